@@ -7,6 +7,21 @@ solution "IronMogFF7"
     configurations { "Release", "Debug" }
     platforms { "x86_64" }
 
+    -- Shared by every project.
+    language "C++"
+    cppdialect "C++17"
+    exceptionhandling "Off"
+    rtti "Off"
+    warnings "Default"
+    characterset "ASCII"
+    location ("build/" .. _ACTION)
+
+    defines {
+        "_CRT_SECURE_NO_WARNINGS",
+        "_CRT_NONSTDC_NO_DEPRECATE",
+        "_USE_MATH_DEFINES",
+    }
+
     filter "platforms:x86_64"
         architecture "x86_64"
 
@@ -22,23 +37,62 @@ solution "IronMogFF7"
 
     filter {}
 
+-- Rules and extras register themselves from static constructors that nothing else references, so
+-- projects link the whole core library rather than only the objects they use.
+function linkCore()
+    links { "IronMogCore" }
+
+    filter "system:windows"
+        linkoptions { "/WHOLEARCHIVE:IronMogCore.lib" }
+
+    filter "system:linux"
+        libdirs { "%{cfg.targetdir}" }
+        linkoptions { "-Wl,--whole-archive", "-lIronMogCore", "-Wl,--no-whole-archive" }
+
+    filter {}
+end
+
+-- Everything that runs the rules, with no window, display or ImGui dependencies. The rules' settings
+-- and debug views are only built with IRONMOG_GUI, see IronMogFF7.
+project "IronMogCore"
+    kind "StaticLib"
+
+    includedirs {
+        path.join(ROOT_DIR, "src/"),
+    }
+
+    files {
+        path.join(ROOT_DIR, "src/core/**.cpp"),
+        path.join(ROOT_DIR, "src/core/**.c"),
+        path.join(ROOT_DIR, "src/core/**.h"),
+        path.join(ROOT_DIR, "src/rules/**.cpp"),
+        path.join(ROOT_DIR, "src/rules/**.h"),
+        path.join(ROOT_DIR, "src/extras/**.cpp"),
+        path.join(ROOT_DIR, "src/extras/**.h")
+    }
+
+    removefiles {
+        path.join(ROOT_DIR, "src/core/gui/GUI.*"),
+        path.join(ROOT_DIR, "src/core/gui/GUIWidgets.cpp"),
+        path.join(ROOT_DIR, "src/core/gui/IconsFontAwesome5.h"),
+        path.join(ROOT_DIR, "src/core/gui/imgui_impl_*")
+    }
+
+    filter "system:windows"
+        removefiles { path.join(ROOT_DIR, "src/core/utilities/PlatformLinux.cpp") }
+
+    filter "system:linux"
+        removefiles { path.join(ROOT_DIR, "src/core/utilities/PlatformWindows.cpp") }
+
+    filter {}
+
+-- The app builds the core sources itself with IRONMOG_GUI rather than linking IronMogCore, so the rules
+-- come with their settings and debug views.
 project "IronMogFF7"
     kind "WindowedApp"
-    language "C++"
-    cppdialect "C++17"
-    exceptionhandling "Off"
-    rtti "Off"
-    warnings "Default"
-    characterset "ASCII"
-    location ("build/" .. _ACTION)
-
     debugdir "./"
 
-    defines {
-        "_CRT_SECURE_NO_WARNINGS",
-        "_CRT_NONSTDC_NO_DEPRECATE",
-        "_USE_MATH_DEFINES",
-    }
+    defines { "IRONMOG_GUI" }
 
     includedirs {
         path.join(ROOT_DIR, "src/"),
@@ -49,14 +103,86 @@ project "IronMogFF7"
     }
 
     files { 
-        path.join(ROOT_DIR, "src/**.cpp"),
-        path.join(ROOT_DIR, "src/**.c"),
-        path.join(ROOT_DIR, "src/**.h")
+        path.join(ROOT_DIR, "src/app/**.cpp"),
+        path.join(ROOT_DIR, "src/app/**.h"),
+        path.join(ROOT_DIR, "src/main.cpp"),
+        path.join(ROOT_DIR, "src/core/**.cpp"),
+        path.join(ROOT_DIR, "src/core/**.c"),
+        path.join(ROOT_DIR, "src/core/**.h"),
+        path.join(ROOT_DIR, "src/rules/**.cpp"),
+        path.join(ROOT_DIR, "src/rules/**.h"),
+        path.join(ROOT_DIR, "src/extras/**.cpp"),
+        path.join(ROOT_DIR, "src/extras/**.h")
     }
 
+    removefiles { path.join(ROOT_DIR, "src/core/utilities/PlatformLinux.cpp") }
+
     links { 
         "opengl32",
         path.join(LIB_DIR, "glfw/lib/Release/glfw3"),
         path.join(LIB_DIR, "stb/lib/Release/stb"),
         path.join(LIB_DIR, "nativefiledialog-extended/lib/Release/nfd")
-    }
\ No newline at end of file
+    }
+
+-- Runs the rules from the command line, see src/headless/main.cpp.
+project "IronMogHeadless"
+    kind "ConsoleApp"
+    debugdir "./"
+
+    includedirs {
+        path.join(ROOT_DIR, "src/"),
+    }
+
+    files {
+        path.join(ROOT_DIR, "src/headless/**.cpp"),
+        path.join(ROOT_DIR, "src/headless/**.h")
+    }
+
+    linkCore()
+
+    filter "system:linux"
+        links { "pthread", "dl" }
+
+    filter {}
+
+-- Replays a recorded RAM trace and reports timings as JSON, see src/bench/main.cpp.
+project "IronMogBench"
+    kind "ConsoleApp"
+    debugdir "./"
+
+    includedirs {
+        path.join(ROOT_DIR, "src/"),
+    }
+
+    files {
+        path.join(ROOT_DIR, "src/bench/**.cpp"),
+        path.join(ROOT_DIR, "src/bench/**.h")
+    }
+
+    linkCore()
+
+    filter "system:linux"
+        links { "pthread", "dl" }
+
+    filter {}
+
+-- Times single functions against RAM images built from GameData, see src/microbench/main.cpp.
+project "IronMogMicroBench"
+    kind "ConsoleApp"
+    debugdir "./"
+
+    includedirs {
+        path.join(ROOT_DIR, "src/"),
+    }
+
+    files {
+        path.join(ROOT_DIR, "src/microbench/**.cpp"),
+        path.join(ROOT_DIR, "src/microbench/**.h")
+    }
+
+    linkCore()
+
+    filter "system:linux"
+        links { "pthread", "dl" }
+
+    filter {}
@@ -12,6 +12,7 @@
 #include "rules/Rule.h"
 
 #include <imgui.h>
+#include <algorithm>
 #include <random>
 
 #include <filesystem>
@@ -20,6 +21,7 @@ namespace fs = std::filesystem;
 void App::run()
 {
     LOG("IronMog FF7 %s", APP_VERSION_STRING);
+    startTime = Utilities::getTimeMS();
 
     processMemoryOffset[0] = '\0';
 
@@ -32,58 +34,29 @@ void App::run()
     BIND_EVENT_TWO_ARG(gui.onKeyPress, App::onKeyPress);
     generateSeed();
 
-    // Load images
-    logo.loadFromFile("resources/logo.png");
-    characterPortraits.resize(9);
-    characterPortraits[0].loadFromFile("resources/cloud.png");
-    characterPortraits[1].loadFromFile("resources/barret.png");
-    characterPortraits[2].loadFromFile("resources/tifa.png");
-    characterPortraits[3].loadFromFile("resources/aerith.png");
-    characterPortraits[4].loadFromFile("resources/red.png");
-    characterPortraits[5].loadFromFile("resources/yuffie.png");
-    characterPortraits[6].loadFromFile("resources/caitsith.png");
-    characterPortraits[7].loadFromFile("resources/vincent.png");
-    characterPortraits[8].loadFromFile("resources/cid.png");
-
-    deadIcon.loadFromFile("resources/dead.png");
-
-    // Load any settings files
-    {
-        const std::string settingsDir = "settings";
+    // Always first in the list so we can switch to it when settings are changed.
+    availableSettings.push_back("Custom");
 
-        // Always first in the list so we can switch to it when settings are changed.
-        availableSettings.push_back("Custom");
+    beginStartup();
 
-        // Special case for default settings file
-        if (fs::exists(settingsDir + "/Default.cfg"))
+    while (true)
+    {
+        if (gui.wasWindowClosed())
         {
-            availableSettings.push_back("Default");
-            selectedSettingsIdx = 1;
-            loadSettings(settingsDir + "/Default.cfg");
+            break;
         }
 
-        if (fs::exists(settingsDir) && fs::is_directory(settingsDir))
+        gui.setIdleRefreshRate(currentPanel == Panels::Settings ? IdleRefreshRate : TrackerRefreshRate);
+        redrawOnStateChange = (currentPanel == Panels::Debug);
+        // Only the tracker and debug panels show state views, the manager skips building them otherwise.
+        if (connectionState == ConnectionState::Connected)
         {
-            for (const auto& entry : fs::directory_iterator(settingsDir))
-            {
-                if (entry.path().stem() == "Default")
-                {
-                    continue;
-                }
-
-                if (entry.is_regular_file() && entry.path().extension() == ".cfg")
-                {
-                    availableSettings.push_back(entry.path().stem().string());
-                }
-            }
+            game->setStateViewRequested(currentPanel != Panels::Settings);
         }
-    }
 
-    while (true)
-    {
-        if (gui.wasWindowClosed())
+        if (!startupComplete)
         {
-            break;
+            updateStartup();
         }
 
         if (!gui.beginFrame())
@@ -112,6 +85,12 @@ void App::run()
 
         gui.endFrame();
 
+        if (!firstFrameDrawn)
+        {
+            LOG("Time to first frame: %.1lfms", Utilities::getTimeMS() - startTime);
+            firstFrameDrawn = true;
+        }
+
         // Check to see if the game manager thread exited from an error and clean up.
         if (connectionState == ConnectionState::Error && !managerRunning && managerThread != nullptr)
         {
@@ -127,6 +106,128 @@ void App::run()
     gui.destroy();
 }
 
+// Each task wakes the GUI when it finishes so its result is picked up by the next updateStartup() rather
+// than waiting for the idle refresh.
+void App::beginStartup()
+{
+    // Images
+    std::vector<std::pair<GUIImage*, std::string>> images = { { &logo, "resources/logo.png" }, { &deadIcon, "resources/dead.png" } };
+
+    const char* portraitNames[] = { "cloud", "barret", "tifa", "aerith", "red", "yuffie", "caitsith", "vincent", "cid" };
+    characterPortraits.resize(9);
+    for (int i = 0; i < 9; ++i)
+    {
+        images.push_back({ &characterPortraits[i], std::string("resources/") + portraitNames[i] + ".png" });
+    }
+
+    for (const auto& [image, path] : images)
+    {
+        PendingImage& pending = pendingImages.emplace_back();
+        pending.image = image;
+        pending.data = std::async(std::launch::async, [this, path]()
+        {
+            GUIImageData data;
+            data.loadFromFile(path.c_str());
+            gui.requestRedraw();
+            return data;
+        });
+    }
+
+    // Settings files, the default settings are parsed here too but applied on the GUI thread.
+    pendingSettings = std::async(std::launch::async, [this]()
+    {
+        const std::string settingsDir = "settings";
+
+        SettingsList list;
+        list.hasDefault = list.defaultSettings.load(settingsDir + "/Default.cfg");
+        if (fs::exists(settingsDir) && fs::is_directory(settingsDir))
+        {
+            for (const auto& entry : fs::directory_iterator(settingsDir))
+            {
+                if (entry.path().stem() == "Default")
+                {
+                    continue;
+                }
+
+                if (entry.is_regular_file() && entry.path().extension() == ".cfg")
+                {
+                    list.names.push_back(entry.path().stem().string());
+                }
+            }
+        }
+        gui.requestRedraw();
+        return list;
+    });
+
+    // Extras, eg the music index
+    for (auto& extra : Extra::getList())
+    {
+        pendingLoads.push_back(std::async(std::launch::async, [this, extra]()
+        {
+            std::function<void()> apply = extra->loadAsync();
+            gui.requestRedraw();
+            return apply;
+        }));
+    }
+}
+
+void App::updateStartup()
+{
+    auto isReady = [](auto& future) { return future.valid() && future.wait_for(std::chrono::seconds(0)) == std::future_status::ready; };
+
+    for (PendingImage& pending : pendingImages)
+    {
+        if (isReady(pending.data))
+        {
+            pending.image->loadFromData(pending.data.get());
+            gui.requestRedraw();
+        }
+    }
+
+    if (isReady(pendingSettings))
+    {
+        SettingsList list = pendingSettings.get();
+        if (list.hasDefault)
+        {
+            availableSettings.push_back("Default");
+            selectedSettingsIdx = 1;
+            LOG("Loaded settings from: settings/Default.cfg");
+            applySettings(list.defaultSettings);
+        }
+
+        for (const std::string& name : list.names)
+        {
+            availableSettings.push_back(name);
+        }
+        gui.requestRedraw();
+    }
+
+    for (auto& load : pendingLoads)
+    {
+        if (isReady(load))
+        {
+            std::function<void()> apply = load.get();
+            if (apply)
+            {
+                apply();
+            }
+            gui.requestRedraw();
+        }
+    }
+
+    // Futures are invalid once their result has been taken.
+    startupComplete = !pendingSettings.valid() &&
+        std::none_of(pendingImages.begin(), pendingImages.end(), [](const PendingImage& pending) { return pending.data.valid(); }) &&
+        std::none_of(pendingLoads.begin(), pendingLoads.end(), [](const auto& load) { return load.valid(); });
+
+    if (startupComplete)
+    {
+        pendingImages.clear();
+        pendingLoads.clear();
+        LOG("Startup finished: %.1lfms", Utilities::getTimeMS() - startTime);
+    }
+}
+
 void App::connect()
 {
     if (managerThread != nullptr)
@@ -174,6 +275,7 @@ void App::runGameManager()
     }
 
     game = new GameManager();
+    game->loadTransitionStats();
     BIND_EVENT(game->onStart, App::onStart);
 
     connectionState = ConnectionState::Connecting;
@@ -203,11 +305,13 @@ void App::runGameManager()
     {
         connectionState = ConnectionState::Connected;
         connectionStatus = "Connected to emulator.";
+        gui.requestRedraw();
     }
     else
     {
         connectionState = ConnectionState::Error;
         connectionStatus = "Failed to connect to emulator.";
+        gui.requestRedraw();
         return;
     }
 
@@ -217,6 +321,7 @@ void App::runGameManager()
     game->setup(Utilities::hexStringToSeed(seedValue));
 
     managerRunning = true;
+    uint32_t lastViewVersion = 0;
     while (managerRunning.load())
     {
         if (!game->update())
@@ -224,10 +329,31 @@ void App::runGameManager()
             // If update returns false then a fatal error occured.
             connectionState = ConnectionState::Error;
             connectionStatus = "Connection lost.";
+            gui.requestRedraw();
             break;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        if (redrawOnStateChange.load())
+        {
+            std::shared_ptr<const GameManager::GameStateView> stateView = game->getStateView();
+            if (stateView != nullptr && stateView->version != lastViewVersion)
+            {
+                lastViewVersion = stateView->version;
+                gui.requestRedraw();
+            }
+        }
+
+        // Poll as fast as we can during fast forward so time critical rules keep up.
+        if (game->isFastForwarding())
+        {
+            std::this_thread::yield();
+        }
+        else
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
     }
+    game->saveTransitionStats();
     managerRunning = false;
 }
 
@@ -246,26 +372,16 @@ void App::loadSettings(const std::string& filePath)
     if (cfg.load(filePath))
     {
         LOG("Loaded settings from: %s", filePath.c_str());
+        applySettings(cfg);
+    }
+}
 
-        std::string seedStr = cfg.get<std::string>("seed", seedValue);
-        snprintf(seedValue, sizeof(seedValue), "%s", seedStr.c_str());
-
-        for (auto& rule : Rule::getList())
-        {
-            cfg.keyPrefix = Utilities::sanitizeName(rule->name) + ".";
-            rule->loadSettings(cfg);
-            rule->enabled = cfg.get<bool>("enabled", rule->enabled);
-            cfg.keyPrefix = "";
+void App::applySettings(ConfigFile& cfg)
+{
+    std::string seedStr = cfg.get<std::string>("seed", seedValue);
+    snprintf(seedValue, sizeof(seedValue), "%s", seedStr.c_str());
 
-        }
-        for (auto& extra : Extra::getList())
-        {
-            cfg.keyPrefix = Utilities::sanitizeName(extra->name) + ".";
-            extra->loadSettings(cfg);
-            extra->enabled = cfg.get<bool>("enabled", extra->enabled);
-            cfg.keyPrefix = "";
-        }
-    }
+    GameManager::loadRuleSettings(cfg);
 }
 
 void App::saveSettings(const std::string& filePath, bool saveSeed)
@@ -2,9 +2,11 @@
 
 #include "core/game/GameManager.h"
 #include "core/gui/GUI.h"
+#include "core/utilities/ConfigFile.h"
 #include "core/utilities/StringList.h"
 
 #include <atomic>
+#include <future>
 #include <thread>
 
 #define APP_WINDOW_WIDTH 497
@@ -42,6 +44,7 @@ public:
     void run();
     void generateSeed();
     void loadSettings(const std::string& filePath);
+    void applySettings(ConfigFile& cfg);
     void saveSettings(const std::string& filePath, bool saveSeed = false);
 
     void drawSettingsPanel();
@@ -65,6 +68,11 @@ protected:
     std::atomic<bool> managerRunning = false;
     GameManager::GameState previousState = GameManager::GameState::BootScreen;
 
+    // How often panels are redrawn without input, the debug panel also redraws on every new state view.
+    static constexpr double IdleRefreshRate = 1.0;
+    static constexpr double TrackerRefreshRate = 4.0;
+    std::atomic<bool> redrawOnStateChange = false;
+
     EmulatorType selectedEmulatorType = EmulatorType::DuckStation;
 
     StringList availableSettings;
@@ -80,4 +88,29 @@ protected:
 
     void onKeyPress(int key, int mods);
     void onStart();
+
+    // Startup work runs on worker threads while the window is already up, finished
+    // tasks are applied on the GUI thread by updateStartup().
+    struct PendingImage
+    {
+        GUIImage* image = nullptr;
+        std::future<GUIImageData> data;
+    };
+
+    struct SettingsList
+    {
+        std::vector<std::string> names;
+        bool hasDefault = false;
+        ConfigFile defaultSettings;
+    };
+
+    std::vector<PendingImage> pendingImages;
+    std::future<SettingsList> pendingSettings;
+    std::vector<std::future<std::function<void()>>> pendingLoads;
+    double startTime = 0.0;
+    bool startupComplete = false;
+    bool firstFrameDrawn = false;
+
+    void beginStartup();
+    void updateStartup();
 };
\ No newline at end of file
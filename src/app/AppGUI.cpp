@@ -1,6 +1,7 @@
 #include "App.h"
 #include "core/game/GameData.h"
 #include "core/game/MemoryOffsets.h"
+#include "core/game/MemoryStructs.h"
 #include "core/gui/IconsFontAwesome5.h"
 #include "core/utilities/Logging.h"
 #include "core/utilities/MemorySearch.h"
@@ -11,10 +12,13 @@
 #include "rules/Permadeath.h"
 #include "rules/Rule.h"
 
+#include <filesystem>
 #include <imgui.h>
 
 static const char* emulators[]{ "DuckStation", "BizHawk", "Custom" };
 
+static const uint32_t ioTagDebugPanel = IOStats::registerTag("Debug Panel");
+
 static ImColor dotRed(1.0f, 0.0f, 0.0f, 1.0f);
 static ImColor dotYellow(1.0f, 1.0f, 0.0f, 1.0f);
 static ImColor dotGreen(0.0f, 1.0f, 0.0f, 1.0f);
@@ -27,7 +31,7 @@ void App::drawSettingsPanel()
     bool lockSettings = connectionState > ConnectionState::NotConnected && connectionState < ConnectionState::Error;
     if (lockSettings && connectionState == ConnectionState::Connected)
     {
-        GameManager::GameState state = game->getState();
+        GameManager::GameState state = game->getLastState();
         lockSettings &= (state == GameManager::GameState::InGame);
 
         // Save the current configuration in case of a crash, etc
@@ -212,12 +216,13 @@ void App::drawTrackerPanel()
     ImGui::Spacing();
     ImGui::BeginChild("##ScrollBox", ImVec2(0, APP_WINDOW_HEIGHT - 212));
     {
-        if (connectionState == ConnectionState::Connected)
+        std::shared_ptr<const GameManager::GameStateView> stateView = (connectionState == ConnectionState::Connected) ? game->getStateView() : nullptr;
+        if (stateView != nullptr)
         {
             // Permadeath Character Portraits
             {
                 Permadeath* permadeathRule = (Permadeath*)game->getRule("Permadeath");
-                uint16_t phsVisMask = game->read<uint16_t>(GameOffsets::PHSVisibilityMask);
+                uint16_t phsVisMask = stateView->phsVisibilityMask;
 
                 const int imgWidth = 46;
                 const int imgHeight = 53;
@@ -238,7 +243,7 @@ void App::drawTrackerPanel()
 
                     if (permadeathRule != nullptr)
                     {
-                        if (permadeathRule->isCharacterDead(characterID))
+                        if (permadeathRule->isCharacterDead(characterID) && deadIcon.textureID != 0)
                         {
                             ImGui::GetWindowDrawList()->AddImage((ImTextureID)deadIcon.textureID, p, ImVec2(p.x + imgWidth, p.y + imgHeight), ImVec2(0, 0), ImVec2(1, 1));
                         }
@@ -256,8 +261,7 @@ void App::drawTrackerPanel()
             ImGui::Text(seedText.c_str());
 
             // In Game Time
-            uint32_t igt = game->read<uint32_t>(GameOffsets::InGameTime);
-            std::string igtText = "Time: " + Utilities::formatTime(igt);
+            std::string igtText = "Time: " + Utilities::formatTime(stateView->inGameTime);
             ImGui::Text(igtText.c_str());
 
             // Current Song
@@ -359,7 +363,15 @@ void App::drawDebugPanel()
         return;
     }
 
-    GameManager::GameState gameState = game->getState();
+    IOTagScope ioScope(ioTagDebugPanel);
+
+    std::shared_ptr<const GameManager::GameStateView> stateView = game->getStateView();
+    if (stateView == nullptr)
+    {
+        return;
+    }
+
+    GameManager::GameState gameState = stateView->state;
     {
         std::string gameStateText = "State: ";
         if (gameState == GameManager::GameState::BootScreen) gameStateText += "Boot";
@@ -370,71 +382,84 @@ void App::drawDebugPanel()
     }
 
     // IronMog Frame Update Time
-    double updateDuration = game->getLastUpdateDuration();
+    double updateDuration = stateView->lastUpdateDuration;
     std::string updateDurationText = "IronMog Update Time: " + std::to_string(updateDuration) + "ms";
     ImGui::Text(updateDurationText.c_str());
 
+    // Frame Accounting
+    const GameManager::FrameStats& frameStats = stateView->frameStats;
+    std::string frameRateText = "Frame Rate: " + std::to_string(frameStats.framesPerSecond) + "fps" + (stateView->fastForwarding ? " (Fast Forward)" : "");
+    ImGui::Text(frameRateText.c_str());
+    std::string missedFramesText = "Missed Frames: " + std::to_string(frameStats.missedFrames) + " of " + std::to_string(frameStats.totalFrames) + " (Max Gap: " + std::to_string(frameStats.maxElapsedFrames) + ")";
+    ImGui::Text(missedFramesText.c_str());
+    std::string loadsText = "Loads Detected: " + std::to_string(frameStats.loadsDetected);
+    GameManager::LoadType lastLoadType = stateView->lastLoadType;
+    if (lastLoadType == GameManager::LoadType::NewGame) loadsText += " (Last: New Game)";
+    if (lastLoadType == GameManager::LoadType::SameSave) loadsText += " (Last: Same Save)";
+    if (lastLoadType == GameManager::LoadType::DifferentSave) loadsText += " (Last: Different Save)";
+    ImGui::Text(loadsText.c_str());
+
+    // Memory Invariants
+    std::string invariantText = "Invariant Violations: " + std::to_string(stateView->invariantViolationsPerSecond) + "/s (" + std::to_string(stateView->invariantCount) + " invariants)";
+    ImGui::Text(invariantText.c_str());
+
     // Frame Number
-    uint32_t frameNumber = game->read<uint32_t>(GameOffsets::FrameNumber);
-    std::string frameNumberText = "Frame Number: " + std::to_string(frameNumber);
+    std::string frameNumberText = "Frame Number: " + std::to_string(stateView->frameNumber);
     ImGui::Text(frameNumberText.c_str());
 
     // In Game Time
-    uint32_t igt = game->read<uint32_t>(GameOffsets::InGameTime);
-    std::string igtText = "In Game Time: " + Utilities::formatTime(igt);
+    std::string igtText = "In Game Time: " + Utilities::formatTime(stateView->inGameTime);
     ImGui::Text(igtText.c_str());
 
     // Game Moment
-    uint16_t moment = game->getGameMoment();
-    std::string momentText = "Game Moment: " + std::to_string(moment);
+    std::string momentText = "Game Moment: " + std::to_string(stateView->gameMoment);
     ImGui::Text(momentText.c_str());
 
     // Module ID
-    uint8_t gameModule = game->read<uint8_t>(GameOffsets::CurrentModule);
-    std::string moduleText = "Module: " + std::to_string(gameModule);
+    std::string moduleText = "Module: " + std::to_string(stateView->gameModule);
     ImGui::Text(moduleText.c_str());
 
     // Music ID
-    uint16_t musicID = game->read<uint16_t>(GameOffsets::MusicID);
-    std::string musicText = "Music: " + std::to_string(musicID);
+    std::string musicText = "Music: " + std::to_string(stateView->musicID);
     ImGui::Text(musicText.c_str());
 
     // Field ID
-    uint16_t fieldID = game->read<uint16_t>(GameOffsets::FieldID);
-    std::string fieldText = "Field ID: " + std::to_string(fieldID);
+    std::string fieldText = "Field ID: " + std::to_string(stateView->fieldID);
     ImGui::Text(fieldText.c_str());
 
     // Formation
-    uint16_t formationID = game->read<uint16_t>(BattleOffsets::FormationID);
-    std::string formationText = "Formation: " + std::to_string(formationID);
+    std::string formationText = "Formation: " + std::to_string(stateView->formationID);
     ImGui::Text(formationText.c_str());
 
     // Party Members
     {
-        uint8_t party0 = game->read<uint8_t>(GameOffsets::PartyIDList + 0);
-        uint8_t party1 = game->read<uint8_t>(GameOffsets::PartyIDList + 1);
-        uint8_t party2 = game->read<uint8_t>(GameOffsets::PartyIDList + 2);
-        std::string partyText = "Party: " + std::to_string(party0) + " " + std::to_string(party1) + " " + std::to_string(party2);
+        const std::array<uint8_t, 3>& partyIDs = stateView->partyIDs;
+        std::string partyText = "Party: " + std::to_string(partyIDs[0]) + " " + std::to_string(partyIDs[1]) + " " + std::to_string(partyIDs[2]);
         ImGui::Text(partyText.c_str());
+
+        std::string partyHPText = "Party HP:";
+        for (int i = 0; i < 3; ++i)
+        {
+            if (partyIDs[i] != 0xFF)
+            {
+                partyHPText += " " + std::to_string(stateView->partyHP[i]) + "/" + std::to_string(stateView->partyMaxHP[i]);
+            }
+        }
+        ImGui::Text(partyHPText.c_str());
+
+        std::string gilText = "Gil: " + std::to_string(stateView->gil);
+        ImGui::Text(gilText.c_str());
     }
 
     // Player Position
-    int position[3];
-    if (game->getGameModule() == GameModule::World)
+    const std::array<int32_t, 3>& position = stateView->position;
+    if (stateView->gameModule == GameModule::World)
     {
-        position[0] = game->read<int>(WorldOffsets::WorldX);
-        position[1] = game->read<int>(WorldOffsets::WorldY);
-        position[2] = game->read<int>(WorldOffsets::WorldZ);
-
         std::string positionText = "Position: " + std::to_string(position[0]) + ", " + std::to_string(position[1]) + ", " + std::to_string(position[2]);
         ImGui::Text(positionText.c_str());
     }
     else 
     {
-        position[0] = game->read<int>(FieldOffsets::FieldX);
-        position[1] = game->read<int>(FieldOffsets::FieldY);
-        position[2] = game->read<int>(FieldOffsets::FieldZ);
-
         float fx = position[0] / 4096.0f;
         float fy = position[1] / 4096.0f;
         float fz = position[2] / 4096.0f;
@@ -442,8 +467,7 @@ void App::drawDebugPanel()
         std::string positionText = "Position: " + std::to_string(fx) + ", " + std::to_string(fy) + ", " + std::to_string(fz);
         ImGui::Text(positionText.c_str());
 
-        uint16_t triangle = game->read<uint16_t>(FieldOffsets::Triangle);
-        std::string triangleText = "Triangle: " + std::to_string(triangle);
+        std::string triangleText = "Triangle: " + std::to_string(stateView->triangle);
         ImGui::Text(triangleText.c_str());
     }
 
@@ -463,9 +487,158 @@ void App::drawDebugPanel()
         ImGui::SameLine();
         if (ImGui::Button("Warp To Field"))
         {
-            uint16_t warpFieldID = atoi(debugWarpFieldID);
-            game->write<uint16_t>(GameOffsets::FieldWarpID, warpFieldID);
-            game->write<uint8_t>(GameOffsets::FieldWarpTrigger, 1);
+            GameManager::GameCommand command;
+            command.type = GameManager::GameCommand::Type::WarpToField;
+            command.value = (uint16_t)atoi(debugWarpFieldID);
+            game->queueCommand(std::move(command));
+        }
+
+        ImGui::Unindent(25.0f);
+    }
+
+    if (ImGui::CollapsingHeader("Memory I/O"))
+    {
+        ImGui::Indent(25.0f);
+
+        IOStats& ioStats = game->getIOStats();
+        const IOStats::Snapshot& lastFrame = ioStats.getLastFrame();
+        const IOStats::Snapshot& maxFrame = ioStats.getMaxFrame();
+        ImGui::Text("Last Frame: %llu reads (%llu bytes), %llu writes (%llu bytes), %llu errors", lastFrame.reads, lastFrame.readBytes, lastFrame.writes, lastFrame.writeBytes, lastFrame.errors);
+        ImGui::Text("Max Frame: %llu reads (%llu bytes), %llu writes (%llu bytes)", maxFrame.reads, maxFrame.readBytes, maxFrame.writes, maxFrame.writeBytes);
+
+        if (ImGui::BeginTable("##IOTags", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Tag");
+            ImGui::TableSetupColumn("Reads");
+            ImGui::TableSetupColumn("Read Bytes");
+            ImGui::TableSetupColumn("Writes");
+            ImGui::TableSetupColumn("Errors");
+            ImGui::TableHeadersRow();
+
+            for (uint32_t i = 0; i < IOStats::getTagCount(); ++i)
+            {
+                IOStats::Snapshot tagTotals = ioStats.getTagTotals(i);
+                if (tagTotals.reads == 0 && tagTotals.writes == 0)
+                {
+                    continue;
+                }
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text(IOStats::getTagName(i));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", tagTotals.reads);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", tagTotals.readBytes);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", tagTotals.writes);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", tagTotals.errors);
+            }
+
+            ImGui::EndTable();
+        }
+
+        // Heatmap of PS1 RAM, one cell per bucket. Reads are shown in green and writes in red,
+        // brightness is relative to the busiest bucket.
+        {
+            const int columns = 128;
+            const float cellSize = 3.0f;
+            const int rows = IOStats::BucketCount / columns;
+
+            uint32_t maxReads = 1;
+            uint32_t maxWrites = 1;
+            for (uint32_t i = 0; i < IOStats::BucketCount; ++i)
+            {
+                maxReads = std::max(maxReads, ioStats.getBucketReads(i));
+                maxWrites = std::max(maxWrites, ioStats.getBucketWrites(i));
+            }
+
+            ImVec2 origin = ImGui::GetCursorScreenPos();
+            ImDrawList* drawList = ImGui::GetWindowDrawList();
+            for (uint32_t i = 0; i < IOStats::BucketCount; ++i)
+            {
+                float readHeat = ioStats.getBucketReads(i) / (float)maxReads;
+                float writeHeat = ioStats.getBucketWrites(i) / (float)maxWrites;
+                if (readHeat == 0.0f && writeHeat == 0.0f)
+                {
+                    continue;
+                }
+
+                ImVec2 cellMin(origin.x + (i % columns) * cellSize, origin.y + (i / columns) * cellSize);
+                ImVec2 cellMax(cellMin.x + cellSize, cellMin.y + cellSize);
+                drawList->AddRectFilled(cellMin, cellMax, ImColor(0.2f + 0.8f * writeHeat, 0.2f + 0.8f * readHeat, 0.2f));
+            }
+
+            ImGui::InvisibleButton("##IOHeatmap", ImVec2(columns * cellSize, rows * cellSize));
+            if (ImGui::IsItemHovered())
+            {
+                ImVec2 mouse = ImGui::GetMousePos();
+                int column = (int)((mouse.x - origin.x) / cellSize);
+                int row = (int)((mouse.y - origin.y) / cellSize);
+                uint32_t bucket = std::min<uint32_t>(row * columns + column, IOStats::BucketCount - 1);
+                ImGui::SetTooltip("0x%06X: %u reads, %u writes", bucket * IOStats::BucketSize, ioStats.getBucketReads(bucket), ioStats.getBucketWrites(bucket));
+            }
+        }
+
+        if (ImGui::Button("Export I/O Stats"))
+        {
+            std::filesystem::create_directories("stats");
+            ioStats.exportCSV("stats/IO Stats.csv");
+            LOG("Exported I/O stats to stats/IO Stats.csv");
+        }
+        ImGui::SameLine();
+        if (ImGui::Button("Reset I/O Stats"))
+        {
+            ioStats.reset();
+        }
+
+        ImGui::Unindent(25.0f);
+    }
+
+    if (ImGui::CollapsingHeader("Transitions"))
+    {
+        ImGui::Indent(25.0f);
+
+        TransitionTracker& tracker = game->getTransitionTracker();
+        const std::map<uint32_t, TransitionTracker::Stats>& transitionStats = tracker.getStats();
+        std::vector<uint32_t> slowest = tracker.getSlowest(15);
+
+        if (ImGui::BeginTable("##SlowestTransitions", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+        {
+            ImGui::TableSetupColumn("Transition");
+            ImGui::TableSetupColumn("Count");
+            ImGui::TableSetupColumn("Detect (frames)");
+            ImGui::TableSetupColumn("Detect (ms)");
+            ImGui::TableSetupColumn("Patch (us)");
+            ImGui::TableSetupColumn("Slowest Listener");
+            ImGui::TableHeadersRow();
+
+            for (uint32_t key : slowest)
+            {
+                const TransitionTracker::Stats& entry = transitionStats.at(key);
+
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::Text(TransitionTracker::getName(key).c_str());
+                ImGui::TableNextColumn();
+                ImGui::Text("%u", entry.count);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f (max %u)", (double)entry.totalDetectFrames / entry.count, entry.maxDetectFrames);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f (max %.1f)", entry.totalDetectMS / entry.count, entry.maxDetectMS);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.0f (max %.0f)", entry.totalPatchMS * 1000.0 / entry.count, entry.maxPatchMS * 1000.0);
+                ImGui::TableNextColumn();
+                ImGui::Text("#%d %.0fus", entry.slowestListener, entry.maxListenerMS * 1000.0);
+            }
+
+            ImGui::EndTable();
+        }
+
+        if (ImGui::Button("Save Transition Stats"))
+        {
+            game->saveTransitionStats();
         }
 
         ImGui::Unindent(25.0f);
@@ -475,8 +648,7 @@ void App::drawDebugPanel()
     {
         ImGui::Indent(25.0f);
 
-        std::pair<BattleScene*, BattleFormation*> battleData = game->getBattleFormation();
-        BattleFormation* formation = battleData.second;
+        const BattleFormation* formation = stateView->formation;
 
         if (formation != nullptr)
         {
@@ -491,41 +663,33 @@ void App::drawDebugPanel()
                 ImGui::Text(enemyText.c_str());
                 ImGui::Indent(25.0f);
 
-                uint32_t curHP = game->read<uint32_t>(BattleOffsets::Enemies[i] + BattleOffsets::CurrentHP);
-                uint32_t maxHP = game->read<uint32_t>(BattleOffsets::Enemies[i] + BattleOffsets::MaxHP);
-                std::string hpText = "HP: " + std::to_string(curHP) + "/" + std::to_string(maxHP);
+                const BattleCharacter* enemy = &stateView->enemies[i];
+
+                std::string hpText = "HP: " + std::to_string(enemy->currentHP) + "/" + std::to_string(enemy->maxHP);
                 ImGui::Text(hpText.c_str());
 
-                uint16_t curMP = game->read<uint16_t>(BattleOffsets::Enemies[i] + BattleOffsets::CurrentMP);
-                uint16_t maxMP = game->read<uint16_t>(BattleOffsets::Enemies[i] + BattleOffsets::MaxMP);
-                std::string mpText = "MP: " + std::to_string(curMP) + "/" + std::to_string(maxMP);
+                std::string mpText = "MP: " + std::to_string(enemy->currentMP) + "/" + std::to_string(enemy->maxMP);
                 ImGui::Text(mpText.c_str());
 
-                uint8_t str = game->read<uint8_t>(BattleOffsets::Enemies[i] + BattleOffsets::Strength);
-                std::string strText = "Strength: " + std::to_string(str);
+                std::string strText = "Strength: " + std::to_string(enemy->strength);
                 ImGui::Text(strText.c_str());
 
-                uint8_t magic = game->read<uint8_t>(BattleOffsets::Enemies[i] + BattleOffsets::Magic);
-                std::string magicText = "Magic: " + std::to_string(magic);
+                std::string magicText = "Magic: " + std::to_string(enemy->magic);
                 ImGui::Text(magicText.c_str());
 
-                uint8_t evade = game->read<uint8_t>(BattleOffsets::Enemies[i] + BattleOffsets::Evade);
-                std::string evadeText = "Evade: " + std::to_string(evade);
+                std::string evadeText = "Evade: " + std::to_string(enemy->evade);
                 ImGui::Text(evadeText.c_str());
 
-                uint8_t spd = game->read<uint8_t>(BattleOffsets::Enemies[i] + BattleOffsets::Speed);
-                std::string spdText = "Speed: " + std::to_string(spd);
+                std::string spdText = "Speed: " + std::to_string(enemy->speed);
                 ImGui::Text(spdText.c_str());
 
-                uint8_t luck = game->read<uint8_t>(BattleOffsets::Enemies[i] + BattleOffsets::Luck);
-                std::string luckText = "Luck: " + std::to_string(luck);
+                std::string luckText = "Luck: " + std::to_string(enemy->luck);
                 ImGui::Text(luckText.c_str());
 
-                uint16_t def = game->read<uint16_t>(BattleOffsets::Enemies[i] + BattleOffsets::Defense);
-                std::string defText = "Defense: " + std::to_string(def);
+                std::string defText = "Defense: " + std::to_string(enemy->defense);
                 ImGui::Text(defText.c_str());
 
-                uint16_t mDef = game->read<uint16_t>(BattleOffsets::Enemies[i] + BattleOffsets::MDefense);
+                uint16_t mDef = enemy->mDefense;
                 std::string mDefText = "Magic Defense: " + std::to_string(mDef);
                 ImGui::Text(mDefText.c_str());
 
@@ -542,30 +706,22 @@ void App::drawDebugPanel()
 
         if (ImGui::Button("Disable Encounters"))
         {
-            game->write<uint8_t>(0x9AC2F, 0xFF);
+            game->queueWrite<uint8_t>(0x9AC2F, 0xFF);
         }
 
         if (ImGui::Button("Add 10000 Gil"))
         {
-            uint32_t gil = game->read<uint32_t>(GameOffsets::Gil);
-            game->write<uint32_t>(GameOffsets::Gil, gil + 10000);
+            GameManager::GameCommand command;
+            command.type = GameManager::GameCommand::Type::AddGil;
+            command.value = 10000;
+            game->queueCommand(std::move(command));
         }
 
         if (ImGui::Button("Recover Party"))
         {
-            std::array<uint8_t, 3> partyIDs = game->getPartyIDs();
-            for (int i = 0; i < 3; ++i)
-            {
-                uint8_t id = partyIDs[i];
-                if (id == 0xFF)
-                {
-                    continue;
-                }
-
-                uintptr_t characterOffset = getCharacterDataOffset(id);
-                uint16_t maxHP = game->read<uint16_t>(characterOffset + CharacterDataOffsets::MaxHP);
-                game->write<uint16_t>(characterOffset + CharacterDataOffsets::CurrentHP, maxHP);
-            }
+            GameManager::GameCommand command;
+            command.type = GameManager::GameCommand::Type::RecoverParty;
+            game->queueCommand(std::move(command));
         }
 
         // Add item to inventory
@@ -574,51 +730,10 @@ void App::drawDebugPanel()
         ImGui::SameLine();
         if (ImGui::Button("Add Item"))
         {
-            uint16_t addItemID = atoi(debugAddItem);
-            bool foundExistingItem = false;
-
-            for (uint16_t i = 0; i < 320; ++i)
-            {
-                uint16_t itemData = game->read<uint16_t>(GameOffsets::Inventory + (i * 2));
-                uint8_t itemQuantity = (itemData >> 9);
-                uint16_t itemID = (itemData & 0x01FF);
-
-                if (itemID == addItemID)
-                {
-                    itemQuantity++;
-                    if (itemQuantity > 99)
-                    {
-                        itemQuantity = 99;
-                    }
-
-                    uint16_t newItemData = (static_cast<uint16_t>(itemQuantity) << 9) | (itemID & 0x01FF);
-                    game->write<uint16_t>(GameOffsets::Inventory + (i * 2), newItemData);
-
-                    LOG("Cheats: increased inventory item %d to %d", itemID, itemQuantity);
-                    foundExistingItem = true;
-                    break;
-                }
-            }
-
-            if (!foundExistingItem)
-            {
-                for (uint16_t i = 0; i < 320; ++i)
-                {
-                    uint16_t itemData = game->read<uint16_t>(GameOffsets::Inventory + (i * 2));
-
-                    if (itemData != 0xFFFF)
-                    {
-                        continue;
-                    }
-
-                    uint8_t itemQuantity = 1;
-                    uint16_t itemID = addItemID;
-                    uint16_t newItemData = (static_cast<uint16_t>(itemQuantity) << 9) | (itemID & 0x01FF);
-                    game->write<uint16_t>(GameOffsets::Inventory + (i * 2), newItemData);
-                    LOG("Cheats: added item %d to inventory", itemID);
-                    break;
-                }
-            }
+            GameManager::GameCommand command;
+            command.type = GameManager::GameCommand::Type::AddItem;
+            command.value = (uint16_t)atoi(debugAddItem);
+            game->queueCommand(std::move(command));
         }
 
         ImGui::Unindent(25.0f);
@@ -633,6 +748,7 @@ void App::drawDebugPanel()
 
         if (ImGui::CollapsingHeader(rule->name.c_str()))
         {
+            IOTagScope ruleScope(IOStats::registerTag(rule->name.c_str()));
             ImGui::Indent(25.0f);
             rule->onDebugGUI();
             ImGui::Unindent(25.0f);
@@ -648,6 +764,7 @@ void App::drawDebugPanel()
 
         if (ImGui::CollapsingHeader(extra->name.c_str()))
         {
+            IOTagScope extraScope(IOStats::registerTag(extra->name.c_str()));
             ImGui::Indent(25.0f);
             extra->onDebugGUI();
             ImGui::Unindent(25.0f);
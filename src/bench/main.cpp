@@ -0,0 +1,302 @@
+#include "core/emulators/ReplayEmulator.h"
+#include "core/game/GameManager.h"
+#include "core/utilities/ConfigFile.h"
+#include "core/utilities/Event.h"
+#include "core/utilities/Logging.h"
+#include "core/utilities/Utilities.h"
+#include "extras/Extra.h"
+#include "rules/Restrictions.h"
+#include "rules/Rule.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+// Replays a RAM trace recorded with the headless runner through GameManager as fast as it can and
+// reports where the time went as JSON, so runs on different branches can be compared.
+//
+// Usage: IronMogBench --trace <path> [--settings <name>] [--seed <hex>] [--output <path>]
+//
+// Reads and writes are served from memory, their counts are what the same session would cost in
+// calls to the emulator process.
+
+// Every allocation made by the process is counted, only the ones made during updates are reported.
+static std::atomic<uint64_t> allocationCount{ 0 };
+static std::atomic<uint64_t> allocationBytes{ 0 };
+
+void* operator new(size_t size)
+{
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    allocationBytes.fetch_add(size, std::memory_order_relaxed);
+
+    void* memory = malloc(size == 0 ? 1 : size);
+    if (memory == nullptr)
+    {
+        abort();
+    }
+    return memory;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+    free(memory);
+}
+
+struct BenchOptions
+{
+    std::string settings = "Default";
+    std::string trace;
+    std::string seed = "1A2B3C4D";
+    std::string output;
+};
+
+static bool parseOptions(int argc, char** argv, BenchOptions& optionsOut)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (value == nullptr)
+        {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        if (strcmp(arg, "--settings") == 0)    optionsOut.settings = value;
+        else if (strcmp(arg, "--trace") == 0)  optionsOut.trace = value;
+        else if (strcmp(arg, "--seed") == 0)   optionsOut.seed = value;
+        else if (strcmp(arg, "--output") == 0) optionsOut.output = value;
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", arg);
+            return false;
+        }
+        ++i;
+    }
+
+    if (optionsOut.trace.empty())
+    {
+        fprintf(stderr, "Usage: IronMogBench --trace <path> [--settings <name>] [--seed <hex>] [--output <path>]\n");
+        return false;
+    }
+
+    return true;
+}
+
+static std::string escapeJSON(const std::string& text)
+{
+    std::string result;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+static double getPercentile(const std::vector<double>& sortedValues, double percentile)
+{
+    if (sortedValues.empty())
+    {
+        return 0.0;
+    }
+
+    size_t index = (size_t)(percentile * (sortedValues.size() - 1) + 0.5);
+    return sortedValues[std::min(index, sortedValues.size() - 1)];
+}
+
+int main(int argc, char** argv)
+{
+    BenchOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    ConfigFile cfg;
+    std::string settingsPath = "settings/" + options.settings + ".cfg";
+    if (!cfg.load(settingsPath))
+    {
+        fprintf(stderr, "Failed to load settings from: %s\n", settingsPath.c_str());
+        return 1;
+    }
+    GameManager::loadRuleSettings(cfg);
+
+    // There's no audio device to time against.
+    for (auto& extra : Extra::getList())
+    {
+        if (extra->name == "Randomize Music")
+        {
+            extra->enabled = false;
+        }
+    }
+
+    for (auto& extra : Extra::getList())
+    {
+        std::function<void()> apply = extra->loadAsync();
+        if (apply)
+        {
+            apply();
+        }
+    }
+
+    GameManager game;
+    ReplayEmulator* replay = new ReplayEmulator();
+    if (!game.connectToEmulator(replay, options.trace))
+    {
+        fprintf(stderr, "Failed to load trace: %s\n", options.trace.c_str());
+        return 1;
+    }
+
+    Restrictions::reset();
+    game.setup(Utilities::hexStringToSeed(options.seed));
+
+    EventProfiler profiler;
+    EventProfiler::active = &profiler;
+    game.getIOStats().reset();
+
+    std::vector<double> updateTimes;
+    updateTimes.reserve(replay->getFrameCount());
+
+    uint64_t startAllocations = allocationCount.load();
+    uint64_t startAllocationBytes = allocationBytes.load();
+    double startTime = Utilities::getTimeMS();
+
+    bool connectionLost = false;
+    do
+    {
+        double updateStart = Utilities::getTimeMS();
+        if (!game.update())
+        {
+            connectionLost = true;
+            break;
+        }
+        updateTimes.push_back(Utilities::getTimeMS() - updateStart);
+    } while (replay->advance());
+
+    double totalTime = Utilities::getTimeMS() - startTime;
+    uint64_t allocations = allocationCount.load() - startAllocations;
+    uint64_t allocatedBytes = allocationBytes.load() - startAllocationBytes;
+    EventProfiler::active = nullptr;
+
+    if (connectionLost)
+    {
+        fprintf(stderr, "Update failed at frame %zu.\n", replay->getFrameIndex());
+        return 1;
+    }
+
+    std::vector<double> sortedTimes = updateTimes;
+    std::sort(sortedTimes.begin(), sortedTimes.end());
+    size_t updates = updateTimes.size();
+    double meanTime = 0.0;
+    for (double time : updateTimes)
+    {
+        meanTime += time;
+    }
+    meanTime = updates > 0 ? meanTime / updates : 0.0;
+    double perUpdate = updates > 0 ? 1.0 / updates : 0.0;
+
+    FILE* out = stdout;
+    if (!options.output.empty())
+    {
+        out = fopen(options.output.c_str(), "w");
+        if (out == nullptr)
+        {
+            fprintf(stderr, "Failed to open output: %s\n", options.output.c_str());
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n");
+    fprintf(out, "  \"settings\": \"%s\",\n", escapeJSON(options.settings).c_str());
+    fprintf(out, "  \"trace\": \"%s\",\n", escapeJSON(options.trace).c_str());
+    fprintf(out, "  \"seed\": \"%s\",\n", escapeJSON(options.seed).c_str());
+    fprintf(out, "  \"frames\": %zu,\n", updates);
+    fprintf(out, "  \"totalMS\": %.3f,\n", totalTime);
+    fprintf(out, "  \"framesPerSecond\": %.1f,\n", totalTime > 0.0 ? updates * 1000.0 / totalTime : 0.0);
+
+    fprintf(out, "  \"updateMS\": { \"mean\": %.4f, \"p50\": %.4f, \"p99\": %.4f, \"max\": %.4f },\n",
+        meanTime, getPercentile(sortedTimes, 0.50), getPercentile(sortedTimes, 0.99), sortedTimes.empty() ? 0.0 : sortedTimes.back());
+
+    fprintf(out, "  \"allocations\": { \"total\": %llu, \"bytes\": %llu, \"perFrame\": %.2f },\n",
+        (unsigned long long)allocations, (unsigned long long)allocatedBytes, allocations * perUpdate);
+
+    IOStats& ioStats = game.getIOStats();
+    IOStats::Snapshot totals = ioStats.getTotals();
+    fprintf(out, "  \"io\": {\n");
+    fprintf(out, "    \"reads\": %llu, \"writes\": %llu, \"readBytes\": %llu, \"writeBytes\": %llu,\n",
+        (unsigned long long)totals.reads, (unsigned long long)totals.writes, (unsigned long long)totals.readBytes, (unsigned long long)totals.writeBytes);
+    fprintf(out, "    \"callsPerFrame\": %.2f, \"bytesPerFrame\": %.1f,\n",
+        (totals.reads + totals.writes) * perUpdate, (totals.readBytes + totals.writeBytes) * perUpdate);
+    fprintf(out, "    \"tags\": [\n");
+    bool firstTag = true;
+    for (uint32_t tag = 0; tag < IOStats::getTagCount(); ++tag)
+    {
+        IOStats::Snapshot tagTotals = ioStats.getTagTotals(tag);
+        if (tagTotals.reads == 0 && tagTotals.writes == 0)
+        {
+            continue;
+        }
+
+        fprintf(out, "%s      { \"name\": \"%s\", \"reads\": %llu, \"writes\": %llu, \"readBytes\": %llu, \"writeBytes\": %llu }",
+            firstTag ? "" : ",\n", escapeJSON(IOStats::getTagName(tag)).c_str(), (unsigned long long)tagTotals.reads,
+            (unsigned long long)tagTotals.writes, (unsigned long long)tagTotals.readBytes, (unsigned long long)tagTotals.writeBytes);
+        firstTag = false;
+    }
+    fprintf(out, "\n    ]\n  },\n");
+
+    // Owners are rule indices followed by extras, see GameManager::setup().
+    const std::vector<Rule*>& rules = game.getRules();
+    const std::vector<Extra*>& extras = game.getExtras();
+    fprintf(out, "  \"rules\": [\n");
+    bool firstRule = true;
+    for (size_t owner = 0; owner < profiler.owners.size(); ++owner)
+    {
+        const EventProfiler::OwnerStats& stats = profiler.owners[owner];
+        if (stats.calls == 0)
+        {
+            continue;
+        }
+
+        std::string name = owner < rules.size() ? rules[owner]->name : (owner - rules.size() < extras.size() ? extras[owner - rules.size()]->name : "Unknown");
+        fprintf(out, "%s    { \"name\": \"%s\", \"calls\": %llu, \"totalMS\": %.3f, \"perFrameMS\": %.5f }",
+            firstRule ? "" : ",\n", escapeJSON(name).c_str(), (unsigned long long)stats.calls, stats.totalMS, stats.totalMS * perUpdate);
+        firstRule = false;
+    }
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+    {
+        fclose(out);
+    }
+
+    return 0;
+}
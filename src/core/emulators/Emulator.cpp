@@ -87,10 +87,12 @@ bool Emulator::read(uintptr_t offset, void* outBuffer, size_t size)
     if (!Platform::read(processHandle, ps1BaseAddress + offset, outBuffer, size))
     {
         readErrorCount++;
+        ioStats.recordRead(offset, size, false);
         LOG("Failed to read memory from: %d", offset);
         return false;
     }
 
+    ioStats.recordRead(offset, size, true);
     return true;
 }
 
@@ -99,10 +101,12 @@ bool Emulator::write(uintptr_t offset, void* inValue, size_t size)
     if (!Platform::write(processHandle, ps1BaseAddress + offset, inValue, size))
     {
         writeErrorCount++;
+        ioStats.recordWrite(offset, size, false);
         LOG("Failed to write memory to: %d", offset);
         return false;
     }
 
+    ioStats.recordWrite(offset, size, true);
     return true;
 }
 
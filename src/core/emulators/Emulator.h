@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IOStats.h"
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -15,7 +16,7 @@ public:
 
 public:
     Emulator();
-    ~Emulator();
+    virtual ~Emulator();
 
     virtual uintptr_t getPS1MemoryOffset() { return 0; }
     virtual bool connect(std::string processName);
@@ -31,9 +32,12 @@ public:
     // Error counts are reset to 0 when this function returns true.
     bool pollErrors(int errorThreshold = 5);
 
+    IOStats& getIOStats() { return ioStats; }
+
 protected:
     void* processHandle;
     uintptr_t ps1BaseAddress;
     int readErrorCount = 0;
     int writeErrorCount = 0;
+    IOStats ioStats;
 };
\ No newline at end of file
@@ -0,0 +1,183 @@
+#include "IOStats.h"
+
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+
+thread_local uint32_t IOStats::currentTag = 0;
+
+static std::mutex tagMutex;
+static std::atomic<uint32_t> tagCount{ 1 };
+
+// Function local so tags can be registered during static initialization of other files.
+static std::array<std::string, IOStats::MaxTags>& getTagNames()
+{
+    static std::array<std::string, IOStats::MaxTags> tagNames = { "Untagged" };
+    return tagNames;
+}
+
+void IOStats::recordRead(uintptr_t offset, size_t size, bool success)
+{
+    for (uint32_t index : { currentTag, MaxTags })
+    {
+        Counters& counter = counters[index];
+        counter.reads.fetch_add(1, std::memory_order_relaxed);
+        counter.readBytes.fetch_add(size, std::memory_order_relaxed);
+        if (!success)
+        {
+            counter.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    addToBuckets(bucketReads, offset, size);
+}
+
+void IOStats::recordWrite(uintptr_t offset, size_t size, bool success)
+{
+    for (uint32_t index : { currentTag, MaxTags })
+    {
+        Counters& counter = counters[index];
+        counter.writes.fetch_add(1, std::memory_order_relaxed);
+        counter.writeBytes.fetch_add(size, std::memory_order_relaxed);
+        if (!success)
+        {
+            counter.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    addToBuckets(bucketWrites, offset, size);
+}
+
+void IOStats::addToBuckets(std::array<std::atomic<uint32_t>, BucketCount>& buckets, uintptr_t offset, size_t size)
+{
+    if (offset >= RAMSize || size == 0)
+    {
+        return;
+    }
+
+    uint32_t firstBucket = (uint32_t)(offset / BucketSize);
+    uint32_t lastBucket = (uint32_t)(std::min<uintptr_t>(offset + size - 1, RAMSize - 1) / BucketSize);
+    for (uint32_t i = firstBucket; i <= lastBucket; ++i)
+    {
+        buckets[i].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void IOStats::endFrame()
+{
+    Snapshot totals = getTotals();
+    lastFrame = totals - frameStart;
+    frameStart = totals;
+
+    maxFrame.reads = std::max(maxFrame.reads, lastFrame.reads);
+    maxFrame.writes = std::max(maxFrame.writes, lastFrame.writes);
+    maxFrame.readBytes = std::max(maxFrame.readBytes, lastFrame.readBytes);
+    maxFrame.writeBytes = std::max(maxFrame.writeBytes, lastFrame.writeBytes);
+    maxFrame.errors = std::max(maxFrame.errors, lastFrame.errors);
+}
+
+IOStats::Snapshot IOStats::getTagTotals(uint32_t tag) const
+{
+    const Counters& counter = counters[std::min(tag, MaxTags)];
+
+    Snapshot result;
+    result.reads = counter.reads.load(std::memory_order_relaxed);
+    result.writes = counter.writes.load(std::memory_order_relaxed);
+    result.readBytes = counter.readBytes.load(std::memory_order_relaxed);
+    result.writeBytes = counter.writeBytes.load(std::memory_order_relaxed);
+    result.errors = counter.errors.load(std::memory_order_relaxed);
+    return result;
+}
+
+void IOStats::reset()
+{
+    for (Counters& counter : counters)
+    {
+        counter.reads = 0;
+        counter.writes = 0;
+        counter.readBytes = 0;
+        counter.writeBytes = 0;
+        counter.errors = 0;
+    }
+
+    for (uint32_t i = 0; i < BucketCount; ++i)
+    {
+        bucketReads[i] = 0;
+        bucketWrites[i] = 0;
+    }
+
+    frameStart = Snapshot();
+    lastFrame = Snapshot();
+    maxFrame = Snapshot();
+}
+
+bool IOStats::exportCSV(const std::string& filePath) const
+{
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file << "tag,reads,writes,readBytes,writeBytes,errors\n";
+    for (uint32_t i = 0; i < getTagCount(); ++i)
+    {
+        Snapshot tagTotals = getTagTotals(i);
+        file << getTagName(i) << "," << tagTotals.reads << "," << tagTotals.writes << "," << tagTotals.readBytes << "," << tagTotals.writeBytes << "," << tagTotals.errors << "\n";
+    }
+
+    file << "\naddress,reads,writes\n";
+    for (uint32_t i = 0; i < BucketCount; ++i)
+    {
+        uint32_t reads = getBucketReads(i);
+        uint32_t writes = getBucketWrites(i);
+        if (reads == 0 && writes == 0)
+        {
+            continue;
+        }
+
+        file << "0x" << std::hex << (i * BucketSize) << std::dec << "," << reads << "," << writes << "\n";
+    }
+
+    return true;
+}
+
+uint32_t IOStats::registerTag(const char* name)
+{
+    std::lock_guard<std::mutex> lock(tagMutex);
+    std::array<std::string, MaxTags>& tagNames = getTagNames();
+
+    uint32_t count = tagCount.load();
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        if (tagNames[i] == name)
+        {
+            return i;
+        }
+    }
+
+    // Out of tags, count against untagged rather than failing.
+    if (count >= MaxTags)
+    {
+        return 0;
+    }
+
+    tagNames[count] = name;
+    tagCount.store(count + 1);
+    return count;
+}
+
+uint32_t IOStats::getTagCount()
+{
+    return tagCount.load();
+}
+
+const char* IOStats::getTagName(uint32_t tag)
+{
+    if (tag >= getTagCount())
+    {
+        return "";
+    }
+
+    return getTagNames()[tag].c_str();
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Counts every read and write made to emulator memory, split by the tag of the code that made it, along
+// with a coarse heatmap of which parts of PS1 RAM are being touched. Reads come from both the manager
+// and GUI threads so all counters are atomic.
+class IOStats
+{
+public:
+    static constexpr uint32_t RAMSize = 0x200000;
+    static constexpr uint32_t BucketSize = 256;
+    static constexpr uint32_t BucketCount = RAMSize / BucketSize;
+    static constexpr uint32_t MaxTags = 64;
+
+    struct Snapshot
+    {
+        uint64_t reads = 0;
+        uint64_t writes = 0;
+        uint64_t readBytes = 0;
+        uint64_t writeBytes = 0;
+        uint64_t errors = 0;
+
+        Snapshot operator-(const Snapshot& other) const
+        {
+            return { reads - other.reads, writes - other.writes, readBytes - other.readBytes, writeBytes - other.writeBytes, errors - other.errors };
+        }
+    };
+
+    void recordRead(uintptr_t offset, size_t size, bool success);
+    void recordWrite(uintptr_t offset, size_t size, bool success);
+
+    // Closes off the counters for a frame, the difference since the last call becomes the last frame's cost.
+    void endFrame();
+
+    Snapshot getTotals() const { return getTagTotals(MaxTags); }
+    Snapshot getTagTotals(uint32_t tag) const;
+    const Snapshot& getLastFrame() const { return lastFrame; }
+    const Snapshot& getMaxFrame() const { return maxFrame; }
+
+    uint32_t getBucketReads(uint32_t bucket) const { return bucketReads[bucket].load(std::memory_order_relaxed); }
+    uint32_t getBucketWrites(uint32_t bucket) const { return bucketWrites[bucket].load(std::memory_order_relaxed); }
+
+    void reset();
+    bool exportCSV(const std::string& filePath) const;
+
+    // Tags are shared by every instance, tag 0 is used for untagged I/O.
+    static uint32_t registerTag(const char* name);
+    static uint32_t getTagCount();
+    static const char* getTagName(uint32_t tag);
+
+    // The tag I/O made on this thread is counted against, see IOTagScope.
+    static thread_local uint32_t currentTag;
+
+private:
+    struct Counters
+    {
+        std::atomic<uint64_t> reads{ 0 };
+        std::atomic<uint64_t> writes{ 0 };
+        std::atomic<uint64_t> readBytes{ 0 };
+        std::atomic<uint64_t> writeBytes{ 0 };
+        std::atomic<uint64_t> errors{ 0 };
+    };
+
+    // One set per tag plus the totals at the end.
+    std::array<Counters, MaxTags + 1> counters;
+    std::array<std::atomic<uint32_t>, BucketCount> bucketReads{};
+    std::array<std::atomic<uint32_t>, BucketCount> bucketWrites{};
+
+    Snapshot frameStart;
+    Snapshot lastFrame;
+    Snapshot maxFrame;
+
+    void addToBuckets(std::array<std::atomic<uint32_t>, BucketCount>& buckets, uintptr_t offset, size_t size);
+};
+
+// Counts I/O made on this thread against a tag until the scope ends.
+class IOTagScope
+{
+public:
+    IOTagScope(uint32_t tag) : previousTag(IOStats::currentTag) { IOStats::currentTag = tag; }
+    ~IOTagScope() { IOStats::currentTag = previousTag; }
+
+private:
+    uint32_t previousTag;
+};
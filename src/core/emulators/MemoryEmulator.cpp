@@ -0,0 +1,31 @@
+#include "MemoryEmulator.h"
+
+#include <cstring>
+
+bool MemoryEmulator::read(uintptr_t offset, void* outBuffer, size_t size)
+{
+    if (offset + size > ram.size())
+    {
+        readErrorCount++;
+        ioStats.recordRead(offset, size, false);
+        return false;
+    }
+
+    memcpy(outBuffer, ram.data() + offset, size);
+    ioStats.recordRead(offset, size, true);
+    return true;
+}
+
+bool MemoryEmulator::write(uintptr_t offset, void* inValue, size_t size)
+{
+    if (offset + size > ram.size())
+    {
+        writeErrorCount++;
+        ioStats.recordWrite(offset, size, false);
+        return false;
+    }
+
+    memcpy(ram.data() + offset, inValue, size);
+    ioStats.recordWrite(offset, size, true);
+    return true;
+}
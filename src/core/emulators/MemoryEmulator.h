@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Emulator.h"
+#include "RAMTrace.h"
+
+// Serves reads and writes from a copy of PS1 RAM held in this process rather than an emulator, used for
+// replays and benchmarks.
+class MemoryEmulator : public Emulator
+{
+public:
+    MemoryEmulator() : ram(RAMTrace::RAMSize, 0) {}
+
+    bool connect(std::string processName) override { return true; }
+
+    bool read(uintptr_t offset, void* outBuffer, size_t size) override;
+    bool write(uintptr_t offset, void* inValue, size_t size) override;
+
+    uint8_t* getRAM() { return ram.data(); }
+
+protected:
+    std::vector<uint8_t> ram;
+};
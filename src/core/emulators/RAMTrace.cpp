@@ -0,0 +1,214 @@
+#include "RAMTrace.h"
+#include "Emulator.h"
+#include "core/utilities/Logging.h"
+
+#include <cstring>
+
+static const char TraceMagic[4] = { 'I', 'M', 'T', 'R' };
+
+template <typename T>
+static void writeValue(std::ofstream& file, T value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+static bool readValue(const std::vector<uint8_t>& data, size_t& position, T& valueOut)
+{
+    if (position + sizeof(T) > data.size())
+    {
+        return false;
+    }
+
+    memcpy(&valueOut, data.data() + position, sizeof(T));
+    position += sizeof(T);
+    return true;
+}
+
+bool RAMTrace::Writer::open(const std::string& filePath)
+{
+    file.open(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file.write(TraceMagic, sizeof(TraceMagic));
+    writeValue<uint32_t>(file, Version);
+    writeValue<uint32_t>(file, RAMSize);
+
+    previous.clear();
+    current.resize(RAMSize);
+    frameCount = 0;
+    return true;
+}
+
+void RAMTrace::Writer::close()
+{
+    if (file.is_open())
+    {
+        file.close();
+    }
+}
+
+void RAMTrace::Writer::capture(Emulator* emulator)
+{
+    if (!file.is_open() || !emulator->read(0, current.data(), RAMSize))
+    {
+        return;
+    }
+
+    addFrame(current.data());
+}
+
+void RAMTrace::Writer::addFrame(const uint8_t* ram)
+{
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    // The first frame is all of RAM.
+    if (previous.empty())
+    {
+        previous.assign(ram, ram + RAMSize);
+        writeValue<uint32_t>(file, 1);
+        writeValue<uint32_t>(file, 0);
+        writeValue<uint32_t>(file, RAMSize);
+        file.write(reinterpret_cast<const char*>(ram), RAMSize);
+        frameCount++;
+        return;
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> spans;
+    uint32_t offset = 0;
+    while (offset < RAMSize)
+    {
+        // Skip matching words quickly, then bytes up to the first difference.
+        if ((offset & 7) == 0 && memcmp(previous.data() + offset, ram + offset, 8) == 0)
+        {
+            offset += 8;
+            continue;
+        }
+        if (previous[offset] == ram[offset])
+        {
+            offset++;
+            continue;
+        }
+
+        // Extend the span until there's a long enough run of matching bytes.
+        uint32_t start = offset;
+        uint32_t end = offset + 1;
+        uint32_t scan = end;
+        while (scan < RAMSize && scan - end < SpanMergeDistance)
+        {
+            if (previous[scan] != ram[scan])
+            {
+                end = scan + 1;
+            }
+            scan++;
+        }
+
+        spans.push_back({ start, end - start });
+        offset = scan;
+    }
+
+    if (spans.empty())
+    {
+        return;
+    }
+
+    writeValue<uint32_t>(file, (uint32_t)spans.size());
+    for (const auto& [spanOffset, spanLength] : spans)
+    {
+        writeValue<uint32_t>(file, spanOffset);
+        writeValue<uint32_t>(file, spanLength);
+        file.write(reinterpret_cast<const char*>(ram + spanOffset), spanLength);
+        memcpy(previous.data() + spanOffset, ram + spanOffset, spanLength);
+    }
+    frameCount++;
+}
+
+bool RAMTrace::Reader::load(const std::string& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        LOG("Failed to open trace: %s", filePath.c_str());
+        return false;
+    }
+
+    data.resize((size_t)file.tellg());
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(data.data()), data.size());
+    frameOffsets.clear();
+
+    size_t position = 0;
+    uint32_t version = 0;
+    uint32_t ramSize = 0;
+    if (data.size() < sizeof(TraceMagic) || memcmp(data.data(), TraceMagic, sizeof(TraceMagic)) != 0)
+    {
+        LOG("Not a RAM trace: %s", filePath.c_str());
+        return false;
+    }
+    position += sizeof(TraceMagic);
+
+    if (!readValue(data, position, version) || !readValue(data, position, ramSize) || version != Version || ramSize != RAMSize)
+    {
+        LOG("Unsupported RAM trace version %u: %s", version, filePath.c_str());
+        return false;
+    }
+
+    // Index every frame up front, a truncated last frame is dropped.
+    while (position < data.size())
+    {
+        size_t frameStart = position;
+        uint32_t spanCount = 0;
+        if (!readValue(data, position, spanCount))
+        {
+            break;
+        }
+
+        bool complete = true;
+        for (uint32_t i = 0; i < spanCount && complete; ++i)
+        {
+            uint32_t spanOffset = 0;
+            uint32_t spanLength = 0;
+            complete = readValue(data, position, spanOffset) && readValue(data, position, spanLength) &&
+                (uint64_t)spanOffset + spanLength <= RAMSize && position + spanLength <= data.size();
+            position += spanLength;
+        }
+
+        if (!complete)
+        {
+            break;
+        }
+        frameOffsets.push_back(frameStart);
+    }
+
+    return !frameOffsets.empty();
+}
+
+bool RAMTrace::Reader::applyFrame(size_t frameIndex, uint8_t* ram)
+{
+    if (frameIndex >= frameOffsets.size())
+    {
+        return false;
+    }
+
+    // Spans were validated when the trace was loaded.
+    size_t position = frameOffsets[frameIndex];
+    uint32_t spanCount = 0;
+    readValue(data, position, spanCount);
+    for (uint32_t i = 0; i < spanCount; ++i)
+    {
+        uint32_t spanOffset = 0;
+        uint32_t spanLength = 0;
+        readValue(data, position, spanOffset);
+        readValue(data, position, spanLength);
+        memcpy(ram + spanOffset, data.data() + position, spanLength);
+        position += spanLength;
+    }
+
+    return true;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class Emulator;
+
+// A recording of PS1 RAM over a play session so it can be replayed without an emulator, see ReplayEmulator.
+// The first frame holds all of RAM, every frame after only holds the ranges that changed.
+//
+// Layout: "IMTR", uint32 version, uint32 RAM size, then per frame a uint32 span count followed by
+// each span as a uint32 offset, a uint32 length and its bytes.
+class RAMTrace
+{
+public:
+    static constexpr uint32_t RAMSize = 0x200000;
+    static constexpr uint32_t Version = 1;
+
+    // Changed ranges closer together than this are stored as one span.
+    static constexpr uint32_t SpanMergeDistance = 32;
+
+    class Writer
+    {
+    public:
+        bool open(const std::string& filePath);
+        void close();
+
+        // Reads all of RAM and stores what changed since the last capture, frames with no changes are skipped.
+        // This is one large read per call so recording is meant for short sessions.
+        void capture(Emulator* emulator);
+
+        // Same as capture but from a copy of RAM.
+        void addFrame(const uint8_t* ram);
+
+        uint32_t getFrameCount() { return frameCount; }
+
+    private:
+        std::ofstream file;
+        std::vector<uint8_t> previous;
+        std::vector<uint8_t> current;
+        uint32_t frameCount = 0;
+    };
+
+    class Reader
+    {
+    public:
+        // Loads the whole trace into memory so replaying it doesn't touch the disk.
+        bool load(const std::string& filePath);
+
+        size_t getFrameCount() { return frameOffsets.size(); }
+
+        // Applies a frame's changes over ram, which must hold RAMSize bytes.
+        bool applyFrame(size_t frameIndex, uint8_t* ram);
+
+    private:
+        std::vector<uint8_t> data;
+        std::vector<size_t> frameOffsets;
+    };
+};
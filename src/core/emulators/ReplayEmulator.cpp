@@ -0,0 +1,30 @@
+#include "ReplayEmulator.h"
+#include "core/utilities/Logging.h"
+
+#include <algorithm>
+
+bool ReplayEmulator::connect(std::string tracePath)
+{
+    if (!trace.load(tracePath))
+    {
+        return false;
+    }
+
+    std::fill(ram.begin(), ram.end(), 0);
+    frameIndex = 0;
+    trace.applyFrame(frameIndex, ram.data());
+
+    LOG("Replaying %zu frames from: %s", trace.getFrameCount(), tracePath.c_str());
+    return true;
+}
+
+bool ReplayEmulator::advance()
+{
+    if (frameIndex + 1 >= trace.getFrameCount())
+    {
+        return false;
+    }
+
+    frameIndex++;
+    return trace.applyFrame(frameIndex, ram.data());
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "MemoryEmulator.h"
+#include "RAMTrace.h"
+
+// Serves reads and writes from a RAM trace instead of an emulator process, used for benchmarking.
+// Each call to advance() applies the next recorded frame over RAM, writes made by rules stay in place
+// until the recording overwrites them.
+class ReplayEmulator : public MemoryEmulator
+{
+public:
+    // Loads the trace at the given path and applies its first frame.
+    bool connect(std::string tracePath) override;
+
+    // Returns false once the trace has run out of frames.
+    bool advance();
+
+    size_t getFrameCount() { return trace.getFrameCount(); }
+    size_t getFrameIndex() { return frameIndex; }
+
+private:
+    RAMTrace::Reader trace;
+    size_t frameIndex = 0;
+};
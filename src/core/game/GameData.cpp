@@ -1,79 +1,76 @@
 #include "GameData.h"
 #include "core/game/MemoryOffsets.h"
+#include "core/game/TextCodec.h"
 #include "core/utilities/Logging.h"
 #include "rules/Restrictions.h"
 
-static FieldData gInvalidField = { 0, "" };
-
-std::unordered_map<uint8_t, Item> GameData::accessories;
-std::unordered_map<uint8_t, Item> GameData::armors;
-std::unordered_map<uint8_t, Item> GameData::items;
-std::unordered_map<uint8_t, Item> GameData::weapons;
-std::unordered_map<uint8_t, Item> GameData::materia;
-
-std::vector<ESkill> GameData::eSkills;
-std::unordered_map<uint16_t, FieldData> GameData::fieldData;
-std::vector<WorldMapEntrance> GameData::worldMapEntrances;
-std::vector<WorldMapEncounters> GameData::worldMapEncounters;
-std::unordered_map<uint8_t, BattleScene> GameData::battleScenes;
-std::vector<Boss> GameData::bosses;
-std::unordered_map<uint8_t, Shop> GameData::shops;
-std::vector<Model> GameData::models;
-std::vector<BattleModel> GameData::battleModels;
-
-Item* GameData::getAccessory(uint8_t id)
+#include <algorithm>
+
+static const FieldData gInvalidField = { 0, "" };
+
+static const Item* findItem(const TableView<Item>& table, uint8_t id)
 {
-    if (accessories.count(id) == 0)
+    if (id >= table.size() || table[id].name[0] == '\0')
     {
-        LOG("Invalid accessory ID: %d", id);
         return nullptr;
     }
 
-    return &accessories[id];
+    return &table[id];
 }
 
-Item* GameData::getArmor(uint8_t id)
+const Item* GameData::getAccessory(uint8_t id)
 {
-    if (armors.count(id) == 0)
+    const Item* item = findItem(accessories, id);
+    if (item == nullptr)
+    {
+        LOG("Invalid accessory ID: %d", id);
+    }
+
+    return item;
+}
+
+const Item* GameData::getArmor(uint8_t id)
+{
+    const Item* item = findItem(armors, id);
+    if (item == nullptr)
     {
         LOG("Invalid armor ID: %d", id);
-        return nullptr;
     }
 
-    return &armors[id];
+    return item;
 }
 
-Item* GameData::getItem(uint8_t id)
+const Item* GameData::getItem(uint8_t id)
 {
-    if (items.count(id) == 0)
+    const Item* item = findItem(items, id);
+    if (item == nullptr)
     {
         LOG("Invalid item ID: %d", id);
-        return nullptr;
     }
 
-    return &items[id];
+    return item;
 }
 
-Item* GameData::getWeapon(uint8_t id)
+const Item* GameData::getWeapon(uint8_t id)
 {
-    if (weapons.count(id) == 0)
+    const Item* item = findItem(weapons, id);
+    if (item == nullptr)
     {
         LOG("Invalid weapon ID: %d", id);
-        return nullptr;
     }
 
-    return &weapons[id];
+    return item;
 }
 
-Item* GameData::getMateria(uint8_t id)
+const Item* GameData::getMateria(uint8_t id)
 {
-    if (materia.count(id) == 0)
+    const Item* item = findItem(materia, id);
+    if (item == nullptr)
     {
         LOG("Invalid materia ID: %d", id);
-        return nullptr;
     }
 
-    return &materia[id];
+    return item;
 }
 
 std::string GameData::getItemName(uint16_t fieldScriptID)
@@ -86,7 +83,7 @@ std::string GameData::getItemName(uint16_t fieldScriptID)
         288 + X = Accessories
     */
 
-    Item* item = nullptr;
+    const Item* item = nullptr;
 
     if (fieldScriptID < 128)
     {
@@ -115,7 +112,7 @@ std::string GameData::getItemName(uint16_t fieldScriptID)
 
 uint32_t GameData::getItemPrice(uint16_t fieldScriptID)
 {
-    Item* item = nullptr;
+    const Item* item = nullptr;
 
     if (fieldScriptID < 128)
     {
@@ -144,7 +141,7 @@ uint32_t GameData::getItemPrice(uint16_t fieldScriptID)
 
 std::string GameData::getMateriaName(uint8_t id)
 {
-    Item* materia = getMateria(id);
+    const Item* materia = getMateria(id);
     if (materia == nullptr)
     {
         return "";
@@ -154,7 +151,7 @@ std::string GameData::getMateriaName(uint8_t id)
 
 uint32_t GameData::getMateriaPrice(uint8_t id)
 {
-    Item* materia = getMateria(id);
+    const Item* materia = getMateria(id);
     if (materia == nullptr)
     {
         return 0;
@@ -167,9 +164,11 @@ uint16_t GameData::getRandomAccessory(std::mt19937_64& rng, bool excludeBanned,
     std::vector<uint16_t> candidates;
     candidates.reserve(GameData::accessories.size());
 
-    for (const auto& [id, data] : GameData::accessories)
+    for (uint16_t id = 0; id < GameData::accessories.size(); ++id)
     {
-        if ((excludeBanned && Restrictions::isAccessoryBanned(id)) ||
+        const Item& data = GameData::accessories[id];
+        if (data.name[0] == '\0' ||
+            (excludeBanned && Restrictions::isAccessoryBanned(id)) ||
             (excludeRare && data.price == 2) ||
             (excludeSet.count(288 + id) > 0))
         {
@@ -194,9 +193,11 @@ uint16_t GameData::getRandomArmor(std::mt19937_64& rng, bool excludeBanned, bool
     std::vector<uint16_t> candidates;
     candidates.reserve(GameData::armors.size());
 
-    for (const auto& [id, data] : GameData::armors)
+    for (uint16_t id = 0; id < GameData::armors.size(); ++id)
     {
-        if ((excludeBanned && Restrictions::isArmorBanned(id)) ||
+        const Item& data = GameData::armors[id];
+        if (data.name[0] == '\0' ||
+            (excludeBanned && Restrictions::isArmorBanned(id)) ||
             (excludeRare && data.price == 2) ||
             (excludeSet.count(256 + id) > 0))
         {
@@ -221,9 +222,11 @@ uint16_t GameData::getRandomItem(std::mt19937_64& rng, bool excludeBanned, bool
     std::vector<uint16_t> candidates;
     candidates.reserve(GameData::items.size());
 
-    for (const auto& [id, data] : GameData::items)
+    for (uint16_t id = 0; id < GameData::items.size(); ++id)
     {
-        if ((excludeBanned && Restrictions::isItemBanned(id)) ||
+        const Item& data = GameData::items[id];
+        if (data.name[0] == '\0' ||
+            (excludeBanned && Restrictions::isItemBanned(id)) ||
             (excludeRare && data.price == 2) ||
             (excludeSet.count(id) > 0))
         {
@@ -248,9 +251,11 @@ uint16_t GameData::getRandomWeapon(std::mt19937_64& rng, bool excludeBanned, boo
     std::vector<uint16_t> candidates;
     candidates.reserve(GameData::weapons.size());
 
-    for (const auto& [id, data] : GameData::weapons)
+    for (uint16_t id = 0; id < GameData::weapons.size(); ++id)
     {
-        if ((excludeBanned && Restrictions::isWeaponBanned(id)) ||
+        const Item& data = GameData::weapons[id];
+        if (data.name[0] == '\0' ||
+            (excludeBanned && Restrictions::isWeaponBanned(id)) ||
             (excludeRare && data.price == 2) ||
             (excludeSet.count(128 + id) > 0))
         {
@@ -305,9 +310,11 @@ uint16_t GameData::getRandomMateria(std::mt19937_64& rng, bool excludeBanned, bo
     std::vector<uint16_t> candidates;
     candidates.reserve(GameData::materia.size());
 
-    for (const auto& [id, data] : GameData::materia)
+    for (uint16_t id = 0; id < GameData::materia.size(); ++id)
     {
-        if ((excludeBanned && Restrictions::isMateriaBanned(id)) ||
+        const Item& data = GameData::materia[id];
+        if (data.name[0] == '\0' ||
+            (excludeBanned && Restrictions::isMateriaBanned(id)) ||
             (excludeRare && data.price == 1) ||
             (excludeSet.count(id) > 0))
         {
@@ -327,21 +334,43 @@ uint16_t GameData::getRandomMateria(std::mt19937_64& rng, bool excludeBanned, bo
     return candidates[dist(rng)];
 }
 
-FieldData GameData::getField(uint16_t id)
+const FieldData& GameData::getField(uint16_t id)
 {
-    if (fieldData.count(id) == 0)
+    auto it = std::lower_bound(fields.begin(), fields.end(), id, [](const FieldData& field, uint16_t value) { return field.id < value; });
+    if (it == fields.end() || it->id != id)
     {
         return gInvalidField;
     }
 
-    return fieldData[id];
+    return *it;
 }
 
-BattleModel* GameData::getBattleModel(std::string modelName)
+const BattleScene* GameData::getBattleScene(uint8_t id)
 {
-    for (BattleModel& model : battleModels)
+    auto it = std::lower_bound(battleScenes.begin(), battleScenes.end(), id, [](const BattleScene& scene, uint8_t value) { return scene.id < value; });
+    if (it == battleScenes.end() || it->id != id)
     {
-        if (model.name == modelName)
+        return nullptr;
+    }
+
+    return it;
+}
+
+const Shop* GameData::getShop(uint8_t id)
+{
+    if (id >= shops.size())
+    {
+        return nullptr;
+    }
+
+    return &shops[id];
+}
+
+const BattleModel* GameData::getBattleModel(const std::string& modelName)
+{
+    for (const BattleModel& model : battleModels)
+    {
+        if (modelName == model.name)
         {
             return &model;
         }
@@ -367,53 +396,30 @@ std::vector<const Boss*> GameData::getBossesInScene(const BattleScene* scene)
     return result;
 }
 
-const char* normalChars[256] = {
-    " ", "!", "\"", "#", "$", "%", "&", "'", "(", ")", "*", "+", ",", "-", ".", "/",
-    "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", ":", ";", "<", "=", ">", "?",
-    "@", "A", "B", "C", "D", "E", "F", "G", "H", "I", "J", "K", "L", "M", "N", "O",
-    "P", "Q", "R", "S", "T", "U", "V", "W", "X", "Y", "Z", "[", "\\", "]", "^", "_",
-    "`", "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o",
-    "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z", "{", "|", "}", "~",     
-    "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
-    "", "", "", "", "", "", "", "", "", "", "", "", "", "", "", "",
-    " ", "", "", "", " ", " ", " ", " ", " ", " ", " ", "", "", " ", " ", "",
-    " ", "", " ", " ", "", "", " ", " ", " ", " ", " ", "", "", " ", " ", "",
-    "", "", "", " ", "", " ", " ", " ", "", "", "", "", "", "", "", "",
-    "", "", "", "", "", "", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ",
-    "", "", "", "", "", "", "", "", "", "", "", "", "", "", " ", "",
-    "", "", "", " ", "", "", "", " ", " ", " ", " ", " ", " ", " ", " ", " ",
-    " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ",
-    " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " ", " "
-};
-
 std::string GameData::decodeString(const std::vector<uint8_t>& data)
 {
+    char buffer[TextCodec::MaxLength + 1];
     std::string result = "";
-    for (uint8_t byte : data) 
+
+    // Decode in chunks so long strings still avoid per-character appends.
+    for (size_t i = 0; i < data.size(); i += TextCodec::MaxLength)
     {
-        if (byte == 0xFF) break;
-        result += normalChars[byte];
+        size_t chunkLength = std::min<size_t>(data.size() - i, TextCodec::MaxLength);
+        size_t count = TextCodec::decode(data.data() + i, chunkLength, buffer, sizeof(buffer));
+        result.append(buffer, count);
+
+        if (count < chunkLength)
+        {
+            break;
+        }
     }
+
     return result;
 }
 
 std::vector<uint8_t> GameData::encodeString(const std::string& input)
 {
-    std::vector<uint8_t> encoded;
-
-    for (size_t i = 0; i < input.size(); ++i) 
-    {
-        uint8_t value = 0;
-        for (int j = 0; j < 256; ++j)
-        {
-            if (*normalChars[j] == input.at(i))
-            {
-                value = j;
-                break;
-            }
-        }
-        encoded.push_back(value);
-    }
-
+    std::vector<uint8_t> encoded(input.size());
+    TextCodec::encode(input, encoded.data(), encoded.size());
     return encoded;
-}
\ No newline at end of file
+}
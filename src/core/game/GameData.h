@@ -5,20 +5,34 @@
 #include <random>
 #include <set>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 #define SHOP_ITEM_MAX 10
 #define ESKILL_EMPTY 562949953421567
 
+// Read only view over a generated table, or a slice of one.
+template <typename T>
+struct TableView
+{
+    const T* data = nullptr;
+    size_t count = 0;
+
+    constexpr const T* begin() const { return data; }
+    constexpr const T* end() const { return data + count; }
+    constexpr size_t size() const { return count; }
+    constexpr bool empty() const { return count == 0; }
+    constexpr const T& operator[](size_t index) const { return data[index]; }
+};
+
 struct Item
 {
-    std::string name = "";
+    const char* name = "";
     uint32_t price = 0;
 };
 
 struct ESkill
 {
-    std::string name = "";
+    const char* name = "";
 
     uint8_t targetFlags = 0;
     uint32_t mpCost = 0;
@@ -40,8 +54,8 @@ union Encounter
         uint16_t prob : 6;  // Highest 6 bits
     };
 
-    Encounter(uint16_t val) : raw(val) {}
-    Encounter() : raw(0) {}
+    constexpr Encounter(uint16_t val) : raw(val) {}
+    constexpr Encounter() : raw(0) {}
 };
 
 struct FieldScriptItem
@@ -89,22 +103,22 @@ struct FieldWorldExit
 struct FieldData
 {
     uint16_t id = 0;
-    std::string name = "";
-    std::vector<FieldScriptItem> items;
-    std::vector<FieldScriptItem> materia;
-    std::vector<FieldScriptMessage> messages;
-    std::vector<FieldScriptShop> shops;
-    std::vector<FieldScriptBattle> battles;
-    std::vector<FieldWorldExit> worldExits;
-    std::vector<uint8_t> modelIDs;
+    const char* name = "";
+    TableView<FieldScriptItem> items;
+    TableView<FieldScriptItem> materia;
+    TableView<FieldScriptMessage> messages;
+    TableView<FieldScriptShop> shops;
+    TableView<FieldScriptBattle> battles;
+    TableView<FieldWorldExit> worldExits;
+    TableView<uint8_t> modelIDs;
 
     uint32_t encounterOffset = 0;
     std::array<Encounter, 10> encounterTable0{};
     std::array<Encounter, 10> encounterTable1{};
 
-    bool isValid() { return name != ""; }
+    bool isValid() const { return name[0] != '\0'; }
 
-    Encounter getEncounter(uint8_t table, uint8_t index)
+    Encounter getEncounter(uint8_t table, uint8_t index) const
     {
         if (table == 0)
         {
@@ -122,26 +136,26 @@ struct WorldMapEntrance
 {
     uint32_t offset = 0;
     uint16_t fieldID = 0;
-    std::string fieldName = "";
+    const char* fieldName = "";
     uint32_t centerX = 0;
     uint32_t centerZ = 0;
 };
 
 struct WorldMapEncounters
 {
-    std::array<std::vector<Encounter>, 4> sets;
+    std::array<TableView<Encounter>, 4> sets;
 };
 
 struct ShopItem
 {
-    uint8_t index;
-    uint16_t id;
+    uint8_t index = 0;
+    uint16_t id = 0;
 };
 
 struct Shop
 {
-    std::vector<ShopItem> items;
-    std::vector<ShopItem> materia;
+    TableView<ShopItem> items;
+    TableView<ShopItem> materia;
 };
 
 struct BattleFormation
@@ -151,7 +165,7 @@ struct BattleFormation
     std::array<uint16_t, 6> enemyIDs{};
     std::array<uint16_t, 4> arenaIDs{};
 
-    inline bool isArenaBattle()
+    inline bool isArenaBattle() const
     {
         return arenaIDs[0] != 999 || arenaIDs[1] != 999 || arenaIDs[2] != 999 || arenaIDs[3] != 999;
     }
@@ -162,14 +176,14 @@ struct BattleScene
     uint8_t id = 0;
     std::array<uint16_t, 3> enemyIDs{};
     std::array<uint8_t, 3> enemyLevels{};
-    std::vector<BattleFormation> formations;
+    TableView<BattleFormation> formations;
 };
 
 struct Boss
 {
     uint16_t id = 0;
-    std::string name = "";
-    std::vector<int> sceneIDs;
+    const char* name = "";
+    TableView<uint8_t> sceneIDs;
     uint64_t elementTypes = 0;
     uint64_t elementRates = 0;
 };
@@ -188,9 +202,9 @@ struct ModelPart
 
 struct Model
 {
-    std::string name = "";
+    const char* name = "";
     int polyCount = 0;
-    std::vector<ModelPart> parts;
+    TableView<ModelPart> parts;
 };
 
 struct BattleModelPart
@@ -205,9 +219,9 @@ struct BattleModelPart
 
 struct BattleModel
 {
-    std::string name = "";
-    std::vector<int> headerSizes;
-    std::vector<BattleModelPart> parts;
+    const char* name = "";
+    TableView<int> headerSizes;
+    TableView<BattleModelPart> parts;
 };
 
 struct StatMultiplierSet
@@ -228,138 +242,29 @@ struct StatMultiplierSet
 class GameData
 {
 public:
-    static std::unordered_map<uint8_t, Item> accessories;
-    static std::unordered_map<uint8_t, Item> armors;
-    static std::unordered_map<uint8_t, Item> items;
-    static std::unordered_map<uint8_t, Item> weapons;
-    static std::unordered_map<uint8_t, Item> materia;
-
-    static std::vector<ESkill> eSkills;
-    static std::unordered_map<uint16_t, FieldData> fieldData;
-    static std::vector<WorldMapEntrance> worldMapEntrances;
-    static std::vector<WorldMapEncounters> worldMapEncounters;
-    static std::unordered_map<uint8_t, Shop> shops;
-    static std::unordered_map<uint8_t, BattleScene> battleScenes;
-    static std::vector<Boss> bosses;
-    static std::vector<Model> models;
-    static std::vector<BattleModel> battleModels;
-
-    static void loadGameData();
-
-    static void addAccessory(uint8_t id, std::string name, uint32_t shopPrice)      { accessories[id] = { name, shopPrice }; }
-    static void addArmor(uint8_t id, const std::string& name, uint32_t shopPrice)   { armors[id] = { name, shopPrice }; }
-    static void addItem(uint8_t id, const std::string& name, uint32_t shopPrice)    { items[id] = { name, shopPrice }; }
-    static void addWeapon(uint8_t id, const std::string& name, uint32_t shopPrice)  { weapons[id] = { name, shopPrice }; }
-    static void addMateria(uint8_t id, const std::string& name, uint32_t shopPrice) { materia[id] = { name, shopPrice }; }
-
-    static void addESkill(const std::string& name, uint8_t targetFlags, uint32_t mpCost, uint8_t idx) 
-    {
-        GameData::eSkills.push_back({ name, targetFlags, mpCost, idx });
-    }
-
-    static void addField(uint16_t fieldID, const std::string& name) 
-    {
-        fieldData[fieldID] = { fieldID, name };
-    }
-
-    static void addFieldScriptItem(uint16_t fieldID, uint8_t groupIdx, uint8_t scriptIdx, uint32_t offset, uint16_t itemID, uint8_t quantity) 
-    {
-        GameData::fieldData[fieldID].items.push_back({ groupIdx, scriptIdx, offset, itemID, quantity });
-    }
-
-    static void addFieldScriptMateria(uint16_t fieldID, uint8_t groupIdx, uint8_t scriptIdx, uint32_t offset, uint16_t matID) 
-    {
-        GameData::fieldData[fieldID].materia.push_back({ groupIdx, scriptIdx, offset, matID, 1 });
-    }
-
-    static void addFieldScriptMessage(uint16_t fieldID, uint8_t groupIdx, uint8_t scriptIdx, uint8_t windowIdx, uint32_t offset, uint32_t strOffset, uint32_t strLen) 
-    {
-        GameData::fieldData[fieldID].messages.push_back({ groupIdx, scriptIdx, windowIdx, offset, strOffset, strLen });
-    }
-
-    static void addFieldScriptShop(uint16_t fieldID, uint8_t groupIdx, uint8_t scriptIdx, uint32_t offset, uint8_t shopID) 
-    {
-        GameData::fieldData[fieldID].shops.push_back({ groupIdx, scriptIdx, offset, shopID });
-    }
-
-    static void addFieldScriptBattle(uint16_t fieldID, uint8_t groupIdx, uint8_t scriptIdx, uint32_t offset, uint16_t battleID) 
-    {
-        GameData::fieldData[fieldID].battles.push_back({ groupIdx, scriptIdx, offset, battleID });
-    }
-
-    static void addFieldWorldExit(uint16_t fieldID, uint32_t offset, uint8_t index, uint16_t targetFieldID) 
-    {
-        GameData::fieldData[fieldID].worldExits.push_back({ offset, index, targetFieldID });
-    }
-
-    static void addFieldModels(uint16_t fieldID, std::vector<uint8_t> modelIDs) 
-    {
-        GameData::fieldData[fieldID].modelIDs = modelIDs;
-    }
-
-    static void addFieldEncounters(uint16_t fieldID, uint32_t encounterOffset, std::array<Encounter, 10> encounterTable0, std::array<Encounter, 10> encounterTable1)
-    {
-        GameData::fieldData[fieldID].encounterOffset = encounterOffset;
-        GameData::fieldData[fieldID].encounterTable0 = encounterTable0;
-        GameData::fieldData[fieldID].encounterTable1 = encounterTable1;
-    }
-
-    static void addWorldMapEntrance(uint32_t offset, uint16_t fieldID, const std::string& fieldName, uint32_t centerX, uint32_t centerZ) 
-    {
-        GameData::worldMapEntrances.push_back({ offset, fieldID, fieldName, centerX, centerZ });
-    }
-
-    static void addWorldMapEncounters(std::vector<Encounter> set0, std::vector<Encounter> set1, std::vector<Encounter> set2, std::vector<Encounter> set3)
-    {
-        GameData::worldMapEncounters.push_back({ set0, set1, set2, set3 });
-    }
-
-    static void addShop(uint8_t shopID, std::vector<uint16_t> itemData) 
-    {
-        Shop& shop = GameData::shops[shopID];
-        for (uint8_t i = 0; i < itemData.size(); ++i)
-        {
-            if (itemData[i] >= 512)
-            {
-                shop.materia.push_back({ i, itemData[i] - 512u });
-            }
-            else 
-            {
-                shop.items.push_back({ i, itemData[i] });
-            }
-        }
-    }
-
-    static void addBattleScene(uint8_t sceneID, uint16_t id0, uint16_t id1, uint16_t id2, uint8_t lvl0, uint8_t lvl1, uint8_t lvl2) 
-    {
-        GameData::battleScenes[sceneID] = { sceneID, {id0, id1, id2}, {lvl0, lvl1, lvl2} };
-    }
-
-    static void addBattleFormation(uint8_t sceneID, uint16_t formationID, bool noEscape, std::array<uint16_t, 6> enemyIDs, std::array<uint16_t, 4> arenaIDs) 
-    {
-        GameData::battleScenes[sceneID].formations.push_back({ formationID, noEscape, enemyIDs, arenaIDs });
-    }
-
-    static void addBoss(uint16_t enemyID, const std::string& name, std::vector<int> sceneIDs, uint64_t elemTypes, uint64_t elemRates)
-    {
-        GameData::bosses.push_back({ enemyID, name, sceneIDs, elemTypes, elemRates });
-    }
-
-    static void addModel(const std::string& modelName, int polyCount, std::vector<ModelPart> parts) 
-    {
-        GameData::models.push_back({ modelName, polyCount, parts });
-    }
-
-    static void addBattleModel(const std::string& modelName, std::vector<int> headerSizes, std::vector<BattleModelPart> parts) 
-    {
-        GameData::battleModels.push_back({ modelName, headerSizes, parts });
-    }
-
-    static Item* getAccessory(uint8_t id);
-    static Item* getArmor(uint8_t id);
-    static Item* getItem(uint8_t id);
-    static Item* getWeapon(uint8_t id);
-    static Item* getMateria(uint8_t id);
+    // Generated tables, see GameDataGenerated.cpp. Item tables are indexed by ID and unused IDs have an
+    // empty name. Fields and battle scenes are sorted by ID.
+    static const TableView<Item> accessories;
+    static const TableView<Item> armors;
+    static const TableView<Item> items;
+    static const TableView<Item> weapons;
+    static const TableView<Item> materia;
+
+    static const TableView<ESkill> eSkills;
+    static const TableView<FieldData> fields;
+    static const TableView<WorldMapEntrance> worldMapEntrances;
+    static const TableView<WorldMapEncounters> worldMapEncounters;
+    static const TableView<Shop> shops;
+    static const TableView<BattleScene> battleScenes;
+    static const TableView<Boss> bosses;
+    static const TableView<Model> models;
+    static const TableView<BattleModel> battleModels;
+
+    static const Item* getAccessory(uint8_t id);
+    static const Item* getArmor(uint8_t id);
+    static const Item* getItem(uint8_t id);
+    static const Item* getWeapon(uint8_t id);
+    static const Item* getMateria(uint8_t id);
 
     static uint16_t getRandomAccessory(std::mt19937_64& rng, bool excludeBanned = true, bool excludeRare = false, const std::set<uint16_t>& excludeSet = {});
     static uint16_t getRandomArmor(std::mt19937_64& rng, bool excludeBanned = true, bool excludeRare = false, const std::set<uint16_t>& excludeSet = {});
@@ -370,13 +275,15 @@ public:
     // Returns a random item ID thats the same type as origItemID
     static uint16_t getRandomItemFromID(uint16_t origItemID, std::mt19937_64& rng, bool excludeBanned = true, bool excludeRare = false, const std::set<uint16_t>& excludeSet = {});
 
-    static FieldData getField(uint16_t id);
+    static const FieldData& getField(uint16_t id);
+    static const BattleScene* getBattleScene(uint8_t id);
+    static const Shop* getShop(uint8_t id);
     static std::string getItemName(uint16_t fieldScriptID);
     static uint32_t getItemPrice(uint16_t fieldScriptID);
     static std::string getMateriaName(uint8_t id);
     static uint32_t getMateriaPrice(uint8_t id);
 
-    static BattleModel* getBattleModel(std::string modelName);
+    static const BattleModel* getBattleModel(const std::string& modelName);
     static std::vector<const Boss*> getBossesInScene(const BattleScene* scene);
 
     static std::string decodeString(const std::vector<uint8_t>& data);
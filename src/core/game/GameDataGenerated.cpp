@@ -1,4947 +1,11512 @@
 // Auto-generated game data file
 #include "GameData.h"
+#include <iterator>
 
-void GameData::loadGameData()
-{
-    // Items
-    addItem(0, "Potion", 50);
-    addItem(1, "Hi-Potion", 300);
-    addItem(2, "X-Potion", 2);
-    addItem(3, "Ether", 1500);
-    addItem(4, "Turbo Ether", 2);
-    addItem(5, "Elixir", 2);
-    addItem(6, "Megalixir", 2);
-    addItem(7, "Phoenix Down", 300);
-    addItem(8, "Antidote", 80);
-    addItem(9, "Soft", 150);
-    addItem(10, "Maiden's Kiss", 150);
-    addItem(11, "Cornucopia", 150);
-    addItem(12, "Echo Screen", 100);
-    addItem(13, "Hyper", 100);
-    addItem(14, "Tranquilizer", 100);
-    addItem(15, "Remedy", 1000);
-    addItem(16, "Smoke Bomb", 300);
-    addItem(17, "Speed Drink", 1000);
-    addItem(18, "Hero Drink", 2);
-    addItem(19, "Vaccine", 2);
-    addItem(20, "Grenade", 80);
-    addItem(21, "Shrapnel", 2);
-    addItem(22, "Right arm", 2);
-    addItem(23, "Hourglass", 2);
-    addItem(24, "Kiss of Death", 2);
-    addItem(25, "Spider Web", 2);
-    addItem(26, "Dream Powder", 2);
-    addItem(27, "Mute Mask", 2);
-    addItem(28, "War Gong", 2);
-    addItem(29, "Loco weed", 2);
-    addItem(30, "Fire Fang", 2);
-    addItem(31, "Fire Veil", 800);
-    addItem(32, "Antarctic Wind", 2);
-    addItem(33, "Ice Crystal", 2);
-    addItem(34, "Bolt Plume", 2);
-    addItem(35, "Swift Bolt", 800);
-    addItem(36, "Earth Drum", 2);
-    addItem(37, "Earth Mallet", 2);
-    addItem(38, "Deadly Waste", 2);
-    addItem(39, "M-Tentacles", 2);
-    addItem(40, "Stardust", 2);
-    addItem(41, "Vampire Fang", 2);
-    addItem(42, "Ghost Hand", 2);
-    addItem(43, "Vagyrisk Claw", 2);
-    addItem(44, "Light Curtain", 2);
-    addItem(45, "Lunar Curtain", 2);
-    addItem(46, "Mirror", 2);
-    addItem(47, "Holy Torch", 2);
-    addItem(48, "Bird Wing", 2);
-    addItem(49, "Dragon Scales", 2);
-    addItem(50, "Impaler", 500);
-    addItem(51, "Shrivel", 500);
-    addItem(52, "Eye drop", 50);
-    addItem(53, "Molotov", 400);
-    addItem(54, "S-mine", 1000);
-    addItem(55, "8inch Cannon", 2);
-    addItem(56, "Graviball", 2);
-    addItem(57, "T/S Bomb", 2);
-    addItem(58, "Ink", 2);
-    addItem(59, "Dazers", 2);
-    addItem(60, "Dragon Fang", 2);
-    addItem(61, "Cauldron", 2);
-    addItem(62, "Sylkis Greens", 5000);
-    addItem(63, "Reagan Greens", 3000);
-    addItem(64, "Mimett Greens", 1500);
-    addItem(65, "Curiel Greens", 1000);
-    addItem(66, "Pahsana Greens", 800);
-    addItem(67, "Tantal Greens", 400);
-    addItem(68, "Krakka Greens", 250);
-    addItem(69, "Gysahl Greens", 100);
-    addItem(70, "Tent", 500);
-    addItem(71, "Power Source", 500);
-    addItem(72, "Guard Source", 500);
-    addItem(73, "Magic Source", 500);
-    addItem(74, "Mind Source", 500);
-    addItem(75, "Speed Source", 500);
-    addItem(76, "Luck Source", 500);
-    addItem(77, "Zeio Nut", 2);
-    addItem(78, "Carob Nut", 2);
-    addItem(79, "Porov Nut", 2000);
-    addItem(80, "Pram Nut", 1500);
-    addItem(81, "Lasan Nut", 600);
-    addItem(82, "Saraha Nut", 400);
-    addItem(83, "Luchile Nut", 200);
-    addItem(84, "Pepio Nut", 100);
-    addItem(85, "Battery", 10);
-    addItem(86, "Tissue", 2);
-    addItem(87, "Omnislash", 500);
-    addItem(88, "Catastrophe", 500);
-    addItem(89, "Final Heaven", 500);
-    addItem(90, "Great Gospel", 500);
-    addItem(91, "Cosmo Memory", 500);
-    addItem(92, "All Creation", 500);
-    addItem(93, "Chaos", 500);
-    addItem(94, "Highwind", 500);
-    addItem(95, "1/35 soldier", 50);
-    addItem(96, "Super Sweeper", 50);
-    addItem(97, "Masamune Blade", 50);
-    addItem(98, "Save Crystal", 500);
-    addItem(99, "Combat Diary", 50);
-    addItem(100, "Autograph", 50);
-    addItem(101, "Gambler", 50);
-    addItem(102, "Desert Rose", 2);
-    addItem(103, "Earth Harp", 2);
-    addItem(104, "Guide Book", 2);
+// Items
+static constexpr Item itemTable[] = {
+    { "Potion", 50 },
+    { "Hi-Potion", 300 },
+    { "X-Potion", 2 },
+    { "Ether", 1500 },
+    { "Turbo Ether", 2 },
+    { "Elixir", 2 },
+    { "Megalixir", 2 },
+    { "Phoenix Down", 300 },
+    { "Antidote", 80 },
+    { "Soft", 150 },
+    { "Maiden's Kiss", 150 },
+    { "Cornucopia", 150 },
+    { "Echo Screen", 100 },
+    { "Hyper", 100 },
+    { "Tranquilizer", 100 },
+    { "Remedy", 1000 },
+    { "Smoke Bomb", 300 },
+    { "Speed Drink", 1000 },
+    { "Hero Drink", 2 },
+    { "Vaccine", 2 },
+    { "Grenade", 80 },
+    { "Shrapnel", 2 },
+    { "Right arm", 2 },
+    { "Hourglass", 2 },
+    { "Kiss of Death", 2 },
+    { "Spider Web", 2 },
+    { "Dream Powder", 2 },
+    { "Mute Mask", 2 },
+    { "War Gong", 2 },
+    { "Loco weed", 2 },
+    { "Fire Fang", 2 },
+    { "Fire Veil", 800 },
+    { "Antarctic Wind", 2 },
+    { "Ice Crystal", 2 },
+    { "Bolt Plume", 2 },
+    { "Swift Bolt", 800 },
+    { "Earth Drum", 2 },
+    { "Earth Mallet", 2 },
+    { "Deadly Waste", 2 },
+    { "M-Tentacles", 2 },
+    { "Stardust", 2 },
+    { "Vampire Fang", 2 },
+    { "Ghost Hand", 2 },
+    { "Vagyrisk Claw", 2 },
+    { "Light Curtain", 2 },
+    { "Lunar Curtain", 2 },
+    { "Mirror", 2 },
+    { "Holy Torch", 2 },
+    { "Bird Wing", 2 },
+    { "Dragon Scales", 2 },
+    { "Impaler", 500 },
+    { "Shrivel", 500 },
+    { "Eye drop", 50 },
+    { "Molotov", 400 },
+    { "S-mine", 1000 },
+    { "8inch Cannon", 2 },
+    { "Graviball", 2 },
+    { "T/S Bomb", 2 },
+    { "Ink", 2 },
+    { "Dazers", 2 },
+    { "Dragon Fang", 2 },
+    { "Cauldron", 2 },
+    { "Sylkis Greens", 5000 },
+    { "Reagan Greens", 3000 },
+    { "Mimett Greens", 1500 },
+    { "Curiel Greens", 1000 },
+    { "Pahsana Greens", 800 },
+    { "Tantal Greens", 400 },
+    { "Krakka Greens", 250 },
+    { "Gysahl Greens", 100 },
+    { "Tent", 500 },
+    { "Power Source", 500 },
+    { "Guard Source", 500 },
+    { "Magic Source", 500 },
+    { "Mind Source", 500 },
+    { "Speed Source", 500 },
+    { "Luck Source", 500 },
+    { "Zeio Nut", 2 },
+    { "Carob Nut", 2 },
+    { "Porov Nut", 2000 },
+    { "Pram Nut", 1500 },
+    { "Lasan Nut", 600 },
+    { "Saraha Nut", 400 },
+    { "Luchile Nut", 200 },
+    { "Pepio Nut", 100 },
+    { "Battery", 10 },
+    { "Tissue", 2 },
+    { "Omnislash", 500 },
+    { "Catastrophe", 500 },
+    { "Final Heaven", 500 },
+    { "Great Gospel", 500 },
+    { "Cosmo Memory", 500 },
+    { "All Creation", 500 },
+    { "Chaos", 500 },
+    { "Highwind", 500 },
+    { "1/35 soldier", 50 },
+    { "Super Sweeper", 50 },
+    { "Masamune Blade", 50 },
+    { "Save Crystal", 500 },
+    { "Combat Diary", 50 },
+    { "Autograph", 50 },
+    { "Gambler", 50 },
+    { "Desert Rose", 2 },
+    { "Earth Harp", 2 },
+    { "Guide Book", 2 },
+};
+constexpr TableView<Item> GameData::items = { itemTable, std::size(itemTable) };
 
-    // Weapons
-    addWeapon(0, "Buster Sword", 120);
-    addWeapon(1, "Mythril Saber", 1000);
-    addWeapon(2, "Hardedge", 1500);
-    addWeapon(3, "Butterfly Edge", 2800);
-    addWeapon(4, "Enhance Sword", 12000);
-    addWeapon(5, "Organics", 12000);
-    addWeapon(6, "Crystal Sword", 18000);
-    addWeapon(7, "Force Stealer", 2200);
-    addWeapon(8, "Rune Blade", 3800);
-    addWeapon(9, "Murasame", 6500);
-    addWeapon(10, "Nail Bat", 2800);
-    addWeapon(11, "Yoshiyuki", 4200);
-    addWeapon(12, "Apocalypse", 2);
-    addWeapon(13, "Heaven's Cloud", 2);
-    addWeapon(14, "Ragnarok", 2);
-    addWeapon(15, "Ultima Weapon", 2);
-    addWeapon(16, "Leather Glove", 120);
-    addWeapon(17, "Metal Knuckle", 320);
-    addWeapon(18, "Mythril Claw", 750);
-    addWeapon(19, "Grand Glove", 1200);
-    addWeapon(20, "Tiger Fang", 2500);
-    addWeapon(21, "Diamond Knuckle", 5800);
-    addWeapon(22, "Dragon Claw", 10000);
-    addWeapon(23, "Crystal Glove", 16000);
-    addWeapon(24, "Motor Drive", 1800);
-    addWeapon(25, "Platinum Fist", 2700);
-    addWeapon(26, "Kaiser Knuckle", 15000);
-    addWeapon(27, "Work Glove", 2200);
-    addWeapon(28, "Powersoul", 4200);
-    addWeapon(29, "Master Fist", 2);
-    addWeapon(30, "God's Hand", 2);
-    addWeapon(31, "Premium Heart", 2);
-    addWeapon(32, "Gatling Gun", 120);
-    addWeapon(33, "Assault Gun", 350);
-    addWeapon(34, "Cannon Ball", 950);
-    addWeapon(35, "Atomic Scissors", 1400);
-    addWeapon(36, "Heavy Vulcan", 2700);
-    addWeapon(37, "Chainsaw", 6300);
-    addWeapon(38, "Microlaser", 12000);
-    addWeapon(39, "A‧M Cannon", 18000);
-    addWeapon(40, "W Machine Gun", 2000);
-    addWeapon(41, "Drill Arm", 3300);
-    addWeapon(42, "Solid Bazooka", 16000);
-    addWeapon(43, "Rocket Punch", 3200);
-    addWeapon(44, "Enemy Launcher", 3300);
-    addWeapon(45, "Pile Banger", 2);
-    addWeapon(46, "Max Ray", 2);
-    addWeapon(47, "Missing Score", 2);
-    addWeapon(48, "Mythril Clip", 800);
-    addWeapon(49, "Diamond Pin", 1300);
-    addWeapon(50, "Silver Barrette", 2500);
-    addWeapon(51, "Gold Barrette", 6000);
-    addWeapon(52, "Adaman Clip", 11000);
-    addWeapon(53, "Crystal Comb", 17000);
-    addWeapon(54, "Magic Comb", 2000);
-    addWeapon(55, "Plus Barrette", 3500);
-    addWeapon(56, "Centclip", 14000);
-    addWeapon(57, "Hairpin", 6000);
-    addWeapon(58, "Seraph Comb", 8000);
-    addWeapon(59, "Behemoth Horn", 2);
-    addWeapon(60, "Spring Gun Clip", 2);
-    addWeapon(61, "Limited Moon", 2);
-    addWeapon(62, "Guard Stick", 140);
-    addWeapon(63, "Mythril Rod", 370);
-    addWeapon(64, "Full Metal Staff", 800);
-    addWeapon(65, "Striking Staff", 1300);
-    addWeapon(66, "Prism Staff", 2600);
-    addWeapon(67, "Aurora Rod", 5800);
-    addWeapon(68, "Wizard Staff", 1800);
-    addWeapon(69, "Wizer Staff", 3200);
-    addWeapon(70, "Fairy Tale", 2500);
-    addWeapon(71, "Umbrella", 3800);
-    addWeapon(72, "Princess Guard", 7500);
-    addWeapon(73, "Spear", 1200);
-    addWeapon(74, "Slash Lance", 6500);
-    addWeapon(75, "Trident", 7500);
-    addWeapon(76, "Mast Ax", 13000);
-    addWeapon(77, "Partisan", 19000);
-    addWeapon(78, "Viper Halberd", 7000);
-    addWeapon(79, "Javelin", 7500);
-    addWeapon(80, "Grow Lance", 16000);
-    addWeapon(81, "Mop", 3200);
-    addWeapon(82, "Dragoon Lance", 6200);
-    addWeapon(83, "Scimitar", 2);
-    addWeapon(84, "Flayer", 15000);
-    addWeapon(85, "Spirit Lance", 2);
-    addWeapon(86, "Venus Gospel", 2);
-    addWeapon(87, "4-point Shuriken", 600);
-    addWeapon(88, "Boomerang", 1400);
-    addWeapon(89, "Pinwheel", 2600);
-    addWeapon(90, "Razor Ring", 6000);
-    addWeapon(91, "Hawkeye", 12000);
-    addWeapon(92, "Crystal Cross", 18000);
-    addWeapon(93, "Wind Slash", 2000);
-    addWeapon(94, "Twin Viper", 3200);
-    addWeapon(95, "Spiral Shuriken", 14000);
-    addWeapon(96, "Superball", 3000);
-    addWeapon(97, "Magic Shuriken", 6000);
-    addWeapon(98, "Rising Sun", 2);
-    addWeapon(99, "Oritsuru", 2);
-    addWeapon(100, "Conformer", 2);
-    addWeapon(101, "Yellow M-phone", 500);
-    addWeapon(102, "Green M-phone", 2400);
-    addWeapon(103, "Blue M-phone", 5500);
-    addWeapon(104, "Red M-phone", 11000);
-    addWeapon(105, "Crystal M-phone", 18000);
-    addWeapon(106, "White M-phone", 2300);
-    addWeapon(107, "Black M-phone", 2800);
-    addWeapon(108, "Silver M-phone", 3300);
-    addWeapon(109, "Trumpet Shell", 3000);
-    addWeapon(110, "Gold M-phone", 15000);
-    addWeapon(111, "Battle Trumpet", 2);
-    addWeapon(112, "Starlight Phone", 2);
-    addWeapon(113, "HP Shout", 2);
-    addWeapon(114, "Quicksilver", 1000);
-    addWeapon(115, "Shotgun", 3100);
-    addWeapon(116, "Shortbarrel", 6400);
-    addWeapon(117, "Lariat", 12000);
-    addWeapon(118, "Winchester", 18000);
-    addWeapon(119, "Peacemaker", 3500);
-    addWeapon(120, "Buntline", 6800);
-    addWeapon(121, "Long Barrel R", 13000);
-    addWeapon(122, "Silver Rifle", 3000);
-    addWeapon(123, "Sniper CR", 3300);
-    addWeapon(124, "Supershot ST", 2);
-    addWeapon(125, "Outsider", 2);
-    addWeapon(126, "Death Penalty", 2);
-    addWeapon(127, "Masamune", 999999);
+static constexpr Item weaponTable[] = {
+    { "Buster Sword", 120 },
+    { "Mythril Saber", 1000 },
+    { "Hardedge", 1500 },
+    { "Butterfly Edge", 2800 },
+    { "Enhance Sword", 12000 },
+    { "Organics", 12000 },
+    { "Crystal Sword", 18000 },
+    { "Force Stealer", 2200 },
+    { "Rune Blade", 3800 },
+    { "Murasame", 6500 },
+    { "Nail Bat", 2800 },
+    { "Yoshiyuki", 4200 },
+    { "Apocalypse", 2 },
+    { "Heaven's Cloud", 2 },
+    { "Ragnarok", 2 },
+    { "Ultima Weapon", 2 },
+    { "Leather Glove", 120 },
+    { "Metal Knuckle", 320 },
+    { "Mythril Claw", 750 },
+    { "Grand Glove", 1200 },
+    { "Tiger Fang", 2500 },
+    { "Diamond Knuckle", 5800 },
+    { "Dragon Claw", 10000 },
+    { "Crystal Glove", 16000 },
+    { "Motor Drive", 1800 },
+    { "Platinum Fist", 2700 },
+    { "Kaiser Knuckle", 15000 },
+    { "Work Glove", 2200 },
+    { "Powersoul", 4200 },
+    { "Master Fist", 2 },
+    { "God's Hand", 2 },
+    { "Premium Heart", 2 },
+    { "Gatling Gun", 120 },
+    { "Assault Gun", 350 },
+    { "Cannon Ball", 950 },
+    { "Atomic Scissors", 1400 },
+    { "Heavy Vulcan", 2700 },
+    { "Chainsaw", 6300 },
+    { "Microlaser", 12000 },
+    { "A‧M Cannon", 18000 },
+    { "W Machine Gun", 2000 },
+    { "Drill Arm", 3300 },
+    { "Solid Bazooka", 16000 },
+    { "Rocket Punch", 3200 },
+    { "Enemy Launcher", 3300 },
+    { "Pile Banger", 2 },
+    { "Max Ray", 2 },
+    { "Missing Score", 2 },
+    { "Mythril Clip", 800 },
+    { "Diamond Pin", 1300 },
+    { "Silver Barrette", 2500 },
+    { "Gold Barrette", 6000 },
+    { "Adaman Clip", 11000 },
+    { "Crystal Comb", 17000 },
+    { "Magic Comb", 2000 },
+    { "Plus Barrette", 3500 },
+    { "Centclip", 14000 },
+    { "Hairpin", 6000 },
+    { "Seraph Comb", 8000 },
+    { "Behemoth Horn", 2 },
+    { "Spring Gun Clip", 2 },
+    { "Limited Moon", 2 },
+    { "Guard Stick", 140 },
+    { "Mythril Rod", 370 },
+    { "Full Metal Staff", 800 },
+    { "Striking Staff", 1300 },
+    { "Prism Staff", 2600 },
+    { "Aurora Rod", 5800 },
+    { "Wizard Staff", 1800 },
+    { "Wizer Staff", 3200 },
+    { "Fairy Tale", 2500 },
+    { "Umbrella", 3800 },
+    { "Princess Guard", 7500 },
+    { "Spear", 1200 },
+    { "Slash Lance", 6500 },
+    { "Trident", 7500 },
+    { "Mast Ax", 13000 },
+    { "Partisan", 19000 },
+    { "Viper Halberd", 7000 },
+    { "Javelin", 7500 },
+    { "Grow Lance", 16000 },
+    { "Mop", 3200 },
+    { "Dragoon Lance", 6200 },
+    { "Scimitar", 2 },
+    { "Flayer", 15000 },
+    { "Spirit Lance", 2 },
+    { "Venus Gospel", 2 },
+    { "4-point Shuriken", 600 },
+    { "Boomerang", 1400 },
+    { "Pinwheel", 2600 },
+    { "Razor Ring", 6000 },
+    { "Hawkeye", 12000 },
+    { "Crystal Cross", 18000 },
+    { "Wind Slash", 2000 },
+    { "Twin Viper", 3200 },
+    { "Spiral Shuriken", 14000 },
+    { "Superball", 3000 },
+    { "Magic Shuriken", 6000 },
+    { "Rising Sun", 2 },
+    { "Oritsuru", 2 },
+    { "Conformer", 2 },
+    { "Yellow M-phone", 500 },
+    { "Green M-phone", 2400 },
+    { "Blue M-phone", 5500 },
+    { "Red M-phone", 11000 },
+    { "Crystal M-phone", 18000 },
+    { "White M-phone", 2300 },
+    { "Black M-phone", 2800 },
+    { "Silver M-phone", 3300 },
+    { "Trumpet Shell", 3000 },
+    { "Gold M-phone", 15000 },
+    { "Battle Trumpet", 2 },
+    { "Starlight Phone", 2 },
+    { "HP Shout", 2 },
+    { "Quicksilver", 1000 },
+    { "Shotgun", 3100 },
+    { "Shortbarrel", 6400 },
+    { "Lariat", 12000 },
+    { "Winchester", 18000 },
+    { "Peacemaker", 3500 },
+    { "Buntline", 6800 },
+    { "Long Barrel R", 13000 },
+    { "Silver Rifle", 3000 },
+    { "Sniper CR", 3300 },
+    { "Supershot ST", 2 },
+    { "Outsider", 2 },
+    { "Death Penalty", 2 },
+    { "Masamune", 999999 },
+};
+constexpr TableView<Item> GameData::weapons = { weaponTable, std::size(weaponTable) };
 
-    // Armor
-    addArmor(0, "Bronze Bangle", 100);
-    addArmor(1, "Iron Bangle", 160);
-    addArmor(2, "Titan Bangle", 280);
-    addArmor(3, "Mythril Armlet", 350);
-    addArmor(4, "Carbon Bangle", 800);
-    addArmor(5, "Silver Armlet", 1300);
-    addArmor(6, "Gold Armlet", 2000);
-    addArmor(7, "Diamond Bangle", 3200);
-    addArmor(8, "Crystal Bangle", 4800);
-    addArmor(9, "Platinum Bangle", 1800);
-    addArmor(10, "Rune Armlet", 3700);
-    addArmor(11, "Edincoat", 8000);
-    addArmor(12, "Wizard Bracelet", 12000);
-    addArmor(13, "Adaman Bangle", 600);
-    addArmor(14, "Gigas Armlet", 800);
-    addArmor(15, "Imperial Guard", 2);
-    addArmor(16, "Aegis Armlet", 2);
-    addArmor(17, "Fourth Bracelet", 2);
-    addArmor(18, "Warrior Bangle", 1000);
-    addArmor(19, "Shinra Beta", 950);
-    addArmor(20, "Shinra Alpha", 1500);
-    addArmor(21, "Four Slots", 1300);
-    addArmor(22, "Fire Armlet", 4800);
-    addArmor(23, "Aurora Armlet", 4800);
-    addArmor(24, "Bolt Armlet", 4800);
-    addArmor(25, "Dragon Armlet", 3800);
-    addArmor(26, "Minerva Band", 2);
-    addArmor(27, "Escort Guard", 2);
-    addArmor(28, "Mystile", 2);
-    addArmor(29, "Ziedrich", 2);
-    addArmor(30, "Precious Watch", 2);
-    addArmor(31, "Chocobracelet", 2);
+static constexpr Item armorTable[] = {
+    { "Bronze Bangle", 100 },
+    { "Iron Bangle", 160 },
+    { "Titan Bangle", 280 },
+    { "Mythril Armlet", 350 },
+    { "Carbon Bangle", 800 },
+    { "Silver Armlet", 1300 },
+    { "Gold Armlet", 2000 },
+    { "Diamond Bangle", 3200 },
+    { "Crystal Bangle", 4800 },
+    { "Platinum Bangle", 1800 },
+    { "Rune Armlet", 3700 },
+    { "Edincoat", 8000 },
+    { "Wizard Bracelet", 12000 },
+    { "Adaman Bangle", 600 },
+    { "Gigas Armlet", 800 },
+    { "Imperial Guard", 2 },
+    { "Aegis Armlet", 2 },
+    { "Fourth Bracelet", 2 },
+    { "Warrior Bangle", 1000 },
+    { "Shinra Beta", 950 },
+    { "Shinra Alpha", 1500 },
+    { "Four Slots", 1300 },
+    { "Fire Armlet", 4800 },
+    { "Aurora Armlet", 4800 },
+    { "Bolt Armlet", 4800 },
+    { "Dragon Armlet", 3800 },
+    { "Minerva Band", 2 },
+    { "Escort Guard", 2 },
+    { "Mystile", 2 },
+    { "Ziedrich", 2 },
+    { "Precious Watch", 2 },
+    { "Chocobracelet", 2 },
+};
+constexpr TableView<Item> GameData::armors = { armorTable, std::size(armorTable) };
 
-    // Accessories
-    addAccessory(0, "Power Wrist", 7500);
-    addAccessory(1, "Protect Vest", 3500);
-    addAccessory(2, "Earring", 7500);
-    addAccessory(3, "Talisman", 4000);
-    addAccessory(4, "Choco Feather", 10000);
-    addAccessory(5, "Amulet", 10000);
-    addAccessory(6, "Champion Belt", 2);
-    addAccessory(7, "Poison Ring", 20000);
-    addAccessory(8, "Touph Ring", 2);
-    addAccessory(9, "Circlet", 2);
-    addAccessory(10, "Star Pendant", 4000);
-    addAccessory(11, "Silver Glasses", 3000);
-    addAccessory(12, "Headband", 3000);
-    addAccessory(13, "Fairy Ring", 7000);
-    addAccessory(14, "Jem Ring", 7500);
-    addAccessory(15, "White Cape", 5000);
-    addAccessory(16, "Sprint Shoes", 500);
-    addAccessory(17, "Peace Ring", 7500);
-    addAccessory(18, "Ribbon", 2);
-    addAccessory(19, "Fire Ring", 8000);
-    addAccessory(20, "Ice Ring", 8000);
-    addAccessory(21, "Bolt Ring", 8000);
-    addAccessory(22, "Tetra Elemental", 2);
-    addAccessory(23, "Safety Bit", 7500);
-    addAccessory(24, "Fury Ring", 5000);
-    addAccessory(25, "Curse Ring", 2);
-    addAccessory(26, "Protect Ring", 9000);
-    addAccessory(27, "Cat's Bell", 2);
-    addAccessory(28, "Reflect Ring", 12000);
-    addAccessory(29, "Water Ring", 10000);
-    addAccessory(30, "Sneak Glove", 2);
-    addAccessory(31, "HypnoCrown", 2);
+static constexpr Item accessoryTable[] = {
+    { "Power Wrist", 7500 },
+    { "Protect Vest", 3500 },
+    { "Earring", 7500 },
+    { "Talisman", 4000 },
+    { "Choco Feather", 10000 },
+    { "Amulet", 10000 },
+    { "Champion Belt", 2 },
+    { "Poison Ring", 20000 },
+    { "Touph Ring", 2 },
+    { "Circlet", 2 },
+    { "Star Pendant", 4000 },
+    { "Silver Glasses", 3000 },
+    { "Headband", 3000 },
+    { "Fairy Ring", 7000 },
+    { "Jem Ring", 7500 },
+    { "White Cape", 5000 },
+    { "Sprint Shoes", 500 },
+    { "Peace Ring", 7500 },
+    { "Ribbon", 2 },
+    { "Fire Ring", 8000 },
+    { "Ice Ring", 8000 },
+    { "Bolt Ring", 8000 },
+    { "Tetra Elemental", 2 },
+    { "Safety Bit", 7500 },
+    { "Fury Ring", 5000 },
+    { "Curse Ring", 2 },
+    { "Protect Ring", 9000 },
+    { "Cat's Bell", 2 },
+    { "Reflect Ring", 12000 },
+    { "Water Ring", 10000 },
+    { "Sneak Glove", 2 },
+    { "HypnoCrown", 2 },
+};
+constexpr TableView<Item> GameData::accessories = { accessoryTable, std::size(accessoryTable) };
 
-    // Materia
-    addMateria(0, "MP Plus", 8000);
-    addMateria(1, "HP Plus", 8000);
-    addMateria(2, "Speed Plus", 20000);
-    addMateria(3, "Magic Plus", 20000);
-    addMateria(4, "Luck Plus", 15000);
-    addMateria(5, "EXP Plus", 1);
-    addMateria(6, "Gil Plus", 1);
-    addMateria(7, "Enemy Away", 1);
-    addMateria(8, "Enemy Lure", 1);
-    addMateria(9, "Chocobo Lure", 1);
-    addMateria(10, "Pre-Emptive", 1);
-    addMateria(11, "Long Range", 1);
-    addMateria(12, "Mega All", 1);
-    addMateria(13, "Counter Attack", 1);
-    addMateria(14, "Slash-All", 1);
-    addMateria(15, "Double Cut", 1);
-    addMateria(16, "Cover", 1000);
-    addMateria(17, "Underwater", 1);
-    addMateria(18, "HP<->MP", 1);
-    addMateria(19, "W-Magic", 1);
-    addMateria(20, "W-Summon", 1);
-    addMateria(21, "W-Item", 1);
-    addMateria(23, "All", 20000);
-    addMateria(24, "Counter", 1);
-    addMateria(25, "Magic Counter", 1);
-    addMateria(26, "MP Turbo", 1);
-    addMateria(27, "MP Absorb", 1);
-    addMateria(28, "HP Absorb", 1);
-    addMateria(29, "Elemental", 1);
-    addMateria(30, "Added Effect", 1);
-    addMateria(31, "Sneak Attack", 1);
-    addMateria(32, "Final Attack", 1);
-    addMateria(33, "Added Cut", 1);
-    addMateria(34, "Steal as well", 1);
-    addMateria(35, "Quadra Magic", 1);
-    addMateria(36, "Steal", 1200);
-    addMateria(37, "Sense", 1000);
-    addMateria(39, "Throw", 10000);
-    addMateria(40, "Morph", 1);
-    addMateria(41, "Deathblow", 10000);
-    addMateria(42, "Manipulate", 10000);
-    addMateria(43, "Mime", 1);
-    addMateria(44, "Enemy Skill", 1);
-    addMateria(48, "Master Command", 1);
-    addMateria(49, "Fire", 600);
-    addMateria(50, "Ice", 600);
-    addMateria(51, "Earth", 1500);
-    addMateria(52, "Lightning", 600);
-    addMateria(53, "Restore", 750);
-    addMateria(54, "Heal", 1500);
-    addMateria(55, "Revive", 3000);
-    addMateria(56, "Seal", 3000);
-    addMateria(57, "Mystify", 6000);
-    addMateria(58, "Transform", 5000);
-    addMateria(59, "Exit", 10000);
-    addMateria(60, "Poison", 1500);
-    addMateria(61, "Gravity", 8000);
-    addMateria(62, "Barrier", 10000);
-    addMateria(64, "Comet", 20000);
-    addMateria(65, "Time", 6000);
-    addMateria(68, "Destruct", 9000);
-    addMateria(69, "Contain", 1);
-    addMateria(70, "Full Cure", 1);
-    addMateria(71, "Shield", 1);
-    addMateria(72, "Ultima", 1);
-    addMateria(73, "Master Magic", 1);
-    addMateria(74, "Choco/Mog", 1);
-    addMateria(75, "Shiva", 1);
-    addMateria(76, "Ifrit", 1);
-    addMateria(77, "Ramuh", 1);
-    addMateria(78, "Titan", 1);
-    addMateria(79, "Odin", 1);
-    addMateria(80, "Leviathan", 1);
-    addMateria(81, "Bahamut", 1);
-    addMateria(82, "Kjata", 1);
-    addMateria(83, "Alexander", 1);
-    addMateria(84, "Phoenix", 1);
-    addMateria(85, "Neo Bahamut", 1);
-    addMateria(86, "Hades", 1);
-    addMateria(87, "Typoon", 1);
-    addMateria(88, "Bahamut ZERO", 1);
-    addMateria(89, "Knights of Round", 1);
-    addMateria(90, "Master Summon", 1);
+static constexpr Item materiaTable[] = {
+    { "MP Plus", 8000 },
+    { "HP Plus", 8000 },
+    { "Speed Plus", 20000 },
+    { "Magic Plus", 20000 },
+    { "Luck Plus", 15000 },
+    { "EXP Plus", 1 },
+    { "Gil Plus", 1 },
+    { "Enemy Away", 1 },
+    { "Enemy Lure", 1 },
+    { "Chocobo Lure", 1 },
+    { "Pre-Emptive", 1 },
+    { "Long Range", 1 },
+    { "Mega All", 1 },
+    { "Counter Attack", 1 },
+    { "Slash-All", 1 },
+    { "Double Cut", 1 },
+    { "Cover", 1000 },
+    { "Underwater", 1 },
+    { "HP<->MP", 1 },
+    { "W-Magic", 1 },
+    { "W-Summon", 1 },
+    { "W-Item", 1 },
+    { "", 0 },
+    { "All", 20000 },
+    { "Counter", 1 },
+    { "Magic Counter", 1 },
+    { "MP Turbo", 1 },
+    { "MP Absorb", 1 },
+    { "HP Absorb", 1 },
+    { "Elemental", 1 },
+    { "Added Effect", 1 },
+    { "Sneak Attack", 1 },
+    { "Final Attack", 1 },
+    { "Added Cut", 1 },
+    { "Steal as well", 1 },
+    { "Quadra Magic", 1 },
+    { "Steal", 1200 },
+    { "Sense", 1000 },
+    { "", 0 },
+    { "Throw", 10000 },
+    { "Morph", 1 },
+    { "Deathblow", 10000 },
+    { "Manipulate", 10000 },
+    { "Mime", 1 },
+    { "Enemy Skill", 1 },
+    { "", 0 },
+    { "", 0 },
+    { "", 0 },
+    { "Master Command", 1 },
+    { "Fire", 600 },
+    { "Ice", 600 },
+    { "Earth", 1500 },
+    { "Lightning", 600 },
+    { "Restore", 750 },
+    { "Heal", 1500 },
+    { "Revive", 3000 },
+    { "Seal", 3000 },
+    { "Mystify", 6000 },
+    { "Transform", 5000 },
+    { "Exit", 10000 },
+    { "Poison", 1500 },
+    { "Gravity", 8000 },
+    { "Barrier", 10000 },
+    { "", 0 },
+    { "Comet", 20000 },
+    { "Time", 6000 },
+    { "", 0 },
+    { "", 0 },
+    { "Destruct", 9000 },
+    { "Contain", 1 },
+    { "Full Cure", 1 },
+    { "Shield", 1 },
+    { "Ultima", 1 },
+    { "Master Magic", 1 },
+    { "Choco/Mog", 1 },
+    { "Shiva", 1 },
+    { "Ifrit", 1 },
+    { "Ramuh", 1 },
+    { "Titan", 1 },
+    { "Odin", 1 },
+    { "Leviathan", 1 },
+    { "Bahamut", 1 },
+    { "Kjata", 1 },
+    { "Alexander", 1 },
+    { "Phoenix", 1 },
+    { "Neo Bahamut", 1 },
+    { "Hades", 1 },
+    { "Typoon", 1 },
+    { "Bahamut ZERO", 1 },
+    { "Knights of Round", 1 },
+    { "Master Summon", 1 },
+};
+constexpr TableView<Item> GameData::materia = { materiaTable, std::size(materiaTable) };
 
-    addESkill("Frog Song", 0b00000011, 5, 0);
-    addESkill("L4 Suicide", 0b00000111, 10, 1);
-    addESkill("Magic Hammer", 0b00000011, 3, 2);
-    addESkill("White Wind", 0b00000101, 34, 3);
-    addESkill("Big Guard", 0b00000101, 56, 4);
-    addESkill("Angel Whisper", 0b00000001, 50, 5);
-    addESkill("Dragon Force", 0b00000001, 19, 6);
-    addESkill("Death Force", 0b00000001, 3, 7);
-    addESkill("Flame Thrower", 0b00000011, 10, 8);
-    addESkill("Laser", 0b00000011, 16, 9);
-    addESkill("Matra Magic", 0b00000111, 8, 10);
-    addESkill("Bad Breath", 0b00000111, 58, 11);
-    addESkill("Beta", 0b00000111, 35, 12);
-    addESkill("Aqualung", 0b00000111, 34, 13);
-    addESkill("Trine", 0b00000111, 20, 14);
-    addESkill("Magic Breath", 0b00000111, 75, 15);
-    addESkill("????", 0b00000011, 3, 16);
-    addESkill("Goblin Punch", 0b00000011, 0, 17);
-    addESkill("Chocobuckle", 0b00000011, 3, 18);
-    addESkill("L5 Death", 0b00000111, 22, 19);
-    addESkill("Death Sentence", 0b00000011, 10, 20);
-    addESkill("Roulette", 0b11000111, 6, 21);
-    addESkill("Shadow Flare", 0b00000011, 100, 22);
-    addESkill("Pandora’s Box", 0b00000111, 110, 23);
+// Enemy Skills
+static constexpr ESkill eSkillTable[] = {
+    { "Frog Song", 0b00000011, 5, 0 },
+    { "L4 Suicide", 0b00000111, 10, 1 },
+    { "Magic Hammer", 0b00000011, 3, 2 },
+    { "White Wind", 0b00000101, 34, 3 },
+    { "Big Guard", 0b00000101, 56, 4 },
+    { "Angel Whisper", 0b00000001, 50, 5 },
+    { "Dragon Force", 0b00000001, 19, 6 },
+    { "Death Force", 0b00000001, 3, 7 },
+    { "Flame Thrower", 0b00000011, 10, 8 },
+    { "Laser", 0b00000011, 16, 9 },
+    { "Matra Magic", 0b00000111, 8, 10 },
+    { "Bad Breath", 0b00000111, 58, 11 },
+    { "Beta", 0b00000111, 35, 12 },
+    { "Aqualung", 0b00000111, 34, 13 },
+    { "Trine", 0b00000111, 20, 14 },
+    { "Magic Breath", 0b00000111, 75, 15 },
+    { "????", 0b00000011, 3, 16 },
+    { "Goblin Punch", 0b00000011, 0, 17 },
+    { "Chocobuckle", 0b00000011, 3, 18 },
+    { "L5 Death", 0b00000111, 22, 19 },
+    { "Death Sentence", 0b00000011, 10, 20 },
+    { "Roulette", 0b11000111, 6, 21 },
+    { "Shadow Flare", 0b00000011, 100, 22 },
+    { "Pandora’s Box", 0b00000111, 110, 23 },
+};
+constexpr TableView<ESkill> GameData::eSkills = { eSkillTable, std::size(eSkillTable) };
 
-    addField(0x00A4, "4sbwy_1");
-    addFieldScriptMessage(0x00A4, 4, 1, 0, 0x354, 0x453, 17);
-    addFieldScriptItem(0x00A4, 4, 1, 0x357, 3, 1);
-    addFieldModels(0x00A4, {1,0});
-    addFieldEncounters(0x00A4, 0x31F4, {24912,22865,18770,0,0,0,0,0,0,8531}, {});
-    addField(0x02DF, "4sbwy_22");
-    addFieldModels(0x02DF, {1});
-    addField(0x00A5, "4sbwy_2");
-    addFieldModels(0x00A5, {1});
-    addField(0x00A6, "4sbwy_3");
-    addFieldScriptMessage(0x00A6, 6, 1, 0, 0x48E, 0x569, 18);
-    addFieldScriptItem(0x00A6, 6, 1, 0x491, 0, 1);
-    addFieldModels(0x00A6, {1,0,0});
-    addFieldEncounters(0x00A6, 0x464C, {24912,22865,18770,0,0,0,0,0,0,8531}, {});
-    addField(0x00A7, "4sbwy_4");
-    addFieldModels(0x00A7, {1});
-    addFieldEncounters(0x00A7, 0x4AC0, {24916,22869,18774,0,0,0,4439,4439,0,0}, {});
-    addField(0x00A8, "4sbwy_5");
-    addFieldModels(0x00A8, {1,0});
-    addFieldEncounters(0x00A8, 0x75A0, {24916,22869,18774,0,0,0,4439,4439,0,0}, {});
-    addField(0x00A9, "4sbwy_6");
-    addFieldScriptMessage(0x00A9, 8, 1, 0, 0x5C9, 0x6B7, 16);
-    addFieldScriptItem(0x00A9, 8, 1, 0x5CC, 70, 1);
-    addFieldModels(0x00A9, {1,0,0,0});
-    addFieldEncounters(0x00A9, 0x6458, {24916,22869,18774,0,0,0,4439,4439,0,0}, {});
-    addField(0x00AE, "5min1_1");
-    addFieldModels(0x00AE, {1,4,6,0,0,0});
-    addField(0x00AF, "5min1_2");
-    addFieldScriptMessage(0x00AF, 5, 1, 0, 0x414, 0x8DB, 23);
-    addFieldScriptItem(0x00AF, 5, 1, 0x417, 4, 1);
-    addFieldScriptMessage(0x00AF, 8, 4, 3, 0x62A, 0xA14, 108);
-    addFieldModels(0x00AF, {1,4,6,0,0});
-    addField(0x024A, "5tower");
-    addFieldScriptBattle(0x024A, 17, 1, 0x13E8, 623);
-    addFieldScriptBattle(0x024A, 18, 1, 0x179D, 624);
-    addFieldScriptBattle(0x024A, 19, 1, 0x1BEA, 625);
-    addFieldScriptBattle(0x024A, 20, 1, 0x2032, 626);
-    addFieldScriptMateria(0x024A, 21, 0, 0x22A6, 80);
-    addFieldScriptMessage(0x024A, 21, 0, 0, 0x22C5, 0x5E43, 29);
-    addFieldScriptMateria(0x024A, 21, 1, 0x26B3, 80);
-    addFieldScriptMessage(0x024A, 21, 1, 0, 0x26DF, 0x5E43, 29);
-    addFieldScriptBattle(0x024A, 21, 1, 0x283E, 628);
-    addFieldModels(0x024A, {1,3,4,2,5,7,8,9,6,0,0,0,0,0});
-    addField(0x0099, "7min1");
-    addFieldModels(0x0099, {1,0,0,0,0,0,0,0});
-    addField(0x0286, "ancnt1");
-    addFieldModels(0x0286, {1,3,4,5,6,8,9,7,2,0});
-    addField(0x0287, "ancnt2");
-    addFieldModels(0x0287, {1,0,2});
-    addField(0x0288, "ancnt3");
-    addFieldScriptBattle(0x0288, 0, 0, 0x25C, 671);
-    addFieldModels(0x0288, {1,2,0,0});
-    addField(0x0289, "ancnt4");
-    addFieldModels(0x0289, {1,2,3,4,5,6,8,9,7});
-    addField(0x026C, "anfrst_1");
-    addFieldScriptMessage(0x026C, 35, 1, 0, 0x2B55, 0x2F1A, 24);
-    addFieldScriptItem(0x026C, 35, 1, 0x2B58, 282, 1);
-    addFieldScriptMateria(0x026C, 36, 1, 0x2B95, 14);
-    addFieldScriptMessage(0x026C, 36, 1, 0, 0x2BB5, 0x2F33, 29);
-    addFieldModels(0x026C, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x026C, 0xC33C, {19220,18197,16150,15127,0,0,0,0,0,0}, {});
-    addField(0x026D, "anfrst_2");
-    addFieldScriptMateria(0x026D, 9, 1, 0x88F, 87);
-    addFieldScriptMessage(0x026D, 9, 1, 0, 0x8AF, 0xAD6, 26);
-    addFieldModels(0x026D, {1,4,6,0,0,0,0});
-    addFieldEncounters(0x026D, 0x86F0, {19220,18197,16150,15127,0,0,0,0,0,0}, {});
-    addField(0x026E, "anfrst_3");
-    addFieldScriptMessage(0x026E, 26, 1, 0, 0x2134, 0x2444, 24);
-    addFieldScriptItem(0x026E, 26, 1, 0x2137, 252, 1);
-    addFieldScriptMessage(0x026E, 27, 1, 0, 0x2187, 0x245D, 27);
-    addFieldScriptItem(0x026E, 27, 1, 0x218A, 188, 1);
-    addFieldWorldExit(0x026E, 0xB774, 0, 0x37);
-    addFieldModels(0x026E, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x026E, 0xBA20, {19220,18197,16150,15127,0,0,2840,2840,8985,4890}, {});
-    addField(0x026F, "anfrst_4");
-    addFieldModels(0x026F, {1,4,6,0,0,0,0,0,0,0});
-    addFieldEncounters(0x026F, 0xAEA8, {19220,18197,16150,15127,0,0,2840,2840,8985,4890}, {});
-    addField(0x0270, "anfrst_5");
-    addFieldScriptMessage(0x0270, 4, 1, 0, 0x2B6, 0x4D8, 22);
-    addFieldScriptItem(0x0270, 4, 1, 0x2B9, 140, 1);
-    addFieldScriptMessage(0x0270, 5, 1, 0, 0x337, 0x541, 18);
-    addFieldScriptItem(0x0270, 5, 1, 0x33A, 5, 1);
-    addFieldWorldExit(0x0270, 0x9818, 0, 0x37);
-    addFieldModels(0x0270, {1,4,6,0,0});
-    addFieldEncounters(0x0270, 0x9AC4, {25552,23505,19410,0,0,0,5075,5075,0,0}, {});
-    addField(0x01E4, "astage_a");
-    addFieldModels(0x01E4, {1,2,4,6,7,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x01E5, "astage_b");
-    addFieldModels(0x01E5, {1,2,4,7,0,0,0,0,0});
-    addField(0x01E8, "bigwheel");
-    addFieldModels(0x01E8, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x005D, "blackbg1");
-    addFieldScriptItem(0x005D, 5, 1, 0x7F6, 98, 2);
-    addFieldModels(0x005D, {1,4,2,0,3,6,0,5,0});
-    addField(0x005E, "blackbg2");
-    addFieldModels(0x005E, {1,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x005F, "blackbg3");
-    addFieldScriptItem(0x005F, 4, 1, 0x697, 104, 1);
-    addFieldScriptItem(0x005F, 4, 1, 0x6A6, 102, 1);
-    addFieldScriptItem(0x005F, 4, 1, 0x6B5, 103, 1);
-    addFieldScriptItem(0x005F, 8, 1, 0xAAA, 98, 99);
-    addFieldModels(0x005F, {1,0,2,0,0,0,0,0,0});
-    addField(0x0060, "blackbg4");
-    addFieldScriptMateria(0x0060, 11, 1, 0x12D7, 74);
-    addFieldScriptMateria(0x0060, 11, 1, 0x12DE, 75);
-    addFieldScriptMateria(0x0060, 11, 1, 0x12E5, 76);
-    addFieldScriptMateria(0x0060, 11, 1, 0x12EC, 77);
-    addFieldScriptMateria(0x0060, 11, 1, 0x12F3, 78);
-    addFieldScriptMateria(0x0060, 11, 1, 0x12FA, 79);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1301, 80);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1308, 81);
-    addFieldScriptMateria(0x0060, 11, 1, 0x130F, 82);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1316, 83);
-    addFieldScriptMateria(0x0060, 11, 1, 0x131D, 84);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1324, 84);
-    addFieldScriptMateria(0x0060, 11, 1, 0x132B, 84);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1332, 85);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1339, 86);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1340, 87);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1347, 88);
-    addFieldScriptMateria(0x0060, 11, 1, 0x134E, 89);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1355, 90);
-    addFieldScriptMateria(0x0060, 11, 1, 0x135C, 90);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1363, 90);
-    addFieldScriptMateria(0x0060, 11, 1, 0x136A, 48);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1371, 48);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1378, 48);
-    addFieldScriptMateria(0x0060, 11, 1, 0x137F, 73);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1386, 73);
-    addFieldScriptMateria(0x0060, 11, 1, 0x138D, 73);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1394, 32);
-    addFieldScriptMateria(0x0060, 11, 1, 0x139B, 32);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13A2, 32);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13A9, 1);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13B0, 1);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13B7, 1);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13BE, 11);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13C5, 11);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13CC, 11);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13D3, 12);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13DA, 12);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13E1, 12);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13E8, 19);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13EF, 19);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13F6, 19);
-    addFieldScriptMateria(0x0060, 11, 1, 0x13FD, 21);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1404, 21);
-    addFieldScriptMateria(0x0060, 11, 1, 0x140B, 21);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1412, 20);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1419, 20);
-    addFieldScriptMateria(0x0060, 11, 1, 0x1420, 20);
-    addFieldScriptItem(0x0060, 11, 1, 0x1427, 6, 99);
-    addFieldScriptItem(0x0060, 11, 1, 0x142C, 75, 99);
-    addFieldScriptItem(0x0060, 11, 1, 0x1431, 71, 99);
-    addFieldScriptItem(0x0060, 11, 1, 0x1436, 87, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x143B, 88, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1440, 89, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1445, 90, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x144A, 91, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x144F, 92, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1454, 93, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1459, 94, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x145E, 142, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1463, 143, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1468, 158, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x146D, 159, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1472, 174, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1477, 175, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x147C, 188, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1481, 189, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1486, 213, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x148B, 214, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1490, 227, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x1495, 228, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x149A, 240, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x149F, 241, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x14A4, 253, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x14A9, 254, 1);
-    addFieldScriptItem(0x0060, 11, 1, 0x14AE, 284, 9);
-    addFieldScriptItem(0x0060, 11, 1, 0x14B3, 285, 9);
-    addFieldScriptItem(0x0060, 11, 1, 0x14B8, 306, 9);
-    addFieldScriptItem(0x0060, 11, 1, 0x14BD, 304, 9);
-    addFieldScriptBattle(0x0060, 11, 1, 0x1693, 999);
-    addFieldScriptItem(0x0060, 14, 1, 0x186A, 62, 99);
-    addFieldScriptItem(0x0060, 14, 1, 0x186F, 63, 19);
-    addFieldScriptItem(0x0060, 14, 1, 0x1874, 64, 18);
-    addFieldScriptItem(0x0060, 14, 1, 0x1879, 65, 17);
-    addFieldScriptItem(0x0060, 14, 1, 0x187E, 66, 16);
-    addFieldScriptItem(0x0060, 14, 1, 0x1883, 67, 15);
-    addFieldScriptItem(0x0060, 14, 1, 0x1888, 68, 14);
-    addFieldScriptItem(0x0060, 14, 1, 0x188D, 69, 13);
-    addFieldScriptItem(0x0060, 14, 1, 0x1892, 77, 20);
-    addFieldScriptItem(0x0060, 14, 1, 0x1897, 78, 19);
-    addFieldScriptItem(0x0060, 14, 1, 0x189C, 79, 18);
-    addFieldScriptItem(0x0060, 14, 1, 0x18A1, 80, 17);
-    addFieldScriptItem(0x0060, 14, 1, 0x18A6, 81, 16);
-    addFieldScriptItem(0x0060, 14, 1, 0x18AB, 82, 15);
-    addFieldScriptItem(0x0060, 14, 1, 0x18B0, 83, 14);
-    addFieldScriptItem(0x0060, 14, 1, 0x18B5, 84, 13);
-    addFieldScriptShop(0x0060, 14, 1, 0x1B73, 14);
-    addFieldScriptItem(0x0060, 15, 1, 0x1BDD, 98, 1);
-    addFieldModels(0x0060, {0,0,0,0,0,7,7,0,0,0,7,0,0,0});
-    addField(0x0061, "blackbg5");
-    addFieldModels(0x0061, {1,2,4,0,0,0,8,0,0,0,7,3,1,0});
-    addField(0x0062, "blackbg6");
-    addFieldModels(0x0062, {1,3,3,4,2,2,8,8,0,7,6,6,6,0});
-    addField(0x0063, "blackbg7");
-    addFieldScriptBattle(0x0063, 3, 1, 0x58C, 999);
-    addFieldScriptItem(0x0063, 7, 1, 0x98E, 85, 3);
-    addFieldScriptItem(0x0063, 7, 1, 0xA19, 85, 3);
-    addFieldScriptItem(0x0063, 7, 1, 0xA72, 85, 3);
-    addFieldScriptBattle(0x0063, 8, 1, 0xABC, 288);
-    addFieldModels(0x0063, {1,3,4,2,5,7,8,6,0,0,0,0});
-    addField(0x0064, "blackbg8");
-    addFieldModels(0x0064, {1,4,3,2,5,0,0,0,0,7,6});
-    addField(0x0065, "blackbg9");
-    addFieldScriptBattle(0x0065, 0, 0, 0x15A, 468);
-    addFieldModels(0x0065, {1});
-    addField(0x0067, "blackbgb");
-    addFieldScriptBattle(0x0067, 0, 0, 0x33D, 468);
-    addFieldModels(0x0067, {1,0,0});
-    addField(0x0068, "blackbgc");
-    addFieldModels(0x0068, {1});
-    addField(0x006A, "blackbge");
-    addFieldScriptBattle(0x006A, 0, 0, 0x168, 924);
-    addFieldModels(0x006A, {1});
-    addField(0x006D, "blackbgh");
-    addFieldModels(0x006D, {1});
-    addField(0x006E, "blackbgi");
-    addFieldScriptMateria(0x006E, 9, 1, 0x89D, 81);
-    addFieldModels(0x006E, {1,4,6,0,9,5,7,2,3,8,0});
-    addField(0x006F, "blackbgj");
-    addFieldModels(0x006F, {4});
-    addField(0x0070, "blackbgk");
-    addFieldModels(0x0070, {1,3,4,5,6,7,8,9,2,0,0});
-    addField(0x00EA, "blin1");
-    addFieldScriptBattle(0x00EA, 29, 3, 0x1F40, 415);
-    addFieldScriptMessage(0x00EA, 37, 4, 3, 0x2175, 0x2753, 210);
-    addFieldModels(0x00EA, {1,2,3,4,5,0,0,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x00EA, 0xC1D8, {24992,22945,18848,0,0,0,0,0,0,8610}, {});
-    addField(0x00EB, "blin2");
-    addFieldModels(0x00EB, {1,2,3,4,5,8,7,6,9});
-    addFieldEncounters(0x00EB, 0x6588, {24992,22945,18851,0,0,0,0,0,0,0}, {});
-    addField(0x00EC, "blin2_i");
-    addFieldScriptShop(0x00EC, 15, 4, 0xA7C, 10);
-    addFieldScriptShop(0x00EC, 15, 4, 0xA9B, 10);
-    addFieldScriptShop(0x00EC, 15, 4, 0xB08, 10);
-    addFieldScriptItem(0x00EC, 17, 1, 0xC53, 173, 1);
-    addFieldScriptMessage(0x00EC, 18, 1, 0, 0xCE1, 0x1039, 23);
-    addFieldScriptItem(0x00EC, 18, 1, 0xCE4, 157, 1);
-    addFieldModels(0x00EC, {1,2,3,4,5,0,0,0,0,0});
-    addField(0x00ED, "blin3_1");
-    addFieldModels(0x00ED, {1,2,3,4});
-    addFieldEncounters(0x00ED, 0x56BC, {24995,22945,18848,0,0,0,0,0,0,8610}, {});
-    addField(0x00EE, "blin59");
-    addFieldScriptBattle(0x00EE, 23, 5, 0xE3D, 422);
-    addFieldScriptBattle(0x00EE, 24, 5, 0xEAD, 422);
-    addFieldModels(0x00EE, {1,3,4,6,0,0,0});
-    addFieldEncounters(0x00EE, 0x7520, {24995,22948,18853,0,0,0,0,0,0,0}, {});
-    addField(0x00EF, "blin60_1");
-    addFieldScriptBattle(0x00EF, 29, 3, 0x1880, 423);
-    addFieldModels(0x00EF, {1,3,4,0,0,0,0,0,0});
-    addField(0x00F0, "blin60_2");
-    addFieldModels(0x00F0, {1,4,6});
-    addField(0x00F1, "blin61");
-    addFieldModels(0x00F1, {1,4,6,0,0,0,0,0,0});
-    addField(0x00F2, "blin62_1");
-    addFieldScriptMateria(0x00F2, 26, 1, 0x1237, 29);
-    addFieldScriptMessage(0x00F2, 26, 1, 2, 0x1257, 0x259F, 29);
-    addFieldScriptMessage(0x00F2, 26, 1, 2, 0x1290, 0x2661, 18);
-    addFieldScriptItem(0x00F2, 26, 1, 0x1293, 5, 1);
-    addFieldScriptMessage(0x00F2, 26, 1, 2, 0x12BD, 0x2674, 17);
-    addFieldScriptItem(0x00F2, 26, 1, 0x12C0, 3, 1);
-    addFieldScriptMessage(0x00F2, 26, 1, 2, 0x12EA, 0x2686, 18);
-    addFieldScriptItem(0x00F2, 26, 1, 0x12ED, 0, 1);
-    addFieldModels(0x00F2, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x00F3, "blin62_2");
-    addFieldModels(0x00F3, {1,2,3,4,5,6,7,8,9});
-    addField(0x00F4, "blin62_3");
-    addFieldModels(0x00F4, {1,2,3,4,5,6,7,8,9});
-    addField(0x00F5, "blin63_1");
-    addFieldScriptMessage(0x00F5, 15, 1, 0, 0x177A, 0x32A4, 24);
-    addFieldScriptItem(0x00F5, 15, 1, 0x177D, 298, 1);
-    addFieldScriptItem(0x00F5, 15, 1, 0x17AA, 277, 1);
-    addFieldScriptMessage(0x00F5, 15, 1, 0, 0x17D4, 0x32D3, 23);
-    addFieldScriptMateria(0x00F5, 15, 1, 0x17D7, 23);
-    addFieldScriptMessage(0x00F5, 42, 1, 0, 0x2B1A, 0x32BD, 21);
-    addFieldScriptMessage(0x00F5, 42, 1, 0, 0x2B25, 0x32BD, 21);
-    addFieldScriptItem(0x00F5, 42, 1, 0x2B28, 23, 2);
-    addFieldScriptMessage(0x00F5, 43, 1, 0, 0x2BBB, 0x32D3, 23);
-    addFieldScriptMessage(0x00F5, 43, 1, 0, 0x2BC6, 0x32D3, 23);
-    addFieldScriptItem(0x00F5, 43, 1, 0x2BC9, 6, 2);
-    addFieldScriptItem(0x00F5, 44, 1, 0x2C68, 208, 1);
-    addFieldModels(0x00F5, {1,0,0,0});
-    addFieldEncounters(0x00F5, 0xBDE4, {18856,17833,15786,14763,0,0,0,0,0,0}, {});
-    addField(0x00F6, "blin63_t");
-    addFieldModels(0x00F6, {1});
-    addField(0x00F7, "blin64");
-    addFieldScriptMessage(0x00F7, 29, 4, 0, 0x153B, 0x1BB6, 24);
-    addFieldScriptItem(0x00F7, 29, 4, 0x1542, 7, 1);
-    addFieldScriptMessage(0x00F7, 32, 4, 0, 0x1603, 0x1BCF, 17);
-    addFieldScriptItem(0x00F7, 32, 4, 0x160A, 3, 1);
-    addFieldScriptMessage(0x00F7, 35, 4, 0, 0x16D3, 0x1BE1, 20);
-    addFieldScriptItem(0x00F7, 35, 4, 0x16DA, 241, 1);
-    addFieldScriptMessage(0x00F7, 39, 1, 0, 0x1807, 0x1D91, 23);
-    addFieldScriptMessage(0x00F7, 39, 1, 0, 0x1819, 0x1DA9, 24);
-    addFieldScriptItem(0x00F7, 39, 1, 0x181C, 74, 1);
-    addFieldScriptItem(0x00F7, 39, 1, 0x1821, 75, 1);
-    addFieldModels(0x00F7, {1,3,4,6,0,0,0,0,0,0,0,0,0});
-    addField(0x00F8, "blin65_1");
-    addFieldModels(0x00F8, {1,4,6,0,0,0,0,0,0});
-    addFieldEncounters(0x00F8, 0x7524, {15784,14761,13738,12715,10668,0,4525,4525,0,0}, {});
-    addField(0x00F9, "blin65_2");
-    addFieldModels(0x00F9, {1,4,6});
-    addField(0x00FA, "blin66_1");
-    addFieldModels(0x00FA, {1,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x00FB, "blin66_2");
-    addFieldModels(0x00FB, {1,0,0,0,0,0,0});
-    addField(0x00FC, "blin66_3");
-    addFieldModels(0x00FC, {1});
-    addField(0x00FD, "blin66_4");
-    addFieldModels(0x00FD, {1,0});
-    addField(0x00FE, "blin66_5");
-    addFieldModels(0x00FE, {1,3,4,0,0,0,0,0});
-    addField(0x00FF, "blin66_6");
-    addFieldModels(0x00FF, {1,0,0,0,0,0,0,0});
-    addField(0x0101, "blin671b");
-    addFieldScriptMateria(0x0101, 9, 1, 0x96A, 60);
-    addFieldScriptMessage(0x0101, 9, 1, 0, 0x9AD, 0xF11, 26);
-    addFieldModels(0x0101, {1,3,4,5,0,0,0,0,0,0});
-    addFieldEncounters(0x0101, 0xA8E8, {25020,22973,18878,0,0,0,4543,4543,0,0}, {});
-    addField(0x0100, "blin67_1");
-    addFieldScriptMateria(0x0100, 9, 1, 0xB82, 60);
-    addFieldScriptMessage(0x0100, 9, 1, 0, 0xBC5, 0x11E4, 26);
-    addFieldModels(0x0100, {1,3,4,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0100, 0xB484, {18864,17844,15797,14774,0,0,4535,4535,0,0}, {});
-    addField(0x0102, "blin67_2");
-    addFieldModels(0x0102, {1,2,4,3,5,0});
-    addField(0x0104, "blin673b");
-    addFieldModels(0x0104, {1,3,4,5,0});
-    addFieldEncounters(0x0104, 0x9BD0, {25020,22973,18878,0,0,0,4543,4543,0,0}, {});
-    addField(0x0103, "blin67_3");
-    addFieldModels(0x0103, {1,3,4,5,0,0});
-    addFieldEncounters(0x0103, 0xB3D8, {18864,17844,15797,14774,0,0,4535,4535,0,0}, {});
-    addField(0x0105, "blin67_4");
-    addFieldModels(0x0105, {1});
-    addField(0x0106, "blin68_1");
-    addFieldScriptMessage(0x0106, 8, 1, 0, 0xBCE, 0x1326, 18);
-    addFieldScriptItem(0x0106, 8, 1, 0xBD1, 0, 1);
-    addFieldScriptMessage(0x0106, 9, 1, 0, 0xC2F, 0x1326, 18);
-    addFieldScriptItem(0x0106, 9, 1, 0xC32, 0, 1);
-    addFieldScriptMessage(0x0106, 10, 1, 0, 0xC80, 0x1326, 18);
-    addFieldScriptItem(0x0106, 10, 1, 0xC83, 0, 1);
-    addFieldScriptMessage(0x0106, 11, 1, 0, 0xCD1, 0x1326, 18);
-    addFieldScriptItem(0x0106, 11, 1, 0xCD4, 0, 1);
-    addFieldModels(0x0106, {1,3,4,2,5,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0106, 0xCC68, {18865,17848,15801,14778,0,0,4539,4539,0,0}, {25024,22977,18882,0,0,0,0,0,0,451});
-    addField(0x0107, "blin68_2");
-    addFieldScriptBattle(0x0107, 2, 8, 0x64F, 456);
-    addFieldScriptMateria(0x0107, 8, 1, 0xC80, 44);
-    addFieldScriptMessage(0x0107, 8, 1, 0, 0xCA2, 0x11C8, 31);
-    addFieldModels(0x0107, {1,3,4,2,5,0,0});
-    addFieldEncounters(0x0107, 0xE3A4, {18865,17848,15801,14778,0,0,4539,4539,0,0}, {25024,22977,18882,0,0,0,0,0,0,451});
-    addField(0x0108, "blin69_1");
-    addFieldModels(0x0108, {1,3,2,5,4,0,0,0,0});
-    addFieldEncounters(0x0108, 0xED94, {18884,17861,15809,14786,0,0,2502,2502,0,4551}, {});
-    addField(0x010A, "blin70_1");
-    addFieldModels(0x010A, {1,3,4,2,5,0,0,0,0,0,0});
-    addField(0x010B, "blin70_2");
-    addFieldModels(0x010B, {1,3,2,4,5,0,0,0,0,0,0,0});
-    addField(0x010C, "blin70_3");
-    addFieldScriptBattle(0x010C, 0, 0, 0x45A, 464);
-    addFieldModels(0x010C, {1,3,2,4,5,0,0,0});
-    addField(0x010D, "blin70_4");
-    addFieldModels(0x010D, {1,0,0,0,0});
-    addField(0x00E8, "blinele");
-    addFieldScriptBattle(0x00E8, 21, 3, 0x14FB, 416);
-    addFieldScriptBattle(0x00E8, 21, 4, 0x153C, 417);
-    addFieldScriptBattle(0x00E8, 21, 5, 0x157D, 419);
-    addFieldScriptBattle(0x00E8, 21, 6, 0x15BE, 420);
-    addFieldScriptBattle(0x00E8, 21, 7, 0x15FF, 416);
-    addFieldScriptBattle(0x00E8, 21, 8, 0x1640, 417);
-    addFieldScriptBattle(0x00E8, 21, 9, 0x1681, 419);
-    addFieldScriptBattle(0x00E8, 21, 10, 0x16C2, 420);
-    addFieldScriptBattle(0x00E8, 21, 11, 0x1703, 424);
-    addFieldScriptBattle(0x00E8, 21, 12, 0x1744, 425);
-    addFieldScriptBattle(0x00E8, 21, 13, 0x1785, 427);
-    addFieldScriptBattle(0x00E8, 21, 14, 0x17C6, 436);
-    addFieldScriptBattle(0x00E8, 21, 15, 0x1807, 424);
-    addFieldScriptBattle(0x00E8, 21, 16, 0x1848, 425);
-    addFieldScriptBattle(0x00E8, 21, 17, 0x1889, 427);
-    addFieldScriptBattle(0x00E8, 21, 18, 0x18CA, 436);
-    addFieldModels(0x00E8, {1,3,4,6,0,0,0,0});
-    addField(0x00E5, "blinst_1");
-    addFieldModels(0x00E5, {1,3,4,6});
-    addField(0x00E6, "blinst_2");
-    addFieldScriptMessage(0x00E6, 16, 1, 0, 0x1086, 0x17D9, 18);
-    addFieldScriptItem(0x00E6, 16, 1, 0x1089, 5, 1);
-    addFieldScriptMessage(0x00E6, 17, 1, 0, 0x10FB, 0x17EC, 25);
-    addFieldScriptItem(0x00E6, 17, 1, 0x10FE, 187, 1);
-    addFieldModels(0x00E6, {1,3,4,6,0,0});
-    addField(0x00E7, "blinst_3");
-    addFieldModels(0x00E7, {1,3,4,6});
-    addField(0x0280, "blue_1");
-    addFieldModels(0x0280, {1,4,6});
-    addField(0x0281, "blue_2");
-    addFieldModels(0x0281, {1,4,2,6,3,5,8,9,7});
-    addField(0x0304, "bonevil2");
-    addFieldModels(0x0304, {1,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0269, "bonevil");
-    addFieldScriptShop(0x0269, 4, 1, 0x686, 65);
-    addFieldScriptMateria(0x0269, 13, 1, 0xB2A, 84);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xB41, 0x1230, 27);
-    addFieldScriptItem(0x0269, 13, 1, 0xB77, 248, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xB86, 0x118F, 20);
-    addFieldScriptMateria(0x0269, 13, 1, 0xBB0, 88);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xBC7, 0x120F, 32);
-    addFieldScriptItem(0x0269, 13, 1, 0xC0C, 6, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xC1B, 0x11F9, 21);
-    addFieldScriptMateria(0x0269, 13, 1, 0xC3C, 21);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xC53, 0x124C, 26);
-    addFieldScriptItem(0x0269, 13, 1, 0xC89, 209, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xC98, 0x11C4, 15);
-    addFieldScriptItem(0x0269, 13, 1, 0xCE2, 5, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xCF1, 0x11D4, 18);
-    addFieldScriptItem(0x0269, 13, 1, 0xD0E, 5, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xD1D, 0x11D4, 18);
-    addFieldScriptItem(0x0269, 13, 1, 0xD54, 4, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xD63, 0x12A3, 23);
-    addFieldScriptItem(0x0269, 13, 1, 0xD68, 3, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xD77, 0x11E7, 17);
-    addFieldScriptItem(0x0269, 13, 1, 0xD85, 4, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xD94, 0x12A3, 23);
-    addFieldScriptItem(0x0269, 13, 1, 0xD99, 3, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xDA8, 0x11E7, 17);
-    addFieldScriptItem(0x0269, 13, 1, 0xDEE, 3, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xDFD, 0x11E7, 17);
-    addFieldScriptItem(0x0269, 13, 1, 0xE1A, 3, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xE29, 0x11E7, 17);
-    addFieldScriptItem(0x0269, 13, 1, 0xE45, 0, 1);
-    addFieldScriptMessage(0x0269, 13, 1, 0, 0xE54, 0x1278, 18);
-    addFieldWorldExit(0x0269, 0x7E50, 1, 0x19);
-    addFieldModels(0x0269, {1,4,6,0,0,0,0,0,0,0,0});
-    addField(0x021D, "bugin1a");
-    addFieldModels(0x021D, {1,3,4,5,6,7,8,9,0});
-    addField(0x021E, "bugin1b");
-    addFieldScriptMessage(0x021E, 11, 2, 0, 0x655, 0xF52, 175);
-    addFieldScriptMessage(0x021E, 11, 2, 3, 0x6E1, 0x115C, 34);
-    addFieldScriptMessage(0x021E, 12, 2, 0, 0x7F7, 0x1024, 128);
-    addFieldScriptMessage(0x021E, 12, 2, 3, 0x883, 0x117F, 32);
-    addFieldScriptMessage(0x021E, 13, 2, 0, 0x996, 0x10A5, 133);
-    addFieldScriptMessage(0x021E, 13, 2, 3, 0xA22, 0x11A0, 33);
-    addFieldScriptMessage(0x021E, 14, 2, 3, 0xB61, 0x112B, 48);
-    addFieldScriptMessage(0x021E, 14, 2, 3, 0xBD2, 0x11C2, 32);
-    addFieldModels(0x021E, {1,3,4,5,6,7,8,9,0,0,0,0,0});
-    addField(0x021F, "bugin1c");
-    addFieldModels(0x021F, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x0220, "bugin2");
-    addFieldScriptMessage(0x0220, 21, 7, 0, 0x1AF2, 0x2A5C, 24);
-    addFieldScriptItem(0x0220, 21, 7, 0x1AF5, 189, 1);
-    addFieldScriptItem(0x0220, 23, 3, 0x1CB4, 189, 1);
-    addFieldModels(0x0220, {1,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x0221, "bugin3");
-    addFieldModels(0x0221, {1,0});
-    addField(0x01EA, "bwhlin2");
-    addFieldModels(0x01EA, {1,2,3,4,5,6,7,8,9});
-    addField(0x01E9, "bwhlin");
-    addFieldModels(0x01E9, {1,2,3,4,5,6,7,8,9});
-    addField(0x02E4, "canon_1");
-    addFieldScriptMessage(0x02E4, 4, 1, 0, 0x2AA, 0x20FD, 25);
-    addFieldScriptItem(0x02E4, 4, 1, 0x2B1, 175, 1);
-    addFieldModels(0x02E4, {1,9,0});
-    addFieldEncounters(0x02E4, 0x8244, {16208,15185,14162,13140,11093,0,2899,2899,0,4950}, {});
-    addField(0x02E5, "canon_2");
-    addFieldScriptBattle(0x02E5, 13, 1, 0xB0B, 856);
-    addFieldModels(0x02E5, {1,3,4,5,7,8,9,6,0});
-    addField(0x008A, "cargoin");
-    addFieldModels(0x008A, {1,3,0,0,0});
-    addField(0x01FE, "chorace2");
-    addFieldModels(0x01FE, {1,2,3,4,5,6,7,8,0,0,0});
-    addField(0x01FD, "chorace");
-    addFieldModels(0x01FD, {1,2,3,4,5,6,7,8,0,0,0,0,0});
-    addField(0x00B6, "chrin_1a");
-    addFieldModels(0x00B6, {1,2,0,0,0,0,0,0});
-    addField(0x00B7, "chrin_1b");
-    addFieldModels(0x00B7, {1,2,0,0,0,0});
-    addField(0x00B8, "chrin_2");
-    addFieldScriptBattle(0x00B8, 3, 5, 0xA5C, 372);
-    addFieldScriptBattle(0x00B8, 3, 7, 0xAE8, 372);
-    addFieldScriptBattle(0x00B8, 3, 7, 0xB09, 373);
-    addFieldScriptBattle(0x00B8, 3, 7, 0xB24, 374);
-    addFieldScriptBattle(0x00B8, 3, 8, 0xBC8, 373);
-    addFieldScriptBattle(0x00B8, 3, 8, 0xC17, 372);
-    addFieldScriptBattle(0x00B8, 3, 9, 0xCF7, 374);
-    addFieldModels(0x00B8, {1,2,0,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x00B8, 0x840C, {24944,22896,18801,0,0,0,3442,3442,0,6515}, {});
-    addField(0x00B9, "chrin_3a");
-    addFieldModels(0x00B9, {1,2});
-    addFieldEncounters(0x00B9, 0x41F8, {24944,22896,18801,0,0,0,3442,3442,0,6515}, {});
-    addField(0x00BA, "chrin_3b");
-    addFieldModels(0x00BA, {1,2});
-    addFieldEncounters(0x00BA, 0x4488, {24944,22896,18801,0,0,0,3442,3442,0,6515}, {});
-    addField(0x00B5, "church");
-    addFieldModels(0x00B5, {1,2,4,6});
-    addField(0x01F6, "clsin2_1");
-    addFieldScriptBattle(0x01F6, 0, 0, 0x73F, 525);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x74B, 526);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x757, 95);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x763, 100);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x76F, 107);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x77B, 117);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x787, 118);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x78D, 119);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x891, 960);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x8B7, 305);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x8C3, 310);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x8CF, 313);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x8DB, 325);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x8E7, 326);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x8F3, 327);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x8FF, 331);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x905, 333);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x91A, 525);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x926, 526);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x932, 95);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x93E, 100);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x94A, 107);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x956, 117);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x962, 118);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x968, 119);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x974, 604);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x980, 606);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x98C, 609);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x998, 610);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x9A4, 613);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x9B0, 614);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x9BC, 617);
-    addFieldScriptBattle(0x01F6, 0, 0, 0x9C2, 182);
-    addFieldModels(0x01F6, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0,0});
-    addField(0x01F7, "clsin2_2");
-    addFieldScriptMessage(0x01F7, 5, 4, 1, 0x887, 0x10F0, 24);
-    addFieldScriptItem(0x01F7, 5, 4, 0x88E, 289, 1);
-    addFieldScriptMessage(0x01F7, 5, 4, 1, 0x8D3, 0x10F0, 24);
-    addFieldScriptMessage(0x01F7, 5, 4, 1, 0x8E5, 0x1109, 25);
-    addFieldScriptItem(0x01F7, 5, 4, 0x8EC, 289, 1);
-    addFieldScriptItem(0x01F7, 5, 4, 0x8F1, 292, 1);
-    addFieldModels(0x01F7, {1,4,6,0,0});
-    addField(0x01F8, "clsin2_3");
-    addFieldModels(0x01F8, {1,2,4,5,7,8,0,0,0});
-    addField(0x00CE, "colne_1");
-    addFieldModels(0x00CE, {1,2,4,6,0,0,0,0});
-    addField(0x00CF, "colne_2");
-    addFieldModels(0x00CF, {1,2,4,6,0,0,0,4});
-    addField(0x00D0, "colne_3");
-    addFieldScriptBattle(0x00D0, 12, 3, 0x9DF, 384);
-    addFieldScriptBattle(0x00D0, 12, 4, 0x9E8, 385);
-    addFieldScriptMessage(0x00D0, 18, 1, 0, 0xE53, 0x132C, 24);
-    addFieldScriptItem(0x00D0, 18, 1, 0xE56, 7, 1);
-    addFieldModels(0x00D0, {1,4,6,0,0,0,0,0,0,0,0});
-    addField(0x00D1, "colne_4");
-    addFieldScriptMessage(0x00D1, 23, 1, 0, 0x16EB, 0x241C, 17);
-    addFieldScriptItem(0x00D1, 23, 1, 0x16EE, 3, 1);
-    addFieldModels(0x00D1, {1,2,4,6,0,0,0,0,0,0});
-    addField(0x00D2, "colne_5");
-    addFieldModels(0x00D2, {1,2,4,6,0,0,0,0,0,0});
-    addField(0x00D3, "colne_6");
-    addFieldScriptMessage(0x00D3, 19, 1, 0, 0x16A3, 0x267B, 17);
-    addFieldScriptItem(0x00D3, 19, 1, 0x16A6, 13, 1);
-    addFieldModels(0x00D3, {1,2,4,6,0,0,0,0,0});
-    addField(0x00D4, "colne_b1");
-    addFieldScriptBattle(0x00D4, 1, 7, 0x536, 386);
-    addFieldScriptMessage(0x00D4, 4, 1, 0, 0x75D, 0xB69, 18);
-    addFieldScriptItem(0x00D4, 4, 1, 0x760, 0, 1);
-    addFieldScriptMateria(0x00D4, 10, 1, 0x831, 36);
-    addFieldScriptMessage(0x00D4, 10, 1, 0, 0x853, 0xB7C, 25);
-    addFieldModels(0x00D4, {1,2,4,0,0});
-    addFieldEncounters(0x00D4, 0xBE0C, {18820,17797,15750,14727,0,0,0,0,0,0}, {});
-    addField(0x00D5, "colne_b3");
-    addFieldModels(0x00D5, {1});
-    addFieldEncounters(0x00D5, 0x72B0, {18820,17797,15750,14727,0,0,0,0,0,0}, {});
-    addField(0x01F4, "coloin1");
-    addFieldScriptMateria(0x01F4, 0, 0, 0x77A, 32);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x791, 0x3938, 64);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x7AB, 0x3895, 53);
-    addFieldScriptItem(0x01F4, 0, 0, 0x7AE, 100, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x7CA, 0x3862, 50);
-    addFieldScriptItem(0x01F4, 0, 0, 0x7CD, 306, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x7E9, 0x38CB, 56);
-    addFieldScriptItem(0x01F4, 0, 0, 0x7EC, 99, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x808, 0x3904, 51);
-    addFieldScriptItem(0x01F4, 0, 0, 0x80B, 101, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x82A, 0x3895, 53);
-    addFieldScriptItem(0x01F4, 0, 0, 0x82D, 100, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x849, 0x38CB, 56);
-    addFieldScriptItem(0x01F4, 0, 0, 0x84C, 99, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x862, 0x3904, 51);
-    addFieldScriptItem(0x01F4, 0, 0, 0x865, 101, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x877, 0x383D, 36);
-    addFieldScriptItem(0x01F4, 0, 0, 0x87A, 86, 1);
-    addFieldScriptMessage(0x01F4, 0, 0, 1, 0x88C, 0x383D, 36);
-    addFieldScriptItem(0x01F4, 0, 0, 0x88F, 86, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1688, 0x366C, 18);
-    addFieldScriptItem(0x01F4, 18, 1, 0x168B, 0, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x16CB, 0x367F, 24);
-    addFieldScriptItem(0x01F4, 18, 1, 0x16CE, 7, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x170E, 0x3698, 20);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1711, 21, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1751, 0x36AD, 17);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1754, 3, 1);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1797, 64, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x17DA, 0x36D9, 21);
-    addFieldScriptItem(0x01F4, 18, 1, 0x17DD, 312, 1);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1809, 8);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1868, 10);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1889, 0x3706, 31);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x18C7, 2);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x18E8, 0x3726, 30);
-    addFieldScriptItem(0x01F4, 18, 1, 0x193D, 294, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x19EF, 0x367F, 24);
-    addFieldScriptItem(0x01F4, 18, 1, 0x19F2, 7, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1A32, 0x3763, 18);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1A35, 15, 1);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1A78, 64, 1);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1AA4, 8);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1B17, 0x3776, 21);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1B1A, 48, 1);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1B60, 54, 1);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1B8C, 10);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1BAD, 0x3706, 31);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1BEB, 2);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1C0C, 0x3726, 30);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1C61, 294, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1CA7, 0x379F, 21);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1CAA, 87, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1D66, 0x3763, 18);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1D69, 15, 1);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1D96, 8);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1E0C, 22, 1);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1E38, 10);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1E59, 0x3706, 31);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1EAE, 63, 1);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x1EDD, 2);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1EFE, 0x3726, 30);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1F50, 0x37E4, 20);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1F53, 40, 1);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1F96, 294, 1);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x1FDC, 0x379F, 21);
-    addFieldScriptItem(0x01F4, 18, 1, 0x1FDF, 87, 1);
-    addFieldScriptMateria(0x01F4, 18, 1, 0x2024, 20);
-    addFieldScriptMessage(0x01F4, 18, 1, 1, 0x2049, 0x37F9, 28);
-    addFieldModels(0x01F4, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0});
-    addField(0x01F5, "coloin2");
-    addFieldModels(0x01F5, {1,2,4,5,7,8,0,0,0,0,0,0,0,0,0});
-    addField(0x01F3, "coloss");
-    addFieldScriptMessage(0x01F3, 11, 1, 1, 0xB02, 0xF68, 26);
-    addFieldScriptItem(0x01F3, 11, 1, 0xB05, 304, 1);
-    addFieldModels(0x01F3, {1,2,4,5,6,7,8,0,0,0,0,0,0,0,0,0});
-    addField(0x0161, "condor1");
-    addFieldWorldExit(0x0161, 0x1898, 1, 0x6);
-    addFieldModels(0x0161, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x0162, "condor2");
-    addFieldModels(0x0162, {1,2,3,4,5,6,7,8,9});
-    addField(0x0163, "convil_1");
-    addFieldScriptShop(0x0163, 27, 1, 0x398C, 52);
-    addFieldScriptShop(0x0163, 27, 1, 0x3992, 17);
-    addFieldScriptShop(0x0163, 28, 3, 0x3A87, 51);
-    addFieldScriptShop(0x0163, 28, 3, 0x3A8D, 16);
-    addFieldModels(0x0163, {1,2,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x0164, "convil_2");
-    addFieldScriptBattle(0x0164, 11, 9, 0x12D1, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1387, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1395, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13AF, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13B5, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13C7, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13CD, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13DF, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13E5, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13F7, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x13FD, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1403, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x141D, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1423, 289);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1435, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x143B, 289);
-    addFieldScriptBattle(0x0164, 11, 10, 0x144D, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1453, 289);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1465, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x146B, 289);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1471, 288);
-    addFieldScriptBattle(0x0164, 11, 10, 0x1477, 289);
-    addFieldScriptBattle(0x0164, 11, 11, 0x1529, 290);
-    addFieldScriptMessage(0x0164, 12, 1, 0, 0x16C7, 0x4044, 24);
-    addFieldScriptItem(0x0164, 12, 1, 0x16CC, 5, 3);
-    addFieldScriptMessage(0x0164, 12, 1, 0, 0x16F7, 0x4044, 24);
-    addFieldScriptItem(0x0164, 12, 1, 0x16FC, 2, 5);
-    addFieldScriptMessage(0x0164, 12, 1, 0, 0x1727, 0x4026, 29);
-    addFieldScriptItem(0x0164, 12, 1, 0x172C, 4, 3);
-    addFieldScriptItem(0x0164, 12, 1, 0x175C, 224, 1);
-    addFieldScriptMessage(0x0164, 12, 1, 0, 0x178B, 0x3FF4, 23);
-    addFieldScriptItem(0x0164, 12, 1, 0x1790, 1, 5);
-    addFieldScriptMessage(0x0164, 12, 1, 0, 0x17BD, 0x3FAC, 21);
-    addFieldScriptItem(0x0164, 12, 1, 0x17C2, 6, 1);
-    addFieldScriptItem(0x0164, 12, 1, 0x17F0, 3, 3);
-    addFieldScriptMessage(0x0164, 12, 1, 0, 0x181C, 0x3F95, 22);
-    addFieldScriptItem(0x0164, 12, 1, 0x1821, 305, 1);
-    addFieldScriptMessage(0x0164, 12, 1, 0, 0x184B, 0x3F7E, 22);
-    addFieldScriptItem(0x0164, 12, 1, 0x1850, 182, 1);
-    addFieldModels(0x0164, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x0166, "convil_4");
-    addFieldScriptMateria(0x0166, 14, 1, 0x6BA, 84);
-    addFieldScriptMessage(0x0166, 14, 1, 0, 0x6D9, 0x804, 27);
-    addFieldModels(0x0166, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x01D4, "corel1");
-    addFieldModels(0x01D4, {0,0});
-    addField(0x01D5, "corel2");
-    addFieldModels(0x01D5, {1,0,0,0,0,0,0,0,0,0,0});
-    addField(0x01D6, "corel3");
-    addFieldModels(0x01D6, {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x01E3, "corelin");
-    addFieldModels(0x01E3, {1,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x020E, "cos_btm2");
-    addFieldScriptMessage(0x020E, 9, 6, 2, 0x12C2, 0x23F0, 24);
-    addFieldModels(0x020E, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x020D, "cos_btm");
-    addFieldWorldExit(0x020D, 0xA1CC, 5, 0x12);
-    addFieldModels(0x020D, {1,2,3,4,5,6,7,8,0,0,0,0,0,0,0,0});
-    addField(0x0212, "cosin1_1");
-    addFieldModels(0x0212, {1,3,4,6,0});
-    addField(0x0211, "cosin1");
-    addFieldScriptShop(0x0211, 4, 1, 0x319, 37);
-    addFieldScriptShop(0x0211, 4, 3, 0x351, 37);
-    addFieldScriptMessage(0x0211, 7, 4, 3, 0x3E3, 0x575, 153);
-    addFieldModels(0x0211, {1,4,6,0,0});
-    addField(0x0213, "cosin2");
-    addFieldModels(0x0213, {1,2,3,4,5,6,7,8,0,0,0,0});
-    addField(0x0214, "cosin3");
-    addFieldScriptMessage(0x0214, 14, 4, 3, 0xAD0, 0x17B4, 115);
-    addFieldModels(0x0214, {1,2,4,6,0,0,0,0});
-    addField(0x0215, "cosin4");
-    addFieldModels(0x0215, {1,4,6});
-    addField(0x0216, "cosin5");
-    addFieldModels(0x0216, {1,4,6,0});
-    addField(0x0217, "cosmin2");
-    addFieldScriptShop(0x0217, 5, 1, 0x373, 39);
-    addFieldScriptShop(0x0217, 5, 1, 0x389, 39);
-    addFieldScriptShop(0x0217, 5, 1, 0x3BB, 39);
-    addFieldScriptShop(0x0217, 5, 1, 0x428, 39);
-    addFieldScriptShop(0x0217, 5, 1, 0x457, 39);
-    addFieldScriptShop(0x0217, 5, 1, 0x46D, 39);
-    addFieldScriptShop(0x0217, 5, 3, 0x4B5, 39);
-    addFieldScriptShop(0x0217, 5, 3, 0x4CB, 39);
-    addFieldScriptShop(0x0217, 5, 3, 0x4FD, 39);
-    addFieldScriptShop(0x0217, 5, 3, 0x56A, 39);
-    addFieldScriptShop(0x0217, 5, 3, 0x599, 39);
-    addFieldScriptShop(0x0217, 5, 3, 0x5AF, 39);
-    addFieldModels(0x0217, {1,4,7,6,0});
-    addField(0x0218, "cosmin3");
-    addFieldModels(0x0218, {1,4,8,6,0,0});
-    addField(0x0219, "cosmin4");
-    addFieldModels(0x0219, {1,3,4,2,5,8,7,6,9,0});
-    addField(0x021A, "cosmin6");
-    addFieldScriptMessage(0x021A, 11, 1, 0, 0x636, 0x660, 18);
-    addFieldScriptItem(0x021A, 11, 1, 0x639, 5, 1);
-    addFieldModels(0x021A, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x021B, "cosmin7");
-    addFieldScriptShop(0x021B, 5, 1, 0x36C, 38);
-    addFieldScriptShop(0x021B, 5, 1, 0x399, 38);
-    addFieldScriptShop(0x021B, 5, 3, 0x3BD, 38);
-    addFieldScriptShop(0x021B, 5, 4, 0x3EC, 38);
-    addFieldScriptMessage(0x021B, 8, 1, 0, 0x482, 0x655, 18);
-    addFieldScriptItem(0x021B, 8, 1, 0x485, 5, 1);
-    addFieldScriptMessage(0x021B, 8, 1, 0, 0x499, 0x67F, 24);
-    addFieldScriptItem(0x021B, 8, 1, 0x49C, 73, 1);
-    addFieldScriptMateria(0x021B, 9, 1, 0x4F8, 70);
-    addFieldScriptMessage(0x021B, 9, 1, 0, 0x51A, 0x698, 29);
-    addFieldModels(0x021B, {1,4,6,0,0,0});
-    addField(0x0210, "cosmo2");
-    addFieldModels(0x0210, {1,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x020F, "cosmo");
-    addFieldModels(0x020F, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addField(0x021C, "cos_top");
-    addFieldModels(0x021C, {1,4,6,0,0});
-    addField(0x02BC, "crater_1");
-    addFieldModels(0x02BC, {1,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x02BC, 0x6A00, {25296,23249,19154,0,0,0,0,0,8915,0}, {});
-    addField(0x02BD, "crater_2");
-    addFieldModels(0x02BD, {1,3,4,5,6,7,8,9,0});
-    addField(0x01FF, "crcin_1");
-    addFieldScriptItem(0x01FF, 0, 0, 0xAED, 304, 1);
-    addFieldScriptMessage(0x01FF, 0, 0, 1, 0xAFC, 0x3282, 24);
-    addFieldScriptItem(0x01FF, 0, 0, 0xB04, 286, 1);
-    addFieldScriptMessage(0x01FF, 0, 0, 1, 0xB13, 0x32E2, 27);
-    addFieldScriptItem(0x01FF, 0, 0, 0xB1B, 315, 1);
-    addFieldScriptMessage(0x01FF, 0, 0, 1, 0xB2A, 0x33E3, 23);
-    addFieldScriptItem(0x01FF, 0, 0, 0xB32, 287, 1);
-    addFieldScriptMessage(0x01FF, 0, 0, 1, 0xB41, 0x343D, 26);
-    addFieldScriptMateria(0x01FF, 0, 0, 0xB44, 13);
-    addFieldScriptMessage(0x01FF, 0, 0, 1, 0xB60, 0x329B, 35);
-    addFieldScriptItem(0x01FF, 1, 4, 0xE51, 304, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xE60, 0x3282, 24);
-    addFieldScriptMateria(0x01FF, 1, 4, 0xE72, 13);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xE89, 0x329B, 35);
-    addFieldScriptMateria(0x01FF, 1, 4, 0xEB1, 25);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xEC8, 0x32BF, 34);
-    addFieldScriptItem(0x01FF, 1, 4, 0xEF0, 286, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xEFF, 0x32E2, 27);
-    addFieldScriptItem(0x01FF, 1, 4, 0xF11, 315, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xF20, 0x33E3, 23);
-    addFieldScriptMateria(0x01FF, 1, 4, 0xF32, 7);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xF49, 0x33FB, 31);
-    addFieldScriptMateria(0x01FF, 1, 4, 0xF71, 31);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xF88, 0x341B, 33);
-    addFieldScriptItem(0x01FF, 1, 4, 0xFB0, 287, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xFBF, 0x343D, 26);
-    addFieldScriptItem(0x01FF, 1, 4, 0xFCC, 3, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xFDB, 0x32FE, 18);
-    addFieldScriptItem(0x01FF, 1, 4, 0xFE8, 5, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0xFF7, 0x3341, 19);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1004, 18, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x1013, 0x3311, 23);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1020, 34, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x102F, 0x3329, 23);
-    addFieldScriptItem(0x01FF, 1, 4, 0x103C, 30, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x104B, 0x3355, 22);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1058, 32, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x1067, 0x336C, 27);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1074, 35, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x1083, 0x3458, 23);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1090, 31, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x109F, 0x3470, 22);
-    addFieldScriptItem(0x01FF, 1, 4, 0x10AC, 33, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x10BB, 0x34CE, 24);
-    addFieldScriptItem(0x01FF, 1, 4, 0x10C8, 6, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x10D7, 0x3487, 22);
-    addFieldScriptItem(0x01FF, 1, 4, 0x10E4, 4, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x10F3, 0x349E, 24);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1100, 0, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x110F, 0x3388, 19);
-    addFieldScriptItem(0x01FF, 1, 4, 0x111C, 7, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x112B, 0x339C, 25);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1138, 13, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x1147, 0x33B6, 18);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1154, 14, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x1163, 0x33C9, 25);
-    addFieldScriptItem(0x01FF, 1, 4, 0x1170, 14, 1);
-    addFieldScriptMessage(0x01FF, 1, 4, 1, 0x117F, 0x34B7, 22);
-    addFieldModels(0x01FF, {1,4,6,8,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0200, "crcin_2");
-    addFieldScriptMateria(0x0200, 10, 1, 0xF75, 77);
-    addFieldScriptMessage(0x0200, 10, 1, 0, 0xF91, 0x20C7, 25);
-    addFieldModels(0x0200, {1,4,6,0,0,0,0,0,0,0});
-    addField(0x0250, "datiao_1");
-    addFieldModels(0x0250, {1,4,6,0,0});
-    addFieldEncounters(0x0250, 0x8DF0, {25180,23133,19038,0,0,0,4703,4703,0,0}, {});
-    addField(0x0251, "datiao_2");
-    addFieldModels(0x0251, {1,4,6,0});
-    addFieldEncounters(0x0251, 0x796C, {19040,18017,15970,14942,0,0,4707,4707,0,0}, {});
-    addField(0x0252, "datiao_3");
-    addFieldModels(0x0252, {1,4,6,0});
-    addFieldEncounters(0x0252, 0x6E6C, {25184,23137,19042,0,0,0,6755,6755,0,0}, {});
-    addField(0x0253, "datiao_4");
-    addFieldModels(0x0253, {1,4,6,0});
-    addFieldEncounters(0x0253, 0x6AF4, {25188,23141,19046,0,0,0,0,0,0,8807}, {});
-    addField(0x0254, "datiao_5");
-    addFieldModels(0x0254, {1,4,6,0});
-    addFieldEncounters(0x0254, 0x7888, {19044,18021,15974,14941,0,0,0,0,0,8807}, {});
-    addField(0x0255, "datiao_6");
-    addFieldScriptBattle(0x0255, 9, 0, 0xD56, 619);
-    addFieldModels(0x0255, {1,3,4,2,5,8,9,6,0,7,0,0,0});
-    addField(0x0256, "datiao_7");
-    addFieldModels(0x0256, {1,4,6,0});
-    addFieldEncounters(0x0256, 0x7090, {19048,18025,15969,14950,0,0,2655,2659,0,4714}, {});
-    addField(0x0257, "datiao_8");
-    addFieldScriptMessage(0x0257, 18, 1, 0, 0xB99, 0x41FF, 20);
-    addFieldScriptItem(0x0257, 18, 1, 0xB9C, 227, 1);
-    addFieldScriptMateria(0x0257, 19, 1, 0xBDD, 34);
-    addFieldScriptMessage(0x0257, 19, 1, 0, 0xC02, 0x4293, 33);
-    addFieldScriptMessage(0x0257, 20, 1, 0, 0xCAA, 0x41E5, 25);
-    addFieldScriptItem(0x0257, 20, 1, 0xCAD, 210, 1);
-    addFieldModels(0x0257, {1,4,6,0,0,0,0});
-    addField(0x01BA, "del12");
-    addFieldModels(0x01BA, {0,0,0,0,0,0,0,0,0});
-    addField(0x01B9, "del1");
-    addFieldModels(0x01B9, {1,2,3,4,5,6,7,0,0,0,0,0,0});
-    addField(0x01BB, "del2");
-    addFieldScriptShop(0x01BB, 13, 1, 0x9EC, 27);
-    addFieldScriptShop(0x01BB, 16, 1, 0xC22, 62);
-    addFieldScriptShop(0x01BB, 16, 1, 0xC3B, 28);
-    addFieldScriptShop(0x01BB, 17, 3, 0xD1F, 61);
-    addFieldScriptShop(0x01BB, 17, 3, 0xD48, 27);
-    addFieldScriptShop(0x01BB, 17, 3, 0xD65, 27);
-    addFieldScriptShop(0x01BB, 17, 3, 0xD82, 27);
-    addFieldWorldExit(0x01BB, 0x8540, 7, 0xD);
-    addFieldModels(0x01BB, {1,4,5,6,7,0,0,0,0,0,0,0,0,0});
-    addField(0x01C1, "del3");
-    addFieldScriptMessage(0x01C1, 17, 1, 1, 0x14B3, 0x2591, 243);
-    addFieldModels(0x01C1, {1,2,3,4,5,6,7,0,0,0,0,0,0});
-    addField(0x01BC, "delinn");
-    addFieldModels(0x01BC, {1,2,3,4,6,0,0,0});
-    addField(0x01BF, "delmin12");
-    addFieldScriptItem(0x01BF, 8, 1, 0x47C, 152, 1);
-    addFieldScriptMessage(0x01BF, 8, 1, 2, 0x48B, 0x6CE, 23);
-    addFieldScriptItem(0x01BF, 9, 1, 0x533, 307, 1);
-    addFieldScriptMessage(0x01BF, 9, 1, 2, 0x542, 0x6E6, 21);
-    addFieldScriptItem(0x01BF, 10, 1, 0x59D, 71, 1);
-    addFieldScriptMessage(0x01BF, 10, 1, 2, 0x5B0, 0x6FC, 24);
-    addFieldModels(0x01BF, {1,4,6,0,0,0,0});
-    addField(0x01BE, "delmin1");
-    addFieldModels(0x01BE, {1,4,6,0});
-    addField(0x01C0, "delmin2");
-    addFieldModels(0x01C0, {1,4,6,0,0});
-    addField(0x01BD, "delpb");
-    addFieldScriptShop(0x01BD, 13, 1, 0x83E, 60);
-    addFieldScriptShop(0x01BD, 13, 1, 0x857, 26);
-    addFieldModels(0x01BD, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addField(0x01E1, "desert1");
-    addFieldModels(0x01E1, {1,4,6,0});
-    addFieldEncounters(0x01E1, 0x9114, {23052,22028,17932,4352,0,0,0,0,0,0}, {});
-    addField(0x01E2, "desert2");
-    addFieldModels(0x01E2, {1,4,6});
-    addField(0x01E0, "dyne");
-    addFieldScriptBattle(0x01E0, 0, 0, 0x516, 527);
-    addFieldModels(0x01E0, {1,2,3,4,5,7,8,0,0});
-    addField(0x00BD, "ealin_12");
-    addFieldModels(0x00BD, {1,2,3,4,6,0,0,0,0});
-    addField(0x00BC, "ealin_1");
-    addFieldModels(0x00BC, {1,2,3,4,6,0,0,0,0});
-    addField(0x00BE, "ealin_2");
-    addFieldScriptMessage(0x00BE, 15, 1, 0, 0xE28, 0x1207, 18);
-    addFieldScriptMessage(0x00BE, 15, 1, 0, 0xE3A, 0x122C, 24);
-    addFieldScriptItem(0x00BE, 15, 1, 0xE3D, 0, 1);
-    addFieldScriptItem(0x00BE, 15, 1, 0xE42, 7, 1);
-    addFieldModels(0x00BE, {1,2,3,4,6,0,1,2,0});
-    addField(0x00BB, "eals_1");
-    addFieldScriptMessage(0x00BB, 5, 1, 0, 0x5FA, 0x8B4, 19);
-    addFieldScriptItem(0x00BB, 5, 1, 0x601, 3, 1);
-    addFieldScriptMateria(0x00BB, 6, 1, 0x63C, 16);
-    addFieldScriptMessage(0x00BB, 6, 1, 0, 0x658, 0x8C8, 27);
-    addFieldModels(0x00BB, {1,3,4,6,0,0,0});
-    addField(0x00E9, "eleout");
-    addFieldScriptBattle(0x00E9, 7, 4, 0xA50, 460);
-    addFieldModels(0x00E9, {1,4,3,2,0,0});
-    addField(0x0079, "elevtr1");
-    addFieldModels(0x0079, {1,3,0});
-    addField(0x014F, "elm");
-    addFieldWorldExit(0x014F, 0xB50C, 9, 0x2);
-    addFieldWorldExit(0x014F, 0xB524, 10, 0x2);
-    addFieldModels(0x014F, {1,3,4,2,5,6,0,0,0,0,0,0,0});
-    addField(0x0149, "elm_i");
-    addFieldScriptShop(0x0149, 8, 1, 0x409, 12);
-    addFieldModels(0x0149, {1,4,6,0});
-    addField(0x014D, "elmin1_1");
-    addFieldScriptMessage(0x014D, 8, 1, 0, 0x571, 0x7C5, 17);
-    addFieldScriptItem(0x014D, 8, 1, 0x574, 3, 1);
-    addFieldModels(0x014D, {1,4,6,0,0});
-    addField(0x014E, "elmin1_2");
-    addFieldModels(0x014E, {1,4,6,0});
-    addField(0x0150, "elmin2_1");
-    addFieldModels(0x0150, {1,4,6,0,0});
-    addField(0x0151, "elmin2_2");
-    addFieldScriptMessage(0x0151, 6, 3, 0, 0x444, 0x7E8, 17);
-    addFieldScriptItem(0x0151, 6, 3, 0x447, 3, 1);
-    addFieldScriptMessage(0x0151, 7, 3, 0, 0x4C3, 0x7E8, 17);
-    addFieldScriptItem(0x0151, 7, 3, 0x4C6, 3, 1);
-    addFieldScriptMessage(0x0151, 8, 3, 0, 0x542, 0x7E8, 17);
-    addFieldScriptItem(0x0151, 8, 3, 0x545, 3, 1);
-    addFieldModels(0x0151, {1,4,6,0});
-    addField(0x0152, "elmin3_1");
-    addFieldModels(0x0152, {1,4,6,0});
-    addField(0x0153, "elmin3_2");
-    addFieldScriptMessage(0x0153, 4, 3, 0, 0x3CC, 0x8C9, 24);
-    addFieldScriptItem(0x0153, 4, 3, 0x3CF, 72, 1);
-    addFieldScriptMessage(0x0153, 5, 3, 0, 0x44D, 0x8C9, 24);
-    addFieldScriptItem(0x0153, 5, 3, 0x450, 72, 1);
-    addFieldScriptMessage(0x0153, 6, 3, 0, 0x4CE, 0x8C9, 24);
-    addFieldScriptItem(0x0153, 6, 3, 0x4D1, 72, 1);
-    addFieldModels(0x0153, {1,4,6,0,0,0});
-    addField(0x0155, "elmin4_1");
-    addFieldScriptMessage(0x0155, 9, 3, 0, 0x4A3, 0x6D8, 17);
-    addFieldScriptItem(0x0155, 9, 3, 0x4A6, 3, 1);
-    addFieldModels(0x0155, {1,4,6,0,0});
-    addField(0x0156, "elmin4_2");
-    addFieldScriptMessage(0x0156, 5, 1, 1, 0x7A6, 0x4DCE, 192);
-    addFieldScriptMessage(0x0156, 5, 1, 1, 0x7BF, 0x4F47, 62);
-    addFieldScriptMessage(0x0156, 5, 1, 1, 0x7D4, 0x4F07, 63);
-    addFieldScriptMessage(0x0156, 5, 1, 1, 0x7E3, 0x5012, 70);
-    addFieldScriptMessage(0x0156, 5, 1, 1, 0x80D, 0x4FCD, 68);
-    addFieldScriptMessage(0x0156, 5, 1, 1, 0x822, 0x4F86, 70);
-    addFieldScriptMateria(0x0156, 7, 1, 0xBF2, 17);
-    addFieldScriptMessage(0x0156, 7, 1, 0, 0xC1B, 0x1095, 30);
-    addFieldScriptMateria(0x0156, 8, 1, 0xC88, 48);
-    addFieldScriptMessage(0x0156, 8, 1, 0, 0xCB1, 0x10D5, 34);
-    addFieldScriptMateria(0x0156, 9, 1, 0xD1E, 90);
-    addFieldScriptMessage(0x0156, 9, 1, 0, 0xD47, 0x10F8, 33);
-    addFieldScriptMateria(0x0156, 10, 1, 0xDB7, 73);
-    addFieldScriptMessage(0x0156, 10, 1, 0, 0xDE0, 0x10B4, 32);
-    addFieldModels(0x0156, {1,4,6,0,0,0,0,0,0});
-    addField(0x014B, "elminn_1");
-    addFieldModels(0x014B, {1,3,4,2,5,6,0});
-    addField(0x014C, "elminn_2");
-    addFieldScriptMessage(0x014C, 8, 5, 0, 0x91E, 0x157E, 26);
-    addFieldScriptItem(0x014C, 8, 5, 0x925, 6, 1);
-    addFieldModels(0x014C, {1,3,4,2,5,6,0});
-    addField(0x014A, "elmpb");
-    addFieldModels(0x014A, {1,4,6,0,0,0,0});
-    addField(0x0154, "elmtow");
-    addFieldScriptMessage(0x0154, 8, 1, 1, 0x459, 0x6BE, 22);
-    addFieldScriptItem(0x0154, 8, 1, 0x45C, 247, 1);
-    addFieldModels(0x0154, {1,4,6,0});
-    addField(0x0148, "elm_wa");
-    addFieldScriptShop(0x0148, 12, 1, 0x670, 11);
-    addFieldScriptShop(0x0148, 13, 1, 0x6A5, 13);
-    addFieldModels(0x0148, {1,4,6,0,0});
-    addField(0x0157, "farm");
-    addFieldScriptMateria(0x0157, 9, 1, 0x825, 74);
-    addFieldScriptMessage(0x0157, 9, 1, 1, 0x852, 0x96F, 29);
-    addFieldScriptMateria(0x0157, 10, 1, 0x8CE, 9);
-    addFieldScriptMessage(0x0157, 10, 1, 0, 0x8EE, 0x9D6, 32);
-    addFieldWorldExit(0x0157, 0x62E4, 2, 0x3);
-    addFieldWorldExit(0x0157, 0x62FC, 3, 0x3);
-    addFieldWorldExit(0x0157, 0x6314, 4, 0x3);
-    addFieldWorldExit(0x0157, 0x632C, 5, 0x3);
-    addFieldWorldExit(0x0157, 0x6344, 6, 0x3);
-    addFieldWorldExit(0x0157, 0x635C, 7, 0x3);
-    addFieldWorldExit(0x0157, 0x6374, 8, 0x3);
-    addFieldModels(0x0157, {1,4,6,0,0,0,0,0,0});
-    addField(0x0159, "frcyo");
-    addFieldScriptMessage(0x0159, 4, 1, 1, 0xD77, 0xD3E5, 197);
-    addFieldScriptMessage(0x0159, 4, 1, 1, 0xD8A, 0xD4AB, 279);
-    addFieldScriptMessage(0x0159, 4, 1, 1, 0xDE9, 0xD82A, 127);
-    addFieldScriptMateria(0x0159, 5, 1, 0x10F6, 9);
-    addFieldScriptShop(0x0159, 5, 1, 0x1119, 14);
-    addFieldScriptShop(0x0159, 5, 1, 0x1140, 14);
-    addFieldScriptMateria(0x0159, 5, 1, 0x11BE, 9);
-    addFieldScriptShop(0x0159, 5, 1, 0x11E1, 14);
-    addFieldScriptShop(0x0159, 5, 1, 0x123A, 15);
-    addFieldModels(0x0159, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addField(0x015B, "fr_e");
-    addFieldScriptBattle(0x015B, 0, 0, 0x3B3, 980);
-    addFieldModels(0x015B, {1,4,6,3,5,8,9,7});
-    addField(0x0158, "frmin");
-    addFieldModels(0x0158, {1,4,6,0});
-    addField(0x0043, "fship_12");
-    addFieldModels(0x0043, {0,3,0,5,6,0,8,9,0,0});
-    addField(0x0042, "fship_1");
-    addFieldModels(0x0042, {1,4,3,5,7,8,9,6,0});
-    addField(0x0045, "fship_22");
-    addFieldModels(0x0045, {1,0,0,0,0,0,0,0,0,0});
-    addField(0x0046, "fship_23");
-    addFieldModels(0x0046, {1,4,3,5,7,8,9,6,0,0,0});
-    addField(0x0047, "fship_24");
-    addFieldModels(0x0047, {1,3,4,5,6,8,9,0,0,0});
-    addField(0x0048, "fship_25");
-    addFieldModels(0x0048, {1,4,3,5,7,8,9,6,0,0,0});
-    addField(0x0044, "fship_2");
-    addFieldModels(0x0044, {1,4,3,5,7,8,9,6,0,0,0});
-    addField(0x0049, "fship_3");
-    addFieldModels(0x0049, {1,4,3,5,7,8,9,6,0});
-    addField(0x004B, "fship_42");
-    addFieldModels(0x004B, {1,3,4,5,6,7,8,9,0,0,0});
-    addField(0x004A, "fship_4");
-    addFieldModels(0x004A, {1,4,3,5,7,8,9,6,0,0});
-    addField(0x004C, "fship_5");
-    addFieldModels(0x004C, {1,4,6,0,0});
-    addField(0x02B1, "gaia_1");
-    addFieldModels(0x02B1, {1,0,0,0,0});
-    addFieldEncounters(0x02B1, 0x5BF0, {19132,18109,16062,15039,0,0,4800,4800,0,0}, {});
-    addField(0x02B4, "gaia_2");
-    addFieldModels(0x02B4, {1,0,0,0,0,0,0,0});
-    addFieldEncounters(0x02B4, 0x65BC, {19132,18109,16062,15039,0,0,4800,4800,0,0}, {});
-    addField(0x02B6, "gaia_31");
-    addFieldModels(0x02B6, {1,0,0,0,0,0,0});
-    addFieldEncounters(0x02B6, 0x5E10, {19132,18109,16062,15039,0,0,4800,4800,0,0}, {});
-    addField(0x02B7, "gaia_32");
-    addFieldModels(0x02B7, {1});
-    addField(0x02AE, "gaiafoot");
-    addFieldWorldExit(0x02AE, 0x5F34, 1, 0x3C);
-    addFieldModels(0x02AE, {1,3,4,5,6,7,8,9,0});
-    addField(0x02B2, "gaiin_1");
-    addFieldScriptMessage(0x02B2, 8, 1, 0, 0x4AD, 0x560, 19);
-    addFieldScriptItem(0x02B2, 8, 1, 0x4B0, 207, 1);
-    addFieldScriptMessage(0x02B2, 9, 1, 0, 0x531, 0x574, 18);
-    addFieldScriptItem(0x02B2, 9, 1, 0x534, 306, 1);
-    addFieldModels(0x02B2, {1,2,3,0,0});
-    addFieldEncounters(0x02B2, 0x8F5C, {19137,18114,16067,15044,0,0,2757,2757,0,4806}, {});
-    addField(0x02B3, "gaiin_2");
-    addFieldModels(0x02B3, {1,3,0,0,0,0,0});
-    addFieldEncounters(0x02B3, 0x8F9C, {19137,18114,16067,15044,0,0,2757,2757,0,4806}, {});
-    addField(0x02B5, "gaiin_3");
-    addFieldScriptMessage(0x02B5, 23, 1, 0, 0xC49, 0xCFC, 24);
-    addFieldScriptItem(0x02B5, 23, 1, 0xC4C, 75, 1);
-    addFieldScriptMessage(0x02B5, 24, 1, 0, 0xCCD, 0xD15, 18);
-    addFieldScriptItem(0x02B5, 24, 1, 0xCD0, 5, 1);
-    addFieldModels(0x02B5, {0,1,2,3,0,0});
-    addFieldEncounters(0x02B5, 0x7A24, {19137,18114,16067,15044,0,0,2757,2757,0,4806}, {});
-    addField(0x02B8, "gaiin_4");
-    addFieldScriptMessage(0x02B8, 7, 1, 0, 0x342, 0x36D, 25);
-    addFieldScriptItem(0x02B8, 7, 1, 0x345, 132, 1);
-    addFieldModels(0x02B8, {1,2,3,0});
-    addFieldEncounters(0x02B8, 0x6278, {19132,18109,16062,15039,0,0,4800,4800,0,0}, {});
-    addField(0x02B9, "gaiin_5");
-    addFieldScriptBattle(0x02B9, 3, 5, 0x559, 716);
-    addFieldScriptBattle(0x02B9, 4, 5, 0x5A1, 717);
-    addFieldScriptBattle(0x02B9, 5, 5, 0x5DB, 718);
-    addFieldScriptBattle(0x02B9, 6, 5, 0x615, 717);
-    addFieldScriptItem(0x02B9, 15, 1, 0x8CB, 6, 1);
-    addFieldScriptMessage(0x02B9, 16, 1, 0, 0x94C, 0x993, 23);
-    addFieldScriptItem(0x02B9, 16, 1, 0x94F, 278, 1);
-    addFieldModels(0x02B9, {1,0,0,0,0,0,0});
-    addField(0x02BA, "gaiin_6");
-    addFieldScriptBattle(0x02BA, 2, 2, 0x478, 740);
-    addFieldModels(0x02BA, {1,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x02BA, 0x4EA0, {19143,18120,16073,15050,0,0,4811,4811,0,0}, {});
-    addField(0x02BB, "gaiin_7");
-    addFieldModels(0x02BB, {0,1});
-    addFieldEncounters(0x02BB, 0x4184, {19143,18120,16073,15050,0,0,4811,4811,0,0}, {});
-    addField(0x01FA, "games_1");
-    addFieldScriptMessage(0x01FA, 1, 8, 1, 0x83E, 0x2564, 19);
-    addFieldScriptItem(0x01FA, 1, 8, 0x841, 0, 1);
-    addFieldScriptMessage(0x01FA, 1, 8, 1, 0x8B0, 0x25CF, 25);
-    addFieldScriptItem(0x01FA, 1, 8, 0x8B3, 3, 1);
-    addFieldScriptMessage(0x01FA, 1, 8, 1, 0x8CF, 0x2588, 19);
-    addFieldScriptItem(0x01FA, 1, 8, 0x8D2, 5, 1);
-    addFieldScriptMessage(0x01FA, 1, 9, 1, 0x9D4, 0x2564, 19);
-    addFieldScriptItem(0x01FA, 1, 9, 0x9D7, 0, 1);
-    addFieldScriptMessage(0x01FA, 1, 9, 1, 0xA46, 0x25E9, 18);
-    addFieldScriptItem(0x01FA, 1, 9, 0xA49, 7, 1);
-    addFieldScriptMessage(0x01FA, 1, 9, 1, 0xA65, 0x25FC, 22);
-    addFieldScriptItem(0x01FA, 1, 9, 0xA68, 6, 1);
-    addFieldScriptItem(0x01FA, 8, 1, 0xFC9, 0, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0xFE0, 0x2564, 19);
-    addFieldScriptItem(0x01FA, 8, 1, 0x100E, 3, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1027, 0x2B45, 18);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1055, 2, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x106E, 0x2B58, 21);
-    addFieldScriptItem(0x01FA, 8, 1, 0x109B, 4, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x10B4, 0x2BDA, 24);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1140, 78, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1159, 0x2BA5, 22);
-    addFieldScriptItem(0x01FA, 8, 1, 0x11AA, 0, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x11C1, 0x2564, 19);
-    addFieldScriptItem(0x01FA, 8, 1, 0x11EF, 3, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1208, 0x2B45, 18);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1236, 2, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x124F, 0x2B58, 21);
-    addFieldScriptItem(0x01FA, 8, 1, 0x127C, 4, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1295, 0x2BDA, 24);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1321, 78, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x133A, 0x2BA5, 22);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1379, 0, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1390, 0x2564, 19);
-    addFieldScriptItem(0x01FA, 8, 1, 0x13BE, 3, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x13D7, 0x2B45, 18);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1405, 2, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x141E, 0x2B58, 21);
-    addFieldScriptItem(0x01FA, 8, 1, 0x144C, 4, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1465, 0x2BDA, 24);
-    addFieldScriptItem(0x01FA, 8, 1, 0x14F2, 78, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x150B, 0x2BA5, 22);
-    addFieldScriptMateria(0x01FA, 8, 1, 0x1537, 5);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x155C, 0x2BBC, 29);
-    addFieldScriptItem(0x01FA, 8, 1, 0x15B6, 0, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x15CD, 0x2564, 19);
-    addFieldScriptItem(0x01FA, 8, 1, 0x15FB, 3, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1614, 0x2B45, 18);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1642, 2, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x165B, 0x2B58, 21);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1689, 4, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x16A2, 0x2BDA, 24);
-    addFieldScriptItem(0x01FA, 8, 1, 0x172F, 78, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1748, 0x2BA5, 22);
-    addFieldScriptMateria(0x01FA, 8, 1, 0x1774, 6);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1799, 0x2B87, 29);
-    addFieldScriptItem(0x01FA, 8, 1, 0x17EC, 0, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1803, 0x2564, 19);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1831, 3, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x184A, 0x2B45, 18);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1878, 2, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1891, 0x2B58, 21);
-    addFieldScriptItem(0x01FA, 8, 1, 0x18BF, 4, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x18D8, 0x2BDA, 24);
-    addFieldScriptItem(0x01FA, 8, 1, 0x1967, 78, 1);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1980, 0x2BA5, 22);
-    addFieldScriptMateria(0x01FA, 8, 1, 0x19AC, 6);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x19D1, 0x2B87, 29);
-    addFieldScriptMateria(0x01FA, 8, 1, 0x1A11, 5);
-    addFieldScriptMessage(0x01FA, 8, 1, 2, 0x1A36, 0x2BBC, 29);
-    addFieldModels(0x01FA, {1,4,6,0,0,0,0,0,0,0});
-    addField(0x01FB, "games_2");
-    addFieldScriptMessage(0x01FB, 0, 0, 1, 0x86B, 0x2C6A, 24);
-    addFieldScriptItem(0x01FB, 0, 0, 0x86E, 75, 1);
-    addFieldScriptMessage(0x01FB, 0, 0, 1, 0x90A, 0x2BB5, 22);
-    addFieldScriptItem(0x01FB, 0, 0, 0x90D, 311, 1);
-    addFieldScriptMateria(0x01FB, 0, 0, 0x94D, 23);
-    addFieldScriptMessage(0x01FB, 0, 0, 2, 0x969, 0x2BE7, 23);
-    addFieldScriptMessage(0x01FB, 0, 0, 1, 0x9B7, 0x2BCC, 26);
-    addFieldScriptItem(0x01FB, 0, 0, 0x9BA, 264, 1);
-    addFieldScriptMessage(0x01FB, 0, 0, 1, 0xA19, 0x2BFF, 15);
-    addFieldScriptItem(0x01FB, 0, 0, 0xA1C, 58, 1);
-    addFieldScriptMessage(0x01FB, 0, 0, 1, 0xA3A, 0x2C0F, 20);
-    addFieldScriptItem(0x01FB, 0, 0, 0xA3D, 57, 1);
-    addFieldScriptMessage(0x01FB, 0, 0, 1, 0xA5B, 0x2C24, 23);
-    addFieldScriptItem(0x01FB, 0, 0, 0xA5E, 60, 1);
-    addFieldScriptMessage(0x01FB, 0, 0, 1, 0xA7C, 0x2C3C, 25);
-    addFieldScriptItem(0x01FB, 0, 0, 0xA7F, 49, 1);
-    addFieldScriptItem(0x01FB, 0, 0, 0xAA0, 61, 1);
-    addFieldModels(0x01FB, {1,0,0,0,0,0,0,1,0,0,0,0,0});
-    addField(0x01F9, "games");
-    addFieldModels(0x01F9, {1,2,4,5,6,7,8,0,0,0,0,0,0,0,0});
-    addField(0x01EB, "ghotel");
-    addFieldModels(0x01EB, {1,4,6,0,0,0,0,0});
-    addField(0x01EC, "ghotin_1");
-    addFieldScriptMessage(0x01EC, 13, 4, 3, 0x9E1, 0xFEA, 184);
-    addFieldModels(0x01EC, {1,2,3,4,6,7,0,0,0});
-    addField(0x01EE, "ghotin_2");
-    addFieldScriptMessage(0x01EE, 10, 1, 3, 0xA74, 0xFD6, 18);
-    addFieldScriptItem(0x01EE, 10, 1, 0xA77, 5, 1);
-    addFieldModels(0x01EE, {1,2,3,4,6,7,0,0});
-    addField(0x01EF, "ghotin_3");
-    addFieldScriptShop(0x01EF, 4, 1, 0x410, 32);
-    addFieldModels(0x01EF, {1,4,6,0});
-    addField(0x01ED, "ghotin_4");
-    addFieldScriptMessage(0x01ED, 11, 4, 3, 0x1F8C, 0x303A, 183);
-    addFieldModels(0x01ED, {1,2,3,4,5,6,7,8,9});
-    addField(0x0222, "gidun_1");
-    addFieldScriptBattle(0x0222, 18, 0, 0x9E9, 553);
-    addFieldScriptBattle(0x0222, 19, 0, 0xA55, 554);
-    addFieldScriptBattle(0x0222, 21, 0, 0xB3A, 554);
-    addFieldScriptMateria(0x0222, 22, 1, 0xBA4, 30);
-    addFieldScriptMessage(0x0222, 22, 1, 0, 0xBC6, 0xED8, 32);
-    addFieldModels(0x0222, {1,2,3,4,5,6,7,8,9,0,0});
-    addFieldEncounters(0x0222, 0x9684, {25116,23069,18974,0,0,0,0,0,0,0}, {});
-    addField(0x0223, "gidun_2");
-    addFieldScriptMessage(0x0223, 19, 1, 0, 0xA46, 0xC1C, 25);
-    addFieldScriptItem(0x0223, 19, 1, 0xA49, 235, 1);
-    addFieldScriptMessage(0x0223, 20, 1, 0, 0xACC, 0xC36, 17);
-    addFieldScriptItem(0x0223, 20, 1, 0xACF, 3, 1);
-    addFieldModels(0x0223, {1,2,3,4,5,6,7,8,9,0,0,0});
-    addFieldEncounters(0x0223, 0x9D34, {25119,23072,18977,0,0,0,4642,4642,0,0}, {});
-    addField(0x0225, "gidun_3");
-    addFieldScriptBattle(0x0225, 15, 5, 0x89E, 555);
-    addFieldScriptMateria(0x0225, 17, 1, 0x925, 61);
-    addFieldScriptMessage(0x0225, 17, 1, 0, 0x947, 0xB51, 27);
-    addFieldModels(0x0225, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x0224, "gidun_4");
-    addFieldScriptBattle(0x0224, 15, 5, 0x811, 551);
-    addFieldScriptBattle(0x0224, 16, 5, 0x849, 551);
-    addFieldScriptBattle(0x0224, 17, 5, 0x881, 551);
-    addFieldScriptMessage(0x0224, 18, 1, 0, 0x910, 0xB29, 22);
-    addFieldScriptItem(0x0224, 18, 1, 0x913, 301, 1);
-    addFieldScriptMessage(0x0224, 19, 1, 0, 0x996, 0xB40, 20);
-    addFieldScriptItem(0x0224, 19, 1, 0x999, 2, 1);
-    addFieldScriptMessage(0x0224, 20, 1, 0, 0xA1F, 0xB55, 23);
-    addFieldScriptItem(0x0224, 20, 1, 0xA22, 4, 1);
-    addFieldModels(0x0224, {1,2,3,4,5,7,8,9,6,0,0,0,0});
-    addFieldEncounters(0x0224, 0x8FA8, {18980,17955,15902,14881,0,0,2594,2594,8741,4648}, {});
-    addField(0x0201, "gldelev");
-    addFieldModels(0x0201, {1,0,0});
-    addField(0x01F1, "gldgate");
-    addFieldModels(0x01F1, {1,2,3,4,5,6,7,8,0,0});
-    addField(0x01F2, "gldinfo");
-    addFieldModels(0x01F2, {1,0});
-    addField(0x01F0, "gldst");
-    addFieldModels(0x01F0, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0});
-    addField(0x020A, "gninn");
-    addFieldScriptMessage(0x020A, 9, 1, 0, 0xA37, 0xCAA, 20);
-    addFieldScriptItem(0x020A, 9, 1, 0xA3A, 2, 1);
-    addFieldModels(0x020A, {1,3,4,6,0,0});
-    addField(0x0205, "gnmk");
-    addFieldScriptMateria(0x0205, 2, 5, 0x3B6, 78);
-    addFieldScriptMessage(0x0205, 2, 5, 0, 0x3DB, 0xA95, 25);
-    addFieldModels(0x0205, {1,4,6,0,0,0,0});
-    addFieldEncounters(0x0205, 0x8210, {35352,31256,0,0,0,0,4633,4633,0,0}, {});
-    addField(0x0204, "gnmkf");
-    addFieldModels(0x0204, {1,4,6});
-    addFieldEncounters(0x0204, 0x9870, {35352,31256,0,0,0,0,4633,4633,0,0}, {});
-    addField(0x020B, "gomin");
-    addFieldModels(0x020B, {1,3,4,2,5,6,7,8,9,0,0});
-    addField(0x0206, "gongaga");
-    addFieldModels(0x0206, {1,3,4,2,6,0,0,0});
-    addField(0x0209, "gon_i");
-    addFieldScriptShop(0x0209, 8, 1, 0x424, 35);
-    addFieldModels(0x0209, {1,4,6,0});
-    addField(0x0202, "gonjun1");
-    addFieldScriptMateria(0x0202, 6, 1, 0x3A7, 41);
-    addFieldScriptMessage(0x0202, 6, 1, 0, 0x3C7, 0x62C, 29);
-    addFieldWorldExit(0x0202, 0xA520, 3, 0x11);
-    addFieldModels(0x0202, {1,3,4,6,0});
-    addFieldEncounters(0x0202, 0xA784, {25104,23057,18962,0,0,0,0,0,0,8723}, {});
-    addField(0x0203, "gonjun2");
-    addFieldScriptBattle(0x0203, 11, 5, 0x8E1, 539);
-    addFieldWorldExit(0x0203, 0xB6B8, 2, 0x11);
-    addFieldModels(0x0203, {1,3,4,2,5,6,7,8,9,0,0,0});
-    addFieldEncounters(0x0203, 0xB934, {18964,17937,15890,14864,0,0,0,0,8725,0}, {});
-    addField(0x0207, "gon_wa1");
-    addFieldScriptShop(0x0207, 8, 1, 0x512, 36);
-    addFieldModels(0x0207, {1,4,6,0});
-    addField(0x0208, "gon_wa2");
-    addFieldScriptShop(0x0208, 8, 1, 0x494, 34);
-    addFieldModels(0x0208, {1,4,6,0});
-    addField(0x020C, "goson");
-    addFieldScriptMessage(0x020C, 7, 1, 0, 0x4AF, 0x737, 25);
-    addFieldScriptItem(0x020C, 7, 1, 0x4B2, 234, 1);
-    addFieldModels(0x020C, {1,4,6,0,0});
-    addField(0x0284, "hekiga");
-    addFieldModels(0x0284, {1,4,6,3,2,5,8,9,7,0});
-    addField(0x0247, "hideway1");
-    addFieldScriptMessage(0x0247, 10, 4, 0, 0x3D4, 0x3FC, 26);
-    addFieldScriptItem(0x0247, 10, 4, 0x3D7, 225, 1);
-    addFieldModels(0x0247, {1,2,3,4,5,6,7,8,9});
-    addField(0x0248, "hideway2");
-    addFieldScriptMessage(0x0248, 10, 4, 0, 0x3D4, 0x3FC, 19);
-    addFieldScriptItem(0x0248, 10, 4, 0x3D7, 185, 1);
-    addFieldModels(0x0248, {1,2,3,4,5,6,7,8,9});
-    addField(0x0249, "hideway3");
-    addFieldScriptMateria(0x0249, 10, 4, 0x401, 28);
-    addFieldScriptMessage(0x0249, 10, 4, 0, 0x429, 0x4B3, 29);
-    addFieldModels(0x0249, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x0303, "hill2");
-    addFieldModels(0x0303, {1,4});
-    addField(0x004D, "hill");
-    addFieldModels(0x004D, {1,4});
-    addField(0x02AF, "holu_1");
-    addFieldModels(0x02AF, {0,1,3,4,5,6,7,8,9,0});
-    addField(0x02B0, "holu_2");
-    addFieldModels(0x02B0, {1,3,4,5,6,7,8,9,0});
-    addField(0x02A8, "hyou10");
-    addFieldModels(0x02A8, {1,2,3,4,5,6,7,8,9});
-    addField(0x02A9, "hyou11");
-    addFieldModels(0x02A9, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02A9, 0x6AB8, {15032,12980,11957,10934,9911,8889,2746,2746,0,4787}, {});
-    addField(0x02AA, "hyou12");
-    addFieldScriptMateria(0x02AA, 11, 1, 0x482, 23);
-    addFieldScriptMessage(0x02AA, 11, 1, 0, 0x49E, 0xD17, 23);
-    addFieldModels(0x02AA, {1,2,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x02AA, 0x586C, {16044,15021,13998,12975,10928,0,2737,2737,8882,4787}, {});
-    addField(0x02AB, "hyou13_1");
-    addFieldModels(0x02AB, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02AB, 0x8AD4, {15032,12980,11957,10934,9911,8889,2746,2746,0,4787}, {});
-    addField(0x02AC, "hyou13_2");
-    addFieldScriptBattle(0x02AC, 13, 1, 0x612, 679);
-    addFieldScriptMateria(0x02AC, 14, 1, 0x7F3, 83);
-    addFieldScriptMessage(0x02AC, 14, 1, 0, 0x80F, 0xFA6, 30);
-    addFieldModels(0x02AC, {1,2,3,4,5,6,7,8,9,0,0});
-    addFieldEncounters(0x02AC, 0x74F4, {15032,12980,11957,10934,9911,8889,2746,2746,0,4787}, {});
-    addField(0x0292, "hyou1");
-    addFieldModels(0x0292, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x0292, 0x6824, {16032,15009,13986,12963,10916,0,0,0,0,0}, {});
-    addField(0x0293, "hyou2");
-    addFieldScriptMessage(0x0293, 17, 1, 1, 0xA32, 0x12AB, 23);
-    addFieldScriptItem(0x0293, 17, 1, 0xA37, 74, 1);
-    addFieldModels(0x0293, {1,2,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x0293, 0xD1BC, {16032,15009,13986,12963,10916,0,0,0,0,0}, {});
-    addField(0x0294, "hyou3");
-    addFieldModels(0x0294, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x0294, 0x5F08, {16032,15009,13986,12963,10916,0,0,0,0,0}, {});
-    addField(0x0297, "hyou4");
-    addFieldModels(0x0297, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x0297, 0x9564, {16044,15021,13998,12975,10928,0,2737,2737,8882,4787}, {});
-    addField(0x0298, "hyou5_1");
-    addFieldScriptItem(0x0298, 23, 1, 0x9AA, 0, 1);
-    addFieldScriptMessage(0x0298, 23, 1, 0, 0x9BE, 0xAA8, 18);
-    addFieldModels(0x0298, {1,2,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x0298, 0x8480, {16044,15021,13998,12975,10928,0,2737,2737,8882,4787}, {});
-    addField(0x0299, "hyou5_2");
-    addFieldModels(0x0299, {1,2,3,4,5,6,7,8,9});
-    addField(0x029A, "hyou5_3");
-    addFieldScriptMessage(0x029A, 13, 1, 1, 0x622, 0xE88, 22);
-    addFieldScriptItem(0x029A, 13, 1, 0x627, 311, 1);
-    addFieldModels(0x029A, {1,2,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x029A, 0x7518, {16044,15021,13998,12975,10928,0,2737,2737,8882,4787}, {});
-    addField(0x029B, "hyou5_4");
-    addFieldModels(0x029B, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x029B, 0x7944, {16044,15021,13998,12975,10928,0,2737,2737,8882,4787}, {});
-    addField(0x029C, "hyou6");
-    addFieldModels(0x029C, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x029C, 0x72CC, {15032,12980,11957,10934,9911,8889,2746,2746,0,4787}, {});
-    addField(0x02A4, "hyou7");
-    addFieldModels(0x02A4, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02A4, 0x8DC8, {16044,15021,13998,12975,10928,0,2737,2737,8882,4787}, {});
-    addField(0x02A5, "hyou8_1");
-    addFieldModels(0x02A5, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02A5, 0x83A8, {15032,12980,11957,10934,9911,8889,2746,2746,0,4787}, {});
-    addField(0x02A6, "hyou8_2");
-    addFieldScriptItem(0x02A6, 12, 1, 0x4D0, 5, 1);
-    addFieldScriptMessage(0x02A6, 12, 1, 0, 0x4E4, 0x5E1, 18);
-    addFieldModels(0x02A6, {1,2,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x02A6, 0x5E28, {15032,12980,11957,10934,9911,8889,2746,2746,0,4787}, {});
-    addField(0x02A7, "hyou9");
-    addFieldModels(0x02A7, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02A7, 0x6244, {16044,15021,13998,12975,10928,0,2737,2737,8882,4787}, {});
-    addField(0x029D, "hyoumap");
-    addFieldModels(0x029D, {1,4,6});
-    addField(0x0295, "icedun_1");
-    addFieldModels(0x0295, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x0295, 0x8C04, {25256,23209,19114,0,0,0,0,0,0,8875}, {});
-    addField(0x0296, "icedun_2");
-    addFieldModels(0x0296, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x0296, 0x9D90, {25256,23209,19114,0,0,0,0,0,0,8875}, {});
-    addField(0x02CC, "ithill");
-    addFieldModels(0x02CC, {1,3,4,5,6,7,8,9});
-    addField(0x02D0, "ithos");
-    addFieldModels(0x02D0, {3,4,5,6,7,8,9,0,0,0});
-    addField(0x02D1, "itmin1");
-    addFieldScriptShop(0x02D1, 13, 1, 0x5F4, 48);
-    addFieldModels(0x02D1, {3,4,5,6,7,8,9,0,0,0,0,0});
-    addField(0x02D2, "itmin2");
-    addFieldScriptMessage(0x02D2, 11, 1, 0, 0x585, 0x69A, 18);
-    addFieldScriptItem(0x02D2, 11, 1, 0x58C, 5, 1);
-    addFieldModels(0x02D2, {3,4,5,6,7,8,9,0,0,0});
-    addField(0x02C9, "itown12");
-    addFieldWorldExit(0x02C9, 0x8268, 0, 0xB);
-    addFieldWorldExit(0x02C9, 0x8310, 7, 0xB);
-    addFieldModels(0x02C9, {3,4,5,6,7,8,9,0,0,0,0,0});
-    addField(0x02C8, "itown1a");
-    addFieldWorldExit(0x02C8, 0xA4B4, 0, 0xB);
-    addFieldWorldExit(0x02C8, 0xA55C, 7, 0xB);
-    addFieldModels(0x02C8, {3,4,5,6,7,8,9,0,0,0,0,0,0,0});
-    addField(0x02CA, "itown1b");
-    addFieldScriptShop(0x02CA, 2, 1, 0x9B3, 49);
-    addFieldScriptShop(0x02CA, 2, 1, 0x9C0, 47);
-    addFieldScriptShop(0x02CA, 2, 1, 0x9CD, 50);
-    addFieldScriptShop(0x02CA, 2, 1, 0x9F4, 47);
-    addFieldScriptMateria(0x02CA, 3, 1, 0xC22, 69);
-    addFieldScriptShop(0x02CA, 13, 1, 0x104A, 1);
-    addFieldScriptShop(0x02CA, 14, 1, 0x109A, 5);
-    addFieldScriptShop(0x02CA, 20, 1, 0x11C3, 48);
-    addFieldWorldExit(0x02CA, 0x9158, 0, 0xB);
-    addFieldWorldExit(0x02CA, 0x9200, 7, 0xB);
-    addFieldModels(0x02CA, {1,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x02CB, "itown2");
-    addFieldScriptBattle(0x02CB, 0, 0, 0x447, 280);
-    addFieldModels(0x02CB, {3,5,6,7,8,9,0});
-    addField(0x02CE, "itown_i");
-    addFieldScriptShop(0x02CE, 8, 1, 0x66E, 49);
-    addFieldScriptShop(0x02CE, 8, 3, 0x6CA, 49);
-    addFieldScriptMateria(0x02CE, 11, 1, 0xB49, 69);
-    addFieldModels(0x02CE, {3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x02CF, "itown_m");
-    addFieldScriptShop(0x02CF, 8, 1, 0x66F, 50);
-    addFieldScriptShop(0x02CF, 8, 3, 0x6D4, 50);
-    addFieldScriptMateria(0x02CF, 11, 1, 0xB2A, 69);
-    addFieldModels(0x02CF, {3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x02CD, "itown_w");
-    addFieldScriptShop(0x02CD, 8, 1, 0xAD4, 47);
-    addFieldScriptShop(0x02CD, 8, 3, 0xB30, 47);
-    addFieldScriptMateria(0x02CD, 11, 1, 0x102D, 69);
-    addFieldScriptItem(0x02CD, 12, 4, 0x1240, 313, 1);
-    addFieldModels(0x02CD, {3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x01D7, "jail1");
-    addFieldModels(0x01D7, {1,2,3,4,5,6,7,8,0,0});
-    addFieldEncounters(0x01D7, 0xB1F4, {25092,23045,18950,0,0,0,0,0,0,8711}, {});
-    addField(0x01D9, "jail2");
-    addFieldModels(0x01D9, {1,4,6,0,0,0,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x01D9, 0xAB28, {25092,23045,18950,0,0,0,0,0,0,8711}, {});
-    addField(0x01DE, "jail3");
-    addFieldModels(0x01DE, {1,4,6,0,0});
-    addFieldEncounters(0x01DE, 0x8160, {18953,17930,15883,14852,0,0,0,0,0,0}, {});
-    addField(0x01DF, "jail4");
-    addFieldModels(0x01DF, {1,4,6});
-    addFieldEncounters(0x01DF, 0x76F4, {18953,17930,15883,14853,0,0,0,0,0,0}, {});
-    addField(0x01D8, "jailin1");
-    addFieldModels(0x01D8, {1,4,6,0});
-    addFieldEncounters(0x01D8, 0x3F80, {35336,31240,0,0,0,0,0,0,0,0}, {});
-    addField(0x01DB, "jailin2");
-    addFieldModels(0x01DB, {1,2,3,4,5,6,7,8,0});
-    addField(0x01DC, "jailin3");
-    addFieldModels(0x01DC, {1,4,6});
-    addField(0x01DD, "jailin4");
-    addFieldModels(0x01DD, {1,2,3,4,5,7,8,0,0,0});
-    addField(0x01DA, "jailpb");
-    addFieldScriptShop(0x01DA, 5, 1, 0x2FD, 33);
-    addFieldModels(0x01DA, {1,4,6,0,0});
-    addField(0x01E6, "jet");
-    addFieldModels(0x01E6, {1,4,6,8,0,0,0,0,0,0,0,0,0});
-    addField(0x01E7, "jetin1");
-    addFieldScriptMessage(0x01E7, 0, 0, 0, 0x79B, 0x1B64, 33);
-    addFieldScriptItem(0x01E7, 0, 0, 0x7A2, 199, 1);
-    addFieldScriptMessage(0x01E7, 0, 0, 0, 0x7C2, 0x1B86, 31);
-    addFieldScriptItem(0x01E7, 0, 0, 0x7C9, 212, 1);
-    addFieldScriptMessage(0x01E7, 0, 0, 0, 0x7F4, 0x1AEF, 37);
-    addFieldScriptItem(0x01E7, 0, 0, 0x7F7, 95, 1);
-    addFieldScriptMessage(0x01E7, 0, 0, 0, 0x813, 0x1B15, 38);
-    addFieldScriptItem(0x01E7, 0, 0, 0x816, 96, 1);
-    addFieldScriptMessage(0x01E7, 0, 0, 0, 0x82C, 0x1B3C, 39);
-    addFieldScriptItem(0x01E7, 0, 0, 0x82F, 97, 1);
-    addFieldModels(0x01E7, {1,2,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x0259, "jtemplb");
-    addFieldModels(0x0259, {1,0,2,3,4,5,6,7,8,9,0,0});
-    addField(0x0307, "jtemplc");
-    addFieldModels(0x0307, {1,0,2,3,4,5,6,7,8,9,0,0});
-    addField(0x0258, "jtempl");
-    addFieldWorldExit(0x0258, 0x8D14, 1, 0x8);
-    addFieldWorldExit(0x0258, 0x8D2C, 2, 0x8);
-    addFieldModels(0x0258, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x025A, "jtmpin1");
-    addFieldModels(0x025A, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x025B, "jtmpin2");
-    addFieldModels(0x025B, {1});
-    addField(0x01B1, "jumin");
-    addFieldModels(0x01B1, {1,2,3,4,5,6,7,0});
-    addField(0x0176, "jun_a");
-    addFieldScriptShop(0x0176, 8, 1, 0x39E, 23);
-    addFieldScriptShop(0x0176, 9, 1, 0x3F5, 58);
-    addFieldModels(0x0176, {1,4,6,0,0,0});
-    addField(0x0181, "junair2");
-    addFieldModels(0x0181, {1,4,6,3,2,5,8,9,7,0});
-    addField(0x0180, "junair");
-    addFieldModels(0x0180, {1,4,6,3,5,8,9,7,0,0,0,0});
-    addFieldEncounters(0x0180, 0xD7D4, {25320,23273,19178,0,0,0,0,0,0,8939}, {25516,23469,19374,0,0,0,0,0,0,0});
-    addField(0x018D, "junbin12");
-    addFieldModels(0x018D, {1,4,6,3,0,0});
-    addField(0x018C, "junbin1");
-    addFieldModels(0x018C, {1,4,6,3,0});
-    addField(0x018E, "junbin21");
-    addFieldModels(0x018E, {1,4,6,3,0,0,0,0,0});
-    addField(0x018F, "junbin22");
-    addFieldModels(0x018F, {1,4,6,3,0,0,0,0,0});
-    addField(0x0190, "junbin3");
-    addFieldModels(0x0190, {1,4,3,6,0,0});
-    addField(0x0191, "junbin4");
-    addFieldScriptBattle(0x0191, 0, 0, 0x69B, 947);
-    addFieldModels(0x0191, {1,4,6,3,8,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0192, "junbin5");
-    addFieldModels(0x0192, {1,4,6,3,0,0,0});
-    addField(0x017E, "jundoc1a");
-    addFieldScriptMessage(0x017E, 19, 6, 0, 0x1194, 0x1E4A, 26);
-    addFieldScriptItem(0x017E, 19, 6, 0x119D, 299, 1);
-    addFieldScriptMateria(0x017E, 19, 6, 0x11AA, 1);
-    addFieldScriptMessage(0x017E, 19, 6, 0, 0x11D3, 0x1E2E, 27);
-    addFieldScriptMessage(0x017E, 19, 6, 0, 0x11F0, 0x1E14, 25);
-    addFieldScriptItem(0x017E, 19, 6, 0x11F9, 135, 1);
-    addFieldModels(0x017E, {1,4,5,6,0,0,0,0,0,0,0,0,0});
-    addField(0x017F, "jundoc1b");
-    addFieldModels(0x017F, {1,4,6,0});
-    addField(0x0184, "junele1");
-    addFieldScriptBattle(0x0184, 7, 3, 0x7C1, 763);
-    addFieldModels(0x0184, {1,4,6,0,0,0});
-    addField(0x0187, "junele2");
-    addFieldModels(0x0187, {1,4,6,0});
-    addField(0x016D, "jun_i1");
-    addFieldScriptShop(0x016D, 8, 1, 0x34A, 55);
-    addFieldScriptShop(0x016D, 8, 1, 0x380, 20);
-    addFieldModels(0x016D, {1,4,6,0,0});
-    addField(0x0177, "jun_i2");
-    addFieldScriptShop(0x0177, 14, 1, 0x71B, 59);
-    addFieldScriptShop(0x0177, 14, 1, 0x744, 24);
-    addFieldModels(0x0177, {1,4,6,0,0,0,0,0,0,0});
-    addField(0x0183, "junin1a");
-    addFieldModels(0x0183, {1,4,6,0,0,0,0,0});
-    addField(0x0182, "junin1");
-    addFieldModels(0x0182, {1,4,6,0,0,0,0,0,0,0});
-    addField(0x0185, "junin2");
-    addFieldModels(0x0185, {1,4,6,3,8,7,0,0,0,0,0});
-    addFieldEncounters(0x0185, 0x8DA8, {25324,23277,19182,0,0,0,4847,4847,8944,0}, {35760,31665,0,0,0,0,0,0,0,946});
-    addField(0x0186, "junin3");
-    addFieldModels(0x0186, {1,4,6,0,0,0,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0186, 0x5674, {25324,23277,19182,0,0,0,4847,4847,8944,0}, {});
-    addField(0x0188, "junin4");
-    addFieldScriptBattle(0x0188, 2, 0, 0x64E, 763);
-    addFieldScriptBattle(0x0188, 18, 3, 0x9D4, 763);
-    addFieldModels(0x0188, {1,3,4,5,6,7,8,9,0,0,0,0,0});
-    addFieldEncounters(0x0188, 0x6418, {25324,23277,19182,0,0,0,4847,4847,8944,0}, {});
-    addField(0x0189, "junin5");
-    addFieldModels(0x0189, {1,4,6});
-    addFieldEncounters(0x0189, 0x3D10, {19185,18164,16114,15093,0,0,2803,2799,0,4856}, {});
-    addField(0x018A, "junin6");
-    addFieldModels(0x018A, {1,4,6,0});
-    addFieldEncounters(0x018A, 0x396C, {19185,18164,16114,15093,0,0,2803,2799,0,4856}, {});
-    addField(0x018B, "junin7");
-    addFieldModels(0x018B, {1,4,6,0});
-    addField(0x0178, "juninn");
-    addFieldModels(0x0178, {1,4,6,0,0,0,0});
-    addField(0x016E, "jun_m");
-    addFieldScriptShop(0x016E, 8, 1, 0x353, 21);
-    addFieldScriptShop(0x016E, 8, 1, 0x36C, 21);
-    addFieldModels(0x016E, {1,4,6,0,0});
-    addField(0x016F, "junmin1");
-    addFieldModels(0x016F, {1,4,6,0,0,0,0,0,0});
-    addField(0x0170, "junmin2");
-    addFieldScriptItem(0x0170, 14, 1, 0x6E7, 74, 1);
-    addFieldScriptMessage(0x0170, 14, 1, 2, 0x6FA, 0x7E5, 23);
-    addFieldScriptItem(0x0170, 15, 1, 0x74D, 76, 1);
-    addFieldScriptMessage(0x0170, 15, 1, 2, 0x760, 0x7FD, 23);
-    addFieldScriptItem(0x0170, 16, 1, 0x7B0, 95, 1);
-    addFieldScriptMessage(0x0170, 16, 1, 2, 0x7C3, 0x815, 24);
-    addFieldModels(0x0170, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addField(0x0171, "junmin3");
-    addFieldScriptItem(0x0171, 13, 1, 0x70A, 71, 1);
-    addFieldScriptMessage(0x0171, 13, 1, 2, 0x71D, 0xA6B, 24);
-    addFieldScriptItem(0x0171, 14, 1, 0x773, 72, 1);
-    addFieldScriptMessage(0x0171, 14, 1, 2, 0x786, 0xA84, 26);
-    addFieldModels(0x0171, {1,4,6,0,0,0,0,0,0,0});
-    addField(0x017C, "junmin4");
-    addFieldScriptItem(0x017C, 11, 1, 0x5BA, 75, 1);
-    addFieldScriptMessage(0x017C, 11, 1, 2, 0x5CD, 0x7B6, 24);
-    addFieldModels(0x017C, {1,4,6,0,0,0,0});
-    addField(0x017D, "junmin5");
-    addFieldScriptItem(0x017D, 9, 1, 0x461, 95, 1);
-    addFieldScriptMessage(0x017D, 9, 1, 2, 0x474, 0x67A, 24);
-    addFieldModels(0x017D, {1,4,6,0,0,0});
-    addField(0x0167, "junon");
-    addFieldModels(0x0167, {0,0,0,0});
-    addField(0x0305, "junone22");
-    addFieldModels(0x0305, {1,4,6,3,2,5,8,9,7});
-    addField(0x019B, "junone2");
-    addFieldModels(0x019B, {1,4,6,3,8,0,0,0,0,0,0});
-    addFieldEncounters(0x019B, 0x5888, {25320,23273,19178,0,0,0,0,0,0,8939}, {25516,23469,19374,0,0,0,0,0,0,0});
-    addField(0x019C, "junone3");
-    addFieldModels(0x019C, {1,4,6,3,0,0});
-    addField(0x019D, "junone4");
-    addFieldModels(0x019D, {1,4,6});
-    addField(0x019E, "junone5");
-    addFieldModels(0x019E, {1,4,6,0,0,0,0});
-    addField(0x019F, "junone6");
-    addFieldModels(0x019F, {1,4,6});
-    addField(0x01A0, "junone7");
-    addFieldModels(0x01A0, {1,4,6,0,0});
-    addField(0x0172, "junonl1");
-    addFieldModels(0x0172, {1,4,5,6,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0173, "junonl2");
-    addFieldModels(0x0173, {1,4,6,0,0,0});
-    addField(0x0174, "junonl3");
-    addFieldModels(0x0174, {1,4,6});
-    addField(0x0168, "junonr1");
-    addFieldModels(0x0168, {1,4,6,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0169, "junonr2");
-    addFieldModels(0x0169, {1,4,6,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x016A, "junonr3");
-    addFieldModels(0x016A, {1,4,6});
-    addField(0x016B, "junonr4");
-    addFieldScriptItem(0x016B, 6, 1, 0xB4D, 3, 6);
-    addFieldScriptMessage(0x016B, 6, 1, 1, 0xB5C, 0x1B52, 18);
-    addFieldScriptItem(0x016B, 6, 1, 0xB91, 0, 6);
-    addFieldScriptMessage(0x016B, 6, 1, 1, 0xBA0, 0x1B8C, 20);
-    addFieldScriptItem(0x016B, 6, 1, 0xBCD, 20, 1);
-    addFieldScriptMessage(0x016B, 6, 1, 1, 0xBDC, 0x1B78, 19);
-    addFieldModels(0x016B, {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0179, "junpb_1");
-    addFieldModels(0x0179, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addField(0x017A, "junpb_2");
-    addFieldScriptItem(0x017A, 14, 1, 0xC99, 0, 1);
-    addFieldScriptMateria(0x017A, 14, 1, 0xD29, 53);
-    addFieldScriptMateria(0x017A, 14, 1, 0xD58, 23);
-    addFieldScriptMateria(0x017A, 14, 1, 0xD5F, 52);
-    addFieldScriptMateria(0x017A, 14, 1, 0xD66, 53);
-    addFieldScriptMateria(0x017A, 17, 1, 0x104F, 44);
-    addFieldScriptMessage(0x017A, 17, 1, 2, 0x1083, 0x3F02, 31);
-    addFieldModels(0x017A, {1,4,6,0,0,0,0,0,0,0,0,0,0});
-    addField(0x017B, "junpb_3");
-    addFieldModels(0x017B, {1,4,6,0,0,0,0,0,0,0});
-    addField(0x0194, "junsbd1");
-    addFieldModels(0x0194, {1,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x0194, 0x7554, {35577,31482,0,0,0,0,0,0,0,0}, {});
-    addField(0x016C, "jun_wa");
-    addFieldScriptShop(0x016C, 8, 1, 0x351, 54);
-    addFieldScriptShop(0x016C, 8, 1, 0x36A, 19);
-    addFieldModels(0x016C, {1,4,6,0,0});
-    addField(0x0175, "jun_w");
-    addFieldScriptShop(0x0175, 9, 1, 0x586, 57);
-    addFieldScriptShop(0x0175, 9, 1, 0x5A5, 22);
-    addFieldScriptShop(0x0175, 9, 1, 0x5C4, 22);
-    addFieldScriptShop(0x0175, 9, 1, 0x5E3, 22);
-    addFieldModels(0x0175, {1,4,6,0,0});
-    addField(0x0266, "kuro_10");
-    addFieldModels(0x0266, {1});
-    addField(0x0267, "kuro_11");
-    addFieldModels(0x0267, {1});
-    addField(0x0268, "kuro_12");
-    addFieldScriptBattle(0x0268, 16, 4, 0xC3B, 644);
-    addFieldModels(0x0268, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x025C, "kuro_1");
-    addFieldScriptMessage(0x025C, 30, 1, 0, 0x11FD, 0x1809, 19);
-    addFieldScriptItem(0x025C, 30, 1, 0x1200, 203, 1);
-    addFieldScriptMateria(0x025C, 31, 1, 0x123F, 4);
-    addFieldScriptItem(0x025C, 32, 1, 0x12C7, 4, 1);
-    addFieldScriptMessage(0x025C, 32, 1, 0, 0x12DA, 0x179B, 23);
-    addFieldScriptItem(0x025C, 33, 1, 0x132A, 74, 1);
-    addFieldScriptMessage(0x025C, 33, 1, 0, 0x133D, 0x17B3, 23);
-    addFieldScriptMessage(0x025C, 34, 1, 0, 0x13D0, 0x181D, 24);
-    addFieldScriptItem(0x025C, 34, 1, 0x13D3, 171, 1);
-    addFieldScriptMessage(0x025C, 35, 1, 0, 0x1466, 0x1836, 18);
-    addFieldScriptItem(0x025C, 35, 1, 0x1469, 306, 1);
-    addFieldModels(0x025C, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0,0});
-    addFieldEncounters(0x025C, 0x979C, {15992,14969,13946,12923,10876,0,4733,4734,8831,0}, {});
-    addField(0x025D, "kuro_2");
-    addFieldScriptShop(0x025D, 16, 1, 0x7EC, 45);
-    addFieldScriptMessage(0x025D, 17, 1, 0, 0x935, 0xCA8, 24);
-    addFieldScriptItem(0x025D, 17, 1, 0x938, 250, 1);
-    addFieldModels(0x025D, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x025E, "kuro_3");
-    addFieldScriptMateria(0x025E, 30, 1, 0x1DDA, 40);
-    addFieldScriptMessage(0x025E, 30, 1, 0, 0x1E18, 0x239B, 25);
-    addFieldModels(0x025E, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0});
-    addField(0x025F, "kuro_4");
-    addFieldModels(0x025F, {1,0,0,0,0,0});
-    addField(0x0260, "kuro_5");
-    addFieldScriptBattle(0x0260, 10, 0, 0xA2A, 648);
-    addFieldScriptBattle(0x0260, 10, 0, 0xA3A, 648);
-    addFieldScriptBattle(0x0260, 10, 0, 0xA4E, 648);
-    addFieldScriptBattle(0x0260, 10, 0, 0xA77, 648);
-    addFieldScriptMessage(0x0260, 22, 1, 0, 0xC3E, 0xD3B, 20);
-    addFieldScriptItem(0x0260, 22, 1, 0xC41, 138, 1);
-    addFieldModels(0x0260, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x0261, "kuro_6");
-    addFieldScriptBattle(0x0261, 7, 1, 0x4A1, 645);
-    addFieldScriptBattle(0x0261, 7, 1, 0x4F0, 649);
-    addFieldScriptMessage(0x0261, 7, 1, 0, 0x555, 0x64C, 26);
-    addFieldScriptItem(0x0261, 7, 1, 0x558, 200, 1);
-    addFieldScriptMessage(0x0261, 7, 1, 0, 0x5B7, 0x667, 25);
-    addFieldScriptItem(0x0261, 7, 1, 0x5BA, 237, 1);
-    addFieldScriptMessage(0x0261, 7, 1, 0, 0x619, 0x681, 21);
-    addFieldScriptItem(0x0261, 7, 1, 0x61C, 6, 1);
-    addFieldModels(0x0261, {1,0});
-    addField(0x0262, "kuro_7");
-    addFieldScriptItem(0x0262, 28, 1, 0x1812, 155, 1);
-    addFieldScriptMessage(0x0262, 28, 1, 0, 0x1825, 0x1982, 22);
-    addFieldModels(0x0262, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x0264, "kuro_82");
-    addFieldScriptBattle(0x0264, 2, 0, 0x875, 652);
-    addFieldScriptMateria(0x0264, 20, 1, 0x12FC, 81);
-    addFieldScriptMessage(0x0264, 20, 1, 0, 0x133A, 0x19AD, 27);
-    addFieldModels(0x0264, {1,1,2,3,4,5,6,7,8,9,0,0});
-    addFieldEncounters(0x0264, 0xB998, {25216,23169,19074,0,0,0,0,0,0,8835}, {});
-    addField(0x0263, "kuro_8");
-    addFieldModels(0x0263, {1,2,3,4,5,6,7,8,9,0,0,0,0,0});
-    addFieldEncounters(0x0263, 0x8708, {25216,23169,19074,0,0,0,0,0,0,8835}, {});
-    addField(0x0265, "kuro_9");
-    addFieldModels(0x0265, {1,2,3,4,5,6,7,8,9,0,0,0});
-    addField(0x02E8, "las0_1");
-    addFieldModels(0x02E8, {1,0});
-    addField(0x02E9, "las0_2");
-    addFieldModels(0x02E9, {1});
-    addField(0x02EA, "las0_3");
-    addFieldModels(0x02EA, {1});
-    addField(0x02EB, "las0_4");
-    addFieldScriptMessage(0x02EB, 30, 1, 1, 0x148F, 0x17DF, 24);
-    addFieldScriptItem(0x02EB, 30, 1, 0x1492, 98, 1);
-    addFieldScriptMessage(0x02EB, 31, 1, 0, 0x1512, 0x1795, 24);
-    addFieldScriptItem(0x02EB, 31, 1, 0x1515, 72, 1);
-    addFieldModels(0x02EB, {1,0,0,0});
-    addFieldEncounters(0x02EB, 0x907C, {19300,18278,16233,15205,0,0,0,0,0,0}, {});
-    addField(0x02EC, "las0_5");
-    addFieldScriptMessage(0x02EC, 30, 1, 1, 0x1751, 0x1CC5, 23);
-    addFieldScriptItem(0x02EC, 30, 1, 0x1754, 74, 1);
-    addFieldScriptMessage(0x02EC, 31, 1, 1, 0x17EA, 0x1C80, 24);
-    addFieldScriptItem(0x02EC, 31, 1, 0x17ED, 71, 1);
-    addFieldScriptMessage(0x02EC, 32, 1, 1, 0x1883, 0x1C99, 18);
-    addFieldScriptItem(0x02EC, 32, 1, 0x1886, 5, 1);
-    addFieldScriptMessage(0x02EC, 33, 1, 1, 0x191C, 0x1CDD, 24);
-    addFieldScriptItem(0x02EC, 33, 1, 0x191F, 73, 1);
-    addFieldScriptMessage(0x02EC, 34, 1, 1, 0x19B5, 0x1CAC, 24);
-    addFieldScriptItem(0x02EC, 34, 1, 0x19B8, 72, 1);
-    addFieldScriptMateria(0x02EC, 35, 1, 0x1A05, 28);
-    addFieldScriptMessage(0x02EC, 35, 1, 0, 0x1A25, 0x1D0F, 29);
-    addFieldModels(0x02EC, {1,0,0,0,0,0,0,0});
-    addFieldEncounters(0x02EC, 0xCFA0, {19380,18278,16233,15205,0,0,4971,5046,0,0}, {});
-    addField(0x02ED, "las0_6");
-    addFieldScriptMessage(0x02ED, 36, 1, 0, 0x15CA, 0x1B2F, 23);
-    addFieldScriptItem(0x02ED, 36, 1, 0x15CD, 74, 1);
-    addFieldScriptMessage(0x02ED, 37, 1, 0, 0x1675, 0x1B47, 22);
-    addFieldScriptItem(0x02ED, 37, 1, 0x1678, 18, 1);
-    addFieldModels(0x02ED, {1,3,4,5,7,8,9,6,0,0,0});
-    addFieldEncounters(0x02ED, 0x892C, {16308,15206,14185,13162,11189,0,4971,5046,0,0}, {});
-    addField(0x02EE, "las0_7");
-    addFieldScriptMessage(0x02EE, 9, 1, 0, 0x4F8, 0xA2C, 21);
-    addFieldScriptItem(0x02EE, 9, 1, 0x4FF, 6, 1);
-    addFieldScriptMessage(0x02EE, 10, 1, 0, 0x592, 0xA42, 24);
-    addFieldScriptItem(0x02EE, 10, 1, 0x599, 71, 1);
-    addFieldScriptMessage(0x02EE, 11, 1, 0, 0x62C, 0xA5B, 24);
-    addFieldScriptItem(0x02EE, 11, 1, 0x633, 72, 1);
-    addFieldModels(0x02EE, {1,3,4,5,7,8,9,6,0,0,0,0});
-    addFieldEncounters(0x02EE, 0x738C, {15285,13158,12137,11188,10090,9064,4971,5046,0,0}, {});
-    addField(0x02EF, "las0_8");
-    addFieldModels(0x02EF, {1,3,4,5,7,8,9,6,0});
-    addFieldEncounters(0x02EF, 0xA280, {15285,13158,12137,11188,10090,9064,4971,5046,0,0}, {});
-    addField(0x02F0, "las1_1");
-    addFieldModels(0x02F0, {1,0});
-    addFieldEncounters(0x02F0, 0x4E68, {15212,13165,12142,11119,10096,9073,2930,2930,0,4979}, {});
-    addField(0x02F1, "las1_2");
-    addFieldScriptMessage(0x02F1, 5, 1, 0, 0x546, 0x831, 18);
-    addFieldScriptItem(0x02F1, 5, 1, 0x549, 5, 1);
-    addFieldScriptMessage(0x02F1, 6, 1, 0, 0x5CF, 0x844, 19);
-    addFieldScriptItem(0x02F1, 6, 1, 0x5D2, 284, 1);
-    addFieldScriptMessage(0x02F1, 7, 1, 0, 0x658, 0x858, 24);
-    addFieldScriptItem(0x02F1, 7, 1, 0x65B, 75, 1);
-    addFieldModels(0x02F1, {1,0,0,0,0});
-    addFieldEncounters(0x02F1, 0x764C, {15212,13165,12142,11119,10096,9073,2930,2930,0,4979}, {});
-    addField(0x02F2, "las1_3");
-    addFieldScriptMessage(0x02F2, 3, 1, 0, 0x3D0, 0x77E, 27);
-    addFieldScriptItem(0x02F2, 3, 1, 0x3D3, 310, 1);
-    addFieldScriptMessage(0x02F2, 4, 1, 0, 0x459, 0x765, 24);
-    addFieldScriptItem(0x02F2, 4, 1, 0x45C, 75, 1);
-    addFieldScriptMessage(0x02F2, 5, 1, 0, 0x4E2, 0x79A, 21);
-    addFieldScriptItem(0x02F2, 5, 1, 0x4E5, 6, 1);
-    addFieldScriptMessage(0x02F2, 6, 1, 0, 0x56B, 0x79A, 21);
-    addFieldScriptItem(0x02F2, 6, 1, 0x56E, 6, 1);
-    addFieldModels(0x02F2, {1,0,0,0,0,0});
-    addFieldEncounters(0x02F2, 0x7F40, {15212,13165,12142,11119,10096,9073,2930,2930,0,4979}, {});
-    addField(0x02F3, "las1_4");
-    addFieldModels(0x02F3, {1,0});
-    addFieldEncounters(0x02F3, 0x6DDC, {15212,13165,12142,11119,10096,9073,2930,2930,0,4979}, {});
-    addField(0x02F4, "las2_1");
-    addFieldModels(0x02F4, {1,3,4,5,7,8,9,6,0});
-    addFieldEncounters(0x02F4, 0xAF54, {19324,18301,16254,15232,0,0,4991,4991,0,0}, {});
-    addField(0x02F5, "las2_2");
-    addFieldScriptMessage(0x02F5, 22, 1, 0, 0xF39, 0x141F, 24);
-    addFieldScriptItem(0x02F5, 22, 1, 0xF40, 73, 1);
-    addFieldScriptMessage(0x02F5, 23, 1, 0, 0xFD3, 0x1438, 18);
-    addFieldScriptItem(0x02F5, 23, 1, 0xFDA, 15, 1);
-    addFieldModels(0x02F5, {1,3,4,5,7,8,9,6,0,0,0});
-    addFieldEncounters(0x02F5, 0xBB3C, {16244,14197,13174,12153,10107,4986,0,0,9079,9080}, {});
-    addField(0x02F6, "las2_3");
-    addFieldScriptMessage(0x02F6, 20, 1, 0, 0xFCA, 0x15F1, 22);
-    addFieldScriptItem(0x02F6, 20, 1, 0xFD1, 18, 1);
-    addFieldScriptMessage(0x02F6, 21, 1, 0, 0x1064, 0x1608, 19);
-    addFieldScriptItem(0x02F6, 21, 1, 0x106B, 19, 1);
-    addFieldScriptMessage(0x02F6, 22, 1, 0, 0x10FE, 0x161C, 26);
-    addFieldScriptItem(0x02F6, 22, 1, 0x1105, 271, 1);
-    addFieldScriptMateria(0x02F6, 23, 1, 0x1144, 71);
-    addFieldScriptMessage(0x02F6, 23, 1, 0, 0x1169, 0x152A, 26);
-    addFieldModels(0x02F6, {1,3,4,5,7,8,9,6,0,0,0,0,0});
-    addFieldEncounters(0x02F6, 0xCB8C, {16244,14197,13174,12153,10107,4986,0,0,9079,9080}, {});
-    addField(0x02F7, "las2_4");
-    addFieldScriptMateria(0x02F7, 10, 1, 0x4F0, 24);
-    addFieldScriptMessage(0x02F7, 10, 1, 0, 0x515, 0x960, 27);
-    addFieldScriptMateria(0x02F7, 11, 1, 0x55F, 19);
-    addFieldModels(0x02F7, {1,3,4,5,7,8,9,6,0,0,0});
-    addFieldEncounters(0x02F7, 0xC764, {19324,18301,16254,15232,0,0,4991,4991,0,0}, {});
-    addField(0x02F8, "las3_1");
-    addFieldScriptMessage(0x02F8, 2, 1, 0, 0xB7E, 0x10F5, 18);
-    addFieldScriptItem(0x02F8, 2, 1, 0xB81, 5, 1);
-    addFieldScriptMessage(0x02F8, 3, 1, 0, 0xC03, 0x10E0, 20);
-    addFieldScriptItem(0x02F8, 3, 1, 0xC06, 2, 1);
-    addFieldScriptMessage(0x02F8, 4, 1, 0, 0xC86, 0x1108, 18);
-    addFieldScriptItem(0x02F8, 4, 1, 0xC89, 15, 1);
-    addFieldModels(0x02F8, {1,0,0,0,0});
-    addFieldEncounters(0x02F8, 0x6FBC, {19324,18301,16254,15232,0,0,4991,4991,0,0}, {});
-    addField(0x02F9, "las3_2");
-    addFieldScriptMessage(0x02F9, 2, 1, 0, 0xBEE, 0x11EF, 23);
-    addFieldScriptItem(0x02F9, 2, 1, 0xBF1, 4, 1);
-    addFieldScriptMessage(0x02F9, 3, 1, 0, 0xC73, 0x1207, 19);
-    addFieldScriptItem(0x02F9, 3, 1, 0xC76, 19, 1);
-    addFieldScriptMessage(0x02F9, 4, 1, 0, 0xCFF, 0x121B, 33);
-    addFieldScriptMateria(0x02F9, 4, 1, 0xD02, 25);
-    addFieldModels(0x02F9, {1,0,0,0,0});
-    addFieldEncounters(0x02F9, 0xACC0, {19324,18301,16254,15232,0,0,4991,4991,0,0}, {});
-    addField(0x02FA, "las3_3");
-    addFieldScriptMessage(0x02FA, 2, 1, 0, 0x1162, 0x18AC, 24);
-    addFieldScriptItem(0x02FA, 2, 1, 0x1165, 75, 1);
-    addFieldScriptMessage(0x02FA, 3, 1, 0, 0x11E7, 0x18C5, 23);
-    addFieldScriptItem(0x02FA, 3, 1, 0x11EA, 4, 1);
-    addFieldScriptMessage(0x02FA, 4, 1, 0, 0x126C, 0x18DD, 20);
-    addFieldScriptItem(0x02FA, 4, 1, 0x126F, 2, 1);
-    addFieldScriptMateria(0x02FA, 5, 3, 0x12DE, 12);
-    addFieldModels(0x02FA, {1,0,0,0,0,0});
-    addFieldEncounters(0x02FA, 0xB8EC, {19324,18301,16254,15232,0,0,4991,4991,0,0}, {});
-    addField(0x02FB, "las4_0");
-    addFieldScriptBattle(0x02FB, 0, 0, 0x738, 925);
-    addFieldScriptMessage(0x02FB, 3, 1, 1, 0xBAC, 0x1C9E, 24);
-    addFieldScriptItem(0x02FB, 3, 1, 0xBB3, 72, 1);
-    addFieldScriptMessage(0x02FB, 3, 1, 1, 0xBCA, 0x1CB7, 19);
-    addFieldScriptItem(0x02FB, 3, 1, 0xBD1, 19, 1);
-    addFieldScriptMessage(0x02FB, 3, 1, 1, 0xBE2, 0x1CCB, 18);
-    addFieldScriptItem(0x02FB, 3, 1, 0xBE9, 15, 1);
-    addFieldScriptItem(0x02FB, 4, 1, 0xDC1, 284, 1);
-    addFieldScriptMessage(0x02FB, 4, 1, 1, 0xDD8, 0x1C53, 22);
-    addFieldScriptItem(0x02FB, 4, 1, 0xDDF, 18, 1);
-    addFieldScriptMessage(0x02FB, 4, 1, 1, 0xDF0, 0x1C6A, 23);
-    addFieldScriptItem(0x02FB, 4, 1, 0xDF7, 4, 1);
-    addFieldScriptMessage(0x02FB, 5, 1, 1, 0xF8E, 0x1D15, 23);
-    addFieldScriptItem(0x02FB, 5, 1, 0xF99, 74, 1);
-    addFieldScriptMateria(0x02FB, 5, 1, 0xFA6, 71);
-    addFieldScriptMessage(0x02FB, 5, 1, 1, 0xFC2, 0x1D2D, 26);
-    addFieldScriptMessage(0x02FB, 5, 1, 1, 0xFED, 0x1D7A, 24);
-    addFieldScriptItem(0x02FB, 5, 1, 0xFF8, 75, 1);
-    addFieldScriptMessage(0x02FB, 6, 1, 1, 0x117C, 0x1DD5, 24);
-    addFieldScriptItem(0x02FB, 6, 1, 0x1183, 75, 1);
-    addFieldScriptMessage(0x02FB, 6, 1, 1, 0x119A, 0x1DEE, 26);
-    addFieldScriptItem(0x02FB, 6, 1, 0x11A1, 271, 1);
-    addFieldScriptMessage(0x02FB, 6, 1, 1, 0x11B2, 0x1E09, 18);
-    addFieldScriptItem(0x02FB, 6, 1, 0x11B9, 5, 1);
-    addFieldScriptItem(0x02FB, 7, 1, 0x144A, 6, 1);
-    addFieldScriptMateria(0x02FB, 7, 1, 0x14A9, 19);
-    addFieldScriptMateria(0x02FB, 7, 1, 0x14B2, 24);
-    addFieldScriptMessage(0x02FB, 7, 1, 1, 0x14EB, 0x214B, 27);
-    addFieldScriptMessage(0x02FB, 7, 1, 1, 0x1519, 0x21A9, 19);
-    addFieldScriptItem(0x02FB, 7, 1, 0x1524, 19, 1);
-    addFieldScriptMessage(0x02FB, 8, 1, 1, 0x16A7, 0x1E59, 18);
-    addFieldScriptItem(0x02FB, 8, 1, 0x16AE, 5, 1);
-    addFieldScriptMessage(0x02FB, 8, 1, 1, 0x16C5, 0x1E6C, 18);
-    addFieldScriptItem(0x02FB, 8, 1, 0x16CC, 15, 1);
-    addFieldScriptMessage(0x02FB, 8, 1, 1, 0x16DD, 0x1E7F, 20);
-    addFieldScriptItem(0x02FB, 8, 1, 0x16E4, 2, 1);
-    addFieldScriptItem(0x02FB, 9, 1, 0x1825, 6, 1);
-    addFieldScriptMessage(0x02FB, 9, 1, 1, 0x1845, 0x1EDA, 24);
-    addFieldScriptItem(0x02FB, 9, 1, 0x184C, 73, 1);
-    addFieldScriptMateria(0x02FB, 9, 1, 0x1857, 12);
-    addFieldModels(0x02FB, {1,3,4,5,6,7,8,9,1});
-    addField(0x02FC, "las4_1");
-    addFieldScriptMessage(0x02FC, 10, 1, 0, 0x144B, 0x17BD, 23);
-    addFieldScriptItem(0x02FC, 10, 1, 0x144E, 76, 1);
-    addFieldModels(0x02FC, {1,3,4,5,6,7,8,9,0,0});
-    addField(0x02FD, "las4_2");
-    addFieldScriptBattle(0x02FD, 3, 1, 0x69B, 902);
-    addFieldScriptBattle(0x02FD, 3, 1, 0x6A7, 900);
-    addFieldScriptBattle(0x02FD, 3, 1, 0x6AD, 901);
-    addFieldModels(0x02FD, {1,3,4,5,6,7,8,9});
-    addField(0x02FE, "las4_3");
-    addFieldScriptBattle(0x02FE, 3, 1, 0x533, 902);
-    addFieldScriptBattle(0x02FE, 3, 1, 0x53F, 900);
-    addFieldScriptBattle(0x02FE, 3, 1, 0x545, 901);
-    addFieldModels(0x02FE, {1});
-    addField(0x02FF, "las4_4");
-    addFieldScriptBattle(0x02FF, 0, 0, 0x521, 908);
-    addFieldModels(0x02FF, {0,3,4,5,6,7,8,9,0});
-    addField(0x0300, "lastmap");
-    addFieldScriptBattle(0x0300, 15, 3, 0x1D56, 912);
-    addFieldScriptBattle(0x0300, 15, 4, 0x1D6E, 928);
-    addFieldScriptBattle(0x0300, 15, 4, 0x1DA3, 916);
-    addFieldScriptBattle(0x0300, 15, 5, 0x1DBA, 932);
-    addFieldScriptBattle(0x0300, 15, 5, 0x1DEB, 920);
-    addFieldScriptBattle(0x0300, 15, 5, 0x1E06, 936);
-    addFieldScriptBattle(0x0300, 17, 8, 0x237B, 924);
-    addFieldModels(0x0300, {1,3,4,5,6,7,8,9,0});
-    addField(0x02D4, "life2");
-    addFieldModels(0x02D4, {1,4});
-    addField(0x02D3, "life");
-    addFieldModels(0x02D3, {1,4});
-    addField(0x0277, "losin1");
-    addFieldScriptMateria(0x0277, 6, 1, 0x347, 64);
-    addFieldScriptMessage(0x0277, 6, 1, 0, 0x36D, 0x512, 25);
-    addFieldModels(0x0277, {1,4,6,0});
-    addField(0x0278, "losin2");
-    addFieldScriptMessage(0x0278, 17, 1, 0, 0xF57, 0x115C, 24);
-    addFieldScriptItem(0x0278, 17, 1, 0xF5A, 72, 1);
-    addFieldModels(0x0278, {1,3,4,5,6,7,8,9,0});
-    addField(0x0279, "losin3");
-    addFieldScriptMessage(0x0279, 10, 1, 0, 0x6CD, 0x8EB, 24);
-    addFieldScriptItem(0x0279, 10, 1, 0x6D0, 73, 1);
-    addFieldModels(0x0279, {1,4,6,0,0});
-    addField(0x027C, "losinn");
-    addFieldScriptMessage(0x027C, 20, 1, 0, 0x1311, 0x157C, 18);
-    addFieldScriptItem(0x027C, 20, 1, 0x1314, 5, 1);
-    addFieldScriptMateria(0x027C, 21, 1, 0x1351, 44);
-    addFieldScriptMessage(0x027C, 21, 1, 0, 0x137A, 0x15C1, 31);
-    addFieldModels(0x027C, {1,3,4,5,6,7,8,9,0,0});
-    addField(0x027D, "loslake1");
-    addFieldScriptItem(0x027D, 19, 1, 0xDE5, 279, 1);
-    addFieldScriptMessage(0x027D, 19, 1, 0, 0xDF4, 0x110E, 25);
-    addFieldModels(0x027D, {1,4,6,3,2,5,8,9,7,0,0,0});
-    addField(0x027E, "loslake2");
-    addFieldModels(0x027E, {1,4,6});
-    addField(0x027F, "loslake3");
-    addFieldModels(0x027F, {1,4,6,0,0});
-    addField(0x0276, "lost1");
-    addFieldWorldExit(0x0276, 0x83C0, 0, 0x3A);
-    addFieldModels(0x0276, {1,3,4,5,6,7,8,9});
-    addField(0x027A, "lost2");
-    addFieldModels(0x027A, {1,3,4,5,6,7,8,9,0});
-    addField(0x027B, "lost3");
-    addFieldModels(0x027B, {1,4,6});
-    addField(0x00E1, "md0");
-    addFieldModels(0x00E1, {1,3,4,6,0,0,0,0});
-    addField(0x0075, "md1_1");
-    addFieldModels(0x0075, {1,3,0,0,0,0,0});
-    addFieldEncounters(0x0075, 0x762C, {24877,22830,18735,0,0,0,4400,4400,0,0}, {});
-    addField(0x0076, "md1_2");
-    addFieldModels(0x0076, {1,0,0,0});
-    addFieldEncounters(0x0076, 0x7220, {24877,22830,18735,0,0,0,4400,4400,0,0}, {});
-    addField(0x0074, "md1stin");
-    addFieldScriptBattle(0x0074, 0, 0, 0x4C6, 300);
-    addFieldScriptMessage(0x0074, 9, 1, 0, 0x711, 0x9CF, 18);
-    addFieldScriptItem(0x0074, 9, 1, 0x718, 0, 1);
-    addFieldScriptMessage(0x0074, 9, 1, 0, 0x734, 0x9CF, 18);
-    addFieldScriptItem(0x0074, 9, 1, 0x73B, 0, 1);
-    addFieldScriptMessage(0x0074, 10, 1, 0, 0x7B5, 0x9CF, 18);
-    addFieldScriptItem(0x0074, 10, 1, 0x7BC, 0, 1);
-    addFieldScriptMessage(0x0074, 10, 1, 0, 0x7D8, 0x9CF, 18);
-    addFieldScriptItem(0x0074, 10, 1, 0x7DF, 0, 1);
-    addFieldScriptMessage(0x0074, 11, 1, 0, 0x855, 0x9CF, 18);
-    addFieldScriptItem(0x0074, 11, 1, 0x85C, 0, 1);
-    addFieldScriptMessage(0x0074, 11, 1, 0, 0x878, 0x9CF, 18);
-    addFieldScriptItem(0x0074, 11, 1, 0x87F, 0, 1);
-    addFieldModels(0x0074, {1,3,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0074, 0x8154, {24877,22830,18735,0,0,0,4400,4400,0,0}, {});
-    addField(0x0085, "md8_1");
-    addFieldModels(0x0085, {1,3,0,0,0});
-    addField(0x0086, "md8_2");
-    addFieldModels(0x0086, {1,0,0,0,0});
-    addField(0x02E3, "md8_32");
-    addFieldScriptMessage(0x02E3, 6, 1, 0, 0x52B, 0x23DD, 20);
-    addFieldScriptItem(0x02E3, 6, 1, 0x532, 284, 1);
-    addFieldScriptMessage(0x02E3, 7, 1, 0, 0x5C3, 0x2362, 19);
-    addFieldScriptItem(0x02E3, 7, 1, 0x5CA, 5, 1);
-    addFieldModels(0x02E3, {1,8,0,0,0});
-    addFieldEncounters(0x02E3, 0x8800, {19268,18245,16198,15175,0,0,0,0,0,0}, {});
-    addField(0x0087, "md8_3");
-    addFieldScriptMessage(0x0087, 11, 1, 1, 0x699, 0x8A0, 18);
-    addFieldScriptItem(0x0087, 11, 1, 0x6A0, 0, 1);
-    addFieldModels(0x0087, {1,4,6,0,0,0,0,0,0,0,0});
-    addField(0x0088, "md8_4");
-    addFieldModels(0x0088, {1,3,0,0,0});
-    addField(0x030B, "md8_52");
-    addFieldModels(0x030B, {1,0,0,0,0,0,0,0,0,0});
-    addField(0x02DB, "md8_5");
-    addFieldModels(0x02DB, {1,0,0,0,0,0,8,0});
-    addField(0x02DC, "md8_6");
-    addFieldModels(0x02DC, {1,3,4,5,7,8,9,6,0});
-    addField(0x02DD, "md8_b1");
-    addFieldScriptMessage(0x02DD, 15, 1, 0, 0xB60, 0x2A79, 25);
-    addFieldScriptItem(0x02DD, 15, 1, 0xB67, 272, 1);
-    addFieldScriptMessage(0x02DD, 16, 1, 0, 0xBF8, 0x2A64, 20);
-    addFieldScriptItem(0x02DD, 16, 1, 0xBFF, 174, 1);
-    addFieldScriptMessage(0x02DD, 17, 1, 0, 0xC90, 0x2A93, 22);
-    addFieldScriptItem(0x02DD, 17, 1, 0xC97, 6, 1);
-    addFieldScriptMessage(0x02DD, 18, 1, 0, 0xD28, 0x2AC7, 19);
-    addFieldScriptItem(0x02DD, 18, 1, 0xD2F, 5, 1);
-    addFieldModels(0x02DD, {1,0,0,0,0,0});
-    addFieldEncounters(0x02DD, 0xA42C, {15156,13110,12087,11064,10041,9018,2875,2876,0,4925}, {});
-    addField(0x02DE, "md8_b2");
-    addFieldScriptMessage(0x02DE, 16, 1, 0, 0xC13, 0x2A4A, 19);
-    addFieldScriptItem(0x02DE, 16, 1, 0xC1A, 5, 1);
-    addFieldScriptMessage(0x02DE, 17, 1, 0, 0xCAB, 0x2A2D, 28);
-    addFieldScriptItem(0x02DE, 17, 1, 0xCB2, 240, 1);
-    addFieldModels(0x02DE, {1,0,0});
-    addFieldEncounters(0x02DE, 0xB658, {15157,13110,12087,11064,10041,9018,2875,2876,0,4925}, {});
-    addField(0x02E2, "md8brdg2");
-    addFieldScriptBattle(0x02E2, 13, 2, 0x8AF, 844);
-    addFieldModels(0x02E2, {1,3,4,5,7,8,9,6,0,0,0});
-    addField(0x0089, "md8brdg");
-    addFieldScriptBattle(0x0089, 0, 3, 0x61A, 328);
-    addFieldScriptBattle(0x0089, 0, 3, 0x68F, 329);
-    addFieldScriptBattle(0x0089, 0, 3, 0x6F8, 330);
-    addFieldModels(0x0089, {1,4,6,0,0,0,0,0,0,0,0});
-    addField(0x02E6, "md_e1");
-    addFieldModels(0x02E6, {1,0,0,0,0,0,0});
-    addField(0x00B1, "mds5_1");
-    addFieldModels(0x00B1, {1,2,4,6,0,0,0,0,0,0});
-    addField(0x00AD, "mds5_2");
-    addFieldModels(0x00AD, {1,2,4,6,0,0});
-    addFieldEncounters(0x00AD, 0x7520, {24952,22905,18810,0,0,0,4475,4475,0,0}, {});
-    addField(0x00AC, "mds5_3");
-    addFieldModels(0x00AC, {1,2,4,6,0,0,0});
-    addFieldEncounters(0x00AC, 0x68CC, {24952,22905,18810,0,0,0,4475,4475,0,0}, {});
-    addField(0x00AB, "mds5_4");
-    addFieldModels(0x00AB, {1,2});
-    addField(0x00AA, "mds5_5");
-    addFieldWorldExit(0x00AA, 0x5858, 1, 0x1);
-    addFieldModels(0x00AA, {1,3,2,4,6,5,0});
-    addField(0x00B0, "mds5_dk");
-    addFieldModels(0x00B0, {1,2,4,6,0});
-    addField(0x00B3, "mds5_i");
-    addFieldScriptShop(0x00B3, 4, 1, 0x285, 4);
-    addFieldScriptShop(0x00B3, 4, 1, 0x29B, 4);
-    addFieldScriptShop(0x00B3, 4, 4, 0x2FB, 4);
-    addFieldScriptShop(0x00B3, 4, 4, 0x311, 4);
-    addFieldModels(0x00B3, {1,4,6,0});
-    addField(0x00B4, "mds5_m");
-    addFieldScriptShop(0x00B4, 6, 1, 0x371, 5);
-    addFieldScriptShop(0x00B4, 6, 1, 0x38F, 5);
-    addFieldScriptShop(0x00B4, 6, 1, 0x3A5, 5);
-    addFieldScriptShop(0x00B4, 6, 4, 0x43F, 5);
-    addFieldScriptShop(0x00B4, 6, 4, 0x45D, 5);
-    addFieldScriptShop(0x00B4, 6, 4, 0x473, 5);
-    addFieldModels(0x00B4, {1,4,6,0});
-    addField(0x00B2, "mds5_w");
-    addFieldScriptShop(0x00B2, 4, 1, 0x366, 3);
-    addFieldScriptShop(0x00B2, 4, 1, 0x384, 3);
-    addFieldScriptShop(0x00B2, 4, 1, 0x39A, 3);
-    addFieldScriptShop(0x00B2, 7, 4, 0x4A3, 3);
-    addFieldScriptShop(0x00B2, 7, 4, 0x4C1, 3);
-    addFieldScriptShop(0x00B2, 7, 4, 0x4D7, 3);
-    addFieldModels(0x00B2, {1,4,6,0,0,0});
-    addField(0x00BF, "mds6_1");
-    addFieldModels(0x00BF, {1,3,4,6,0,0});
-    addFieldEncounters(0x00BF, 0x941C, {24956,22909,18812,0,0,0,0,0,8574,8575}, {});
-    addField(0x00C1, "mds6_22");
-    addFieldScriptMateria(0x00C1, 7, 1, 0xDFC, 37);
-    addFieldScriptMessage(0x00C1, 7, 1, 0, 0xE18, 0x16C4, 25);
-    addFieldModels(0x00C1, {1,3,4,6,0});
-    addField(0x00C0, "mds6_2");
-    addFieldModels(0x00C0, {1,2,0,1,2,0,0});
-    addField(0x00C2, "mds6_3");
-    addFieldModels(0x00C2, {1,4,6});
-    addField(0x0097, "mds7");
-    addFieldModels(0x0097, {1,3,4,0,0,0,0,0,0,0,0});
-    addField(0x0098, "mds7_im");
-    addFieldScriptShop(0x0098, 4, 1, 0x263, 2);
-    addFieldModels(0x0098, {1,0});
-    addField(0x009A, "mds7pb_1");
-    addFieldScriptMateria(0x009A, 18, 25, 0x12CF, 53);
-    addFieldModels(0x009A, {1,3,4,0,0,0,0,0,0,0,0,0});
-    addField(0x009B, "mds7pb_2");
-    addFieldScriptMateria(0x009B, 13, 10, 0x111F, 53);
-    addFieldModels(0x009B, {1,3,4,0,0,0,0,0,0,0});
-    addField(0x009C, "mds7plr1");
-    addFieldScriptShop(0x009C, 19, 1, 0x12BB, 9);
-    addFieldModels(0x009C, {1,2,3,4,0,0,0,0,0,0,0,0,0});
-    addField(0x009D, "mds7plr2");
-    addFieldModels(0x009D, {1,3,0,0,0,0});
-    addField(0x0090, "mds7st1");
-    addFieldScriptMessage(0x0090, 16, 1, 1, 0xAD1, 0xE1E, 21);
-    addFieldScriptItem(0x0090, 16, 1, 0xAD6, 1, 1);
-    addFieldScriptMessage(0x0090, 17, 1, 1, 0xB29, 0xE59, 23);
-    addFieldScriptItem(0x0090, 17, 1, 0xB2E, 12, 1);
-    addFieldScriptMessage(0x0090, 18, 1, 1, 0xB82, 0xE1E, 21);
-    addFieldScriptItem(0x0090, 18, 1, 0xB87, 1, 1);
-    addFieldScriptMessage(0x0090, 19, 1, 1, 0xBFA, 0xE46, 18);
-    addFieldScriptItem(0x0090, 19, 1, 0xBFF, 0, 1);
-    addFieldScriptMessage(0x0090, 20, 1, 1, 0xC72, 0xE46, 18);
-    addFieldScriptItem(0x0090, 20, 1, 0xC77, 0, 1);
-    addFieldModels(0x0090, {1,2,4,6,0,0,0,0,0,0});
-    addFieldEncounters(0x0090, 0x767C, {15756,14733,13709,12686,10639,0,0,0,0,0}, {18824,17801,15754,14731,0,0,0,0,0,0});
-    addField(0x0091, "mds7st2");
-    addFieldScriptMessage(0x0091, 20, 1, 1, 0x146E, 0x16AB, 17);
-    addFieldScriptItem(0x0091, 20, 1, 0x1473, 3, 1);
-    addFieldScriptMessage(0x0091, 21, 1, 1, 0x14C7, 0x16BD, 18);
-    addFieldScriptItem(0x0091, 21, 1, 0x14CC, 0, 1);
-    addFieldScriptMessage(0x0091, 22, 1, 1, 0x153F, 0x1695, 21);
-    addFieldScriptItem(0x0091, 22, 1, 0x1544, 1, 1);
-    addFieldModels(0x0091, {1,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0091, 0x8534, {15760,14737,13709,12686,10639,0,0,0,0,0}, {18824,17801,15754,14731,0,0,0,0,0,0});
-    addField(0x0093, "mds7st32");
-    addFieldModels(0x0093, {1,0,0,0,0,0,0,0,0});
-    addField(0x030D, "mds7st33");
-    addFieldModels(0x030D, {1,0,4,0,0});
-    addField(0x0092, "mds7st3");
-    addFieldModels(0x0092, {1,3,4,0,0,0,0,0,0,0,0,0});
-    addField(0x0094, "mds7_w1");
-    addFieldScriptShop(0x0094, 9, 1, 0x4D6, 0);
-    addFieldModels(0x0094, {1,0,0,0});
-    addField(0x0095, "mds7_w2");
-    addFieldScriptItem(0x0095, 9, 1, 0xA72, 0, 1);
-    addFieldScriptMateria(0x0095, 9, 1, 0xB0A, 53);
-    addFieldScriptMateria(0x0095, 9, 1, 0xB39, 23);
-    addFieldScriptMateria(0x0095, 9, 1, 0xB40, 52);
-    addFieldScriptMateria(0x0095, 9, 1, 0xB47, 53);
-    addFieldScriptMateria(0x0095, 14, 1, 0x135E, 23);
-    addFieldScriptMessage(0x0095, 14, 1, 3, 0x139F, 0x236A, 23);
-    addFieldScriptItem(0x0095, 15, 1, 0x14D4, 3, 1);
-    addFieldScriptMessage(0x0095, 15, 1, 2, 0x14E7, 0x23C8, 17);
-    addFieldModels(0x0095, {1,3,4,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0096, "mds7_w3");
-    addFieldModels(0x0096, {1,0});
-    addField(0x030E, "midgal");
-    addFieldModels(0x030E, {1,0,0,0,0,0,0,0});
-    addField(0x00C6, "mkt_ia");
-    addFieldScriptMessage(0x00C6, 4, 3, 1, 0x69B, 0xB13, 25);
-    addFieldScriptItem(0x00C6, 4, 3, 0x6A0, 159, 1);
-    addFieldScriptMessage(0x00C6, 5, 4, 1, 0x74E, 0xB13, 25);
-    addFieldScriptItem(0x00C6, 5, 4, 0x753, 159, 1);
-    addFieldModels(0x00C6, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x00C7, "mktinn");
-    addFieldModels(0x00C7, {1,2,0,2,0});
-    addField(0x00C8, "mkt_m");
-    addFieldScriptShop(0x00C8, 5, 1, 0x3A6, 7);
-    addFieldModels(0x00C8, {1,2,0,2,0});
-    addField(0x00C5, "mkt_mens");
-    addFieldModels(0x00C5, {1,2,0,2,0,0,0,0,0});
-    addField(0x00CC, "mktpb");
-    addFieldModels(0x00CC, {1,2,4,6,0,2,0,0,0,0,0,0});
-    addField(0x00C9, "mkt_s1");
-    addFieldModels(0x00C9, {1,2,0,0,0,0,0});
-    addField(0x00CA, "mkt_s2");
-    addFieldModels(0x00CA, {1,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x00CB, "mkt_s3");
-    addFieldScriptShop(0x00CB, 7, 3, 0x438, 8);
-    addFieldScriptShop(0x00CB, 7, 3, 0x4EA, 8);
-    addFieldScriptShop(0x00CB, 7, 4, 0x5EE, 8);
-    addFieldModels(0x00CB, {1,2,0,2,0});
-    addField(0x00C4, "mkt_w");
-    addFieldScriptMessage(0x00C4, 1, 1, 0, 0x390, 0xB2C, 23);
-    addFieldScriptItem(0x00C4, 1, 1, 0x395, 318, 1);
-    addFieldScriptMessage(0x00C4, 1, 1, 0, 0x3D9, 0xB2C, 23);
-    addFieldScriptItem(0x00C4, 1, 1, 0x3DE, 318, 1);
-    addFieldScriptShop(0x00C4, 8, 1, 0x4B3, 6);
-    addFieldScriptItem(0x00C4, 9, 1, 0x5E7, 85, 3);
-    addFieldScriptItem(0x00C4, 9, 1, 0x619, 85, 3);
-    addFieldModels(0x00C4, {1,2,4,6,0,2,0,0});
-    addField(0x01FC, "mogu_1");
-    addFieldModels(0x01FC, {1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x02A3, "move_d");
-    addFieldScriptMateria(0x02A3, 20, 1, 0x911, 33);
-    addFieldScriptMessage(0x02A3, 20, 1, 0, 0x92D, 0x1149, 29);
-    addFieldModels(0x02A3, {1,2,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x02A3, 0x8980, {18080,17057,16034,12963,4772,0,2725,2725,0,4774}, {});
-    addField(0x02A0, "move_f");
-    addFieldModels(0x02A0, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02A0, 0xA4AC, {18080,17057,16034,12963,4772,0,2725,2725,0,4774}, {});
-    addField(0x029F, "move_i");
-    addFieldModels(0x029F, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x029F, 0x8554, {16032,15009,13986,12963,10916,0,0,0,0,0}, {});
-    addField(0x02A1, "move_r");
-    addFieldModels(0x02A1, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02A1, 0x7A1C, {18080,17057,16034,12963,4772,0,2725,2725,0,4774}, {});
-    addField(0x029E, "move_s");
-    addFieldModels(0x029E, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x029E, 0x83D8, {16032,15009,13986,12963,10916,0,0,0,0,0}, {});
-    addField(0x02A2, "move_u");
-    addFieldModels(0x02A2, {1,2,3,4,5,6,7,8,9});
-    addFieldEncounters(0x02A2, 0x8BA8, {18080,17057,16034,12963,4772,0,2725,2725,0,4774}, {});
-    addField(0x00CD, "mrkt1");
-    addFieldModels(0x00CD, {1,2,4,6,0,0,0,0,0,0});
-    addField(0x00C3, "mrkt2");
-    addFieldModels(0x00C3, {1,2,0,0,0,0,0,0,0,0,0,0});
-    addField(0x00D6, "mrkt3");
-    addFieldModels(0x00D6, {1,2,4,6,0,0,0,0,0,0,0});
-    addField(0x00DE, "mrkt4");
-    addFieldModels(0x00DE, {1,3,4,0,0,0,0});
-    addField(0x01CA, "mtcrl_0");
-    addFieldWorldExit(0x01CA, 0x7054, 0, 0xE);
-    addFieldModels(0x01CA, {1,2,3,4,5,6,7,0});
-    addFieldEncounters(0x01CA, 0x7300, {25068,23021,18926,0,0,0,4591,4591,0,0}, {});
-    addField(0x01CB, "mtcrl_1");
-    addFieldModels(0x01CB, {1,4,6});
-    addFieldEncounters(0x01CB, 0x6E34, {25068,23021,18926,0,0,0,4591,4591,0,0}, {});
-    addField(0x01CC, "mtcrl_2");
-    addFieldScriptBattle(0x01CC, 12, 3, 0x83F, 813);
-    addFieldModels(0x01CC, {1,4,3,5,7,8,9,6,0,0,0,0});
-    addFieldEncounters(0x01CC, 0xB46C, {18928,17905,15858,14835,0,0,0,0,0,0}, {});
-    addField(0x01CD, "mtcrl_3");
-    addFieldModels(0x01CD, {1,4,6,0,0,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x01CD, 0x70D4, {18932,17909,15862,14839,0,0,0,0,0,0}, {});
-    addField(0x01CE, "mtcrl_4");
-    addFieldScriptItem(0x01CE, 29, 1, 0x1A5E, 168, 1);
-    addFieldScriptMessage(0x01CE, 29, 1, 2, 0x1A71, 0x1BD3, 25);
-    addFieldScriptMateria(0x01CE, 30, 1, 0x1AB0, 58);
-    addFieldScriptMessage(0x01CE, 30, 1, 2, 0x1AE4, 0x1BED, 29);
-    addFieldScriptItem(0x01CE, 31, 1, 0x1B3B, 4, 1);
-    addFieldScriptMessage(0x01CE, 31, 1, 2, 0x1B4E, 0x1C0B, 23);
-    addFieldModels(0x01CE, {1,4,6,0,0,0,0});
-    addFieldEncounters(0x01CE, 0x8600, {35320,31225,0,0,0,0,2554,2554,0,4603}, {});
-    addField(0x01CF, "mtcrl_5");
-    addFieldScriptItem(0x01CF, 5, 3, 0x6A8, 298, 1);
-    addFieldScriptMessage(0x01CF, 5, 3, 2, 0x6B7, 0x732, 23);
-    addFieldScriptItem(0x01CF, 6, 3, 0x70D, 196, 1);
-    addFieldScriptMessage(0x01CF, 6, 3, 2, 0x71C, 0x74A, 24);
-    addFieldModels(0x01CF, {1,0,0});
-    addField(0x01D0, "mtcrl_6");
-    addFieldModels(0x01D0, {1,2,3,4,5,7,6});
-    addFieldEncounters(0x01D0, 0x97AC, {25084,23037,18942,0,0,0,0,0,8703,0}, {});
-    addField(0x01D1, "mtcrl_7");
-    addFieldScriptItem(0x01D1, 8, 1, 0x439, 74, 1);
-    addFieldScriptMessage(0x01D1, 8, 1, 2, 0x44C, 0x73B, 23);
-    addFieldScriptItem(0x01D1, 9, 1, 0x49F, 71, 1);
-    addFieldScriptMessage(0x01D1, 9, 1, 2, 0x4B2, 0x753, 24);
-    addFieldScriptItem(0x01D1, 10, 1, 0x53D, 70, 1);
-    addFieldScriptMessage(0x01D1, 10, 1, 2, 0x550, 0x76C, 16);
-    addFieldModels(0x01D1, {1,4,6,0,0,0,0});
-    addField(0x01D2, "mtcrl_8");
-    addFieldScriptBattle(0x01D2, 5, 7, 0x5E6, 512);
-    addFieldScriptItem(0x01D2, 5, 7, 0x5F8, 7, 10);
-    addFieldScriptMessage(0x01D2, 5, 7, 2, 0x607, 0xAC2, 27);
-    addFieldModels(0x01D2, {1,2,3,4,5,6,7});
-    addField(0x01D3, "mtcrl_9");
-    addFieldModels(0x01D3, {1,2,3,4,5,6,7});
-    addFieldEncounters(0x01D3, 0x5F50, {35329,31234,0,0,0,0,0,0,0,12803}, {});
-    addField(0x0137, "mtnvl2");
-    addFieldScriptItem(0x0137, 19, 1, 0xE1D, 136, 1);
-    addFieldScriptMessage(0x0137, 19, 1, 0, 0xE2C, 0x1161, 22);
-    addFieldScriptItem(0x0137, 20, 1, 0xE81, 183, 1);
-    addFieldScriptMessage(0x0137, 20, 1, 0, 0xE90, 0x1178, 25);
-    addFieldWorldExit(0x0137, 0xD85C, 1, 0x2C);
-    addFieldModels(0x0137, {1,4,6,1,0,0,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0137, 0xDAF0, {19012,17989,15942,14919,0,0,0,0,0,0}, {19012,17989,15942,14919,0,0,0,0,0,0});
-    addField(0x0138, "mtnvl3");
-    addFieldModels(0x0138, {1,4,6,1,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0138, 0xB07C, {25160,23113,19018,0,0,0,0,0,0,8779}, {35400,31305,0,0,0,0,0,0,0,0});
-    addField(0x0139, "mtnvl4");
-    addFieldWorldExit(0x0139, 0xBC1C, 3, 0x2E);
-    addFieldModels(0x0139, {1,4,6,1,0,0,0});
-    addFieldEncounters(0x0139, 0xBE80, {19012,17989,15942,14919,0,0,0,0,0,0}, {19012,17989,15942,14919,0,0,0,0,0,0});
-    addField(0x013A, "mtnvl5");
-    addFieldModels(0x013A, {1,4,6,1,0,0,0});
-    addFieldEncounters(0x013A, 0xAB28, {15948,14925,13902,12879,10832,0,0,0,0,0}, {25164,23117,19022,0,0,0,0,0,0,0});
-    addField(0x013C, "mtnvl6b");
-    addFieldModels(0x013C, {1,4,6,1,0,0,0});
-    addFieldEncounters(0x013C, 0x7810, {15948,14925,13902,12879,10832,0,2641,2641,0,4690}, {25164,23117,19022,0,0,0,0,0,0,0});
-    addField(0x013B, "mtnvl6");
-    addFieldModels(0x013B, {1,4,6,1});
-    addFieldEncounters(0x013B, 0xA818, {15948,14925,13902,12879,10832,0,4689,4689,0,0}, {25164,23117,19022,0,0,0,0,0,0,0});
-    addField(0x01C5, "ncoin1");
-    addFieldScriptMessage(0x01C5, 3, 1, 0, 0x313, 0x634, 17);
-    addFieldScriptItem(0x01C5, 3, 1, 0x316, 3, 1);
-    addFieldModels(0x01C5, {1,4,6,0,0});
-    addField(0x01C6, "ncoin2");
-    addFieldScriptMateria(0x01C6, 8, 1, 0x403, 72);
-    addFieldScriptMessage(0x01C6, 8, 1, 0, 0x42A, 0x783, 26);
-    addFieldModels(0x01C6, {1,4,6,0,0,0});
-    addField(0x01C7, "ncoin3");
-    addFieldScriptMessage(0x01C7, 11, 1, 0, 0x6A3, 0xA7D, 23);
-    addFieldScriptItem(0x01C7, 11, 1, 0x6A6, 88, 1);
-    addFieldModels(0x01C7, {1,3,4,6,0,0,0,0,0});
-    addField(0x01C8, "ncoinn");
-    addFieldModels(0x01C8, {1,3,4,5,6,7,8,9,0,0});
-    addField(0x01C3, "ncorel2");
-    addFieldScriptMateria(0x01C3, 2, 4, 0x7DE, 72);
-    addFieldScriptMessage(0x01C3, 2, 4, 0, 0x7FB, 0x147D, 26);
-    addFieldScriptShop(0x01C3, 3, 4, 0x85E, 29);
-    addFieldWorldExit(0x01C3, 0x7640, 4, 0xF);
-    addFieldModels(0x01C3, {1,3,4,5,6,7,8,9,0,0,0,0,0,0,0});
-    addField(0x01C4, "ncorel3");
-    addFieldScriptMateria(0x01C4, 24, 4, 0xCEF, 72);
-    addFieldScriptMessage(0x01C4, 24, 4, 0, 0xD16, 0x11F8, 26);
-    addFieldWorldExit(0x01C4, 0x75B4, 5, 0xF);
-    addFieldModels(0x01C4, {1,3,5,6,7,8,9,0,0,0,0,0,0,0,0});
-    addField(0x01C2, "ncorel");
-    addFieldScriptShop(0x01C2, 5, 4, 0xA6A, 29);
-    addFieldScriptShop(0x01C2, 6, 4, 0xA98, 30);
-    addFieldScriptShop(0x01C2, 21, 9, 0x122B, 31);
-    addFieldWorldExit(0x01C2, 0x88E0, 5, 0xF);
-    addFieldModels(0x01C2, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0});
-    addField(0x0114, "niv_cl");
-    addFieldModels(0x0114, {1,1,4,6,0,0});
-    addField(0x0118, "nivgate2");
-    addFieldModels(0x0118, {1,4,0,0,0,1,0,0,0});
-    addField(0x0310, "nivgate4");
-    addFieldModels(0x0310, {0,0});
-    addField(0x0117, "nivgate");
-    addFieldModels(0x0117, {1,4,3,5,7,8,9,6,0,0,0,1,0,0});
-    addField(0x0111, "nivinn_1");
-    addFieldScriptItem(0x0111, 20, 1, 0xDA5, 76, 1);
-    addFieldModels(0x0111, {1,1,4,2,3,5,7,8,9,6,0,0,0,0});
-    addField(0x0112, "nivinn_2");
-    addFieldModels(0x0112, {1,1,4,6,0,0,0});
-    addField(0x011B, "nivl_2");
-    addFieldModels(0x011B, {1,4});
-    addField(0x011C, "nivl_3");
-    addFieldScriptItem(0x011C, 17, 1, 0xB3B, 74, 1);
-    addFieldWorldExit(0x011C, 0x721C, 6, 0x13);
-    addFieldWorldExit(0x011C, 0x7234, 7, 0x2B);
-    addFieldModels(0x011C, {1,4,2,3,5,7,8,9,6,0,0,0,0});
-    addField(0x0123, "nivl_b12");
-    addFieldModels(0x0123, {1,0,0,0,0,0});
-    addField(0x0122, "nivl_b1");
-    addFieldModels(0x0122, {1,0,0,0,0,0});
-    addField(0x0125, "nivl_b22");
-    addFieldModels(0x0125, {1,4,3,5,7,8,9,6,0,0,0});
-    addField(0x0124, "nivl_b2");
-    addFieldModels(0x0124, {1,0,0,0,0,0,0});
-    addField(0x011A, "nivl");
-    addFieldModels(0x011A, {1,1,0,0,0,0,0,0,0});
-    addField(0x0126, "nivl_e1");
-    addFieldModels(0x0126, {1,4,0,0});
-    addField(0x0127, "nivl_e2");
-    addFieldModels(0x0127, {1,4,0,0});
-    addField(0x0128, "nivl_e3");
-    addFieldModels(0x0128, {1});
-    addField(0x011E, "niv_ti1");
-    addFieldScriptItem(0x011E, 17, 1, 0x840, 4, 1);
-    addFieldModels(0x011E, {1,1,4,2,3,5,7,8,9,6,0,0});
-    addField(0x011F, "niv_ti2");
-    addFieldScriptMateria(0x011F, 17, 1, 0xA45, 29);
-    addFieldScriptMessage(0x011F, 17, 1, 0, 0xA6B, 0x1A87, 28);
-    addFieldScriptMessage(0x011F, 17, 1, 0, 0xC14, 0x2356, 23);
-    addFieldScriptItem(0x011F, 17, 1, 0xC1B, 89, 1);
-    addFieldScriptItem(0x011F, 21, 1, 0x1053, 153, 1);
-    addFieldModels(0x011F, {1,1,4,2,3,5,7,8,9,6,0});
-    addField(0x0120, "niv_ti3");
-    addFieldModels(0x0120, {1,4,0,0,0,0,0});
-    addField(0x0121, "niv_ti4");
-    addFieldModels(0x0121, {1,1,4,0,0,0,0,0});
-    addField(0x010E, "niv_w");
-    addFieldScriptShop(0x010E, 11, 1, 0x67F, 40);
-    addFieldScriptMessage(0x010E, 13, 1, 1, 0x817, 0xC40, 17);
-    addFieldScriptItem(0x010E, 13, 1, 0x81A, 5, 1);
-    addFieldModels(0x010E, {1,1,4,6,0,0,0,0});
-    addField(0x0078, "nmkin_1");
-    addFieldScriptMessage(0x0078, 11, 1, 0, 0xBCD, 0xE05, 24);
-    addFieldScriptItem(0x0078, 11, 1, 0xBD0, 7, 1);
-    addFieldModels(0x0078, {1,3,0,0,0,0,0,0,0});
-    addFieldEncounters(0x0078, 0x8E68, {18742,17719,15672,14649,0,0,0,0,0,0}, {});
-    addField(0x007A, "nmkin_2");
-    addFieldModels(0x007A, {1,0});
-    addFieldEncounters(0x007A, 0xA610, {14644,12597,11574,10551,9528,8505,4410,4411,0,0}, {});
-    addField(0x007B, "nmkin_3");
-    addFieldScriptMessage(0x007B, 5, 1, 0, 0x8B9, 0xB35, 18);
-    addFieldScriptItem(0x007B, 5, 1, 0x8BC, 0, 1);
-    addFieldModels(0x007B, {1,0,0});
-    addFieldEncounters(0x007B, 0xA184, {24892,22845,18750,0,0,0,4415,4415,0,0}, {});
-    addField(0x007C, "nmkin_4");
-    addFieldModels(0x007C, {1,0});
-    addFieldEncounters(0x007C, 0x93B0, {24896,22849,18754,0,0,0,4419,4419,0,0}, {});
-    addField(0x007D, "nmkin_5");
-    addFieldScriptMessage(0x007D, 3, 3, 0, 0x50E, 0xB0F, 27);
-    addFieldScriptMateria(0x007D, 3, 3, 0x511, 53);
-    addFieldScriptBattle(0x007D, 3, 6, 0x63D, 324);
-    addFieldModels(0x007D, {1,3,4,0});
-    addField(0x0077, "nrthmk");
-    addFieldModels(0x0077, {1,3,0,0,0});
-    addFieldEncounters(0x0077, 0x63F0, {18737,17714,15667,14643,0,0,0,0,0,0}, {});
-    addField(0x013D, "nvdun1");
-    addFieldScriptItem(0x013D, 19, 1, 0x1224, 156, 1);
-    addFieldScriptMessage(0x013D, 19, 1, 0, 0x1233, 0x180B, 21);
-    addFieldScriptMateria(0x013D, 20, 1, 0x128D, 23);
-    addFieldScriptMessage(0x013D, 20, 1, 0, 0x12D4, 0x1821, 23);
-    addFieldScriptBattle(0x013D, 21, 1, 0x1313, 595);
-    addFieldScriptMateria(0x013D, 22, 1, 0x1363, 13);
-    addFieldScriptMessage(0x013D, 22, 1, 0, 0x137F, 0x17EF, 27);
-    addFieldModels(0x013D, {1,4,6,1,0,0,0,0,0});
-    addFieldEncounters(0x013D, 0xD220, {19028,18005,15958,14935,0,0,0,0,0,0}, {});
-    addField(0x013E, "nvdun2");
-    addFieldScriptItem(0x013E, 9, 1, 0x569, 5, 1);
-    addFieldScriptMessage(0x013E, 9, 1, 0, 0x578, 0x8FF, 18);
-    addFieldModels(0x013E, {1,4,6,1,0,0,0,0});
-    addFieldEncounters(0x013E, 0x8F94, {19028,18005,15958,14935,0,0,0,0,0,0}, {25172,23125,19030,0,0,0,0,0,0,0});
-    addField(0x0140, "nvdun31");
-    addFieldModels(0x0140, {1,4,6,1,0,0});
-    addField(0x013F, "nvdun3");
-    addFieldScriptMateria(0x013F, 9, 1, 0x7E1, 29);
-    addFieldScriptMessage(0x013F, 9, 1, 0, 0x7FD, 0xD37, 29);
-    addFieldModels(0x013F, {1,4,6,1,0,0,0,0,0});
-    addField(0x0141, "nvdun4");
-    addFieldScriptItem(0x0141, 5, 1, 0x2E4, 251, 1);
-    addFieldScriptMessage(0x0141, 5, 1, 0, 0x2F3, 0x641, 21);
-    addFieldModels(0x0141, {1,4,6,1,0});
-    addFieldEncounters(0x0141, 0xA790, {19028,18005,15958,14935,0,0,0,0,0,0}, {25172,23125,19030,0,0,0,0,0,0,0});
-    addField(0x010F, "nvmin1_1");
-    addFieldModels(0x010F, {1,1,4,2,3,5,7,8,9,6,0,0,0});
-    addField(0x0110, "nvmin1_2");
-    addFieldScriptItem(0x0110, 6, 1, 0x36B, 76, 1);
-    addFieldModels(0x0110, {1,1,4,6,0,0});
-    addField(0x0142, "nvmkin1");
-    addFieldModels(0x0142, {1,4,6,1,0,0,0,0,0,0});
-    addField(0x0143, "nvmkin21");
-    addFieldModels(0x0143, {1,4,6,1,0,0,0,0});
-    addField(0x0144, "nvmkin22");
-    addFieldModels(0x0144, {1,4,6,1,0,0,0,0,0,0,0});
-    addField(0x0145, "nvmkin23");
-    addFieldModels(0x0145, {1});
-    addField(0x0146, "nvmkin31");
-    addFieldModels(0x0146, {1,0});
-    addField(0x0147, "nvmkin32");
-    addFieldModels(0x0147, {0,0,0,0,0,0});
-    addField(0x00D8, "onna_2");
-    addFieldModels(0x00D8, {1,0,0,0});
-    addField(0x00DA, "onna_4");
-    addFieldModels(0x00DA, {1,0,0});
-    addField(0x00DC, "onna_52");
-    addFieldModels(0x00DC, {1,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x00DB, "onna_5");
-    addFieldModels(0x00DB, {1,8,0,0,0,0,0,0,0});
-    addField(0x009E, "pillar_1");
-    addFieldModels(0x009E, {1,0});
-    addFieldEncounters(0x009E, 0x8E98, {24980,22933,18838,0,0,0,4503,4503,0,0}, {});
-    addField(0x009F, "pillar_2");
-    addFieldModels(0x009F, {1,4,3,0,0});
-    addFieldEncounters(0x009F, 0xA68C, {24980,22933,18838,0,0,0,3479,3479,0,6552}, {});
-    addField(0x00A0, "pillar_3");
-    addFieldScriptBattle(0x00A0, 4, 4, 0x8B7, 412);
-    addFieldModels(0x00A0, {1,1,3,4,0,0,0,2,0});
-    addField(0x01AF, "prisila");
-    addFieldScriptMateria(0x01AF, 12, 1, 0x88F, 75);
-    addFieldScriptMessage(0x01AF, 12, 1, 0, 0x8AB, 0xC56, 25);
-    addFieldModels(0x01AF, {1,4,6,0,0});
-    addField(0x015D, "psdun_1");
-    addFieldWorldExit(0x015D, 0x6964, 2, 0x5);
-    addFieldModels(0x015D, {1,3,4,2,5,6,0,0,0});
-    addFieldEncounters(0x015D, 0x6BE0, {25048,23001,18906,0,0,0,4571,4571,0,0}, {});
-    addField(0x015E, "psdun_2");
-    addFieldScriptMessage(0x015E, 8, 1, 1, 0x47C, 0x5A1, 23);
-    addFieldScriptItem(0x015E, 8, 1, 0x47F, 74, 1);
-    addFieldWorldExit(0x015E, 0x722C, 2, 0x4);
-    addFieldModels(0x015E, {1,3,4,2,5,6,0});
-    addFieldEncounters(0x015E, 0x74A8, {25048,23001,18906,0,0,0,4571,4571,0,0}, {});
-    addField(0x015F, "psdun_3");
-    addFieldScriptMessage(0x015F, 6, 1, 0, 0x452, 0x621, 17);
-    addFieldScriptItem(0x015F, 6, 1, 0x455, 3, 1);
-    addFieldScriptMateria(0x015F, 7, 1, 0x498, 11);
-    addFieldScriptMessage(0x015F, 7, 1, 0, 0x4B8, 0x602, 30);
-    addFieldScriptMessage(0x015F, 8, 1, 1, 0x54B, 0x5F1, 16);
-    addFieldScriptItem(0x015F, 8, 1, 0x54E, 70, 1);
-    addFieldModels(0x015F, {1,4,6,0,0,0});
-    addFieldEncounters(0x015F, 0x87D8, {25052,23005,18910,0,0,0,0,0,8663,0}, {});
-    addField(0x0160, "psdun_4");
-    addFieldScriptMessage(0x0160, 6, 1, 0, 0x3D8, 0x4F1, 21);
-    addFieldScriptItem(0x0160, 6, 1, 0x3DB, 1, 1);
-    addFieldScriptMessage(0x0160, 7, 1, 0, 0x461, 0x59E, 18);
-    addFieldScriptItem(0x0160, 7, 1, 0x464, 5, 1);
-    addFieldModels(0x0160, {1,4,6,0,0});
-    addFieldEncounters(0x0160, 0x83D0, {18908,17885,15838,14815,0,0,0,0,0,0}, {});
-    addField(0x0058, "q_1");
-    addFieldScriptMessage(0x0058, 11, 1, 0, 0x876, 0x9A5, 26);
-    addFieldScriptItem(0x0058, 11, 1, 0x879, 141, 1);
-    addFieldModels(0x0058, {1,0,0});
-    addField(0x0059, "q_2");
-    addFieldScriptBattle(0x0059, 6, 5, 0x491, 807);
-    addFieldModels(0x0059, {1,0,0});
-    addFieldEncounters(0x0059, 0x861C, {25372,23325,19230,0,0,0,0,0,0,8991}, {});
-    addField(0x005A, "q_3");
-    addFieldScriptMateria(0x005A, 8, 1, 0x54B, 15);
-    addFieldScriptMessage(0x005A, 8, 1, 0, 0x574, 0x901, 30);
-    addFieldScriptMessage(0x005A, 9, 1, 0, 0x62C, 0x888, 24);
-    addFieldScriptItem(0x005A, 9, 1, 0x62F, 283, 1);
-    addFieldScriptMessage(0x005A, 10, 1, 0, 0x6DA, 0x8EB, 21);
-    addFieldScriptItem(0x005A, 10, 1, 0x6DD, 6, 1);
-    addFieldScriptMessage(0x005A, 11, 1, 0, 0x772, 0x8BC, 21);
-    addFieldScriptItem(0x005A, 11, 1, 0x775, 228, 1);
-    addFieldModels(0x005A, {1,0,0,0,0});
-    addFieldEncounters(0x005A, 0x63B0, {25376,23329,19234,0,0,0,4899,4899,0,0}, {});
-    addField(0x005B, "q_4");
-    addFieldScriptMateria(0x005B, 9, 1, 0x77D, 86);
-    addFieldScriptMessage(0x005B, 9, 1, 0, 0x7A6, 0xACC, 25);
-    addFieldScriptMessage(0x005B, 10, 1, 0, 0x851, 0xB23, 20);
-    addFieldScriptItem(0x005B, 10, 1, 0x854, 253, 1);
-    addFieldScriptMessage(0x005B, 11, 1, 0, 0x8EC, 0xB82, 24);
-    addFieldScriptItem(0x005B, 11, 1, 0x8EF, 213, 1);
-    addFieldScriptMessage(0x005B, 12, 1, 0, 0x987, 0xB9B, 21);
-    addFieldScriptItem(0x005B, 12, 1, 0x98A, 6, 1);
-    addFieldScriptMessage(0x005B, 13, 1, 0, 0xA22, 0xBD0, 20);
-    addFieldScriptItem(0x005B, 13, 1, 0xA25, 94, 1);
-    addFieldModels(0x005B, {1,0,0,0,0,0});
-    addFieldEncounters(0x005B, 0x7924, {19236,18208,16161,15138,0,0,0,0,0,0}, {});
-    addField(0x0227, "rckt2");
-    addFieldScriptMessage(0x0227, 13, 1, 0, 0x6F1, 0x9AA, 24);
-    addFieldScriptItem(0x0227, 13, 1, 0x6F4, 214, 1);
-    addFieldWorldExit(0x0227, 0x9398, 6, 0x14);
-    addFieldModels(0x0227, {1,4,6,0,0,0});
-    addField(0x0306, "rckt32");
-    addFieldScriptBattle(0x0306, 14, 3, 0xCE5, 600);
-    addFieldModels(0x0306, {1,4,6,3,2,5,8,9,7,0,0,0});
-    addField(0x0228, "rckt3");
-    addFieldModels(0x0228, {1,4,3,2,5,8,9,7,0});
-    addField(0x0231, "rcktbas1");
-    addFieldScriptBattle(0x0231, 11, 4, 0x9DC, 816);
-    addFieldScriptBattle(0x0231, 11, 4, 0xA5A, 817);
-    addFieldScriptBattle(0x0231, 14, 4, 0xD94, 816);
-    addFieldModels(0x0231, {1,4,6,0,0,0,0,0,0,0,0,0});
-    addField(0x0232, "rcktbas2");
-    addFieldScriptBattle(0x0232, 10, 3, 0x818, 818);
-    addFieldModels(0x0232, {1,4,6,0,0,0});
-    addField(0x022D, "rckt");
-    addFieldScriptMessage(0x022D, 15, 1, 0, 0xD5E, 0x110C, 21);
-    addFieldScriptItem(0x022D, 15, 1, 0xD61, 139, 1);
-    addFieldScriptMessage(0x022D, 15, 1, 0, 0xE63, 0x110C, 21);
-    addFieldScriptItem(0x022D, 15, 1, 0xE66, 139, 1);
-    addFieldWorldExit(0x022D, 0x9430, 7, 0x14);
-    addFieldModels(0x022D, {1,4,6,0,0,0,0,0,0});
-    addField(0x0233, "rcktin1");
-    addFieldModels(0x0233, {1});
-    addField(0x0234, "rcktin2");
-    addFieldScriptBattle(0x0234, 14, 0, 0xE00, 819);
-    addFieldModels(0x0234, {1,6,0,0,0,0,0,0,0});
-    addField(0x0235, "rcktin3");
-    addFieldModels(0x0235, {1,0});
-    addField(0x0236, "rcktin4");
-    addFieldModels(0x0236, {1,6,0});
-    addField(0x0237, "rcktin5");
-    addFieldModels(0x0237, {1,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x0238, "rcktin6");
-    addFieldModels(0x0238, {1,3,4,5,6,7,8,9,0,0,0});
-    addField(0x0239, "rcktin7");
-    addFieldModels(0x0239, {1,3,4,5,6,7,8,9,0});
-    addField(0x023A, "rcktin8");
-    addFieldModels(0x023A, {1});
-    addField(0x022A, "rkt_i");
-    addFieldScriptShop(0x022A, 15, 1, 0x787, 64);
-    addFieldScriptShop(0x022A, 15, 1, 0x78D, 42);
-    addFieldScriptMessage(0x022A, 17, 1, 0, 0x8ED, 0xBE3, 24);
-    addFieldScriptItem(0x022A, 17, 1, 0x8F4, 72, 1);
-    addFieldModels(0x022A, {1,4,6,0,0,0});
-    addField(0x022B, "rktinn1");
-    addFieldModels(0x022B, {1,4,6,0,0,0,0,0});
-    addField(0x022C, "rktinn2");
-    addFieldModels(0x022C, {1,4,6});
-    addField(0x022F, "rktmin1");
-    addFieldModels(0x022F, {1,4,6,0,0});
-    addField(0x0230, "rktmin2");
-    addFieldScriptMessage(0x0230, 18, 1, 0, 0xA3F, 0xCCF, 24);
-    addFieldScriptItem(0x0230, 18, 1, 0xA42, 71, 1);
-    addFieldModels(0x0230, {1,3,4,5,6,7,8,9,0,0});
-    addField(0x022E, "rktsid");
-    addFieldScriptMessage(0x022E, 25, 1, 0, 0x16AD, 0x1915, 21);
-    addFieldScriptItem(0x022E, 25, 1, 0x16B4, 169, 1);
-    addFieldModels(0x022E, {1,3,4,2,5,6,7,8,9,0,0,0});
-    addField(0x0229, "rkt_w");
-    addFieldScriptShop(0x0229, 16, 1, 0x73F, 63);
-    addFieldScriptShop(0x0229, 16, 1, 0x745, 41);
-    addFieldScriptMessage(0x0229, 17, 1, 0, 0x7DD, 0xAB7, 27);
-    addFieldScriptItem(0x0229, 17, 1, 0x7E4, 273, 1);
-    addFieldModels(0x0229, {1,4,6,0,0});
-    addField(0x00E2, "roadend");
-    addFieldModels(0x00E2, {1,3,4,2,5});
-    addField(0x008F, "rootmap");
-    addFieldModels(0x008F, {0,0});
-    addField(0x01C9, "ropest");
-    addFieldModels(0x01C9, {1,2,3,4,5,6,7,0,0,0});
-    addField(0x0274, "sandun_1");
-    addFieldScriptMessage(0x0274, 22, 1, 0, 0x27A1, 0x2C62, 23);
-    addFieldScriptItem(0x0274, 22, 1, 0x27A4, 280, 1);
-    addFieldScriptMessage(0x0274, 23, 1, 0, 0x2825, 0x2C7A, 22);
-    addFieldScriptItem(0x0274, 23, 1, 0x2828, 319, 1);
-    addFieldScriptMateria(0x0274, 24, 1, 0x285D, 3);
-    addFieldScriptMessage(0x0274, 24, 1, 0, 0x287F, 0x2C43, 30);
-    addFieldScriptMessage(0x0274, 25, 1, 0, 0x290B, 0x2C91, 21);
-    addFieldScriptItem(0x0274, 25, 1, 0x290E, 6, 1);
-    addFieldModels(0x0274, {1,4,6,0,0,0,0});
-    addFieldEncounters(0x0274, 0xB92C, {16024,15004,13981,12953,10906,0,2715,2715,0,4766}, {});
-    addField(0x0275, "sandun_2");
-    addFieldScriptItem(0x0275, 4, 1, 0x215, 71, 1);
-    addFieldScriptMessage(0x0275, 4, 1, 0, 0x224, 0x564, 24);
-    addFieldWorldExit(0x0275, 0x627C, 1, 0x1A);
-    addFieldModels(0x0275, {1,4,6,0});
-    addFieldEncounters(0x0275, 0x6510, {16024,15004,13981,12953,10906,0,2715,2715,0,4766}, {});
-    addField(0x0271, "sango1");
-    addFieldScriptMessage(0x0271, 4, 1, 0, 0x223, 0x57D, 22);
-    addFieldScriptItem(0x0271, 4, 1, 0x226, 317, 1);
-    addFieldModels(0x0271, {1,4,6,0});
-    addFieldEncounters(0x0271, 0x9CDC, {25232,23185,19090,0,0,0,0,0,0,0}, {});
-    addField(0x0272, "sango2");
-    addFieldWorldExit(0x0272, 0x648C, 0, 0x39);
-    addFieldModels(0x0272, {1,4,6});
-    addFieldEncounters(0x0272, 0x6738, {35475,31379,0,0,0,0,0,0,0,0}, {});
-    addField(0x0273, "sango3");
-    addFieldScriptItem(0x0273, 9, 1, 0xB8C, 206, 1);
-    addFieldScriptMessage(0x0273, 9, 1, 0, 0xB9B, 0xD94, 25);
-    addFieldModels(0x0273, {1,4,6,0});
-    addFieldEncounters(0x0273, 0x92FC, {25236,23189,19094,0,0,0,4759,4759,0,0}, {});
-    addField(0x0056, "sea");
-    addFieldModels(0x0056, {1,4,6,3,2,5,8,9,7});
-    addField(0x01A4, "semkin_1");
-    addFieldModels(0x01A4, {1,0});
-    addField(0x01A5, "semkin_2");
-    addFieldModels(0x01A5, {1,0});
-    addFieldEncounters(0x01A5, 0x9818, {19204,18181,16134,15112,0,0,4871,4871,0,0}, {});
-    addField(0x01A7, "semkin_3");
-    addFieldScriptBattle(0x01A7, 8, 2, 0x599, 768);
-    addFieldScriptBattle(0x01A7, 9, 3, 0x60A, 771);
-    addFieldScriptBattle(0x01A7, 10, 3, 0x667, 769);
-    addFieldScriptBattle(0x01A7, 10, 3, 0x694, 770);
-    addFieldModels(0x01A7, {1,0,0,0,0,0});
-    addField(0x01A8, "semkin_4");
-    addFieldModels(0x01A8, {1,3,4,5,7,8,9,6,0,0});
-    addFieldEncounters(0x01A8, 0xAC38, {19208,18185,16132,15109,0,0,4874,4871,0,0}, {});
-    addField(0x01A9, "semkin_5");
-    addFieldScriptBattle(0x01A9, 3, 3, 0x8C1, 780);
-    addFieldModels(0x01A9, {1,3,4,5,7,8,9,6,0,0,0,0,0});
-    addField(0x01AA, "semkin_6");
-    addFieldScriptMessage(0x01AA, 15, 1, 0, 0xA83, 0x277C, 27);
-    addFieldScriptItem(0x01AA, 15, 1, 0xA8A, 239, 1);
-    addFieldModels(0x01AA, {1,3,4,5,7,8,9,6,0,0,0,0,0});
-    addField(0x01AB, "semkin_7");
-    addFieldScriptBattle(0x01AB, 4, 3, 0x517, 769);
-    addFieldScriptBattle(0x01AB, 8, 1, 0x653, 769);
-    addFieldScriptMessage(0x01AB, 9, 1, 0, 0x6FF, 0x2476, 21);
-    addFieldScriptItem(0x01AB, 9, 1, 0x706, 211, 1);
-    addFieldModels(0x01AB, {1,0,0,0,0,0,0});
-    addField(0x01A6, "semkin_8");
-    addFieldModels(0x01A6, {1,0});
-    addFieldEncounters(0x01A6, 0x9A84, {19204,18181,16134,15112,0,0,4871,4871,0,0}, {});
-    addField(0x0226, "seto1");
-    addFieldScriptItem(0x0226, 8, 3, 0xC3F, 186, 1);
-    addFieldModels(0x0226, {1,2,3,4,5,8,7,0,0,0,0});
-    addField(0x01B4, "ship_1");
-    addFieldScriptShop(0x01B4, 16, 1, 0x1498, 25);
-    addFieldModels(0x01B4, {1,2,3,4,5,7,0,0,0,0,0,0,0,0});
-    addField(0x01B5, "ship_2");
-    addFieldModels(0x01B5, {1,0,0,0,0});
-    addField(0x01B6, "shpin_22");
-    addFieldModels(0x01B6, {1,2,3,4,5,6,7,8,9});
-    addField(0x01B7, "shpin_2");
-    addFieldScriptMateria(0x01B7, 15, 1, 0xAD8, 23);
-    addFieldScriptMessage(0x01B7, 15, 1, 0, 0xAFE, 0x122A, 23);
-    addFieldScriptMessage(0x01B7, 16, 1, 0, 0xB8A, 0x1242, 17);
-    addFieldScriptItem(0x01B7, 16, 1, 0xB8D, 3, 1);
-    addFieldModels(0x01B7, {1,2,3,4,5,7,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x01B7, 0x6A54, {25060,23013,18918,0,0,0,4583,4583,0,0}, {});
-    addField(0x01B8, "shpin_3");
-    addFieldScriptMessage(0x01B8, 14, 1, 0, 0x119C, 0x1694, 22);
-    addFieldScriptItem(0x01B8, 14, 1, 0x119F, 221, 1);
-    addFieldScriptBattle(0x01B8, 15, 5, 0x12BA, 488);
-    addFieldScriptMateria(0x01B8, 19, 1, 0x15D0, 76);
-    addFieldScriptMessage(0x01B8, 19, 1, 0, 0x15F2, 0x20B0, 25);
-    addFieldModels(0x01B8, {1,2,3,4,5,7,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x01B8, 0x8660, {25060,23013,18918,0,0,0,4583,4583,0,0}, {});
-    addField(0x015C, "sichi");
-    addFieldModels(0x015C, {1,2,3,4,5,7});
-    addField(0x00E3, "sinbil_1");
-    addFieldModels(0x00E3, {1,2,3,4,5,6,7,8,9,0});
-    addFieldEncounters(0x00E3, 0x5924, {24992,22945,18848,0,0,0,0,0,0,0}, {});
-    addField(0x00E4, "sinbil_2");
-    addFieldModels(0x00E4, {1,2,3,4,5,6,7,8,9});
-    addField(0x0129, "sinin1_1");
-    addFieldModels(0x0129, {1,4,6,1,0});
-    addFieldEncounters(0x0129, 0x7ED4, {25132,23085,18990,0,0,0,0,0,0,0}, {});
-    addField(0x012A, "sinin1_2");
-    addFieldScriptItem(0x012A, 6, 1, 0x5AB, 222, 1);
-    addFieldScriptMessage(0x012A, 6, 1, 0, 0x5D9, 0xAA3, 22);
-    addFieldScriptItem(0x012A, 7, 1, 0x639, 236, 1);
-    addFieldScriptMessage(0x012A, 7, 1, 0, 0x667, 0xABA, 28);
-    addFieldModels(0x012A, {1,4,6,1,0,0,0,0});
-    addFieldEncounters(0x012A, 0x7AD4, {25132,23085,18990,0,0,0,0,0,0,0}, {});
-    addField(0x012B, "sinin2_1");
-    addFieldScriptBattle(0x012B, 3, 3, 0x5FB, 576);
-    addFieldScriptBattle(0x012B, 4, 3, 0x7AA, 576);
-    addFieldScriptBattle(0x012B, 5, 3, 0x959, 576);
-    addFieldScriptItem(0x012B, 7, 1, 0xA33, 172, 1);
-    addFieldScriptMessage(0x012B, 7, 1, 0, 0xA61, 0xED2, 26);
-    addFieldScriptMateria(0x012B, 10, 1, 0xB51, 79);
-    addFieldScriptMessage(0x012B, 10, 1, 0, 0xB6D, 0xF97, 24);
-    addFieldModels(0x012B, {1,4,6,1,0,0,0});
-    addFieldEncounters(0x012B, 0xB14C, {18990,17968,15921,14898,0,0,2607,2607,0,4659}, {});
-    addField(0x012C, "sinin2_2");
-    addFieldScriptItem(0x012C, 6, 1, 0x4C4, 73, 1);
-    addFieldScriptMessage(0x012C, 6, 1, 0, 0x4F2, 0x793, 24);
-    addFieldModels(0x012C, {1,4,6,1,0,0});
-    addFieldEncounters(0x012C, 0x78FC, {18990,17968,15921,14898,0,0,2607,2607,0,4659}, {});
-    addField(0x012D, "sinin3");
-    addFieldModels(0x012D, {1,4,6,1});
-    addFieldEncounters(0x012D, 0x6868, {25134,23092,18997,0,0,0,2614,2614,0,4659}, {});
-    addField(0x012E, "sininb1");
-    addFieldModels(0x012E, {1,4,6,3,2,5,8,9,7,1});
-    addFieldEncounters(0x012E, 0x4C44, {15927,14904,13881,12860,10813,0,2618,2622,0,4667}, {});
-    addField(0x012F, "sininb2");
-    addFieldModels(0x012F, {1,4,6,1,9,3,2,5,8,7,0,0});
-    addFieldEncounters(0x012F, 0x7B8C, {15927,14904,13881,12860,10813,0,2618,2622,0,4667}, {});
-    addField(0x0130, "sininb31");
-    addFieldModels(0x0130, {1,0});
-    addField(0x0131, "sininb32");
-    addFieldModels(0x0131, {1,4,6,3,2,5,8,9,7});
-    addField(0x0132, "sininb33");
-    addFieldModels(0x0132, {0,0,0});
-    addField(0x030C, "sininb34");
-    addFieldModels(0x030C, {0,0,0,0});
-    addField(0x030F, "sininb35");
-    addFieldModels(0x030F, {0,0,0});
-    addField(0x0311, "sininb36");
-    addFieldModels(0x0311, {0,0});
-    addField(0x0133, "sininb41");
-    addFieldModels(0x0133, {1,0,0});
-    addField(0x0134, "sininb42");
-    addFieldScriptMateria(0x0134, 5, 1, 0x43C, 68);
-    addFieldScriptMessage(0x0134, 5, 1, 0, 0x458, 0x6D9, 28);
-    addFieldModels(0x0134, {1,4,6,0,0});
-    addField(0x0135, "sininb51");
-    addFieldModels(0x0135, {1,0});
-    addField(0x0136, "sininb52");
-    addFieldModels(0x0136, {1,4,6});
-    addField(0x0057, "sky");
-    addFieldModels(0x0057, {1,4,6,3,2,5,8,9,7});
-    addField(0x026A, "slfrst_1");
-    addFieldModels(0x026A, {1,4,6,2,0});
-    addField(0x026B, "slfrst_2");
-    addFieldScriptMessage(0x026B, 4, 1, 0, 0x2DB, 0x5AB, 27);
-    addFieldScriptMateria(0x026B, 4, 1, 0x2DE, 82);
-    addFieldModels(0x026B, {1,4,6,0});
-    addField(0x0080, "smkin_1");
-    addFieldScriptMessage(0x0080, 7, 1, 0, 0x5CC, 0xA0A, 17);
-    addFieldScriptItem(0x0080, 7, 1, 0x5CF, 3, 1);
-    addFieldModels(0x0080, {1,3,4,0,0,0,0});
-    addFieldEncounters(0x0080, 0x9310, {15704,14681,13658,12635,10588,0,2397,2398,0,4447}, {});
-    addField(0x0081, "smkin_2");
-    addFieldModels(0x0081, {1});
-    addFieldEncounters(0x0081, 0x9570, {18784,17761,15714,14691,0,0,0,0,0,0}, {});
-    addField(0x0082, "smkin_3");
-    addFieldModels(0x0082, {1});
-    addFieldEncounters(0x0082, 0x8858, {18784,17761,15714,14691,0,0,0,0,0,0}, {});
-    addField(0x0083, "smkin_4");
-    addFieldModels(0x0083, {1,0});
-    addFieldEncounters(0x0083, 0x94BC, {24932,22885,18790,0,0,0,4455,4455,0,0}, {});
-    addField(0x0084, "smkin_5");
-    addFieldScriptMessage(0x0084, 2, 3, 0, 0x439, 0xA46, 27);
-    addFieldScriptMateria(0x0084, 2, 3, 0x43C, 53);
-    addFieldScriptBattle(0x0084, 2, 6, 0x547, 324);
-    addFieldModels(0x0084, {1,3,4,0});
-    addFieldEncounters(0x0084, 0x9B70, {24932,22885,18790,0,0,0,4455,4455,0,0}, {});
-    addField(0x028B, "sninn_1");
-    addFieldModels(0x028B, {1,4,6,0,0,0,0,0,0});
-    addField(0x028C, "sninn_2");
-    addFieldScriptMessage(0x028C, 10, 1, 0, 0x472, 0x498, 20);
-    addFieldScriptItem(0x028C, 10, 1, 0x475, 2, 1);
-    addFieldModels(0x028C, {1,4,6,0});
-    addField(0x028D, "sninn_b1");
-    addFieldModels(0x028D, {1,4,6,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0291, "snmayor");
-    addFieldScriptMessage(0x0291, 30, 1, 0, 0x196D, 0x3103, 23);
-    addFieldScriptItem(0x0291, 30, 1, 0x1970, 4, 1);
-    addFieldModels(0x0291, {1,4,6,0,0,0,0,0,0,0,0});
-    addField(0x028F, "snmin1");
-    addFieldModels(0x028F, {1,4,6,0,0,0,0,0});
-    addField(0x0290, "snmin2");
-    addFieldScriptMessage(0x0290, 12, 1, 0, 0x73C, 0xC46, 22);
-    addFieldScriptItem(0x0290, 12, 1, 0x73F, 18, 1);
-    addFieldScriptMessage(0x0290, 13, 1, 0, 0x79A, 0xC5D, 19);
-    addFieldScriptItem(0x0290, 13, 1, 0x79D, 19, 1);
-    addFieldModels(0x0290, {1,4,6,0,0,0,0,0,0,0});
-    addField(0x028E, "snow");
-    addFieldWorldExit(0x028E, 0xC6A8, 0, 0x1B);
-    addFieldWorldExit(0x028E, 0xC6C0, 1, 0x1B);
-    addFieldModels(0x028E, {1,4,6,0,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x028A, "snw_w");
-    addFieldScriptShop(0x028A, 3, 1, 0x409, 46);
-    addFieldScriptShop(0x028A, 4, 1, 0x43F, 46);
-    addFieldScriptShop(0x028A, 5, 1, 0x491, 46);
-    addFieldScriptShop(0x028A, 6, 1, 0x4C1, 46);
-    addFieldModels(0x028A, {1,4,6,0,0,0});
-    addField(0x007E, "southmk1");
-    addFieldModels(0x007E, {1,3,4,0,0,0,0,0,0});
-    addField(0x007F, "southmk2");
-    addFieldScriptBattle(0x007F, 4, 10, 0x824, 364);
-    addFieldModels(0x007F, {1,3,4,0,0,0});
-    addField(0x01A1, "spgate");
-    addFieldModels(0x01A1, {1});
-    addField(0x01A2, "spipe_1");
-    addFieldModels(0x01A2, {1,0,0,0,0,0});
-    addFieldEncounters(0x01A2, 0xA31C, {25340,23293,19198,0,0,0,0,0,0,8959}, {});
-    addField(0x01A3, "spipe_2");
-    addFieldModels(0x01A3, {1,0,0,0,0,0,0});
-    addFieldEncounters(0x01A3, 0x9FEC, {25340,23293,19198,0,0,0,0,0,0,8959}, {});
-    addField(0x0041, "startmap");
-    addFieldScriptBattle(0x0041, 4, 1, 0x390, 999);
-    addFieldWorldExit(0x0041, 0x1CCC, 0, 0x1);
-    addFieldModels(0x0041, {1,4,6,7});
-    addField(0x0195, "subin_1a");
-    addFieldScriptBattle(0x0195, 5, 0, 0x905, 786);
-    addFieldModels(0x0195, {1,3,4,5,6,7,8,9,0,0,0,0,0,0});
-    addField(0x0196, "subin_1b");
-    addFieldScriptBattle(0x0196, 27, 6, 0x223C, 786);
-    addFieldModels(0x0196, {1,3,4,5,6,7,8,9,0,0,0});
-    addField(0x0197, "subin_2a");
-    addFieldScriptBattle(0x0197, 8, 7, 0x7D3, 784);
-    addFieldModels(0x0197, {1,3,4,5,6,7,8,9,0,0,0});
-    addField(0x0198, "subin_2b");
-    addFieldScriptBattle(0x0198, 4, 0, 0x7AF, 785);
-    addFieldModels(0x0198, {1,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x0199, "subin_3");
-    addFieldModels(0x0199, {1,3,4,5,6,7,8,9});
-    addField(0x008B, "tin_1");
-    addFieldScriptItem(0x008B, 39, 1, 0x2A37, 7, 1);
-    addFieldScriptMessage(0x008B, 39, 1, 2, 0x2A46, 0x4541, 24);
-    addFieldModels(0x008B, {1,3,4,0,0,0,0,0,0,0,0,0});
-    addField(0x008C, "tin_2");
-    addFieldScriptItem(0x008C, 30, 1, 0x134C, 1, 1);
-    addFieldScriptMessage(0x008C, 30, 1, 2, 0x136D, 0x19DC, 21);
-    addFieldModels(0x008C, {1,3,4,0,0,0,0,0,0,0,0,0});
-    addField(0x008D, "tin_3");
-    addFieldModels(0x008D, {1,3,4,0,0,0,0,0,0});
-    addField(0x008E, "tin_4");
-    addFieldModels(0x008E, {1,3,4,0,0,0,0,0,0,0,0,0});
-    addField(0x0116, "trackin2");
-    addFieldScriptBattle(0x0116, 5, 15, 0x6EC, 292);
-    addFieldModels(0x0116, {0,0,0,0,0});
-    addField(0x0115, "trackin");
-    addFieldScriptBattle(0x0115, 7, 17, 0x7F9, 292);
-    addFieldModels(0x0115, {1,1,0,0,0,0});
-    addField(0x02BE, "trnad_1");
-    addFieldModels(0x02BE, {1,3,4,5,6,7,8,9,0,0});
-    addField(0x02BF, "trnad_2");
-    addFieldScriptMateria(0x02BF, 23, 1, 0xAF6, 85);
-    addFieldScriptMessage(0x02BF, 23, 1, 0, 0xB0D, 0xBCA, 31);
-    addFieldModels(0x02BF, {0,1,3,4,5,6,7,8,9,0,0});
-    addField(0x02C0, "trnad_3");
-    addFieldScriptMessage(0x02C0, 22, 1, 0, 0xD15, 0xD50, 26);
-    addFieldScriptItem(0x02C0, 22, 1, 0xD18, 154, 1);
-    addFieldModels(0x02C0, {1,4,6,0,0,0,0,0,0,0,0,0,0,0,0,0});
-    addFieldEncounters(0x02C0, 0x7514, {19156,18133,16086,15063,0,0,4824,4824,0,0}, {});
-    addField(0x02C1, "trnad_4");
-    addFieldScriptBattle(0x02C1, 17, 2, 0x102A, 743);
-    addFieldScriptMessage(0x02C1, 29, 1, 0, 0x1659, 0x1AAA, 23);
-    addFieldScriptItem(0x02C1, 29, 1, 0x165C, 295, 1);
-    addFieldScriptMateria(0x02C1, 30, 1, 0x16A1, 26);
-    addFieldScriptMessage(0x02C1, 30, 1, 0, 0x16B8, 0x1AC2, 28);
-    addFieldModels(0x02C1, {0,1,3,4,5,6,7,8,9,0,0,0,0,0});
-    addFieldEncounters(0x02C1, 0xA160, {16090,15067,14044,13021,10976,0,2782,2782,0,4831}, {});
-    addField(0x02C2, "trnad_51");
-    addFieldModels(0x02C2, {1,4,3,5,7,8,9,6,0,0,0,0});
-    addFieldEncounters(0x02C2, 0x7F44, {19164,18145,16098,15075,0,0,0,0,0,0}, {});
-    addField(0x02C3, "trnad_52");
-    addFieldModels(0x02C3, {1,4,3,5,7,8,9,6,0,0,0});
-    addField(0x02C4, "trnad_53");
-    addFieldModels(0x02C4, {1,4,3,5,7,8,9,6,0,0,0});
-    addField(0x00A1, "tunnel_1");
-    addFieldModels(0x00A1, {1,3,4});
-    addFieldEncounters(0x00A1, 0x5AEC, {24908,22861,18766,0,0,0,4431,4431,0,0}, {});
-    addField(0x00A2, "tunnel_2");
-    addFieldModels(0x00A2, {1,3,4});
-    addField(0x00A3, "tunnel_3");
-    addFieldScriptBattle(0x00A3, 5, 3, 0x3AC, 367);
-    addFieldModels(0x00A3, {1,0,0});
-    addField(0x02E0, "tunnel_4");
-    addFieldScriptMateria(0x02E0, 19, 1, 0xCFC, 21);
-    addFieldScriptMessage(0x02E0, 19, 1, 0, 0xD18, 0x2A12, 19);
-    addFieldModels(0x02E0, {1,3,4,5,7,8,9,6,0,0});
-    addFieldEncounters(0x02E0, 0x9FCC, {19262,18239,16192,15169,0,0,4930,4931,0,0}, {});
-    addField(0x02E1, "tunnel_5");
-    addFieldScriptMessage(0x02E1, 16, 1, 0, 0xCE2, 0x2CE6, 25);
-    addFieldScriptItem(0x02E1, 16, 1, 0xCE9, 72, 1);
-    addFieldScriptMessage(0x02E1, 17, 1, 0, 0xD8E, 0x2CCC, 25);
-    addFieldScriptItem(0x02E1, 17, 1, 0xD95, 71, 1);
-    addFieldScriptMessage(0x02E1, 18, 1, 0, 0xE3A, 0x2C99, 25);
-    addFieldScriptItem(0x02E1, 18, 1, 0xE41, 73, 1);
-    addFieldScriptMessage(0x02E1, 19, 1, 0, 0xEE6, 0x2CB3, 24);
-    addFieldScriptItem(0x02E1, 19, 1, 0xEED, 74, 1);
-    addFieldModels(0x02E1, {1,7,6,5,0,0,0,0});
-    addFieldEncounters(0x02E1, 0x8294, {19262,18239,16192,15169,0,0,4930,4931,0,0}, {});
-    addField(0x030A, "tunnel_6");
-    addFieldScriptBattle(0x030A, 15, 0, 0xB46, 840);
-    addFieldScriptBattle(0x030A, 15, 0, 0xBCE, 840);
-    addFieldModels(0x030A, {1,3,4,5,7,8,9,6,0,0,0});
-    addFieldEncounters(0x030A, 0xBF00, {19262,18239,16192,15169,0,0,4930,4931,0,0}, {});
-    addField(0x01AC, "ujunon1");
-    addFieldScriptMessage(0x01AC, 6, 6, 0, 0x9D7, 0x2B6E, 25);
-    addFieldScriptMateria(0x01AC, 6, 6, 0x9DF, 75);
-    addFieldScriptMateria(0x01AC, 17, 8, 0x11AE, 75);
-    addFieldScriptMessage(0x01AC, 17, 8, 0, 0x11E5, 0x2B6E, 25);
-    addFieldWorldExit(0x01AC, 0xCA0C, 4, 0x7);
-    addFieldModels(0x01AC, {1,2,3,4,5,6,7,0,0,0,0,0,0,0,0});
-    addField(0x01AD, "ujunon2");
-    addFieldScriptBattle(0x01AD, 2, 0, 0x5BD, 480);
-    addFieldModels(0x01AD, {1,2,3,4,5,6,7,0,0,0});
-    addField(0x01AE, "ujunon3");
-    addFieldModels(0x01AE, {1,0,0});
-    addField(0x01B2, "ujunon4");
-    addFieldModels(0x01B2, {0,1,2,3,4,5,7,0,0,0});
-    addField(0x01B3, "ujunon5");
-    addFieldModels(0x01B3, {1,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x01B0, "ujun_w");
-    addFieldScriptShop(0x01B0, 2, 4, 0x268, 18);
-    addFieldModels(0x01B0, {1,4,6,0});
-    addField(0x0240, "uta_im");
-    addFieldScriptShop(0x0240, 5, 3, 0x422, 44);
-    addFieldScriptMessage(0x0240, 7, 1, 0, 0x537, 0x5DF, 29);
-    addFieldScriptMessage(0x0240, 7, 1, 0, 0x556, 0x5C4, 26);
-    addFieldModels(0x0240, {1,4,6,7,0,0,0});
-    addField(0x0244, "utapb");
-    addFieldScriptMessage(0x0244, 11, 1, 0, 0x81C, 0x1B3B, 24);
-    addFieldScriptItem(0x0244, 11, 1, 0x81F, 71, 1);
-    addFieldScriptMessage(0x0244, 11, 1, 0, 0x836, 0x1B54, 24);
-    addFieldScriptItem(0x0244, 11, 1, 0x839, 72, 1);
-    addFieldScriptMessage(0x0244, 11, 1, 0, 0x850, 0x1B6D, 24);
-    addFieldScriptItem(0x0244, 11, 1, 0x853, 73, 1);
-    addFieldScriptMessage(0x0244, 11, 1, 0, 0x86A, 0x1B86, 23);
-    addFieldScriptItem(0x0244, 11, 1, 0x86D, 74, 1);
-    addFieldScriptMessage(0x0244, 11, 1, 0, 0x884, 0x1B9E, 24);
-    addFieldScriptItem(0x0244, 11, 1, 0x887, 75, 1);
-    addFieldScriptMessage(0x0244, 11, 1, 0, 0x89E, 0x1BB7, 23);
-    addFieldScriptItem(0x0244, 11, 1, 0x8A1, 76, 1);
-    addFieldScriptMessage(0x0244, 11, 1, 0, 0x8B8, 0x1B25, 21);
-    addFieldScriptItem(0x0244, 11, 1, 0x8BB, 6, 1);
-    addFieldModels(0x0244, {1,2,3,4,5,6,8,9,0,0,0,0,0,0,0});
-    addField(0x023F, "uta_wa");
-    addFieldScriptShop(0x023F, 5, 3, 0x378, 43);
-    addFieldModels(0x023F, {1,4,6,7,0,0});
-    addField(0x0241, "utmin1");
-    addFieldModels(0x0241, {1,4,6,0,0,0,0,0,0,0,0,0,0,0});
-    addField(0x0242, "utmin2");
-    addFieldModels(0x0242, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x024C, "uttmpin1");
-    addFieldModels(0x024C, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x024D, "uttmpin2");
-    addFieldModels(0x024D, {1,4,6,7,0,0,0,0,0,0,0,0});
-    addField(0x024E, "uttmpin3");
-    addFieldScriptBattle(0x024E, 14, 0, 0x876, 622);
-    addFieldModels(0x024E, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0,0});
-    addField(0x024F, "uttmpin4");
-    addFieldScriptMessage(0x024F, 12, 1, 0, 0x80F, 0xA72, 22);
-    addFieldScriptItem(0x024F, 12, 1, 0x812, 35, 1);
-    addFieldScriptMessage(0x024F, 13, 1, 0, 0x895, 0xA89, 18);
-    addFieldScriptItem(0x024F, 13, 1, 0x898, 5, 1);
-    addFieldModels(0x024F, {1,4,6,7,0,0,0,0,0,0});
-    addField(0x0243, "uutai1");
-    addFieldWorldExit(0x0243, 0xB098, 8, 0x17);
-    addFieldWorldExit(0x0243, 0xB0B0, 9, 0x17);
-    addFieldModels(0x0243, {1,2,3,4,5,6,7,8,9,0,0,0,0,0,0});
-    addField(0x024B, "uutai2");
-    addFieldModels(0x024B, {1,2,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x00DF, "wcrimb_1");
-    addFieldModels(0x00DF, {1,0,0,0});
-    addField(0x00E0, "wcrimb_2");
-    addFieldScriptMessage(0x00E0, 13, 14, 1, 0x937, 0xB14, 17);
-    addFieldScriptItem(0x00E0, 13, 14, 0x93C, 3, 1);
-    addFieldModels(0x00E0, {1});
-    addField(0x0282, "white1");
-    addFieldModels(0x0282, {1,4,6,3,2,5,8,9,7,0});
-    addField(0x0283, "white2");
-    addFieldModels(0x0283, {1,4,6,3,2,5,8,9,7,0});
-    addField(0x0073, "whitebg3");
-    addFieldModels(0x0073, {1,4,6,1,0,0,0,0});
-    addField(0x0285, "whitein");
-    addFieldModels(0x0285, {1,4,6});
-    addField(0x02C5, "woa_1");
-    addFieldScriptBattle(0x02C5, 3, 0, 0x7A8, 729);
-    addFieldScriptMessage(0x02C5, 20, 1, 0, 0xAD7, 0xC10, 17);
-    addFieldScriptItem(0x02C5, 20, 1, 0xADA, 3, 1);
-    addFieldScriptMessage(0x02C5, 21, 1, 0, 0xB4D, 0xC22, 21);
-    addFieldScriptItem(0x02C5, 21, 1, 0xB50, 1, 1);
-    addFieldModels(0x02C5, {1,3,4,5,6,7,8,9,0,0,0,0});
-    addField(0x02C6, "woa_2");
-    addFieldScriptBattle(0x02C6, 0, 0, 0x4C9, 729);
-    addFieldModels(0x02C6, {1,3,4,5,6,7,8,9});
-    addField(0x02C7, "woa_3");
-    addFieldScriptBattle(0x02C7, 5, 0, 0x962, 729);
-    addFieldModels(0x02C7, {1,3,4,5,6,7,8,9});
-    addField(0x023D, "yougan2");
-    addFieldModels(0x023D, {1,2,3,4,5,6,8,9,7,0});
-    addField(0x023E, "yougan3");
-    addFieldScriptBattle(0x023E, 10, 3, 0x12AE, 621);
-    addFieldScriptBattle(0x023E, 10, 4, 0x13F2, 621);
-    addFieldModels(0x023E, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x023C, "yougan");
-    addFieldScriptBattle(0x023C, 10, 3, 0x1271, 620);
-    addFieldScriptBattle(0x023C, 10, 4, 0x13B8, 620);
-    addFieldModels(0x023C, {1,2,3,4,5,6,7,8,9,0,0});
-    addField(0x0245, "yufy1");
-    addFieldScriptMateria(0x0245, 7, 7, 0xB72, 27);
-    addFieldScriptMessage(0x0245, 7, 7, 0, 0xBBB, 0x1282, 29);
-    addFieldScriptMateria(0x0245, 13, 1, 0xE8D, 27);
-    addFieldModels(0x0245, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x0246, "yufy2");
-    addFieldScriptMessage(0x0246, 14, 4, 3, 0xC35, 0x13A8, 137);
-    addFieldModels(0x0246, {1,2,3,4,5,6,7,8,9,0});
-    addField(0x02D8, "zcoal_1");
-    addFieldModels(0x02D8, {1,3,5,7,8,9,6,0});
-    addField(0x02D9, "zcoal_2");
-    addFieldScriptBattle(0x02D9, 3, 3, 0x4AB, 808);
-    addFieldScriptBattle(0x02D9, 3, 4, 0x4D4, 809);
-    addFieldScriptBattle(0x02D9, 3, 5, 0x4FD, 810);
-    addFieldScriptBattle(0x02D9, 3, 6, 0x526, 811);
-    addFieldModels(0x02D9, {1,6});
-    addField(0x02DA, "zcoal_3");
-    addFieldScriptBattle(0x02DA, 11, 0, 0x753, 812);
-    addFieldModels(0x02DA, {1,3,5,7,8,9,6,0});
-    addField(0x02D5, "zmind1");
-    addFieldModels(0x02D5, {1,1,1,1,1,1,4});
-    addField(0x02D6, "zmind2");
-    addFieldModels(0x02D6, {1,1,1,1,4});
-    addField(0x02D7, "zmind3");
-    addFieldModels(0x02D7, {1,1,1,1,1,4,0});
-    addField(0x0312, "ztruck");
-    addFieldModels(0x0312, {1,0,0,0});
-    addField(0x004E, "zz1");
-    addFieldScriptMessage(0x004E, 4, 1, 0, 0x3A3, 0x555, 22);
-    addFieldScriptItem(0x004E, 4, 1, 0x3AA, 309, 1);
-    addFieldWorldExit(0x004E, 0x4804, 0, 0x9);
-    addFieldModels(0x004E, {1,4,6,0});
-    addField(0x004F, "zz2");
-    addFieldScriptMessage(0x004F, 4, 7, 0, 0x81A, 0x1082, 24);
-    addFieldScriptItem(0x004F, 4, 7, 0x81D, 90, 1);
-    addFieldScriptMessage(0x004F, 4, 8, 0, 0x83D, 0x106A, 23);
-    addFieldScriptItem(0x004F, 4, 8, 0x840, 262, 1);
-    addFieldWorldExit(0x004F, 0x3A34, 0, 0xA);
-    addFieldModels(0x004F, {1,4,6,0});
-    addField(0x0050, "zz3");
-    addFieldScriptShop(0x0050, 4, 1, 0x607, 53);
-    addFieldScriptShop(0x0050, 4, 1, 0x737, 53);
-    addFieldScriptMateria(0x0050, 8, 1, 0xB91, 44);
-    addFieldScriptMessage(0x0050, 8, 1, 0, 0xBB1, 0x1CA2, 31);
-    addFieldWorldExit(0x0050, 0x510C, 0, 0x1C);
-    addFieldModels(0x0050, {1,4,6,0,0,0});
-    addField(0x0051, "zz4");
-    addFieldScriptMessage(0x0051, 12, 1, 0, 0x939, 0xE1F, 26);
-    addFieldScriptMessage(0x0051, 12, 1, 0, 0x94B, 0xE3A, 18);
-    addFieldScriptItem(0x0051, 12, 1, 0x952, 254, 1);
-    addFieldScriptItem(0x0051, 12, 1, 0x957, 93, 1);
-    addFieldWorldExit(0x0051, 0x36F8, 0, 0x15);
-    addFieldModels(0x0051, {1,3,4,5,6,7,8,9,0,0});
-    addField(0x0052, "zz5");
-    addFieldScriptMateria(0x0052, 4, 1, 0x346, 43);
-    addFieldScriptMessage(0x0052, 4, 1, 0, 0x366, 0x5E0, 24);
-    addFieldScriptMateria(0x0052, 5, 1, 0x3BB, 43);
-    addFieldScriptMessage(0x0052, 5, 1, 0, 0x3DB, 0x5E0, 24);
-    addFieldScriptMateria(0x0052, 6, 1, 0x430, 43);
-    addFieldScriptMessage(0x0052, 6, 1, 0, 0x450, 0x5E0, 24);
-    addFieldScriptMateria(0x0052, 7, 1, 0x4A5, 43);
-    addFieldScriptMessage(0x0052, 7, 1, 0, 0x4C5, 0x5E0, 24);
-    addFieldWorldExit(0x0052, 0x31B4, 0, 0x18);
-    addFieldModels(0x0052, {1,4,6});
-    addField(0x0053, "zz6");
-    addFieldScriptMateria(0x0053, 4, 1, 0x306, 18);
-    addFieldScriptMessage(0x0053, 4, 1, 0, 0x326, 0x45D, 19);
-    addFieldWorldExit(0x0053, 0x5280, 0, 0x16);
-    addFieldModels(0x0053, {1,4,6,0});
-    addField(0x0054, "zz7");
-    addFieldScriptMateria(0x0054, 4, 1, 0x346, 35);
-    addFieldScriptMessage(0x0054, 4, 1, 0, 0x366, 0x5DC, 32);
-    addFieldScriptMateria(0x0054, 5, 1, 0x3BB, 35);
-    addFieldScriptMessage(0x0054, 5, 1, 0, 0x3DB, 0x5DC, 32);
-    addFieldScriptMateria(0x0054, 6, 1, 0x430, 35);
-    addFieldScriptMessage(0x0054, 6, 1, 0, 0x450, 0x5DC, 32);
-    addFieldScriptMateria(0x0054, 7, 1, 0x4A5, 35);
-    addFieldScriptMessage(0x0054, 7, 1, 0, 0x4C5, 0x5DC, 32);
-    addFieldWorldExit(0x0054, 0x3528, 0, 0xC);
-    addFieldModels(0x0054, {1,4,6});
-    addField(0x0055, "zz8");
-    addFieldScriptMateria(0x0055, 4, 1, 0x346, 89);
-    addFieldScriptMateria(0x0055, 5, 1, 0x3BB, 89);
-    addFieldScriptMateria(0x0055, 6, 1, 0x430, 89);
-    addFieldScriptMateria(0x0055, 7, 1, 0x4A5, 89);
-    addFieldWorldExit(0x0055, 0x3210, 0, 0x1D);
-    addFieldModels(0x0055, {1,4,6});
+// Fields
+static constexpr FieldScriptItem fieldScriptItems[] = {
+    { 4, 1, 0x3AA, 309, 1 },
+    { 4, 7, 0x81D, 90, 1 },
+    { 4, 8, 0x840, 262, 1 },
+    { 12, 1, 0x952, 254, 1 },
+    { 12, 1, 0x957, 93, 1 },
+    { 11, 1, 0x879, 141, 1 },
+    { 9, 1, 0x62F, 283, 1 },
+    { 10, 1, 0x6DD, 6, 1 },
+    { 11, 1, 0x775, 228, 1 },
+    { 10, 1, 0x854, 253, 1 },
+    { 11, 1, 0x8EF, 213, 1 },
+    { 12, 1, 0x98A, 6, 1 },
+    { 13, 1, 0xA25, 94, 1 },
+    { 5, 1, 0x7F6, 98, 2 },
+    { 4, 1, 0x697, 104, 1 },
+    { 4, 1, 0x6A6, 102, 1 },
+    { 4, 1, 0x6B5, 103, 1 },
+    { 8, 1, 0xAAA, 98, 99 },
+    { 11, 1, 0x1427, 6, 99 },
+    { 11, 1, 0x142C, 75, 99 },
+    { 11, 1, 0x1431, 71, 99 },
+    { 11, 1, 0x1436, 87, 1 },
+    { 11, 1, 0x143B, 88, 1 },
+    { 11, 1, 0x1440, 89, 1 },
+    { 11, 1, 0x1445, 90, 1 },
+    { 11, 1, 0x144A, 91, 1 },
+    { 11, 1, 0x144F, 92, 1 },
+    { 11, 1, 0x1454, 93, 1 },
+    { 11, 1, 0x1459, 94, 1 },
+    { 11, 1, 0x145E, 142, 1 },
+    { 11, 1, 0x1463, 143, 1 },
+    { 11, 1, 0x1468, 158, 1 },
+    { 11, 1, 0x146D, 159, 1 },
+    { 11, 1, 0x1472, 174, 1 },
+    { 11, 1, 0x1477, 175, 1 },
+    { 11, 1, 0x147C, 188, 1 },
+    { 11, 1, 0x1481, 189, 1 },
+    { 11, 1, 0x1486, 213, 1 },
+    { 11, 1, 0x148B, 214, 1 },
+    { 11, 1, 0x1490, 227, 1 },
+    { 11, 1, 0x1495, 228, 1 },
+    { 11, 1, 0x149A, 240, 1 },
+    { 11, 1, 0x149F, 241, 1 },
+    { 11, 1, 0x14A4, 253, 1 },
+    { 11, 1, 0x14A9, 254, 1 },
+    { 11, 1, 0x14AE, 284, 9 },
+    { 11, 1, 0x14B3, 285, 9 },
+    { 11, 1, 0x14B8, 306, 9 },
+    { 11, 1, 0x14BD, 304, 9 },
+    { 14, 1, 0x186A, 62, 99 },
+    { 14, 1, 0x186F, 63, 19 },
+    { 14, 1, 0x1874, 64, 18 },
+    { 14, 1, 0x1879, 65, 17 },
+    { 14, 1, 0x187E, 66, 16 },
+    { 14, 1, 0x1883, 67, 15 },
+    { 14, 1, 0x1888, 68, 14 },
+    { 14, 1, 0x188D, 69, 13 },
+    { 14, 1, 0x1892, 77, 20 },
+    { 14, 1, 0x1897, 78, 19 },
+    { 14, 1, 0x189C, 79, 18 },
+    { 14, 1, 0x18A1, 80, 17 },
+    { 14, 1, 0x18A6, 81, 16 },
+    { 14, 1, 0x18AB, 82, 15 },
+    { 14, 1, 0x18B0, 83, 14 },
+    { 14, 1, 0x18B5, 84, 13 },
+    { 15, 1, 0x1BDD, 98, 1 },
+    { 7, 1, 0x98E, 85, 3 },
+    { 7, 1, 0xA19, 85, 3 },
+    { 7, 1, 0xA72, 85, 3 },
+    { 9, 1, 0x718, 0, 1 },
+    { 9, 1, 0x73B, 0, 1 },
+    { 10, 1, 0x7BC, 0, 1 },
+    { 10, 1, 0x7DF, 0, 1 },
+    { 11, 1, 0x85C, 0, 1 },
+    { 11, 1, 0x87F, 0, 1 },
+    { 11, 1, 0xBD0, 7, 1 },
+    { 5, 1, 0x8BC, 0, 1 },
+    { 7, 1, 0x5CF, 3, 1 },
+    { 11, 1, 0x6A0, 0, 1 },
+    { 39, 1, 0x2A37, 7, 1 },
+    { 30, 1, 0x134C, 1, 1 },
+    { 16, 1, 0xAD6, 1, 1 },
+    { 17, 1, 0xB2E, 12, 1 },
+    { 18, 1, 0xB87, 1, 1 },
+    { 19, 1, 0xBFF, 0, 1 },
+    { 20, 1, 0xC77, 0, 1 },
+    { 20, 1, 0x1473, 3, 1 },
+    { 21, 1, 0x14CC, 0, 1 },
+    { 22, 1, 0x1544, 1, 1 },
+    { 9, 1, 0xA72, 0, 1 },
+    { 15, 1, 0x14D4, 3, 1 },
+    { 4, 1, 0x357, 3, 1 },
+    { 6, 1, 0x491, 0, 1 },
+    { 8, 1, 0x5CC, 70, 1 },
+    { 5, 1, 0x417, 4, 1 },
+    { 5, 1, 0x601, 3, 1 },
+    { 15, 1, 0xE3D, 0, 1 },
+    { 15, 1, 0xE42, 7, 1 },
+    { 1, 1, 0x395, 318, 1 },
+    { 1, 1, 0x3DE, 318, 1 },
+    { 9, 1, 0x5E7, 85, 3 },
+    { 9, 1, 0x619, 85, 3 },
+    { 4, 3, 0x6A0, 159, 1 },
+    { 5, 4, 0x753, 159, 1 },
+    { 18, 1, 0xE56, 7, 1 },
+    { 23, 1, 0x16EE, 3, 1 },
+    { 19, 1, 0x16A6, 13, 1 },
+    { 4, 1, 0x760, 0, 1 },
+    { 13, 14, 0x93C, 3, 1 },
+    { 16, 1, 0x1089, 5, 1 },
+    { 17, 1, 0x10FE, 187, 1 },
+    { 17, 1, 0xC53, 173, 1 },
+    { 18, 1, 0xCE4, 157, 1 },
+    { 26, 1, 0x1293, 5, 1 },
+    { 26, 1, 0x12C0, 3, 1 },
+    { 26, 1, 0x12ED, 0, 1 },
+    { 15, 1, 0x177D, 298, 1 },
+    { 15, 1, 0x17AA, 277, 1 },
+    { 42, 1, 0x2B28, 23, 2 },
+    { 43, 1, 0x2BC9, 6, 2 },
+    { 44, 1, 0x2C68, 208, 1 },
+    { 29, 4, 0x1542, 7, 1 },
+    { 32, 4, 0x160A, 3, 1 },
+    { 35, 4, 0x16DA, 241, 1 },
+    { 39, 1, 0x181C, 74, 1 },
+    { 39, 1, 0x1821, 75, 1 },
+    { 8, 1, 0xBD1, 0, 1 },
+    { 9, 1, 0xC32, 0, 1 },
+    { 10, 1, 0xC83, 0, 1 },
+    { 11, 1, 0xCD4, 0, 1 },
+    { 13, 1, 0x81A, 5, 1 },
+    { 6, 1, 0x36B, 76, 1 },
+    { 20, 1, 0xDA5, 76, 1 },
+    { 17, 1, 0xB3B, 74, 1 },
+    { 17, 1, 0x840, 4, 1 },
+    { 17, 1, 0xC1B, 89, 1 },
+    { 21, 1, 0x1053, 153, 1 },
+    { 6, 1, 0x5AB, 222, 1 },
+    { 7, 1, 0x639, 236, 1 },
+    { 7, 1, 0xA33, 172, 1 },
+    { 6, 1, 0x4C4, 73, 1 },
+    { 19, 1, 0xE1D, 136, 1 },
+    { 20, 1, 0xE81, 183, 1 },
+    { 19, 1, 0x1224, 156, 1 },
+    { 9, 1, 0x569, 5, 1 },
+    { 5, 1, 0x2E4, 251, 1 },
+    { 8, 5, 0x925, 6, 1 },
+    { 8, 1, 0x574, 3, 1 },
+    { 6, 3, 0x447, 3, 1 },
+    { 7, 3, 0x4C6, 3, 1 },
+    { 8, 3, 0x545, 3, 1 },
+    { 4, 3, 0x3CF, 72, 1 },
+    { 5, 3, 0x450, 72, 1 },
+    { 6, 3, 0x4D1, 72, 1 },
+    { 8, 1, 0x45C, 247, 1 },
+    { 9, 3, 0x4A6, 3, 1 },
+    { 8, 1, 0x47F, 74, 1 },
+    { 6, 1, 0x455, 3, 1 },
+    { 8, 1, 0x54E, 70, 1 },
+    { 6, 1, 0x3DB, 1, 1 },
+    { 7, 1, 0x464, 5, 1 },
+    { 12, 1, 0x16CC, 5, 3 },
+    { 12, 1, 0x16FC, 2, 5 },
+    { 12, 1, 0x172C, 4, 3 },
+    { 12, 1, 0x175C, 224, 1 },
+    { 12, 1, 0x1790, 1, 5 },
+    { 12, 1, 0x17C2, 6, 1 },
+    { 12, 1, 0x17F0, 3, 3 },
+    { 12, 1, 0x1821, 305, 1 },
+    { 12, 1, 0x1850, 182, 1 },
+    { 6, 1, 0xB4D, 3, 6 },
+    { 6, 1, 0xB91, 0, 6 },
+    { 6, 1, 0xBCD, 20, 1 },
+    { 14, 1, 0x6E7, 74, 1 },
+    { 15, 1, 0x74D, 76, 1 },
+    { 16, 1, 0x7B0, 95, 1 },
+    { 13, 1, 0x70A, 71, 1 },
+    { 14, 1, 0x773, 72, 1 },
+    { 14, 1, 0xC99, 0, 1 },
+    { 11, 1, 0x5BA, 75, 1 },
+    { 9, 1, 0x461, 95, 1 },
+    { 19, 6, 0x119D, 299, 1 },
+    { 19, 6, 0x11F9, 135, 1 },
+    { 15, 1, 0xA8A, 239, 1 },
+    { 9, 1, 0x706, 211, 1 },
+    { 16, 1, 0xB8D, 3, 1 },
+    { 14, 1, 0x119F, 221, 1 },
+    { 8, 1, 0x47C, 152, 1 },
+    { 9, 1, 0x533, 307, 1 },
+    { 10, 1, 0x59D, 71, 1 },
+    { 3, 1, 0x316, 3, 1 },
+    { 11, 1, 0x6A6, 88, 1 },
+    { 29, 1, 0x1A5E, 168, 1 },
+    { 31, 1, 0x1B3B, 4, 1 },
+    { 5, 3, 0x6A8, 298, 1 },
+    { 6, 3, 0x70D, 196, 1 },
+    { 8, 1, 0x439, 74, 1 },
+    { 9, 1, 0x49F, 71, 1 },
+    { 10, 1, 0x53D, 70, 1 },
+    { 5, 7, 0x5F8, 7, 10 },
+    { 0, 0, 0x7A2, 199, 1 },
+    { 0, 0, 0x7C9, 212, 1 },
+    { 0, 0, 0x7F7, 95, 1 },
+    { 0, 0, 0x816, 96, 1 },
+    { 0, 0, 0x82F, 97, 1 },
+    { 10, 1, 0xA77, 5, 1 },
+    { 11, 1, 0xB05, 304, 1 },
+    { 0, 0, 0x7AE, 100, 1 },
+    { 0, 0, 0x7CD, 306, 1 },
+    { 0, 0, 0x7EC, 99, 1 },
+    { 0, 0, 0x80B, 101, 1 },
+    { 0, 0, 0x82D, 100, 1 },
+    { 0, 0, 0x84C, 99, 1 },
+    { 0, 0, 0x865, 101, 1 },
+    { 0, 0, 0x87A, 86, 1 },
+    { 0, 0, 0x88F, 86, 1 },
+    { 18, 1, 0x168B, 0, 1 },
+    { 18, 1, 0x16CE, 7, 1 },
+    { 18, 1, 0x1711, 21, 1 },
+    { 18, 1, 0x1754, 3, 1 },
+    { 18, 1, 0x1797, 64, 1 },
+    { 18, 1, 0x17DD, 312, 1 },
+    { 18, 1, 0x193D, 294, 1 },
+    { 18, 1, 0x19F2, 7, 1 },
+    { 18, 1, 0x1A35, 15, 1 },
+    { 18, 1, 0x1A78, 64, 1 },
+    { 18, 1, 0x1B1A, 48, 1 },
+    { 18, 1, 0x1B60, 54, 1 },
+    { 18, 1, 0x1C61, 294, 1 },
+    { 18, 1, 0x1CAA, 87, 1 },
+    { 18, 1, 0x1D69, 15, 1 },
+    { 18, 1, 0x1E0C, 22, 1 },
+    { 18, 1, 0x1EAE, 63, 1 },
+    { 18, 1, 0x1F53, 40, 1 },
+    { 18, 1, 0x1F96, 294, 1 },
+    { 18, 1, 0x1FDF, 87, 1 },
+    { 5, 4, 0x88E, 289, 1 },
+    { 5, 4, 0x8EC, 289, 1 },
+    { 5, 4, 0x8F1, 292, 1 },
+    { 1, 8, 0x841, 0, 1 },
+    { 1, 8, 0x8B3, 3, 1 },
+    { 1, 8, 0x8D2, 5, 1 },
+    { 1, 9, 0x9D7, 0, 1 },
+    { 1, 9, 0xA49, 7, 1 },
+    { 1, 9, 0xA68, 6, 1 },
+    { 8, 1, 0xFC9, 0, 1 },
+    { 8, 1, 0x100E, 3, 1 },
+    { 8, 1, 0x1055, 2, 1 },
+    { 8, 1, 0x109B, 4, 1 },
+    { 8, 1, 0x1140, 78, 1 },
+    { 8, 1, 0x11AA, 0, 1 },
+    { 8, 1, 0x11EF, 3, 1 },
+    { 8, 1, 0x1236, 2, 1 },
+    { 8, 1, 0x127C, 4, 1 },
+    { 8, 1, 0x1321, 78, 1 },
+    { 8, 1, 0x1379, 0, 1 },
+    { 8, 1, 0x13BE, 3, 1 },
+    { 8, 1, 0x1405, 2, 1 },
+    { 8, 1, 0x144C, 4, 1 },
+    { 8, 1, 0x14F2, 78, 1 },
+    { 8, 1, 0x15B6, 0, 1 },
+    { 8, 1, 0x15FB, 3, 1 },
+    { 8, 1, 0x1642, 2, 1 },
+    { 8, 1, 0x1689, 4, 1 },
+    { 8, 1, 0x172F, 78, 1 },
+    { 8, 1, 0x17EC, 0, 1 },
+    { 8, 1, 0x1831, 3, 1 },
+    { 8, 1, 0x1878, 2, 1 },
+    { 8, 1, 0x18BF, 4, 1 },
+    { 8, 1, 0x1967, 78, 1 },
+    { 0, 0, 0x86E, 75, 1 },
+    { 0, 0, 0x90D, 311, 1 },
+    { 0, 0, 0x9BA, 264, 1 },
+    { 0, 0, 0xA1C, 58, 1 },
+    { 0, 0, 0xA3D, 57, 1 },
+    { 0, 0, 0xA5E, 60, 1 },
+    { 0, 0, 0xA7F, 49, 1 },
+    { 0, 0, 0xAA0, 61, 1 },
+    { 0, 0, 0xAED, 304, 1 },
+    { 0, 0, 0xB04, 286, 1 },
+    { 0, 0, 0xB1B, 315, 1 },
+    { 0, 0, 0xB32, 287, 1 },
+    { 1, 4, 0xE51, 304, 1 },
+    { 1, 4, 0xEF0, 286, 1 },
+    { 1, 4, 0xF11, 315, 1 },
+    { 1, 4, 0xFB0, 287, 1 },
+    { 1, 4, 0xFCC, 3, 1 },
+    { 1, 4, 0xFE8, 5, 1 },
+    { 1, 4, 0x1004, 18, 1 },
+    { 1, 4, 0x1020, 34, 1 },
+    { 1, 4, 0x103C, 30, 1 },
+    { 1, 4, 0x1058, 32, 1 },
+    { 1, 4, 0x1074, 35, 1 },
+    { 1, 4, 0x1090, 31, 1 },
+    { 1, 4, 0x10AC, 33, 1 },
+    { 1, 4, 0x10C8, 6, 1 },
+    { 1, 4, 0x10E4, 4, 1 },
+    { 1, 4, 0x1100, 0, 1 },
+    { 1, 4, 0x111C, 7, 1 },
+    { 1, 4, 0x1138, 13, 1 },
+    { 1, 4, 0x1154, 14, 1 },
+    { 1, 4, 0x1170, 14, 1 },
+    { 9, 1, 0xA3A, 2, 1 },
+    { 7, 1, 0x4B2, 234, 1 },
+    { 11, 1, 0x639, 5, 1 },
+    { 8, 1, 0x485, 5, 1 },
+    { 8, 1, 0x49C, 73, 1 },
+    { 21, 7, 0x1AF5, 189, 1 },
+    { 23, 3, 0x1CB4, 189, 1 },
+    { 19, 1, 0xA49, 235, 1 },
+    { 20, 1, 0xACF, 3, 1 },
+    { 18, 1, 0x913, 301, 1 },
+    { 19, 1, 0x999, 2, 1 },
+    { 20, 1, 0xA22, 4, 1 },
+    { 8, 3, 0xC3F, 186, 1 },
+    { 13, 1, 0x6F4, 214, 1 },
+    { 17, 1, 0x7E4, 273, 1 },
+    { 17, 1, 0x8F4, 72, 1 },
+    { 15, 1, 0xD61, 139, 1 },
+    { 15, 1, 0xE66, 139, 1 },
+    { 25, 1, 0x16B4, 169, 1 },
+    { 18, 1, 0xA42, 71, 1 },
+    { 11, 1, 0x81F, 71, 1 },
+    { 11, 1, 0x839, 72, 1 },
+    { 11, 1, 0x853, 73, 1 },
+    { 11, 1, 0x86D, 74, 1 },
+    { 11, 1, 0x887, 75, 1 },
+    { 11, 1, 0x8A1, 76, 1 },
+    { 11, 1, 0x8BB, 6, 1 },
+    { 10, 4, 0x3D7, 225, 1 },
+    { 10, 4, 0x3D7, 185, 1 },
+    { 12, 1, 0x812, 35, 1 },
+    { 13, 1, 0x898, 5, 1 },
+    { 18, 1, 0xB9C, 227, 1 },
+    { 20, 1, 0xCAD, 210, 1 },
+    { 30, 1, 0x1200, 203, 1 },
+    { 32, 1, 0x12C7, 4, 1 },
+    { 33, 1, 0x132A, 74, 1 },
+    { 34, 1, 0x13D3, 171, 1 },
+    { 35, 1, 0x1469, 306, 1 },
+    { 17, 1, 0x938, 250, 1 },
+    { 22, 1, 0xC41, 138, 1 },
+    { 7, 1, 0x558, 200, 1 },
+    { 7, 1, 0x5BA, 237, 1 },
+    { 7, 1, 0x61C, 6, 1 },
+    { 28, 1, 0x1812, 155, 1 },
+    { 13, 1, 0xB77, 248, 1 },
+    { 13, 1, 0xC0C, 6, 1 },
+    { 13, 1, 0xC89, 209, 1 },
+    { 13, 1, 0xCE2, 5, 1 },
+    { 13, 1, 0xD0E, 5, 1 },
+    { 13, 1, 0xD54, 4, 1 },
+    { 13, 1, 0xD68, 3, 1 },
+    { 13, 1, 0xD85, 4, 1 },
+    { 13, 1, 0xD99, 3, 1 },
+    { 13, 1, 0xDEE, 3, 1 },
+    { 13, 1, 0xE1A, 3, 1 },
+    { 13, 1, 0xE45, 0, 1 },
+    { 35, 1, 0x2B58, 282, 1 },
+    { 26, 1, 0x2137, 252, 1 },
+    { 27, 1, 0x218A, 188, 1 },
+    { 4, 1, 0x2B9, 140, 1 },
+    { 5, 1, 0x33A, 5, 1 },
+    { 4, 1, 0x226, 317, 1 },
+    { 9, 1, 0xB8C, 206, 1 },
+    { 22, 1, 0x27A4, 280, 1 },
+    { 23, 1, 0x2828, 319, 1 },
+    { 25, 1, 0x290E, 6, 1 },
+    { 4, 1, 0x215, 71, 1 },
+    { 17, 1, 0xF5A, 72, 1 },
+    { 10, 1, 0x6D0, 73, 1 },
+    { 20, 1, 0x1314, 5, 1 },
+    { 19, 1, 0xDE5, 279, 1 },
+    { 10, 1, 0x475, 2, 1 },
+    { 12, 1, 0x73F, 18, 1 },
+    { 13, 1, 0x79D, 19, 1 },
+    { 30, 1, 0x1970, 4, 1 },
+    { 17, 1, 0xA37, 74, 1 },
+    { 23, 1, 0x9AA, 0, 1 },
+    { 13, 1, 0x627, 311, 1 },
+    { 12, 1, 0x4D0, 5, 1 },
+    { 8, 1, 0x4B0, 207, 1 },
+    { 9, 1, 0x534, 306, 1 },
+    { 23, 1, 0xC4C, 75, 1 },
+    { 24, 1, 0xCD0, 5, 1 },
+    { 7, 1, 0x345, 132, 1 },
+    { 15, 1, 0x8CB, 6, 1 },
+    { 16, 1, 0x94F, 278, 1 },
+    { 22, 1, 0xD18, 154, 1 },
+    { 29, 1, 0x165C, 295, 1 },
+    { 20, 1, 0xADA, 3, 1 },
+    { 21, 1, 0xB50, 1, 1 },
+    { 12, 4, 0x1240, 313, 1 },
+    { 11, 1, 0x58C, 5, 1 },
+    { 15, 1, 0xB67, 272, 1 },
+    { 16, 1, 0xBFF, 174, 1 },
+    { 17, 1, 0xC97, 6, 1 },
+    { 18, 1, 0xD2F, 5, 1 },
+    { 16, 1, 0xC1A, 5, 1 },
+    { 17, 1, 0xCB2, 240, 1 },
+    { 16, 1, 0xCE9, 72, 1 },
+    { 17, 1, 0xD95, 71, 1 },
+    { 18, 1, 0xE41, 73, 1 },
+    { 19, 1, 0xEED, 74, 1 },
+    { 6, 1, 0x532, 284, 1 },
+    { 7, 1, 0x5CA, 5, 1 },
+    { 4, 1, 0x2B1, 175, 1 },
+    { 30, 1, 0x1492, 98, 1 },
+    { 31, 1, 0x1515, 72, 1 },
+    { 30, 1, 0x1754, 74, 1 },
+    { 31, 1, 0x17ED, 71, 1 },
+    { 32, 1, 0x1886, 5, 1 },
+    { 33, 1, 0x191F, 73, 1 },
+    { 34, 1, 0x19B8, 72, 1 },
+    { 36, 1, 0x15CD, 74, 1 },
+    { 37, 1, 0x1678, 18, 1 },
+    { 9, 1, 0x4FF, 6, 1 },
+    { 10, 1, 0x599, 71, 1 },
+    { 11, 1, 0x633, 72, 1 },
+    { 5, 1, 0x549, 5, 1 },
+    { 6, 1, 0x5D2, 284, 1 },
+    { 7, 1, 0x65B, 75, 1 },
+    { 3, 1, 0x3D3, 310, 1 },
+    { 4, 1, 0x45C, 75, 1 },
+    { 5, 1, 0x4E5, 6, 1 },
+    { 6, 1, 0x56E, 6, 1 },
+    { 22, 1, 0xF40, 73, 1 },
+    { 23, 1, 0xFDA, 15, 1 },
+    { 20, 1, 0xFD1, 18, 1 },
+    { 21, 1, 0x106B, 19, 1 },
+    { 22, 1, 0x1105, 271, 1 },
+    { 2, 1, 0xB81, 5, 1 },
+    { 3, 1, 0xC06, 2, 1 },
+    { 4, 1, 0xC89, 15, 1 },
+    { 2, 1, 0xBF1, 4, 1 },
+    { 3, 1, 0xC76, 19, 1 },
+    { 2, 1, 0x1165, 75, 1 },
+    { 3, 1, 0x11EA, 4, 1 },
+    { 4, 1, 0x126F, 2, 1 },
+    { 3, 1, 0xBB3, 72, 1 },
+    { 3, 1, 0xBD1, 19, 1 },
+    { 3, 1, 0xBE9, 15, 1 },
+    { 4, 1, 0xDC1, 284, 1 },
+    { 4, 1, 0xDDF, 18, 1 },
+    { 4, 1, 0xDF7, 4, 1 },
+    { 5, 1, 0xF99, 74, 1 },
+    { 5, 1, 0xFF8, 75, 1 },
+    { 6, 1, 0x1183, 75, 1 },
+    { 6, 1, 0x11A1, 271, 1 },
+    { 6, 1, 0x11B9, 5, 1 },
+    { 7, 1, 0x144A, 6, 1 },
+    { 7, 1, 0x1524, 19, 1 },
+    { 8, 1, 0x16AE, 5, 1 },
+    { 8, 1, 0x16CC, 15, 1 },
+    { 8, 1, 0x16E4, 2, 1 },
+    { 9, 1, 0x1825, 6, 1 },
+    { 9, 1, 0x184C, 73, 1 },
+    { 10, 1, 0x144E, 76, 1 },
+};
 
-    addWorldMapEntrance(0x5436, 0x01, "Slum Outskirts", 185586, 120034);
-    addWorldMapEntrance(0x546c, 0x02, "Kalm", 201654, 112270);
-    addWorldMapEntrance(0x54a2, 0x03, "Chocobo Farm", 239232, 137553);
-    addWorldMapEntrance(0x558c, 0x04, "Mithril Mine", 214151, 153662);
-    addWorldMapEntrance(0x55c2, 0x05, "Mithril Mine", 209488, 157306);
-    addWorldMapEntrance(0x55f8, 0x06, "Base of Fort Condor", 203336, 169536);
-    addWorldMapEntrance(0x562e, 0x07, "Under Junon", 169850, 146365);
-    addWorldMapEntrance(0x5670, 0x08, "Temple of the Ancients", 169981, 182279);
-    addWorldMapEntrance(0x56a6, 0x09, "Old Man's House", 198726, 133446);
-    addWorldMapEntrance(0x56dc, 0x0A, "Weapon Seller", 129280, 173309);
-    addWorldMapEntrance(0x5712, 0x0B, "Mideel", 220157, 201688);
-    addWorldMapEntrance(0x5768, 0x0C, "Materia Cave", 274268, 140114);
-    addWorldMapEntrance(0x579e, 0x0D, "Costa del Sol", 140866, 124836);
-    addWorldMapEntrance(0x57e0, 0x0E, "Mt. Corel", 112985, 121747);
-    addWorldMapEntrance(0x5816, 0x0F, "North Corel", 109337, 125402);
-    addWorldMapEntrance(0x5866, 0x10, "Corel Desert", 120383, 154118);
-    addWorldMapEntrance(0x5884, 0x11, "Jungle", 112914, 182638);
-    addWorldMapEntrance(0x58ba, 0x12, "Cosmo Canyon", 87246, 170237);
-    addWorldMapEntrance(0x58f0, 0x13, "Nibelheim", 92529, 136292);
-    addWorldMapEntrance(0x5926, 0x14, "Rocket Town", 83786, 120735);
-    addWorldMapEntrance(0x597c, 0x15, "???", 102194, 141174);
-    addWorldMapEntrance(0x59b2, 0x16, "Materia Cave", 116260, 109023);
-    addWorldMapEntrance(0x59e8, 0x17, "Wutai", 37926, 88476);
-    addWorldMapEntrance(0x5a90, 0x18, "Materia Cave", 53675, 128295);
-    addWorldMapEntrance(0x5ac6, 0x19, "Bone Village", 156389, 89288);
-    addWorldMapEntrance(0x5afc, 0x1A, "Corel Valley Cave", 158239, 71427);
-    addWorldMapEntrance(0x5b32, 0x1B, "Icicle Inn", 129009, 72362);
-    addWorldMapEntrance(0x5b68, 0x1C, "Mystery House", 146135, 70381);
-    addWorldMapEntrance(0x5b9e, 0x1D, "Materia Cave", 263725, 13193);
-    addWorldMapEntrance(0x5238, 0x20, "Marshes", 215007, 152937);
-    addWorldMapEntrance(0x5286, 0x22, "Wilderness", 52951, 156334);
-    addWorldMapEntrance(0x5bd4, 0x2B, "Nibelheim", 92389, 135817);
-    addWorldMapEntrance(0x5c0a, 0x2C, "Mt. Nibel", 94085, 125897);
-    addWorldMapEntrance(0x5c40, 0x2E, "Mt. Nibel", 88079, 132446);
-    addWorldMapEntrance(0x5c76, 0x2F, "Icicle Inn", 129068, 71982);
-    addWorldMapEntrance(0x5cbc, 0x30, "Great Glacier", 136858, 53523);
-    addWorldMapEntrance(0x5cda, 0x39, "Corel Valley", 162994, 86357);
-    addWorldMapEntrance(0x5d10, 0x3A, "Forgotten Capital", 162051, 81137);
+static constexpr FieldScriptItem fieldScriptMateria[] = {
+    { 8, 1, 0xB91, 44, 1 },
+    { 4, 1, 0x346, 43, 1 },
+    { 5, 1, 0x3BB, 43, 1 },
+    { 6, 1, 0x430, 43, 1 },
+    { 7, 1, 0x4A5, 43, 1 },
+    { 4, 1, 0x306, 18, 1 },
+    { 4, 1, 0x346, 35, 1 },
+    { 5, 1, 0x3BB, 35, 1 },
+    { 6, 1, 0x430, 35, 1 },
+    { 7, 1, 0x4A5, 35, 1 },
+    { 4, 1, 0x346, 89, 1 },
+    { 5, 1, 0x3BB, 89, 1 },
+    { 6, 1, 0x430, 89, 1 },
+    { 7, 1, 0x4A5, 89, 1 },
+    { 8, 1, 0x54B, 15, 1 },
+    { 9, 1, 0x77D, 86, 1 },
+    { 11, 1, 0x12D7, 74, 1 },
+    { 11, 1, 0x12DE, 75, 1 },
+    { 11, 1, 0x12E5, 76, 1 },
+    { 11, 1, 0x12EC, 77, 1 },
+    { 11, 1, 0x12F3, 78, 1 },
+    { 11, 1, 0x12FA, 79, 1 },
+    { 11, 1, 0x1301, 80, 1 },
+    { 11, 1, 0x1308, 81, 1 },
+    { 11, 1, 0x130F, 82, 1 },
+    { 11, 1, 0x1316, 83, 1 },
+    { 11, 1, 0x131D, 84, 1 },
+    { 11, 1, 0x1324, 84, 1 },
+    { 11, 1, 0x132B, 84, 1 },
+    { 11, 1, 0x1332, 85, 1 },
+    { 11, 1, 0x1339, 86, 1 },
+    { 11, 1, 0x1340, 87, 1 },
+    { 11, 1, 0x1347, 88, 1 },
+    { 11, 1, 0x134E, 89, 1 },
+    { 11, 1, 0x1355, 90, 1 },
+    { 11, 1, 0x135C, 90, 1 },
+    { 11, 1, 0x1363, 90, 1 },
+    { 11, 1, 0x136A, 48, 1 },
+    { 11, 1, 0x1371, 48, 1 },
+    { 11, 1, 0x1378, 48, 1 },
+    { 11, 1, 0x137F, 73, 1 },
+    { 11, 1, 0x1386, 73, 1 },
+    { 11, 1, 0x138D, 73, 1 },
+    { 11, 1, 0x1394, 32, 1 },
+    { 11, 1, 0x139B, 32, 1 },
+    { 11, 1, 0x13A2, 32, 1 },
+    { 11, 1, 0x13A9, 1, 1 },
+    { 11, 1, 0x13B0, 1, 1 },
+    { 11, 1, 0x13B7, 1, 1 },
+    { 11, 1, 0x13BE, 11, 1 },
+    { 11, 1, 0x13C5, 11, 1 },
+    { 11, 1, 0x13CC, 11, 1 },
+    { 11, 1, 0x13D3, 12, 1 },
+    { 11, 1, 0x13DA, 12, 1 },
+    { 11, 1, 0x13E1, 12, 1 },
+    { 11, 1, 0x13E8, 19, 1 },
+    { 11, 1, 0x13EF, 19, 1 },
+    { 11, 1, 0x13F6, 19, 1 },
+    { 11, 1, 0x13FD, 21, 1 },
+    { 11, 1, 0x1404, 21, 1 },
+    { 11, 1, 0x140B, 21, 1 },
+    { 11, 1, 0x1412, 20, 1 },
+    { 11, 1, 0x1419, 20, 1 },
+    { 11, 1, 0x1420, 20, 1 },
+    { 9, 1, 0x89D, 81, 1 },
+    { 3, 3, 0x511, 53, 1 },
+    { 2, 3, 0x43C, 53, 1 },
+    { 9, 1, 0xB0A, 53, 1 },
+    { 9, 1, 0xB39, 23, 1 },
+    { 9, 1, 0xB40, 52, 1 },
+    { 9, 1, 0xB47, 53, 1 },
+    { 14, 1, 0x135E, 23, 1 },
+    { 18, 25, 0x12CF, 53, 1 },
+    { 13, 10, 0x111F, 53, 1 },
+    { 6, 1, 0x63C, 16, 1 },
+    { 7, 1, 0xDFC, 37, 1 },
+    { 10, 1, 0x831, 36, 1 },
+    { 26, 1, 0x1237, 29, 1 },
+    { 15, 1, 0x17D7, 23, 1 },
+    { 9, 1, 0xB82, 60, 1 },
+    { 9, 1, 0x96A, 60, 1 },
+    { 8, 1, 0xC80, 44, 1 },
+    { 17, 1, 0xA45, 29, 1 },
+    { 10, 1, 0xB51, 79, 1 },
+    { 5, 1, 0x43C, 68, 1 },
+    { 20, 1, 0x128D, 23, 1 },
+    { 22, 1, 0x1363, 13, 1 },
+    { 9, 1, 0x7E1, 29, 1 },
+    { 7, 1, 0xBF2, 17, 1 },
+    { 8, 1, 0xC88, 48, 1 },
+    { 9, 1, 0xD1E, 90, 1 },
+    { 10, 1, 0xDB7, 73, 1 },
+    { 9, 1, 0x825, 74, 1 },
+    { 10, 1, 0x8CE, 9, 1 },
+    { 5, 1, 0x10F6, 9, 1 },
+    { 5, 1, 0x11BE, 9, 1 },
+    { 7, 1, 0x498, 11, 1 },
+    { 14, 1, 0x6BA, 84, 1 },
+    { 14, 1, 0xD29, 53, 1 },
+    { 14, 1, 0xD58, 23, 1 },
+    { 14, 1, 0xD5F, 52, 1 },
+    { 14, 1, 0xD66, 53, 1 },
+    { 17, 1, 0x104F, 44, 1 },
+    { 19, 6, 0x11AA, 1, 1 },
+    { 6, 6, 0x9DF, 75, 1 },
+    { 17, 8, 0x11AE, 75, 1 },
+    { 12, 1, 0x88F, 75, 1 },
+    { 15, 1, 0xAD8, 23, 1 },
+    { 19, 1, 0x15D0, 76, 1 },
+    { 2, 4, 0x7DE, 72, 1 },
+    { 24, 4, 0xCEF, 72, 1 },
+    { 8, 1, 0x403, 72, 1 },
+    { 30, 1, 0x1AB0, 58, 1 },
+    { 0, 0, 0x77A, 32, 1 },
+    { 18, 1, 0x1809, 8, 1 },
+    { 18, 1, 0x1868, 10, 1 },
+    { 18, 1, 0x18C7, 2, 1 },
+    { 18, 1, 0x1AA4, 8, 1 },
+    { 18, 1, 0x1B8C, 10, 1 },
+    { 18, 1, 0x1BEB, 2, 1 },
+    { 18, 1, 0x1D96, 8, 1 },
+    { 18, 1, 0x1E38, 10, 1 },
+    { 18, 1, 0x1EDD, 2, 1 },
+    { 18, 1, 0x2024, 20, 1 },
+    { 8, 1, 0x1537, 5, 1 },
+    { 8, 1, 0x1774, 6, 1 },
+    { 8, 1, 0x19AC, 6, 1 },
+    { 8, 1, 0x1A11, 5, 1 },
+    { 0, 0, 0x94D, 23, 1 },
+    { 0, 0, 0xB44, 13, 1 },
+    { 1, 4, 0xE72, 13, 1 },
+    { 1, 4, 0xEB1, 25, 1 },
+    { 1, 4, 0xF32, 7, 1 },
+    { 1, 4, 0xF71, 31, 1 },
+    { 10, 1, 0xF75, 77, 1 },
+    { 6, 1, 0x3A7, 41, 1 },
+    { 2, 5, 0x3B6, 78, 1 },
+    { 9, 1, 0x4F8, 70, 1 },
+    { 22, 1, 0xBA4, 30, 1 },
+    { 17, 1, 0x925, 61, 1 },
+    { 7, 7, 0xB72, 27, 1 },
+    { 13, 1, 0xE8D, 27, 1 },
+    { 10, 4, 0x401, 28, 1 },
+    { 21, 0, 0x22A6, 80, 1 },
+    { 21, 1, 0x26B3, 80, 1 },
+    { 19, 1, 0xBDD, 34, 1 },
+    { 31, 1, 0x123F, 4, 1 },
+    { 30, 1, 0x1DDA, 40, 1 },
+    { 20, 1, 0x12FC, 81, 1 },
+    { 13, 1, 0xB2A, 84, 1 },
+    { 13, 1, 0xBB0, 88, 1 },
+    { 13, 1, 0xC3C, 21, 1 },
+    { 4, 1, 0x2DE, 82, 1 },
+    { 36, 1, 0x2B95, 14, 1 },
+    { 9, 1, 0x88F, 87, 1 },
+    { 24, 1, 0x285D, 3, 1 },
+    { 6, 1, 0x347, 64, 1 },
+    { 21, 1, 0x1351, 44, 1 },
+    { 20, 1, 0x911, 33, 1 },
+    { 11, 1, 0x482, 23, 1 },
+    { 14, 1, 0x7F3, 83, 1 },
+    { 23, 1, 0xAF6, 85, 1 },
+    { 30, 1, 0x16A1, 26, 1 },
+    { 3, 1, 0xC22, 69, 1 },
+    { 11, 1, 0x102D, 69, 1 },
+    { 11, 1, 0xB49, 69, 1 },
+    { 11, 1, 0xB2A, 69, 1 },
+    { 19, 1, 0xCFC, 21, 1 },
+    { 35, 1, 0x1A05, 28, 1 },
+    { 23, 1, 0x1144, 71, 1 },
+    { 10, 1, 0x4F0, 24, 1 },
+    { 11, 1, 0x55F, 19, 1 },
+    { 4, 1, 0xD02, 25, 1 },
+    { 5, 3, 0x12DE, 12, 1 },
+    { 5, 1, 0xFA6, 71, 1 },
+    { 7, 1, 0x14A9, 19, 1 },
+    { 7, 1, 0x14B2, 24, 1 },
+    { 9, 1, 0x1857, 12, 1 },
+};
 
-    addWorldMapEncounters({16422, 16423, 16424, 16425, 0, 0, 2090, 2090, 0, 4139, 0, 0, 0, 0}, {16416, 16417, 16418, 16420, 0, 0, 4131, 4131, 10277, 0, 0, 0, 0, 0}, {}, {22572, 21549, 21550, 0, 0, 0, 0, 0, 0, 8239, 0, 0, 0, 0});
-    addWorldMapEncounters({13360, 13361, 13362, 13363, 12340, 0, 2101, 2102, 0, 4151, 24632, 24633, 24636, 24637}, {}, {}, {16442, 16443, 16446, 16447, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({16448, 16449, 16450, 16451, 0, 0, 4164, 4165, 0, 0, 16462, 16463, 16464, 16465}, {22598, 21575, 21576, 0, 0, 0, 4169, 4169, 0, 0, 0, 0, 0, 0}, {16458, 16458, 16459, 16459, 0, 0, 4172, 4172, 0, 0, 0, 0, 0, 0}, {22605, 21586, 21587, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({22612, 21588, 21588, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {22614, 21592, 21593, 0, 0, 0, 4186, 4186, 16475, 0, 0, 0, 0, 0}, {}, {16469, 16476, 16477, 16478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({22624, 21601, 21604, 0, 0, 0, 4197, 4197, 0, 0, 5218, 5219, 11368, 11369}, {32870, 32870, 0, 0, 0, 0, 0, 0, 10343, 0, 0, 0, 0, 0}, {32874, 32875, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {16469, 16476, 16477, 16478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({22636, 21613, 21614, 0, 0, 0, 2159, 2159, 0, 4208, 0, 0, 0, 0}, {}, {22641, 21618, 21619, 0, 0, 0, 0, 0, 0, 8308, 0, 0, 0, 0}, {16469, 16476, 16477, 16478, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({22636, 21613, 21614, 0, 0, 0, 2159, 2159, 0, 4208, 0, 0, 0, 0}, {22648, 21625, 21626, 0, 0, 0, 4219, 4219, 0, 0, 0, 0, 0, 0}, {11388, 11389, 11390, 11391, 10368, 10369, 2178, 2179, 10372, 4229, 0, 0, 0, 0}, {22662, 21639, 21640, 0, 0, 0, 0, 0, 0, 8329, 0, 0, 0, 0});
-    addWorldMapEncounters({22668, 21645, 21646, 0, 0, 0, 4239, 4239, 0, 0, 0, 0, 0, 0}, {}, {22672, 21649, 21650, 0, 0, 0, 0, 0, 0, 8339, 0, 0, 0, 0}, {22662, 21639, 21640, 0, 0, 0, 0, 0, 0, 8329, 0, 0, 0, 0});
-    addWorldMapEncounters({22676, 21653, 21654, 0, 0, 0, 0, 0, 0, 8343, 5272, 5273, 11420, 11421}, {}, {22682, 21659, 21662, 0, 0, 0, 4255, 4255, 0, 0, 0, 0, 0, 0}, {22662, 21639, 21640, 0, 0, 0, 0, 0, 0, 8329, 0, 0, 0, 0});
-    addWorldMapEncounters({16544, 16545, 16548, 16549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {16552, 16553, 16554, 16555, 0, 0, 2220, 2221, 10414, 4271, 8354, 8355, 8358, 8359}, {32944, 32945, 0, 0, 0, 0, 0, 0, 0, 8370, 0, 0, 0, 0}, {32947, 32947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({22708, 21685, 21686, 0, 0, 0, 4279, 4279, 0, 0, 0, 0, 0, 0}, {22712, 21689, 21690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {22716, 21693, 21694, 0, 0, 0, 0, 0, 0, 8383, 0, 0, 0, 0}, {32955, 32955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({22720, 21697, 21698, 0, 0, 0, 4291, 4292, 0, 0, 0, 0, 0, 0}, {13509, 13510, 13511, 13512, 12489, 0, 2252, 2252, 0, 4301, 3274, 3275, 13518, 13519}, {22736, 21713, 21714, 0, 0, 0, 0, 0, 10451, 0, 0, 0, 0, 0}, {32955, 32955, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({16596, 16597, 16600, 16601, 0, 0, 0, 0, 0, 0, 7382, 7383, 9434, 9435}, {22748, 21725, 21726, 0, 0, 0, 4319, 4319, 0, 0, 0, 0, 0, 0}, {22752, 21729, 21730, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {32995, 32995, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0});
-    addWorldMapEncounters({}, {}, {20712, 20713, 16612, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {});
-    addWorldMapEncounters({22757, 21734, 21735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {}, {41188, 24804, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {});
-    addWorldMapEncounters({22757, 21734, 21735, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, {}, {22762, 21739, 21740, 0, 0, 0, 2285, 2285, 10478, 4335, 0, 0, 0, 0}, {});
+static constexpr FieldScriptMessage fieldScriptMessages[] = {
+    { 4, 1, 0, 0x3A3, 0x555, 22 },
+    { 4, 7, 0, 0x81A, 0x1082, 24 },
+    { 4, 8, 0, 0x83D, 0x106A, 23 },
+    { 8, 1, 0, 0xBB1, 0x1CA2, 31 },
+    { 12, 1, 0, 0x939, 0xE1F, 26 },
+    { 12, 1, 0, 0x94B, 0xE3A, 18 },
+    { 4, 1, 0, 0x366, 0x5E0, 24 },
+    { 5, 1, 0, 0x3DB, 0x5E0, 24 },
+    { 6, 1, 0, 0x450, 0x5E0, 24 },
+    { 7, 1, 0, 0x4C5, 0x5E0, 24 },
+    { 4, 1, 0, 0x326, 0x45D, 19 },
+    { 4, 1, 0, 0x366, 0x5DC, 32 },
+    { 5, 1, 0, 0x3DB, 0x5DC, 32 },
+    { 6, 1, 0, 0x450, 0x5DC, 32 },
+    { 7, 1, 0, 0x4C5, 0x5DC, 32 },
+    { 11, 1, 0, 0x876, 0x9A5, 26 },
+    { 8, 1, 0, 0x574, 0x901, 30 },
+    { 9, 1, 0, 0x62C, 0x888, 24 },
+    { 10, 1, 0, 0x6DA, 0x8EB, 21 },
+    { 11, 1, 0, 0x772, 0x8BC, 21 },
+    { 9, 1, 0, 0x7A6, 0xACC, 25 },
+    { 10, 1, 0, 0x851, 0xB23, 20 },
+    { 11, 1, 0, 0x8EC, 0xB82, 24 },
+    { 12, 1, 0, 0x987, 0xB9B, 21 },
+    { 13, 1, 0, 0xA22, 0xBD0, 20 },
+    { 9, 1, 0, 0x711, 0x9CF, 18 },
+    { 9, 1, 0, 0x734, 0x9CF, 18 },
+    { 10, 1, 0, 0x7B5, 0x9CF, 18 },
+    { 10, 1, 0, 0x7D8, 0x9CF, 18 },
+    { 11, 1, 0, 0x855, 0x9CF, 18 },
+    { 11, 1, 0, 0x878, 0x9CF, 18 },
+    { 11, 1, 0, 0xBCD, 0xE05, 24 },
+    { 5, 1, 0, 0x8B9, 0xB35, 18 },
+    { 3, 3, 0, 0x50E, 0xB0F, 27 },
+    { 7, 1, 0, 0x5CC, 0xA0A, 17 },
+    { 2, 3, 0, 0x439, 0xA46, 27 },
+    { 11, 1, 1, 0x699, 0x8A0, 18 },
+    { 39, 1, 2, 0x2A46, 0x4541, 24 },
+    { 30, 1, 2, 0x136D, 0x19DC, 21 },
+    { 16, 1, 1, 0xAD1, 0xE1E, 21 },
+    { 17, 1, 1, 0xB29, 0xE59, 23 },
+    { 18, 1, 1, 0xB82, 0xE1E, 21 },
+    { 19, 1, 1, 0xBFA, 0xE46, 18 },
+    { 20, 1, 1, 0xC72, 0xE46, 18 },
+    { 20, 1, 1, 0x146E, 0x16AB, 17 },
+    { 21, 1, 1, 0x14C7, 0x16BD, 18 },
+    { 22, 1, 1, 0x153F, 0x1695, 21 },
+    { 14, 1, 3, 0x139F, 0x236A, 23 },
+    { 15, 1, 2, 0x14E7, 0x23C8, 17 },
+    { 4, 1, 0, 0x354, 0x453, 17 },
+    { 6, 1, 0, 0x48E, 0x569, 18 },
+    { 8, 1, 0, 0x5C9, 0x6B7, 16 },
+    { 5, 1, 0, 0x414, 0x8DB, 23 },
+    { 8, 4, 3, 0x62A, 0xA14, 108 },
+    { 5, 1, 0, 0x5FA, 0x8B4, 19 },
+    { 6, 1, 0, 0x658, 0x8C8, 27 },
+    { 15, 1, 0, 0xE28, 0x1207, 18 },
+    { 15, 1, 0, 0xE3A, 0x122C, 24 },
+    { 7, 1, 0, 0xE18, 0x16C4, 25 },
+    { 1, 1, 0, 0x390, 0xB2C, 23 },
+    { 1, 1, 0, 0x3D9, 0xB2C, 23 },
+    { 4, 3, 1, 0x69B, 0xB13, 25 },
+    { 5, 4, 1, 0x74E, 0xB13, 25 },
+    { 18, 1, 0, 0xE53, 0x132C, 24 },
+    { 23, 1, 0, 0x16EB, 0x241C, 17 },
+    { 19, 1, 0, 0x16A3, 0x267B, 17 },
+    { 4, 1, 0, 0x75D, 0xB69, 18 },
+    { 10, 1, 0, 0x853, 0xB7C, 25 },
+    { 13, 14, 1, 0x937, 0xB14, 17 },
+    { 16, 1, 0, 0x1086, 0x17D9, 18 },
+    { 17, 1, 0, 0x10FB, 0x17EC, 25 },
+    { 37, 4, 3, 0x2175, 0x2753, 210 },
+    { 18, 1, 0, 0xCE1, 0x1039, 23 },
+    { 26, 1, 2, 0x1257, 0x259F, 29 },
+    { 26, 1, 2, 0x1290, 0x2661, 18 },
+    { 26, 1, 2, 0x12BD, 0x2674, 17 },
+    { 26, 1, 2, 0x12EA, 0x2686, 18 },
+    { 15, 1, 0, 0x177A, 0x32A4, 24 },
+    { 15, 1, 0, 0x17D4, 0x32D3, 23 },
+    { 42, 1, 0, 0x2B1A, 0x32BD, 21 },
+    { 42, 1, 0, 0x2B25, 0x32BD, 21 },
+    { 43, 1, 0, 0x2BBB, 0x32D3, 23 },
+    { 43, 1, 0, 0x2BC6, 0x32D3, 23 },
+    { 29, 4, 0, 0x153B, 0x1BB6, 24 },
+    { 32, 4, 0, 0x1603, 0x1BCF, 17 },
+    { 35, 4, 0, 0x16D3, 0x1BE1, 20 },
+    { 39, 1, 0, 0x1807, 0x1D91, 23 },
+    { 39, 1, 0, 0x1819, 0x1DA9, 24 },
+    { 9, 1, 0, 0xBC5, 0x11E4, 26 },
+    { 9, 1, 0, 0x9AD, 0xF11, 26 },
+    { 8, 1, 0, 0xBCE, 0x1326, 18 },
+    { 9, 1, 0, 0xC2F, 0x1326, 18 },
+    { 10, 1, 0, 0xC80, 0x1326, 18 },
+    { 11, 1, 0, 0xCD1, 0x1326, 18 },
+    { 8, 1, 0, 0xCA2, 0x11C8, 31 },
+    { 13, 1, 1, 0x817, 0xC40, 17 },
+    { 17, 1, 0, 0xA6B, 0x1A87, 28 },
+    { 17, 1, 0, 0xC14, 0x2356, 23 },
+    { 6, 1, 0, 0x5D9, 0xAA3, 22 },
+    { 7, 1, 0, 0x667, 0xABA, 28 },
+    { 7, 1, 0, 0xA61, 0xED2, 26 },
+    { 10, 1, 0, 0xB6D, 0xF97, 24 },
+    { 6, 1, 0, 0x4F2, 0x793, 24 },
+    { 5, 1, 0, 0x458, 0x6D9, 28 },
+    { 19, 1, 0, 0xE2C, 0x1161, 22 },
+    { 20, 1, 0, 0xE90, 0x1178, 25 },
+    { 19, 1, 0, 0x1233, 0x180B, 21 },
+    { 20, 1, 0, 0x12D4, 0x1821, 23 },
+    { 22, 1, 0, 0x137F, 0x17EF, 27 },
+    { 9, 1, 0, 0x578, 0x8FF, 18 },
+    { 9, 1, 0, 0x7FD, 0xD37, 29 },
+    { 5, 1, 0, 0x2F3, 0x641, 21 },
+    { 8, 5, 0, 0x91E, 0x157E, 26 },
+    { 8, 1, 0, 0x571, 0x7C5, 17 },
+    { 6, 3, 0, 0x444, 0x7E8, 17 },
+    { 7, 3, 0, 0x4C3, 0x7E8, 17 },
+    { 8, 3, 0, 0x542, 0x7E8, 17 },
+    { 4, 3, 0, 0x3CC, 0x8C9, 24 },
+    { 5, 3, 0, 0x44D, 0x8C9, 24 },
+    { 6, 3, 0, 0x4CE, 0x8C9, 24 },
+    { 8, 1, 1, 0x459, 0x6BE, 22 },
+    { 9, 3, 0, 0x4A3, 0x6D8, 17 },
+    { 5, 1, 1, 0x7A6, 0x4DCE, 192 },
+    { 5, 1, 1, 0x7BF, 0x4F47, 62 },
+    { 5, 1, 1, 0x7D4, 0x4F07, 63 },
+    { 5, 1, 1, 0x7E3, 0x5012, 70 },
+    { 5, 1, 1, 0x80D, 0x4FCD, 68 },
+    { 5, 1, 1, 0x822, 0x4F86, 70 },
+    { 7, 1, 0, 0xC1B, 0x1095, 30 },
+    { 8, 1, 0, 0xCB1, 0x10D5, 34 },
+    { 9, 1, 0, 0xD47, 0x10F8, 33 },
+    { 10, 1, 0, 0xDE0, 0x10B4, 32 },
+    { 9, 1, 1, 0x852, 0x96F, 29 },
+    { 10, 1, 0, 0x8EE, 0x9D6, 32 },
+    { 4, 1, 1, 0xD77, 0xD3E5, 197 },
+    { 4, 1, 1, 0xD8A, 0xD4AB, 279 },
+    { 4, 1, 1, 0xDE9, 0xD82A, 127 },
+    { 8, 1, 1, 0x47C, 0x5A1, 23 },
+    { 6, 1, 0, 0x452, 0x621, 17 },
+    { 7, 1, 0, 0x4B8, 0x602, 30 },
+    { 8, 1, 1, 0x54B, 0x5F1, 16 },
+    { 6, 1, 0, 0x3D8, 0x4F1, 21 },
+    { 7, 1, 0, 0x461, 0x59E, 18 },
+    { 12, 1, 0, 0x16C7, 0x4044, 24 },
+    { 12, 1, 0, 0x16F7, 0x4044, 24 },
+    { 12, 1, 0, 0x1727, 0x4026, 29 },
+    { 12, 1, 0, 0x178B, 0x3FF4, 23 },
+    { 12, 1, 0, 0x17BD, 0x3FAC, 21 },
+    { 12, 1, 0, 0x181C, 0x3F95, 22 },
+    { 12, 1, 0, 0x184B, 0x3F7E, 22 },
+    { 14, 1, 0, 0x6D9, 0x804, 27 },
+    { 6, 1, 1, 0xB5C, 0x1B52, 18 },
+    { 6, 1, 1, 0xBA0, 0x1B8C, 20 },
+    { 6, 1, 1, 0xBDC, 0x1B78, 19 },
+    { 14, 1, 2, 0x6FA, 0x7E5, 23 },
+    { 15, 1, 2, 0x760, 0x7FD, 23 },
+    { 16, 1, 2, 0x7C3, 0x815, 24 },
+    { 13, 1, 2, 0x71D, 0xA6B, 24 },
+    { 14, 1, 2, 0x786, 0xA84, 26 },
+    { 17, 1, 2, 0x1083, 0x3F02, 31 },
+    { 11, 1, 2, 0x5CD, 0x7B6, 24 },
+    { 9, 1, 2, 0x474, 0x67A, 24 },
+    { 19, 6, 0, 0x1194, 0x1E4A, 26 },
+    { 19, 6, 0, 0x11D3, 0x1E2E, 27 },
+    { 19, 6, 0, 0x11F0, 0x1E14, 25 },
+    { 15, 1, 0, 0xA83, 0x277C, 27 },
+    { 9, 1, 0, 0x6FF, 0x2476, 21 },
+    { 6, 6, 0, 0x9D7, 0x2B6E, 25 },
+    { 17, 8, 0, 0x11E5, 0x2B6E, 25 },
+    { 12, 1, 0, 0x8AB, 0xC56, 25 },
+    { 15, 1, 0, 0xAFE, 0x122A, 23 },
+    { 16, 1, 0, 0xB8A, 0x1242, 17 },
+    { 14, 1, 0, 0x119C, 0x1694, 22 },
+    { 19, 1, 0, 0x15F2, 0x20B0, 25 },
+    { 8, 1, 2, 0x48B, 0x6CE, 23 },
+    { 9, 1, 2, 0x542, 0x6E6, 21 },
+    { 10, 1, 2, 0x5B0, 0x6FC, 24 },
+    { 17, 1, 1, 0x14B3, 0x2591, 243 },
+    { 2, 4, 0, 0x7FB, 0x147D, 26 },
+    { 24, 4, 0, 0xD16, 0x11F8, 26 },
+    { 3, 1, 0, 0x313, 0x634, 17 },
+    { 8, 1, 0, 0x42A, 0x783, 26 },
+    { 11, 1, 0, 0x6A3, 0xA7D, 23 },
+    { 29, 1, 2, 0x1A71, 0x1BD3, 25 },
+    { 30, 1, 2, 0x1AE4, 0x1BED, 29 },
+    { 31, 1, 2, 0x1B4E, 0x1C0B, 23 },
+    { 5, 3, 2, 0x6B7, 0x732, 23 },
+    { 6, 3, 2, 0x71C, 0x74A, 24 },
+    { 8, 1, 2, 0x44C, 0x73B, 23 },
+    { 9, 1, 2, 0x4B2, 0x753, 24 },
+    { 10, 1, 2, 0x550, 0x76C, 16 },
+    { 5, 7, 2, 0x607, 0xAC2, 27 },
+    { 0, 0, 0, 0x79B, 0x1B64, 33 },
+    { 0, 0, 0, 0x7C2, 0x1B86, 31 },
+    { 0, 0, 0, 0x7F4, 0x1AEF, 37 },
+    { 0, 0, 0, 0x813, 0x1B15, 38 },
+    { 0, 0, 0, 0x82C, 0x1B3C, 39 },
+    { 13, 4, 3, 0x9E1, 0xFEA, 184 },
+    { 11, 4, 3, 0x1F8C, 0x303A, 183 },
+    { 10, 1, 3, 0xA74, 0xFD6, 18 },
+    { 11, 1, 1, 0xB02, 0xF68, 26 },
+    { 0, 0, 1, 0x791, 0x3938, 64 },
+    { 0, 0, 1, 0x7AB, 0x3895, 53 },
+    { 0, 0, 1, 0x7CA, 0x3862, 50 },
+    { 0, 0, 1, 0x7E9, 0x38CB, 56 },
+    { 0, 0, 1, 0x808, 0x3904, 51 },
+    { 0, 0, 1, 0x82A, 0x3895, 53 },
+    { 0, 0, 1, 0x849, 0x38CB, 56 },
+    { 0, 0, 1, 0x862, 0x3904, 51 },
+    { 0, 0, 1, 0x877, 0x383D, 36 },
+    { 0, 0, 1, 0x88C, 0x383D, 36 },
+    { 18, 1, 1, 0x1688, 0x366C, 18 },
+    { 18, 1, 1, 0x16CB, 0x367F, 24 },
+    { 18, 1, 1, 0x170E, 0x3698, 20 },
+    { 18, 1, 1, 0x1751, 0x36AD, 17 },
+    { 18, 1, 1, 0x17DA, 0x36D9, 21 },
+    { 18, 1, 1, 0x1889, 0x3706, 31 },
+    { 18, 1, 1, 0x18E8, 0x3726, 30 },
+    { 18, 1, 1, 0x19EF, 0x367F, 24 },
+    { 18, 1, 1, 0x1A32, 0x3763, 18 },
+    { 18, 1, 1, 0x1B17, 0x3776, 21 },
+    { 18, 1, 1, 0x1BAD, 0x3706, 31 },
+    { 18, 1, 1, 0x1C0C, 0x3726, 30 },
+    { 18, 1, 1, 0x1CA7, 0x379F, 21 },
+    { 18, 1, 1, 0x1D66, 0x3763, 18 },
+    { 18, 1, 1, 0x1E59, 0x3706, 31 },
+    { 18, 1, 1, 0x1EFE, 0x3726, 30 },
+    { 18, 1, 1, 0x1F50, 0x37E4, 20 },
+    { 18, 1, 1, 0x1FDC, 0x379F, 21 },
+    { 18, 1, 1, 0x2049, 0x37F9, 28 },
+    { 5, 4, 1, 0x887, 0x10F0, 24 },
+    { 5, 4, 1, 0x8D3, 0x10F0, 24 },
+    { 5, 4, 1, 0x8E5, 0x1109, 25 },
+    { 1, 8, 1, 0x83E, 0x2564, 19 },
+    { 1, 8, 1, 0x8B0, 0x25CF, 25 },
+    { 1, 8, 1, 0x8CF, 0x2588, 19 },
+    { 1, 9, 1, 0x9D4, 0x2564, 19 },
+    { 1, 9, 1, 0xA46, 0x25E9, 18 },
+    { 1, 9, 1, 0xA65, 0x25FC, 22 },
+    { 8, 1, 2, 0xFE0, 0x2564, 19 },
+    { 8, 1, 2, 0x1027, 0x2B45, 18 },
+    { 8, 1, 2, 0x106E, 0x2B58, 21 },
+    { 8, 1, 2, 0x10B4, 0x2BDA, 24 },
+    { 8, 1, 2, 0x1159, 0x2BA5, 22 },
+    { 8, 1, 2, 0x11C1, 0x2564, 19 },
+    { 8, 1, 2, 0x1208, 0x2B45, 18 },
+    { 8, 1, 2, 0x124F, 0x2B58, 21 },
+    { 8, 1, 2, 0x1295, 0x2BDA, 24 },
+    { 8, 1, 2, 0x133A, 0x2BA5, 22 },
+    { 8, 1, 2, 0x1390, 0x2564, 19 },
+    { 8, 1, 2, 0x13D7, 0x2B45, 18 },
+    { 8, 1, 2, 0x141E, 0x2B58, 21 },
+    { 8, 1, 2, 0x1465, 0x2BDA, 24 },
+    { 8, 1, 2, 0x150B, 0x2BA5, 22 },
+    { 8, 1, 2, 0x155C, 0x2BBC, 29 },
+    { 8, 1, 2, 0x15CD, 0x2564, 19 },
+    { 8, 1, 2, 0x1614, 0x2B45, 18 },
+    { 8, 1, 2, 0x165B, 0x2B58, 21 },
+    { 8, 1, 2, 0x16A2, 0x2BDA, 24 },
+    { 8, 1, 2, 0x1748, 0x2BA5, 22 },
+    { 8, 1, 2, 0x1799, 0x2B87, 29 },
+    { 8, 1, 2, 0x1803, 0x2564, 19 },
+    { 8, 1, 2, 0x184A, 0x2B45, 18 },
+    { 8, 1, 2, 0x1891, 0x2B58, 21 },
+    { 8, 1, 2, 0x18D8, 0x2BDA, 24 },
+    { 8, 1, 2, 0x1980, 0x2BA5, 22 },
+    { 8, 1, 2, 0x19D1, 0x2B87, 29 },
+    { 8, 1, 2, 0x1A36, 0x2BBC, 29 },
+    { 0, 0, 1, 0x86B, 0x2C6A, 24 },
+    { 0, 0, 1, 0x90A, 0x2BB5, 22 },
+    { 0, 0, 2, 0x969, 0x2BE7, 23 },
+    { 0, 0, 1, 0x9B7, 0x2BCC, 26 },
+    { 0, 0, 1, 0xA19, 0x2BFF, 15 },
+    { 0, 0, 1, 0xA3A, 0x2C0F, 20 },
+    { 0, 0, 1, 0xA5B, 0x2C24, 23 },
+    { 0, 0, 1, 0xA7C, 0x2C3C, 25 },
+    { 0, 0, 1, 0xAFC, 0x3282, 24 },
+    { 0, 0, 1, 0xB13, 0x32E2, 27 },
+    { 0, 0, 1, 0xB2A, 0x33E3, 23 },
+    { 0, 0, 1, 0xB41, 0x343D, 26 },
+    { 0, 0, 1, 0xB60, 0x329B, 35 },
+    { 1, 4, 1, 0xE60, 0x3282, 24 },
+    { 1, 4, 1, 0xE89, 0x329B, 35 },
+    { 1, 4, 1, 0xEC8, 0x32BF, 34 },
+    { 1, 4, 1, 0xEFF, 0x32E2, 27 },
+    { 1, 4, 1, 0xF20, 0x33E3, 23 },
+    { 1, 4, 1, 0xF49, 0x33FB, 31 },
+    { 1, 4, 1, 0xF88, 0x341B, 33 },
+    { 1, 4, 1, 0xFBF, 0x343D, 26 },
+    { 1, 4, 1, 0xFDB, 0x32FE, 18 },
+    { 1, 4, 1, 0xFF7, 0x3341, 19 },
+    { 1, 4, 1, 0x1013, 0x3311, 23 },
+    { 1, 4, 1, 0x102F, 0x3329, 23 },
+    { 1, 4, 1, 0x104B, 0x3355, 22 },
+    { 1, 4, 1, 0x1067, 0x336C, 27 },
+    { 1, 4, 1, 0x1083, 0x3458, 23 },
+    { 1, 4, 1, 0x109F, 0x3470, 22 },
+    { 1, 4, 1, 0x10BB, 0x34CE, 24 },
+    { 1, 4, 1, 0x10D7, 0x3487, 22 },
+    { 1, 4, 1, 0x10F3, 0x349E, 24 },
+    { 1, 4, 1, 0x110F, 0x3388, 19 },
+    { 1, 4, 1, 0x112B, 0x339C, 25 },
+    { 1, 4, 1, 0x1147, 0x33B6, 18 },
+    { 1, 4, 1, 0x1163, 0x33C9, 25 },
+    { 1, 4, 1, 0x117F, 0x34B7, 22 },
+    { 10, 1, 0, 0xF91, 0x20C7, 25 },
+    { 6, 1, 0, 0x3C7, 0x62C, 29 },
+    { 2, 5, 0, 0x3DB, 0xA95, 25 },
+    { 9, 1, 0, 0xA37, 0xCAA, 20 },
+    { 7, 1, 0, 0x4AF, 0x737, 25 },
+    { 9, 6, 2, 0x12C2, 0x23F0, 24 },
+    { 7, 4, 3, 0x3E3, 0x575, 153 },
+    { 14, 4, 3, 0xAD0, 0x17B4, 115 },
+    { 11, 1, 0, 0x636, 0x660, 18 },
+    { 8, 1, 0, 0x482, 0x655, 18 },
+    { 8, 1, 0, 0x499, 0x67F, 24 },
+    { 9, 1, 0, 0x51A, 0x698, 29 },
+    { 11, 2, 0, 0x655, 0xF52, 175 },
+    { 11, 2, 3, 0x6E1, 0x115C, 34 },
+    { 12, 2, 0, 0x7F7, 0x1024, 128 },
+    { 12, 2, 3, 0x883, 0x117F, 32 },
+    { 13, 2, 0, 0x996, 0x10A5, 133 },
+    { 13, 2, 3, 0xA22, 0x11A0, 33 },
+    { 14, 2, 3, 0xB61, 0x112B, 48 },
+    { 14, 2, 3, 0xBD2, 0x11C2, 32 },
+    { 21, 7, 0, 0x1AF2, 0x2A5C, 24 },
+    { 22, 1, 0, 0xBC6, 0xED8, 32 },
+    { 19, 1, 0, 0xA46, 0xC1C, 25 },
+    { 20, 1, 0, 0xACC, 0xC36, 17 },
+    { 18, 1, 0, 0x910, 0xB29, 22 },
+    { 19, 1, 0, 0x996, 0xB40, 20 },
+    { 20, 1, 0, 0xA1F, 0xB55, 23 },
+    { 17, 1, 0, 0x947, 0xB51, 27 },
+    { 13, 1, 0, 0x6F1, 0x9AA, 24 },
+    { 17, 1, 0, 0x7DD, 0xAB7, 27 },
+    { 17, 1, 0, 0x8ED, 0xBE3, 24 },
+    { 15, 1, 0, 0xD5E, 0x110C, 21 },
+    { 15, 1, 0, 0xE63, 0x110C, 21 },
+    { 25, 1, 0, 0x16AD, 0x1915, 21 },
+    { 18, 1, 0, 0xA3F, 0xCCF, 24 },
+    { 7, 1, 0, 0x537, 0x5DF, 29 },
+    { 7, 1, 0, 0x556, 0x5C4, 26 },
+    { 11, 1, 0, 0x81C, 0x1B3B, 24 },
+    { 11, 1, 0, 0x836, 0x1B54, 24 },
+    { 11, 1, 0, 0x850, 0x1B6D, 24 },
+    { 11, 1, 0, 0x86A, 0x1B86, 23 },
+    { 11, 1, 0, 0x884, 0x1B9E, 24 },
+    { 11, 1, 0, 0x89E, 0x1BB7, 23 },
+    { 11, 1, 0, 0x8B8, 0x1B25, 21 },
+    { 7, 7, 0, 0xBBB, 0x1282, 29 },
+    { 14, 4, 3, 0xC35, 0x13A8, 137 },
+    { 10, 4, 0, 0x3D4, 0x3FC, 26 },
+    { 10, 4, 0, 0x3D4, 0x3FC, 19 },
+    { 10, 4, 0, 0x429, 0x4B3, 29 },
+    { 21, 0, 0, 0x22C5, 0x5E43, 29 },
+    { 21, 1, 0, 0x26DF, 0x5E43, 29 },
+    { 12, 1, 0, 0x80F, 0xA72, 22 },
+    { 13, 1, 0, 0x895, 0xA89, 18 },
+    { 18, 1, 0, 0xB99, 0x41FF, 20 },
+    { 19, 1, 0, 0xC02, 0x4293, 33 },
+    { 20, 1, 0, 0xCAA, 0x41E5, 25 },
+    { 30, 1, 0, 0x11FD, 0x1809, 19 },
+    { 32, 1, 0, 0x12DA, 0x179B, 23 },
+    { 33, 1, 0, 0x133D, 0x17B3, 23 },
+    { 34, 1, 0, 0x13D0, 0x181D, 24 },
+    { 35, 1, 0, 0x1466, 0x1836, 18 },
+    { 17, 1, 0, 0x935, 0xCA8, 24 },
+    { 30, 1, 0, 0x1E18, 0x239B, 25 },
+    { 22, 1, 0, 0xC3E, 0xD3B, 20 },
+    { 7, 1, 0, 0x555, 0x64C, 26 },
+    { 7, 1, 0, 0x5B7, 0x667, 25 },
+    { 7, 1, 0, 0x619, 0x681, 21 },
+    { 28, 1, 0, 0x1825, 0x1982, 22 },
+    { 20, 1, 0, 0x133A, 0x19AD, 27 },
+    { 13, 1, 0, 0xB41, 0x1230, 27 },
+    { 13, 1, 0, 0xB86, 0x118F, 20 },
+    { 13, 1, 0, 0xBC7, 0x120F, 32 },
+    { 13, 1, 0, 0xC1B, 0x11F9, 21 },
+    { 13, 1, 0, 0xC53, 0x124C, 26 },
+    { 13, 1, 0, 0xC98, 0x11C4, 15 },
+    { 13, 1, 0, 0xCF1, 0x11D4, 18 },
+    { 13, 1, 0, 0xD1D, 0x11D4, 18 },
+    { 13, 1, 0, 0xD63, 0x12A3, 23 },
+    { 13, 1, 0, 0xD77, 0x11E7, 17 },
+    { 13, 1, 0, 0xD94, 0x12A3, 23 },
+    { 13, 1, 0, 0xDA8, 0x11E7, 17 },
+    { 13, 1, 0, 0xDFD, 0x11E7, 17 },
+    { 13, 1, 0, 0xE29, 0x11E7, 17 },
+    { 13, 1, 0, 0xE54, 0x1278, 18 },
+    { 4, 1, 0, 0x2DB, 0x5AB, 27 },
+    { 35, 1, 0, 0x2B55, 0x2F1A, 24 },
+    { 36, 1, 0, 0x2BB5, 0x2F33, 29 },
+    { 9, 1, 0, 0x8AF, 0xAD6, 26 },
+    { 26, 1, 0, 0x2134, 0x2444, 24 },
+    { 27, 1, 0, 0x2187, 0x245D, 27 },
+    { 4, 1, 0, 0x2B6, 0x4D8, 22 },
+    { 5, 1, 0, 0x337, 0x541, 18 },
+    { 4, 1, 0, 0x223, 0x57D, 22 },
+    { 9, 1, 0, 0xB9B, 0xD94, 25 },
+    { 22, 1, 0, 0x27A1, 0x2C62, 23 },
+    { 23, 1, 0, 0x2825, 0x2C7A, 22 },
+    { 24, 1, 0, 0x287F, 0x2C43, 30 },
+    { 25, 1, 0, 0x290B, 0x2C91, 21 },
+    { 4, 1, 0, 0x224, 0x564, 24 },
+    { 6, 1, 0, 0x36D, 0x512, 25 },
+    { 17, 1, 0, 0xF57, 0x115C, 24 },
+    { 10, 1, 0, 0x6CD, 0x8EB, 24 },
+    { 20, 1, 0, 0x1311, 0x157C, 18 },
+    { 21, 1, 0, 0x137A, 0x15C1, 31 },
+    { 19, 1, 0, 0xDF4, 0x110E, 25 },
+    { 10, 1, 0, 0x472, 0x498, 20 },
+    { 12, 1, 0, 0x73C, 0xC46, 22 },
+    { 13, 1, 0, 0x79A, 0xC5D, 19 },
+    { 30, 1, 0, 0x196D, 0x3103, 23 },
+    { 17, 1, 1, 0xA32, 0x12AB, 23 },
+    { 23, 1, 0, 0x9BE, 0xAA8, 18 },
+    { 13, 1, 1, 0x622, 0xE88, 22 },
+    { 20, 1, 0, 0x92D, 0x1149, 29 },
+    { 12, 1, 0, 0x4E4, 0x5E1, 18 },
+    { 11, 1, 0, 0x49E, 0xD17, 23 },
+    { 14, 1, 0, 0x80F, 0xFA6, 30 },
+    { 8, 1, 0, 0x4AD, 0x560, 19 },
+    { 9, 1, 0, 0x531, 0x574, 18 },
+    { 23, 1, 0, 0xC49, 0xCFC, 24 },
+    { 24, 1, 0, 0xCCD, 0xD15, 18 },
+    { 7, 1, 0, 0x342, 0x36D, 25 },
+    { 16, 1, 0, 0x94C, 0x993, 23 },
+    { 23, 1, 0, 0xB0D, 0xBCA, 31 },
+    { 22, 1, 0, 0xD15, 0xD50, 26 },
+    { 29, 1, 0, 0x1659, 0x1AAA, 23 },
+    { 30, 1, 0, 0x16B8, 0x1AC2, 28 },
+    { 20, 1, 0, 0xAD7, 0xC10, 17 },
+    { 21, 1, 0, 0xB4D, 0xC22, 21 },
+    { 11, 1, 0, 0x585, 0x69A, 18 },
+    { 15, 1, 0, 0xB60, 0x2A79, 25 },
+    { 16, 1, 0, 0xBF8, 0x2A64, 20 },
+    { 17, 1, 0, 0xC90, 0x2A93, 22 },
+    { 18, 1, 0, 0xD28, 0x2AC7, 19 },
+    { 16, 1, 0, 0xC13, 0x2A4A, 19 },
+    { 17, 1, 0, 0xCAB, 0x2A2D, 28 },
+    { 19, 1, 0, 0xD18, 0x2A12, 19 },
+    { 16, 1, 0, 0xCE2, 0x2CE6, 25 },
+    { 17, 1, 0, 0xD8E, 0x2CCC, 25 },
+    { 18, 1, 0, 0xE3A, 0x2C99, 25 },
+    { 19, 1, 0, 0xEE6, 0x2CB3, 24 },
+    { 6, 1, 0, 0x52B, 0x23DD, 20 },
+    { 7, 1, 0, 0x5C3, 0x2362, 19 },
+    { 4, 1, 0, 0x2AA, 0x20FD, 25 },
+    { 30, 1, 1, 0x148F, 0x17DF, 24 },
+    { 31, 1, 0, 0x1512, 0x1795, 24 },
+    { 30, 1, 1, 0x1751, 0x1CC5, 23 },
+    { 31, 1, 1, 0x17EA, 0x1C80, 24 },
+    { 32, 1, 1, 0x1883, 0x1C99, 18 },
+    { 33, 1, 1, 0x191C, 0x1CDD, 24 },
+    { 34, 1, 1, 0x19B5, 0x1CAC, 24 },
+    { 35, 1, 0, 0x1A25, 0x1D0F, 29 },
+    { 36, 1, 0, 0x15CA, 0x1B2F, 23 },
+    { 37, 1, 0, 0x1675, 0x1B47, 22 },
+    { 9, 1, 0, 0x4F8, 0xA2C, 21 },
+    { 10, 1, 0, 0x592, 0xA42, 24 },
+    { 11, 1, 0, 0x62C, 0xA5B, 24 },
+    { 5, 1, 0, 0x546, 0x831, 18 },
+    { 6, 1, 0, 0x5CF, 0x844, 19 },
+    { 7, 1, 0, 0x658, 0x858, 24 },
+    { 3, 1, 0, 0x3D0, 0x77E, 27 },
+    { 4, 1, 0, 0x459, 0x765, 24 },
+    { 5, 1, 0, 0x4E2, 0x79A, 21 },
+    { 6, 1, 0, 0x56B, 0x79A, 21 },
+    { 22, 1, 0, 0xF39, 0x141F, 24 },
+    { 23, 1, 0, 0xFD3, 0x1438, 18 },
+    { 20, 1, 0, 0xFCA, 0x15F1, 22 },
+    { 21, 1, 0, 0x1064, 0x1608, 19 },
+    { 22, 1, 0, 0x10FE, 0x161C, 26 },
+    { 23, 1, 0, 0x1169, 0x152A, 26 },
+    { 10, 1, 0, 0x515, 0x960, 27 },
+    { 2, 1, 0, 0xB7E, 0x10F5, 18 },
+    { 3, 1, 0, 0xC03, 0x10E0, 20 },
+    { 4, 1, 0, 0xC86, 0x1108, 18 },
+    { 2, 1, 0, 0xBEE, 0x11EF, 23 },
+    { 3, 1, 0, 0xC73, 0x1207, 19 },
+    { 4, 1, 0, 0xCFF, 0x121B, 33 },
+    { 2, 1, 0, 0x1162, 0x18AC, 24 },
+    { 3, 1, 0, 0x11E7, 0x18C5, 23 },
+    { 4, 1, 0, 0x126C, 0x18DD, 20 },
+    { 3, 1, 1, 0xBAC, 0x1C9E, 24 },
+    { 3, 1, 1, 0xBCA, 0x1CB7, 19 },
+    { 3, 1, 1, 0xBE2, 0x1CCB, 18 },
+    { 4, 1, 1, 0xDD8, 0x1C53, 22 },
+    { 4, 1, 1, 0xDF0, 0x1C6A, 23 },
+    { 5, 1, 1, 0xF8E, 0x1D15, 23 },
+    { 5, 1, 1, 0xFC2, 0x1D2D, 26 },
+    { 5, 1, 1, 0xFED, 0x1D7A, 24 },
+    { 6, 1, 1, 0x117C, 0x1DD5, 24 },
+    { 6, 1, 1, 0x119A, 0x1DEE, 26 },
+    { 6, 1, 1, 0x11B2, 0x1E09, 18 },
+    { 7, 1, 1, 0x14EB, 0x214B, 27 },
+    { 7, 1, 1, 0x1519, 0x21A9, 19 },
+    { 8, 1, 1, 0x16A7, 0x1E59, 18 },
+    { 8, 1, 1, 0x16C5, 0x1E6C, 18 },
+    { 8, 1, 1, 0x16DD, 0x1E7F, 20 },
+    { 9, 1, 1, 0x1845, 0x1EDA, 24 },
+    { 10, 1, 0, 0x144B, 0x17BD, 23 },
+};
 
-    addShop(0, {257, 161, 20});
-    addShop(1, {0, 7, 8, 70});
-    addShop(2, {0, 7, 8, 561, 562, 564, 565});
-    addShop(3, {258, 20});
-    addShop(4, {0, 7, 8, 70});
-    addShop(5, {561, 562, 564, 565});
-    addShop(6, {191, 145, 161, 258, 259});
-    addShop(7, {561, 562, 564, 565, 528});
-    addShop(8, {0, 7, 8, 12, 52, 13, 14, 1, 70});
-    addShop(9, {0, 7, 8, 20, 13, 14, 70});
-    addShop(10, {0, 7, 8, 52, 70});
-    addShop(11, {129, 162, 146, 192, 259});
-    addShop(12, {0, 7, 8, 52, 13, 14, 70});
-    addShop(13, {563, 572, 548, 549, 566});
-    addShop(14, {64, 65, 66, 67, 68, 69});
-    addShop(15, {81, 82, 83, 84, 64, 65, 66, 67, 68, 69});
-    addShop(16, {0, 7, 13, 14, 70});
-    addShop(17, {561, 564, 562, 565});
-    addShop(18, {259, 0, 7, 20, 70});
-    addShop(19, {129, 162, 146, 192, 176});
-    addShop(20, {0, 1, 7, 8, 52, 12, 13, 14, 70});
-    addShop(21, {549, 568, 565, 566, 567});
-    addShop(22, {130, 147, 163, 193, 177, 216});
-    addShop(23, {299, 300});
-    addShop(24, {561, 562, 564, 563, 572});
-    addShop(25, {0, 7});
-    addShop(26, {265, 260, 277, 53});
-    addShop(27, {566, 567, 565, 568, 561, 562, 564});
-    addShop(28, {0, 1, 7, 9, 8, 52, 13, 14, 70});
-    addShop(29, {260, 135, 53});
-    addShop(30, {0, 7, 70});
-    addShop(31, {570, 10, 11, 9, 13, 14});
-    addShop(32, {0, 7, 3, 8, 10, 11, 9, 12, 13, 14});
-    addShop(33, {0, 7, 70});
-    addShop(34, {130, 147, 163, 193, 177, 216, 50, 51, 53});
-    addShop(35, {0, 1, 7, 70, 10, 11, 9, 13, 14});
-    addShop(36, {300, 299, 298, 291, 303, 312, 569, 577, 566, 570});
-    addShop(37, {131, 148, 164, 194, 178, 217, 230, 261});
-    addShop(38, {0, 1, 7, 3, 70, 10, 11, 9, 13, 14});
-    addShop(39, {512, 513, 569, 570});
-    addShop(40, {0, 1, 7, 70});
-    addShop(41, {243, 262, 288, 289, 290, 291});
-    addShop(42, {0, 1, 7, 3, 13, 14, 70, 574, 571, 577});
-    addShop(43, {137, 149, 165, 195, 179, 202, 231, 218, 244});
-    addShop(44, {1, 7, 3, 13, 14, 70, 31, 35, 292});
-    addShop(45, {0, 1, 7, 3, 13, 14, 10, 70});
-    addShop(46, {133, 150, 166, 180, 219, 232, 204, 245, 70, 1});
-    addShop(47, {134, 151, 167, 181, 220, 233, 205, 246, 264, 268});
-    addShop(48, {293, 307, 308, 309, 301, 302, 303});
-    addShop(49, {1, 7, 3, 13, 14, 15, 70});
-    addShop(50, {513, 512, 570, 573, 580});
-    addShop(51, {1, 7, 3, 13, 14, 70, 54});
-    addShop(52, {551, 554, 553, 580, 535});
-    addShop(53, {79, 80, 62, 63});
-    addShop(54, {163, 147, 193, 177, 216, 229, 201, 203, 242});
-    addShop(55, {221, 222, 206, 210, 247, 248, 182, 183, 196, 197});
-    addShop(56, {515, 567, 512, 574, 571, 535});
-    addShop(57, {136, 132, 168, 169, 153, 154, 198});
-    addShop(58, {265, 156, 172, 225, 234, 235, 236, 251});
-    addShop(59, {138, 171, 155, 185, 224, 237, 209, 250});
-    addShop(60, {170, 184, 223, 249, 238, 54});
-    addShop(61, {561, 562, 564, 563, 573, 572});
-    addShop(62, {0, 1, 7, 3, 13, 14, 70});
-    addShop(63, {54, 262, 267, 288, 289, 290, 291, 305, 311});
-    addShop(64, {1, 7, 3, 70, 574, 571, 577, 551, 553, 554});
-    addShop(65, {263, 266, 0, 1, 7, 3, 13, 14, 70});
-    addShop(66, {0, 1, 7, 3, 70});
-    addShop(67, {0, 1, 7, 3, 70});
-    addShop(68, {0, 1, 7, 3, 70});
-    addShop(69, {0, 1, 7, 3, 70});
-    addShop(70, {0, 1, 7, 3, 70});
-    addShop(71, {0, 1, 7, 3, 70});
-    addShop(72, {0, 1, 7, 3, 70});
-    addShop(73, {0, 1, 7, 3, 70});
-    addShop(74, {0, 1, 7, 3, 70});
-    addShop(75, {0, 1, 7, 3, 70});
-    addShop(76, {0, 1, 7, 3, 70});
-    addShop(77, {0, 1, 7, 3, 70});
-    addShop(78, {0, 1, 7, 3, 70});
-    addShop(79, {0, 1, 7, 3, 0});
+static constexpr FieldScriptShop fieldScriptShops[] = {
+    { 4, 1, 0x607, 53 },
+    { 4, 1, 0x737, 53 },
+    { 14, 1, 0x1B73, 14 },
+    { 9, 1, 0x4D6, 0 },
+    { 4, 1, 0x263, 2 },
+    { 19, 1, 0x12BB, 9 },
+    { 4, 1, 0x366, 3 },
+    { 4, 1, 0x384, 3 },
+    { 4, 1, 0x39A, 3 },
+    { 7, 4, 0x4A3, 3 },
+    { 7, 4, 0x4C1, 3 },
+    { 7, 4, 0x4D7, 3 },
+    { 4, 1, 0x285, 4 },
+    { 4, 1, 0x29B, 4 },
+    { 4, 4, 0x2FB, 4 },
+    { 4, 4, 0x311, 4 },
+    { 6, 1, 0x371, 5 },
+    { 6, 1, 0x38F, 5 },
+    { 6, 1, 0x3A5, 5 },
+    { 6, 4, 0x43F, 5 },
+    { 6, 4, 0x45D, 5 },
+    { 6, 4, 0x473, 5 },
+    { 8, 1, 0x4B3, 6 },
+    { 5, 1, 0x3A6, 7 },
+    { 7, 3, 0x438, 8 },
+    { 7, 3, 0x4EA, 8 },
+    { 7, 4, 0x5EE, 8 },
+    { 15, 4, 0xA7C, 10 },
+    { 15, 4, 0xA9B, 10 },
+    { 15, 4, 0xB08, 10 },
+    { 11, 1, 0x67F, 40 },
+    { 12, 1, 0x670, 11 },
+    { 13, 1, 0x6A5, 13 },
+    { 8, 1, 0x409, 12 },
+    { 5, 1, 0x1119, 14 },
+    { 5, 1, 0x1140, 14 },
+    { 5, 1, 0x11E1, 14 },
+    { 5, 1, 0x123A, 15 },
+    { 27, 1, 0x398C, 52 },
+    { 27, 1, 0x3992, 17 },
+    { 28, 3, 0x3A87, 51 },
+    { 28, 3, 0x3A8D, 16 },
+    { 8, 1, 0x351, 54 },
+    { 8, 1, 0x36A, 19 },
+    { 8, 1, 0x34A, 55 },
+    { 8, 1, 0x380, 20 },
+    { 8, 1, 0x353, 21 },
+    { 8, 1, 0x36C, 21 },
+    { 9, 1, 0x586, 57 },
+    { 9, 1, 0x5A5, 22 },
+    { 9, 1, 0x5C4, 22 },
+    { 9, 1, 0x5E3, 22 },
+    { 8, 1, 0x39E, 23 },
+    { 9, 1, 0x3F5, 58 },
+    { 14, 1, 0x71B, 59 },
+    { 14, 1, 0x744, 24 },
+    { 2, 4, 0x268, 18 },
+    { 16, 1, 0x1498, 25 },
+    { 13, 1, 0x9EC, 27 },
+    { 16, 1, 0xC22, 62 },
+    { 16, 1, 0xC3B, 28 },
+    { 17, 3, 0xD1F, 61 },
+    { 17, 3, 0xD48, 27 },
+    { 17, 3, 0xD65, 27 },
+    { 17, 3, 0xD82, 27 },
+    { 13, 1, 0x83E, 60 },
+    { 13, 1, 0x857, 26 },
+    { 5, 4, 0xA6A, 29 },
+    { 6, 4, 0xA98, 30 },
+    { 21, 9, 0x122B, 31 },
+    { 3, 4, 0x85E, 29 },
+    { 5, 1, 0x2FD, 33 },
+    { 4, 1, 0x410, 32 },
+    { 8, 1, 0x512, 36 },
+    { 8, 1, 0x494, 34 },
+    { 8, 1, 0x424, 35 },
+    { 4, 1, 0x319, 37 },
+    { 4, 3, 0x351, 37 },
+    { 5, 1, 0x373, 39 },
+    { 5, 1, 0x389, 39 },
+    { 5, 1, 0x3BB, 39 },
+    { 5, 1, 0x428, 39 },
+    { 5, 1, 0x457, 39 },
+    { 5, 1, 0x46D, 39 },
+    { 5, 3, 0x4B5, 39 },
+    { 5, 3, 0x4CB, 39 },
+    { 5, 3, 0x4FD, 39 },
+    { 5, 3, 0x56A, 39 },
+    { 5, 3, 0x599, 39 },
+    { 5, 3, 0x5AF, 39 },
+    { 5, 1, 0x36C, 38 },
+    { 5, 1, 0x399, 38 },
+    { 5, 3, 0x3BD, 38 },
+    { 5, 4, 0x3EC, 38 },
+    { 16, 1, 0x73F, 63 },
+    { 16, 1, 0x745, 41 },
+    { 15, 1, 0x787, 64 },
+    { 15, 1, 0x78D, 42 },
+    { 5, 3, 0x378, 43 },
+    { 5, 3, 0x422, 44 },
+    { 16, 1, 0x7EC, 45 },
+    { 4, 1, 0x686, 65 },
+    { 3, 1, 0x409, 46 },
+    { 4, 1, 0x43F, 46 },
+    { 5, 1, 0x491, 46 },
+    { 6, 1, 0x4C1, 46 },
+    { 2, 1, 0x9B3, 49 },
+    { 2, 1, 0x9C0, 47 },
+    { 2, 1, 0x9CD, 50 },
+    { 2, 1, 0x9F4, 47 },
+    { 13, 1, 0x104A, 1 },
+    { 14, 1, 0x109A, 5 },
+    { 20, 1, 0x11C3, 48 },
+    { 8, 1, 0xAD4, 47 },
+    { 8, 3, 0xB30, 47 },
+    { 8, 1, 0x66E, 49 },
+    { 8, 3, 0x6CA, 49 },
+    { 8, 1, 0x66F, 50 },
+    { 8, 3, 0x6D4, 50 },
+    { 13, 1, 0x5F4, 48 },
+};
 
-    addBattleScene(7, 19, 65535, 65535, 7, 255, 255);
-    addBattleFormation(7, 28, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(7, 29, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(7, 30, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(7, 31, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(8, 72, 73, 74, 13, 15, 10);
-    addBattleFormation(8, 32, false, {72, 65535, 65535, 65535, 65535, 65535}, {472, 474, 476, 479});
-    addBattleFormation(8, 33, false, {73, 73, 65535, 65535, 65535, 65535}, {473, 477, 478, 484});
-    addBattleFormation(8, 34, false, {74, 74, 72, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(8, 35, false, {72, 72, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(9, 73, 74, 75, 15, 10, 12);
-    addBattleFormation(9, 36, false, {74, 75, 75, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(9, 37, false, {73, 73, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(9, 38, false, {74, 74, 74, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(9, 39, false, {74, 74, 75, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(10, 72, 74, 75, 13, 10, 12);
-    addBattleFormation(10, 40, false, {72, 72, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(10, 41, false, {74, 74, 74, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(10, 42, false, {74, 75, 75, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(10, 43, false, {75, 74, 74, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(11, 74, 75, 65535, 10, 12, 255);
-    addBattleFormation(11, 44, false, {74, 74, 74, 65535, 65535, 65535}, {472, 474, 476, 479});
-    addBattleFormation(11, 45, false, {74, 74, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(11, 46, false, {74, 75, 74, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(11, 47, false, {75, 75, 74, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(12, 77, 78, 80, 12, 255, 14);
-    addBattleFormation(12, 48, false, {80, 77, 78, 77, 78, 65535}, {473, 477, 478, 484});
-    addBattleFormation(12, 49, false, {80, 80, 80, 65535, 65535, 65535}, {472, 474, 476, 479});
-    addBattleFormation(12, 50, false, {80, 80, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(12, 51, false, {80, 80, 80, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(13, 76, 79, 80, 14, 10, 14);
-    addBattleFormation(13, 52, false, {79, 79, 79, 79, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(13, 53, false, {76, 76, 65535, 65535, 65535, 65535}, {472, 474, 476, 479});
-    addBattleFormation(13, 54, false, {80, 76, 76, 65535, 65535, 65535}, {473, 477, 478, 484});
-    addBattleFormation(13, 55, false, {80, 79, 79, 76, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(14, 79, 80, 339, 10, 14, 13);
-    addBattleFormation(14, 56, false, {339, 79, 79, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(14, 57, false, {79, 339, 80, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(14, 58, false, {80, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(14, 59, false, {80, 80, 65535, 65535, 65535, 65535}, {473, 477, 478, 484});
-    addBattleScene(15, 76, 80, 340, 14, 14, 16);
-    addBattleFormation(15, 60, false, {340, 80, 80, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(15, 61, false, {76, 340, 76, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(15, 62, false, {76, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(15, 63, false, {76, 76, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(16, 86, 87, 89, 17, 16, 16);
-    addBattleFormation(16, 64, false, {87, 87, 65535, 65535, 65535, 65535}, {70, 85, 497, 102});
-    addBattleFormation(16, 65, false, {87, 87, 89, 65535, 65535, 65535}, {70, 85, 497, 102});
-    addBattleFormation(16, 66, false, {86, 65535, 65535, 65535, 65535, 65535}, {70, 85, 497, 102});
-    addBattleFormation(16, 67, false, {86, 87, 87, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(17, 87, 88, 89, 16, 18, 16);
-    addBattleFormation(17, 68, false, {87, 87, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(17, 69, false, {87, 87, 87, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(17, 70, false, {88, 65535, 65535, 65535, 65535, 65535}, {0, 0, 0, 0});
-    addBattleFormation(17, 71, false, {89, 89, 65535, 65535, 65535, 65535}, {70, 85, 497, 102});
-    addBattleScene(18, 86, 89, 90, 17, 16, 15);
-    addBattleFormation(18, 72, false, {86, 65535, 65535, 65535, 65535, 65535}, {70, 85, 497, 102});
-    addBattleFormation(18, 73, false, {86, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(18, 74, false, {89, 89, 89, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(18, 75, false, {90, 90, 90, 90, 90, 65535}, {70, 85, 497, 102});
-    addBattleScene(19, 90, 341, 65535, 15, 19, 255);
-    addBattleFormation(19, 76, false, {90, 90, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(19, 77, false, {90, 90, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(19, 78, false, {90, 90, 90, 341, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(19, 79, false, {341, 90, 90, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(20, 87, 90, 341, 16, 15, 19);
-    addBattleFormation(20, 80, false, {87, 87, 341, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(20, 81, false, {90, 90, 341, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(20, 82, false, {87, 87, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(20, 83, false, {87, 90, 90, 65535, 65535, 65535}, {70, 85, 497, 102});
-    addBattleScene(21, 96, 97, 98, 16, 15, 14);
-    addBattleFormation(21, 84, false, {98, 98, 98, 97, 96, 65535}, {999, 999, 999, 999});
-    addBattleFormation(21, 85, false, {98, 98, 98, 97, 96, 65535}, {0, 0, 0, 0});
-    addBattleFormation(21, 86, false, {98, 98, 98, 97, 96, 65535}, {999, 999, 999, 999});
-    addBattleFormation(21, 87, false, {98, 98, 98, 97, 96, 65535}, {999, 999, 999, 999});
-    addBattleScene(22, 101, 104, 65535, 17, 17, 255);
-    addBattleFormation(22, 88, false, {101, 101, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(22, 89, false, {104, 101, 101, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(22, 90, false, {101, 101, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(22, 91, false, {101, 101, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(23, 99, 113, 65535, 16, 17, 255);
-    addBattleFormation(23, 92, false, {99, 99, 99, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(23, 93, false, {99, 99, 99, 99, 65535, 65535}, {70, 85, 497, 102});
-    addBattleFormation(23, 94, false, {99, 99, 99, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(23, 95, false, {113, 113, 65535, 65535, 65535, 65535}, {108, 109, 110, 136});
-    addBattleScene(24, 113, 115, 344, 17, 18, 29);
-    addBattleFormation(24, 96, false, {113, 113, 113, 115, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(24, 97, false, {115, 115, 115, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(24, 98, false, {344, 115, 115, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(24, 99, false, {113, 113, 344, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(25, 114, 115, 116, 18, 18, 18);
-    addBattleFormation(25, 100, false, {114, 114, 65535, 65535, 65535, 65535}, {113, 114, 492, 494});
-    addBattleFormation(25, 101, false, {114, 115, 115, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(25, 102, false, {116, 65535, 65535, 65535, 65535, 65535}, {0, 0, 0, 0});
-    addBattleFormation(25, 103, false, {116, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(26, 115, 116, 343, 18, 18, 22);
-    addBattleFormation(26, 104, false, {115, 115, 343, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(26, 105, false, {343, 116, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(26, 106, false, {116, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(26, 107, false, {115, 115, 115, 115, 65535, 65535}, {108, 109, 110, 136});
-    addBattleScene(27, 117, 118, 65535, 19, 19, 255);
-    addBattleFormation(27, 108, false, {117, 65535, 65535, 65535, 65535, 65535}, {528, 534, 538, 115});
-    addBattleFormation(27, 109, false, {118, 118, 65535, 65535, 65535, 65535}, {528, 534, 538, 115});
-    addBattleFormation(27, 110, false, {117, 117, 65535, 65535, 65535, 65535}, {528, 534, 538, 115});
-    addBattleFormation(27, 111, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(28, 118, 119, 65535, 19, 18, 255);
-    addBattleFormation(28, 112, false, {118, 118, 118, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(28, 113, false, {118, 118, 118, 65535, 65535, 65535}, {529, 530, 532, 536});
-    addBattleFormation(28, 114, false, {118, 118, 65535, 65535, 65535, 65535}, {529, 530, 532, 536});
-    addBattleFormation(28, 115, false, {118, 119, 119, 65535, 65535, 65535}, {120, 125, 126, 129});
-    addBattleScene(29, 113, 115, 119, 17, 18, 18);
-    addBattleFormation(29, 116, false, {119, 119, 119, 119, 119, 119}, {999, 999, 999, 999});
-    addBattleFormation(29, 117, false, {115, 65535, 65535, 65535, 65535, 65535}, {113, 114, 492, 494});
-    addBattleFormation(29, 118, false, {115, 115, 65535, 65535, 65535, 65535}, {113, 114, 492, 494});
-    addBattleFormation(29, 119, false, {113, 113, 113, 115, 65535, 65535}, {113, 114, 492, 494});
-    addBattleScene(30, 130, 132, 133, 21, 19, 20);
-    addBattleFormation(30, 120, false, {132, 132, 132, 65535, 65535, 65535}, {124, 540, 543, 553});
-    addBattleFormation(30, 121, false, {130, 65535, 65535, 65535, 65535, 65535}, {542, 545, 548, 554});
-    addBattleFormation(30, 122, false, {133, 133, 65535, 65535, 65535, 65535}, {542, 545, 548, 554});
-    addBattleFormation(30, 123, false, {132, 132, 132, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(31, 129, 130, 131, 20, 21, 24);
-    addBattleFormation(31, 124, false, {129, 129, 129, 65535, 65535, 65535}, {144, 146, 148, 150});
-    addBattleFormation(31, 125, false, {130, 65535, 65535, 65535, 65535, 65535}, {124, 540, 543, 553});
-    addBattleFormation(31, 126, false, {131, 65535, 65535, 65535, 65535, 65535}, {124, 540, 543, 553});
-    addBattleFormation(31, 127, false, {129, 129, 130, 65535, 65535, 65535}, {542, 545, 548, 554});
-    addBattleScene(32, 129, 133, 65535, 20, 20, 255);
-    addBattleFormation(32, 128, false, {133, 133, 133, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(32, 129, false, {133, 133, 65535, 65535, 65535, 65535}, {124, 540, 543, 553});
-    addBattleFormation(32, 130, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(32, 131, false, {129, 129, 129, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(33, 120, 129, 133, 20, 20, 20);
-    addBattleFormation(33, 132, false, {129, 129, 129, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(33, 133, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(33, 134, false, {120, 120, 65535, 65535, 65535, 65535}, {542, 545, 548, 554});
-    addBattleFormation(33, 135, false, {120, 120, 120, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(34, 120, 65535, 65535, 20, 255, 255);
-    addBattleFormation(34, 136, false, {120, 65535, 65535, 65535, 65535, 65535}, {528, 534, 538, 115});
-    addBattleFormation(34, 137, false, {120, 120, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(34, 138, false, {120, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(34, 139, false, {120, 120, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(35, 140, 143, 65535, 23, 24, 255);
-    addBattleFormation(35, 140, false, {140, 140, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(35, 141, false, {143, 140, 140, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(35, 142, false, {143, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(35, 143, false, {140, 140, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(36, 142, 143, 144, 23, 24, 24);
-    addBattleFormation(36, 144, false, {142, 142, 65535, 65535, 65535, 65535}, {569, 582, 589, 592});
-    addBattleFormation(36, 145, false, {144, 144, 144, 144, 143, 65535}, {568, 581, 584, 596});
-    addBattleFormation(36, 146, false, {144, 144, 144, 144, 144, 144}, {569, 582, 589, 592});
-    addBattleFormation(36, 147, false, {142, 142, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(37, 140, 141, 65535, 23, 26, 255);
-    addBattleFormation(37, 148, false, {140, 140, 140, 65535, 65535, 65535}, {569, 582, 589, 592});
-    addBattleFormation(37, 149, false, {141, 141, 65535, 65535, 65535, 65535}, {568, 581, 584, 596});
-    addBattleFormation(37, 150, false, {140, 140, 141, 65535, 65535, 65535}, {569, 582, 589, 592});
-    addBattleFormation(37, 151, false, {140, 140, 141, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(38, 143, 161, 342, 24, 24, 22);
-    addBattleFormation(38, 152, false, {342, 143, 143, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(38, 153, false, {161, 161, 342, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(38, 154, false, {161, 161, 161, 161, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(38, 155, false, {143, 143, 143, 65535, 65535, 65535}, {568, 581, 584, 596});
-    addBattleScene(39, 141, 161, 342, 26, 24, 22);
-    addBattleFormation(39, 156, false, {342, 141, 161, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(39, 157, false, {141, 141, 342, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(39, 158, false, {141, 141, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(39, 159, false, {141, 141, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(40, 168, 171, 347, 27, 28, 30);
-    addBattleFormation(40, 160, false, {171, 168, 168, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(40, 161, false, {168, 168, 168, 168, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(40, 162, false, {347, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(40, 163, false, {168, 168, 168, 347, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(41, 169, 171, 347, 27, 28, 30);
-    addBattleFormation(41, 164, false, {169, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(41, 165, false, {171, 171, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(41, 166, false, {347, 171, 171, 171, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(41, 167, false, {347, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(42, 167, 170, 171, 28, 28, 28);
-    addBattleFormation(42, 168, false, {167, 167, 167, 167, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(42, 169, false, {170, 170, 167, 167, 167, 65535}, {999, 999, 999, 999});
-    addBattleFormation(42, 170, false, {171, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(42, 171, false, {171, 170, 170, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(43, 167, 170, 171, 28, 28, 28);
-    addBattleFormation(43, 172, false, {167, 167, 167, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(43, 173, false, {171, 171, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(43, 174, false, {170, 170, 170, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(43, 175, false, {171, 167, 170, 170, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(44, 170, 171, 172, 28, 28, 30);
-    addBattleFormation(44, 176, false, {170, 170, 170, 170, 170, 65535}, {999, 999, 999, 999});
-    addBattleFormation(44, 177, false, {170, 170, 171, 65535, 65535, 65535}, {636, 640, 645, 651});
-    addBattleFormation(44, 178, false, {170, 170, 170, 171, 171, 65535}, {999, 999, 999, 999});
-    addBattleFormation(44, 179, false, {172, 65535, 65535, 65535, 65535, 65535}, {641, 642, 647, 650});
-    addBattleScene(45, 185, 187, 65535, 29, 30, 255);
-    addBattleFormation(45, 180, false, {185, 65535, 65535, 65535, 65535, 65535}, {636, 640, 645, 651});
-    addBattleFormation(45, 181, false, {187, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(45, 182, false, {187, 187, 65535, 65535, 65535, 65535}, {177, 180, 187, 189});
-    addBattleFormation(45, 183, false, {187, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(46, 185, 188, 65535, 29, 30, 255);
-    addBattleFormation(46, 184, false, {185, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(46, 185, false, {185, 185, 65535, 65535, 65535, 65535}, {641, 642, 647, 650});
-    addBattleFormation(46, 186, false, {188, 65535, 65535, 65535, 65535, 65535}, {641, 642, 647, 650});
-    addBattleFormation(46, 187, false, {188, 65535, 65535, 65535, 65535, 65535}, {636, 640, 645, 651});
-    addBattleScene(47, 124, 186, 65535, 29, 30, 255);
-    addBattleFormation(47, 188, false, {124, 124, 124, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(47, 189, false, {124, 124, 124, 124, 124, 65535}, {636, 640, 645, 651});
-    addBattleFormation(47, 190, false, {186, 186, 65535, 65535, 65535, 65535}, {641, 642, 647, 650});
-    addBattleFormation(47, 191, false, {124, 124, 124, 124, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(48, 197, 198, 199, 33, 24, 255);
-    addBattleFormation(48, 192, false, {197, 65535, 65535, 65535, 65535, 65535}, {672, 692, 696, 210});
-    addBattleFormation(48, 193, false, {198, 199, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(48, 194, false, {198, 199, 198, 199, 65535, 65535}, {672, 692, 696, 210});
-    addBattleFormation(48, 195, false, {198, 199, 198, 199, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(49, 197, 211, 65535, 33, 30, 255);
-    addBattleFormation(49, 196, false, {197, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(49, 197, false, {211, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(49, 198, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(49, 199, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(50, 209, 349, 65535, 24, 33, 255);
-    addBattleFormation(50, 200, false, {209, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(50, 201, false, {209, 209, 65535, 65535, 65535, 65535}, {673, 674, 680, 694});
-    addBattleFormation(50, 202, false, {349, 209, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(50, 203, false, {349, 209, 209, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(51, 209, 211, 349, 24, 30, 33);
-    addBattleFormation(51, 204, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(51, 205, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(51, 206, false, {349, 211, 209, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(51, 207, false, {211, 211, 349, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(52, 205, 207, 209, 40, 34, 24);
-    addBattleFormation(52, 208, false, {207, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(52, 209, false, {205, 205, 65535, 65535, 65535, 65535}, {673, 674, 680, 694});
-    addBattleFormation(52, 210, false, {209, 209, 209, 65535, 65535, 65535}, {705, 713, 727, 732});
-    addBattleFormation(52, 211, false, {209, 209, 209, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(53, 276, 278, 350, 37, 39, 36);
-    addBattleFormation(53, 212, false, {276, 65535, 65535, 65535, 65535, 65535}, {673, 674, 680, 694});
-    addBattleFormation(53, 213, false, {278, 278, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(53, 214, false, {278, 350, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(53, 215, false, {278, 278, 350, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(54, 277, 350, 65535, 30, 36, 255);
-    addBattleFormation(54, 216, false, {277, 277, 277, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(54, 217, false, {277, 277, 277, 277, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(54, 218, false, {350, 277, 277, 277, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(54, 219, false, {350, 277, 277, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(55, 276, 278, 65535, 37, 39, 255);
-    addBattleFormation(55, 220, false, {278, 278, 278, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(55, 221, false, {278, 278, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(55, 222, false, {276, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(55, 223, false, {278, 278, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(56, 277, 279, 280, 30, 37, 22);
-    addBattleFormation(56, 224, false, {279, 279, 279, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(56, 225, false, {277, 277, 277, 277, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(56, 226, false, {277, 277, 277, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(56, 227, false, {280, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(57, 185, 187, 337, 29, 30, 40);
-    addBattleFormation(57, 228, false, {337, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(57, 229, false, {187, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(57, 230, false, {187, 187, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(57, 231, false, {185, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(58, 188, 280, 338, 30, 22, 40);
-    addBattleFormation(58, 232, false, {280, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(58, 233, false, {188, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(58, 234, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(58, 235, false, {338, 338, 338, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(59, 338, 65535, 65535, 40, 255, 255);
-    addBattleFormation(59, 236, false, {338, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(59, 237, false, {338, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(59, 238, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(59, 239, false, {338, 338, 338, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(60, 338, 65535, 65535, 40, 255, 255);
-    addBattleFormation(60, 240, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(60, 241, false, {338, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(60, 242, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(60, 243, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(61, 133, 65535, 65535, 20, 255, 255);
-    addBattleFormation(61, 244, false, {133, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(61, 245, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(61, 246, false, {133, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(61, 247, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(62, 19, 65535, 65535, 7, 255, 255);
-    addBattleFormation(62, 248, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(62, 249, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(62, 250, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(62, 251, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(63, 19, 65535, 65535, 7, 255, 255);
-    addBattleFormation(63, 252, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(63, 253, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(63, 254, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(63, 255, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(64, 19, 364, 65535, 7, 20, 255);
-    addBattleFormation(64, 256, false, {364, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(64, 257, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(64, 258, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(64, 259, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(65, 99, 65535, 65535, 16, 255, 255);
-    addBattleFormation(65, 260, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(65, 261, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(65, 262, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(65, 263, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(66, 117, 65535, 65535, 19, 255, 255);
-    addBattleFormation(66, 264, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(66, 265, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(66, 266, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(66, 267, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(67, 353, 354, 65535, 17, 22, 255);
-    addBattleFormation(67, 268, false, {353, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(67, 269, false, {353, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(67, 270, false, {354, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(67, 271, false, {354, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(68, 355, 356, 65535, 27, 32, 255);
-    addBattleFormation(68, 272, false, {355, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(68, 273, false, {355, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(68, 274, false, {356, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(68, 275, false, {356, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(69, 357, 358, 65535, 37, 42, 255);
-    addBattleFormation(69, 276, false, {357, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(69, 277, false, {357, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(69, 278, false, {358, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(69, 279, false, {358, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(70, 333, 334, 335, 61, 61, 61);
-    addBattleFormation(70, 280, true, {333, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(70, 281, true, {335, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(70, 282, true, {335, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(70, 283, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(71, 334, 335, 336, 61, 61, 61);
-    addBattleFormation(71, 284, true, {335, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(71, 285, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(71, 286, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(71, 287, true, {336, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(72, 282, 283, 284, 19, 25, 37);
-    addBattleFormation(72, 288, true, {282, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(72, 289, true, {283, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(72, 290, true, {284, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(72, 291, true, {284, 284, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(73, 157, 334, 65535, 32, 61, 255);
-    addBattleFormation(73, 292, true, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(73, 293, true, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(73, 294, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(73, 295, false, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(74, 90, 358, 65535, 15, 42, 255);
-    addBattleFormation(74, 296, false, {358, 358, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(74, 297, false, {358, 358, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(74, 298, false, {358, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(74, 299, false, {90, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(75, 16, 17, 65535, 2, 3, 255);
-    addBattleFormation(75, 300, true, {16, 16, 65535, 65535, 65535, 65535}, {300, 300, 300, 300});
-    addBattleFormation(75, 301, false, {16, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(75, 302, false, {17, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(75, 303, false, {16, 17, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(76, 16, 17, 18, 2, 3, 2);
-    addBattleFormation(76, 304, false, {17, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(76, 305, false, {18, 18, 65535, 65535, 65535, 65535}, {360, 369, 376, 389});
-    addBattleFormation(76, 306, false, {16, 16, 18, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(76, 307, false, {16, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(77, 18, 19, 20, 2, 7, 4);
-    addBattleFormation(77, 308, false, {18, 18, 20, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(77, 309, false, {20, 20, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(77, 310, false, {19, 19, 65535, 65535, 65535, 65535}, {360, 369, 376, 389});
-    addBattleFormation(77, 311, false, {20, 19, 20, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(78, 18, 19, 20, 2, 7, 4);
-    addBattleFormation(78, 312, false, {20, 20, 20, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(78, 313, false, {19, 19, 19, 65535, 65535, 65535}, {360, 369, 376, 389});
-    addBattleFormation(78, 314, false, {18, 18, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(78, 315, false, {19, 19, 19, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(79, 18, 19, 65535, 2, 7, 255);
-    addBattleFormation(79, 316, false, {19, 19, 18, 18, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(79, 317, false, {19, 19, 18, 18, 18, 65535}, {999, 999, 999, 999});
-    addBattleFormation(79, 318, false, {19, 19, 19, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(79, 319, false, {19, 19, 18, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(80, 19, 21, 65535, 7, 8, 255);
-    addBattleFormation(80, 320, false, {21, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(80, 321, false, {21, 19, 19, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(80, 322, false, {19, 19, 21, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(80, 323, false, {19, 19, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(81, 17, 22, 23, 3, 12, 8);
-    addBattleFormation(81, 324, true, {22, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(81, 325, false, {17, 65535, 65535, 65535, 65535, 65535}, {360, 369, 376, 389});
-    addBattleFormation(81, 326, false, {17, 17, 65535, 65535, 65535, 65535}, {368, 377, 388, 395});
-    addBattleFormation(81, 327, false, {23, 65535, 65535, 65535, 65535, 65535}, {368, 377, 388, 395});
-    addBattleScene(82, 16, 26, 65535, 2, 6, 255);
-    addBattleFormation(82, 328, false, {16, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(82, 329, false, {16, 16, 16, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(82, 330, false, {16, 16, 16, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(82, 331, false, {26, 26, 65535, 65535, 65535, 65535}, {368, 377, 388, 395});
-    addBattleScene(83, 23, 24, 65535, 8, 5, 255);
-    addBattleFormation(83, 332, false, {24, 24, 24, 24, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(83, 333, false, {23, 23, 23, 65535, 65535, 65535}, {368, 377, 388, 395});
-    addBattleFormation(83, 334, false, {23, 23, 23, 23, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(83, 335, false, {23, 23, 23, 23, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(84, 23, 26, 65535, 8, 6, 255);
-    addBattleFormation(84, 336, false, {23, 23, 26, 26, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(84, 337, false, {26, 26, 26, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(84, 338, false, {26, 26, 26, 23, 23, 65535}, {999, 999, 999, 999});
-    addBattleFormation(84, 339, false, {23, 23, 23, 23, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(85, 24, 26, 27, 5, 6, 4);
-    addBattleFormation(85, 340, false, {24, 24, 24, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(85, 341, false, {24, 24, 27, 27, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(85, 342, false, {24, 27, 27, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(85, 343, false, {26, 27, 27, 27, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(86, 30, 31, 32, 9, 8, 4);
-    addBattleFormation(86, 344, false, {30, 30, 30, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(86, 345, false, {32, 32, 32, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(86, 346, false, {32, 32, 30, 30, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(86, 347, false, {31, 31, 30, 30, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(87, 30, 31, 32, 9, 8, 4);
-    addBattleFormation(87, 348, false, {31, 31, 31, 31, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(87, 349, false, {30, 30, 32, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(87, 350, false, {31, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(87, 351, false, {31, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(88, 29, 30, 32, 8, 9, 4);
-    addBattleFormation(88, 352, false, {30, 29, 29, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(88, 353, false, {29, 29, 32, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(88, 354, false, {30, 30, 30, 30, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(88, 355, false, {29, 29, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(89, 29, 31, 32, 8, 8, 4);
-    addBattleFormation(89, 356, false, {32, 32, 32, 32, 32, 65535}, {999, 999, 999, 999});
-    addBattleFormation(89, 357, false, {29, 29, 31, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(89, 358, false, {29, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(89, 359, false, {31, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(90, 27, 30, 31, 4, 9, 8);
-    addBattleFormation(90, 360, false, {27, 27, 27, 65535, 65535, 65535}, {396, 398, 399, 400});
-    addBattleFormation(90, 361, false, {30, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(90, 362, false, {31, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(90, 363, false, {31, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(91, 30, 33, 65535, 9, 15, 255);
-    addBattleFormation(91, 364, true, {33, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(91, 365, false, {33, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(91, 366, false, {33, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(91, 367, true, {30, 30, 30, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(92, 28, 65535, 65535, 6, 255, 255);
-    addBattleFormation(92, 368, false, {28, 28, 28, 65535, 65535, 65535}, {397, 401, 404, 411});
-    addBattleFormation(92, 369, false, {28, 28, 65535, 65535, 65535, 65535}, {396, 398, 399, 400});
-    addBattleFormation(92, 370, false, {28, 28, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(92, 371, false, {28, 28, 28, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(93, 16, 17, 29, 2, 3, 8);
-    addBattleFormation(93, 372, true, {16, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(93, 373, true, {17, 17, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(93, 374, false, {17, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(93, 375, true, {17, 17, 29, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(94, 25, 28, 34, 9, 6, 7);
-    addBattleFormation(94, 376, false, {25, 25, 65535, 65535, 65535, 65535}, {396, 398, 399, 400});
-    addBattleFormation(94, 377, false, {25, 28, 28, 65535, 65535, 65535}, {397, 401, 404, 411});
-    addBattleFormation(94, 378, false, {34, 34, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(94, 379, false, {34, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(95, 25, 44, 45, 9, 11, 11);
-    addBattleFormation(95, 380, false, {44, 45, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(95, 381, false, {25, 25, 25, 25, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(95, 382, false, {44, 45, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(95, 383, false, {25, 25, 25, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(96, 35, 36, 37, 8, 11, 18);
-    addBattleFormation(96, 384, true, {35, 35, 35, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(96, 385, true, {35, 35, 36, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(96, 386, true, {37, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(96, 387, true, {37, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(97, 38, 39, 65535, 10, 8, 255);
-    addBattleFormation(97, 388, false, {39, 39, 39, 65535, 65535, 65535}, {397, 401, 404, 411});
-    addBattleFormation(97, 389, false, {38, 38, 39, 65535, 65535, 65535}, {396, 398, 399, 400});
-    addBattleFormation(97, 390, false, {38, 38, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(97, 391, false, {38, 38, 38, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(98, 17, 18, 21, 3, 2, 8);
-    addBattleFormation(98, 392, false, {18, 18, 18, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(98, 393, false, {17, 17, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(98, 394, false, {18, 18, 18, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(98, 395, false, {21, 65535, 65535, 65535, 65535, 65535}, {397, 401, 404, 411});
-    addBattleScene(99, 41, 42, 43, 10, 8, 10);
-    addBattleFormation(99, 396, false, {42, 42, 43, 65535, 65535, 65535}, {427, 436, 444, 449});
-    addBattleFormation(99, 397, false, {43, 43, 65535, 65535, 65535, 65535}, {425, 428, 438, 445});
-    addBattleFormation(99, 398, false, {41, 41, 41, 65535, 65535, 65535}, {427, 436, 444, 449});
-    addBattleFormation(99, 399, false, {41, 43, 41, 65535, 65535, 65535}, {427, 436, 444, 449});
-    addBattleScene(100, 40, 41, 43, 12, 10, 10);
-    addBattleFormation(100, 400, false, {40, 65535, 65535, 65535, 65535, 65535}, {427, 436, 444, 449});
-    addBattleFormation(100, 401, false, {43, 43, 43, 65535, 65535, 65535}, {425, 428, 438, 445});
-    addBattleFormation(100, 402, false, {41, 41, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(100, 403, false, {41, 41, 41, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(101, 46, 47, 65535, 11, 11, 255);
-    addBattleFormation(101, 404, false, {46, 47, 46, 47, 65535, 65535}, {425, 428, 438, 445});
-    addBattleFormation(101, 405, false, {46, 47, 46, 47, 46, 47}, {999, 999, 999, 999});
-    addBattleFormation(101, 406, false, {46, 47, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(101, 407, false, {46, 47, 46, 47, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(102, 40, 46, 47, 12, 11, 11);
-    addBattleFormation(102, 408, false, {46, 47, 46, 47, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(102, 409, false, {46, 47, 46, 47, 46, 47}, {999, 999, 999, 999});
-    addBattleFormation(102, 410, false, {46, 47, 46, 47, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(102, 411, false, {40, 65535, 65535, 65535, 65535, 65535}, {425, 428, 438, 445});
-    addBattleScene(103, 48, 49, 60, 17, 2, 10);
-    addBattleFormation(103, 412, true, {48, 49, 49, 49, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(103, 413, true, {48, 49, 49, 49, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(103, 414, true, {48, 49, 49, 49, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(103, 415, true, {60, 60, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(104, 57, 58, 60, 12, 12, 10);
-    addBattleFormation(104, 416, false, {60, 60, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(104, 417, false, {60, 60, 60, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(104, 418, false, {60, 60, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(104, 419, false, {57, 58, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(105, 57, 58, 65535, 12, 12, 255);
-    addBattleFormation(105, 420, false, {57, 58, 57, 58, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(105, 421, false, {57, 58, 57, 58, 57, 58}, {999, 999, 999, 999});
-    addBattleFormation(105, 422, false, {57, 58, 57, 58, 57, 58}, {999, 999, 999, 999});
-    addBattleFormation(105, 423, false, {57, 58, 57, 58, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(106, 53, 54, 55, 12, 255, 11);
-    addBattleFormation(106, 424, false, {53, 54, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(106, 425, false, {55, 65535, 65535, 65535, 65535, 65535}, {33, 48, 54, 59});
-    addBattleFormation(106, 426, false, {53, 54, 53, 54, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(106, 427, false, {55, 55, 65535, 65535, 65535, 65535}, {32, 44, 49, 53});
-    addBattleScene(107, 53, 54, 55, 12, 255, 11);
-    addBattleFormation(107, 428, false, {55, 55, 55, 65535, 65535, 65535}, {33, 48, 54, 59});
-    addBattleFormation(107, 429, false, {53, 54, 53, 54, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(107, 430, false, {55, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(107, 431, false, {55, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(108, 50, 51, 52, 12, 8, 8);
-    addBattleFormation(108, 432, false, {50, 51, 52, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(108, 433, false, {50, 51, 52, 50, 51, 52}, {999, 999, 999, 999});
-    addBattleFormation(108, 434, false, {50, 51, 52, 50, 51, 52}, {999, 999, 999, 999});
-    addBattleFormation(108, 435, false, {50, 51, 52, 50, 51, 52}, {999, 999, 999, 999});
-    addBattleScene(109, 56, 59, 65535, 13, 13, 255);
-    addBattleFormation(109, 436, false, {59, 65535, 65535, 65535, 65535, 65535}, {32, 44, 49, 53});
-    addBattleFormation(109, 437, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(109, 438, false, {59, 59, 65535, 65535, 65535, 65535}, {33, 48, 54, 59});
-    addBattleFormation(109, 439, false, {59, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(110, 56, 59, 65535, 13, 13, 255);
-    addBattleFormation(110, 440, false, {56, 56, 56, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(110, 441, false, {59, 59, 59, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(110, 442, false, {59, 56, 56, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(110, 443, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(111, 61, 62, 65535, 15, 9, 255);
-    addBattleFormation(111, 444, false, {61, 61, 65535, 65535, 65535, 65535}, {32, 44, 49, 53});
-    addBattleFormation(111, 445, false, {61, 65535, 65535, 65535, 65535, 65535}, {33, 48, 54, 59});
-    addBattleFormation(111, 446, false, {62, 62, 62, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(111, 447, false, {61, 62, 62, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(112, 61, 62, 63, 15, 9, 14);
-    addBattleFormation(112, 448, false, {63, 63, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(112, 449, false, {62, 63, 65535, 65535, 65535, 65535}, {32, 44, 49, 53});
-    addBattleFormation(112, 450, false, {61, 61, 63, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(112, 451, false, {63, 63, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(113, 62, 63, 65535, 9, 14, 255);
-    addBattleFormation(113, 452, false, {63, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(113, 453, false, {62, 62, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(113, 454, false, {63, 63, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(113, 455, false, {62, 62, 62, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(114, 64, 65, 65535, 19, 7, 255);
-    addBattleFormation(114, 456, true, {65, 65, 65, 64, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(114, 457, false, {64, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(114, 458, false, {64, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(114, 459, false, {64, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(115, 66, 67, 65535, 18, 19, 255);
-    addBattleFormation(115, 460, true, {66, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(115, 461, true, {67, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(115, 462, false, {66, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(115, 463, false, {67, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(116, 68, 69, 70, 21, 18, 255);
-    addBattleFormation(116, 464, true, {68, 69, 70, 70, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(116, 465, true, {68, 69, 70, 70, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(116, 466, false, {68, 69, 70, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(116, 467, false, {68, 69, 70, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(117, 71, 81, 84, 19, 26, 18);
-    addBattleFormation(117, 468, true, {71, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(117, 469, false, {81, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(117, 470, false, {81, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(117, 471, false, {84, 84, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(118, 82, 83, 85, 16, 15, 15);
-    addBattleFormation(118, 472, false, {82, 82, 65535, 65535, 65535, 65535}, {64, 66, 75, 93});
-    addBattleFormation(118, 473, false, {82, 83, 83, 82, 83, 65535}, {65, 71, 72, 83});
-    addBattleFormation(118, 474, false, {85, 85, 85, 65535, 65535, 65535}, {64, 66, 75, 93});
-    addBattleFormation(118, 475, false, {83, 83, 83, 83, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(119, 83, 84, 85, 15, 18, 15);
-    addBattleFormation(119, 476, false, {83, 83, 83, 84, 65535, 65535}, {64, 66, 75, 93});
-    addBattleFormation(119, 477, false, {85, 85, 85, 85, 65535, 65535}, {65, 71, 72, 83});
-    addBattleFormation(119, 478, false, {85, 85, 84, 83, 65535, 65535}, {65, 71, 72, 83});
-    addBattleFormation(119, 479, false, {83, 83, 83, 83, 83, 65535}, {64, 66, 75, 93});
-    addBattleScene(120, 91, 92, 65535, 23, 4, 255);
-    addBattleFormation(120, 480, true, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(120, 481, false, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(120, 482, false, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(120, 483, false, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(121, 93, 94, 65535, 15, 16, 255);
-    addBattleFormation(121, 484, false, {93, 93, 93, 93, 65535, 65535}, {65, 71, 72, 83});
-    addBattleFormation(121, 485, false, {94, 94, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(121, 486, false, {94, 94, 94, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(121, 487, false, {93, 93, 93, 93, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(122, 95, 65535, 65535, 25, 255, 255);
-    addBattleFormation(122, 488, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(122, 489, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(122, 490, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(122, 491, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(123, 100, 101, 103, 16, 17, 16);
-    addBattleFormation(123, 492, false, {101, 101, 101, 65535, 65535, 65535}, {529, 530, 532, 536});
-    addBattleFormation(123, 493, false, {100, 100, 100, 101, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(123, 494, false, {101, 100, 103, 65535, 65535, 65535}, {529, 530, 532, 536});
-    addBattleFormation(123, 495, false, {101, 101, 101, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(124, 102, 103, 65535, 18, 16, 255);
-    addBattleFormation(124, 496, false, {102, 102, 102, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(124, 497, false, {103, 103, 65535, 65535, 65535, 65535}, {0, 0, 0, 0});
-    addBattleFormation(124, 498, false, {102, 102, 102, 102, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(124, 499, false, {102, 103, 102, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(125, 102, 104, 105, 18, 17, 18);
-    addBattleFormation(125, 500, false, {105, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(125, 501, false, {105, 105, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(125, 502, false, {104, 102, 102, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(125, 503, false, {104, 104, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(126, 101, 104, 65535, 17, 17, 255);
-    addBattleFormation(126, 504, false, {101, 101, 101, 104, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(126, 505, false, {104, 104, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(126, 506, false, {104, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(126, 507, false, {101, 101, 101, 101, 101, 65535}, {999, 999, 999, 999});
-    addBattleScene(127, 100, 101, 103, 16, 17, 16);
-    addBattleFormation(127, 508, false, {100, 100, 100, 100, 100, 65535}, {999, 999, 999, 999});
-    addBattleFormation(127, 509, false, {101, 101, 103, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(127, 510, false, {100, 100, 100, 101, 101, 65535}, {999, 999, 999, 999});
-    addBattleFormation(127, 511, false, {100, 100, 100, 100, 100, 65535}, {999, 999, 999, 999});
-    addBattleScene(128, 103, 104, 105, 16, 17, 18);
-    addBattleFormation(128, 512, false, {104, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(128, 513, false, {105, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(128, 514, false, {103, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(128, 515, false, {104, 104, 104, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(129, 107, 108, 65535, 18, 17, 255);
-    addBattleFormation(129, 516, false, {107, 108, 108, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(129, 517, false, {107, 107, 108, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(129, 518, false, {107, 107, 107, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(129, 519, false, {108, 108, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(130, 106, 107, 109, 19, 18, 19);
-    addBattleFormation(130, 520, false, {107, 107, 107, 107, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(130, 521, false, {106, 106, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(130, 522, false, {109, 109, 109, 109, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(130, 523, false, {106, 106, 109, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(131, 109, 110, 111, 19, 22, 23);
-    addBattleFormation(131, 524, false, {110, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(131, 525, false, {109, 65535, 65535, 65535, 65535, 65535}, {108, 109, 110, 136});
-    addBattleFormation(131, 526, false, {109, 109, 65535, 65535, 65535, 65535}, {108, 109, 110, 136});
-    addBattleFormation(131, 527, true, {111, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(132, 119, 125, 65535, 18, 19, 255);
-    addBattleFormation(132, 528, false, {125, 65535, 65535, 65535, 65535, 65535}, {120, 125, 126, 129});
-    addBattleFormation(132, 529, false, {119, 65535, 65535, 65535, 65535, 65535}, {121, 122, 127, 134});
-    addBattleFormation(132, 530, false, {125, 125, 65535, 65535, 65535, 65535}, {121, 122, 127, 134});
-    addBattleFormation(132, 531, false, {119, 119, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(133, 121, 122, 123, 19, 19, 19);
-    addBattleFormation(133, 532, false, {121, 122, 123, 65535, 65535, 65535}, {121, 122, 127, 134});
-    addBattleFormation(133, 533, false, {121, 122, 123, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(133, 534, false, {121, 122, 123, 65535, 65535, 65535}, {120, 125, 126, 129});
-    addBattleFormation(133, 535, false, {121, 122, 123, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(134, 126, 127, 128, 21, 22, 23);
-    addBattleFormation(134, 536, false, {126, 65535, 65535, 65535, 65535, 65535}, {121, 122, 127, 134});
-    addBattleFormation(134, 537, false, {126, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(134, 538, false, {126, 65535, 65535, 65535, 65535, 65535}, {120, 125, 126, 129});
-    addBattleFormation(134, 539, true, {127, 128, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(135, 135, 136, 65535, 21, 22, 255);
-    addBattleFormation(135, 540, false, {136, 136, 136, 136, 65535, 65535}, {144, 146, 148, 150});
-    addBattleFormation(135, 541, false, {135, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(135, 542, false, {136, 136, 135, 65535, 65535, 65535}, {145, 149, 155, 144});
-    addBattleFormation(135, 543, false, {135, 135, 135, 65535, 65535, 65535}, {144, 146, 148, 150});
-    addBattleScene(136, 134, 135, 136, 23, 21, 22);
-    addBattleFormation(136, 544, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(136, 545, false, {136, 136, 136, 136, 136, 65535}, {145, 149, 155, 144});
-    addBattleFormation(136, 546, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(136, 547, false, {134, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(137, 135, 136, 137, 21, 22, 25);
-    addBattleFormation(137, 548, false, {135, 136, 136, 136, 65535, 65535}, {145, 149, 155, 144});
-    addBattleFormation(137, 549, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(137, 550, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(137, 551, true, {137, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(138, 134, 138, 139, 23, 21, 29);
-    addBattleFormation(138, 552, false, {134, 134, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(138, 553, true, {134, 134, 65535, 65535, 65535, 65535}, {144, 146, 148, 150});
-    addBattleFormation(138, 554, true, {134, 134, 134, 65535, 65535, 65535}, {145, 149, 155, 144});
-    addBattleFormation(138, 555, true, {138, 138, 139, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(139, 146, 149, 150, 23, 26, 1);
-    addBattleFormation(139, 556, false, {146, 146, 146, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(139, 557, false, {146, 146, 146, 146, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(139, 558, false, {149, 150, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(139, 559, false, {149, 150, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(140, 145, 146, 147, 24, 23, 25);
-    addBattleFormation(140, 560, false, {146, 146, 146, 146, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(140, 561, false, {145, 145, 146, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(140, 562, false, {147, 147, 147, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(140, 563, false, {147, 145, 145, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(141, 145, 146, 148, 24, 23, 25);
-    addBattleFormation(141, 564, false, {146, 146, 148, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(141, 565, false, {146, 146, 145, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(141, 566, false, {148, 148, 148, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(141, 567, false, {148, 148, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(142, 148, 65535, 65535, 25, 255, 255);
-    addBattleFormation(142, 568, false, {148, 148, 148, 65535, 65535, 65535}, {558, 573, 591, 599});
-    addBattleFormation(142, 569, false, {148, 148, 148, 148, 65535, 65535}, {558, 573, 591, 599});
-    addBattleFormation(142, 570, false, {148, 148, 148, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(142, 571, false, {148, 148, 148, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(143, 151, 152, 153, 24, 24, 24);
-    addBattleFormation(143, 572, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(143, 573, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(143, 574, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(143, 575, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(144, 154, 155, 156, 35, 35, 35);
-    addBattleFormation(144, 576, true, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(144, 577, false, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(144, 578, false, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(144, 579, false, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(145, 158, 161, 65535, 26, 24, 255);
-    addBattleFormation(145, 580, false, {161, 161, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(145, 581, false, {161, 161, 161, 65535, 65535, 65535}, {558, 573, 591, 599});
-    addBattleFormation(145, 582, false, {158, 161, 161, 65535, 65535, 65535}, {558, 573, 591, 599});
-    addBattleFormation(145, 583, false, {158, 158, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(146, 158, 160, 65535, 26, 27, 255);
-    addBattleFormation(146, 584, false, {158, 158, 158, 65535, 65535, 65535}, {558, 573, 591, 599});
-    addBattleFormation(146, 585, false, {158, 158, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(146, 586, false, {160, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(146, 587, false, {158, 158, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(147, 158, 159, 160, 26, 25, 27);
-    addBattleFormation(147, 588, false, {159, 159, 158, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(147, 589, false, {159, 159, 159, 65535, 65535, 65535}, {558, 573, 591, 599});
-    addBattleFormation(147, 590, false, {158, 158, 158, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(147, 591, false, {160, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(148, 159, 162, 163, 25, 26, 38);
-    addBattleFormation(148, 592, false, {162, 159, 162, 65535, 65535, 65535}, {558, 573, 591, 599});
-    addBattleFormation(148, 593, false, {162, 162, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(148, 594, false, {162, 162, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(148, 595, true, {163, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(149, 157, 159, 161, 32, 25, 24);
-    addBattleFormation(149, 596, false, {161, 161, 161, 161, 161, 65535}, {558, 573, 591, 599});
-    addBattleFormation(149, 597, false, {159, 159, 159, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(149, 598, false, {159, 159, 161, 161, 161, 65535}, {999, 999, 999, 999});
-    addBattleFormation(149, 599, false, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(150, 164, 165, 166, 38, 255, 255);
-    addBattleFormation(150, 600, true, {164, 165, 166, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(150, 601, true, {164, 165, 166, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(150, 602, true, {164, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(150, 603, false, {164, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(151, 168, 170, 176, 27, 28, 28);
-    addBattleFormation(151, 604, false, {168, 168, 168, 65535, 65535, 65535}, {179, 185, 186, 190});
-    addBattleFormation(151, 605, false, {170, 170, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(151, 606, false, {176, 176, 170, 65535, 65535, 65535}, {179, 185, 186, 190});
-    addBattleFormation(151, 607, false, {168, 168, 168, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(152, 170, 174, 65535, 28, 27, 255);
-    addBattleFormation(152, 608, false, {174, 170, 170, 170, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(152, 609, false, {174, 174, 65535, 65535, 65535, 65535}, {179, 185, 186, 190});
-    addBattleFormation(152, 610, false, {174, 174, 174, 65535, 65535, 65535}, {179, 185, 186, 190});
-    addBattleFormation(152, 611, false, {174, 174, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(153, 175, 176, 65535, 29, 28, 255);
-    addBattleFormation(153, 612, false, {176, 176, 176, 175, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(153, 613, false, {175, 175, 65535, 65535, 65535, 65535}, {177, 180, 187, 189});
-    addBattleFormation(153, 614, false, {176, 176, 175, 65535, 65535, 65535}, {177, 180, 187, 189});
-    addBattleFormation(153, 615, false, {175, 175, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(154, 174, 175, 177, 27, 29, 39);
-    addBattleFormation(154, 616, false, {175, 175, 174, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(154, 617, false, {175, 175, 175, 65535, 65535, 65535}, {177, 180, 187, 189});
-    addBattleFormation(154, 618, false, {174, 174, 175, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(154, 619, true, {177, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(155, 173, 178, 65535, 34, 30, 255);
-    addBattleFormation(155, 620, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(155, 621, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(155, 622, true, {173, 173, 173, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(155, 623, true, {178, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(156, 179, 180, 181, 32, 34, 36);
-    addBattleFormation(156, 624, true, {179, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(156, 625, true, {180, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(156, 626, true, {181, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(156, 627, false, {181, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(157, 182, 65535, 65535, 41, 255, 255);
-    addBattleFormation(157, 628, true, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(157, 629, false, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(157, 630, false, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(157, 631, false, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(158, 185, 186, 189, 29, 30, 26);
-    addBattleFormation(158, 632, false, {186, 186, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(158, 633, false, {185, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(158, 634, false, {186, 186, 189, 189, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(158, 635, false, {185, 189, 189, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(159, 186, 189, 191, 30, 26, 35);
-    addBattleFormation(159, 636, false, {191, 65535, 65535, 65535, 65535, 65535}, {661, 201, 209, 212});
-    addBattleFormation(159, 637, false, {186, 186, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(159, 638, false, {186, 189, 189, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(159, 639, false, {186, 186, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(160, 191, 192, 65535, 35, 34, 255);
-    addBattleFormation(160, 640, false, {192, 192, 65535, 65535, 65535, 65535}, {661, 201, 209, 212});
-    addBattleFormation(160, 641, false, {191, 65535, 65535, 65535, 65535, 65535}, {192, 194, 656, 668});
-    addBattleFormation(160, 642, false, {192, 192, 192, 65535, 65535, 65535}, {192, 194, 656, 668});
-    addBattleFormation(160, 643, false, {191, 191, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(161, 189, 190, 195, 26, 24, 45);
-    addBattleFormation(161, 644, true, {195, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(161, 645, true, {189, 189, 190, 65535, 65535, 65535}, {661, 201, 209, 212});
-    addBattleFormation(161, 646, true, {189, 189, 189, 190, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(161, 647, true, {189, 189, 189, 190, 65535, 65535}, {192, 194, 656, 668});
-    addBattleScene(162, 192, 194, 65535, 34, 30, 255);
-    addBattleFormation(162, 648, true, {192, 192, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(162, 649, true, {194, 194, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(162, 650, true, {194, 194, 65535, 65535, 65535, 65535}, {192, 194, 656, 668});
-    addBattleFormation(162, 651, true, {194, 194, 65535, 65535, 65535, 65535}, {661, 201, 209, 212});
-    addBattleScene(163, 56, 193, 65535, 13, 39, 255);
-    addBattleFormation(163, 652, true, {193, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(163, 653, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(163, 654, false, {56, 56, 56, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(163, 655, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(164, 200, 201, 203, 27, 32, 33);
-    addBattleFormation(164, 656, false, {200, 201, 201, 201, 65535, 65535}, {672, 692, 696, 210});
-    addBattleFormation(164, 657, false, {201, 201, 201, 201, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(164, 658, false, {201, 201, 200, 200, 200, 65535}, {999, 999, 999, 999});
-    addBattleFormation(164, 659, false, {203, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(165, 198, 199, 200, 24, 255, 27);
-    addBattleFormation(165, 660, false, {200, 200, 200, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(165, 661, false, {198, 199, 200, 200, 65535, 65535}, {673, 674, 680, 694});
-    addBattleFormation(165, 662, false, {198, 199, 198, 199, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(165, 663, false, {200, 200, 200, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(166, 200, 202, 203, 27, 31, 33);
-    addBattleFormation(166, 664, false, {202, 202, 202, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(166, 665, false, {200, 200, 200, 203, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(166, 666, false, {200, 200, 200, 200, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(166, 667, false, {200, 203, 200, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(167, 196, 203, 204, 50, 33, 35);
-    addBattleFormation(167, 668, false, {204, 65535, 65535, 65535, 65535, 65535}, {672, 692, 696, 210});
-    addBattleFormation(167, 669, false, {203, 203, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(167, 670, false, {203, 203, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(167, 671, true, {196, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(168, 206, 208, 211, 32, 28, 30);
-    addBattleFormation(168, 672, false, {206, 206, 206, 65535, 65535, 65535}, {705, 713, 727, 732});
-    addBattleFormation(168, 673, false, {208, 208, 65535, 65535, 65535, 65535}, {700, 706, 711, 712});
-    addBattleFormation(168, 674, false, {206, 206, 208, 65535, 65535, 65535}, {700, 706, 711, 712});
-    addBattleFormation(168, 675, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(169, 208, 210, 211, 28, 32, 30);
-    addBattleFormation(169, 676, false, {208, 208, 208, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(169, 677, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(169, 678, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(169, 679, true, {210, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(170, 203, 207, 211, 33, 34, 30);
-    addBattleFormation(170, 680, false, {207, 65535, 65535, 65535, 65535, 65535}, {700, 706, 711, 712});
-    addBattleFormation(170, 681, false, {203, 203, 203, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(170, 682, false, {211, 211, 211, 211, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(170, 683, false, {203, 203, 203, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(171, 205, 210, 211, 40, 32, 30);
-    addBattleFormation(171, 684, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(171, 685, false, {205, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(171, 686, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(171, 687, false, {210, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(172, 205, 210, 211, 40, 32, 30);
-    addBattleFormation(172, 688, false, {205, 205, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(172, 689, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(172, 690, false, {211, 210, 211, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(172, 691, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(173, 207, 210, 211, 34, 32, 30);
-    addBattleFormation(173, 692, false, {207, 207, 65535, 65535, 65535, 65535}, {705, 713, 727, 732});
-    addBattleFormation(173, 693, false, {211, 211, 211, 211, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(173, 694, false, {210, 207, 65535, 65535, 65535, 65535}, {700, 706, 711, 712});
-    addBattleFormation(173, 695, false, {210, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(174, 212, 213, 214, 35, 255, 255);
-    addBattleFormation(174, 696, false, {212, 213, 214, 65535, 65535, 65535}, {705, 713, 727, 732});
-    addBattleFormation(174, 697, false, {212, 213, 214, 212, 213, 214}, {999, 999, 999, 999});
-    addBattleFormation(174, 698, false, {212, 213, 214, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(174, 699, false, {212, 213, 214, 212, 213, 214}, {999, 999, 999, 999});
-    addBattleScene(175, 215, 218, 220, 44, 35, 30);
-    addBattleFormation(175, 700, false, {218, 218, 218, 65535, 65535, 65535}, {724, 730, 733, 956});
-    addBattleFormation(175, 701, false, {215, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleFormation(175, 702, false, {220, 220, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(175, 703, false, {218, 218, 220, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(176, 218, 219, 220, 35, 40, 30);
-    addBattleFormation(176, 704, false, {218, 218, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(176, 705, false, {219, 65535, 65535, 65535, 65535, 65535}, {701, 714, 721, 731});
-    addBattleFormation(176, 706, false, {218, 220, 218, 65535, 65535, 65535}, {724, 730, 733, 956});
-    addBattleFormation(176, 707, false, {220, 220, 220, 220, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(177, 219, 221, 65535, 40, 28, 255);
-    addBattleFormation(177, 708, false, {221, 221, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(177, 709, false, {219, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(177, 710, false, {221, 221, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(177, 711, false, {221, 221, 221, 65535, 65535, 65535}, {724, 730, 733, 956});
-    addBattleScene(178, 216, 218, 222, 41, 35, 33);
-    addBattleFormation(178, 712, false, {222, 222, 65535, 65535, 65535, 65535}, {724, 730, 733, 956});
-    addBattleFormation(178, 713, false, {222, 218, 218, 65535, 65535, 65535}, {701, 714, 721, 731});
-    addBattleFormation(178, 714, false, {216, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleFormation(178, 715, false, {222, 222, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(179, 217, 221, 65535, 30, 28, 255);
-    addBattleFormation(179, 716, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999});
-    addBattleFormation(179, 717, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999});
-    addBattleFormation(179, 718, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999});
-    addBattleFormation(179, 719, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999});
-    addBattleScene(180, 223, 224, 65535, 40, 32, 255);
-    addBattleFormation(180, 720, false, {224, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(180, 721, false, {223, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleFormation(180, 722, false, {224, 224, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(180, 723, false, {224, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(181, 225, 226, 227, 36, 30, 32);
-    addBattleFormation(181, 724, false, {225, 225, 225, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleFormation(181, 725, false, {227, 227, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(181, 726, false, {226, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(181, 727, false, {225, 225, 227, 65535, 65535, 65535}, {701, 714, 721, 731});
-    addBattleScene(182, 225, 230, 231, 36, 36, 35);
-    addBattleFormation(182, 728, false, {225, 225, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(182, 729, false, {230, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(182, 730, false, {230, 230, 65535, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleFormation(182, 731, false, {231, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleScene(183, 226, 230, 65535, 30, 36, 255);
-    addBattleFormation(183, 732, false, {226, 230, 230, 65535, 65535, 65535}, {701, 714, 721, 731});
-    addBattleFormation(183, 733, false, {226, 226, 65535, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleFormation(183, 734, false, {230, 230, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(183, 735, false, {230, 230, 230, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(184, 225, 232, 233, 36, 30, 25);
-    addBattleFormation(184, 736, false, {232, 232, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(184, 737, false, {225, 225, 232, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(184, 738, false, {233, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765});
-    addBattleFormation(184, 739, false, {233, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(185, 228, 229, 234, 43, 43, 55);
-    addBattleFormation(185, 740, true, {228, 229, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(185, 741, false, {228, 229, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(185, 742, false, {228, 229, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(185, 743, true, {234, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(186, 235, 236, 237, 38, 1, 35);
-    addBattleFormation(186, 744, false, {235, 236, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(186, 745, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(186, 746, false, {237, 235, 236, 237, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(186, 747, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(187, 238, 239, 65535, 35, 37, 255);
-    addBattleFormation(187, 748, false, {239, 239, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(187, 749, false, {239, 239, 239, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(187, 750, false, {238, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(187, 751, false, {239, 239, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(188, 237, 238, 239, 35, 35, 37);
-    addBattleFormation(188, 752, false, {238, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(188, 753, false, {238, 238, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(188, 754, false, {239, 239, 237, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(188, 755, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(189, 243, 244, 245, 35, 20, 20);
-    addBattleFormation(189, 756, false, {243, 244, 245, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(189, 757, false, {243, 244, 245, 243, 244, 245}, {999, 999, 999, 999});
-    addBattleFormation(189, 758, false, {243, 244, 245, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(189, 759, false, {243, 244, 245, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(190, 237, 249, 65535, 35, 32, 255);
-    addBattleFormation(190, 760, false, {237, 237, 237, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(190, 761, false, {237, 237, 237, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(190, 762, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(190, 763, true, {249, 249, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(191, 246, 247, 248, 44, 36, 38);
-    addBattleFormation(191, 764, false, {248, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(191, 765, false, {246, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(191, 766, false, {247, 247, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(191, 767, false, {247, 247, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(192, 249, 251, 65535, 32, 34, 255);
-    addBattleFormation(192, 768, true, {249, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(192, 769, true, {249, 249, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(192, 770, true, {249, 249, 249, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(192, 771, true, {251, 251, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(193, 252, 253, 257, 35, 32, 39);
-    addBattleFormation(193, 772, false, {252, 257, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(193, 773, false, {253, 253, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(193, 774, false, {253, 252, 252, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(193, 775, false, {257, 252, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(194, 254, 255, 256, 40, 40, 40);
-    addBattleFormation(194, 776, false, {254, 255, 256, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(194, 777, false, {254, 255, 256, 254, 255, 256}, {999, 999, 999, 999});
-    addBattleFormation(194, 778, false, {254, 255, 256, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(194, 779, false, {254, 255, 256, 254, 255, 256}, {999, 999, 999, 999});
-    addBattleScene(195, 258, 259, 260, 45, 45, 45);
-    addBattleFormation(195, 780, true, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(195, 781, false, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(195, 782, false, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(195, 783, false, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(196, 249, 250, 65535, 32, 34, 255);
-    addBattleFormation(196, 784, true, {249, 249, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(196, 785, true, {249, 249, 249, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(196, 786, true, {249, 249, 250, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(196, 787, false, {250, 250, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(197, 261, 262, 263, 40, 41, 36);
-    addBattleFormation(197, 788, false, {261, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(197, 789, false, {263, 263, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(197, 790, false, {262, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(197, 791, false, {262, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(198, 261, 264, 65535, 40, 39, 255);
-    addBattleFormation(198, 792, false, {261, 261, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(198, 793, false, {261, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(198, 794, false, {261, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(198, 795, true, {264, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(199, 269, 270, 65535, 42, 38, 255);
-    addBattleFormation(199, 796, false, {269, 269, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(199, 797, false, {269, 270, 270, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(199, 798, false, {270, 270, 270, 270, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(199, 799, false, {270, 270, 269, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(200, 271, 272, 273, 50, 52, 51);
-    addBattleFormation(200, 800, false, {271, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(200, 801, false, {272, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(200, 802, false, {273, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(200, 803, false, {271, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(201, 268, 274, 275, 40, 42, 49);
-    addBattleFormation(201, 804, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(201, 805, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(201, 806, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(201, 807, true, {274, 275, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(202, 265, 266, 267, 42, 43, 46);
-    addBattleFormation(202, 808, true, {265, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(202, 809, true, {265, 265, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(202, 810, true, {266, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(202, 811, true, {267, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(203, 173, 65535, 65535, 34, 255, 255);
-    addBattleFormation(203, 812, true, {173, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(203, 813, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(203, 814, false, {173, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(203, 815, false, {173, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(204, 173, 252, 281, 34, 35, 42);
-    addBattleFormation(204, 816, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(204, 817, true, {173, 173, 252, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(204, 818, true, {173, 173, 281, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(204, 819, true, {252, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(205, 286, 287, 288, 42, 35, 1);
-    addBattleFormation(205, 820, false, {286, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(205, 821, false, {286, 286, 286, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(205, 822, false, {287, 288, 287, 288, 287, 288}, {999, 999, 999, 999});
-    addBattleFormation(205, 823, false, {287, 288, 287, 288, 287, 288}, {999, 999, 999, 999});
-    addBattleScene(206, 285, 286, 289, 45, 42, 44);
-    addBattleFormation(206, 824, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(206, 825, false, {289, 289, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(206, 826, false, {289, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(206, 827, false, {286, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(207, 286, 289, 290, 42, 44, 42);
-    addBattleFormation(207, 828, false, {286, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(207, 829, false, {286, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(207, 830, false, {289, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(207, 831, false, {290, 290, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(208, 289, 290, 65535, 44, 42, 255);
-    addBattleFormation(208, 832, false, {290, 290, 290, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(208, 833, false, {290, 290, 289, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(208, 834, false, {290, 290, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(208, 835, false, {289, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(209, 291, 292, 293, 46, 42, 50);
-    addBattleFormation(209, 836, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(209, 837, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(209, 838, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(209, 839, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(210, 296, 297, 298, 53, 50, 51);
-    addBattleFormation(210, 840, true, {296, 297, 298, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(210, 841, false, {296, 297, 298, 296, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(210, 842, false, {296, 297, 298, 296, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(210, 843, false, {296, 297, 298, 296, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(211, 299, 300, 65535, 53, 62, 255);
-    addBattleFormation(211, 844, true, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(211, 845, false, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(211, 846, false, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(211, 847, false, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(212, 301, 302, 65535, 44, 46, 255);
-    addBattleFormation(212, 848, false, {301, 301, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(212, 849, false, {302, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(212, 850, false, {301, 301, 301, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(212, 851, false, {301, 301, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(213, 267, 301, 304, 46, 44, 49);
-    addBattleFormation(213, 852, false, {304, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(213, 853, false, {301, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(213, 854, false, {301, 301, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(213, 855, false, {267, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(214, 305, 362, 363, 50, 34, 42);
-    addBattleFormation(214, 856, true, {362, 363, 305, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(214, 857, false, {362, 363, 305, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(214, 858, false, {362, 363, 305, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(214, 859, false, {305, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(215, 306, 307, 308, 55, 55, 55);
-    addBattleFormation(215, 860, true, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(215, 861, false, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(215, 862, false, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(215, 863, false, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(216, 309, 65535, 65535, 58, 255, 255);
-    addBattleFormation(216, 864, true, {309, 309, 309, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(216, 865, false, {309, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(216, 866, false, {309, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(216, 867, false, {309, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(217, 294, 295, 322, 43, 43, 57);
-    addBattleFormation(217, 868, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(217, 869, false, {294, 295, 294, 295, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(217, 870, false, {322, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(217, 871, false, {322, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(218, 317, 321, 65535, 77, 51, 255);
-    addBattleFormation(218, 872, false, {317, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(218, 873, false, {321, 321, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(218, 874, false, {321, 321, 321, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(218, 875, false, {321, 321, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(219, 318, 321, 323, 41, 51, 48);
-    addBattleFormation(219, 876, false, {318, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(219, 877, false, {323, 323, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(219, 878, false, {318, 321, 321, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(219, 879, false, {321, 321, 321, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(220, 215, 315, 323, 44, 54, 48);
-    addBattleFormation(220, 880, false, {215, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(220, 881, false, {315, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(220, 882, false, {323, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(220, 883, false, {323, 323, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(221, 310, 311, 312, 41, 34, 34);
-    addBattleFormation(221, 884, false, {311, 312, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(221, 885, false, {310, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(221, 886, false, {310, 310, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(221, 887, false, {310, 310, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(222, 314, 317, 319, 48, 77, 59);
-    addBattleFormation(222, 888, false, {314, 314, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(222, 889, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(222, 890, false, {319, 319, 319, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(222, 891, false, {317, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(223, 313, 314, 316, 60, 48, 41);
-    addBattleFormation(223, 892, false, {313, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(223, 893, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(223, 894, false, {316, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(223, 895, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(224, 294, 295, 317, 43, 43, 77);
-    addBattleFormation(224, 896, false, {317, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(224, 897, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(224, 898, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(224, 899, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(225, 314, 315, 320, 48, 54, 46);
-    addBattleFormation(225, 900, false, {320, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(225, 901, false, {315, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(225, 902, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(225, 903, false, {315, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(226, 311, 312, 323, 34, 34, 48);
-    addBattleFormation(226, 904, false, {323, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(226, 905, false, {323, 323, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(226, 906, false, {323, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(226, 907, false, {311, 312, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(227, 324, 65535, 65535, 61, 255, 255);
-    addBattleFormation(227, 908, true, {324, 324, 324, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(227, 909, false, {324, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(227, 910, false, {324, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(227, 911, false, {324, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(228, 325, 65535, 65535, 61, 255, 255);
-    addBattleFormation(228, 912, true, {325, 325, 325, 325, 325, 65535}, {999, 999, 999, 999});
-    addBattleFormation(228, 913, true, {325, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(228, 914, true, {325, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(228, 915, true, {325, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(229, 326, 65535, 65535, 61, 255, 255);
-    addBattleFormation(229, 916, true, {326, 326, 326, 326, 326, 65535}, {999, 999, 999, 999});
-    addBattleFormation(229, 917, true, {326, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(229, 918, true, {326, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(229, 919, true, {326, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(230, 330, 65535, 65535, 61, 255, 255);
-    addBattleFormation(230, 920, true, {330, 330, 330, 330, 330, 330}, {999, 999, 999, 999});
-    addBattleFormation(230, 921, true, {330, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(230, 922, true, {330, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(230, 923, true, {330, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(231, 331, 332, 65535, 87, 50, 255);
-    addBattleFormation(231, 924, true, {331, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(231, 925, true, {332, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(231, 926, true, {331, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(231, 927, true, {332, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(232, 327, 65535, 65535, 61, 255, 255);
-    addBattleFormation(232, 928, true, {327, 327, 327, 327, 327, 65535}, {999, 999, 999, 999});
-    addBattleFormation(232, 929, true, {327, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(232, 930, true, {327, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(232, 931, true, {327, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(233, 328, 65535, 65535, 61, 255, 255);
-    addBattleFormation(233, 932, true, {328, 328, 328, 328, 328, 65535}, {999, 999, 999, 999});
-    addBattleFormation(233, 933, true, {328, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(233, 934, true, {328, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(233, 935, true, {328, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(234, 329, 65535, 65535, 61, 255, 255);
-    addBattleFormation(234, 936, true, {329, 329, 329, 329, 329, 329}, {999, 999, 999, 999});
-    addBattleFormation(234, 937, true, {329, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(234, 938, true, {329, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(234, 939, true, {329, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(235, 235, 236, 237, 38, 1, 35);
-    addBattleFormation(235, 940, false, {237, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(235, 941, false, {235, 236, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(235, 942, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(235, 943, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(236, 173, 237, 65535, 34, 35, 255);
-    addBattleFormation(236, 944, false, {237, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(236, 945, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(236, 946, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(236, 947, false, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(237, 240, 241, 242, 33, 33, 33);
-    addBattleFormation(237, 948, false, {240, 241, 242, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(237, 949, false, {240, 241, 242, 240, 241, 242}, {999, 999, 999, 999});
-    addBattleFormation(237, 950, false, {240, 241, 242, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(237, 951, false, {240, 241, 242, 240, 241, 242}, {999, 999, 999, 999});
-    addBattleScene(240, 264, 272, 280, 39, 52, 22);
-    addBattleFormation(240, 960, false, {280, 65535, 65535, 65535, 65535, 65535}, {961, 961, 961, 961});
-    addBattleFormation(240, 961, true, {264, 65535, 65535, 65535, 65535, 65535}, {962, 962, 962, 962});
-    addBattleFormation(240, 962, false, {272, 65535, 65535, 65535, 65535, 65535}, {964, 964, 964, 964});
-    addBattleFormation(240, 963, false, {272, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(241, 266, 268, 65535, 43, 40, 255);
-    addBattleFormation(241, 964, false, {268, 65535, 65535, 65535, 65535, 65535}, {965, 965, 965, 965});
-    addBattleFormation(241, 965, true, {266, 65535, 65535, 65535, 65535, 65535}, {968, 968, 968, 968});
-    addBattleFormation(241, 966, true, {266, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(241, 967, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(242, 285, 65535, 65535, 45, 255, 255);
-    addBattleFormation(242, 968, false, {285, 65535, 65535, 65535, 65535, 65535}, {972, 972, 972, 972});
-    addBattleFormation(242, 969, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(242, 970, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(242, 971, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(243, 299, 300, 304, 53, 62, 49);
-    addBattleFormation(243, 972, false, {304, 65535, 65535, 65535, 65535, 65535}, {973, 973, 973, 973});
-    addBattleFormation(243, 973, true, {299, 300, 65535, 65535, 65535, 65535}, {0, 0, 0, 0});
-    addBattleFormation(243, 974, false, {304, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(243, 975, false, {304, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(244, 261, 262, 263, 40, 41, 36);
-    addBattleFormation(244, 976, false, {262, 262, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(244, 977, false, {261, 261, 263, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(244, 978, false, {262, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(244, 979, false, {262, 262, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(245, 10, 11, 12, 49, 59, 37);
-    addBattleFormation(245, 980, true, {10, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(245, 981, true, {10, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(245, 982, false, {11, 12, 12, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(245, 983, false, {11, 12, 12, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(246, 13, 14, 15, 99, 1, 50);
-    addBattleFormation(246, 984, false, {13, 14, 15, 15, 15, 15}, {999, 999, 999, 999});
-    addBattleFormation(246, 985, false, {13, 14, 15, 15, 15, 15}, {999, 999, 999, 999});
-    addBattleFormation(246, 986, false, {13, 14, 15, 15, 15, 15}, {999, 999, 999, 999});
-    addBattleFormation(246, 987, false, {15, 15, 15, 15, 65535, 65535}, {999, 999, 999, 999});
-    addBattleScene(248, 102, 103, 65535, 18, 16, 255);
-    addBattleFormation(248, 992, false, {102, 102, 102, 65535, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(248, 993, false, {103, 103, 65535, 65535, 65535, 65535}, {0, 0, 0, 0});
-    addBattleFormation(248, 994, false, {102, 102, 102, 102, 65535, 65535}, {999, 999, 999, 999});
-    addBattleFormation(248, 995, false, {102, 103, 102, 65535, 65535, 65535}, {999, 999, 999, 999});
+static constexpr FieldScriptBattle fieldScriptBattles[] = {
+    { 4, 1, 0x390, 999 },
+    { 6, 5, 0x491, 807 },
+    { 11, 1, 0x1693, 999 },
+    { 3, 1, 0x58C, 999 },
+    { 8, 1, 0xABC, 288 },
+    { 0, 0, 0x15A, 468 },
+    { 0, 0, 0x33D, 468 },
+    { 0, 0, 0x168, 924 },
+    { 0, 0, 0x4C6, 300 },
+    { 3, 6, 0x63D, 324 },
+    { 4, 10, 0x824, 364 },
+    { 2, 6, 0x547, 324 },
+    { 0, 3, 0x61A, 328 },
+    { 0, 3, 0x68F, 329 },
+    { 0, 3, 0x6F8, 330 },
+    { 4, 4, 0x8B7, 412 },
+    { 5, 3, 0x3AC, 367 },
+    { 3, 5, 0xA5C, 372 },
+    { 3, 7, 0xAE8, 372 },
+    { 3, 7, 0xB09, 373 },
+    { 3, 7, 0xB24, 374 },
+    { 3, 8, 0xBC8, 373 },
+    { 3, 8, 0xC17, 372 },
+    { 3, 9, 0xCF7, 374 },
+    { 12, 3, 0x9DF, 384 },
+    { 12, 4, 0x9E8, 385 },
+    { 1, 7, 0x536, 386 },
+    { 21, 3, 0x14FB, 416 },
+    { 21, 4, 0x153C, 417 },
+    { 21, 5, 0x157D, 419 },
+    { 21, 6, 0x15BE, 420 },
+    { 21, 7, 0x15FF, 416 },
+    { 21, 8, 0x1640, 417 },
+    { 21, 9, 0x1681, 419 },
+    { 21, 10, 0x16C2, 420 },
+    { 21, 11, 0x1703, 424 },
+    { 21, 12, 0x1744, 425 },
+    { 21, 13, 0x1785, 427 },
+    { 21, 14, 0x17C6, 436 },
+    { 21, 15, 0x1807, 424 },
+    { 21, 16, 0x1848, 425 },
+    { 21, 17, 0x1889, 427 },
+    { 21, 18, 0x18CA, 436 },
+    { 7, 4, 0xA50, 460 },
+    { 29, 3, 0x1F40, 415 },
+    { 23, 5, 0xE3D, 422 },
+    { 24, 5, 0xEAD, 422 },
+    { 29, 3, 0x1880, 423 },
+    { 2, 8, 0x64F, 456 },
+    { 0, 0, 0x45A, 464 },
+    { 7, 17, 0x7F9, 292 },
+    { 5, 15, 0x6EC, 292 },
+    { 3, 3, 0x5FB, 576 },
+    { 4, 3, 0x7AA, 576 },
+    { 5, 3, 0x959, 576 },
+    { 21, 1, 0x1313, 595 },
+    { 0, 0, 0x3B3, 980 },
+    { 11, 9, 0x12D1, 288 },
+    { 11, 10, 0x1387, 288 },
+    { 11, 10, 0x1395, 288 },
+    { 11, 10, 0x13AF, 288 },
+    { 11, 10, 0x13B5, 288 },
+    { 11, 10, 0x13C7, 288 },
+    { 11, 10, 0x13CD, 288 },
+    { 11, 10, 0x13DF, 288 },
+    { 11, 10, 0x13E5, 288 },
+    { 11, 10, 0x13F7, 288 },
+    { 11, 10, 0x13FD, 288 },
+    { 11, 10, 0x1403, 288 },
+    { 11, 10, 0x141D, 288 },
+    { 11, 10, 0x1423, 289 },
+    { 11, 10, 0x1435, 288 },
+    { 11, 10, 0x143B, 289 },
+    { 11, 10, 0x144D, 288 },
+    { 11, 10, 0x1453, 289 },
+    { 11, 10, 0x1465, 288 },
+    { 11, 10, 0x146B, 289 },
+    { 11, 10, 0x1471, 288 },
+    { 11, 10, 0x1477, 289 },
+    { 11, 11, 0x1529, 290 },
+    { 7, 3, 0x7C1, 763 },
+    { 2, 0, 0x64E, 763 },
+    { 18, 3, 0x9D4, 763 },
+    { 0, 0, 0x69B, 947 },
+    { 5, 0, 0x905, 786 },
+    { 27, 6, 0x223C, 786 },
+    { 8, 7, 0x7D3, 784 },
+    { 4, 0, 0x7AF, 785 },
+    { 8, 2, 0x599, 768 },
+    { 9, 3, 0x60A, 771 },
+    { 10, 3, 0x667, 769 },
+    { 10, 3, 0x694, 770 },
+    { 3, 3, 0x8C1, 780 },
+    { 4, 3, 0x517, 769 },
+    { 8, 1, 0x653, 769 },
+    { 2, 0, 0x5BD, 480 },
+    { 15, 5, 0x12BA, 488 },
+    { 12, 3, 0x83F, 813 },
+    { 5, 7, 0x5E6, 512 },
+    { 0, 0, 0x516, 527 },
+    { 0, 0, 0x73F, 525 },
+    { 0, 0, 0x74B, 526 },
+    { 0, 0, 0x757, 95 },
+    { 0, 0, 0x763, 100 },
+    { 0, 0, 0x76F, 107 },
+    { 0, 0, 0x77B, 117 },
+    { 0, 0, 0x787, 118 },
+    { 0, 0, 0x78D, 119 },
+    { 0, 0, 0x891, 960 },
+    { 0, 0, 0x8B7, 305 },
+    { 0, 0, 0x8C3, 310 },
+    { 0, 0, 0x8CF, 313 },
+    { 0, 0, 0x8DB, 325 },
+    { 0, 0, 0x8E7, 326 },
+    { 0, 0, 0x8F3, 327 },
+    { 0, 0, 0x8FF, 331 },
+    { 0, 0, 0x905, 333 },
+    { 0, 0, 0x91A, 525 },
+    { 0, 0, 0x926, 526 },
+    { 0, 0, 0x932, 95 },
+    { 0, 0, 0x93E, 100 },
+    { 0, 0, 0x94A, 107 },
+    { 0, 0, 0x956, 117 },
+    { 0, 0, 0x962, 118 },
+    { 0, 0, 0x968, 119 },
+    { 0, 0, 0x974, 604 },
+    { 0, 0, 0x980, 606 },
+    { 0, 0, 0x98C, 609 },
+    { 0, 0, 0x998, 610 },
+    { 0, 0, 0x9A4, 613 },
+    { 0, 0, 0x9B0, 614 },
+    { 0, 0, 0x9BC, 617 },
+    { 0, 0, 0x9C2, 182 },
+    { 11, 5, 0x8E1, 539 },
+    { 18, 0, 0x9E9, 553 },
+    { 19, 0, 0xA55, 554 },
+    { 21, 0, 0xB3A, 554 },
+    { 15, 5, 0x811, 551 },
+    { 16, 5, 0x849, 551 },
+    { 17, 5, 0x881, 551 },
+    { 15, 5, 0x89E, 555 },
+    { 11, 4, 0x9DC, 816 },
+    { 11, 4, 0xA5A, 817 },
+    { 14, 4, 0xD94, 816 },
+    { 10, 3, 0x818, 818 },
+    { 14, 0, 0xE00, 819 },
+    { 10, 3, 0x1271, 620 },
+    { 10, 4, 0x13B8, 620 },
+    { 10, 3, 0x12AE, 621 },
+    { 10, 4, 0x13F2, 621 },
+    { 17, 1, 0x13E8, 623 },
+    { 18, 1, 0x179D, 624 },
+    { 19, 1, 0x1BEA, 625 },
+    { 20, 1, 0x2032, 626 },
+    { 21, 1, 0x283E, 628 },
+    { 14, 0, 0x876, 622 },
+    { 9, 0, 0xD56, 619 },
+    { 10, 0, 0xA2A, 648 },
+    { 10, 0, 0xA3A, 648 },
+    { 10, 0, 0xA4E, 648 },
+    { 10, 0, 0xA77, 648 },
+    { 7, 1, 0x4A1, 645 },
+    { 7, 1, 0x4F0, 649 },
+    { 2, 0, 0x875, 652 },
+    { 16, 4, 0xC3B, 644 },
+    { 0, 0, 0x25C, 671 },
+    { 13, 1, 0x612, 679 },
+    { 3, 5, 0x559, 716 },
+    { 4, 5, 0x5A1, 717 },
+    { 5, 5, 0x5DB, 718 },
+    { 6, 5, 0x615, 717 },
+    { 2, 2, 0x478, 740 },
+    { 17, 2, 0x102A, 743 },
+    { 3, 0, 0x7A8, 729 },
+    { 0, 0, 0x4C9, 729 },
+    { 5, 0, 0x962, 729 },
+    { 0, 0, 0x447, 280 },
+    { 3, 3, 0x4AB, 808 },
+    { 3, 4, 0x4D4, 809 },
+    { 3, 5, 0x4FD, 810 },
+    { 3, 6, 0x526, 811 },
+    { 11, 0, 0x753, 812 },
+    { 13, 2, 0x8AF, 844 },
+    { 13, 1, 0xB0B, 856 },
+    { 0, 0, 0x738, 925 },
+    { 3, 1, 0x69B, 902 },
+    { 3, 1, 0x6A7, 900 },
+    { 3, 1, 0x6AD, 901 },
+    { 3, 1, 0x533, 902 },
+    { 3, 1, 0x53F, 900 },
+    { 3, 1, 0x545, 901 },
+    { 0, 0, 0x521, 908 },
+    { 15, 3, 0x1D56, 912 },
+    { 15, 4, 0x1D6E, 928 },
+    { 15, 4, 0x1DA3, 916 },
+    { 15, 5, 0x1DBA, 932 },
+    { 15, 5, 0x1DEB, 920 },
+    { 15, 5, 0x1E06, 936 },
+    { 17, 8, 0x237B, 924 },
+    { 14, 3, 0xCE5, 600 },
+    { 15, 0, 0xB46, 840 },
+    { 15, 0, 0xBCE, 840 },
+};
 
-    addBoss(22, "Guard Scorpion", {81}, 0x0205FFFFFFFFFFFFULL, 0x0205FFFFFFFFFFFFULL);
-    addBoss(33, "Air Buster", {91}, 0x02000305FFFFFFFFULL, 0x02040505FFFFFFFFULL);
-    addBoss(37, "Aps", {96}, 0x0005FFFFFFFFFFFFULL, 0x0205FFFFFFFFFFFFULL);
-    addBoss(48, "Turks:Reno", {103}, 0x0205FFFFFFFFFFFFULL, 0x0405FFFFFFFFFFFFULL);
-    addBoss(127, "Turks:Reno", {134}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(274, "Turks:Reno", {201}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(297, "Turks:Reno", {210}, 0x0502FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL);
-    addBoss(64, "Sample:H0512", {114}, 0x040205FFFFFFFFFFULL, 0x060405FFFFFFFFFFULL);
-    addBoss(66, "Hundred Gunner", {115}, 0x0205FFFFFFFFFFFFULL, 0x0204FFFFFFFFFFFFULL);
-    addBoss(67, "Heli Gunner", {115}, 0x020307FFFFFFFFFFULL, 0x020502FFFFFFFFFFULL);
-    addBoss(68, "Rufus", {116}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(69, "Dark Nation", {116}, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL);
-    addBoss(71, "Motor Ball", {117}, 0x020005FFFFFFFFFFULL, 0x020405FFFFFFFFFFULL);
-    addBoss(91, "Bottomswell", {120}, 0x030705FFFFFFFFFFULL, 0x050204FFFFFFFFFFULL);
-    addBoss(95, "Jenova-BIRTH", {122}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(111, "Dyne", {131}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(128, "Turks:Rude", {134}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(275, "Turks:Rude", {201}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(281, "Turks:Rude", {204}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(298, "Turks:Rude", {210}, 0x0500FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL);
-    addBoss(139, "Gi Nattak", {138}, 0x0905030608FFFFFFULL, 0x0605050502FFFFFFULL);
-    addBoss(163, "Materia Keeper", {148}, 0x0005FFFFFFFFFFFFULL, 0x0605FFFFFFFFFFFFULL);
-    addBoss(164, "Palmer", {150}, 0x0522FFFFFFFFFFFFULL, 0x0502FFFFFFFFFFFFULL);
-    addBoss(193, "Red Dragon", {163}, 0x0500FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL);
-    addBoss(195, "Demons Gate", {161}, 0x050403FFFFFFFFFFULL, 0x050504FFFFFFFFFFULL);
-    addBoss(196, "Jenova-LIFE", {167}, 0x050603FFFFFFFFFFULL, 0x050602FFFFFFFFFFULL);
-    addBoss(228, "Schizo(Right)", {185}, 0x0005FFFFFFFFFFFFULL, 0x0605FFFFFFFFFFFFULL);
-    addBoss(229, "Schizo(Left)", {185}, 0x0105FFFFFFFFFFFFULL, 0x0605FFFFFFFFFFFFULL);
-    addBoss(234, "Jenova-DEATH", {185}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(267, "Eagle Gun", {202, 213}, 0x030602FFFFFFFFFFULL, 0x050502FFFFFFFFFFULL);
-    addBoss(267, "Eagle Gun", {202, 213}, 0x030602FFFFFFFFFFULL, 0x050502FFFFFFFFFFULL);
-    addBoss(258, "Carry Armor", {195}, 0x020405FFFFFFFFFFULL, 0x020505FFFFFFFFFFULL);
-    addBoss(154, "Lost Number", {144}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(155, "Lost Number", {144}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(156, "Lost Number", {144}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(177, "Rapps", {154}, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL);
-    addBoss(178, "Gorkii", {155}, 0x050307FFFFFFFFFFULL, 0x050502FFFFFFFFFFULL);
-    addBoss(179, "Shake", {156}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(180, "Chekhov", {156}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(181, "Staniv", {156}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(182, "Godo", {157}, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL);
-    addBoss(10, "Diamond Weapon", {245}, 0x050002FFFFFFFFFFULL, 0x050402FFFFFFFFFFULL);
-    addBoss(296, "Turks:Elena", {210}, 0x0501FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL);
-    addBoss(305, "Hojo", {214}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(306, "Helletic Hojo", {215}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(309, "Lifeform-Hojo N", {216}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(333, "Ultimate Weapon", {70}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(334, "Ultimate Weapon", {70, 71, 73}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(335, "Ultimate Weapon", {70, 71, 247}, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL);
-    addBoss(334, "Ultimate Weapon", {70, 71, 73}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(335, "Ultimate Weapon", {70, 71, 247}, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL);
-    addBoss(336, "Ultimate Weapon", {71}, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL);
-    addBoss(334, "Ultimate Weapon", {70, 71, 73}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(335, "Ultimate Weapon", {70, 71, 247}, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL);
-    addBoss(13, "Emerald Weapon", {246}, 0x0502010603FFFFFFULL, 0x0402060605FFFFFFULL);
-    addBoss(11, "Ruby Weapon", {245}, 0x0605FFFFFFFFFFFFULL, 0x0505FFFFFFFFFFFFULL);
-    addBoss(324, "Jenova-SYNTHESIS", {227}, 0x050304FFFFFFFFFFULL, 0x050506FFFFFFFFFFULL);
-    addBoss(325, "Bizarro-Sephiroth", {228}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(326, "Bizarro-Sephiroth", {229}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(330, "Bizarro-Sephiroth", {230}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(327, "Bizarro-Sephiroth", {232}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(328, "Bizarro-Sephiroth", {233}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(329, "Bizarro-Sephiroth", {234}, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL);
-    addBoss(331, "Safer-Sephiroth", {231}, 0x0503FFFFFFFFFFFFULL, 0x0505FFFFFFFFFFFFULL);
-    addBoss(332, "Sephiroth", {231}, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL);
+static constexpr FieldWorldExit fieldWorldExits[] = {
+    { 0x1CCC, 0, 0x1 },
+    { 0x4804, 0, 0x9 },
+    { 0x3A34, 0, 0xA },
+    { 0x510C, 0, 0x1C },
+    { 0x36F8, 0, 0x15 },
+    { 0x31B4, 0, 0x18 },
+    { 0x5280, 0, 0x16 },
+    { 0x3528, 0, 0xC },
+    { 0x3210, 0, 0x1D },
+    { 0x5858, 1, 0x1 },
+    { 0x721C, 6, 0x13 },
+    { 0x7234, 7, 0x2B },
+    { 0xD85C, 1, 0x2C },
+    { 0xBC1C, 3, 0x2E },
+    { 0xB50C, 9, 0x2 },
+    { 0xB524, 10, 0x2 },
+    { 0x62E4, 2, 0x3 },
+    { 0x62FC, 3, 0x3 },
+    { 0x6314, 4, 0x3 },
+    { 0x632C, 5, 0x3 },
+    { 0x6344, 6, 0x3 },
+    { 0x635C, 7, 0x3 },
+    { 0x6374, 8, 0x3 },
+    { 0x6964, 2, 0x5 },
+    { 0x722C, 2, 0x4 },
+    { 0x1898, 1, 0x6 },
+    { 0xCA0C, 4, 0x7 },
+    { 0x8540, 7, 0xD },
+    { 0x88E0, 5, 0xF },
+    { 0x7640, 4, 0xF },
+    { 0x75B4, 5, 0xF },
+    { 0x7054, 0, 0xE },
+    { 0xA520, 3, 0x11 },
+    { 0xB6B8, 2, 0x11 },
+    { 0xA1CC, 5, 0x12 },
+    { 0x9398, 6, 0x14 },
+    { 0x9430, 7, 0x14 },
+    { 0xB098, 8, 0x17 },
+    { 0xB0B0, 9, 0x17 },
+    { 0x8D14, 1, 0x8 },
+    { 0x8D2C, 2, 0x8 },
+    { 0x7E50, 1, 0x19 },
+    { 0xB774, 0, 0x37 },
+    { 0x9818, 0, 0x37 },
+    { 0x648C, 0, 0x39 },
+    { 0x627C, 1, 0x1A },
+    { 0x83C0, 0, 0x3A },
+    { 0xC6A8, 0, 0x1B },
+    { 0xC6C0, 1, 0x1B },
+    { 0x5F34, 1, 0x3C },
+    { 0xA4B4, 0, 0xB },
+    { 0xA55C, 7, 0xB },
+    { 0x8268, 0, 0xB },
+    { 0x8310, 7, 0xB },
+    { 0x9158, 0, 0xB },
+    { 0x9200, 7, 0xB },
+};
 
-    addModel("BARRET", 371, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 64, 24}, {3, 4, 0, 0, 0, 0, 76, 20}, {0, 0, 0, 0, 0, 0, 14, 8}, {0, 0, 0, 0, 0, 0, 0, 9}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 14, 8}, {0, 0, 0, 0, 0, 0, 0, 10}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 2, 5}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 4, 10}, {0, 0, 0, 0, 0, 0, 2, 5}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 4, 10}});
-    addModel("CID", 388, {{0, 0, 0, 0, 0, 0, 10, 6}, {0, 0, 0, 0, 0, 0, 36, 22}, {0, 11, 0, 0, 0, 0, 90, 45}, {0, 0, 0, 0, 0, 0, 14, 7}, {0, 0, 0, 0, 0, 0, 0, 13}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 14, 7}, {0, 0, 0, 0, 0, 0, 0, 13}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 12, 9}, {0, 0, 0, 0, 0, 0, 4, 7}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 12, 9}, {0, 0, 0, 0, 0, 0, 4, 7}});
-    addModel("CLOUD", 373, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 6, 27}, {2, 4, 0, 0, 0, 0, 148, 12}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("AERITH", 370, {{0, 0, 0, 0, 0, 0, 6, 11}, {0, 0, 0, 0, 0, 0, 24, 20}, {2, 2, 0, 0, 0, 0, 100, 43}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 10, 15}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 15}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("CAITSITH", 385, {{0, 0, 0, 0, 0, 0, 96, 45}, {0, 0, 0, 0, 0, 0, 2, 16}, {0, 0, 0, 0, 0, 0, 2, 16}, {0, 0, 0, 0, 0, 0, 43, 13}, {6, 7, 0, 0, 0, 0, 40, 17}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 5}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 0, 2}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 5}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 0, 9}, {0, 0, 0, 0, 0, 0, 6, 1}, {0, 0, 0, 0, 0, 0, 0, 9}, {0, 0, 0, 0, 0, 0, 6, 1}});
-    addModel("REDXIII", 424, {{0, 0, 0, 0, 0, 0, 14, 2}, {0, 0, 0, 0, 0, 0, 28, 11}, {0, 3, 0, 0, 0, 0, 120, 10}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 12, 5}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 2, 3}, {0, 0, 0, 0, 0, 0, 2, 3}, {0, 0, 0, 0, 0, 0, 8, 0}, {0, 0, 0, 0, 0, 0, 12, 5}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}});
-    addModel("TIFA", 383, {{0, 0, 0, 0, 0, 0, 0, 22}, {0, 0, 0, 0, 0, 0, 36, 12}, {2, 2, 0, 0, 0, 0, 124, 22}, {0, 0, 0, 0, 0, 0, 16, 8}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 4, 1}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 5}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 0, 5}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("VINCENT", 377, {{0, 0, 0, 0, 0, 0, 10, 7}, {0, 0, 0, 0, 0, 0, 12, 20}, {2, 2, 0, 0, 0, 0, 126, 34}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 0, 2}, {0, 0, 0, 0, 0, 0, 0, 17}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 17}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 6, 2}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 6, 2}});
-    addModel("YUFFIE", 382, {{0, 0, 0, 0, 0, 0, 2, 13}, {0, 0, 0, 0, 0, 0, 24, 25}, {2, 2, 0, 0, 0, 0, 128, 34}, {0, 0, 0, 0, 0, 0, 2, 4}, {0, 0, 0, 0, 0, 0, 2, 4}, {0, 0, 0, 0, 0, 0, 14, 13}, {0, 0, 0, 0, 0, 0, 0, 20}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 11}, {0, 0, 0, 0, 0, 0, 0, 10}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 11}, {0, 0, 0, 0, 0, 0, 0, 10}});
-    addModel("AERITH_INTRO", 489, {{0, 0, 0, 0, 0, 0, 6, 11}, {0, 0, 0, 0, 0, 0, 24, 20}, {4, 4, 0, 0, 0, 0, 100, 43}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 10, 15}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 15}, {0, 0, 0, 0, 0, 0, 64, 65}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("CLOUD_DRESS", 388, {{0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 26, 25}, {2, 6, 0, 0, 0, 0, 134, 19}, {0, 0, 0, 0, 0, 0, 42, 6}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 12}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 12}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("AERITH_DRESS", 560, {{0, 0, 0, 0, 0, 0, 6, 11}, {0, 0, 0, 0, 0, 0, 58, 19}, {0, 0, 0, 0, 0, 0, 32, 20}, {2, 2, 0, 0, 0, 0, 131, 44}, {0, 0, 0, 0, 0, 0, 64, 1}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 4, 6}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 16, 7}, {0, 0, 0, 0, 0, 0, 4, 6}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 16, 7}});
-    addModel("TIFA_DRESS", 516, {{0, 0, 0, 0, 0, 0, 8, 51}, {0, 0, 0, 0, 0, 0, 70, 13}, {2, 2, 0, 0, 0, 0, 138, 28}, {0, 0, 0, 0, 0, 0, 42, 8}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 4, 5}, {0, 0, 0, 0, 0, 0, 16, 7}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 4, 5}, {0, 0, 0, 0, 0, 0, 16, 7}});
-    addModel("CLOUD_SWORD", 425, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 8, 26}, {2, 6, 0, 0, 0, 0, 148, 12}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 21, 28}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("BARRET_COREL", 387, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 66, 30}, {3, 4, 0, 0, 0, 0, 76, 20}, {0, 0, 0, 0, 0, 0, 14, 8}, {0, 0, 0, 0, 0, 0, 0, 9}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 14, 8}, {0, 0, 0, 0, 0, 0, 0, 9}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 2, 5}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 4, 10}, {0, 0, 0, 0, 0, 0, 2, 5}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 4, 10}});
-    addModel("CLOUD_WHEELCHAIR", 725, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 8, 26}, {2, 6, 0, 0, 0, 0, 150, 13}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 6, 21}, {0, 0, 0, 0, 0, 0, 0, 92}, {0, 0, 0, 0, 0, 0, 0, 34}, {0, 0, 0, 0, 0, 0, 0, 10}, {0, 0, 0, 0, 0, 0, 0, 24}, {0, 0, 0, 0, 0, 0, 0, 10}, {0, 0, 0, 0, 0, 0, 0, 24}, {0, 0, 0, 0, 0, 0, 0, 76}, {0, 0, 0, 0, 0, 0, 0, 76}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("CLOUD_PARACHUTE", 450, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 12, 39}, {0, 0, 0, 0, 0, 0, 24, 30}, {2, 6, 0, 0, 0, 0, 150, 13}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("TIFA_PARACHUTE", 454, {{0, 0, 0, 0, 0, 0, 0, 22}, {0, 0, 0, 0, 0, 0, 42, 19}, {0, 0, 0, 0, 0, 0, 32, 26}, {2, 2, 0, 0, 0, 0, 124, 22}, {0, 0, 0, 0, 0, 0, 16, 8}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 4, 1}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 5}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 0, 5}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});
-    addModel("BARRET_PARACHUTE", 443, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 60, 34}, {0, 0, 0, 0, 0, 0, 40, 26}, {3, 4, 0, 0, 0, 0, 76, 20}, {0, 0, 0, 0, 0, 0, 14, 8}, {0, 0, 0, 0, 0, 0, 0, 9}, {0, 0, 0, 0, 0, 0, 0, 15}, {0, 0, 0, 0, 0, 0, 14, 8}, {0, 0, 0, 0, 0, 0, 0, 10}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 2, 5}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 4, 10}, {0, 0, 0, 0, 0, 0, 2, 5}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 4, 10}});
-    addModel("REDXIII_PARACHUTE", 526, {{0, 0, 0, 0, 0, 0, 14, 2}, {0, 0, 0, 0, 0, 0, 44, 33}, {0, 0, 0, 0, 0, 0, 36, 28}, {0, 3, 0, 0, 0, 0, 120, 10}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 12, 5}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}, {0, 0, 0, 0, 0, 0, 2, 3}, {0, 0, 0, 0, 0, 0, 2, 3}, {0, 0, 0, 0, 0, 0, 8, 0}, {0, 0, 0, 0, 0, 0, 12, 5}, {0, 0, 0, 0, 0, 0, 2, 11}, {0, 0, 0, 0, 0, 0, 4, 8}, {0, 0, 0, 0, 0, 0, 10, 4}});
-    addModel("CID_PARACHUTE", 466, {{0, 0, 0, 0, 0, 0, 10, 6}, {0, 0, 0, 0, 0, 0, 56, 30}, {0, 0, 0, 0, 0, 0, 16, 34}, {0, 11, 0, 0, 0, 0, 90, 45}, {0, 0, 0, 0, 0, 0, 14, 7}, {0, 0, 0, 0, 0, 0, 0, 13}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 14, 7}, {0, 0, 0, 0, 0, 0, 0, 13}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 12, 9}, {0, 0, 0, 0, 0, 0, 4, 7}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 12, 9}, {0, 0, 0, 0, 0, 0, 4, 7}});
-    addModel("YUFFIE_PARACHUTE", 455, {{0, 0, 0, 0, 0, 0, 2, 13}, {0, 0, 0, 0, 0, 0, 34, 30}, {0, 0, 0, 0, 0, 0, 32, 26}, {2, 2, 0, 0, 0, 0, 128, 34}, {0, 0, 0, 0, 0, 0, 2, 4}, {0, 0, 0, 0, 0, 0, 2, 4}, {0, 0, 0, 0, 0, 0, 14, 13}, {0, 0, 0, 0, 0, 0, 0, 20}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 11}, {0, 0, 0, 0, 0, 0, 0, 10}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 0, 11}, {0, 0, 0, 0, 0, 0, 0, 10}});
-    addModel("CLOUD_WORLD", 378, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 6, 27}, {2, 4 + 2, 0, 0, 0, 0, 148 + 2, 12 + 1}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});
+static constexpr uint8_t fieldModelIDs[] = {
+    1,
+    4,
+    6,
+    7,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    3,
+    0,
+    5,
+    6,
+    0,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    1,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    2,
+    0,
+    3,
+    6,
+    0,
+    5,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    7,
+    7,
+    0,
+    0,
+    0,
+    7,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    0,
+    0,
+    0,
+    8,
+    0,
+    0,
+    0,
+    7,
+    3,
+    1,
+    0,
+    1,
+    3,
+    3,
+    4,
+    2,
+    2,
+    8,
+    8,
+    0,
+    7,
+    6,
+    6,
+    6,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    7,
+    8,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    2,
+    5,
+    0,
+    0,
+    0,
+    0,
+    7,
+    6,
+    1,
+    1,
+    0,
+    0,
+    1,
+    1,
+    1,
+    1,
+    4,
+    6,
+    0,
+    9,
+    5,
+    7,
+    2,
+    3,
+    8,
+    0,
+    4,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    2,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    1,
+    0,
+    1,
+    0,
+    0,
+    1,
+    0,
+    1,
+    3,
+    4,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    1,
+    0,
+    1,
+    3,
+    4,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    4,
+    3,
+    0,
+    0,
+    1,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    2,
+    0,
+    1,
+    3,
+    4,
+    1,
+    3,
+    4,
+    1,
+    0,
+    0,
+    1,
+    0,
+    1,
+    1,
+    0,
+    0,
+    1,
+    1,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    3,
+    2,
+    4,
+    6,
+    5,
+    0,
+    1,
+    2,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    2,
+    4,
+    6,
+    1,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    1,
+    2,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    6,
+    0,
+    1,
+    2,
+    0,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    1,
+    2,
+    0,
+    1,
+    2,
+    0,
+    0,
+    1,
+    3,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    1,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    2,
+    0,
+    0,
+    1,
+    2,
+    0,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    0,
+    2,
+    0,
+    1,
+    2,
+    0,
+    2,
+    0,
+    1,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    0,
+    2,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    2,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    4,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    0,
+    0,
+    1,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    3,
+    4,
+    6,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    6,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    2,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    8,
+    7,
+    6,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    0,
+    0,
+    0,
+    1,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    3,
+    5,
+    0,
+    1,
+    3,
+    4,
+    5,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    0,
+    1,
+    1,
+    3,
+    4,
+    2,
+    5,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    0,
+    0,
+    1,
+    3,
+    2,
+    5,
+    4,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    2,
+    4,
+    5,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    2,
+    4,
+    5,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    4,
+    2,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    1,
+    4,
+    2,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    4,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    1,
+    4,
+    2,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    4,
+    2,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    1,
+    1,
+    4,
+    2,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    4,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    0,
+    0,
+    1,
+    4,
+    0,
+    0,
+    1,
+    1,
+    4,
+    6,
+    1,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    1,
+    1,
+    4,
+    6,
+    1,
+    9,
+    3,
+    2,
+    5,
+    8,
+    7,
+    0,
+    0,
+    1,
+    0,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    5,
+    8,
+    9,
+    7,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    5,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    5,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    3,
+    5,
+    8,
+    9,
+    7,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    8,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    3,
+    0,
+    1,
+    4,
+    6,
+    3,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    4,
+    6,
+    3,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    0,
+    1,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    1,
+    4,
+    6,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    8,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    8,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    6,
+    7,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    6,
+    7,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    1,
+    0,
+    1,
+    2,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    5,
+    7,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    2,
+    4,
+    5,
+    7,
+    8,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    3,
+    4,
+    6,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    3,
+    4,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    6,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    7,
+    6,
+    0,
+    1,
+    4,
+    8,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    8,
+    7,
+    6,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    8,
+    7,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    1,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    6,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    8,
+    9,
+    7,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    6,
+    7,
+    0,
+    0,
+    1,
+    4,
+    6,
+    7,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    6,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    7,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    3,
+    4,
+    2,
+    5,
+    8,
+    9,
+    6,
+    0,
+    7,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    0,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    1,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    2,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    4,
+    6,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    4,
+    6,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    6,
+    0,
+    0,
+    1,
+    4,
+    6,
+    1,
+    4,
+    2,
+    6,
+    3,
+    5,
+    8,
+    9,
+    7,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    1,
+    4,
+    6,
+    1,
+    3,
+    4,
+    5,
+    6,
+    8,
+    9,
+    7,
+    2,
+    0,
+    1,
+    0,
+    2,
+    1,
+    2,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    8,
+    9,
+    7,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    4,
+    6,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    0,
+    0,
+    1,
+    3,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    2,
+    3,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    1,
+    2,
+    3,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    4,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    3,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    0,
+    0,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    0,
+    1,
+    4,
+    1,
+    4,
+    1,
+    1,
+    1,
+    1,
+    1,
+    1,
+    4,
+    1,
+    1,
+    1,
+    1,
+    4,
+    1,
+    1,
+    1,
+    1,
+    1,
+    4,
+    0,
+    1,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    6,
+    1,
+    3,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    1,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    1,
+    7,
+    6,
+    5,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    8,
+    0,
+    0,
+    0,
+    1,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    1,
+    1,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    1,
+    0,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    1,
+    4,
+    1,
+    4,
+    6,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    1,
+    4,
+    6,
+    3,
+    2,
+    5,
+    8,
+    9,
+    7,
+    0,
+    0,
+    0,
+    1,
+    0,
+    2,
+    3,
+    4,
+    5,
+    6,
+    7,
+    8,
+    9,
+    0,
+    0,
+    1,
+    3,
+    4,
+    5,
+    7,
+    8,
+    9,
+    6,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    4,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    1,
+    0,
+    0,
+    0,
+};
+
+static constexpr FieldData fieldTable[] = {
+    { 0x0041, "startmap", {}, {}, {}, {}, { fieldScriptBattles + 0, 1 }, { fieldWorldExits + 0, 1 }, { fieldModelIDs + 0, 4 }, 0x0, {}, {} },
+    { 0x0042, "fship_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4, 9 }, 0x0, {}, {} },
+    { 0x0043, "fship_12", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 13, 10 }, 0x0, {}, {} },
+    { 0x0044, "fship_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 23, 11 }, 0x0, {}, {} },
+    { 0x0045, "fship_22", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 34, 10 }, 0x0, {}, {} },
+    { 0x0046, "fship_23", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 44, 11 }, 0x0, {}, {} },
+    { 0x0047, "fship_24", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 55, 10 }, 0x0, {}, {} },
+    { 0x0048, "fship_25", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 65, 11 }, 0x0, {}, {} },
+    { 0x0049, "fship_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 76, 9 }, 0x0, {}, {} },
+    { 0x004A, "fship_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 85, 10 }, 0x0, {}, {} },
+    { 0x004B, "fship_42", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 95, 11 }, 0x0, {}, {} },
+    { 0x004C, "fship_5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 106, 5 }, 0x0, {}, {} },
+    { 0x004D, "hill", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 111, 2 }, 0x0, {}, {} },
+    { 0x004E, "zz1", { fieldScriptItems + 0, 1 }, {}, { fieldScriptMessages + 0, 1 }, {}, {}, { fieldWorldExits + 1, 1 }, { fieldModelIDs + 113, 4 }, 0x0, {}, {} },
+    { 0x004F, "zz2", { fieldScriptItems + 1, 2 }, {}, { fieldScriptMessages + 1, 2 }, {}, {}, { fieldWorldExits + 2, 1 }, { fieldModelIDs + 117, 4 }, 0x0, {}, {} },
+    { 0x0050, "zz3", {}, { fieldScriptMateria + 0, 1 }, { fieldScriptMessages + 3, 1 }, { fieldScriptShops + 0, 2 }, {}, { fieldWorldExits + 3, 1 }, { fieldModelIDs + 121, 6 }, 0x0, {}, {} },
+    { 0x0051, "zz4", { fieldScriptItems + 3, 2 }, {}, { fieldScriptMessages + 4, 2 }, {}, {}, { fieldWorldExits + 4, 1 }, { fieldModelIDs + 127, 10 }, 0x0, {}, {} },
+    { 0x0052, "zz5", {}, { fieldScriptMateria + 1, 4 }, { fieldScriptMessages + 6, 4 }, {}, {}, { fieldWorldExits + 5, 1 }, { fieldModelIDs + 137, 3 }, 0x0, {}, {} },
+    { 0x0053, "zz6", {}, { fieldScriptMateria + 5, 1 }, { fieldScriptMessages + 10, 1 }, {}, {}, { fieldWorldExits + 6, 1 }, { fieldModelIDs + 140, 4 }, 0x0, {}, {} },
+    { 0x0054, "zz7", {}, { fieldScriptMateria + 6, 4 }, { fieldScriptMessages + 11, 4 }, {}, {}, { fieldWorldExits + 7, 1 }, { fieldModelIDs + 144, 3 }, 0x0, {}, {} },
+    { 0x0055, "zz8", {}, { fieldScriptMateria + 10, 4 }, {}, {}, {}, { fieldWorldExits + 8, 1 }, { fieldModelIDs + 147, 3 }, 0x0, {}, {} },
+    { 0x0056, "sea", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 150, 9 }, 0x0, {}, {} },
+    { 0x0057, "sky", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 159, 9 }, 0x0, {}, {} },
+    { 0x0058, "q_1", { fieldScriptItems + 5, 1 }, {}, { fieldScriptMessages + 15, 1 }, {}, {}, {}, { fieldModelIDs + 168, 3 }, 0x0, {}, {} },
+    { 0x0059, "q_2", {}, {}, {}, {}, { fieldScriptBattles + 1, 1 }, {}, { fieldModelIDs + 171, 3 }, 0x861C, {25372, 23325, 19230, 0, 0, 0, 0, 0, 0, 8991}, {} },
+    { 0x005A, "q_3", { fieldScriptItems + 6, 3 }, { fieldScriptMateria + 14, 1 }, { fieldScriptMessages + 16, 4 }, {}, {}, {}, { fieldModelIDs + 174, 5 }, 0x63B0, {25376, 23329, 19234, 0, 0, 0, 4899, 4899, 0, 0}, {} },
+    { 0x005B, "q_4", { fieldScriptItems + 9, 4 }, { fieldScriptMateria + 15, 1 }, { fieldScriptMessages + 20, 5 }, {}, {}, {}, { fieldModelIDs + 179, 6 }, 0x7924, {19236, 18208, 16161, 15138, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x005D, "blackbg1", { fieldScriptItems + 13, 1 }, {}, {}, {}, {}, {}, { fieldModelIDs + 185, 9 }, 0x0, {}, {} },
+    { 0x005E, "blackbg2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 194, 14 }, 0x0, {}, {} },
+    { 0x005F, "blackbg3", { fieldScriptItems + 14, 4 }, {}, {}, {}, {}, {}, { fieldModelIDs + 208, 9 }, 0x0, {}, {} },
+    { 0x0060, "blackbg4", { fieldScriptItems + 18, 48 }, { fieldScriptMateria + 16, 48 }, {}, { fieldScriptShops + 2, 1 }, { fieldScriptBattles + 2, 1 }, {}, { fieldModelIDs + 217, 14 }, 0x0, {}, {} },
+    { 0x0061, "blackbg5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 231, 14 }, 0x0, {}, {} },
+    { 0x0062, "blackbg6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 245, 14 }, 0x0, {}, {} },
+    { 0x0063, "blackbg7", { fieldScriptItems + 66, 3 }, {}, {}, {}, { fieldScriptBattles + 3, 2 }, {}, { fieldModelIDs + 259, 12 }, 0x0, {}, {} },
+    { 0x0064, "blackbg8", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 271, 11 }, 0x0, {}, {} },
+    { 0x0065, "blackbg9", {}, {}, {}, {}, { fieldScriptBattles + 5, 1 }, {}, { fieldModelIDs + 282, 1 }, 0x0, {}, {} },
+    { 0x0067, "blackbgb", {}, {}, {}, {}, { fieldScriptBattles + 6, 1 }, {}, { fieldModelIDs + 283, 3 }, 0x0, {}, {} },
+    { 0x0068, "blackbgc", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 286, 1 }, 0x0, {}, {} },
+    { 0x006A, "blackbge", {}, {}, {}, {}, { fieldScriptBattles + 7, 1 }, {}, { fieldModelIDs + 287, 1 }, 0x0, {}, {} },
+    { 0x006D, "blackbgh", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 288, 1 }, 0x0, {}, {} },
+    { 0x006E, "blackbgi", {}, { fieldScriptMateria + 64, 1 }, {}, {}, {}, {}, { fieldModelIDs + 289, 11 }, 0x0, {}, {} },
+    { 0x006F, "blackbgj", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 300, 1 }, 0x0, {}, {} },
+    { 0x0070, "blackbgk", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 301, 11 }, 0x0, {}, {} },
+    { 0x0073, "whitebg3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 312, 8 }, 0x0, {}, {} },
+    { 0x0074, "md1stin", { fieldScriptItems + 69, 6 }, {}, { fieldScriptMessages + 25, 6 }, {}, { fieldScriptBattles + 8, 1 }, {}, { fieldModelIDs + 320, 10 }, 0x8154, {24877, 22830, 18735, 0, 0, 0, 4400, 4400, 0, 0}, {} },
+    { 0x0075, "md1_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 330, 7 }, 0x762C, {24877, 22830, 18735, 0, 0, 0, 4400, 4400, 0, 0}, {} },
+    { 0x0076, "md1_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 337, 4 }, 0x7220, {24877, 22830, 18735, 0, 0, 0, 4400, 4400, 0, 0}, {} },
+    { 0x0077, "nrthmk", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 341, 5 }, 0x63F0, {18737, 17714, 15667, 14643, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0078, "nmkin_1", { fieldScriptItems + 75, 1 }, {}, { fieldScriptMessages + 31, 1 }, {}, {}, {}, { fieldModelIDs + 346, 9 }, 0x8E68, {18742, 17719, 15672, 14649, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0079, "elevtr1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 355, 3 }, 0x0, {}, {} },
+    { 0x007A, "nmkin_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 358, 2 }, 0xA610, {14644, 12597, 11574, 10551, 9528, 8505, 4410, 4411, 0, 0}, {} },
+    { 0x007B, "nmkin_3", { fieldScriptItems + 76, 1 }, {}, { fieldScriptMessages + 32, 1 }, {}, {}, {}, { fieldModelIDs + 360, 3 }, 0xA184, {24892, 22845, 18750, 0, 0, 0, 4415, 4415, 0, 0}, {} },
+    { 0x007C, "nmkin_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 363, 2 }, 0x93B0, {24896, 22849, 18754, 0, 0, 0, 4419, 4419, 0, 0}, {} },
+    { 0x007D, "nmkin_5", {}, { fieldScriptMateria + 65, 1 }, { fieldScriptMessages + 33, 1 }, {}, { fieldScriptBattles + 9, 1 }, {}, { fieldModelIDs + 365, 4 }, 0x0, {}, {} },
+    { 0x007E, "southmk1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 369, 9 }, 0x0, {}, {} },
+    { 0x007F, "southmk2", {}, {}, {}, {}, { fieldScriptBattles + 10, 1 }, {}, { fieldModelIDs + 378, 6 }, 0x0, {}, {} },
+    { 0x0080, "smkin_1", { fieldScriptItems + 77, 1 }, {}, { fieldScriptMessages + 34, 1 }, {}, {}, {}, { fieldModelIDs + 384, 7 }, 0x9310, {15704, 14681, 13658, 12635, 10588, 0, 2397, 2398, 0, 4447}, {} },
+    { 0x0081, "smkin_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 391, 1 }, 0x9570, {18784, 17761, 15714, 14691, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0082, "smkin_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 392, 1 }, 0x8858, {18784, 17761, 15714, 14691, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0083, "smkin_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 393, 2 }, 0x94BC, {24932, 22885, 18790, 0, 0, 0, 4455, 4455, 0, 0}, {} },
+    { 0x0084, "smkin_5", {}, { fieldScriptMateria + 66, 1 }, { fieldScriptMessages + 35, 1 }, {}, { fieldScriptBattles + 11, 1 }, {}, { fieldModelIDs + 395, 4 }, 0x9B70, {24932, 22885, 18790, 0, 0, 0, 4455, 4455, 0, 0}, {} },
+    { 0x0085, "md8_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 399, 5 }, 0x0, {}, {} },
+    { 0x0086, "md8_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 404, 5 }, 0x0, {}, {} },
+    { 0x0087, "md8_3", { fieldScriptItems + 78, 1 }, {}, { fieldScriptMessages + 36, 1 }, {}, {}, {}, { fieldModelIDs + 409, 11 }, 0x0, {}, {} },
+    { 0x0088, "md8_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 420, 5 }, 0x0, {}, {} },
+    { 0x0089, "md8brdg", {}, {}, {}, {}, { fieldScriptBattles + 12, 3 }, {}, { fieldModelIDs + 425, 11 }, 0x0, {}, {} },
+    { 0x008A, "cargoin", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 436, 5 }, 0x0, {}, {} },
+    { 0x008B, "tin_1", { fieldScriptItems + 79, 1 }, {}, { fieldScriptMessages + 37, 1 }, {}, {}, {}, { fieldModelIDs + 441, 12 }, 0x0, {}, {} },
+    { 0x008C, "tin_2", { fieldScriptItems + 80, 1 }, {}, { fieldScriptMessages + 38, 1 }, {}, {}, {}, { fieldModelIDs + 453, 12 }, 0x0, {}, {} },
+    { 0x008D, "tin_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 465, 9 }, 0x0, {}, {} },
+    { 0x008E, "tin_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 474, 12 }, 0x0, {}, {} },
+    { 0x008F, "rootmap", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 486, 2 }, 0x0, {}, {} },
+    { 0x0090, "mds7st1", { fieldScriptItems + 81, 5 }, {}, { fieldScriptMessages + 39, 5 }, {}, {}, {}, { fieldModelIDs + 488, 10 }, 0x767C, {15756, 14733, 13709, 12686, 10639, 0, 0, 0, 0, 0}, {18824, 17801, 15754, 14731, 0, 0, 0, 0, 0, 0} },
+    { 0x0091, "mds7st2", { fieldScriptItems + 86, 3 }, {}, { fieldScriptMessages + 44, 3 }, {}, {}, {}, { fieldModelIDs + 498, 8 }, 0x8534, {15760, 14737, 13709, 12686, 10639, 0, 0, 0, 0, 0}, {18824, 17801, 15754, 14731, 0, 0, 0, 0, 0, 0} },
+    { 0x0092, "mds7st3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 506, 12 }, 0x0, {}, {} },
+    { 0x0093, "mds7st32", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 518, 9 }, 0x0, {}, {} },
+    { 0x0094, "mds7_w1", {}, {}, {}, { fieldScriptShops + 3, 1 }, {}, {}, { fieldModelIDs + 527, 4 }, 0x0, {}, {} },
+    { 0x0095, "mds7_w2", { fieldScriptItems + 89, 2 }, { fieldScriptMateria + 67, 5 }, { fieldScriptMessages + 47, 2 }, {}, {}, {}, { fieldModelIDs + 531, 15 }, 0x0, {}, {} },
+    { 0x0096, "mds7_w3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 546, 2 }, 0x0, {}, {} },
+    { 0x0097, "mds7", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 548, 11 }, 0x0, {}, {} },
+    { 0x0098, "mds7_im", {}, {}, {}, { fieldScriptShops + 4, 1 }, {}, {}, { fieldModelIDs + 559, 2 }, 0x0, {}, {} },
+    { 0x0099, "7min1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 561, 8 }, 0x0, {}, {} },
+    { 0x009A, "mds7pb_1", {}, { fieldScriptMateria + 72, 1 }, {}, {}, {}, {}, { fieldModelIDs + 569, 12 }, 0x0, {}, {} },
+    { 0x009B, "mds7pb_2", {}, { fieldScriptMateria + 73, 1 }, {}, {}, {}, {}, { fieldModelIDs + 581, 10 }, 0x0, {}, {} },
+    { 0x009C, "mds7plr1", {}, {}, {}, { fieldScriptShops + 5, 1 }, {}, {}, { fieldModelIDs + 591, 13 }, 0x0, {}, {} },
+    { 0x009D, "mds7plr2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 604, 6 }, 0x0, {}, {} },
+    { 0x009E, "pillar_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 610, 2 }, 0x8E98, {24980, 22933, 18838, 0, 0, 0, 4503, 4503, 0, 0}, {} },
+    { 0x009F, "pillar_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 612, 5 }, 0xA68C, {24980, 22933, 18838, 0, 0, 0, 3479, 3479, 0, 6552}, {} },
+    { 0x00A0, "pillar_3", {}, {}, {}, {}, { fieldScriptBattles + 15, 1 }, {}, { fieldModelIDs + 617, 9 }, 0x0, {}, {} },
+    { 0x00A1, "tunnel_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 626, 3 }, 0x5AEC, {24908, 22861, 18766, 0, 0, 0, 4431, 4431, 0, 0}, {} },
+    { 0x00A2, "tunnel_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 629, 3 }, 0x0, {}, {} },
+    { 0x00A3, "tunnel_3", {}, {}, {}, {}, { fieldScriptBattles + 16, 1 }, {}, { fieldModelIDs + 632, 3 }, 0x0, {}, {} },
+    { 0x00A4, "4sbwy_1", { fieldScriptItems + 91, 1 }, {}, { fieldScriptMessages + 49, 1 }, {}, {}, {}, { fieldModelIDs + 635, 2 }, 0x31F4, {24912, 22865, 18770, 0, 0, 0, 0, 0, 0, 8531}, {} },
+    { 0x00A5, "4sbwy_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 637, 1 }, 0x0, {}, {} },
+    { 0x00A6, "4sbwy_3", { fieldScriptItems + 92, 1 }, {}, { fieldScriptMessages + 50, 1 }, {}, {}, {}, { fieldModelIDs + 638, 3 }, 0x464C, {24912, 22865, 18770, 0, 0, 0, 0, 0, 0, 8531}, {} },
+    { 0x00A7, "4sbwy_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 641, 1 }, 0x4AC0, {24916, 22869, 18774, 0, 0, 0, 4439, 4439, 0, 0}, {} },
+    { 0x00A8, "4sbwy_5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 642, 2 }, 0x75A0, {24916, 22869, 18774, 0, 0, 0, 4439, 4439, 0, 0}, {} },
+    { 0x00A9, "4sbwy_6", { fieldScriptItems + 93, 1 }, {}, { fieldScriptMessages + 51, 1 }, {}, {}, {}, { fieldModelIDs + 644, 4 }, 0x6458, {24916, 22869, 18774, 0, 0, 0, 4439, 4439, 0, 0}, {} },
+    { 0x00AA, "mds5_5", {}, {}, {}, {}, {}, { fieldWorldExits + 9, 1 }, { fieldModelIDs + 648, 7 }, 0x0, {}, {} },
+    { 0x00AB, "mds5_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 655, 2 }, 0x0, {}, {} },
+    { 0x00AC, "mds5_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 657, 7 }, 0x68CC, {24952, 22905, 18810, 0, 0, 0, 4475, 4475, 0, 0}, {} },
+    { 0x00AD, "mds5_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 664, 6 }, 0x7520, {24952, 22905, 18810, 0, 0, 0, 4475, 4475, 0, 0}, {} },
+    { 0x00AE, "5min1_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 670, 6 }, 0x0, {}, {} },
+    { 0x00AF, "5min1_2", { fieldScriptItems + 94, 1 }, {}, { fieldScriptMessages + 52, 2 }, {}, {}, {}, { fieldModelIDs + 676, 5 }, 0x0, {}, {} },
+    { 0x00B0, "mds5_dk", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 681, 5 }, 0x0, {}, {} },
+    { 0x00B1, "mds5_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 686, 10 }, 0x0, {}, {} },
+    { 0x00B2, "mds5_w", {}, {}, {}, { fieldScriptShops + 6, 6 }, {}, {}, { fieldModelIDs + 696, 6 }, 0x0, {}, {} },
+    { 0x00B3, "mds5_i", {}, {}, {}, { fieldScriptShops + 12, 4 }, {}, {}, { fieldModelIDs + 702, 4 }, 0x0, {}, {} },
+    { 0x00B4, "mds5_m", {}, {}, {}, { fieldScriptShops + 16, 6 }, {}, {}, { fieldModelIDs + 706, 4 }, 0x0, {}, {} },
+    { 0x00B5, "church", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 710, 4 }, 0x0, {}, {} },
+    { 0x00B6, "chrin_1a", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 714, 8 }, 0x0, {}, {} },
+    { 0x00B7, "chrin_1b", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 722, 6 }, 0x0, {}, {} },
+    { 0x00B8, "chrin_2", {}, {}, {}, {}, { fieldScriptBattles + 17, 7 }, {}, { fieldModelIDs + 728, 12 }, 0x840C, {24944, 22896, 18801, 0, 0, 0, 3442, 3442, 0, 6515}, {} },
+    { 0x00B9, "chrin_3a", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 740, 2 }, 0x41F8, {24944, 22896, 18801, 0, 0, 0, 3442, 3442, 0, 6515}, {} },
+    { 0x00BA, "chrin_3b", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 742, 2 }, 0x4488, {24944, 22896, 18801, 0, 0, 0, 3442, 3442, 0, 6515}, {} },
+    { 0x00BB, "eals_1", { fieldScriptItems + 95, 1 }, { fieldScriptMateria + 74, 1 }, { fieldScriptMessages + 54, 2 }, {}, {}, {}, { fieldModelIDs + 744, 7 }, 0x0, {}, {} },
+    { 0x00BC, "ealin_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 751, 9 }, 0x0, {}, {} },
+    { 0x00BD, "ealin_12", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 760, 9 }, 0x0, {}, {} },
+    { 0x00BE, "ealin_2", { fieldScriptItems + 96, 2 }, {}, { fieldScriptMessages + 56, 2 }, {}, {}, {}, { fieldModelIDs + 769, 9 }, 0x0, {}, {} },
+    { 0x00BF, "mds6_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 778, 6 }, 0x941C, {24956, 22909, 18812, 0, 0, 0, 0, 0, 8574, 8575}, {} },
+    { 0x00C0, "mds6_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 784, 7 }, 0x0, {}, {} },
+    { 0x00C1, "mds6_22", {}, { fieldScriptMateria + 75, 1 }, { fieldScriptMessages + 58, 1 }, {}, {}, {}, { fieldModelIDs + 791, 5 }, 0x0, {}, {} },
+    { 0x00C2, "mds6_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 796, 3 }, 0x0, {}, {} },
+    { 0x00C3, "mrkt2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 799, 12 }, 0x0, {}, {} },
+    { 0x00C4, "mkt_w", { fieldScriptItems + 98, 4 }, {}, { fieldScriptMessages + 59, 2 }, { fieldScriptShops + 22, 1 }, {}, {}, { fieldModelIDs + 811, 8 }, 0x0, {}, {} },
+    { 0x00C5, "mkt_mens", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 819, 9 }, 0x0, {}, {} },
+    { 0x00C6, "mkt_ia", { fieldScriptItems + 102, 2 }, {}, { fieldScriptMessages + 61, 2 }, {}, {}, {}, { fieldModelIDs + 828, 11 }, 0x0, {}, {} },
+    { 0x00C7, "mktinn", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 839, 5 }, 0x0, {}, {} },
+    { 0x00C8, "mkt_m", {}, {}, {}, { fieldScriptShops + 23, 1 }, {}, {}, { fieldModelIDs + 844, 5 }, 0x0, {}, {} },
+    { 0x00C9, "mkt_s1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 849, 7 }, 0x0, {}, {} },
+    { 0x00CA, "mkt_s2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 856, 14 }, 0x0, {}, {} },
+    { 0x00CB, "mkt_s3", {}, {}, {}, { fieldScriptShops + 24, 3 }, {}, {}, { fieldModelIDs + 870, 5 }, 0x0, {}, {} },
+    { 0x00CC, "mktpb", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 875, 12 }, 0x0, {}, {} },
+    { 0x00CD, "mrkt1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 887, 10 }, 0x0, {}, {} },
+    { 0x00CE, "colne_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 897, 8 }, 0x0, {}, {} },
+    { 0x00CF, "colne_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 905, 8 }, 0x0, {}, {} },
+    { 0x00D0, "colne_3", { fieldScriptItems + 104, 1 }, {}, { fieldScriptMessages + 63, 1 }, {}, { fieldScriptBattles + 24, 2 }, {}, { fieldModelIDs + 913, 11 }, 0x0, {}, {} },
+    { 0x00D1, "colne_4", { fieldScriptItems + 105, 1 }, {}, { fieldScriptMessages + 64, 1 }, {}, {}, {}, { fieldModelIDs + 924, 10 }, 0x0, {}, {} },
+    { 0x00D2, "colne_5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 934, 10 }, 0x0, {}, {} },
+    { 0x00D3, "colne_6", { fieldScriptItems + 106, 1 }, {}, { fieldScriptMessages + 65, 1 }, {}, {}, {}, { fieldModelIDs + 944, 9 }, 0x0, {}, {} },
+    { 0x00D4, "colne_b1", { fieldScriptItems + 107, 1 }, { fieldScriptMateria + 76, 1 }, { fieldScriptMessages + 66, 2 }, {}, { fieldScriptBattles + 26, 1 }, {}, { fieldModelIDs + 953, 5 }, 0xBE0C, {18820, 17797, 15750, 14727, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x00D5, "colne_b3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 958, 1 }, 0x72B0, {18820, 17797, 15750, 14727, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x00D6, "mrkt3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 959, 11 }, 0x0, {}, {} },
+    { 0x00D8, "onna_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 970, 4 }, 0x0, {}, {} },
+    { 0x00DA, "onna_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 974, 3 }, 0x0, {}, {} },
+    { 0x00DB, "onna_5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 977, 9 }, 0x0, {}, {} },
+    { 0x00DC, "onna_52", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 986, 12 }, 0x0, {}, {} },
+    { 0x00DE, "mrkt4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 998, 7 }, 0x0, {}, {} },
+    { 0x00DF, "wcrimb_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1005, 4 }, 0x0, {}, {} },
+    { 0x00E0, "wcrimb_2", { fieldScriptItems + 108, 1 }, {}, { fieldScriptMessages + 68, 1 }, {}, {}, {}, { fieldModelIDs + 1009, 1 }, 0x0, {}, {} },
+    { 0x00E1, "md0", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1010, 8 }, 0x0, {}, {} },
+    { 0x00E2, "roadend", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1018, 5 }, 0x0, {}, {} },
+    { 0x00E3, "sinbil_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1023, 10 }, 0x5924, {24992, 22945, 18848, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x00E4, "sinbil_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1033, 9 }, 0x0, {}, {} },
+    { 0x00E5, "blinst_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1042, 4 }, 0x0, {}, {} },
+    { 0x00E6, "blinst_2", { fieldScriptItems + 109, 2 }, {}, { fieldScriptMessages + 69, 2 }, {}, {}, {}, { fieldModelIDs + 1046, 6 }, 0x0, {}, {} },
+    { 0x00E7, "blinst_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1052, 4 }, 0x0, {}, {} },
+    { 0x00E8, "blinele", {}, {}, {}, {}, { fieldScriptBattles + 27, 16 }, {}, { fieldModelIDs + 1056, 8 }, 0x0, {}, {} },
+    { 0x00E9, "eleout", {}, {}, {}, {}, { fieldScriptBattles + 43, 1 }, {}, { fieldModelIDs + 1064, 6 }, 0x0, {}, {} },
+    { 0x00EA, "blin1", {}, {}, { fieldScriptMessages + 71, 1 }, {}, { fieldScriptBattles + 44, 1 }, {}, { fieldModelIDs + 1070, 16 }, 0xC1D8, {24992, 22945, 18848, 0, 0, 0, 0, 0, 0, 8610}, {} },
+    { 0x00EB, "blin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1086, 9 }, 0x6588, {24992, 22945, 18851, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x00EC, "blin2_i", { fieldScriptItems + 111, 2 }, {}, { fieldScriptMessages + 72, 1 }, { fieldScriptShops + 27, 3 }, {}, {}, { fieldModelIDs + 1095, 10 }, 0x0, {}, {} },
+    { 0x00ED, "blin3_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1105, 4 }, 0x56BC, {24995, 22945, 18848, 0, 0, 0, 0, 0, 0, 8610}, {} },
+    { 0x00EE, "blin59", {}, {}, {}, {}, { fieldScriptBattles + 45, 2 }, {}, { fieldModelIDs + 1109, 7 }, 0x7520, {24995, 22948, 18853, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x00EF, "blin60_1", {}, {}, {}, {}, { fieldScriptBattles + 47, 1 }, {}, { fieldModelIDs + 1116, 9 }, 0x0, {}, {} },
+    { 0x00F0, "blin60_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1125, 3 }, 0x0, {}, {} },
+    { 0x00F1, "blin61", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1128, 9 }, 0x0, {}, {} },
+    { 0x00F2, "blin62_1", { fieldScriptItems + 113, 3 }, { fieldScriptMateria + 77, 1 }, { fieldScriptMessages + 73, 4 }, {}, {}, {}, { fieldModelIDs + 1137, 11 }, 0x0, {}, {} },
+    { 0x00F3, "blin62_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1148, 9 }, 0x0, {}, {} },
+    { 0x00F4, "blin62_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1157, 9 }, 0x0, {}, {} },
+    { 0x00F5, "blin63_1", { fieldScriptItems + 116, 5 }, { fieldScriptMateria + 78, 1 }, { fieldScriptMessages + 77, 6 }, {}, {}, {}, { fieldModelIDs + 1166, 4 }, 0xBDE4, {18856, 17833, 15786, 14763, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x00F6, "blin63_t", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1170, 1 }, 0x0, {}, {} },
+    { 0x00F7, "blin64", { fieldScriptItems + 121, 5 }, {}, { fieldScriptMessages + 83, 5 }, {}, {}, {}, { fieldModelIDs + 1171, 13 }, 0x0, {}, {} },
+    { 0x00F8, "blin65_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1184, 9 }, 0x7524, {15784, 14761, 13738, 12715, 10668, 0, 4525, 4525, 0, 0}, {} },
+    { 0x00F9, "blin65_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1193, 3 }, 0x0, {}, {} },
+    { 0x00FA, "blin66_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1196, 14 }, 0x0, {}, {} },
+    { 0x00FB, "blin66_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1210, 7 }, 0x0, {}, {} },
+    { 0x00FC, "blin66_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1217, 1 }, 0x0, {}, {} },
+    { 0x00FD, "blin66_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1218, 2 }, 0x0, {}, {} },
+    { 0x00FE, "blin66_5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1220, 8 }, 0x0, {}, {} },
+    { 0x00FF, "blin66_6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1228, 8 }, 0x0, {}, {} },
+    { 0x0100, "blin67_1", {}, { fieldScriptMateria + 79, 1 }, { fieldScriptMessages + 88, 1 }, {}, {}, {}, { fieldModelIDs + 1236, 10 }, 0xB484, {18864, 17844, 15797, 14774, 0, 0, 4535, 4535, 0, 0}, {} },
+    { 0x0101, "blin671b", {}, { fieldScriptMateria + 80, 1 }, { fieldScriptMessages + 89, 1 }, {}, {}, {}, { fieldModelIDs + 1246, 10 }, 0xA8E8, {25020, 22973, 18878, 0, 0, 0, 4543, 4543, 0, 0}, {} },
+    { 0x0102, "blin67_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1256, 6 }, 0x0, {}, {} },
+    { 0x0103, "blin67_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1262, 6 }, 0xB3D8, {18864, 17844, 15797, 14774, 0, 0, 4535, 4535, 0, 0}, {} },
+    { 0x0104, "blin673b", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1268, 5 }, 0x9BD0, {25020, 22973, 18878, 0, 0, 0, 4543, 4543, 0, 0}, {} },
+    { 0x0105, "blin67_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1273, 1 }, 0x0, {}, {} },
+    { 0x0106, "blin68_1", { fieldScriptItems + 126, 4 }, {}, { fieldScriptMessages + 90, 4 }, {}, {}, {}, { fieldModelIDs + 1274, 12 }, 0xCC68, {18865, 17848, 15801, 14778, 0, 0, 4539, 4539, 0, 0}, {25024, 22977, 18882, 0, 0, 0, 0, 0, 0, 451} },
+    { 0x0107, "blin68_2", {}, { fieldScriptMateria + 81, 1 }, { fieldScriptMessages + 94, 1 }, {}, { fieldScriptBattles + 48, 1 }, {}, { fieldModelIDs + 1286, 7 }, 0xE3A4, {18865, 17848, 15801, 14778, 0, 0, 4539, 4539, 0, 0}, {25024, 22977, 18882, 0, 0, 0, 0, 0, 0, 451} },
+    { 0x0108, "blin69_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1293, 9 }, 0xED94, {18884, 17861, 15809, 14786, 0, 0, 2502, 2502, 0, 4551}, {} },
+    { 0x010A, "blin70_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1302, 11 }, 0x0, {}, {} },
+    { 0x010B, "blin70_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1313, 12 }, 0x0, {}, {} },
+    { 0x010C, "blin70_3", {}, {}, {}, {}, { fieldScriptBattles + 49, 1 }, {}, { fieldModelIDs + 1325, 8 }, 0x0, {}, {} },
+    { 0x010D, "blin70_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1333, 5 }, 0x0, {}, {} },
+    { 0x010E, "niv_w", { fieldScriptItems + 130, 1 }, {}, { fieldScriptMessages + 95, 1 }, { fieldScriptShops + 30, 1 }, {}, {}, { fieldModelIDs + 1338, 8 }, 0x0, {}, {} },
+    { 0x010F, "nvmin1_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1346, 13 }, 0x0, {}, {} },
+    { 0x0110, "nvmin1_2", { fieldScriptItems + 131, 1 }, {}, {}, {}, {}, {}, { fieldModelIDs + 1359, 6 }, 0x0, {}, {} },
+    { 0x0111, "nivinn_1", { fieldScriptItems + 132, 1 }, {}, {}, {}, {}, {}, { fieldModelIDs + 1365, 14 }, 0x0, {}, {} },
+    { 0x0112, "nivinn_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1379, 7 }, 0x0, {}, {} },
+    { 0x0114, "niv_cl", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1386, 6 }, 0x0, {}, {} },
+    { 0x0115, "trackin", {}, {}, {}, {}, { fieldScriptBattles + 50, 1 }, {}, { fieldModelIDs + 1392, 6 }, 0x0, {}, {} },
+    { 0x0116, "trackin2", {}, {}, {}, {}, { fieldScriptBattles + 51, 1 }, {}, { fieldModelIDs + 1398, 5 }, 0x0, {}, {} },
+    { 0x0117, "nivgate", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1403, 14 }, 0x0, {}, {} },
+    { 0x0118, "nivgate2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1417, 9 }, 0x0, {}, {} },
+    { 0x011A, "nivl", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1426, 9 }, 0x0, {}, {} },
+    { 0x011B, "nivl_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1435, 2 }, 0x0, {}, {} },
+    { 0x011C, "nivl_3", { fieldScriptItems + 133, 1 }, {}, {}, {}, {}, { fieldWorldExits + 10, 2 }, { fieldModelIDs + 1437, 13 }, 0x0, {}, {} },
+    { 0x011E, "niv_ti1", { fieldScriptItems + 134, 1 }, {}, {}, {}, {}, {}, { fieldModelIDs + 1450, 12 }, 0x0, {}, {} },
+    { 0x011F, "niv_ti2", { fieldScriptItems + 135, 2 }, { fieldScriptMateria + 82, 1 }, { fieldScriptMessages + 96, 2 }, {}, {}, {}, { fieldModelIDs + 1462, 11 }, 0x0, {}, {} },
+    { 0x0120, "niv_ti3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1473, 7 }, 0x0, {}, {} },
+    { 0x0121, "niv_ti4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1480, 8 }, 0x0, {}, {} },
+    { 0x0122, "nivl_b1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1488, 6 }, 0x0, {}, {} },
+    { 0x0123, "nivl_b12", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1494, 6 }, 0x0, {}, {} },
+    { 0x0124, "nivl_b2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1500, 7 }, 0x0, {}, {} },
+    { 0x0125, "nivl_b22", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1507, 11 }, 0x0, {}, {} },
+    { 0x0126, "nivl_e1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1518, 4 }, 0x0, {}, {} },
+    { 0x0127, "nivl_e2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1522, 4 }, 0x0, {}, {} },
+    { 0x0128, "nivl_e3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1526, 1 }, 0x0, {}, {} },
+    { 0x0129, "sinin1_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1527, 5 }, 0x7ED4, {25132, 23085, 18990, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x012A, "sinin1_2", { fieldScriptItems + 137, 2 }, {}, { fieldScriptMessages + 98, 2 }, {}, {}, {}, { fieldModelIDs + 1532, 8 }, 0x7AD4, {25132, 23085, 18990, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x012B, "sinin2_1", { fieldScriptItems + 139, 1 }, { fieldScriptMateria + 83, 1 }, { fieldScriptMessages + 100, 2 }, {}, { fieldScriptBattles + 52, 3 }, {}, { fieldModelIDs + 1540, 7 }, 0xB14C, {18990, 17968, 15921, 14898, 0, 0, 2607, 2607, 0, 4659}, {} },
+    { 0x012C, "sinin2_2", { fieldScriptItems + 140, 1 }, {}, { fieldScriptMessages + 102, 1 }, {}, {}, {}, { fieldModelIDs + 1547, 6 }, 0x78FC, {18990, 17968, 15921, 14898, 0, 0, 2607, 2607, 0, 4659}, {} },
+    { 0x012D, "sinin3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1553, 4 }, 0x6868, {25134, 23092, 18997, 0, 0, 0, 2614, 2614, 0, 4659}, {} },
+    { 0x012E, "sininb1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1557, 10 }, 0x4C44, {15927, 14904, 13881, 12860, 10813, 0, 2618, 2622, 0, 4667}, {} },
+    { 0x012F, "sininb2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1567, 12 }, 0x7B8C, {15927, 14904, 13881, 12860, 10813, 0, 2618, 2622, 0, 4667}, {} },
+    { 0x0130, "sininb31", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1579, 2 }, 0x0, {}, {} },
+    { 0x0131, "sininb32", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1581, 9 }, 0x0, {}, {} },
+    { 0x0132, "sininb33", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1590, 3 }, 0x0, {}, {} },
+    { 0x0133, "sininb41", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1593, 3 }, 0x0, {}, {} },
+    { 0x0134, "sininb42", {}, { fieldScriptMateria + 84, 1 }, { fieldScriptMessages + 103, 1 }, {}, {}, {}, { fieldModelIDs + 1596, 5 }, 0x0, {}, {} },
+    { 0x0135, "sininb51", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1601, 2 }, 0x0, {}, {} },
+    { 0x0136, "sininb52", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1603, 3 }, 0x0, {}, {} },
+    { 0x0137, "mtnvl2", { fieldScriptItems + 141, 2 }, {}, { fieldScriptMessages + 104, 2 }, {}, {}, { fieldWorldExits + 12, 1 }, { fieldModelIDs + 1606, 15 }, 0xDAF0, {19012, 17989, 15942, 14919, 0, 0, 0, 0, 0, 0}, {19012, 17989, 15942, 14919, 0, 0, 0, 0, 0, 0} },
+    { 0x0138, "mtnvl3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1621, 12 }, 0xB07C, {25160, 23113, 19018, 0, 0, 0, 0, 0, 0, 8779}, {35400, 31305, 0, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x0139, "mtnvl4", {}, {}, {}, {}, {}, { fieldWorldExits + 13, 1 }, { fieldModelIDs + 1633, 7 }, 0xBE80, {19012, 17989, 15942, 14919, 0, 0, 0, 0, 0, 0}, {19012, 17989, 15942, 14919, 0, 0, 0, 0, 0, 0} },
+    { 0x013A, "mtnvl5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1640, 7 }, 0xAB28, {15948, 14925, 13902, 12879, 10832, 0, 0, 0, 0, 0}, {25164, 23117, 19022, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x013B, "mtnvl6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1647, 4 }, 0xA818, {15948, 14925, 13902, 12879, 10832, 0, 4689, 4689, 0, 0}, {25164, 23117, 19022, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x013C, "mtnvl6b", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1651, 7 }, 0x7810, {15948, 14925, 13902, 12879, 10832, 0, 2641, 2641, 0, 4690}, {25164, 23117, 19022, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x013D, "nvdun1", { fieldScriptItems + 143, 1 }, { fieldScriptMateria + 85, 2 }, { fieldScriptMessages + 106, 3 }, {}, { fieldScriptBattles + 55, 1 }, {}, { fieldModelIDs + 1658, 9 }, 0xD220, {19028, 18005, 15958, 14935, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x013E, "nvdun2", { fieldScriptItems + 144, 1 }, {}, { fieldScriptMessages + 109, 1 }, {}, {}, {}, { fieldModelIDs + 1667, 8 }, 0x8F94, {19028, 18005, 15958, 14935, 0, 0, 0, 0, 0, 0}, {25172, 23125, 19030, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x013F, "nvdun3", {}, { fieldScriptMateria + 87, 1 }, { fieldScriptMessages + 110, 1 }, {}, {}, {}, { fieldModelIDs + 1675, 9 }, 0x0, {}, {} },
+    { 0x0140, "nvdun31", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1684, 6 }, 0x0, {}, {} },
+    { 0x0141, "nvdun4", { fieldScriptItems + 145, 1 }, {}, { fieldScriptMessages + 111, 1 }, {}, {}, {}, { fieldModelIDs + 1690, 5 }, 0xA790, {19028, 18005, 15958, 14935, 0, 0, 0, 0, 0, 0}, {25172, 23125, 19030, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x0142, "nvmkin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1695, 10 }, 0x0, {}, {} },
+    { 0x0143, "nvmkin21", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1705, 8 }, 0x0, {}, {} },
+    { 0x0144, "nvmkin22", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1713, 11 }, 0x0, {}, {} },
+    { 0x0145, "nvmkin23", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1724, 1 }, 0x0, {}, {} },
+    { 0x0146, "nvmkin31", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1725, 2 }, 0x0, {}, {} },
+    { 0x0147, "nvmkin32", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1727, 6 }, 0x0, {}, {} },
+    { 0x0148, "elm_wa", {}, {}, {}, { fieldScriptShops + 31, 2 }, {}, {}, { fieldModelIDs + 1733, 5 }, 0x0, {}, {} },
+    { 0x0149, "elm_i", {}, {}, {}, { fieldScriptShops + 33, 1 }, {}, {}, { fieldModelIDs + 1738, 4 }, 0x0, {}, {} },
+    { 0x014A, "elmpb", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1742, 7 }, 0x0, {}, {} },
+    { 0x014B, "elminn_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1749, 7 }, 0x0, {}, {} },
+    { 0x014C, "elminn_2", { fieldScriptItems + 146, 1 }, {}, { fieldScriptMessages + 112, 1 }, {}, {}, {}, { fieldModelIDs + 1756, 7 }, 0x0, {}, {} },
+    { 0x014D, "elmin1_1", { fieldScriptItems + 147, 1 }, {}, { fieldScriptMessages + 113, 1 }, {}, {}, {}, { fieldModelIDs + 1763, 5 }, 0x0, {}, {} },
+    { 0x014E, "elmin1_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1768, 4 }, 0x0, {}, {} },
+    { 0x014F, "elm", {}, {}, {}, {}, {}, { fieldWorldExits + 14, 2 }, { fieldModelIDs + 1772, 13 }, 0x0, {}, {} },
+    { 0x0150, "elmin2_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1785, 5 }, 0x0, {}, {} },
+    { 0x0151, "elmin2_2", { fieldScriptItems + 148, 3 }, {}, { fieldScriptMessages + 114, 3 }, {}, {}, {}, { fieldModelIDs + 1790, 4 }, 0x0, {}, {} },
+    { 0x0152, "elmin3_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1794, 4 }, 0x0, {}, {} },
+    { 0x0153, "elmin3_2", { fieldScriptItems + 151, 3 }, {}, { fieldScriptMessages + 117, 3 }, {}, {}, {}, { fieldModelIDs + 1798, 6 }, 0x0, {}, {} },
+    { 0x0154, "elmtow", { fieldScriptItems + 154, 1 }, {}, { fieldScriptMessages + 120, 1 }, {}, {}, {}, { fieldModelIDs + 1804, 4 }, 0x0, {}, {} },
+    { 0x0155, "elmin4_1", { fieldScriptItems + 155, 1 }, {}, { fieldScriptMessages + 121, 1 }, {}, {}, {}, { fieldModelIDs + 1808, 5 }, 0x0, {}, {} },
+    { 0x0156, "elmin4_2", {}, { fieldScriptMateria + 88, 4 }, { fieldScriptMessages + 122, 10 }, {}, {}, {}, { fieldModelIDs + 1813, 9 }, 0x0, {}, {} },
+    { 0x0157, "farm", {}, { fieldScriptMateria + 92, 2 }, { fieldScriptMessages + 132, 2 }, {}, {}, { fieldWorldExits + 16, 7 }, { fieldModelIDs + 1822, 9 }, 0x0, {}, {} },
+    { 0x0158, "frmin", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1831, 4 }, 0x0, {}, {} },
+    { 0x0159, "frcyo", {}, { fieldScriptMateria + 94, 2 }, { fieldScriptMessages + 134, 3 }, { fieldScriptShops + 34, 4 }, {}, {}, { fieldModelIDs + 1835, 12 }, 0x0, {}, {} },
+    { 0x015B, "fr_e", {}, {}, {}, {}, { fieldScriptBattles + 56, 1 }, {}, { fieldModelIDs + 1847, 8 }, 0x0, {}, {} },
+    { 0x015C, "sichi", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1855, 6 }, 0x0, {}, {} },
+    { 0x015D, "psdun_1", {}, {}, {}, {}, {}, { fieldWorldExits + 23, 1 }, { fieldModelIDs + 1861, 9 }, 0x6BE0, {25048, 23001, 18906, 0, 0, 0, 4571, 4571, 0, 0}, {} },
+    { 0x015E, "psdun_2", { fieldScriptItems + 156, 1 }, {}, { fieldScriptMessages + 137, 1 }, {}, {}, { fieldWorldExits + 24, 1 }, { fieldModelIDs + 1870, 7 }, 0x74A8, {25048, 23001, 18906, 0, 0, 0, 4571, 4571, 0, 0}, {} },
+    { 0x015F, "psdun_3", { fieldScriptItems + 157, 2 }, { fieldScriptMateria + 96, 1 }, { fieldScriptMessages + 138, 3 }, {}, {}, {}, { fieldModelIDs + 1877, 6 }, 0x87D8, {25052, 23005, 18910, 0, 0, 0, 0, 0, 8663, 0}, {} },
+    { 0x0160, "psdun_4", { fieldScriptItems + 159, 2 }, {}, { fieldScriptMessages + 141, 2 }, {}, {}, {}, { fieldModelIDs + 1883, 5 }, 0x83D0, {18908, 17885, 15838, 14815, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0161, "condor1", {}, {}, {}, {}, {}, { fieldWorldExits + 25, 1 }, { fieldModelIDs + 1888, 10 }, 0x0, {}, {} },
+    { 0x0162, "condor2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1898, 9 }, 0x0, {}, {} },
+    { 0x0163, "convil_1", {}, {}, {}, { fieldScriptShops + 38, 4 }, {}, {}, { fieldModelIDs + 1907, 13 }, 0x0, {}, {} },
+    { 0x0164, "convil_2", { fieldScriptItems + 161, 9 }, {}, { fieldScriptMessages + 143, 7 }, {}, { fieldScriptBattles + 57, 23 }, {}, { fieldModelIDs + 1920, 10 }, 0x0, {}, {} },
+    { 0x0166, "convil_4", {}, { fieldScriptMateria + 97, 1 }, { fieldScriptMessages + 150, 1 }, {}, {}, {}, { fieldModelIDs + 1930, 11 }, 0x0, {}, {} },
+    { 0x0167, "junon", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1941, 4 }, 0x0, {}, {} },
+    { 0x0168, "junonr1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1945, 14 }, 0x0, {}, {} },
+    { 0x0169, "junonr2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1959, 14 }, 0x0, {}, {} },
+    { 0x016A, "junonr3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 1973, 3 }, 0x0, {}, {} },
+    { 0x016B, "junonr4", { fieldScriptItems + 170, 3 }, {}, { fieldScriptMessages + 151, 3 }, {}, {}, {}, { fieldModelIDs + 1976, 16 }, 0x0, {}, {} },
+    { 0x016C, "jun_wa", {}, {}, {}, { fieldScriptShops + 42, 2 }, {}, {}, { fieldModelIDs + 1992, 5 }, 0x0, {}, {} },
+    { 0x016D, "jun_i1", {}, {}, {}, { fieldScriptShops + 44, 2 }, {}, {}, { fieldModelIDs + 1997, 5 }, 0x0, {}, {} },
+    { 0x016E, "jun_m", {}, {}, {}, { fieldScriptShops + 46, 2 }, {}, {}, { fieldModelIDs + 2002, 5 }, 0x0, {}, {} },
+    { 0x016F, "junmin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2007, 9 }, 0x0, {}, {} },
+    { 0x0170, "junmin2", { fieldScriptItems + 173, 3 }, {}, { fieldScriptMessages + 154, 3 }, {}, {}, {}, { fieldModelIDs + 2016, 12 }, 0x0, {}, {} },
+    { 0x0171, "junmin3", { fieldScriptItems + 176, 2 }, {}, { fieldScriptMessages + 157, 2 }, {}, {}, {}, { fieldModelIDs + 2028, 10 }, 0x0, {}, {} },
+    { 0x0172, "junonl1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2038, 15 }, 0x0, {}, {} },
+    { 0x0173, "junonl2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2053, 6 }, 0x0, {}, {} },
+    { 0x0174, "junonl3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2059, 3 }, 0x0, {}, {} },
+    { 0x0175, "jun_w", {}, {}, {}, { fieldScriptShops + 48, 4 }, {}, {}, { fieldModelIDs + 2062, 5 }, 0x0, {}, {} },
+    { 0x0176, "jun_a", {}, {}, {}, { fieldScriptShops + 52, 2 }, {}, {}, { fieldModelIDs + 2067, 6 }, 0x0, {}, {} },
+    { 0x0177, "jun_i2", {}, {}, {}, { fieldScriptShops + 54, 2 }, {}, {}, { fieldModelIDs + 2073, 10 }, 0x0, {}, {} },
+    { 0x0178, "juninn", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2083, 7 }, 0x0, {}, {} },
+    { 0x0179, "junpb_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2090, 12 }, 0x0, {}, {} },
+    { 0x017A, "junpb_2", { fieldScriptItems + 178, 1 }, { fieldScriptMateria + 98, 5 }, { fieldScriptMessages + 159, 1 }, {}, {}, {}, { fieldModelIDs + 2102, 13 }, 0x0, {}, {} },
+    { 0x017B, "junpb_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2115, 10 }, 0x0, {}, {} },
+    { 0x017C, "junmin4", { fieldScriptItems + 179, 1 }, {}, { fieldScriptMessages + 160, 1 }, {}, {}, {}, { fieldModelIDs + 2125, 7 }, 0x0, {}, {} },
+    { 0x017D, "junmin5", { fieldScriptItems + 180, 1 }, {}, { fieldScriptMessages + 161, 1 }, {}, {}, {}, { fieldModelIDs + 2132, 6 }, 0x0, {}, {} },
+    { 0x017E, "jundoc1a", { fieldScriptItems + 181, 2 }, { fieldScriptMateria + 103, 1 }, { fieldScriptMessages + 162, 3 }, {}, {}, {}, { fieldModelIDs + 2138, 13 }, 0x0, {}, {} },
+    { 0x017F, "jundoc1b", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2151, 4 }, 0x0, {}, {} },
+    { 0x0180, "junair", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2155, 12 }, 0xD7D4, {25320, 23273, 19178, 0, 0, 0, 0, 0, 0, 8939}, {25516, 23469, 19374, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x0181, "junair2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2167, 10 }, 0x0, {}, {} },
+    { 0x0182, "junin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2177, 10 }, 0x0, {}, {} },
+    { 0x0183, "junin1a", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2187, 8 }, 0x0, {}, {} },
+    { 0x0184, "junele1", {}, {}, {}, {}, { fieldScriptBattles + 80, 1 }, {}, { fieldModelIDs + 2195, 6 }, 0x0, {}, {} },
+    { 0x0185, "junin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2201, 11 }, 0x8DA8, {25324, 23277, 19182, 0, 0, 0, 4847, 4847, 8944, 0}, {35760, 31665, 0, 0, 0, 0, 0, 0, 0, 946} },
+    { 0x0186, "junin3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2212, 15 }, 0x5674, {25324, 23277, 19182, 0, 0, 0, 4847, 4847, 8944, 0}, {} },
+    { 0x0187, "junele2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2227, 4 }, 0x0, {}, {} },
+    { 0x0188, "junin4", {}, {}, {}, {}, { fieldScriptBattles + 81, 2 }, {}, { fieldModelIDs + 2231, 13 }, 0x6418, {25324, 23277, 19182, 0, 0, 0, 4847, 4847, 8944, 0}, {} },
+    { 0x0189, "junin5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2244, 3 }, 0x3D10, {19185, 18164, 16114, 15093, 0, 0, 2803, 2799, 0, 4856}, {} },
+    { 0x018A, "junin6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2247, 4 }, 0x396C, {19185, 18164, 16114, 15093, 0, 0, 2803, 2799, 0, 4856}, {} },
+    { 0x018B, "junin7", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2251, 4 }, 0x0, {}, {} },
+    { 0x018C, "junbin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2255, 5 }, 0x0, {}, {} },
+    { 0x018D, "junbin12", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2260, 6 }, 0x0, {}, {} },
+    { 0x018E, "junbin21", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2266, 9 }, 0x0, {}, {} },
+    { 0x018F, "junbin22", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2275, 9 }, 0x0, {}, {} },
+    { 0x0190, "junbin3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2284, 6 }, 0x0, {}, {} },
+    { 0x0191, "junbin4", {}, {}, {}, {}, { fieldScriptBattles + 83, 1 }, {}, { fieldModelIDs + 2290, 15 }, 0x0, {}, {} },
+    { 0x0192, "junbin5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2305, 7 }, 0x0, {}, {} },
+    { 0x0194, "junsbd1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2312, 9 }, 0x7554, {35577, 31482, 0, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0195, "subin_1a", {}, {}, {}, {}, { fieldScriptBattles + 84, 1 }, {}, { fieldModelIDs + 2321, 14 }, 0x0, {}, {} },
+    { 0x0196, "subin_1b", {}, {}, {}, {}, { fieldScriptBattles + 85, 1 }, {}, { fieldModelIDs + 2335, 11 }, 0x0, {}, {} },
+    { 0x0197, "subin_2a", {}, {}, {}, {}, { fieldScriptBattles + 86, 1 }, {}, { fieldModelIDs + 2346, 11 }, 0x0, {}, {} },
+    { 0x0198, "subin_2b", {}, {}, {}, {}, { fieldScriptBattles + 87, 1 }, {}, { fieldModelIDs + 2357, 12 }, 0x0, {}, {} },
+    { 0x0199, "subin_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2369, 8 }, 0x0, {}, {} },
+    { 0x019B, "junone2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2377, 11 }, 0x5888, {25320, 23273, 19178, 0, 0, 0, 0, 0, 0, 8939}, {25516, 23469, 19374, 0, 0, 0, 0, 0, 0, 0} },
+    { 0x019C, "junone3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2388, 6 }, 0x0, {}, {} },
+    { 0x019D, "junone4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2394, 3 }, 0x0, {}, {} },
+    { 0x019E, "junone5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2397, 7 }, 0x0, {}, {} },
+    { 0x019F, "junone6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2404, 3 }, 0x0, {}, {} },
+    { 0x01A0, "junone7", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2407, 5 }, 0x0, {}, {} },
+    { 0x01A1, "spgate", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2412, 1 }, 0x0, {}, {} },
+    { 0x01A2, "spipe_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2413, 6 }, 0xA31C, {25340, 23293, 19198, 0, 0, 0, 0, 0, 0, 8959}, {} },
+    { 0x01A3, "spipe_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2419, 7 }, 0x9FEC, {25340, 23293, 19198, 0, 0, 0, 0, 0, 0, 8959}, {} },
+    { 0x01A4, "semkin_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2426, 2 }, 0x0, {}, {} },
+    { 0x01A5, "semkin_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2428, 2 }, 0x9818, {19204, 18181, 16134, 15112, 0, 0, 4871, 4871, 0, 0}, {} },
+    { 0x01A6, "semkin_8", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2430, 2 }, 0x9A84, {19204, 18181, 16134, 15112, 0, 0, 4871, 4871, 0, 0}, {} },
+    { 0x01A7, "semkin_3", {}, {}, {}, {}, { fieldScriptBattles + 88, 4 }, {}, { fieldModelIDs + 2432, 6 }, 0x0, {}, {} },
+    { 0x01A8, "semkin_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2438, 10 }, 0xAC38, {19208, 18185, 16132, 15109, 0, 0, 4874, 4871, 0, 0}, {} },
+    { 0x01A9, "semkin_5", {}, {}, {}, {}, { fieldScriptBattles + 92, 1 }, {}, { fieldModelIDs + 2448, 13 }, 0x0, {}, {} },
+    { 0x01AA, "semkin_6", { fieldScriptItems + 183, 1 }, {}, { fieldScriptMessages + 165, 1 }, {}, {}, {}, { fieldModelIDs + 2461, 13 }, 0x0, {}, {} },
+    { 0x01AB, "semkin_7", { fieldScriptItems + 184, 1 }, {}, { fieldScriptMessages + 166, 1 }, {}, { fieldScriptBattles + 93, 2 }, {}, { fieldModelIDs + 2474, 7 }, 0x0, {}, {} },
+    { 0x01AC, "ujunon1", {}, { fieldScriptMateria + 104, 2 }, { fieldScriptMessages + 167, 2 }, {}, {}, { fieldWorldExits + 26, 1 }, { fieldModelIDs + 2481, 15 }, 0x0, {}, {} },
+    { 0x01AD, "ujunon2", {}, {}, {}, {}, { fieldScriptBattles + 95, 1 }, {}, { fieldModelIDs + 2496, 10 }, 0x0, {}, {} },
+    { 0x01AE, "ujunon3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2506, 3 }, 0x0, {}, {} },
+    { 0x01AF, "prisila", {}, { fieldScriptMateria + 106, 1 }, { fieldScriptMessages + 169, 1 }, {}, {}, {}, { fieldModelIDs + 2509, 5 }, 0x0, {}, {} },
+    { 0x01B0, "ujun_w", {}, {}, {}, { fieldScriptShops + 56, 1 }, {}, {}, { fieldModelIDs + 2514, 4 }, 0x0, {}, {} },
+    { 0x01B1, "jumin", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2518, 8 }, 0x0, {}, {} },
+    { 0x01B2, "ujunon4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2526, 10 }, 0x0, {}, {} },
+    { 0x01B3, "ujunon5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2536, 12 }, 0x0, {}, {} },
+    { 0x01B4, "ship_1", {}, {}, {}, { fieldScriptShops + 57, 1 }, {}, {}, { fieldModelIDs + 2548, 14 }, 0x0, {}, {} },
+    { 0x01B5, "ship_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2562, 5 }, 0x0, {}, {} },
+    { 0x01B6, "shpin_22", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2567, 9 }, 0x0, {}, {} },
+    { 0x01B7, "shpin_2", { fieldScriptItems + 185, 1 }, { fieldScriptMateria + 107, 1 }, { fieldScriptMessages + 170, 2 }, {}, {}, {}, { fieldModelIDs + 2576, 14 }, 0x6A54, {25060, 23013, 18918, 0, 0, 0, 4583, 4583, 0, 0}, {} },
+    { 0x01B8, "shpin_3", { fieldScriptItems + 186, 1 }, { fieldScriptMateria + 108, 1 }, { fieldScriptMessages + 172, 2 }, {}, { fieldScriptBattles + 96, 1 }, {}, { fieldModelIDs + 2590, 14 }, 0x8660, {25060, 23013, 18918, 0, 0, 0, 4583, 4583, 0, 0}, {} },
+    { 0x01B9, "del1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2604, 13 }, 0x0, {}, {} },
+    { 0x01BA, "del12", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2617, 9 }, 0x0, {}, {} },
+    { 0x01BB, "del2", {}, {}, {}, { fieldScriptShops + 58, 7 }, {}, { fieldWorldExits + 27, 1 }, { fieldModelIDs + 2626, 14 }, 0x0, {}, {} },
+    { 0x01BC, "delinn", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2640, 8 }, 0x0, {}, {} },
+    { 0x01BD, "delpb", {}, {}, {}, { fieldScriptShops + 65, 2 }, {}, {}, { fieldModelIDs + 2648, 12 }, 0x0, {}, {} },
+    { 0x01BE, "delmin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2660, 4 }, 0x0, {}, {} },
+    { 0x01BF, "delmin12", { fieldScriptItems + 187, 3 }, {}, { fieldScriptMessages + 174, 3 }, {}, {}, {}, { fieldModelIDs + 2664, 7 }, 0x0, {}, {} },
+    { 0x01C0, "delmin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2671, 5 }, 0x0, {}, {} },
+    { 0x01C1, "del3", {}, {}, { fieldScriptMessages + 177, 1 }, {}, {}, {}, { fieldModelIDs + 2676, 13 }, 0x0, {}, {} },
+    { 0x01C2, "ncorel", {}, {}, {}, { fieldScriptShops + 67, 3 }, {}, { fieldWorldExits + 28, 1 }, { fieldModelIDs + 2689, 15 }, 0x0, {}, {} },
+    { 0x01C3, "ncorel2", {}, { fieldScriptMateria + 109, 1 }, { fieldScriptMessages + 178, 1 }, { fieldScriptShops + 70, 1 }, {}, { fieldWorldExits + 29, 1 }, { fieldModelIDs + 2704, 15 }, 0x0, {}, {} },
+    { 0x01C4, "ncorel3", {}, { fieldScriptMateria + 110, 1 }, { fieldScriptMessages + 179, 1 }, {}, {}, { fieldWorldExits + 30, 1 }, { fieldModelIDs + 2719, 15 }, 0x0, {}, {} },
+    { 0x01C5, "ncoin1", { fieldScriptItems + 190, 1 }, {}, { fieldScriptMessages + 180, 1 }, {}, {}, {}, { fieldModelIDs + 2734, 5 }, 0x0, {}, {} },
+    { 0x01C6, "ncoin2", {}, { fieldScriptMateria + 111, 1 }, { fieldScriptMessages + 181, 1 }, {}, {}, {}, { fieldModelIDs + 2739, 6 }, 0x0, {}, {} },
+    { 0x01C7, "ncoin3", { fieldScriptItems + 191, 1 }, {}, { fieldScriptMessages + 182, 1 }, {}, {}, {}, { fieldModelIDs + 2745, 9 }, 0x0, {}, {} },
+    { 0x01C8, "ncoinn", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2754, 10 }, 0x0, {}, {} },
+    { 0x01C9, "ropest", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2764, 10 }, 0x0, {}, {} },
+    { 0x01CA, "mtcrl_0", {}, {}, {}, {}, {}, { fieldWorldExits + 31, 1 }, { fieldModelIDs + 2774, 8 }, 0x7300, {25068, 23021, 18926, 0, 0, 0, 4591, 4591, 0, 0}, {} },
+    { 0x01CB, "mtcrl_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2782, 3 }, 0x6E34, {25068, 23021, 18926, 0, 0, 0, 4591, 4591, 0, 0}, {} },
+    { 0x01CC, "mtcrl_2", {}, {}, {}, {}, { fieldScriptBattles + 97, 1 }, {}, { fieldModelIDs + 2785, 12 }, 0xB46C, {18928, 17905, 15858, 14835, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x01CD, "mtcrl_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2797, 14 }, 0x70D4, {18932, 17909, 15862, 14839, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x01CE, "mtcrl_4", { fieldScriptItems + 192, 2 }, { fieldScriptMateria + 112, 1 }, { fieldScriptMessages + 183, 3 }, {}, {}, {}, { fieldModelIDs + 2811, 7 }, 0x8600, {35320, 31225, 0, 0, 0, 0, 2554, 2554, 0, 4603}, {} },
+    { 0x01CF, "mtcrl_5", { fieldScriptItems + 194, 2 }, {}, { fieldScriptMessages + 186, 2 }, {}, {}, {}, { fieldModelIDs + 2818, 3 }, 0x0, {}, {} },
+    { 0x01D0, "mtcrl_6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2821, 7 }, 0x97AC, {25084, 23037, 18942, 0, 0, 0, 0, 0, 8703, 0}, {} },
+    { 0x01D1, "mtcrl_7", { fieldScriptItems + 196, 3 }, {}, { fieldScriptMessages + 188, 3 }, {}, {}, {}, { fieldModelIDs + 2828, 7 }, 0x0, {}, {} },
+    { 0x01D2, "mtcrl_8", { fieldScriptItems + 199, 1 }, {}, { fieldScriptMessages + 191, 1 }, {}, { fieldScriptBattles + 98, 1 }, {}, { fieldModelIDs + 2835, 7 }, 0x0, {}, {} },
+    { 0x01D3, "mtcrl_9", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2842, 7 }, 0x5F50, {35329, 31234, 0, 0, 0, 0, 0, 0, 0, 12803}, {} },
+    { 0x01D4, "corel1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2849, 2 }, 0x0, {}, {} },
+    { 0x01D5, "corel2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2851, 11 }, 0x0, {}, {} },
+    { 0x01D6, "corel3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2862, 15 }, 0x0, {}, {} },
+    { 0x01D7, "jail1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2877, 10 }, 0xB1F4, {25092, 23045, 18950, 0, 0, 0, 0, 0, 0, 8711}, {} },
+    { 0x01D8, "jailin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2887, 4 }, 0x3F80, {35336, 31240, 0, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x01D9, "jail2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2891, 15 }, 0xAB28, {25092, 23045, 18950, 0, 0, 0, 0, 0, 0, 8711}, {} },
+    { 0x01DA, "jailpb", {}, {}, {}, { fieldScriptShops + 71, 1 }, {}, {}, { fieldModelIDs + 2906, 5 }, 0x0, {}, {} },
+    { 0x01DB, "jailin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2911, 9 }, 0x0, {}, {} },
+    { 0x01DC, "jailin3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2920, 3 }, 0x0, {}, {} },
+    { 0x01DD, "jailin4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2923, 10 }, 0x0, {}, {} },
+    { 0x01DE, "jail3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2933, 5 }, 0x8160, {18953, 17930, 15883, 14852, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x01DF, "jail4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2938, 3 }, 0x76F4, {18953, 17930, 15883, 14853, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x01E0, "dyne", {}, {}, {}, {}, { fieldScriptBattles + 99, 1 }, {}, { fieldModelIDs + 2941, 9 }, 0x0, {}, {} },
+    { 0x01E1, "desert1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2950, 4 }, 0x9114, {23052, 22028, 17932, 4352, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x01E2, "desert2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2954, 3 }, 0x0, {}, {} },
+    { 0x01E3, "corelin", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2957, 12 }, 0x0, {}, {} },
+    { 0x01E4, "astage_a", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2969, 16 }, 0x0, {}, {} },
+    { 0x01E5, "astage_b", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2985, 9 }, 0x0, {}, {} },
+    { 0x01E6, "jet", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 2994, 13 }, 0x0, {}, {} },
+    { 0x01E7, "jetin1", { fieldScriptItems + 200, 5 }, {}, { fieldScriptMessages + 192, 5 }, {}, {}, {}, { fieldModelIDs + 3007, 13 }, 0x0, {}, {} },
+    { 0x01E8, "bigwheel", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3020, 11 }, 0x0, {}, {} },
+    { 0x01E9, "bwhlin", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3031, 9 }, 0x0, {}, {} },
+    { 0x01EA, "bwhlin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3040, 9 }, 0x0, {}, {} },
+    { 0x01EB, "ghotel", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3049, 8 }, 0x0, {}, {} },
+    { 0x01EC, "ghotin_1", {}, {}, { fieldScriptMessages + 197, 1 }, {}, {}, {}, { fieldModelIDs + 3057, 9 }, 0x0, {}, {} },
+    { 0x01ED, "ghotin_4", {}, {}, { fieldScriptMessages + 198, 1 }, {}, {}, {}, { fieldModelIDs + 3066, 9 }, 0x0, {}, {} },
+    { 0x01EE, "ghotin_2", { fieldScriptItems + 205, 1 }, {}, { fieldScriptMessages + 199, 1 }, {}, {}, {}, { fieldModelIDs + 3075, 8 }, 0x0, {}, {} },
+    { 0x01EF, "ghotin_3", {}, {}, {}, { fieldScriptShops + 72, 1 }, {}, {}, { fieldModelIDs + 3083, 4 }, 0x0, {}, {} },
+    { 0x01F0, "gldst", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3087, 15 }, 0x0, {}, {} },
+    { 0x01F1, "gldgate", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3102, 10 }, 0x0, {}, {} },
+    { 0x01F2, "gldinfo", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3112, 2 }, 0x0, {}, {} },
+    { 0x01F3, "coloss", { fieldScriptItems + 206, 1 }, {}, { fieldScriptMessages + 200, 1 }, {}, {}, {}, { fieldModelIDs + 3114, 16 }, 0x0, {}, {} },
+    { 0x01F4, "coloin1", { fieldScriptItems + 207, 29 }, { fieldScriptMateria + 113, 11 }, { fieldScriptMessages + 201, 29 }, {}, {}, {}, { fieldModelIDs + 3130, 15 }, 0x0, {}, {} },
+    { 0x01F5, "coloin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3145, 15 }, 0x0, {}, {} },
+    { 0x01F6, "clsin2_1", {}, {}, {}, {}, { fieldScriptBattles + 100, 33 }, {}, { fieldModelIDs + 3160, 16 }, 0x0, {}, {} },
+    { 0x01F7, "clsin2_2", { fieldScriptItems + 236, 3 }, {}, { fieldScriptMessages + 230, 3 }, {}, {}, {}, { fieldModelIDs + 3176, 5 }, 0x0, {}, {} },
+    { 0x01F8, "clsin2_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3181, 9 }, 0x0, {}, {} },
+    { 0x01F9, "games", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3190, 15 }, 0x0, {}, {} },
+    { 0x01FA, "games_1", { fieldScriptItems + 239, 31 }, { fieldScriptMateria + 124, 4 }, { fieldScriptMessages + 233, 35 }, {}, {}, {}, { fieldModelIDs + 3205, 10 }, 0x0, {}, {} },
+    { 0x01FB, "games_2", { fieldScriptItems + 270, 8 }, { fieldScriptMateria + 128, 1 }, { fieldScriptMessages + 268, 8 }, {}, {}, {}, { fieldModelIDs + 3215, 13 }, 0x0, {}, {} },
+    { 0x01FC, "mogu_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3228, 16 }, 0x0, {}, {} },
+    { 0x01FD, "chorace", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3244, 13 }, 0x0, {}, {} },
+    { 0x01FE, "chorace2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3257, 11 }, 0x0, {}, {} },
+    { 0x01FF, "crcin_1", { fieldScriptItems + 278, 24 }, { fieldScriptMateria + 129, 5 }, { fieldScriptMessages + 276, 29 }, {}, {}, {}, { fieldModelIDs + 3268, 14 }, 0x0, {}, {} },
+    { 0x0200, "crcin_2", {}, { fieldScriptMateria + 134, 1 }, { fieldScriptMessages + 305, 1 }, {}, {}, {}, { fieldModelIDs + 3282, 10 }, 0x0, {}, {} },
+    { 0x0201, "gldelev", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3292, 3 }, 0x0, {}, {} },
+    { 0x0202, "gonjun1", {}, { fieldScriptMateria + 135, 1 }, { fieldScriptMessages + 306, 1 }, {}, {}, { fieldWorldExits + 32, 1 }, { fieldModelIDs + 3295, 5 }, 0xA784, {25104, 23057, 18962, 0, 0, 0, 0, 0, 0, 8723}, {} },
+    { 0x0203, "gonjun2", {}, {}, {}, {}, { fieldScriptBattles + 133, 1 }, { fieldWorldExits + 33, 1 }, { fieldModelIDs + 3300, 12 }, 0xB934, {18964, 17937, 15890, 14864, 0, 0, 0, 0, 8725, 0}, {} },
+    { 0x0204, "gnmkf", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3312, 3 }, 0x9870, {35352, 31256, 0, 0, 0, 0, 4633, 4633, 0, 0}, {} },
+    { 0x0205, "gnmk", {}, { fieldScriptMateria + 136, 1 }, { fieldScriptMessages + 307, 1 }, {}, {}, {}, { fieldModelIDs + 3315, 7 }, 0x8210, {35352, 31256, 0, 0, 0, 0, 4633, 4633, 0, 0}, {} },
+    { 0x0206, "gongaga", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3322, 8 }, 0x0, {}, {} },
+    { 0x0207, "gon_wa1", {}, {}, {}, { fieldScriptShops + 73, 1 }, {}, {}, { fieldModelIDs + 3330, 4 }, 0x0, {}, {} },
+    { 0x0208, "gon_wa2", {}, {}, {}, { fieldScriptShops + 74, 1 }, {}, {}, { fieldModelIDs + 3334, 4 }, 0x0, {}, {} },
+    { 0x0209, "gon_i", {}, {}, {}, { fieldScriptShops + 75, 1 }, {}, {}, { fieldModelIDs + 3338, 4 }, 0x0, {}, {} },
+    { 0x020A, "gninn", { fieldScriptItems + 302, 1 }, {}, { fieldScriptMessages + 308, 1 }, {}, {}, {}, { fieldModelIDs + 3342, 6 }, 0x0, {}, {} },
+    { 0x020B, "gomin", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3348, 11 }, 0x0, {}, {} },
+    { 0x020C, "goson", { fieldScriptItems + 303, 1 }, {}, { fieldScriptMessages + 309, 1 }, {}, {}, {}, { fieldModelIDs + 3359, 5 }, 0x0, {}, {} },
+    { 0x020D, "cos_btm", {}, {}, {}, {}, {}, { fieldWorldExits + 34, 1 }, { fieldModelIDs + 3364, 16 }, 0x0, {}, {} },
+    { 0x020E, "cos_btm2", {}, {}, { fieldScriptMessages + 310, 1 }, {}, {}, {}, { fieldModelIDs + 3380, 10 }, 0x0, {}, {} },
+    { 0x020F, "cosmo", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3390, 12 }, 0x0, {}, {} },
+    { 0x0210, "cosmo2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3402, 12 }, 0x0, {}, {} },
+    { 0x0211, "cosin1", {}, {}, { fieldScriptMessages + 311, 1 }, { fieldScriptShops + 76, 2 }, {}, {}, { fieldModelIDs + 3414, 5 }, 0x0, {}, {} },
+    { 0x0212, "cosin1_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3419, 5 }, 0x0, {}, {} },
+    { 0x0213, "cosin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3424, 12 }, 0x0, {}, {} },
+    { 0x0214, "cosin3", {}, {}, { fieldScriptMessages + 312, 1 }, {}, {}, {}, { fieldModelIDs + 3436, 8 }, 0x0, {}, {} },
+    { 0x0215, "cosin4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3444, 3 }, 0x0, {}, {} },
+    { 0x0216, "cosin5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3447, 4 }, 0x0, {}, {} },
+    { 0x0217, "cosmin2", {}, {}, {}, { fieldScriptShops + 78, 12 }, {}, {}, { fieldModelIDs + 3451, 5 }, 0x0, {}, {} },
+    { 0x0218, "cosmin3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3456, 6 }, 0x0, {}, {} },
+    { 0x0219, "cosmin4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3462, 10 }, 0x0, {}, {} },
+    { 0x021A, "cosmin6", { fieldScriptItems + 304, 1 }, {}, { fieldScriptMessages + 313, 1 }, {}, {}, {}, { fieldModelIDs + 3472, 10 }, 0x0, {}, {} },
+    { 0x021B, "cosmin7", { fieldScriptItems + 305, 2 }, { fieldScriptMateria + 137, 1 }, { fieldScriptMessages + 314, 3 }, { fieldScriptShops + 90, 4 }, {}, {}, { fieldModelIDs + 3482, 6 }, 0x0, {}, {} },
+    { 0x021C, "cos_top", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3488, 5 }, 0x0, {}, {} },
+    { 0x021D, "bugin1a", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3493, 9 }, 0x0, {}, {} },
+    { 0x021E, "bugin1b", {}, {}, { fieldScriptMessages + 317, 8 }, {}, {}, {}, { fieldModelIDs + 3502, 13 }, 0x0, {}, {} },
+    { 0x021F, "bugin1c", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3515, 11 }, 0x0, {}, {} },
+    { 0x0220, "bugin2", { fieldScriptItems + 307, 2 }, {}, { fieldScriptMessages + 325, 1 }, {}, {}, {}, { fieldModelIDs + 3526, 12 }, 0x0, {}, {} },
+    { 0x0221, "bugin3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3538, 2 }, 0x0, {}, {} },
+    { 0x0222, "gidun_1", {}, { fieldScriptMateria + 138, 1 }, { fieldScriptMessages + 326, 1 }, {}, { fieldScriptBattles + 134, 3 }, {}, { fieldModelIDs + 3540, 11 }, 0x9684, {25116, 23069, 18974, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0223, "gidun_2", { fieldScriptItems + 309, 2 }, {}, { fieldScriptMessages + 327, 2 }, {}, {}, {}, { fieldModelIDs + 3551, 12 }, 0x9D34, {25119, 23072, 18977, 0, 0, 0, 4642, 4642, 0, 0}, {} },
+    { 0x0224, "gidun_4", { fieldScriptItems + 311, 3 }, {}, { fieldScriptMessages + 329, 3 }, {}, { fieldScriptBattles + 137, 3 }, {}, { fieldModelIDs + 3563, 13 }, 0x8FA8, {18980, 17955, 15902, 14881, 0, 0, 2594, 2594, 8741, 4648}, {} },
+    { 0x0225, "gidun_3", {}, { fieldScriptMateria + 139, 1 }, { fieldScriptMessages + 332, 1 }, {}, { fieldScriptBattles + 140, 1 }, {}, { fieldModelIDs + 3576, 11 }, 0x0, {}, {} },
+    { 0x0226, "seto1", { fieldScriptItems + 314, 1 }, {}, {}, {}, {}, {}, { fieldModelIDs + 3587, 11 }, 0x0, {}, {} },
+    { 0x0227, "rckt2", { fieldScriptItems + 315, 1 }, {}, { fieldScriptMessages + 333, 1 }, {}, {}, { fieldWorldExits + 35, 1 }, { fieldModelIDs + 3598, 6 }, 0x0, {}, {} },
+    { 0x0228, "rckt3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3604, 9 }, 0x0, {}, {} },
+    { 0x0229, "rkt_w", { fieldScriptItems + 316, 1 }, {}, { fieldScriptMessages + 334, 1 }, { fieldScriptShops + 94, 2 }, {}, {}, { fieldModelIDs + 3613, 5 }, 0x0, {}, {} },
+    { 0x022A, "rkt_i", { fieldScriptItems + 317, 1 }, {}, { fieldScriptMessages + 335, 1 }, { fieldScriptShops + 96, 2 }, {}, {}, { fieldModelIDs + 3618, 6 }, 0x0, {}, {} },
+    { 0x022B, "rktinn1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3624, 8 }, 0x0, {}, {} },
+    { 0x022C, "rktinn2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3632, 3 }, 0x0, {}, {} },
+    { 0x022D, "rckt", { fieldScriptItems + 318, 2 }, {}, { fieldScriptMessages + 336, 2 }, {}, {}, { fieldWorldExits + 36, 1 }, { fieldModelIDs + 3635, 9 }, 0x0, {}, {} },
+    { 0x022E, "rktsid", { fieldScriptItems + 320, 1 }, {}, { fieldScriptMessages + 338, 1 }, {}, {}, {}, { fieldModelIDs + 3644, 12 }, 0x0, {}, {} },
+    { 0x022F, "rktmin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3656, 5 }, 0x0, {}, {} },
+    { 0x0230, "rktmin2", { fieldScriptItems + 321, 1 }, {}, { fieldScriptMessages + 339, 1 }, {}, {}, {}, { fieldModelIDs + 3661, 10 }, 0x0, {}, {} },
+    { 0x0231, "rcktbas1", {}, {}, {}, {}, { fieldScriptBattles + 141, 3 }, {}, { fieldModelIDs + 3671, 12 }, 0x0, {}, {} },
+    { 0x0232, "rcktbas2", {}, {}, {}, {}, { fieldScriptBattles + 144, 1 }, {}, { fieldModelIDs + 3683, 6 }, 0x0, {}, {} },
+    { 0x0233, "rcktin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3689, 1 }, 0x0, {}, {} },
+    { 0x0234, "rcktin2", {}, {}, {}, {}, { fieldScriptBattles + 145, 1 }, {}, { fieldModelIDs + 3690, 9 }, 0x0, {}, {} },
+    { 0x0235, "rcktin3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3699, 2 }, 0x0, {}, {} },
+    { 0x0236, "rcktin4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3701, 3 }, 0x0, {}, {} },
+    { 0x0237, "rcktin5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3704, 12 }, 0x0, {}, {} },
+    { 0x0238, "rcktin6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3716, 11 }, 0x0, {}, {} },
+    { 0x0239, "rcktin7", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3727, 9 }, 0x0, {}, {} },
+    { 0x023A, "rcktin8", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3736, 1 }, 0x0, {}, {} },
+    { 0x023C, "yougan", {}, {}, {}, {}, { fieldScriptBattles + 146, 2 }, {}, { fieldModelIDs + 3737, 11 }, 0x0, {}, {} },
+    { 0x023D, "yougan2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3748, 10 }, 0x0, {}, {} },
+    { 0x023E, "yougan3", {}, {}, {}, {}, { fieldScriptBattles + 148, 2 }, {}, { fieldModelIDs + 3758, 11 }, 0x0, {}, {} },
+    { 0x023F, "uta_wa", {}, {}, {}, { fieldScriptShops + 98, 1 }, {}, {}, { fieldModelIDs + 3769, 6 }, 0x0, {}, {} },
+    { 0x0240, "uta_im", {}, {}, { fieldScriptMessages + 340, 2 }, { fieldScriptShops + 99, 1 }, {}, {}, { fieldModelIDs + 3775, 7 }, 0x0, {}, {} },
+    { 0x0241, "utmin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3782, 14 }, 0x0, {}, {} },
+    { 0x0242, "utmin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3796, 11 }, 0x0, {}, {} },
+    { 0x0243, "uutai1", {}, {}, {}, {}, {}, { fieldWorldExits + 37, 2 }, { fieldModelIDs + 3807, 15 }, 0x0, {}, {} },
+    { 0x0244, "utapb", { fieldScriptItems + 322, 7 }, {}, { fieldScriptMessages + 342, 7 }, {}, {}, {}, { fieldModelIDs + 3822, 15 }, 0x0, {}, {} },
+    { 0x0245, "yufy1", {}, { fieldScriptMateria + 140, 2 }, { fieldScriptMessages + 349, 1 }, {}, {}, {}, { fieldModelIDs + 3837, 10 }, 0x0, {}, {} },
+    { 0x0246, "yufy2", {}, {}, { fieldScriptMessages + 350, 1 }, {}, {}, {}, { fieldModelIDs + 3847, 10 }, 0x0, {}, {} },
+    { 0x0247, "hideway1", { fieldScriptItems + 329, 1 }, {}, { fieldScriptMessages + 351, 1 }, {}, {}, {}, { fieldModelIDs + 3857, 9 }, 0x0, {}, {} },
+    { 0x0248, "hideway2", { fieldScriptItems + 330, 1 }, {}, { fieldScriptMessages + 352, 1 }, {}, {}, {}, { fieldModelIDs + 3866, 9 }, 0x0, {}, {} },
+    { 0x0249, "hideway3", {}, { fieldScriptMateria + 142, 1 }, { fieldScriptMessages + 353, 1 }, {}, {}, {}, { fieldModelIDs + 3875, 10 }, 0x0, {}, {} },
+    { 0x024A, "5tower", {}, { fieldScriptMateria + 143, 2 }, { fieldScriptMessages + 354, 2 }, {}, { fieldScriptBattles + 150, 5 }, {}, { fieldModelIDs + 3885, 14 }, 0x0, {}, {} },
+    { 0x024B, "uutai2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3899, 13 }, 0x0, {}, {} },
+    { 0x024C, "uttmpin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3912, 11 }, 0x0, {}, {} },
+    { 0x024D, "uttmpin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3923, 12 }, 0x0, {}, {} },
+    { 0x024E, "uttmpin3", {}, {}, {}, {}, { fieldScriptBattles + 155, 1 }, {}, { fieldModelIDs + 3935, 16 }, 0x0, {}, {} },
+    { 0x024F, "uttmpin4", { fieldScriptItems + 331, 2 }, {}, { fieldScriptMessages + 356, 2 }, {}, {}, {}, { fieldModelIDs + 3951, 10 }, 0x0, {}, {} },
+    { 0x0250, "datiao_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3961, 5 }, 0x8DF0, {25180, 23133, 19038, 0, 0, 0, 4703, 4703, 0, 0}, {} },
+    { 0x0251, "datiao_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3966, 4 }, 0x796C, {19040, 18017, 15970, 14942, 0, 0, 4707, 4707, 0, 0}, {} },
+    { 0x0252, "datiao_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3970, 4 }, 0x6E6C, {25184, 23137, 19042, 0, 0, 0, 6755, 6755, 0, 0}, {} },
+    { 0x0253, "datiao_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3974, 4 }, 0x6AF4, {25188, 23141, 19046, 0, 0, 0, 0, 0, 0, 8807}, {} },
+    { 0x0254, "datiao_5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3978, 4 }, 0x7888, {19044, 18021, 15974, 14941, 0, 0, 0, 0, 0, 8807}, {} },
+    { 0x0255, "datiao_6", {}, {}, {}, {}, { fieldScriptBattles + 156, 1 }, {}, { fieldModelIDs + 3982, 13 }, 0x0, {}, {} },
+    { 0x0256, "datiao_7", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 3995, 4 }, 0x7090, {19048, 18025, 15969, 14950, 0, 0, 2655, 2659, 0, 4714}, {} },
+    { 0x0257, "datiao_8", { fieldScriptItems + 333, 2 }, { fieldScriptMateria + 145, 1 }, { fieldScriptMessages + 358, 3 }, {}, {}, {}, { fieldModelIDs + 3999, 7 }, 0x0, {}, {} },
+    { 0x0258, "jtempl", {}, {}, {}, {}, {}, { fieldWorldExits + 39, 2 }, { fieldModelIDs + 4006, 10 }, 0x0, {}, {} },
+    { 0x0259, "jtemplb", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4016, 12 }, 0x0, {}, {} },
+    { 0x025A, "jtmpin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4028, 10 }, 0x0, {}, {} },
+    { 0x025B, "jtmpin2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4038, 1 }, 0x0, {}, {} },
+    { 0x025C, "kuro_1", { fieldScriptItems + 335, 5 }, { fieldScriptMateria + 146, 1 }, { fieldScriptMessages + 361, 5 }, {}, {}, {}, { fieldModelIDs + 4039, 16 }, 0x979C, {15992, 14969, 13946, 12923, 10876, 0, 4733, 4734, 8831, 0}, {} },
+    { 0x025D, "kuro_2", { fieldScriptItems + 340, 1 }, {}, { fieldScriptMessages + 366, 1 }, { fieldScriptShops + 100, 1 }, {}, {}, { fieldModelIDs + 4055, 11 }, 0x0, {}, {} },
+    { 0x025E, "kuro_3", {}, { fieldScriptMateria + 147, 1 }, { fieldScriptMessages + 367, 1 }, {}, {}, {}, { fieldModelIDs + 4066, 15 }, 0x0, {}, {} },
+    { 0x025F, "kuro_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4081, 6 }, 0x0, {}, {} },
+    { 0x0260, "kuro_5", { fieldScriptItems + 341, 1 }, {}, { fieldScriptMessages + 368, 1 }, {}, { fieldScriptBattles + 157, 4 }, {}, { fieldModelIDs + 4087, 10 }, 0x0, {}, {} },
+    { 0x0261, "kuro_6", { fieldScriptItems + 342, 3 }, {}, { fieldScriptMessages + 369, 3 }, {}, { fieldScriptBattles + 161, 2 }, {}, { fieldModelIDs + 4097, 2 }, 0x0, {}, {} },
+    { 0x0262, "kuro_7", { fieldScriptItems + 345, 1 }, {}, { fieldScriptMessages + 372, 1 }, {}, {}, {}, { fieldModelIDs + 4099, 11 }, 0x0, {}, {} },
+    { 0x0263, "kuro_8", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4110, 14 }, 0x8708, {25216, 23169, 19074, 0, 0, 0, 0, 0, 0, 8835}, {} },
+    { 0x0264, "kuro_82", {}, { fieldScriptMateria + 148, 1 }, { fieldScriptMessages + 373, 1 }, {}, { fieldScriptBattles + 163, 1 }, {}, { fieldModelIDs + 4124, 12 }, 0xB998, {25216, 23169, 19074, 0, 0, 0, 0, 0, 0, 8835}, {} },
+    { 0x0265, "kuro_9", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4136, 12 }, 0x0, {}, {} },
+    { 0x0266, "kuro_10", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4148, 1 }, 0x0, {}, {} },
+    { 0x0267, "kuro_11", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4149, 1 }, 0x0, {}, {} },
+    { 0x0268, "kuro_12", {}, {}, {}, {}, { fieldScriptBattles + 164, 1 }, {}, { fieldModelIDs + 4150, 10 }, 0x0, {}, {} },
+    { 0x0269, "bonevil", { fieldScriptItems + 346, 12 }, { fieldScriptMateria + 149, 3 }, { fieldScriptMessages + 374, 15 }, { fieldScriptShops + 101, 1 }, {}, { fieldWorldExits + 41, 1 }, { fieldModelIDs + 4160, 11 }, 0x0, {}, {} },
+    { 0x026A, "slfrst_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4171, 5 }, 0x0, {}, {} },
+    { 0x026B, "slfrst_2", {}, { fieldScriptMateria + 152, 1 }, { fieldScriptMessages + 389, 1 }, {}, {}, {}, { fieldModelIDs + 4176, 4 }, 0x0, {}, {} },
+    { 0x026C, "anfrst_1", { fieldScriptItems + 358, 1 }, { fieldScriptMateria + 153, 1 }, { fieldScriptMessages + 390, 2 }, {}, {}, {}, { fieldModelIDs + 4180, 12 }, 0xC33C, {19220, 18197, 16150, 15127, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x026D, "anfrst_2", {}, { fieldScriptMateria + 154, 1 }, { fieldScriptMessages + 392, 1 }, {}, {}, {}, { fieldModelIDs + 4192, 7 }, 0x86F0, {19220, 18197, 16150, 15127, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x026E, "anfrst_3", { fieldScriptItems + 359, 2 }, {}, { fieldScriptMessages + 393, 2 }, {}, {}, { fieldWorldExits + 42, 1 }, { fieldModelIDs + 4199, 12 }, 0xBA20, {19220, 18197, 16150, 15127, 0, 0, 2840, 2840, 8985, 4890}, {} },
+    { 0x026F, "anfrst_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4211, 10 }, 0xAEA8, {19220, 18197, 16150, 15127, 0, 0, 2840, 2840, 8985, 4890}, {} },
+    { 0x0270, "anfrst_5", { fieldScriptItems + 361, 2 }, {}, { fieldScriptMessages + 395, 2 }, {}, {}, { fieldWorldExits + 43, 1 }, { fieldModelIDs + 4221, 5 }, 0x9AC4, {25552, 23505, 19410, 0, 0, 0, 5075, 5075, 0, 0}, {} },
+    { 0x0271, "sango1", { fieldScriptItems + 363, 1 }, {}, { fieldScriptMessages + 397, 1 }, {}, {}, {}, { fieldModelIDs + 4226, 4 }, 0x9CDC, {25232, 23185, 19090, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0272, "sango2", {}, {}, {}, {}, {}, { fieldWorldExits + 44, 1 }, { fieldModelIDs + 4230, 3 }, 0x6738, {35475, 31379, 0, 0, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x0273, "sango3", { fieldScriptItems + 364, 1 }, {}, { fieldScriptMessages + 398, 1 }, {}, {}, {}, { fieldModelIDs + 4233, 4 }, 0x92FC, {25236, 23189, 19094, 0, 0, 0, 4759, 4759, 0, 0}, {} },
+    { 0x0274, "sandun_1", { fieldScriptItems + 365, 3 }, { fieldScriptMateria + 155, 1 }, { fieldScriptMessages + 399, 4 }, {}, {}, {}, { fieldModelIDs + 4237, 7 }, 0xB92C, {16024, 15004, 13981, 12953, 10906, 0, 2715, 2715, 0, 4766}, {} },
+    { 0x0275, "sandun_2", { fieldScriptItems + 368, 1 }, {}, { fieldScriptMessages + 403, 1 }, {}, {}, { fieldWorldExits + 45, 1 }, { fieldModelIDs + 4244, 4 }, 0x6510, {16024, 15004, 13981, 12953, 10906, 0, 2715, 2715, 0, 4766}, {} },
+    { 0x0276, "lost1", {}, {}, {}, {}, {}, { fieldWorldExits + 46, 1 }, { fieldModelIDs + 4248, 8 }, 0x0, {}, {} },
+    { 0x0277, "losin1", {}, { fieldScriptMateria + 156, 1 }, { fieldScriptMessages + 404, 1 }, {}, {}, {}, { fieldModelIDs + 4256, 4 }, 0x0, {}, {} },
+    { 0x0278, "losin2", { fieldScriptItems + 369, 1 }, {}, { fieldScriptMessages + 405, 1 }, {}, {}, {}, { fieldModelIDs + 4260, 9 }, 0x0, {}, {} },
+    { 0x0279, "losin3", { fieldScriptItems + 370, 1 }, {}, { fieldScriptMessages + 406, 1 }, {}, {}, {}, { fieldModelIDs + 4269, 5 }, 0x0, {}, {} },
+    { 0x027A, "lost2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4274, 9 }, 0x0, {}, {} },
+    { 0x027B, "lost3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4283, 3 }, 0x0, {}, {} },
+    { 0x027C, "losinn", { fieldScriptItems + 371, 1 }, { fieldScriptMateria + 157, 1 }, { fieldScriptMessages + 407, 2 }, {}, {}, {}, { fieldModelIDs + 4286, 10 }, 0x0, {}, {} },
+    { 0x027D, "loslake1", { fieldScriptItems + 372, 1 }, {}, { fieldScriptMessages + 409, 1 }, {}, {}, {}, { fieldModelIDs + 4296, 12 }, 0x0, {}, {} },
+    { 0x027E, "loslake2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4308, 3 }, 0x0, {}, {} },
+    { 0x027F, "loslake3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4311, 5 }, 0x0, {}, {} },
+    { 0x0280, "blue_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4316, 3 }, 0x0, {}, {} },
+    { 0x0281, "blue_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4319, 9 }, 0x0, {}, {} },
+    { 0x0282, "white1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4328, 10 }, 0x0, {}, {} },
+    { 0x0283, "white2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4338, 10 }, 0x0, {}, {} },
+    { 0x0284, "hekiga", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4348, 10 }, 0x0, {}, {} },
+    { 0x0285, "whitein", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4358, 3 }, 0x0, {}, {} },
+    { 0x0286, "ancnt1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4361, 10 }, 0x0, {}, {} },
+    { 0x0287, "ancnt2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4371, 3 }, 0x0, {}, {} },
+    { 0x0288, "ancnt3", {}, {}, {}, {}, { fieldScriptBattles + 165, 1 }, {}, { fieldModelIDs + 4374, 4 }, 0x0, {}, {} },
+    { 0x0289, "ancnt4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4378, 9 }, 0x0, {}, {} },
+    { 0x028A, "snw_w", {}, {}, {}, { fieldScriptShops + 102, 4 }, {}, {}, { fieldModelIDs + 4387, 6 }, 0x0, {}, {} },
+    { 0x028B, "sninn_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4393, 9 }, 0x0, {}, {} },
+    { 0x028C, "sninn_2", { fieldScriptItems + 373, 1 }, {}, { fieldScriptMessages + 410, 1 }, {}, {}, {}, { fieldModelIDs + 4402, 4 }, 0x0, {}, {} },
+    { 0x028D, "sninn_b1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4406, 13 }, 0x0, {}, {} },
+    { 0x028E, "snow", {}, {}, {}, {}, {}, { fieldWorldExits + 47, 2 }, { fieldModelIDs + 4419, 15 }, 0x0, {}, {} },
+    { 0x028F, "snmin1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4434, 8 }, 0x0, {}, {} },
+    { 0x0290, "snmin2", { fieldScriptItems + 374, 2 }, {}, { fieldScriptMessages + 411, 2 }, {}, {}, {}, { fieldModelIDs + 4442, 10 }, 0x0, {}, {} },
+    { 0x0291, "snmayor", { fieldScriptItems + 376, 1 }, {}, { fieldScriptMessages + 413, 1 }, {}, {}, {}, { fieldModelIDs + 4452, 11 }, 0x0, {}, {} },
+    { 0x0292, "hyou1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4463, 9 }, 0x6824, {16032, 15009, 13986, 12963, 10916, 0, 0, 0, 0, 0}, {} },
+    { 0x0293, "hyou2", { fieldScriptItems + 377, 1 }, {}, { fieldScriptMessages + 414, 1 }, {}, {}, {}, { fieldModelIDs + 4472, 10 }, 0xD1BC, {16032, 15009, 13986, 12963, 10916, 0, 0, 0, 0, 0}, {} },
+    { 0x0294, "hyou3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4482, 9 }, 0x5F08, {16032, 15009, 13986, 12963, 10916, 0, 0, 0, 0, 0}, {} },
+    { 0x0295, "icedun_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4491, 9 }, 0x8C04, {25256, 23209, 19114, 0, 0, 0, 0, 0, 0, 8875}, {} },
+    { 0x0296, "icedun_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4500, 9 }, 0x9D90, {25256, 23209, 19114, 0, 0, 0, 0, 0, 0, 8875}, {} },
+    { 0x0297, "hyou4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4509, 9 }, 0x9564, {16044, 15021, 13998, 12975, 10928, 0, 2737, 2737, 8882, 4787}, {} },
+    { 0x0298, "hyou5_1", { fieldScriptItems + 378, 1 }, {}, { fieldScriptMessages + 415, 1 }, {}, {}, {}, { fieldModelIDs + 4518, 10 }, 0x8480, {16044, 15021, 13998, 12975, 10928, 0, 2737, 2737, 8882, 4787}, {} },
+    { 0x0299, "hyou5_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4528, 9 }, 0x0, {}, {} },
+    { 0x029A, "hyou5_3", { fieldScriptItems + 379, 1 }, {}, { fieldScriptMessages + 416, 1 }, {}, {}, {}, { fieldModelIDs + 4537, 10 }, 0x7518, {16044, 15021, 13998, 12975, 10928, 0, 2737, 2737, 8882, 4787}, {} },
+    { 0x029B, "hyou5_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4547, 9 }, 0x7944, {16044, 15021, 13998, 12975, 10928, 0, 2737, 2737, 8882, 4787}, {} },
+    { 0x029C, "hyou6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4556, 9 }, 0x72CC, {15032, 12980, 11957, 10934, 9911, 8889, 2746, 2746, 0, 4787}, {} },
+    { 0x029D, "hyoumap", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4565, 3 }, 0x0, {}, {} },
+    { 0x029E, "move_s", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4568, 9 }, 0x83D8, {16032, 15009, 13986, 12963, 10916, 0, 0, 0, 0, 0}, {} },
+    { 0x029F, "move_i", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4577, 9 }, 0x8554, {16032, 15009, 13986, 12963, 10916, 0, 0, 0, 0, 0}, {} },
+    { 0x02A0, "move_f", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4586, 9 }, 0xA4AC, {18080, 17057, 16034, 12963, 4772, 0, 2725, 2725, 0, 4774}, {} },
+    { 0x02A1, "move_r", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4595, 9 }, 0x7A1C, {18080, 17057, 16034, 12963, 4772, 0, 2725, 2725, 0, 4774}, {} },
+    { 0x02A2, "move_u", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4604, 9 }, 0x8BA8, {18080, 17057, 16034, 12963, 4772, 0, 2725, 2725, 0, 4774}, {} },
+    { 0x02A3, "move_d", {}, { fieldScriptMateria + 158, 1 }, { fieldScriptMessages + 417, 1 }, {}, {}, {}, { fieldModelIDs + 4613, 10 }, 0x8980, {18080, 17057, 16034, 12963, 4772, 0, 2725, 2725, 0, 4774}, {} },
+    { 0x02A4, "hyou7", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4623, 9 }, 0x8DC8, {16044, 15021, 13998, 12975, 10928, 0, 2737, 2737, 8882, 4787}, {} },
+    { 0x02A5, "hyou8_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4632, 9 }, 0x83A8, {15032, 12980, 11957, 10934, 9911, 8889, 2746, 2746, 0, 4787}, {} },
+    { 0x02A6, "hyou8_2", { fieldScriptItems + 380, 1 }, {}, { fieldScriptMessages + 418, 1 }, {}, {}, {}, { fieldModelIDs + 4641, 10 }, 0x5E28, {15032, 12980, 11957, 10934, 9911, 8889, 2746, 2746, 0, 4787}, {} },
+    { 0x02A7, "hyou9", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4651, 9 }, 0x6244, {16044, 15021, 13998, 12975, 10928, 0, 2737, 2737, 8882, 4787}, {} },
+    { 0x02A8, "hyou10", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4660, 9 }, 0x0, {}, {} },
+    { 0x02A9, "hyou11", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4669, 9 }, 0x6AB8, {15032, 12980, 11957, 10934, 9911, 8889, 2746, 2746, 0, 4787}, {} },
+    { 0x02AA, "hyou12", {}, { fieldScriptMateria + 159, 1 }, { fieldScriptMessages + 419, 1 }, {}, {}, {}, { fieldModelIDs + 4678, 10 }, 0x586C, {16044, 15021, 13998, 12975, 10928, 0, 2737, 2737, 8882, 4787}, {} },
+    { 0x02AB, "hyou13_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4688, 9 }, 0x8AD4, {15032, 12980, 11957, 10934, 9911, 8889, 2746, 2746, 0, 4787}, {} },
+    { 0x02AC, "hyou13_2", {}, { fieldScriptMateria + 160, 1 }, { fieldScriptMessages + 420, 1 }, {}, { fieldScriptBattles + 166, 1 }, {}, { fieldModelIDs + 4697, 11 }, 0x74F4, {15032, 12980, 11957, 10934, 9911, 8889, 2746, 2746, 0, 4787}, {} },
+    { 0x02AE, "gaiafoot", {}, {}, {}, {}, {}, { fieldWorldExits + 49, 1 }, { fieldModelIDs + 4708, 9 }, 0x0, {}, {} },
+    { 0x02AF, "holu_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4717, 10 }, 0x0, {}, {} },
+    { 0x02B0, "holu_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4727, 9 }, 0x0, {}, {} },
+    { 0x02B1, "gaia_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4736, 5 }, 0x5BF0, {19132, 18109, 16062, 15039, 0, 0, 4800, 4800, 0, 0}, {} },
+    { 0x02B2, "gaiin_1", { fieldScriptItems + 381, 2 }, {}, { fieldScriptMessages + 421, 2 }, {}, {}, {}, { fieldModelIDs + 4741, 5 }, 0x8F5C, {19137, 18114, 16067, 15044, 0, 0, 2757, 2757, 0, 4806}, {} },
+    { 0x02B3, "gaiin_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4746, 7 }, 0x8F9C, {19137, 18114, 16067, 15044, 0, 0, 2757, 2757, 0, 4806}, {} },
+    { 0x02B4, "gaia_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4753, 8 }, 0x65BC, {19132, 18109, 16062, 15039, 0, 0, 4800, 4800, 0, 0}, {} },
+    { 0x02B5, "gaiin_3", { fieldScriptItems + 383, 2 }, {}, { fieldScriptMessages + 423, 2 }, {}, {}, {}, { fieldModelIDs + 4761, 6 }, 0x7A24, {19137, 18114, 16067, 15044, 0, 0, 2757, 2757, 0, 4806}, {} },
+    { 0x02B6, "gaia_31", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4767, 7 }, 0x5E10, {19132, 18109, 16062, 15039, 0, 0, 4800, 4800, 0, 0}, {} },
+    { 0x02B7, "gaia_32", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4774, 1 }, 0x0, {}, {} },
+    { 0x02B8, "gaiin_4", { fieldScriptItems + 385, 1 }, {}, { fieldScriptMessages + 425, 1 }, {}, {}, {}, { fieldModelIDs + 4775, 4 }, 0x6278, {19132, 18109, 16062, 15039, 0, 0, 4800, 4800, 0, 0}, {} },
+    { 0x02B9, "gaiin_5", { fieldScriptItems + 386, 2 }, {}, { fieldScriptMessages + 426, 1 }, {}, { fieldScriptBattles + 167, 4 }, {}, { fieldModelIDs + 4779, 7 }, 0x0, {}, {} },
+    { 0x02BA, "gaiin_6", {}, {}, {}, {}, { fieldScriptBattles + 171, 1 }, {}, { fieldModelIDs + 4786, 9 }, 0x4EA0, {19143, 18120, 16073, 15050, 0, 0, 4811, 4811, 0, 0}, {} },
+    { 0x02BB, "gaiin_7", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4795, 2 }, 0x4184, {19143, 18120, 16073, 15050, 0, 0, 4811, 4811, 0, 0}, {} },
+    { 0x02BC, "crater_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4797, 9 }, 0x6A00, {25296, 23249, 19154, 0, 0, 0, 0, 0, 8915, 0}, {} },
+    { 0x02BD, "crater_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4806, 9 }, 0x0, {}, {} },
+    { 0x02BE, "trnad_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4815, 10 }, 0x0, {}, {} },
+    { 0x02BF, "trnad_2", {}, { fieldScriptMateria + 161, 1 }, { fieldScriptMessages + 427, 1 }, {}, {}, {}, { fieldModelIDs + 4825, 11 }, 0x0, {}, {} },
+    { 0x02C0, "trnad_3", { fieldScriptItems + 388, 1 }, {}, { fieldScriptMessages + 428, 1 }, {}, {}, {}, { fieldModelIDs + 4836, 16 }, 0x7514, {19156, 18133, 16086, 15063, 0, 0, 4824, 4824, 0, 0}, {} },
+    { 0x02C1, "trnad_4", { fieldScriptItems + 389, 1 }, { fieldScriptMateria + 162, 1 }, { fieldScriptMessages + 429, 2 }, {}, { fieldScriptBattles + 172, 1 }, {}, { fieldModelIDs + 4852, 14 }, 0xA160, {16090, 15067, 14044, 13021, 10976, 0, 2782, 2782, 0, 4831}, {} },
+    { 0x02C2, "trnad_51", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4866, 12 }, 0x7F44, {19164, 18145, 16098, 15075, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x02C3, "trnad_52", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4878, 11 }, 0x0, {}, {} },
+    { 0x02C4, "trnad_53", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4889, 11 }, 0x0, {}, {} },
+    { 0x02C5, "woa_1", { fieldScriptItems + 390, 2 }, {}, { fieldScriptMessages + 431, 2 }, {}, { fieldScriptBattles + 173, 1 }, {}, { fieldModelIDs + 4900, 12 }, 0x0, {}, {} },
+    { 0x02C6, "woa_2", {}, {}, {}, {}, { fieldScriptBattles + 174, 1 }, {}, { fieldModelIDs + 4912, 8 }, 0x0, {}, {} },
+    { 0x02C7, "woa_3", {}, {}, {}, {}, { fieldScriptBattles + 175, 1 }, {}, { fieldModelIDs + 4920, 8 }, 0x0, {}, {} },
+    { 0x02C8, "itown1a", {}, {}, {}, {}, {}, { fieldWorldExits + 50, 2 }, { fieldModelIDs + 4928, 14 }, 0x0, {}, {} },
+    { 0x02C9, "itown12", {}, {}, {}, {}, {}, { fieldWorldExits + 52, 2 }, { fieldModelIDs + 4942, 12 }, 0x0, {}, {} },
+    { 0x02CA, "itown1b", {}, { fieldScriptMateria + 163, 1 }, {}, { fieldScriptShops + 106, 7 }, {}, { fieldWorldExits + 54, 2 }, { fieldModelIDs + 4954, 13 }, 0x0, {}, {} },
+    { 0x02CB, "itown2", {}, {}, {}, {}, { fieldScriptBattles + 176, 1 }, {}, { fieldModelIDs + 4967, 7 }, 0x0, {}, {} },
+    { 0x02CC, "ithill", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 4974, 8 }, 0x0, {}, {} },
+    { 0x02CD, "itown_w", { fieldScriptItems + 392, 1 }, { fieldScriptMateria + 164, 1 }, {}, { fieldScriptShops + 113, 2 }, {}, {}, { fieldModelIDs + 4982, 11 }, 0x0, {}, {} },
+    { 0x02CE, "itown_i", {}, { fieldScriptMateria + 165, 1 }, {}, { fieldScriptShops + 115, 2 }, {}, {}, { fieldModelIDs + 4993, 11 }, 0x0, {}, {} },
+    { 0x02CF, "itown_m", {}, { fieldScriptMateria + 166, 1 }, {}, { fieldScriptShops + 117, 2 }, {}, {}, { fieldModelIDs + 5004, 11 }, 0x0, {}, {} },
+    { 0x02D0, "ithos", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5015, 10 }, 0x0, {}, {} },
+    { 0x02D1, "itmin1", {}, {}, {}, { fieldScriptShops + 119, 1 }, {}, {}, { fieldModelIDs + 5025, 12 }, 0x0, {}, {} },
+    { 0x02D2, "itmin2", { fieldScriptItems + 393, 1 }, {}, { fieldScriptMessages + 433, 1 }, {}, {}, {}, { fieldModelIDs + 5037, 10 }, 0x0, {}, {} },
+    { 0x02D3, "life", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5047, 2 }, 0x0, {}, {} },
+    { 0x02D4, "life2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5049, 2 }, 0x0, {}, {} },
+    { 0x02D5, "zmind1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5051, 7 }, 0x0, {}, {} },
+    { 0x02D6, "zmind2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5058, 5 }, 0x0, {}, {} },
+    { 0x02D7, "zmind3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5063, 7 }, 0x0, {}, {} },
+    { 0x02D8, "zcoal_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5070, 8 }, 0x0, {}, {} },
+    { 0x02D9, "zcoal_2", {}, {}, {}, {}, { fieldScriptBattles + 177, 4 }, {}, { fieldModelIDs + 5078, 2 }, 0x0, {}, {} },
+    { 0x02DA, "zcoal_3", {}, {}, {}, {}, { fieldScriptBattles + 181, 1 }, {}, { fieldModelIDs + 5080, 8 }, 0x0, {}, {} },
+    { 0x02DB, "md8_5", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5088, 8 }, 0x0, {}, {} },
+    { 0x02DC, "md8_6", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5096, 9 }, 0x0, {}, {} },
+    { 0x02DD, "md8_b1", { fieldScriptItems + 394, 4 }, {}, { fieldScriptMessages + 434, 4 }, {}, {}, {}, { fieldModelIDs + 5105, 6 }, 0xA42C, {15156, 13110, 12087, 11064, 10041, 9018, 2875, 2876, 0, 4925}, {} },
+    { 0x02DE, "md8_b2", { fieldScriptItems + 398, 2 }, {}, { fieldScriptMessages + 438, 2 }, {}, {}, {}, { fieldModelIDs + 5111, 3 }, 0xB658, {15157, 13110, 12087, 11064, 10041, 9018, 2875, 2876, 0, 4925}, {} },
+    { 0x02DF, "4sbwy_22", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5114, 1 }, 0x0, {}, {} },
+    { 0x02E0, "tunnel_4", {}, { fieldScriptMateria + 167, 1 }, { fieldScriptMessages + 440, 1 }, {}, {}, {}, { fieldModelIDs + 5115, 10 }, 0x9FCC, {19262, 18239, 16192, 15169, 0, 0, 4930, 4931, 0, 0}, {} },
+    { 0x02E1, "tunnel_5", { fieldScriptItems + 400, 4 }, {}, { fieldScriptMessages + 441, 4 }, {}, {}, {}, { fieldModelIDs + 5125, 8 }, 0x8294, {19262, 18239, 16192, 15169, 0, 0, 4930, 4931, 0, 0}, {} },
+    { 0x02E2, "md8brdg2", {}, {}, {}, {}, { fieldScriptBattles + 182, 1 }, {}, { fieldModelIDs + 5133, 11 }, 0x0, {}, {} },
+    { 0x02E3, "md8_32", { fieldScriptItems + 404, 2 }, {}, { fieldScriptMessages + 445, 2 }, {}, {}, {}, { fieldModelIDs + 5144, 5 }, 0x8800, {19268, 18245, 16198, 15175, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x02E4, "canon_1", { fieldScriptItems + 406, 1 }, {}, { fieldScriptMessages + 447, 1 }, {}, {}, {}, { fieldModelIDs + 5149, 3 }, 0x8244, {16208, 15185, 14162, 13140, 11093, 0, 2899, 2899, 0, 4950}, {} },
+    { 0x02E5, "canon_2", {}, {}, {}, {}, { fieldScriptBattles + 183, 1 }, {}, { fieldModelIDs + 5152, 9 }, 0x0, {}, {} },
+    { 0x02E6, "md_e1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5161, 7 }, 0x0, {}, {} },
+    { 0x02E8, "las0_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5168, 2 }, 0x0, {}, {} },
+    { 0x02E9, "las0_2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5170, 1 }, 0x0, {}, {} },
+    { 0x02EA, "las0_3", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5171, 1 }, 0x0, {}, {} },
+    { 0x02EB, "las0_4", { fieldScriptItems + 407, 2 }, {}, { fieldScriptMessages + 448, 2 }, {}, {}, {}, { fieldModelIDs + 5172, 4 }, 0x907C, {19300, 18278, 16233, 15205, 0, 0, 0, 0, 0, 0}, {} },
+    { 0x02EC, "las0_5", { fieldScriptItems + 409, 5 }, { fieldScriptMateria + 168, 1 }, { fieldScriptMessages + 450, 6 }, {}, {}, {}, { fieldModelIDs + 5176, 8 }, 0xCFA0, {19380, 18278, 16233, 15205, 0, 0, 4971, 5046, 0, 0}, {} },
+    { 0x02ED, "las0_6", { fieldScriptItems + 414, 2 }, {}, { fieldScriptMessages + 456, 2 }, {}, {}, {}, { fieldModelIDs + 5184, 11 }, 0x892C, {16308, 15206, 14185, 13162, 11189, 0, 4971, 5046, 0, 0}, {} },
+    { 0x02EE, "las0_7", { fieldScriptItems + 416, 3 }, {}, { fieldScriptMessages + 458, 3 }, {}, {}, {}, { fieldModelIDs + 5195, 12 }, 0x738C, {15285, 13158, 12137, 11188, 10090, 9064, 4971, 5046, 0, 0}, {} },
+    { 0x02EF, "las0_8", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5207, 9 }, 0xA280, {15285, 13158, 12137, 11188, 10090, 9064, 4971, 5046, 0, 0}, {} },
+    { 0x02F0, "las1_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5216, 2 }, 0x4E68, {15212, 13165, 12142, 11119, 10096, 9073, 2930, 2930, 0, 4979}, {} },
+    { 0x02F1, "las1_2", { fieldScriptItems + 419, 3 }, {}, { fieldScriptMessages + 461, 3 }, {}, {}, {}, { fieldModelIDs + 5218, 5 }, 0x764C, {15212, 13165, 12142, 11119, 10096, 9073, 2930, 2930, 0, 4979}, {} },
+    { 0x02F2, "las1_3", { fieldScriptItems + 422, 4 }, {}, { fieldScriptMessages + 464, 4 }, {}, {}, {}, { fieldModelIDs + 5223, 6 }, 0x7F40, {15212, 13165, 12142, 11119, 10096, 9073, 2930, 2930, 0, 4979}, {} },
+    { 0x02F3, "las1_4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5229, 2 }, 0x6DDC, {15212, 13165, 12142, 11119, 10096, 9073, 2930, 2930, 0, 4979}, {} },
+    { 0x02F4, "las2_1", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5231, 9 }, 0xAF54, {19324, 18301, 16254, 15232, 0, 0, 4991, 4991, 0, 0}, {} },
+    { 0x02F5, "las2_2", { fieldScriptItems + 426, 2 }, {}, { fieldScriptMessages + 468, 2 }, {}, {}, {}, { fieldModelIDs + 5240, 11 }, 0xBB3C, {16244, 14197, 13174, 12153, 10107, 4986, 0, 0, 9079, 9080}, {} },
+    { 0x02F6, "las2_3", { fieldScriptItems + 428, 3 }, { fieldScriptMateria + 169, 1 }, { fieldScriptMessages + 470, 4 }, {}, {}, {}, { fieldModelIDs + 5251, 13 }, 0xCB8C, {16244, 14197, 13174, 12153, 10107, 4986, 0, 0, 9079, 9080}, {} },
+    { 0x02F7, "las2_4", {}, { fieldScriptMateria + 170, 2 }, { fieldScriptMessages + 474, 1 }, {}, {}, {}, { fieldModelIDs + 5264, 11 }, 0xC764, {19324, 18301, 16254, 15232, 0, 0, 4991, 4991, 0, 0}, {} },
+    { 0x02F8, "las3_1", { fieldScriptItems + 431, 3 }, {}, { fieldScriptMessages + 475, 3 }, {}, {}, {}, { fieldModelIDs + 5275, 5 }, 0x6FBC, {19324, 18301, 16254, 15232, 0, 0, 4991, 4991, 0, 0}, {} },
+    { 0x02F9, "las3_2", { fieldScriptItems + 434, 2 }, { fieldScriptMateria + 172, 1 }, { fieldScriptMessages + 478, 3 }, {}, {}, {}, { fieldModelIDs + 5280, 5 }, 0xACC0, {19324, 18301, 16254, 15232, 0, 0, 4991, 4991, 0, 0}, {} },
+    { 0x02FA, "las3_3", { fieldScriptItems + 436, 3 }, { fieldScriptMateria + 173, 1 }, { fieldScriptMessages + 481, 3 }, {}, {}, {}, { fieldModelIDs + 5285, 6 }, 0xB8EC, {19324, 18301, 16254, 15232, 0, 0, 4991, 4991, 0, 0}, {} },
+    { 0x02FB, "las4_0", { fieldScriptItems + 439, 18 }, { fieldScriptMateria + 174, 4 }, { fieldScriptMessages + 484, 17 }, {}, { fieldScriptBattles + 184, 1 }, {}, { fieldModelIDs + 5291, 9 }, 0x0, {}, {} },
+    { 0x02FC, "las4_1", { fieldScriptItems + 457, 1 }, {}, { fieldScriptMessages + 501, 1 }, {}, {}, {}, { fieldModelIDs + 5300, 10 }, 0x0, {}, {} },
+    { 0x02FD, "las4_2", {}, {}, {}, {}, { fieldScriptBattles + 185, 3 }, {}, { fieldModelIDs + 5310, 8 }, 0x0, {}, {} },
+    { 0x02FE, "las4_3", {}, {}, {}, {}, { fieldScriptBattles + 188, 3 }, {}, { fieldModelIDs + 5318, 1 }, 0x0, {}, {} },
+    { 0x02FF, "las4_4", {}, {}, {}, {}, { fieldScriptBattles + 191, 1 }, {}, { fieldModelIDs + 5319, 9 }, 0x0, {}, {} },
+    { 0x0300, "lastmap", {}, {}, {}, {}, { fieldScriptBattles + 192, 7 }, {}, { fieldModelIDs + 5328, 9 }, 0x0, {}, {} },
+    { 0x0303, "hill2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5337, 2 }, 0x0, {}, {} },
+    { 0x0304, "bonevil2", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5339, 16 }, 0x0, {}, {} },
+    { 0x0305, "junone22", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5355, 9 }, 0x0, {}, {} },
+    { 0x0306, "rckt32", {}, {}, {}, {}, { fieldScriptBattles + 199, 1 }, {}, { fieldModelIDs + 5364, 12 }, 0x0, {}, {} },
+    { 0x0307, "jtemplc", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5376, 12 }, 0x0, {}, {} },
+    { 0x030A, "tunnel_6", {}, {}, {}, {}, { fieldScriptBattles + 200, 2 }, {}, { fieldModelIDs + 5388, 11 }, 0xBF00, {19262, 18239, 16192, 15169, 0, 0, 4930, 4931, 0, 0}, {} },
+    { 0x030B, "md8_52", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5399, 10 }, 0x0, {}, {} },
+    { 0x030C, "sininb34", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5409, 4 }, 0x0, {}, {} },
+    { 0x030D, "mds7st33", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5413, 5 }, 0x0, {}, {} },
+    { 0x030E, "midgal", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5418, 8 }, 0x0, {}, {} },
+    { 0x030F, "sininb35", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5426, 3 }, 0x0, {}, {} },
+    { 0x0310, "nivgate4", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5429, 2 }, 0x0, {}, {} },
+    { 0x0311, "sininb36", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5431, 2 }, 0x0, {}, {} },
+    { 0x0312, "ztruck", {}, {}, {}, {}, {}, {}, { fieldModelIDs + 5433, 4 }, 0x0, {}, {} },
+};
+constexpr TableView<FieldData> GameData::fields = { fieldTable, std::size(fieldTable) };
+
+// World Map
+static constexpr WorldMapEntrance worldMapEntranceTable[] = {
+    { 0x5436, 0x01, "Slum Outskirts", 185586, 120034 },
+    { 0x546C, 0x02, "Kalm", 201654, 112270 },
+    { 0x54A2, 0x03, "Chocobo Farm", 239232, 137553 },
+    { 0x558C, 0x04, "Mithril Mine", 214151, 153662 },
+    { 0x55C2, 0x05, "Mithril Mine", 209488, 157306 },
+    { 0x55F8, 0x06, "Base of Fort Condor", 203336, 169536 },
+    { 0x562E, 0x07, "Under Junon", 169850, 146365 },
+    { 0x5670, 0x08, "Temple of the Ancients", 169981, 182279 },
+    { 0x56A6, 0x09, "Old Man's House", 198726, 133446 },
+    { 0x56DC, 0x0A, "Weapon Seller", 129280, 173309 },
+    { 0x5712, 0x0B, "Mideel", 220157, 201688 },
+    { 0x5768, 0x0C, "Materia Cave", 274268, 140114 },
+    { 0x579E, 0x0D, "Costa del Sol", 140866, 124836 },
+    { 0x57E0, 0x0E, "Mt. Corel", 112985, 121747 },
+    { 0x5816, 0x0F, "North Corel", 109337, 125402 },
+    { 0x5866, 0x10, "Corel Desert", 120383, 154118 },
+    { 0x5884, 0x11, "Jungle", 112914, 182638 },
+    { 0x58BA, 0x12, "Cosmo Canyon", 87246, 170237 },
+    { 0x58F0, 0x13, "Nibelheim", 92529, 136292 },
+    { 0x5926, 0x14, "Rocket Town", 83786, 120735 },
+    { 0x597C, 0x15, "???", 102194, 141174 },
+    { 0x59B2, 0x16, "Materia Cave", 116260, 109023 },
+    { 0x59E8, 0x17, "Wutai", 37926, 88476 },
+    { 0x5A90, 0x18, "Materia Cave", 53675, 128295 },
+    { 0x5AC6, 0x19, "Bone Village", 156389, 89288 },
+    { 0x5AFC, 0x1A, "Corel Valley Cave", 158239, 71427 },
+    { 0x5B32, 0x1B, "Icicle Inn", 129009, 72362 },
+    { 0x5B68, 0x1C, "Mystery House", 146135, 70381 },
+    { 0x5B9E, 0x1D, "Materia Cave", 263725, 13193 },
+    { 0x5238, 0x20, "Marshes", 215007, 152937 },
+    { 0x5286, 0x22, "Wilderness", 52951, 156334 },
+    { 0x5BD4, 0x2B, "Nibelheim", 92389, 135817 },
+    { 0x5C0A, 0x2C, "Mt. Nibel", 94085, 125897 },
+    { 0x5C40, 0x2E, "Mt. Nibel", 88079, 132446 },
+    { 0x5C76, 0x2F, "Icicle Inn", 129068, 71982 },
+    { 0x5CBC, 0x30, "Great Glacier", 136858, 53523 },
+    { 0x5CDA, 0x39, "Corel Valley", 162994, 86357 },
+    { 0x5D10, 0x3A, "Forgotten Capital", 162051, 81137 },
+};
+constexpr TableView<WorldMapEntrance> GameData::worldMapEntrances = { worldMapEntranceTable, std::size(worldMapEntranceTable) };
+
+static constexpr Encounter worldMapEncounterSets[] = {
+    16422,
+    16423,
+    16424,
+    16425,
+    0,
+    0,
+    2090,
+    2090,
+    0,
+    4139,
+    0,
+    0,
+    0,
+    0,
+    16416,
+    16417,
+    16418,
+    16420,
+    0,
+    0,
+    4131,
+    4131,
+    10277,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22572,
+    21549,
+    21550,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8239,
+    0,
+    0,
+    0,
+    0,
+    13360,
+    13361,
+    13362,
+    13363,
+    12340,
+    0,
+    2101,
+    2102,
+    0,
+    4151,
+    24632,
+    24633,
+    24636,
+    24637,
+    16442,
+    16443,
+    16446,
+    16447,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    16448,
+    16449,
+    16450,
+    16451,
+    0,
+    0,
+    4164,
+    4165,
+    0,
+    0,
+    16462,
+    16463,
+    16464,
+    16465,
+    22598,
+    21575,
+    21576,
+    0,
+    0,
+    0,
+    4169,
+    4169,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    16458,
+    16458,
+    16459,
+    16459,
+    0,
+    0,
+    4172,
+    4172,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22605,
+    21586,
+    21587,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22612,
+    21588,
+    21588,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22614,
+    21592,
+    21593,
+    0,
+    0,
+    0,
+    4186,
+    4186,
+    16475,
+    0,
+    0,
+    0,
+    0,
+    0,
+    16469,
+    16476,
+    16477,
+    16478,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22624,
+    21601,
+    21604,
+    0,
+    0,
+    0,
+    4197,
+    4197,
+    0,
+    0,
+    5218,
+    5219,
+    11368,
+    11369,
+    32870,
+    32870,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    10343,
+    0,
+    0,
+    0,
+    0,
+    0,
+    32874,
+    32875,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    16469,
+    16476,
+    16477,
+    16478,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22636,
+    21613,
+    21614,
+    0,
+    0,
+    0,
+    2159,
+    2159,
+    0,
+    4208,
+    0,
+    0,
+    0,
+    0,
+    22641,
+    21618,
+    21619,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8308,
+    0,
+    0,
+    0,
+    0,
+    16469,
+    16476,
+    16477,
+    16478,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22636,
+    21613,
+    21614,
+    0,
+    0,
+    0,
+    2159,
+    2159,
+    0,
+    4208,
+    0,
+    0,
+    0,
+    0,
+    22648,
+    21625,
+    21626,
+    0,
+    0,
+    0,
+    4219,
+    4219,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    11388,
+    11389,
+    11390,
+    11391,
+    10368,
+    10369,
+    2178,
+    2179,
+    10372,
+    4229,
+    0,
+    0,
+    0,
+    0,
+    22662,
+    21639,
+    21640,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8329,
+    0,
+    0,
+    0,
+    0,
+    22668,
+    21645,
+    21646,
+    0,
+    0,
+    0,
+    4239,
+    4239,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22672,
+    21649,
+    21650,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8339,
+    0,
+    0,
+    0,
+    0,
+    22662,
+    21639,
+    21640,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8329,
+    0,
+    0,
+    0,
+    0,
+    22676,
+    21653,
+    21654,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8343,
+    5272,
+    5273,
+    11420,
+    11421,
+    22682,
+    21659,
+    21662,
+    0,
+    0,
+    0,
+    4255,
+    4255,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22662,
+    21639,
+    21640,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8329,
+    0,
+    0,
+    0,
+    0,
+    16544,
+    16545,
+    16548,
+    16549,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    16552,
+    16553,
+    16554,
+    16555,
+    0,
+    0,
+    2220,
+    2221,
+    10414,
+    4271,
+    8354,
+    8355,
+    8358,
+    8359,
+    32944,
+    32945,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8370,
+    0,
+    0,
+    0,
+    0,
+    32947,
+    32947,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22708,
+    21685,
+    21686,
+    0,
+    0,
+    0,
+    4279,
+    4279,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22712,
+    21689,
+    21690,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22716,
+    21693,
+    21694,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    8383,
+    0,
+    0,
+    0,
+    0,
+    32955,
+    32955,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22720,
+    21697,
+    21698,
+    0,
+    0,
+    0,
+    4291,
+    4292,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    13509,
+    13510,
+    13511,
+    13512,
+    12489,
+    0,
+    2252,
+    2252,
+    0,
+    4301,
+    3274,
+    3275,
+    13518,
+    13519,
+    22736,
+    21713,
+    21714,
+    0,
+    0,
+    0,
+    0,
+    0,
+    10451,
+    0,
+    0,
+    0,
+    0,
+    0,
+    32955,
+    32955,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    16596,
+    16597,
+    16600,
+    16601,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    7382,
+    7383,
+    9434,
+    9435,
+    22748,
+    21725,
+    21726,
+    0,
+    0,
+    0,
+    4319,
+    4319,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22752,
+    21729,
+    21730,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    32995,
+    32995,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    20712,
+    20713,
+    16612,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22757,
+    21734,
+    21735,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    41188,
+    24804,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22757,
+    21734,
+    21735,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    22762,
+    21739,
+    21740,
+    0,
+    0,
+    0,
+    2285,
+    2285,
+    10478,
+    4335,
+    0,
+    0,
+    0,
+    0,
+};
+
+static constexpr WorldMapEncounters worldMapEncounterTable[] = {
+    { { {{ worldMapEncounterSets + 0, 14 }, { worldMapEncounterSets + 14, 14 }, {}, { worldMapEncounterSets + 28, 14 }} } },
+    { { {{ worldMapEncounterSets + 42, 14 }, {}, {}, { worldMapEncounterSets + 56, 14 }} } },
+    { { {{ worldMapEncounterSets + 70, 14 }, { worldMapEncounterSets + 84, 14 }, { worldMapEncounterSets + 98, 14 }, { worldMapEncounterSets + 112, 14 }} } },
+    { { {{ worldMapEncounterSets + 126, 14 }, { worldMapEncounterSets + 140, 14 }, {}, { worldMapEncounterSets + 154, 14 }} } },
+    { { {{ worldMapEncounterSets + 168, 14 }, { worldMapEncounterSets + 182, 14 }, { worldMapEncounterSets + 196, 14 }, { worldMapEncounterSets + 210, 14 }} } },
+    { { {{ worldMapEncounterSets + 224, 14 }, {}, { worldMapEncounterSets + 238, 14 }, { worldMapEncounterSets + 252, 14 }} } },
+    { { {{ worldMapEncounterSets + 266, 14 }, { worldMapEncounterSets + 280, 14 }, { worldMapEncounterSets + 294, 14 }, { worldMapEncounterSets + 308, 14 }} } },
+    { { {{ worldMapEncounterSets + 322, 14 }, {}, { worldMapEncounterSets + 336, 14 }, { worldMapEncounterSets + 350, 14 }} } },
+    { { {{ worldMapEncounterSets + 364, 14 }, {}, { worldMapEncounterSets + 378, 14 }, { worldMapEncounterSets + 392, 14 }} } },
+    { { {{ worldMapEncounterSets + 406, 14 }, { worldMapEncounterSets + 420, 14 }, { worldMapEncounterSets + 434, 14 }, { worldMapEncounterSets + 448, 14 }} } },
+    { { {{ worldMapEncounterSets + 462, 14 }, { worldMapEncounterSets + 476, 14 }, { worldMapEncounterSets + 490, 14 }, { worldMapEncounterSets + 504, 14 }} } },
+    { { {{ worldMapEncounterSets + 518, 14 }, { worldMapEncounterSets + 532, 14 }, { worldMapEncounterSets + 546, 14 }, { worldMapEncounterSets + 560, 14 }} } },
+    { { {{ worldMapEncounterSets + 574, 14 }, { worldMapEncounterSets + 588, 14 }, { worldMapEncounterSets + 602, 14 }, { worldMapEncounterSets + 616, 14 }} } },
+    { { {{}, {}, { worldMapEncounterSets + 630, 14 }, {}} } },
+    { { {{ worldMapEncounterSets + 644, 14 }, {}, { worldMapEncounterSets + 658, 14 }, {}} } },
+    { { {{ worldMapEncounterSets + 672, 14 }, {}, { worldMapEncounterSets + 686, 14 }, {}} } },
+};
+constexpr TableView<WorldMapEncounters> GameData::worldMapEncounters = { worldMapEncounterTable, std::size(worldMapEncounterTable) };
+
+// Shops
+static constexpr ShopItem shopItems[] = {
+    { 0, 257 },
+    { 1, 161 },
+    { 2, 20 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 8 },
+    { 3, 70 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 8 },
+    { 0, 258 },
+    { 1, 20 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 8 },
+    { 3, 70 },
+    { 0, 191 },
+    { 1, 145 },
+    { 2, 161 },
+    { 3, 258 },
+    { 4, 259 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 8 },
+    { 3, 12 },
+    { 4, 52 },
+    { 5, 13 },
+    { 6, 14 },
+    { 7, 1 },
+    { 8, 70 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 8 },
+    { 3, 20 },
+    { 4, 13 },
+    { 5, 14 },
+    { 6, 70 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 8 },
+    { 3, 52 },
+    { 4, 70 },
+    { 0, 129 },
+    { 1, 162 },
+    { 2, 146 },
+    { 3, 192 },
+    { 4, 259 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 8 },
+    { 3, 52 },
+    { 4, 13 },
+    { 5, 14 },
+    { 6, 70 },
+    { 0, 64 },
+    { 1, 65 },
+    { 2, 66 },
+    { 3, 67 },
+    { 4, 68 },
+    { 5, 69 },
+    { 0, 81 },
+    { 1, 82 },
+    { 2, 83 },
+    { 3, 84 },
+    { 4, 64 },
+    { 5, 65 },
+    { 6, 66 },
+    { 7, 67 },
+    { 8, 68 },
+    { 9, 69 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 13 },
+    { 3, 14 },
+    { 4, 70 },
+    { 0, 259 },
+    { 1, 0 },
+    { 2, 7 },
+    { 3, 20 },
+    { 4, 70 },
+    { 0, 129 },
+    { 1, 162 },
+    { 2, 146 },
+    { 3, 192 },
+    { 4, 176 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 8 },
+    { 4, 52 },
+    { 5, 12 },
+    { 6, 13 },
+    { 7, 14 },
+    { 8, 70 },
+    { 0, 130 },
+    { 1, 147 },
+    { 2, 163 },
+    { 3, 193 },
+    { 4, 177 },
+    { 5, 216 },
+    { 0, 299 },
+    { 1, 300 },
+    { 0, 0 },
+    { 1, 7 },
+    { 0, 265 },
+    { 1, 260 },
+    { 2, 277 },
+    { 3, 53 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 9 },
+    { 4, 8 },
+    { 5, 52 },
+    { 6, 13 },
+    { 7, 14 },
+    { 8, 70 },
+    { 0, 260 },
+    { 1, 135 },
+    { 2, 53 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 70 },
+    { 1, 10 },
+    { 2, 11 },
+    { 3, 9 },
+    { 4, 13 },
+    { 5, 14 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 3 },
+    { 3, 8 },
+    { 4, 10 },
+    { 5, 11 },
+    { 6, 9 },
+    { 7, 12 },
+    { 8, 13 },
+    { 9, 14 },
+    { 0, 0 },
+    { 1, 7 },
+    { 2, 70 },
+    { 0, 130 },
+    { 1, 147 },
+    { 2, 163 },
+    { 3, 193 },
+    { 4, 177 },
+    { 5, 216 },
+    { 6, 50 },
+    { 7, 51 },
+    { 8, 53 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 70 },
+    { 4, 10 },
+    { 5, 11 },
+    { 6, 9 },
+    { 7, 13 },
+    { 8, 14 },
+    { 0, 300 },
+    { 1, 299 },
+    { 2, 298 },
+    { 3, 291 },
+    { 4, 303 },
+    { 5, 312 },
+    { 0, 131 },
+    { 1, 148 },
+    { 2, 164 },
+    { 3, 194 },
+    { 4, 178 },
+    { 5, 217 },
+    { 6, 230 },
+    { 7, 261 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 5, 10 },
+    { 6, 11 },
+    { 7, 9 },
+    { 8, 13 },
+    { 9, 14 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 70 },
+    { 0, 243 },
+    { 1, 262 },
+    { 2, 288 },
+    { 3, 289 },
+    { 4, 290 },
+    { 5, 291 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 13 },
+    { 5, 14 },
+    { 6, 70 },
+    { 0, 137 },
+    { 1, 149 },
+    { 2, 165 },
+    { 3, 195 },
+    { 4, 179 },
+    { 5, 202 },
+    { 6, 231 },
+    { 7, 218 },
+    { 8, 244 },
+    { 0, 1 },
+    { 1, 7 },
+    { 2, 3 },
+    { 3, 13 },
+    { 4, 14 },
+    { 5, 70 },
+    { 6, 31 },
+    { 7, 35 },
+    { 8, 292 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 13 },
+    { 5, 14 },
+    { 6, 10 },
+    { 7, 70 },
+    { 0, 133 },
+    { 1, 150 },
+    { 2, 166 },
+    { 3, 180 },
+    { 4, 219 },
+    { 5, 232 },
+    { 6, 204 },
+    { 7, 245 },
+    { 8, 70 },
+    { 9, 1 },
+    { 0, 134 },
+    { 1, 151 },
+    { 2, 167 },
+    { 3, 181 },
+    { 4, 220 },
+    { 5, 233 },
+    { 6, 205 },
+    { 7, 246 },
+    { 8, 264 },
+    { 9, 268 },
+    { 0, 293 },
+    { 1, 307 },
+    { 2, 308 },
+    { 3, 309 },
+    { 4, 301 },
+    { 5, 302 },
+    { 6, 303 },
+    { 0, 1 },
+    { 1, 7 },
+    { 2, 3 },
+    { 3, 13 },
+    { 4, 14 },
+    { 5, 15 },
+    { 6, 70 },
+    { 0, 1 },
+    { 1, 7 },
+    { 2, 3 },
+    { 3, 13 },
+    { 4, 14 },
+    { 5, 70 },
+    { 6, 54 },
+    { 0, 79 },
+    { 1, 80 },
+    { 2, 62 },
+    { 3, 63 },
+    { 0, 163 },
+    { 1, 147 },
+    { 2, 193 },
+    { 3, 177 },
+    { 4, 216 },
+    { 5, 229 },
+    { 6, 201 },
+    { 7, 203 },
+    { 8, 242 },
+    { 0, 221 },
+    { 1, 222 },
+    { 2, 206 },
+    { 3, 210 },
+    { 4, 247 },
+    { 5, 248 },
+    { 6, 182 },
+    { 7, 183 },
+    { 8, 196 },
+    { 9, 197 },
+    { 0, 136 },
+    { 1, 132 },
+    { 2, 168 },
+    { 3, 169 },
+    { 4, 153 },
+    { 5, 154 },
+    { 6, 198 },
+    { 0, 265 },
+    { 1, 156 },
+    { 2, 172 },
+    { 3, 225 },
+    { 4, 234 },
+    { 5, 235 },
+    { 6, 236 },
+    { 7, 251 },
+    { 0, 138 },
+    { 1, 171 },
+    { 2, 155 },
+    { 3, 185 },
+    { 4, 224 },
+    { 5, 237 },
+    { 6, 209 },
+    { 7, 250 },
+    { 0, 170 },
+    { 1, 184 },
+    { 2, 223 },
+    { 3, 249 },
+    { 4, 238 },
+    { 5, 54 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 13 },
+    { 5, 14 },
+    { 6, 70 },
+    { 0, 54 },
+    { 1, 262 },
+    { 2, 267 },
+    { 3, 288 },
+    { 4, 289 },
+    { 5, 290 },
+    { 6, 291 },
+    { 7, 305 },
+    { 8, 311 },
+    { 0, 1 },
+    { 1, 7 },
+    { 2, 3 },
+    { 3, 70 },
+    { 0, 263 },
+    { 1, 266 },
+    { 2, 0 },
+    { 3, 1 },
+    { 4, 7 },
+    { 5, 3 },
+    { 6, 13 },
+    { 7, 14 },
+    { 8, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 70 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 7 },
+    { 3, 3 },
+    { 4, 0 },
+};
+
+static constexpr ShopItem shopMateria[] = {
+    { 3, 49 },
+    { 4, 50 },
+    { 5, 52 },
+    { 6, 53 },
+    { 0, 49 },
+    { 1, 50 },
+    { 2, 52 },
+    { 3, 53 },
+    { 0, 49 },
+    { 1, 50 },
+    { 2, 52 },
+    { 3, 53 },
+    { 4, 16 },
+    { 0, 51 },
+    { 1, 60 },
+    { 2, 36 },
+    { 3, 37 },
+    { 4, 54 },
+    { 0, 49 },
+    { 1, 52 },
+    { 2, 50 },
+    { 3, 53 },
+    { 0, 37 },
+    { 1, 56 },
+    { 2, 53 },
+    { 3, 54 },
+    { 4, 55 },
+    { 0, 49 },
+    { 1, 50 },
+    { 2, 52 },
+    { 3, 51 },
+    { 4, 60 },
+    { 0, 54 },
+    { 1, 55 },
+    { 2, 53 },
+    { 3, 56 },
+    { 4, 49 },
+    { 5, 50 },
+    { 6, 52 },
+    { 0, 58 },
+    { 6, 57 },
+    { 7, 65 },
+    { 8, 54 },
+    { 9, 58 },
+    { 0, 0 },
+    { 1, 1 },
+    { 2, 57 },
+    { 3, 58 },
+    { 7, 62 },
+    { 8, 59 },
+    { 9, 65 },
+    { 0, 1 },
+    { 1, 0 },
+    { 2, 58 },
+    { 3, 61 },
+    { 4, 68 },
+    { 0, 39 },
+    { 1, 42 },
+    { 2, 41 },
+    { 3, 68 },
+    { 4, 23 },
+    { 0, 3 },
+    { 1, 55 },
+    { 2, 0 },
+    { 3, 62 },
+    { 4, 59 },
+    { 5, 23 },
+    { 0, 49 },
+    { 1, 50 },
+    { 2, 52 },
+    { 3, 51 },
+    { 4, 61 },
+    { 5, 60 },
+    { 4, 62 },
+    { 5, 59 },
+    { 6, 65 },
+    { 7, 39 },
+    { 8, 41 },
+    { 9, 42 },
+};
+
+static constexpr Shop shopTable[] = {
+    { { shopItems + 0, 3 }, {} },
+    { { shopItems + 3, 4 }, {} },
+    { { shopItems + 7, 3 }, { shopMateria + 0, 4 } },
+    { { shopItems + 10, 2 }, {} },
+    { { shopItems + 12, 4 }, {} },
+    { {}, { shopMateria + 4, 4 } },
+    { { shopItems + 16, 5 }, {} },
+    { {}, { shopMateria + 8, 5 } },
+    { { shopItems + 21, 9 }, {} },
+    { { shopItems + 30, 7 }, {} },
+    { { shopItems + 37, 5 }, {} },
+    { { shopItems + 42, 5 }, {} },
+    { { shopItems + 47, 7 }, {} },
+    { {}, { shopMateria + 13, 5 } },
+    { { shopItems + 54, 6 }, {} },
+    { { shopItems + 60, 10 }, {} },
+    { { shopItems + 70, 5 }, {} },
+    { {}, { shopMateria + 18, 4 } },
+    { { shopItems + 75, 5 }, {} },
+    { { shopItems + 80, 5 }, {} },
+    { { shopItems + 85, 9 }, {} },
+    { {}, { shopMateria + 22, 5 } },
+    { { shopItems + 94, 6 }, {} },
+    { { shopItems + 100, 2 }, {} },
+    { {}, { shopMateria + 27, 5 } },
+    { { shopItems + 102, 2 }, {} },
+    { { shopItems + 104, 4 }, {} },
+    { {}, { shopMateria + 32, 7 } },
+    { { shopItems + 108, 9 }, {} },
+    { { shopItems + 117, 3 }, {} },
+    { { shopItems + 120, 3 }, {} },
+    { { shopItems + 123, 5 }, { shopMateria + 39, 1 } },
+    { { shopItems + 128, 10 }, {} },
+    { { shopItems + 138, 3 }, {} },
+    { { shopItems + 141, 9 }, {} },
+    { { shopItems + 150, 9 }, {} },
+    { { shopItems + 159, 6 }, { shopMateria + 40, 4 } },
+    { { shopItems + 165, 8 }, {} },
+    { { shopItems + 173, 10 }, {} },
+    { {}, { shopMateria + 44, 4 } },
+    { { shopItems + 183, 4 }, {} },
+    { { shopItems + 187, 6 }, {} },
+    { { shopItems + 193, 7 }, { shopMateria + 48, 3 } },
+    { { shopItems + 200, 9 }, {} },
+    { { shopItems + 209, 9 }, {} },
+    { { shopItems + 218, 8 }, {} },
+    { { shopItems + 226, 10 }, {} },
+    { { shopItems + 236, 10 }, {} },
+    { { shopItems + 246, 7 }, {} },
+    { { shopItems + 253, 7 }, {} },
+    { {}, { shopMateria + 51, 5 } },
+    { { shopItems + 260, 7 }, {} },
+    { {}, { shopMateria + 56, 5 } },
+    { { shopItems + 267, 4 }, {} },
+    { { shopItems + 271, 9 }, {} },
+    { { shopItems + 280, 10 }, {} },
+    { {}, { shopMateria + 61, 6 } },
+    { { shopItems + 290, 7 }, {} },
+    { { shopItems + 297, 8 }, {} },
+    { { shopItems + 305, 8 }, {} },
+    { { shopItems + 313, 6 }, {} },
+    { {}, { shopMateria + 67, 6 } },
+    { { shopItems + 319, 7 }, {} },
+    { { shopItems + 326, 9 }, {} },
+    { { shopItems + 335, 4 }, { shopMateria + 73, 6 } },
+    { { shopItems + 339, 9 }, {} },
+    { { shopItems + 348, 5 }, {} },
+    { { shopItems + 353, 5 }, {} },
+    { { shopItems + 358, 5 }, {} },
+    { { shopItems + 363, 5 }, {} },
+    { { shopItems + 368, 5 }, {} },
+    { { shopItems + 373, 5 }, {} },
+    { { shopItems + 378, 5 }, {} },
+    { { shopItems + 383, 5 }, {} },
+    { { shopItems + 388, 5 }, {} },
+    { { shopItems + 393, 5 }, {} },
+    { { shopItems + 398, 5 }, {} },
+    { { shopItems + 403, 5 }, {} },
+    { { shopItems + 408, 5 }, {} },
+    { { shopItems + 413, 5 }, {} },
+};
+constexpr TableView<Shop> GameData::shops = { shopTable, std::size(shopTable) };
+
+// Battles
+static constexpr BattleFormation battleFormations[] = {
+    { 28, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 29, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 30, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 31, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 32, false, {72, 65535, 65535, 65535, 65535, 65535}, {472, 474, 476, 479} },
+    { 33, false, {73, 73, 65535, 65535, 65535, 65535}, {473, 477, 478, 484} },
+    { 34, false, {74, 74, 72, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 35, false, {72, 72, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 36, false, {74, 75, 75, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 37, false, {73, 73, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 38, false, {74, 74, 74, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 39, false, {74, 74, 75, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 40, false, {72, 72, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 41, false, {74, 74, 74, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 42, false, {74, 75, 75, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 43, false, {75, 74, 74, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 44, false, {74, 74, 74, 65535, 65535, 65535}, {472, 474, 476, 479} },
+    { 45, false, {74, 74, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 46, false, {74, 75, 74, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 47, false, {75, 75, 74, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 48, false, {80, 77, 78, 77, 78, 65535}, {473, 477, 478, 484} },
+    { 49, false, {80, 80, 80, 65535, 65535, 65535}, {472, 474, 476, 479} },
+    { 50, false, {80, 80, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 51, false, {80, 80, 80, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 52, false, {79, 79, 79, 79, 65535, 65535}, {999, 999, 999, 999} },
+    { 53, false, {76, 76, 65535, 65535, 65535, 65535}, {472, 474, 476, 479} },
+    { 54, false, {80, 76, 76, 65535, 65535, 65535}, {473, 477, 478, 484} },
+    { 55, false, {80, 79, 79, 76, 65535, 65535}, {999, 999, 999, 999} },
+    { 56, false, {339, 79, 79, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 57, false, {79, 339, 80, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 58, false, {80, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 59, false, {80, 80, 65535, 65535, 65535, 65535}, {473, 477, 478, 484} },
+    { 60, false, {340, 80, 80, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 61, false, {76, 340, 76, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 62, false, {76, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 63, false, {76, 76, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 64, false, {87, 87, 65535, 65535, 65535, 65535}, {70, 85, 497, 102} },
+    { 65, false, {87, 87, 89, 65535, 65535, 65535}, {70, 85, 497, 102} },
+    { 66, false, {86, 65535, 65535, 65535, 65535, 65535}, {70, 85, 497, 102} },
+    { 67, false, {86, 87, 87, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 68, false, {87, 87, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 69, false, {87, 87, 87, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 70, false, {88, 65535, 65535, 65535, 65535, 65535}, {0, 0, 0, 0} },
+    { 71, false, {89, 89, 65535, 65535, 65535, 65535}, {70, 85, 497, 102} },
+    { 72, false, {86, 65535, 65535, 65535, 65535, 65535}, {70, 85, 497, 102} },
+    { 73, false, {86, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 74, false, {89, 89, 89, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 75, false, {90, 90, 90, 90, 90, 65535}, {70, 85, 497, 102} },
+    { 76, false, {90, 90, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 77, false, {90, 90, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 78, false, {90, 90, 90, 341, 65535, 65535}, {999, 999, 999, 999} },
+    { 79, false, {341, 90, 90, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 80, false, {87, 87, 341, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 81, false, {90, 90, 341, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 82, false, {87, 87, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 83, false, {87, 90, 90, 65535, 65535, 65535}, {70, 85, 497, 102} },
+    { 84, false, {98, 98, 98, 97, 96, 65535}, {999, 999, 999, 999} },
+    { 85, false, {98, 98, 98, 97, 96, 65535}, {0, 0, 0, 0} },
+    { 86, false, {98, 98, 98, 97, 96, 65535}, {999, 999, 999, 999} },
+    { 87, false, {98, 98, 98, 97, 96, 65535}, {999, 999, 999, 999} },
+    { 88, false, {101, 101, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 89, false, {104, 101, 101, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 90, false, {101, 101, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 91, false, {101, 101, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 92, false, {99, 99, 99, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 93, false, {99, 99, 99, 99, 65535, 65535}, {70, 85, 497, 102} },
+    { 94, false, {99, 99, 99, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 95, false, {113, 113, 65535, 65535, 65535, 65535}, {108, 109, 110, 136} },
+    { 96, false, {113, 113, 113, 115, 65535, 65535}, {999, 999, 999, 999} },
+    { 97, false, {115, 115, 115, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 98, false, {344, 115, 115, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 99, false, {113, 113, 344, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 100, false, {114, 114, 65535, 65535, 65535, 65535}, {113, 114, 492, 494} },
+    { 101, false, {114, 115, 115, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 102, false, {116, 65535, 65535, 65535, 65535, 65535}, {0, 0, 0, 0} },
+    { 103, false, {116, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 104, false, {115, 115, 343, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 105, false, {343, 116, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 106, false, {116, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 107, false, {115, 115, 115, 115, 65535, 65535}, {108, 109, 110, 136} },
+    { 108, false, {117, 65535, 65535, 65535, 65535, 65535}, {528, 534, 538, 115} },
+    { 109, false, {118, 118, 65535, 65535, 65535, 65535}, {528, 534, 538, 115} },
+    { 110, false, {117, 117, 65535, 65535, 65535, 65535}, {528, 534, 538, 115} },
+    { 111, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 112, false, {118, 118, 118, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 113, false, {118, 118, 118, 65535, 65535, 65535}, {529, 530, 532, 536} },
+    { 114, false, {118, 118, 65535, 65535, 65535, 65535}, {529, 530, 532, 536} },
+    { 115, false, {118, 119, 119, 65535, 65535, 65535}, {120, 125, 126, 129} },
+    { 116, false, {119, 119, 119, 119, 119, 119}, {999, 999, 999, 999} },
+    { 117, false, {115, 65535, 65535, 65535, 65535, 65535}, {113, 114, 492, 494} },
+    { 118, false, {115, 115, 65535, 65535, 65535, 65535}, {113, 114, 492, 494} },
+    { 119, false, {113, 113, 113, 115, 65535, 65535}, {113, 114, 492, 494} },
+    { 120, false, {132, 132, 132, 65535, 65535, 65535}, {124, 540, 543, 553} },
+    { 121, false, {130, 65535, 65535, 65535, 65535, 65535}, {542, 545, 548, 554} },
+    { 122, false, {133, 133, 65535, 65535, 65535, 65535}, {542, 545, 548, 554} },
+    { 123, false, {132, 132, 132, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 124, false, {129, 129, 129, 65535, 65535, 65535}, {144, 146, 148, 150} },
+    { 125, false, {130, 65535, 65535, 65535, 65535, 65535}, {124, 540, 543, 553} },
+    { 126, false, {131, 65535, 65535, 65535, 65535, 65535}, {124, 540, 543, 553} },
+    { 127, false, {129, 129, 130, 65535, 65535, 65535}, {542, 545, 548, 554} },
+    { 128, false, {133, 133, 133, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 129, false, {133, 133, 65535, 65535, 65535, 65535}, {124, 540, 543, 553} },
+    { 130, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 131, false, {129, 129, 129, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 132, false, {129, 129, 129, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 133, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 134, false, {120, 120, 65535, 65535, 65535, 65535}, {542, 545, 548, 554} },
+    { 135, false, {120, 120, 120, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 136, false, {120, 65535, 65535, 65535, 65535, 65535}, {528, 534, 538, 115} },
+    { 137, false, {120, 120, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 138, false, {120, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 139, false, {120, 120, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 140, false, {140, 140, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 141, false, {143, 140, 140, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 142, false, {143, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 143, false, {140, 140, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 144, false, {142, 142, 65535, 65535, 65535, 65535}, {569, 582, 589, 592} },
+    { 145, false, {144, 144, 144, 144, 143, 65535}, {568, 581, 584, 596} },
+    { 146, false, {144, 144, 144, 144, 144, 144}, {569, 582, 589, 592} },
+    { 147, false, {142, 142, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 148, false, {140, 140, 140, 65535, 65535, 65535}, {569, 582, 589, 592} },
+    { 149, false, {141, 141, 65535, 65535, 65535, 65535}, {568, 581, 584, 596} },
+    { 150, false, {140, 140, 141, 65535, 65535, 65535}, {569, 582, 589, 592} },
+    { 151, false, {140, 140, 141, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 152, false, {342, 143, 143, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 153, false, {161, 161, 342, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 154, false, {161, 161, 161, 161, 65535, 65535}, {999, 999, 999, 999} },
+    { 155, false, {143, 143, 143, 65535, 65535, 65535}, {568, 581, 584, 596} },
+    { 156, false, {342, 141, 161, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 157, false, {141, 141, 342, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 158, false, {141, 141, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 159, false, {141, 141, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 160, false, {171, 168, 168, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 161, false, {168, 168, 168, 168, 65535, 65535}, {999, 999, 999, 999} },
+    { 162, false, {347, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 163, false, {168, 168, 168, 347, 65535, 65535}, {999, 999, 999, 999} },
+    { 164, false, {169, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 165, false, {171, 171, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 166, false, {347, 171, 171, 171, 65535, 65535}, {999, 999, 999, 999} },
+    { 167, false, {347, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 168, false, {167, 167, 167, 167, 65535, 65535}, {999, 999, 999, 999} },
+    { 169, false, {170, 170, 167, 167, 167, 65535}, {999, 999, 999, 999} },
+    { 170, false, {171, 171, 171, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 171, false, {171, 170, 170, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 172, false, {167, 167, 167, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 173, false, {171, 171, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 174, false, {170, 170, 170, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 175, false, {171, 167, 170, 170, 65535, 65535}, {999, 999, 999, 999} },
+    { 176, false, {170, 170, 170, 170, 170, 65535}, {999, 999, 999, 999} },
+    { 177, false, {170, 170, 171, 65535, 65535, 65535}, {636, 640, 645, 651} },
+    { 178, false, {170, 170, 170, 171, 171, 65535}, {999, 999, 999, 999} },
+    { 179, false, {172, 65535, 65535, 65535, 65535, 65535}, {641, 642, 647, 650} },
+    { 180, false, {185, 65535, 65535, 65535, 65535, 65535}, {636, 640, 645, 651} },
+    { 181, false, {187, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 182, false, {187, 187, 65535, 65535, 65535, 65535}, {177, 180, 187, 189} },
+    { 183, false, {187, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 184, false, {185, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 185, false, {185, 185, 65535, 65535, 65535, 65535}, {641, 642, 647, 650} },
+    { 186, false, {188, 65535, 65535, 65535, 65535, 65535}, {641, 642, 647, 650} },
+    { 187, false, {188, 65535, 65535, 65535, 65535, 65535}, {636, 640, 645, 651} },
+    { 188, false, {124, 124, 124, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 189, false, {124, 124, 124, 124, 124, 65535}, {636, 640, 645, 651} },
+    { 190, false, {186, 186, 65535, 65535, 65535, 65535}, {641, 642, 647, 650} },
+    { 191, false, {124, 124, 124, 124, 65535, 65535}, {999, 999, 999, 999} },
+    { 192, false, {197, 65535, 65535, 65535, 65535, 65535}, {672, 692, 696, 210} },
+    { 193, false, {198, 199, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 194, false, {198, 199, 198, 199, 65535, 65535}, {672, 692, 696, 210} },
+    { 195, false, {198, 199, 198, 199, 65535, 65535}, {999, 999, 999, 999} },
+    { 196, false, {197, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 197, false, {211, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 198, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 199, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 200, false, {209, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 201, false, {209, 209, 65535, 65535, 65535, 65535}, {673, 674, 680, 694} },
+    { 202, false, {349, 209, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 203, false, {349, 209, 209, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 204, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 205, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 206, false, {349, 211, 209, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 207, false, {211, 211, 349, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 208, false, {207, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 209, false, {205, 205, 65535, 65535, 65535, 65535}, {673, 674, 680, 694} },
+    { 210, false, {209, 209, 209, 65535, 65535, 65535}, {705, 713, 727, 732} },
+    { 211, false, {209, 209, 209, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 212, false, {276, 65535, 65535, 65535, 65535, 65535}, {673, 674, 680, 694} },
+    { 213, false, {278, 278, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 214, false, {278, 350, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 215, false, {278, 278, 350, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 216, false, {277, 277, 277, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 217, false, {277, 277, 277, 277, 65535, 65535}, {999, 999, 999, 999} },
+    { 218, false, {350, 277, 277, 277, 65535, 65535}, {999, 999, 999, 999} },
+    { 219, false, {350, 277, 277, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 220, false, {278, 278, 278, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 221, false, {278, 278, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 222, false, {276, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 223, false, {278, 278, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 224, false, {279, 279, 279, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 225, false, {277, 277, 277, 277, 65535, 65535}, {999, 999, 999, 999} },
+    { 226, false, {277, 277, 277, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 227, false, {280, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 228, false, {337, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 229, false, {187, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 230, false, {187, 187, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 231, false, {185, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 232, false, {280, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 233, false, {188, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 234, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 235, false, {338, 338, 338, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 236, false, {338, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 237, false, {338, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 238, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 239, false, {338, 338, 338, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 240, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 241, false, {338, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 242, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 243, false, {338, 338, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 244, false, {133, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 245, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 246, false, {133, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 247, false, {133, 133, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 248, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 249, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 250, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 251, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 252, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 253, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 254, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 255, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 256, false, {364, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 257, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 258, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 259, false, {19, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 260, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 261, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 262, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 263, false, {99, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 264, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 265, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 266, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 267, false, {117, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 268, false, {353, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 269, false, {353, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 270, false, {354, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 271, false, {354, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 272, false, {355, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 273, false, {355, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 274, false, {356, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 275, false, {356, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 276, false, {357, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 277, false, {357, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 278, false, {358, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 279, false, {358, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 280, true, {333, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 281, true, {335, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 282, true, {335, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 283, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 284, true, {335, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 285, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 286, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 287, true, {336, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 288, true, {282, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 289, true, {283, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 290, true, {284, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 291, true, {284, 284, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 292, true, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 293, true, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 294, true, {334, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 295, false, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 296, false, {358, 358, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 297, false, {358, 358, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 298, false, {358, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 299, false, {90, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 300, true, {16, 16, 65535, 65535, 65535, 65535}, {300, 300, 300, 300} },
+    { 301, false, {16, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 302, false, {17, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 303, false, {16, 17, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 304, false, {17, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 305, false, {18, 18, 65535, 65535, 65535, 65535}, {360, 369, 376, 389} },
+    { 306, false, {16, 16, 18, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 307, false, {16, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 308, false, {18, 18, 20, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 309, false, {20, 20, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 310, false, {19, 19, 65535, 65535, 65535, 65535}, {360, 369, 376, 389} },
+    { 311, false, {20, 19, 20, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 312, false, {20, 20, 20, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 313, false, {19, 19, 19, 65535, 65535, 65535}, {360, 369, 376, 389} },
+    { 314, false, {18, 18, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 315, false, {19, 19, 19, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 316, false, {19, 19, 18, 18, 65535, 65535}, {999, 999, 999, 999} },
+    { 317, false, {19, 19, 18, 18, 18, 65535}, {999, 999, 999, 999} },
+    { 318, false, {19, 19, 19, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 319, false, {19, 19, 18, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 320, false, {21, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 321, false, {21, 19, 19, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 322, false, {19, 19, 21, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 323, false, {19, 19, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 324, true, {22, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 325, false, {17, 65535, 65535, 65535, 65535, 65535}, {360, 369, 376, 389} },
+    { 326, false, {17, 17, 65535, 65535, 65535, 65535}, {368, 377, 388, 395} },
+    { 327, false, {23, 65535, 65535, 65535, 65535, 65535}, {368, 377, 388, 395} },
+    { 328, false, {16, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 329, false, {16, 16, 16, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 330, false, {16, 16, 16, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 331, false, {26, 26, 65535, 65535, 65535, 65535}, {368, 377, 388, 395} },
+    { 332, false, {24, 24, 24, 24, 65535, 65535}, {999, 999, 999, 999} },
+    { 333, false, {23, 23, 23, 65535, 65535, 65535}, {368, 377, 388, 395} },
+    { 334, false, {23, 23, 23, 23, 65535, 65535}, {999, 999, 999, 999} },
+    { 335, false, {23, 23, 23, 23, 65535, 65535}, {999, 999, 999, 999} },
+    { 336, false, {23, 23, 26, 26, 65535, 65535}, {999, 999, 999, 999} },
+    { 337, false, {26, 26, 26, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 338, false, {26, 26, 26, 23, 23, 65535}, {999, 999, 999, 999} },
+    { 339, false, {23, 23, 23, 23, 65535, 65535}, {999, 999, 999, 999} },
+    { 340, false, {24, 24, 24, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 341, false, {24, 24, 27, 27, 65535, 65535}, {999, 999, 999, 999} },
+    { 342, false, {24, 27, 27, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 343, false, {26, 27, 27, 27, 65535, 65535}, {999, 999, 999, 999} },
+    { 344, false, {30, 30, 30, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 345, false, {32, 32, 32, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 346, false, {32, 32, 30, 30, 65535, 65535}, {999, 999, 999, 999} },
+    { 347, false, {31, 31, 30, 30, 65535, 65535}, {999, 999, 999, 999} },
+    { 348, false, {31, 31, 31, 31, 65535, 65535}, {999, 999, 999, 999} },
+    { 349, false, {30, 30, 32, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 350, false, {31, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 351, false, {31, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 352, false, {30, 29, 29, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 353, false, {29, 29, 32, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 354, false, {30, 30, 30, 30, 65535, 65535}, {999, 999, 999, 999} },
+    { 355, false, {29, 29, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 356, false, {32, 32, 32, 32, 32, 65535}, {999, 999, 999, 999} },
+    { 357, false, {29, 29, 31, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 358, false, {29, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 359, false, {31, 31, 31, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 360, false, {27, 27, 27, 65535, 65535, 65535}, {396, 398, 399, 400} },
+    { 361, false, {30, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 362, false, {31, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 363, false, {31, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 364, true, {33, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 365, false, {33, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 366, false, {33, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 367, true, {30, 30, 30, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 368, false, {28, 28, 28, 65535, 65535, 65535}, {397, 401, 404, 411} },
+    { 369, false, {28, 28, 65535, 65535, 65535, 65535}, {396, 398, 399, 400} },
+    { 370, false, {28, 28, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 371, false, {28, 28, 28, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 372, true, {16, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 373, true, {17, 17, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 374, false, {17, 16, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 375, true, {17, 17, 29, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 376, false, {25, 25, 65535, 65535, 65535, 65535}, {396, 398, 399, 400} },
+    { 377, false, {25, 28, 28, 65535, 65535, 65535}, {397, 401, 404, 411} },
+    { 378, false, {34, 34, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 379, false, {34, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 380, false, {44, 45, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 381, false, {25, 25, 25, 25, 65535, 65535}, {999, 999, 999, 999} },
+    { 382, false, {44, 45, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 383, false, {25, 25, 25, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 384, true, {35, 35, 35, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 385, true, {35, 35, 36, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 386, true, {37, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 387, true, {37, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 388, false, {39, 39, 39, 65535, 65535, 65535}, {397, 401, 404, 411} },
+    { 389, false, {38, 38, 39, 65535, 65535, 65535}, {396, 398, 399, 400} },
+    { 390, false, {38, 38, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 391, false, {38, 38, 38, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 392, false, {18, 18, 18, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 393, false, {17, 17, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 394, false, {18, 18, 18, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 395, false, {21, 65535, 65535, 65535, 65535, 65535}, {397, 401, 404, 411} },
+    { 396, false, {42, 42, 43, 65535, 65535, 65535}, {427, 436, 444, 449} },
+    { 397, false, {43, 43, 65535, 65535, 65535, 65535}, {425, 428, 438, 445} },
+    { 398, false, {41, 41, 41, 65535, 65535, 65535}, {427, 436, 444, 449} },
+    { 399, false, {41, 43, 41, 65535, 65535, 65535}, {427, 436, 444, 449} },
+    { 400, false, {40, 65535, 65535, 65535, 65535, 65535}, {427, 436, 444, 449} },
+    { 401, false, {43, 43, 43, 65535, 65535, 65535}, {425, 428, 438, 445} },
+    { 402, false, {41, 41, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 403, false, {41, 41, 41, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 404, false, {46, 47, 46, 47, 65535, 65535}, {425, 428, 438, 445} },
+    { 405, false, {46, 47, 46, 47, 46, 47}, {999, 999, 999, 999} },
+    { 406, false, {46, 47, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 407, false, {46, 47, 46, 47, 65535, 65535}, {999, 999, 999, 999} },
+    { 408, false, {46, 47, 46, 47, 65535, 65535}, {999, 999, 999, 999} },
+    { 409, false, {46, 47, 46, 47, 46, 47}, {999, 999, 999, 999} },
+    { 410, false, {46, 47, 46, 47, 65535, 65535}, {999, 999, 999, 999} },
+    { 411, false, {40, 65535, 65535, 65535, 65535, 65535}, {425, 428, 438, 445} },
+    { 412, true, {48, 49, 49, 49, 65535, 65535}, {999, 999, 999, 999} },
+    { 413, true, {48, 49, 49, 49, 65535, 65535}, {999, 999, 999, 999} },
+    { 414, true, {48, 49, 49, 49, 65535, 65535}, {999, 999, 999, 999} },
+    { 415, true, {60, 60, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 416, false, {60, 60, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 417, false, {60, 60, 60, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 418, false, {60, 60, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 419, false, {57, 58, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 420, false, {57, 58, 57, 58, 65535, 65535}, {999, 999, 999, 999} },
+    { 421, false, {57, 58, 57, 58, 57, 58}, {999, 999, 999, 999} },
+    { 422, false, {57, 58, 57, 58, 57, 58}, {999, 999, 999, 999} },
+    { 423, false, {57, 58, 57, 58, 65535, 65535}, {999, 999, 999, 999} },
+    { 424, false, {53, 54, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 425, false, {55, 65535, 65535, 65535, 65535, 65535}, {33, 48, 54, 59} },
+    { 426, false, {53, 54, 53, 54, 65535, 65535}, {999, 999, 999, 999} },
+    { 427, false, {55, 55, 65535, 65535, 65535, 65535}, {32, 44, 49, 53} },
+    { 428, false, {55, 55, 55, 65535, 65535, 65535}, {33, 48, 54, 59} },
+    { 429, false, {53, 54, 53, 54, 65535, 65535}, {999, 999, 999, 999} },
+    { 430, false, {55, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 431, false, {55, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 432, false, {50, 51, 52, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 433, false, {50, 51, 52, 50, 51, 52}, {999, 999, 999, 999} },
+    { 434, false, {50, 51, 52, 50, 51, 52}, {999, 999, 999, 999} },
+    { 435, false, {50, 51, 52, 50, 51, 52}, {999, 999, 999, 999} },
+    { 436, false, {59, 65535, 65535, 65535, 65535, 65535}, {32, 44, 49, 53} },
+    { 437, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 438, false, {59, 59, 65535, 65535, 65535, 65535}, {33, 48, 54, 59} },
+    { 439, false, {59, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 440, false, {56, 56, 56, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 441, false, {59, 59, 59, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 442, false, {59, 56, 56, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 443, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 444, false, {61, 61, 65535, 65535, 65535, 65535}, {32, 44, 49, 53} },
+    { 445, false, {61, 65535, 65535, 65535, 65535, 65535}, {33, 48, 54, 59} },
+    { 446, false, {62, 62, 62, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 447, false, {61, 62, 62, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 448, false, {63, 63, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 449, false, {62, 63, 65535, 65535, 65535, 65535}, {32, 44, 49, 53} },
+    { 450, false, {61, 61, 63, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 451, false, {63, 63, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 452, false, {63, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 453, false, {62, 62, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 454, false, {63, 63, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 455, false, {62, 62, 62, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 456, true, {65, 65, 65, 64, 65535, 65535}, {999, 999, 999, 999} },
+    { 457, false, {64, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 458, false, {64, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 459, false, {64, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 460, true, {66, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 461, true, {67, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 462, false, {66, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 463, false, {67, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 464, true, {68, 69, 70, 70, 65535, 65535}, {999, 999, 999, 999} },
+    { 465, true, {68, 69, 70, 70, 65535, 65535}, {999, 999, 999, 999} },
+    { 466, false, {68, 69, 70, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 467, false, {68, 69, 70, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 468, true, {71, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 469, false, {81, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 470, false, {81, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 471, false, {84, 84, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 472, false, {82, 82, 65535, 65535, 65535, 65535}, {64, 66, 75, 93} },
+    { 473, false, {82, 83, 83, 82, 83, 65535}, {65, 71, 72, 83} },
+    { 474, false, {85, 85, 85, 65535, 65535, 65535}, {64, 66, 75, 93} },
+    { 475, false, {83, 83, 83, 83, 65535, 65535}, {999, 999, 999, 999} },
+    { 476, false, {83, 83, 83, 84, 65535, 65535}, {64, 66, 75, 93} },
+    { 477, false, {85, 85, 85, 85, 65535, 65535}, {65, 71, 72, 83} },
+    { 478, false, {85, 85, 84, 83, 65535, 65535}, {65, 71, 72, 83} },
+    { 479, false, {83, 83, 83, 83, 83, 65535}, {64, 66, 75, 93} },
+    { 480, true, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999} },
+    { 481, false, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999} },
+    { 482, false, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999} },
+    { 483, false, {91, 92, 92, 92, 65535, 65535}, {999, 999, 999, 999} },
+    { 484, false, {93, 93, 93, 93, 65535, 65535}, {65, 71, 72, 83} },
+    { 485, false, {94, 94, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 486, false, {94, 94, 94, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 487, false, {93, 93, 93, 93, 65535, 65535}, {999, 999, 999, 999} },
+    { 488, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 489, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 490, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 491, true, {95, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 492, false, {101, 101, 101, 65535, 65535, 65535}, {529, 530, 532, 536} },
+    { 493, false, {100, 100, 100, 101, 65535, 65535}, {999, 999, 999, 999} },
+    { 494, false, {101, 100, 103, 65535, 65535, 65535}, {529, 530, 532, 536} },
+    { 495, false, {101, 101, 101, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 496, false, {102, 102, 102, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 497, false, {103, 103, 65535, 65535, 65535, 65535}, {0, 0, 0, 0} },
+    { 498, false, {102, 102, 102, 102, 65535, 65535}, {999, 999, 999, 999} },
+    { 499, false, {102, 103, 102, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 500, false, {105, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 501, false, {105, 105, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 502, false, {104, 102, 102, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 503, false, {104, 104, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 504, false, {101, 101, 101, 104, 65535, 65535}, {999, 999, 999, 999} },
+    { 505, false, {104, 104, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 506, false, {104, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 507, false, {101, 101, 101, 101, 101, 65535}, {999, 999, 999, 999} },
+    { 508, false, {100, 100, 100, 100, 100, 65535}, {999, 999, 999, 999} },
+    { 509, false, {101, 101, 103, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 510, false, {100, 100, 100, 101, 101, 65535}, {999, 999, 999, 999} },
+    { 511, false, {100, 100, 100, 100, 100, 65535}, {999, 999, 999, 999} },
+    { 512, false, {104, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 513, false, {105, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 514, false, {103, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 515, false, {104, 104, 104, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 516, false, {107, 108, 108, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 517, false, {107, 107, 108, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 518, false, {107, 107, 107, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 519, false, {108, 108, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 520, false, {107, 107, 107, 107, 65535, 65535}, {999, 999, 999, 999} },
+    { 521, false, {106, 106, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 522, false, {109, 109, 109, 109, 65535, 65535}, {999, 999, 999, 999} },
+    { 523, false, {106, 106, 109, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 524, false, {110, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 525, false, {109, 65535, 65535, 65535, 65535, 65535}, {108, 109, 110, 136} },
+    { 526, false, {109, 109, 65535, 65535, 65535, 65535}, {108, 109, 110, 136} },
+    { 527, true, {111, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 528, false, {125, 65535, 65535, 65535, 65535, 65535}, {120, 125, 126, 129} },
+    { 529, false, {119, 65535, 65535, 65535, 65535, 65535}, {121, 122, 127, 134} },
+    { 530, false, {125, 125, 65535, 65535, 65535, 65535}, {121, 122, 127, 134} },
+    { 531, false, {119, 119, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 532, false, {121, 122, 123, 65535, 65535, 65535}, {121, 122, 127, 134} },
+    { 533, false, {121, 122, 123, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 534, false, {121, 122, 123, 65535, 65535, 65535}, {120, 125, 126, 129} },
+    { 535, false, {121, 122, 123, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 536, false, {126, 65535, 65535, 65535, 65535, 65535}, {121, 122, 127, 134} },
+    { 537, false, {126, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 538, false, {126, 65535, 65535, 65535, 65535, 65535}, {120, 125, 126, 129} },
+    { 539, true, {127, 128, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 540, false, {136, 136, 136, 136, 65535, 65535}, {144, 146, 148, 150} },
+    { 541, false, {135, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 542, false, {136, 136, 135, 65535, 65535, 65535}, {145, 149, 155, 144} },
+    { 543, false, {135, 135, 135, 65535, 65535, 65535}, {144, 146, 148, 150} },
+    { 544, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 545, false, {136, 136, 136, 136, 136, 65535}, {145, 149, 155, 144} },
+    { 546, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 547, false, {134, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 548, false, {135, 136, 136, 136, 65535, 65535}, {145, 149, 155, 144} },
+    { 549, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 550, false, {135, 135, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 551, true, {137, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 552, false, {134, 134, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 553, true, {134, 134, 65535, 65535, 65535, 65535}, {144, 146, 148, 150} },
+    { 554, true, {134, 134, 134, 65535, 65535, 65535}, {145, 149, 155, 144} },
+    { 555, true, {138, 138, 139, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 556, false, {146, 146, 146, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 557, false, {146, 146, 146, 146, 65535, 65535}, {999, 999, 999, 999} },
+    { 558, false, {149, 150, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 559, false, {149, 150, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 560, false, {146, 146, 146, 146, 65535, 65535}, {999, 999, 999, 999} },
+    { 561, false, {145, 145, 146, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 562, false, {147, 147, 147, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 563, false, {147, 145, 145, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 564, false, {146, 146, 148, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 565, false, {146, 146, 145, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 566, false, {148, 148, 148, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 567, false, {148, 148, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 568, false, {148, 148, 148, 65535, 65535, 65535}, {558, 573, 591, 599} },
+    { 569, false, {148, 148, 148, 148, 65535, 65535}, {558, 573, 591, 599} },
+    { 570, false, {148, 148, 148, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 571, false, {148, 148, 148, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 572, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 573, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 574, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 575, false, {151, 152, 153, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 576, true, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 577, false, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 578, false, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 579, false, {154, 155, 156, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 580, false, {161, 161, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 581, false, {161, 161, 161, 65535, 65535, 65535}, {558, 573, 591, 599} },
+    { 582, false, {158, 161, 161, 65535, 65535, 65535}, {558, 573, 591, 599} },
+    { 583, false, {158, 158, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 584, false, {158, 158, 158, 65535, 65535, 65535}, {558, 573, 591, 599} },
+    { 585, false, {158, 158, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 586, false, {160, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 587, false, {158, 158, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 588, false, {159, 159, 158, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 589, false, {159, 159, 159, 65535, 65535, 65535}, {558, 573, 591, 599} },
+    { 590, false, {158, 158, 158, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 591, false, {160, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 592, false, {162, 159, 162, 65535, 65535, 65535}, {558, 573, 591, 599} },
+    { 593, false, {162, 162, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 594, false, {162, 162, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 595, true, {163, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 596, false, {161, 161, 161, 161, 161, 65535}, {558, 573, 591, 599} },
+    { 597, false, {159, 159, 159, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 598, false, {159, 159, 161, 161, 161, 65535}, {999, 999, 999, 999} },
+    { 599, false, {157, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 600, true, {164, 165, 166, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 601, true, {164, 165, 166, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 602, true, {164, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 603, false, {164, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 604, false, {168, 168, 168, 65535, 65535, 65535}, {179, 185, 186, 190} },
+    { 605, false, {170, 170, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 606, false, {176, 176, 170, 65535, 65535, 65535}, {179, 185, 186, 190} },
+    { 607, false, {168, 168, 168, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 608, false, {174, 170, 170, 170, 65535, 65535}, {999, 999, 999, 999} },
+    { 609, false, {174, 174, 65535, 65535, 65535, 65535}, {179, 185, 186, 190} },
+    { 610, false, {174, 174, 174, 65535, 65535, 65535}, {179, 185, 186, 190} },
+    { 611, false, {174, 174, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 612, false, {176, 176, 176, 175, 65535, 65535}, {999, 999, 999, 999} },
+    { 613, false, {175, 175, 65535, 65535, 65535, 65535}, {177, 180, 187, 189} },
+    { 614, false, {176, 176, 175, 65535, 65535, 65535}, {177, 180, 187, 189} },
+    { 615, false, {175, 175, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 616, false, {175, 175, 174, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 617, false, {175, 175, 175, 65535, 65535, 65535}, {177, 180, 187, 189} },
+    { 618, false, {174, 174, 175, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 619, true, {177, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 620, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 621, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 622, true, {173, 173, 173, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 623, true, {178, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 624, true, {179, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 625, true, {180, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 626, true, {181, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 627, false, {181, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 628, true, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 629, false, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 630, false, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 631, false, {182, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 632, false, {186, 186, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 633, false, {185, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 634, false, {186, 186, 189, 189, 65535, 65535}, {999, 999, 999, 999} },
+    { 635, false, {185, 189, 189, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 636, false, {191, 65535, 65535, 65535, 65535, 65535}, {661, 201, 209, 212} },
+    { 637, false, {186, 186, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 638, false, {186, 189, 189, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 639, false, {186, 186, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 640, false, {192, 192, 65535, 65535, 65535, 65535}, {661, 201, 209, 212} },
+    { 641, false, {191, 65535, 65535, 65535, 65535, 65535}, {192, 194, 656, 668} },
+    { 642, false, {192, 192, 192, 65535, 65535, 65535}, {192, 194, 656, 668} },
+    { 643, false, {191, 191, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 644, true, {195, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 645, true, {189, 189, 190, 65535, 65535, 65535}, {661, 201, 209, 212} },
+    { 646, true, {189, 189, 189, 190, 65535, 65535}, {999, 999, 999, 999} },
+    { 647, true, {189, 189, 189, 190, 65535, 65535}, {192, 194, 656, 668} },
+    { 648, true, {192, 192, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 649, true, {194, 194, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 650, true, {194, 194, 65535, 65535, 65535, 65535}, {192, 194, 656, 668} },
+    { 651, true, {194, 194, 65535, 65535, 65535, 65535}, {661, 201, 209, 212} },
+    { 652, true, {193, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 653, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 654, false, {56, 56, 56, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 655, false, {56, 56, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 656, false, {200, 201, 201, 201, 65535, 65535}, {672, 692, 696, 210} },
+    { 657, false, {201, 201, 201, 201, 65535, 65535}, {999, 999, 999, 999} },
+    { 658, false, {201, 201, 200, 200, 200, 65535}, {999, 999, 999, 999} },
+    { 659, false, {203, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 660, false, {200, 200, 200, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 661, false, {198, 199, 200, 200, 65535, 65535}, {673, 674, 680, 694} },
+    { 662, false, {198, 199, 198, 199, 65535, 65535}, {999, 999, 999, 999} },
+    { 663, false, {200, 200, 200, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 664, false, {202, 202, 202, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 665, false, {200, 200, 200, 203, 65535, 65535}, {999, 999, 999, 999} },
+    { 666, false, {200, 200, 200, 200, 65535, 65535}, {999, 999, 999, 999} },
+    { 667, false, {200, 203, 200, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 668, false, {204, 65535, 65535, 65535, 65535, 65535}, {672, 692, 696, 210} },
+    { 669, false, {203, 203, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 670, false, {203, 203, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 671, true, {196, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 672, false, {206, 206, 206, 65535, 65535, 65535}, {705, 713, 727, 732} },
+    { 673, false, {208, 208, 65535, 65535, 65535, 65535}, {700, 706, 711, 712} },
+    { 674, false, {206, 206, 208, 65535, 65535, 65535}, {700, 706, 711, 712} },
+    { 675, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 676, false, {208, 208, 208, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 677, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 678, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 679, true, {210, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 680, false, {207, 65535, 65535, 65535, 65535, 65535}, {700, 706, 711, 712} },
+    { 681, false, {203, 203, 203, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 682, false, {211, 211, 211, 211, 65535, 65535}, {999, 999, 999, 999} },
+    { 683, false, {203, 203, 203, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 684, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 685, false, {205, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 686, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 687, false, {210, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 688, false, {205, 205, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 689, false, {211, 211, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 690, false, {211, 210, 211, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 691, false, {211, 211, 211, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 692, false, {207, 207, 65535, 65535, 65535, 65535}, {705, 713, 727, 732} },
+    { 693, false, {211, 211, 211, 211, 65535, 65535}, {999, 999, 999, 999} },
+    { 694, false, {210, 207, 65535, 65535, 65535, 65535}, {700, 706, 711, 712} },
+    { 695, false, {210, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 696, false, {212, 213, 214, 65535, 65535, 65535}, {705, 713, 727, 732} },
+    { 697, false, {212, 213, 214, 212, 213, 214}, {999, 999, 999, 999} },
+    { 698, false, {212, 213, 214, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 699, false, {212, 213, 214, 212, 213, 214}, {999, 999, 999, 999} },
+    { 700, false, {218, 218, 218, 65535, 65535, 65535}, {724, 730, 733, 956} },
+    { 701, false, {215, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 702, false, {220, 220, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 703, false, {218, 218, 220, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 704, false, {218, 218, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 705, false, {219, 65535, 65535, 65535, 65535, 65535}, {701, 714, 721, 731} },
+    { 706, false, {218, 220, 218, 65535, 65535, 65535}, {724, 730, 733, 956} },
+    { 707, false, {220, 220, 220, 220, 65535, 65535}, {999, 999, 999, 999} },
+    { 708, false, {221, 221, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 709, false, {219, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 710, false, {221, 221, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 711, false, {221, 221, 221, 65535, 65535, 65535}, {724, 730, 733, 956} },
+    { 712, false, {222, 222, 65535, 65535, 65535, 65535}, {724, 730, 733, 956} },
+    { 713, false, {222, 218, 218, 65535, 65535, 65535}, {701, 714, 721, 731} },
+    { 714, false, {216, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 715, false, {222, 222, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 716, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999} },
+    { 717, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999} },
+    { 718, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999} },
+    { 719, false, {221, 221, 221, 221, 217, 65535}, {999, 999, 999, 999} },
+    { 720, false, {224, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 721, false, {223, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 722, false, {224, 224, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 723, false, {224, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 724, false, {225, 225, 225, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 725, false, {227, 227, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 726, false, {226, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 727, false, {225, 225, 227, 65535, 65535, 65535}, {701, 714, 721, 731} },
+    { 728, false, {225, 225, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 729, false, {230, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 730, false, {230, 230, 65535, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 731, false, {231, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 732, false, {226, 230, 230, 65535, 65535, 65535}, {701, 714, 721, 731} },
+    { 733, false, {226, 226, 65535, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 734, false, {230, 230, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 735, false, {230, 230, 230, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 736, false, {232, 232, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 737, false, {225, 225, 232, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 738, false, {233, 65535, 65535, 65535, 65535, 65535}, {804, 227, 795, 765} },
+    { 739, false, {233, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 740, true, {228, 229, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 741, false, {228, 229, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 742, false, {228, 229, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 743, true, {234, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 744, false, {235, 236, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 745, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 746, false, {237, 235, 236, 237, 65535, 65535}, {999, 999, 999, 999} },
+    { 747, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 748, false, {239, 239, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 749, false, {239, 239, 239, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 750, false, {238, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 751, false, {239, 239, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 752, false, {238, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 753, false, {238, 238, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 754, false, {239, 239, 237, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 755, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 756, false, {243, 244, 245, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 757, false, {243, 244, 245, 243, 244, 245}, {999, 999, 999, 999} },
+    { 758, false, {243, 244, 245, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 759, false, {243, 244, 245, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 760, false, {237, 237, 237, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 761, false, {237, 237, 237, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 762, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 763, true, {249, 249, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 764, false, {248, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 765, false, {246, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 766, false, {247, 247, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 767, false, {247, 247, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 768, true, {249, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 769, true, {249, 249, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 770, true, {249, 249, 249, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 771, true, {251, 251, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 772, false, {252, 257, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 773, false, {253, 253, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 774, false, {253, 252, 252, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 775, false, {257, 252, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 776, false, {254, 255, 256, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 777, false, {254, 255, 256, 254, 255, 256}, {999, 999, 999, 999} },
+    { 778, false, {254, 255, 256, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 779, false, {254, 255, 256, 254, 255, 256}, {999, 999, 999, 999} },
+    { 780, true, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 781, false, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 782, false, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 783, false, {258, 259, 260, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 784, true, {249, 249, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 785, true, {249, 249, 249, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 786, true, {249, 249, 250, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 787, false, {250, 250, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 788, false, {261, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 789, false, {263, 263, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 790, false, {262, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 791, false, {262, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 792, false, {261, 261, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 793, false, {261, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 794, false, {261, 261, 261, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 795, true, {264, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 796, false, {269, 269, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 797, false, {269, 270, 270, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 798, false, {270, 270, 270, 270, 65535, 65535}, {999, 999, 999, 999} },
+    { 799, false, {270, 270, 269, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 800, false, {271, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 801, false, {272, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 802, false, {273, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 803, false, {271, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 804, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 805, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 806, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 807, true, {274, 275, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 808, true, {265, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 809, true, {265, 265, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 810, true, {266, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 811, true, {267, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 812, true, {173, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 813, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 814, false, {173, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 815, false, {173, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 816, true, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 817, true, {173, 173, 252, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 818, true, {173, 173, 281, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 819, true, {252, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 820, false, {286, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 821, false, {286, 286, 286, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 822, false, {287, 288, 287, 288, 287, 288}, {999, 999, 999, 999} },
+    { 823, false, {287, 288, 287, 288, 287, 288}, {999, 999, 999, 999} },
+    { 824, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 825, false, {289, 289, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 826, false, {289, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 827, false, {286, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 828, false, {286, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 829, false, {286, 286, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 830, false, {289, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 831, false, {290, 290, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 832, false, {290, 290, 290, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 833, false, {290, 290, 289, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 834, false, {290, 290, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 835, false, {289, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 836, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999} },
+    { 837, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999} },
+    { 838, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999} },
+    { 839, false, {291, 292, 292, 293, 65535, 65535}, {999, 999, 999, 999} },
+    { 840, true, {296, 297, 298, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 841, false, {296, 297, 298, 296, 65535, 65535}, {999, 999, 999, 999} },
+    { 842, false, {296, 297, 298, 296, 65535, 65535}, {999, 999, 999, 999} },
+    { 843, false, {296, 297, 298, 296, 65535, 65535}, {999, 999, 999, 999} },
+    { 844, true, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 845, false, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 846, false, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 847, false, {299, 300, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 848, false, {301, 301, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 849, false, {302, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 850, false, {301, 301, 301, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 851, false, {301, 301, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 852, false, {304, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 853, false, {301, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 854, false, {301, 301, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 855, false, {267, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 856, true, {362, 363, 305, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 857, false, {362, 363, 305, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 858, false, {362, 363, 305, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 859, false, {305, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 860, true, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 861, false, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 862, false, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 863, false, {306, 307, 308, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 864, true, {309, 309, 309, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 865, false, {309, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 866, false, {309, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 867, false, {309, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 868, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 869, false, {294, 295, 294, 295, 65535, 65535}, {999, 999, 999, 999} },
+    { 870, false, {322, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 871, false, {322, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 872, false, {317, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 873, false, {321, 321, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 874, false, {321, 321, 321, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 875, false, {321, 321, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 876, false, {318, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 877, false, {323, 323, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 878, false, {318, 321, 321, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 879, false, {321, 321, 321, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 880, false, {215, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 881, false, {315, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 882, false, {323, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 883, false, {323, 323, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 884, false, {311, 312, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 885, false, {310, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 886, false, {310, 310, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 887, false, {310, 310, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 888, false, {314, 314, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 889, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 890, false, {319, 319, 319, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 891, false, {317, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 892, false, {313, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 893, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 894, false, {316, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 895, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 896, false, {317, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 897, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 898, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 899, false, {294, 295, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 900, false, {320, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 901, false, {315, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 902, false, {314, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 903, false, {315, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 904, false, {323, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 905, false, {323, 323, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 906, false, {323, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 907, false, {311, 312, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 908, true, {324, 324, 324, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 909, false, {324, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 910, false, {324, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 911, false, {324, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 912, true, {325, 325, 325, 325, 325, 65535}, {999, 999, 999, 999} },
+    { 913, true, {325, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 914, true, {325, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 915, true, {325, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 916, true, {326, 326, 326, 326, 326, 65535}, {999, 999, 999, 999} },
+    { 917, true, {326, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 918, true, {326, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 919, true, {326, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 920, true, {330, 330, 330, 330, 330, 330}, {999, 999, 999, 999} },
+    { 921, true, {330, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 922, true, {330, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 923, true, {330, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 924, true, {331, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 925, true, {332, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 926, true, {331, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 927, true, {332, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 928, true, {327, 327, 327, 327, 327, 65535}, {999, 999, 999, 999} },
+    { 929, true, {327, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 930, true, {327, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 931, true, {327, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 932, true, {328, 328, 328, 328, 328, 65535}, {999, 999, 999, 999} },
+    { 933, true, {328, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 934, true, {328, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 935, true, {328, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 936, true, {329, 329, 329, 329, 329, 329}, {999, 999, 999, 999} },
+    { 937, true, {329, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 938, true, {329, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 939, true, {329, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 940, false, {237, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 941, false, {235, 236, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 942, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 943, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 944, false, {237, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 945, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 946, false, {237, 237, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 947, false, {173, 173, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 948, false, {240, 241, 242, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 949, false, {240, 241, 242, 240, 241, 242}, {999, 999, 999, 999} },
+    { 950, false, {240, 241, 242, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 951, false, {240, 241, 242, 240, 241, 242}, {999, 999, 999, 999} },
+    { 960, false, {280, 65535, 65535, 65535, 65535, 65535}, {961, 961, 961, 961} },
+    { 961, true, {264, 65535, 65535, 65535, 65535, 65535}, {962, 962, 962, 962} },
+    { 962, false, {272, 65535, 65535, 65535, 65535, 65535}, {964, 964, 964, 964} },
+    { 963, false, {272, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 964, false, {268, 65535, 65535, 65535, 65535, 65535}, {965, 965, 965, 965} },
+    { 965, true, {266, 65535, 65535, 65535, 65535, 65535}, {968, 968, 968, 968} },
+    { 966, true, {266, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 967, false, {268, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 968, false, {285, 65535, 65535, 65535, 65535, 65535}, {972, 972, 972, 972} },
+    { 969, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 970, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 971, false, {285, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 972, false, {304, 65535, 65535, 65535, 65535, 65535}, {973, 973, 973, 973} },
+    { 973, true, {299, 300, 65535, 65535, 65535, 65535}, {0, 0, 0, 0} },
+    { 974, false, {304, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 975, false, {304, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 976, false, {262, 262, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 977, false, {261, 261, 263, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 978, false, {262, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 979, false, {262, 262, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 980, true, {10, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 981, true, {10, 65535, 65535, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 982, false, {11, 12, 12, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 983, false, {11, 12, 12, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 984, false, {13, 14, 15, 15, 15, 15}, {999, 999, 999, 999} },
+    { 985, false, {13, 14, 15, 15, 15, 15}, {999, 999, 999, 999} },
+    { 986, false, {13, 14, 15, 15, 15, 15}, {999, 999, 999, 999} },
+    { 987, false, {15, 15, 15, 15, 65535, 65535}, {999, 999, 999, 999} },
+    { 992, false, {102, 102, 102, 65535, 65535, 65535}, {999, 999, 999, 999} },
+    { 993, false, {103, 103, 65535, 65535, 65535, 65535}, {0, 0, 0, 0} },
+    { 994, false, {102, 102, 102, 102, 65535, 65535}, {999, 999, 999, 999} },
+    { 995, false, {102, 103, 102, 65535, 65535, 65535}, {999, 999, 999, 999} },
+};
+
+static constexpr BattleScene battleSceneTable[] = {
+    { 7, {19, 65535, 65535}, {7, 255, 255}, { battleFormations + 0, 4 } },
+    { 8, {72, 73, 74}, {13, 15, 10}, { battleFormations + 4, 4 } },
+    { 9, {73, 74, 75}, {15, 10, 12}, { battleFormations + 8, 4 } },
+    { 10, {72, 74, 75}, {13, 10, 12}, { battleFormations + 12, 4 } },
+    { 11, {74, 75, 65535}, {10, 12, 255}, { battleFormations + 16, 4 } },
+    { 12, {77, 78, 80}, {12, 255, 14}, { battleFormations + 20, 4 } },
+    { 13, {76, 79, 80}, {14, 10, 14}, { battleFormations + 24, 4 } },
+    { 14, {79, 80, 339}, {10, 14, 13}, { battleFormations + 28, 4 } },
+    { 15, {76, 80, 340}, {14, 14, 16}, { battleFormations + 32, 4 } },
+    { 16, {86, 87, 89}, {17, 16, 16}, { battleFormations + 36, 4 } },
+    { 17, {87, 88, 89}, {16, 18, 16}, { battleFormations + 40, 4 } },
+    { 18, {86, 89, 90}, {17, 16, 15}, { battleFormations + 44, 4 } },
+    { 19, {90, 341, 65535}, {15, 19, 255}, { battleFormations + 48, 4 } },
+    { 20, {87, 90, 341}, {16, 15, 19}, { battleFormations + 52, 4 } },
+    { 21, {96, 97, 98}, {16, 15, 14}, { battleFormations + 56, 4 } },
+    { 22, {101, 104, 65535}, {17, 17, 255}, { battleFormations + 60, 4 } },
+    { 23, {99, 113, 65535}, {16, 17, 255}, { battleFormations + 64, 4 } },
+    { 24, {113, 115, 344}, {17, 18, 29}, { battleFormations + 68, 4 } },
+    { 25, {114, 115, 116}, {18, 18, 18}, { battleFormations + 72, 4 } },
+    { 26, {115, 116, 343}, {18, 18, 22}, { battleFormations + 76, 4 } },
+    { 27, {117, 118, 65535}, {19, 19, 255}, { battleFormations + 80, 4 } },
+    { 28, {118, 119, 65535}, {19, 18, 255}, { battleFormations + 84, 4 } },
+    { 29, {113, 115, 119}, {17, 18, 18}, { battleFormations + 88, 4 } },
+    { 30, {130, 132, 133}, {21, 19, 20}, { battleFormations + 92, 4 } },
+    { 31, {129, 130, 131}, {20, 21, 24}, { battleFormations + 96, 4 } },
+    { 32, {129, 133, 65535}, {20, 20, 255}, { battleFormations + 100, 4 } },
+    { 33, {120, 129, 133}, {20, 20, 20}, { battleFormations + 104, 4 } },
+    { 34, {120, 65535, 65535}, {20, 255, 255}, { battleFormations + 108, 4 } },
+    { 35, {140, 143, 65535}, {23, 24, 255}, { battleFormations + 112, 4 } },
+    { 36, {142, 143, 144}, {23, 24, 24}, { battleFormations + 116, 4 } },
+    { 37, {140, 141, 65535}, {23, 26, 255}, { battleFormations + 120, 4 } },
+    { 38, {143, 161, 342}, {24, 24, 22}, { battleFormations + 124, 4 } },
+    { 39, {141, 161, 342}, {26, 24, 22}, { battleFormations + 128, 4 } },
+    { 40, {168, 171, 347}, {27, 28, 30}, { battleFormations + 132, 4 } },
+    { 41, {169, 171, 347}, {27, 28, 30}, { battleFormations + 136, 4 } },
+    { 42, {167, 170, 171}, {28, 28, 28}, { battleFormations + 140, 4 } },
+    { 43, {167, 170, 171}, {28, 28, 28}, { battleFormations + 144, 4 } },
+    { 44, {170, 171, 172}, {28, 28, 30}, { battleFormations + 148, 4 } },
+    { 45, {185, 187, 65535}, {29, 30, 255}, { battleFormations + 152, 4 } },
+    { 46, {185, 188, 65535}, {29, 30, 255}, { battleFormations + 156, 4 } },
+    { 47, {124, 186, 65535}, {29, 30, 255}, { battleFormations + 160, 4 } },
+    { 48, {197, 198, 199}, {33, 24, 255}, { battleFormations + 164, 4 } },
+    { 49, {197, 211, 65535}, {33, 30, 255}, { battleFormations + 168, 4 } },
+    { 50, {209, 349, 65535}, {24, 33, 255}, { battleFormations + 172, 4 } },
+    { 51, {209, 211, 349}, {24, 30, 33}, { battleFormations + 176, 4 } },
+    { 52, {205, 207, 209}, {40, 34, 24}, { battleFormations + 180, 4 } },
+    { 53, {276, 278, 350}, {37, 39, 36}, { battleFormations + 184, 4 } },
+    { 54, {277, 350, 65535}, {30, 36, 255}, { battleFormations + 188, 4 } },
+    { 55, {276, 278, 65535}, {37, 39, 255}, { battleFormations + 192, 4 } },
+    { 56, {277, 279, 280}, {30, 37, 22}, { battleFormations + 196, 4 } },
+    { 57, {185, 187, 337}, {29, 30, 40}, { battleFormations + 200, 4 } },
+    { 58, {188, 280, 338}, {30, 22, 40}, { battleFormations + 204, 4 } },
+    { 59, {338, 65535, 65535}, {40, 255, 255}, { battleFormations + 208, 4 } },
+    { 60, {338, 65535, 65535}, {40, 255, 255}, { battleFormations + 212, 4 } },
+    { 61, {133, 65535, 65535}, {20, 255, 255}, { battleFormations + 216, 4 } },
+    { 62, {19, 65535, 65535}, {7, 255, 255}, { battleFormations + 220, 4 } },
+    { 63, {19, 65535, 65535}, {7, 255, 255}, { battleFormations + 224, 4 } },
+    { 64, {19, 364, 65535}, {7, 20, 255}, { battleFormations + 228, 4 } },
+    { 65, {99, 65535, 65535}, {16, 255, 255}, { battleFormations + 232, 4 } },
+    { 66, {117, 65535, 65535}, {19, 255, 255}, { battleFormations + 236, 4 } },
+    { 67, {353, 354, 65535}, {17, 22, 255}, { battleFormations + 240, 4 } },
+    { 68, {355, 356, 65535}, {27, 32, 255}, { battleFormations + 244, 4 } },
+    { 69, {357, 358, 65535}, {37, 42, 255}, { battleFormations + 248, 4 } },
+    { 70, {333, 334, 335}, {61, 61, 61}, { battleFormations + 252, 4 } },
+    { 71, {334, 335, 336}, {61, 61, 61}, { battleFormations + 256, 4 } },
+    { 72, {282, 283, 284}, {19, 25, 37}, { battleFormations + 260, 4 } },
+    { 73, {157, 334, 65535}, {32, 61, 255}, { battleFormations + 264, 4 } },
+    { 74, {90, 358, 65535}, {15, 42, 255}, { battleFormations + 268, 4 } },
+    { 75, {16, 17, 65535}, {2, 3, 255}, { battleFormations + 272, 4 } },
+    { 76, {16, 17, 18}, {2, 3, 2}, { battleFormations + 276, 4 } },
+    { 77, {18, 19, 20}, {2, 7, 4}, { battleFormations + 280, 4 } },
+    { 78, {18, 19, 20}, {2, 7, 4}, { battleFormations + 284, 4 } },
+    { 79, {18, 19, 65535}, {2, 7, 255}, { battleFormations + 288, 4 } },
+    { 80, {19, 21, 65535}, {7, 8, 255}, { battleFormations + 292, 4 } },
+    { 81, {17, 22, 23}, {3, 12, 8}, { battleFormations + 296, 4 } },
+    { 82, {16, 26, 65535}, {2, 6, 255}, { battleFormations + 300, 4 } },
+    { 83, {23, 24, 65535}, {8, 5, 255}, { battleFormations + 304, 4 } },
+    { 84, {23, 26, 65535}, {8, 6, 255}, { battleFormations + 308, 4 } },
+    { 85, {24, 26, 27}, {5, 6, 4}, { battleFormations + 312, 4 } },
+    { 86, {30, 31, 32}, {9, 8, 4}, { battleFormations + 316, 4 } },
+    { 87, {30, 31, 32}, {9, 8, 4}, { battleFormations + 320, 4 } },
+    { 88, {29, 30, 32}, {8, 9, 4}, { battleFormations + 324, 4 } },
+    { 89, {29, 31, 32}, {8, 8, 4}, { battleFormations + 328, 4 } },
+    { 90, {27, 30, 31}, {4, 9, 8}, { battleFormations + 332, 4 } },
+    { 91, {30, 33, 65535}, {9, 15, 255}, { battleFormations + 336, 4 } },
+    { 92, {28, 65535, 65535}, {6, 255, 255}, { battleFormations + 340, 4 } },
+    { 93, {16, 17, 29}, {2, 3, 8}, { battleFormations + 344, 4 } },
+    { 94, {25, 28, 34}, {9, 6, 7}, { battleFormations + 348, 4 } },
+    { 95, {25, 44, 45}, {9, 11, 11}, { battleFormations + 352, 4 } },
+    { 96, {35, 36, 37}, {8, 11, 18}, { battleFormations + 356, 4 } },
+    { 97, {38, 39, 65535}, {10, 8, 255}, { battleFormations + 360, 4 } },
+    { 98, {17, 18, 21}, {3, 2, 8}, { battleFormations + 364, 4 } },
+    { 99, {41, 42, 43}, {10, 8, 10}, { battleFormations + 368, 4 } },
+    { 100, {40, 41, 43}, {12, 10, 10}, { battleFormations + 372, 4 } },
+    { 101, {46, 47, 65535}, {11, 11, 255}, { battleFormations + 376, 4 } },
+    { 102, {40, 46, 47}, {12, 11, 11}, { battleFormations + 380, 4 } },
+    { 103, {48, 49, 60}, {17, 2, 10}, { battleFormations + 384, 4 } },
+    { 104, {57, 58, 60}, {12, 12, 10}, { battleFormations + 388, 4 } },
+    { 105, {57, 58, 65535}, {12, 12, 255}, { battleFormations + 392, 4 } },
+    { 106, {53, 54, 55}, {12, 255, 11}, { battleFormations + 396, 4 } },
+    { 107, {53, 54, 55}, {12, 255, 11}, { battleFormations + 400, 4 } },
+    { 108, {50, 51, 52}, {12, 8, 8}, { battleFormations + 404, 4 } },
+    { 109, {56, 59, 65535}, {13, 13, 255}, { battleFormations + 408, 4 } },
+    { 110, {56, 59, 65535}, {13, 13, 255}, { battleFormations + 412, 4 } },
+    { 111, {61, 62, 65535}, {15, 9, 255}, { battleFormations + 416, 4 } },
+    { 112, {61, 62, 63}, {15, 9, 14}, { battleFormations + 420, 4 } },
+    { 113, {62, 63, 65535}, {9, 14, 255}, { battleFormations + 424, 4 } },
+    { 114, {64, 65, 65535}, {19, 7, 255}, { battleFormations + 428, 4 } },
+    { 115, {66, 67, 65535}, {18, 19, 255}, { battleFormations + 432, 4 } },
+    { 116, {68, 69, 70}, {21, 18, 255}, { battleFormations + 436, 4 } },
+    { 117, {71, 81, 84}, {19, 26, 18}, { battleFormations + 440, 4 } },
+    { 118, {82, 83, 85}, {16, 15, 15}, { battleFormations + 444, 4 } },
+    { 119, {83, 84, 85}, {15, 18, 15}, { battleFormations + 448, 4 } },
+    { 120, {91, 92, 65535}, {23, 4, 255}, { battleFormations + 452, 4 } },
+    { 121, {93, 94, 65535}, {15, 16, 255}, { battleFormations + 456, 4 } },
+    { 122, {95, 65535, 65535}, {25, 255, 255}, { battleFormations + 460, 4 } },
+    { 123, {100, 101, 103}, {16, 17, 16}, { battleFormations + 464, 4 } },
+    { 124, {102, 103, 65535}, {18, 16, 255}, { battleFormations + 468, 4 } },
+    { 125, {102, 104, 105}, {18, 17, 18}, { battleFormations + 472, 4 } },
+    { 126, {101, 104, 65535}, {17, 17, 255}, { battleFormations + 476, 4 } },
+    { 127, {100, 101, 103}, {16, 17, 16}, { battleFormations + 480, 4 } },
+    { 128, {103, 104, 105}, {16, 17, 18}, { battleFormations + 484, 4 } },
+    { 129, {107, 108, 65535}, {18, 17, 255}, { battleFormations + 488, 4 } },
+    { 130, {106, 107, 109}, {19, 18, 19}, { battleFormations + 492, 4 } },
+    { 131, {109, 110, 111}, {19, 22, 23}, { battleFormations + 496, 4 } },
+    { 132, {119, 125, 65535}, {18, 19, 255}, { battleFormations + 500, 4 } },
+    { 133, {121, 122, 123}, {19, 19, 19}, { battleFormations + 504, 4 } },
+    { 134, {126, 127, 128}, {21, 22, 23}, { battleFormations + 508, 4 } },
+    { 135, {135, 136, 65535}, {21, 22, 255}, { battleFormations + 512, 4 } },
+    { 136, {134, 135, 136}, {23, 21, 22}, { battleFormations + 516, 4 } },
+    { 137, {135, 136, 137}, {21, 22, 25}, { battleFormations + 520, 4 } },
+    { 138, {134, 138, 139}, {23, 21, 29}, { battleFormations + 524, 4 } },
+    { 139, {146, 149, 150}, {23, 26, 1}, { battleFormations + 528, 4 } },
+    { 140, {145, 146, 147}, {24, 23, 25}, { battleFormations + 532, 4 } },
+    { 141, {145, 146, 148}, {24, 23, 25}, { battleFormations + 536, 4 } },
+    { 142, {148, 65535, 65535}, {25, 255, 255}, { battleFormations + 540, 4 } },
+    { 143, {151, 152, 153}, {24, 24, 24}, { battleFormations + 544, 4 } },
+    { 144, {154, 155, 156}, {35, 35, 35}, { battleFormations + 548, 4 } },
+    { 145, {158, 161, 65535}, {26, 24, 255}, { battleFormations + 552, 4 } },
+    { 146, {158, 160, 65535}, {26, 27, 255}, { battleFormations + 556, 4 } },
+    { 147, {158, 159, 160}, {26, 25, 27}, { battleFormations + 560, 4 } },
+    { 148, {159, 162, 163}, {25, 26, 38}, { battleFormations + 564, 4 } },
+    { 149, {157, 159, 161}, {32, 25, 24}, { battleFormations + 568, 4 } },
+    { 150, {164, 165, 166}, {38, 255, 255}, { battleFormations + 572, 4 } },
+    { 151, {168, 170, 176}, {27, 28, 28}, { battleFormations + 576, 4 } },
+    { 152, {170, 174, 65535}, {28, 27, 255}, { battleFormations + 580, 4 } },
+    { 153, {175, 176, 65535}, {29, 28, 255}, { battleFormations + 584, 4 } },
+    { 154, {174, 175, 177}, {27, 29, 39}, { battleFormations + 588, 4 } },
+    { 155, {173, 178, 65535}, {34, 30, 255}, { battleFormations + 592, 4 } },
+    { 156, {179, 180, 181}, {32, 34, 36}, { battleFormations + 596, 4 } },
+    { 157, {182, 65535, 65535}, {41, 255, 255}, { battleFormations + 600, 4 } },
+    { 158, {185, 186, 189}, {29, 30, 26}, { battleFormations + 604, 4 } },
+    { 159, {186, 189, 191}, {30, 26, 35}, { battleFormations + 608, 4 } },
+    { 160, {191, 192, 65535}, {35, 34, 255}, { battleFormations + 612, 4 } },
+    { 161, {189, 190, 195}, {26, 24, 45}, { battleFormations + 616, 4 } },
+    { 162, {192, 194, 65535}, {34, 30, 255}, { battleFormations + 620, 4 } },
+    { 163, {56, 193, 65535}, {13, 39, 255}, { battleFormations + 624, 4 } },
+    { 164, {200, 201, 203}, {27, 32, 33}, { battleFormations + 628, 4 } },
+    { 165, {198, 199, 200}, {24, 255, 27}, { battleFormations + 632, 4 } },
+    { 166, {200, 202, 203}, {27, 31, 33}, { battleFormations + 636, 4 } },
+    { 167, {196, 203, 204}, {50, 33, 35}, { battleFormations + 640, 4 } },
+    { 168, {206, 208, 211}, {32, 28, 30}, { battleFormations + 644, 4 } },
+    { 169, {208, 210, 211}, {28, 32, 30}, { battleFormations + 648, 4 } },
+    { 170, {203, 207, 211}, {33, 34, 30}, { battleFormations + 652, 4 } },
+    { 171, {205, 210, 211}, {40, 32, 30}, { battleFormations + 656, 4 } },
+    { 172, {205, 210, 211}, {40, 32, 30}, { battleFormations + 660, 4 } },
+    { 173, {207, 210, 211}, {34, 32, 30}, { battleFormations + 664, 4 } },
+    { 174, {212, 213, 214}, {35, 255, 255}, { battleFormations + 668, 4 } },
+    { 175, {215, 218, 220}, {44, 35, 30}, { battleFormations + 672, 4 } },
+    { 176, {218, 219, 220}, {35, 40, 30}, { battleFormations + 676, 4 } },
+    { 177, {219, 221, 65535}, {40, 28, 255}, { battleFormations + 680, 4 } },
+    { 178, {216, 218, 222}, {41, 35, 33}, { battleFormations + 684, 4 } },
+    { 179, {217, 221, 65535}, {30, 28, 255}, { battleFormations + 688, 4 } },
+    { 180, {223, 224, 65535}, {40, 32, 255}, { battleFormations + 692, 4 } },
+    { 181, {225, 226, 227}, {36, 30, 32}, { battleFormations + 696, 4 } },
+    { 182, {225, 230, 231}, {36, 36, 35}, { battleFormations + 700, 4 } },
+    { 183, {226, 230, 65535}, {30, 36, 255}, { battleFormations + 704, 4 } },
+    { 184, {225, 232, 233}, {36, 30, 25}, { battleFormations + 708, 4 } },
+    { 185, {228, 229, 234}, {43, 43, 55}, { battleFormations + 712, 4 } },
+    { 186, {235, 236, 237}, {38, 1, 35}, { battleFormations + 716, 4 } },
+    { 187, {238, 239, 65535}, {35, 37, 255}, { battleFormations + 720, 4 } },
+    { 188, {237, 238, 239}, {35, 35, 37}, { battleFormations + 724, 4 } },
+    { 189, {243, 244, 245}, {35, 20, 20}, { battleFormations + 728, 4 } },
+    { 190, {237, 249, 65535}, {35, 32, 255}, { battleFormations + 732, 4 } },
+    { 191, {246, 247, 248}, {44, 36, 38}, { battleFormations + 736, 4 } },
+    { 192, {249, 251, 65535}, {32, 34, 255}, { battleFormations + 740, 4 } },
+    { 193, {252, 253, 257}, {35, 32, 39}, { battleFormations + 744, 4 } },
+    { 194, {254, 255, 256}, {40, 40, 40}, { battleFormations + 748, 4 } },
+    { 195, {258, 259, 260}, {45, 45, 45}, { battleFormations + 752, 4 } },
+    { 196, {249, 250, 65535}, {32, 34, 255}, { battleFormations + 756, 4 } },
+    { 197, {261, 262, 263}, {40, 41, 36}, { battleFormations + 760, 4 } },
+    { 198, {261, 264, 65535}, {40, 39, 255}, { battleFormations + 764, 4 } },
+    { 199, {269, 270, 65535}, {42, 38, 255}, { battleFormations + 768, 4 } },
+    { 200, {271, 272, 273}, {50, 52, 51}, { battleFormations + 772, 4 } },
+    { 201, {268, 274, 275}, {40, 42, 49}, { battleFormations + 776, 4 } },
+    { 202, {265, 266, 267}, {42, 43, 46}, { battleFormations + 780, 4 } },
+    { 203, {173, 65535, 65535}, {34, 255, 255}, { battleFormations + 784, 4 } },
+    { 204, {173, 252, 281}, {34, 35, 42}, { battleFormations + 788, 4 } },
+    { 205, {286, 287, 288}, {42, 35, 1}, { battleFormations + 792, 4 } },
+    { 206, {285, 286, 289}, {45, 42, 44}, { battleFormations + 796, 4 } },
+    { 207, {286, 289, 290}, {42, 44, 42}, { battleFormations + 800, 4 } },
+    { 208, {289, 290, 65535}, {44, 42, 255}, { battleFormations + 804, 4 } },
+    { 209, {291, 292, 293}, {46, 42, 50}, { battleFormations + 808, 4 } },
+    { 210, {296, 297, 298}, {53, 50, 51}, { battleFormations + 812, 4 } },
+    { 211, {299, 300, 65535}, {53, 62, 255}, { battleFormations + 816, 4 } },
+    { 212, {301, 302, 65535}, {44, 46, 255}, { battleFormations + 820, 4 } },
+    { 213, {267, 301, 304}, {46, 44, 49}, { battleFormations + 824, 4 } },
+    { 214, {305, 362, 363}, {50, 34, 42}, { battleFormations + 828, 4 } },
+    { 215, {306, 307, 308}, {55, 55, 55}, { battleFormations + 832, 4 } },
+    { 216, {309, 65535, 65535}, {58, 255, 255}, { battleFormations + 836, 4 } },
+    { 217, {294, 295, 322}, {43, 43, 57}, { battleFormations + 840, 4 } },
+    { 218, {317, 321, 65535}, {77, 51, 255}, { battleFormations + 844, 4 } },
+    { 219, {318, 321, 323}, {41, 51, 48}, { battleFormations + 848, 4 } },
+    { 220, {215, 315, 323}, {44, 54, 48}, { battleFormations + 852, 4 } },
+    { 221, {310, 311, 312}, {41, 34, 34}, { battleFormations + 856, 4 } },
+    { 222, {314, 317, 319}, {48, 77, 59}, { battleFormations + 860, 4 } },
+    { 223, {313, 314, 316}, {60, 48, 41}, { battleFormations + 864, 4 } },
+    { 224, {294, 295, 317}, {43, 43, 77}, { battleFormations + 868, 4 } },
+    { 225, {314, 315, 320}, {48, 54, 46}, { battleFormations + 872, 4 } },
+    { 226, {311, 312, 323}, {34, 34, 48}, { battleFormations + 876, 4 } },
+    { 227, {324, 65535, 65535}, {61, 255, 255}, { battleFormations + 880, 4 } },
+    { 228, {325, 65535, 65535}, {61, 255, 255}, { battleFormations + 884, 4 } },
+    { 229, {326, 65535, 65535}, {61, 255, 255}, { battleFormations + 888, 4 } },
+    { 230, {330, 65535, 65535}, {61, 255, 255}, { battleFormations + 892, 4 } },
+    { 231, {331, 332, 65535}, {87, 50, 255}, { battleFormations + 896, 4 } },
+    { 232, {327, 65535, 65535}, {61, 255, 255}, { battleFormations + 900, 4 } },
+    { 233, {328, 65535, 65535}, {61, 255, 255}, { battleFormations + 904, 4 } },
+    { 234, {329, 65535, 65535}, {61, 255, 255}, { battleFormations + 908, 4 } },
+    { 235, {235, 236, 237}, {38, 1, 35}, { battleFormations + 912, 4 } },
+    { 236, {173, 237, 65535}, {34, 35, 255}, { battleFormations + 916, 4 } },
+    { 237, {240, 241, 242}, {33, 33, 33}, { battleFormations + 920, 4 } },
+    { 240, {264, 272, 280}, {39, 52, 22}, { battleFormations + 924, 4 } },
+    { 241, {266, 268, 65535}, {43, 40, 255}, { battleFormations + 928, 4 } },
+    { 242, {285, 65535, 65535}, {45, 255, 255}, { battleFormations + 932, 4 } },
+    { 243, {299, 300, 304}, {53, 62, 49}, { battleFormations + 936, 4 } },
+    { 244, {261, 262, 263}, {40, 41, 36}, { battleFormations + 940, 4 } },
+    { 245, {10, 11, 12}, {49, 59, 37}, { battleFormations + 944, 4 } },
+    { 246, {13, 14, 15}, {99, 1, 50}, { battleFormations + 948, 4 } },
+    { 248, {102, 103, 65535}, {18, 16, 255}, { battleFormations + 952, 4 } },
+};
+constexpr TableView<BattleScene> GameData::battleScenes = { battleSceneTable, std::size(battleSceneTable) };
+
+static constexpr uint8_t bossSceneIDs[] = {
+    81,
+    91,
+    96,
+    103,
+    134,
+    201,
+    210,
+    114,
+    115,
+    115,
+    116,
+    116,
+    117,
+    120,
+    122,
+    131,
+    134,
+    201,
+    204,
+    210,
+    138,
+    148,
+    150,
+    163,
+    161,
+    167,
+    185,
+    185,
+    185,
+    202,
+    213,
+    202,
+    213,
+    195,
+    144,
+    144,
+    144,
+    154,
+    155,
+    156,
+    156,
+    156,
+    157,
+    245,
+    210,
+    214,
+    215,
+    216,
+    70,
+    70,
+    71,
+    73,
+    70,
+    71,
+    247,
+    70,
+    71,
+    73,
+    70,
+    71,
+    247,
+    71,
+    70,
+    71,
+    73,
+    70,
+    71,
+    247,
+    246,
+    245,
+    227,
+    228,
+    229,
+    230,
+    232,
+    233,
+    234,
+    231,
+    231,
+};
+
+static constexpr Boss bossTable[] = {
+    { 22, "Guard Scorpion", { bossSceneIDs + 0, 1 }, 0x0205FFFFFFFFFFFFULL, 0x0205FFFFFFFFFFFFULL },
+    { 33, "Air Buster", { bossSceneIDs + 1, 1 }, 0x02000305FFFFFFFFULL, 0x02040505FFFFFFFFULL },
+    { 37, "Aps", { bossSceneIDs + 2, 1 }, 0x0005FFFFFFFFFFFFULL, 0x0205FFFFFFFFFFFFULL },
+    { 48, "Turks:Reno", { bossSceneIDs + 3, 1 }, 0x0205FFFFFFFFFFFFULL, 0x0405FFFFFFFFFFFFULL },
+    { 127, "Turks:Reno", { bossSceneIDs + 4, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 274, "Turks:Reno", { bossSceneIDs + 5, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 297, "Turks:Reno", { bossSceneIDs + 6, 1 }, 0x0502FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL },
+    { 64, "Sample:H0512", { bossSceneIDs + 7, 1 }, 0x040205FFFFFFFFFFULL, 0x060405FFFFFFFFFFULL },
+    { 66, "Hundred Gunner", { bossSceneIDs + 8, 1 }, 0x0205FFFFFFFFFFFFULL, 0x0204FFFFFFFFFFFFULL },
+    { 67, "Heli Gunner", { bossSceneIDs + 9, 1 }, 0x020307FFFFFFFFFFULL, 0x020502FFFFFFFFFFULL },
+    { 68, "Rufus", { bossSceneIDs + 10, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 69, "Dark Nation", { bossSceneIDs + 11, 1 }, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL },
+    { 71, "Motor Ball", { bossSceneIDs + 12, 1 }, 0x020005FFFFFFFFFFULL, 0x020405FFFFFFFFFFULL },
+    { 91, "Bottomswell", { bossSceneIDs + 13, 1 }, 0x030705FFFFFFFFFFULL, 0x050204FFFFFFFFFFULL },
+    { 95, "Jenova-BIRTH", { bossSceneIDs + 14, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 111, "Dyne", { bossSceneIDs + 15, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 128, "Turks:Rude", { bossSceneIDs + 16, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 275, "Turks:Rude", { bossSceneIDs + 17, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 281, "Turks:Rude", { bossSceneIDs + 18, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 298, "Turks:Rude", { bossSceneIDs + 19, 1 }, 0x0500FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL },
+    { 139, "Gi Nattak", { bossSceneIDs + 20, 1 }, 0x0905030608FFFFFFULL, 0x0605050502FFFFFFULL },
+    { 163, "Materia Keeper", { bossSceneIDs + 21, 1 }, 0x0005FFFFFFFFFFFFULL, 0x0605FFFFFFFFFFFFULL },
+    { 164, "Palmer", { bossSceneIDs + 22, 1 }, 0x0522FFFFFFFFFFFFULL, 0x0502FFFFFFFFFFFFULL },
+    { 193, "Red Dragon", { bossSceneIDs + 23, 1 }, 0x0500FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL },
+    { 195, "Demons Gate", { bossSceneIDs + 24, 1 }, 0x050403FFFFFFFFFFULL, 0x050504FFFFFFFFFFULL },
+    { 196, "Jenova-LIFE", { bossSceneIDs + 25, 1 }, 0x050603FFFFFFFFFFULL, 0x050602FFFFFFFFFFULL },
+    { 228, "Schizo(Right)", { bossSceneIDs + 26, 1 }, 0x0005FFFFFFFFFFFFULL, 0x0605FFFFFFFFFFFFULL },
+    { 229, "Schizo(Left)", { bossSceneIDs + 27, 1 }, 0x0105FFFFFFFFFFFFULL, 0x0605FFFFFFFFFFFFULL },
+    { 234, "Jenova-DEATH", { bossSceneIDs + 28, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 267, "Eagle Gun", { bossSceneIDs + 29, 2 }, 0x030602FFFFFFFFFFULL, 0x050502FFFFFFFFFFULL },
+    { 267, "Eagle Gun", { bossSceneIDs + 31, 2 }, 0x030602FFFFFFFFFFULL, 0x050502FFFFFFFFFFULL },
+    { 258, "Carry Armor", { bossSceneIDs + 33, 1 }, 0x020405FFFFFFFFFFULL, 0x020505FFFFFFFFFFULL },
+    { 154, "Lost Number", { bossSceneIDs + 34, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 155, "Lost Number", { bossSceneIDs + 35, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 156, "Lost Number", { bossSceneIDs + 36, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 177, "Rapps", { bossSceneIDs + 37, 1 }, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL },
+    { 178, "Gorkii", { bossSceneIDs + 38, 1 }, 0x050307FFFFFFFFFFULL, 0x050502FFFFFFFFFFULL },
+    { 179, "Shake", { bossSceneIDs + 39, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 180, "Chekhov", { bossSceneIDs + 40, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 181, "Staniv", { bossSceneIDs + 41, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 182, "Godo", { bossSceneIDs + 42, 1 }, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL },
+    { 10, "Diamond Weapon", { bossSceneIDs + 43, 1 }, 0x050002FFFFFFFFFFULL, 0x050402FFFFFFFFFFULL },
+    { 296, "Turks:Elena", { bossSceneIDs + 44, 1 }, 0x0501FFFFFFFFFFFFULL, 0x0506FFFFFFFFFFFFULL },
+    { 305, "Hojo", { bossSceneIDs + 45, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 306, "Helletic Hojo", { bossSceneIDs + 46, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 309, "Lifeform-Hojo N", { bossSceneIDs + 47, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 333, "Ultimate Weapon", { bossSceneIDs + 48, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 334, "Ultimate Weapon", { bossSceneIDs + 49, 3 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 335, "Ultimate Weapon", { bossSceneIDs + 52, 3 }, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL },
+    { 334, "Ultimate Weapon", { bossSceneIDs + 55, 3 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 335, "Ultimate Weapon", { bossSceneIDs + 58, 3 }, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL },
+    { 336, "Ultimate Weapon", { bossSceneIDs + 61, 1 }, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL },
+    { 334, "Ultimate Weapon", { bossSceneIDs + 62, 3 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 335, "Ultimate Weapon", { bossSceneIDs + 65, 3 }, 0x030605FFFFFFFFFFULL, 0x050505FFFFFFFFFFULL },
+    { 13, "Emerald Weapon", { bossSceneIDs + 68, 1 }, 0x0502010603FFFFFFULL, 0x0402060605FFFFFFULL },
+    { 11, "Ruby Weapon", { bossSceneIDs + 69, 1 }, 0x0605FFFFFFFFFFFFULL, 0x0505FFFFFFFFFFFFULL },
+    { 324, "Jenova-SYNTHESIS", { bossSceneIDs + 70, 1 }, 0x050304FFFFFFFFFFULL, 0x050506FFFFFFFFFFULL },
+    { 325, "Bizarro-Sephiroth", { bossSceneIDs + 71, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 326, "Bizarro-Sephiroth", { bossSceneIDs + 72, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 330, "Bizarro-Sephiroth", { bossSceneIDs + 73, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 327, "Bizarro-Sephiroth", { bossSceneIDs + 74, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 328, "Bizarro-Sephiroth", { bossSceneIDs + 75, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 329, "Bizarro-Sephiroth", { bossSceneIDs + 76, 1 }, 0x05FFFFFFFFFFFFFFULL, 0x05FFFFFFFFFFFFFFULL },
+    { 331, "Safer-Sephiroth", { bossSceneIDs + 77, 1 }, 0x0503FFFFFFFFFFFFULL, 0x0505FFFFFFFFFFFFULL },
+    { 332, "Sephiroth", { bossSceneIDs + 78, 1 }, 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL },
+};
+constexpr TableView<Boss> GameData::bosses = { bossTable, std::size(bossTable) };
+
+// Models
+static constexpr ModelPart modelParts[] = {
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 64, 24},
+    {3, 4, 0, 0, 0, 0, 76, 20},
+    {0, 0, 0, 0, 0, 0, 14, 8},
+    {0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 14, 8},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 2, 5},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 4, 10},
+    {0, 0, 0, 0, 0, 0, 2, 5},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 4, 10},
+    {0, 0, 0, 0, 0, 0, 10, 6},
+    {0, 0, 0, 0, 0, 0, 36, 22},
+    {0, 11, 0, 0, 0, 0, 90, 45},
+    {0, 0, 0, 0, 0, 0, 14, 7},
+    {0, 0, 0, 0, 0, 0, 0, 13},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 14, 7},
+    {0, 0, 0, 0, 0, 0, 0, 13},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 12, 9},
+    {0, 0, 0, 0, 0, 0, 4, 7},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 12, 9},
+    {0, 0, 0, 0, 0, 0, 4, 7},
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 6, 27},
+    {2, 4, 0, 0, 0, 0, 148, 12},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 6, 11},
+    {0, 0, 0, 0, 0, 0, 24, 20},
+    {2, 2, 0, 0, 0, 0, 100, 43},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 10, 15},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 15},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 96, 45},
+    {0, 0, 0, 0, 0, 0, 2, 16},
+    {0, 0, 0, 0, 0, 0, 2, 16},
+    {0, 0, 0, 0, 0, 0, 43, 13},
+    {6, 7, 0, 0, 0, 0, 40, 17},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 5},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 0, 2},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 5},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 6, 1},
+    {0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 6, 1},
+    {0, 0, 0, 0, 0, 0, 14, 2},
+    {0, 0, 0, 0, 0, 0, 28, 11},
+    {0, 3, 0, 0, 0, 0, 120, 10},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 12, 5},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 2, 3},
+    {0, 0, 0, 0, 0, 0, 2, 3},
+    {0, 0, 0, 0, 0, 0, 8, 0},
+    {0, 0, 0, 0, 0, 0, 12, 5},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 0, 22},
+    {0, 0, 0, 0, 0, 0, 36, 12},
+    {2, 2, 0, 0, 0, 0, 124, 22},
+    {0, 0, 0, 0, 0, 0, 16, 8},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 4, 1},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 5},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 0, 5},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 10, 7},
+    {0, 0, 0, 0, 0, 0, 12, 20},
+    {2, 2, 0, 0, 0, 0, 126, 34},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 0, 2},
+    {0, 0, 0, 0, 0, 0, 0, 17},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 17},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 6, 2},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 6, 2},
+    {0, 0, 0, 0, 0, 0, 2, 13},
+    {0, 0, 0, 0, 0, 0, 24, 25},
+    {2, 2, 0, 0, 0, 0, 128, 34},
+    {0, 0, 0, 0, 0, 0, 2, 4},
+    {0, 0, 0, 0, 0, 0, 2, 4},
+    {0, 0, 0, 0, 0, 0, 14, 13},
+    {0, 0, 0, 0, 0, 0, 0, 20},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 11},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 11},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 6, 11},
+    {0, 0, 0, 0, 0, 0, 24, 20},
+    {4, 4, 0, 0, 0, 0, 100, 43},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 10, 15},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 15},
+    {0, 0, 0, 0, 0, 0, 64, 65},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 26, 25},
+    {2, 6, 0, 0, 0, 0, 134, 19},
+    {0, 0, 0, 0, 0, 0, 42, 6},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 12},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 12},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 6, 11},
+    {0, 0, 0, 0, 0, 0, 58, 19},
+    {0, 0, 0, 0, 0, 0, 32, 20},
+    {2, 2, 0, 0, 0, 0, 131, 44},
+    {0, 0, 0, 0, 0, 0, 64, 1},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 4, 6},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 16, 7},
+    {0, 0, 0, 0, 0, 0, 4, 6},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 16, 7},
+    {0, 0, 0, 0, 0, 0, 8, 51},
+    {0, 0, 0, 0, 0, 0, 70, 13},
+    {2, 2, 0, 0, 0, 0, 138, 28},
+    {0, 0, 0, 0, 0, 0, 42, 8},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 4, 5},
+    {0, 0, 0, 0, 0, 0, 16, 7},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 4, 5},
+    {0, 0, 0, 0, 0, 0, 16, 7},
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 8, 26},
+    {2, 6, 0, 0, 0, 0, 148, 12},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 21, 28},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 66, 30},
+    {3, 4, 0, 0, 0, 0, 76, 20},
+    {0, 0, 0, 0, 0, 0, 14, 8},
+    {0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 14, 8},
+    {0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 2, 5},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 4, 10},
+    {0, 0, 0, 0, 0, 0, 2, 5},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 4, 10},
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 8, 26},
+    {2, 6, 0, 0, 0, 0, 150, 13},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 6, 21},
+    {0, 0, 0, 0, 0, 0, 0, 92},
+    {0, 0, 0, 0, 0, 0, 0, 34},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 24},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 24},
+    {0, 0, 0, 0, 0, 0, 0, 76},
+    {0, 0, 0, 0, 0, 0, 0, 76},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 12, 39},
+    {0, 0, 0, 0, 0, 0, 24, 30},
+    {2, 6, 0, 0, 0, 0, 150, 13},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 0, 22},
+    {0, 0, 0, 0, 0, 0, 42, 19},
+    {0, 0, 0, 0, 0, 0, 32, 26},
+    {2, 2, 0, 0, 0, 0, 124, 22},
+    {0, 0, 0, 0, 0, 0, 16, 8},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 4, 1},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 5},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 0, 5},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 60, 34},
+    {0, 0, 0, 0, 0, 0, 40, 26},
+    {3, 4, 0, 0, 0, 0, 76, 20},
+    {0, 0, 0, 0, 0, 0, 14, 8},
+    {0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 14, 8},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 2, 5},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 4, 10},
+    {0, 0, 0, 0, 0, 0, 2, 5},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 4, 10},
+    {0, 0, 0, 0, 0, 0, 14, 2},
+    {0, 0, 0, 0, 0, 0, 44, 33},
+    {0, 0, 0, 0, 0, 0, 36, 28},
+    {0, 3, 0, 0, 0, 0, 120, 10},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 12, 5},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 2, 3},
+    {0, 0, 0, 0, 0, 0, 2, 3},
+    {0, 0, 0, 0, 0, 0, 8, 0},
+    {0, 0, 0, 0, 0, 0, 12, 5},
+    {0, 0, 0, 0, 0, 0, 2, 11},
+    {0, 0, 0, 0, 0, 0, 4, 8},
+    {0, 0, 0, 0, 0, 0, 10, 4},
+    {0, 0, 0, 0, 0, 0, 10, 6},
+    {0, 0, 0, 0, 0, 0, 56, 30},
+    {0, 0, 0, 0, 0, 0, 16, 34},
+    {0, 11, 0, 0, 0, 0, 90, 45},
+    {0, 0, 0, 0, 0, 0, 14, 7},
+    {0, 0, 0, 0, 0, 0, 0, 13},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 14, 7},
+    {0, 0, 0, 0, 0, 0, 0, 13},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 12, 9},
+    {0, 0, 0, 0, 0, 0, 4, 7},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 12, 9},
+    {0, 0, 0, 0, 0, 0, 4, 7},
+    {0, 0, 0, 0, 0, 0, 2, 13},
+    {0, 0, 0, 0, 0, 0, 34, 30},
+    {0, 0, 0, 0, 0, 0, 32, 26},
+    {2, 2, 0, 0, 0, 0, 128, 34},
+    {0, 0, 0, 0, 0, 0, 2, 4},
+    {0, 0, 0, 0, 0, 0, 2, 4},
+    {0, 0, 0, 0, 0, 0, 14, 13},
+    {0, 0, 0, 0, 0, 0, 0, 20},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 11},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 11},
+    {0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 12, 6},
+    {0, 0, 0, 0, 0, 0, 6, 27},
+    {2, 4 + 2, 0, 0, 0, 0, 148 + 2, 12 + 1},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 10, 9},
+    {0, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+    {0, 0, 0, 0, 0, 0, 8, 4},
+    {0, 0, 0, 0, 0, 0, 4, 14},
+    {0, 0, 0, 0, 0, 0, 2, 7},
+};
+
+static constexpr Model modelTable[] = {
+    { "BARRET", 371, { modelParts + 0, 15 } },
+    { "CID", 388, { modelParts + 15, 15 } },
+    { "CLOUD", 373, { modelParts + 30, 15 } },
+    { "AERITH", 370, { modelParts + 45, 16 } },
+    { "CAITSITH", 385, { modelParts + 61, 16 } },
+    { "REDXIII", 424, { modelParts + 77, 22 } },
+    { "TIFA", 383, { modelParts + 99, 17 } },
+    { "VINCENT", 377, { modelParts + 116, 17 } },
+    { "YUFFIE", 382, { modelParts + 133, 16 } },
+    { "AERITH_INTRO", 489, { modelParts + 149, 16 } },
+    { "CLOUD_DRESS", 388, { modelParts + 165, 16 } },
+    { "AERITH_DRESS", 560, { modelParts + 181, 17 } },
+    { "TIFA_DRESS", 516, { modelParts + 198, 16 } },
+    { "CLOUD_SWORD", 425, { modelParts + 214, 16 } },
+    { "BARRET_COREL", 387, { modelParts + 230, 15 } },
+    { "CLOUD_WHEELCHAIR", 725, { modelParts + 245, 22 } },
+    { "CLOUD_PARACHUTE", 450, { modelParts + 267, 16 } },
+    { "TIFA_PARACHUTE", 454, { modelParts + 283, 18 } },
+    { "BARRET_PARACHUTE", 443, { modelParts + 301, 16 } },
+    { "REDXIII_PARACHUTE", 526, { modelParts + 317, 23 } },
+    { "CID_PARACHUTE", 466, { modelParts + 340, 16 } },
+    { "YUFFIE_PARACHUTE", 455, { modelParts + 356, 17 } },
+    { "CLOUD_WORLD", 378, { modelParts + 373, 15 } },
+};
+constexpr TableView<Model> GameData::models = { modelTable, std::size(modelTable) };
+
+static constexpr int battleModelHeaderSizes[] = {
+    636,
+    640,
+    668,
+    652,
+    652,
+    712,
+    812,
+    804,
+    700,
+    840,
+    688,
+};
+
+static constexpr BattleModelPart battleModelParts[] = {
+    {2292, 82, 0, 0, 28, 44},
+    {5300, 146, 0, 0, 196, 8},
+    {5252, 96, 46, 0, 184, 2},
+    {1124, 23, 5, 0, 42, 0},
+    {1128, 36, 0, 0, 11, 25},
+    {1248, 28, 0, 0, 49, 1},
+    {1044, 23, 0, 0, 42, 0},
+    {1048, 36, 0, 0, 19, 15},
+    {852, 20, 0, 0, 30, 3},
+    {1172, 28, 0, 0, 38, 7},
+    {876, 23, 0, 0, 24, 8},
+    {612, 17, 0, 0, 12, 9},
+    {852, 20, 0, 0, 30, 3},
+    {1172, 28, 0, 0, 38, 7},
+    {876, 23, 0, 0, 24, 8},
+    {612, 17, 0, 0, 12, 9},
+    {1304, 33, 0, 0, 39, 10},
+    {3252, 70, 0, 0, 130, 3},
+    {6776, 138, 36, 0, 231, 19},
+    {1396, 31, 0, 0, 54, 2},
+    {1396, 45, 0, 0, 16, 29},
+    {1092, 24, 0, 0, 44, 0},
+    {1156, 26, 0, 0, 44, 2},
+    {468, 12, 0, 0, 14, 3},
+    {1396, 31, 0, 0, 54, 2},
+    {1396, 45, 0, 0, 16, 29},
+    {1092, 24, 0, 0, 44, 0},
+    {852, 19, 0, 0, 34, 0},
+    {980, 23, 0, 0, 34, 4},
+    {612, 15, 0, 0, 20, 3},
+    {436, 11, 0, 0, 14, 2},
+    {852, 19, 0, 0, 34, 0},
+    {980, 23, 0, 0, 34, 4},
+    {612, 15, 0, 0, 20, 3},
+    {436, 11, 0, 0, 14, 2},
+    {1188, 26, 0, 0, 48, 0},
+    {3268, 76, 0, 0, 108, 20},
+    {6324, 131, 11, 0, 248, 5},
+    {1092, 25, 0, 0, 40, 3},
+    {596, 19, 0, 0, 8, 11},
+    {1316, 32, 0, 0, 40, 10},
+    {1044, 24, 0, 0, 38, 3},
+    {404, 11, 0, 0, 10, 4},
+    {1316, 32, 0, 0, 40, 10},
+    {612, 14, 0, 0, 24, 0},
+    {1420, 35, 0, 0, 50, 5},
+    {680, 17, 0, 0, 25, 1},
+    {392, 11, 0, 0, 13, 1},
+    {612, 14, 0, 0, 24, 0},
+    {1420, 35, 0, 0, 50, 5},
+    {680, 17, 0, 0, 25, 1},
+    {392, 11, 0, 0, 13, 1},
+    {3684, 80, 0, 0, 144, 6},
+    {11644, 282, 1, 2, 360, 88},
+    {12788, 262, 45, 0, 470, 23},
+    {5076, 140, 0, 0, 132, 54},
+    {6384, 245, 0, 0, 51, 141},
+    {2532, 67, 0, 0, 70, 24},
+    {2804, 64, 0, 0, 98, 13},
+    {1956, 63, 0, 0, 20, 43},
+    {2532, 67, 0, 0, 70, 24},
+    {2996, 69, 0, 0, 102, 16},
+    {3664, 96, 0, 0, 109, 29},
+    {1772, 48, 0, 0, 42, 22},
+    {1276, 36, 0, 0, 28, 17},
+    {2996, 69, 0, 0, 102, 16},
+    {3664, 96, 0, 0, 109, 29},
+    {1772, 48, 0, 0, 42, 22},
+    {1276, 36, 0, 0, 28, 17},
+    {1572, 35, 0, 0, 60, 3},
+    {2612, 58, 0, 0, 98, 7},
+    {6348, 143, 11, 0, 224, 22},
+    {420, 10, 0, 0, 16, 0},
+    {420, 10, 0, 0, 16, 0},
+    {420, 10, 0, 0, 16, 0},
+    {228, 6, 0, 0, 8, 0},
+    {1204, 36, 0, 0, 22, 19},
+    {548, 17, 0, 0, 4, 13},
+    {1316, 32, 0, 0, 40, 10},
+    {1204, 36, 0, 0, 22, 19},
+    {548, 17, 0, 0, 4, 13},
+    {1316, 32, 0, 0, 40, 10},
+    {708, 16, 0, 0, 28, 0},
+    {1212, 33, 0, 0, 38, 7},
+    {680, 17, 0, 0, 25, 1},
+    {392, 11, 0, 0, 13, 1},
+    {660, 15, 0, 0, 26, 0},
+    {452, 11, 0, 0, 16, 1},
+    {708, 16, 0, 0, 28, 0},
+    {1212, 33, 0, 0, 38, 7},
+    {680, 17, 0, 0, 25, 1},
+    {392, 11, 0, 0, 13, 1},
+    {932, 22, 0, 0, 32, 4},
+    {612, 17, 0, 0, 12, 9},
+    {932, 22, 0, 0, 32, 4},
+    {612, 17, 0, 0, 12, 9},
+    {4548, 107, 0, 0, 150, 28},
+    {676, 17, 0, 0, 20, 5},
+    {900, 22, 0, 0, 28, 6},
+    {2728, 65, 0, 0, 95, 12},
+    {4108, 88, 18, 0, 144, 9},
+    {532, 14, 0, 0, 14, 5},
+    {476, 16, 0, 0, 8, 7},
+    {612, 16, 0, 0, 16, 6},
+    {532, 14, 0, 0, 14, 5},
+    {476, 16, 0, 0, 8, 7},
+    {612, 16, 0, 0, 16, 6},
+    {100, 4, 0, 0, 0, 2},
+    {804, 18, 0, 0, 32, 0},
+    {348, 13, 0, 0, 4, 6},
+    {628, 16, 0, 0, 18, 5},
+    {180, 6, 0, 0, 2, 3},
+    {180, 6, 0, 0, 2, 3},
+    {276, 9, 0, 0, 2, 6},
+    {804, 18, 0, 0, 32, 0},
+    {348, 13, 0, 0, 4, 6},
+    {628, 16, 0, 0, 18, 5},
+    {2452, 53, 0, 0, 98, 2},
+    {1380, 30, 0, 0, 56, 0},
+    {676, 17, 0, 0, 20, 5},
+    {900, 22, 0, 0, 28, 6},
+    {804, 19, 0, 0, 28, 3},
+    {2068, 50, 0, 0, 74, 7},
+    {644, 17, 0, 0, 22, 2},
+    {5924, 136, 14, 0, 220, 8},
+    {228, 6, 0, 0, 8, 0},
+    {340, 10, 0, 0, 12, 0},
+    {164, 5, 0, 0, 4, 1},
+    {228, 6, 0, 0, 8, 0},
+    {340, 10, 0, 0, 12, 0},
+    {164, 5, 0, 0, 4, 1},
+    {468, 13, 0, 0, 10, 6},
+    {660, 15, 0, 0, 26, 0},
+    {664, 15, 1, 1, 22, 2},
+    {852, 27, 0, 0, 14, 14},
+    {372, 10, 0, 0, 10, 3},
+    {612, 14, 0, 0, 24, 0},
+    {660, 15, 0, 0, 26, 0},
+    {628, 15, 0, 0, 22, 2},
+    {852, 27, 0, 0, 14, 14},
+    {372, 10, 0, 0, 10, 3},
+    {612, 14, 0, 0, 24, 0},
+    {772, 16, 4, 0, 28, 0},
+    {516, 13, 0, 0, 16, 3},
+    {836, 28, 0, 0, 14, 13},
+    {340, 10, 0, 0, 6, 5},
+    {612, 15, 0, 0, 20, 3},
+    {356, 10, 0, 0, 8, 4},
+    {356, 10, 0, 0, 8, 4},
+    {356, 10, 0, 0, 8, 4},
+    {356, 10, 0, 0, 8, 4},
+    {324, 9, 0, 0, 8, 3},
+    {180, 5, 0, 0, 6, 0},
+    {772, 16, 4, 0, 28, 0},
+    {516, 13, 0, 0, 16, 3},
+    {836, 28, 0, 0, 14, 13},
+    {340, 10, 0, 0, 6, 5},
+    {612, 15, 0, 0, 20, 3},
+    {5076, 112, 0, 0, 190, 15},
+    {5400, 113, 11, 0, 203, 10},
+    {484, 12, 0, 0, 16, 2},
+    {356, 10, 0, 0, 8, 4},
+    {420, 10, 0, 0, 16, 0},
+    {228, 8, 0, 0, 0, 6},
+    {1060, 25, 0, 0, 36, 5},
+    {1940, 42, 0, 0, 78, 1},
+    {964, 22, 0, 0, 36, 2},
+    {1124, 29, 0, 0, 34, 8},
+    {1236, 37, 0, 0, 28, 15},
+    {724, 17, 0, 0, 26, 2},
+    {452, 11, 0, 0, 16, 1},
+    {964, 22, 0, 0, 36, 2},
+    {1124, 29, 0, 0, 34, 8},
+    {1236, 37, 0, 0, 28, 15},
+    {724, 17, 0, 0, 26, 2},
+    {452, 11, 0, 0, 16, 1},
+    {1364, 35, 0, 0, 40, 11},
+    {660, 25, 0, 0, 4, 15},
+    {1396, 33, 0, 0, 46, 8},
+    {916, 23, 0, 0, 26, 8},
+    {660, 25, 0, 0, 4, 15},
+    {3092, 71, 0, 0, 106, 16},
+    {6996, 147, 11, 0, 256, 21},
+    {580, 14, 0, 0, 20, 2},
+    {468, 11, 0, 0, 18, 0},
+    {276, 7, 0, 0, 10, 0},
+    {276, 8, 0, 0, 6, 3},
+    {164, 5, 0, 0, 4, 1},
+    {180, 5, 0, 0, 6, 0},
+    {180, 5, 0, 0, 6, 0},
+    {228, 6, 0, 0, 8, 0},
+    {180, 5, 0, 0, 6, 0},
+    {180, 5, 0, 0, 6, 0},
+    {228, 6, 0, 0, 8, 0},
+    {180, 5, 0, 0, 6, 0},
+    {180, 5, 0, 0, 6, 0},
+    {228, 6, 0, 0, 8, 0},
+    {180, 5, 0, 0, 6, 0},
+    {180, 5, 0, 0, 6, 0},
+    {228, 6, 0, 0, 8, 0},
+    {1188, 26, 0, 0, 48, 0},
+    {708, 16, 0, 0, 28, 0},
+    {1540, 43, 0, 0, 42, 14},
+    {680, 17, 0, 0, 25, 1},
+    {168, 6, 0, 0, 5, 0},
+    {708, 16, 0, 0, 28, 0},
+    {1540, 43, 0, 0, 42, 14},
+    {680, 17, 0, 0, 25, 1},
+    {168, 6, 0, 0, 5, 0},
+    {1260, 33, 0, 0, 38, 9},
+    {836, 28, 0, 0, 8, 18},
+    {2156, 56, 0, 0, 70, 12},
+    {1140, 26, 0, 0, 42, 3},
+    {604, 21, 0, 0, 4, 14},
+    {1716, 42, 0, 0, 50, 15},
+    {2404, 55, 0, 0, 84, 11},
+    {3620, 80, 0, 0, 136, 10},
+    {6340, 134, 11, 0, 238, 13},
+    {340, 9, 0, 0, 10, 2},
+    {340, 9, 0, 0, 10, 2},
+    {1780, 43, 0, 0, 54, 14},
+    {916, 24, 0, 0, 22, 11},
+    {996, 25, 0, 0, 28, 9},
+    {1236, 30, 0, 0, 38, 9},
+    {180, 8, 0, 0, 0, 4},
+    {788, 19, 0, 0, 26, 4},
+    {492, 17, 0, 0, 6, 9},
+    {1236, 30, 0, 0, 38, 9},
+    {1936, 54, 0, 0, 49, 21},
+    {1372, 36, 0, 0, 40, 11},
+    {680, 17, 0, 0, 25, 1},
+    {440, 12, 0, 0, 15, 1},
+    {1092, 30, 0, 0, 32, 8},
+    {1372, 36, 0, 0, 40, 11},
+    {680, 17, 0, 0, 25, 1},
+    {440, 12, 0, 0, 15, 1},
+};
+
+static constexpr BattleModel battleModelTable[] = {
+    { "BARRET", { battleModelHeaderSizes + 0, 2 }, { battleModelParts + 0, 16 } },
+    { "CID", { battleModelHeaderSizes + 2, 1 }, { battleModelParts + 16, 19 } },
+    { "CLOUD", { battleModelHeaderSizes + 3, 1 }, { battleModelParts + 35, 17 } },
+    { "HICLOUD", { battleModelHeaderSizes + 4, 1 }, { battleModelParts + 52, 17 } },
+    { "AERITH", { battleModelHeaderSizes + 5, 1 }, { battleModelParts + 69, 23 } },
+    { "CAITSITH", { battleModelHeaderSizes + 6, 1 }, { battleModelParts + 92, 29 } },
+    { "REDXIII", { battleModelHeaderSizes + 7, 1 }, { battleModelParts + 121, 37 } },
+    { "TIFA", { battleModelHeaderSizes + 8, 1 }, { battleModelParts + 158, 23 } },
+    { "VINCENT", { battleModelHeaderSizes + 9, 1 }, { battleModelParts + 181, 34 } },
+    { "YUFFIE", { battleModelHeaderSizes + 10, 1 }, { battleModelParts + 215, 21 } },
+};
+constexpr TableView<BattleModel> GameData::battleModels = { battleModelTable, std::size(battleModelTable) };
 
-    addBattleModel("BARRET", {636, 640}, {{2292, 82, 0, 0, 28, 44}, {5300, 146, 0, 0, 196, 8}, {5252, 96, 46, 0, 184, 2}, {1124, 23, 5, 0, 42, 0}, {1128, 36, 0, 0, 11, 25}, {1248, 28, 0, 0, 49, 1}, {1044, 23, 0, 0, 42, 0}, {1048, 36, 0, 0, 19, 15}, {852, 20, 0, 0, 30, 3}, {1172, 28, 0, 0, 38, 7}, {876, 23, 0, 0, 24, 8}, {612, 17, 0, 0, 12, 9}, {852, 20, 0, 0, 30, 3}, {1172, 28, 0, 0, 38, 7}, {876, 23, 0, 0, 24, 8}, {612, 17, 0, 0, 12, 9}});
-    addBattleModel("CID", {668}, {{1304, 33, 0, 0, 39, 10}, {3252, 70, 0, 0, 130, 3}, {6776, 138, 36, 0, 231, 19}, {1396, 31, 0, 0, 54, 2}, {1396, 45, 0, 0, 16, 29}, {1092, 24, 0, 0, 44, 0}, {1156, 26, 0, 0, 44, 2}, {468, 12, 0, 0, 14, 3}, {1396, 31, 0, 0, 54, 2}, {1396, 45, 0, 0, 16, 29}, {1092, 24, 0, 0, 44, 0}, {852, 19, 0, 0, 34, 0}, {980, 23, 0, 0, 34, 4}, {612, 15, 0, 0, 20, 3}, {436, 11, 0, 0, 14, 2}, {852, 19, 0, 0, 34, 0}, {980, 23, 0, 0, 34, 4}, {612, 15, 0, 0, 20, 3}, {436, 11, 0, 0, 14, 2}});
-    addBattleModel("CLOUD", {652}, {{1188, 26, 0, 0, 48, 0}, {3268, 76, 0, 0, 108, 20}, {6324, 131, 11, 0, 248, 5}, {1092, 25, 0, 0, 40, 3}, {596, 19, 0, 0, 8, 11}, {1316, 32, 0, 0, 40, 10}, {1044, 24, 0, 0, 38, 3}, {404, 11, 0, 0, 10, 4}, {1316, 32, 0, 0, 40, 10}, {612, 14, 0, 0, 24, 0}, {1420, 35, 0, 0, 50, 5}, {680, 17, 0, 0, 25, 1}, {392, 11, 0, 0, 13, 1}, {612, 14, 0, 0, 24, 0}, {1420, 35, 0, 0, 50, 5}, {680, 17, 0, 0, 25, 1}, {392, 11, 0, 0, 13, 1}});
-    addBattleModel("HICLOUD", {652}, {{3684, 80, 0, 0, 144, 6}, {11644, 282, 1, 2, 360, 88}, {12788, 262, 45, 0, 470, 23}, {5076, 140, 0, 0, 132, 54}, {6384, 245, 0, 0, 51, 141}, {2532, 67, 0, 0, 70, 24}, {2804, 64, 0, 0, 98, 13}, {1956, 63, 0, 0, 20, 43}, {2532, 67, 0, 0, 70, 24}, {2996, 69, 0, 0, 102, 16}, {3664, 96, 0, 0, 109, 29}, {1772, 48, 0, 0, 42, 22}, {1276, 36, 0, 0, 28, 17}, {2996, 69, 0, 0, 102, 16}, {3664, 96, 0, 0, 109, 29}, {1772, 48, 0, 0, 42, 22}, {1276, 36, 0, 0, 28, 17}});
-    addBattleModel("AERITH", {712}, {{1572, 35, 0, 0, 60, 3}, {2612, 58, 0, 0, 98, 7}, {6348, 143, 11, 0, 224, 22}, {420, 10, 0, 0, 16, 0}, {420, 10, 0, 0, 16, 0}, {420, 10, 0, 0, 16, 0}, {228, 6, 0, 0, 8, 0}, {1204, 36, 0, 0, 22, 19}, {548, 17, 0, 0, 4, 13}, {1316, 32, 0, 0, 40, 10}, {1204, 36, 0, 0, 22, 19}, {548, 17, 0, 0, 4, 13}, {1316, 32, 0, 0, 40, 10}, {708, 16, 0, 0, 28, 0}, {1212, 33, 0, 0, 38, 7}, {680, 17, 0, 0, 25, 1}, {392, 11, 0, 0, 13, 1}, {660, 15, 0, 0, 26, 0}, {452, 11, 0, 0, 16, 1}, {708, 16, 0, 0, 28, 0}, {1212, 33, 0, 0, 38, 7}, {680, 17, 0, 0, 25, 1}, {392, 11, 0, 0, 13, 1}});
-    addBattleModel("CAITSITH", {812}, {{932, 22, 0, 0, 32, 4}, {612, 17, 0, 0, 12, 9}, {932, 22, 0, 0, 32, 4}, {612, 17, 0, 0, 12, 9}, {4548, 107, 0, 0, 150, 28}, {676, 17, 0, 0, 20, 5}, {900, 22, 0, 0, 28, 6}, {2728, 65, 0, 0, 95, 12}, {4108, 88, 18, 0, 144, 9}, {532, 14, 0, 0, 14, 5}, {476, 16, 0, 0, 8, 7}, {612, 16, 0, 0, 16, 6}, {532, 14, 0, 0, 14, 5}, {476, 16, 0, 0, 8, 7}, {612, 16, 0, 0, 16, 6}, {100, 4, 0, 0, 0, 2}, {804, 18, 0, 0, 32, 0}, {348, 13, 0, 0, 4, 6}, {628, 16, 0, 0, 18, 5}, {180, 6, 0, 0, 2, 3}, {180, 6, 0, 0, 2, 3}, {276, 9, 0, 0, 2, 6}, {804, 18, 0, 0, 32, 0}, {348, 13, 0, 0, 4, 6}, {628, 16, 0, 0, 18, 5}, {2452, 53, 0, 0, 98, 2}, {1380, 30, 0, 0, 56, 0}, {676, 17, 0, 0, 20, 5}, {900, 22, 0, 0, 28, 6}});
-    addBattleModel("REDXIII", {804}, {{804, 19, 0, 0, 28, 3}, {2068, 50, 0, 0, 74, 7}, {644, 17, 0, 0, 22, 2}, {5924, 136, 14, 0, 220, 8}, {228, 6, 0, 0, 8, 0}, {340, 10, 0, 0, 12, 0}, {164, 5, 0, 0, 4, 1}, {228, 6, 0, 0, 8, 0}, {340, 10, 0, 0, 12, 0}, {164, 5, 0, 0, 4, 1}, {468, 13, 0, 0, 10, 6}, {660, 15, 0, 0, 26, 0}, {664, 15, 1, 1, 22, 2}, {852, 27, 0, 0, 14, 14}, {372, 10, 0, 0, 10, 3}, {612, 14, 0, 0, 24, 0}, {660, 15, 0, 0, 26, 0}, {628, 15, 0, 0, 22, 2}, {852, 27, 0, 0, 14, 14}, {372, 10, 0, 0, 10, 3}, {612, 14, 0, 0, 24, 0}, {772, 16, 4, 0, 28, 0}, {516, 13, 0, 0, 16, 3}, {836, 28, 0, 0, 14, 13}, {340, 10, 0, 0, 6, 5}, {612, 15, 0, 0, 20, 3}, {356, 10, 0, 0, 8, 4}, {356, 10, 0, 0, 8, 4}, {356, 10, 0, 0, 8, 4}, {356, 10, 0, 0, 8, 4}, {324, 9, 0, 0, 8, 3}, {180, 5, 0, 0, 6, 0}, {772, 16, 4, 0, 28, 0}, {516, 13, 0, 0, 16, 3}, {836, 28, 0, 0, 14, 13}, {340, 10, 0, 0, 6, 5}, {612, 15, 0, 0, 20, 3}});
-    addBattleModel("TIFA", {700}, {{5076, 112, 0, 0, 190, 15}, {5400, 113, 11, 0, 203, 10}, {484, 12, 0, 0, 16, 2}, {356, 10, 0, 0, 8, 4}, {420, 10, 0, 0, 16, 0}, {228, 8, 0, 0, 0, 6}, {1060, 25, 0, 0, 36, 5}, {1940, 42, 0, 0, 78, 1}, {964, 22, 0, 0, 36, 2}, {1124, 29, 0, 0, 34, 8}, {1236, 37, 0, 0, 28, 15}, {724, 17, 0, 0, 26, 2}, {452, 11, 0, 0, 16, 1}, {964, 22, 0, 0, 36, 2}, {1124, 29, 0, 0, 34, 8}, {1236, 37, 0, 0, 28, 15}, {724, 17, 0, 0, 26, 2}, {452, 11, 0, 0, 16, 1}, {1364, 35, 0, 0, 40, 11}, {660, 25, 0, 0, 4, 15}, {1396, 33, 0, 0, 46, 8}, {916, 23, 0, 0, 26, 8}, {660, 25, 0, 0, 4, 15}});
-    addBattleModel("VINCENT", {840}, {{3092, 71, 0, 0, 106, 16}, {6996, 147, 11, 0, 256, 21}, {580, 14, 0, 0, 20, 2}, {468, 11, 0, 0, 18, 0}, {276, 7, 0, 0, 10, 0}, {276, 8, 0, 0, 6, 3}, {164, 5, 0, 0, 4, 1}, {180, 5, 0, 0, 6, 0}, {180, 5, 0, 0, 6, 0}, {228, 6, 0, 0, 8, 0}, {180, 5, 0, 0, 6, 0}, {180, 5, 0, 0, 6, 0}, {228, 6, 0, 0, 8, 0}, {180, 5, 0, 0, 6, 0}, {180, 5, 0, 0, 6, 0}, {228, 6, 0, 0, 8, 0}, {180, 5, 0, 0, 6, 0}, {180, 5, 0, 0, 6, 0}, {228, 6, 0, 0, 8, 0}, {1188, 26, 0, 0, 48, 0}, {708, 16, 0, 0, 28, 0}, {1540, 43, 0, 0, 42, 14}, {680, 17, 0, 0, 25, 1}, {168, 6, 0, 0, 5, 0}, {708, 16, 0, 0, 28, 0}, {1540, 43, 0, 0, 42, 14}, {680, 17, 0, 0, 25, 1}, {168, 6, 0, 0, 5, 0}, {1260, 33, 0, 0, 38, 9}, {836, 28, 0, 0, 8, 18}, {2156, 56, 0, 0, 70, 12}, {1140, 26, 0, 0, 42, 3}, {604, 21, 0, 0, 4, 14}, {1716, 42, 0, 0, 50, 15}});
-    addBattleModel("YUFFIE", {688}, {{2404, 55, 0, 0, 84, 11}, {3620, 80, 0, 0, 136, 10}, {6340, 134, 11, 0, 238, 13}, {340, 9, 0, 0, 10, 2}, {340, 9, 0, 0, 10, 2}, {1780, 43, 0, 0, 54, 14}, {916, 24, 0, 0, 22, 11}, {996, 25, 0, 0, 28, 9}, {1236, 30, 0, 0, 38, 9}, {180, 8, 0, 0, 0, 4}, {788, 19, 0, 0, 26, 4}, {492, 17, 0, 0, 6, 9}, {1236, 30, 0, 0, 38, 9}, {1936, 54, 0, 0, 49, 21}, {1372, 36, 0, 0, 40, 11}, {680, 17, 0, 0, 25, 1}, {440, 12, 0, 0, 15, 1}, {1092, 30, 0, 0, 32, 8}, {1372, 36, 0, 0, 40, 11}, {680, 17, 0, 0, 25, 1}, {440, 12, 0, 0, 15, 1}});
-}
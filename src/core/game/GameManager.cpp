@@ -2,18 +2,35 @@
 #include "core/audio/AudioManager.h"
 #include "core/game/GameData.h"
 #include "core/game/MemoryOffsets.h"
+#include "core/game/MemoryStructs.h"
+#include "core/game/TextCodec.h"
 #include "core/utilities/Logging.h"
 #include "core/utilities/Utilities.h"
 #include "extras/Extra.h"
+#include "rules/Restrictions.h"
 #include "rules/Rule.h"
 
+#include <algorithm>
+#include <filesystem>
 #include <thread>
 #include <chrono>
 
+// I/O made during update is counted against these, see IOStats.
+static const uint32_t ioTagManager    = IOStats::registerTag("GameManager");
+static const uint32_t ioTagStart      = IOStats::registerTag("onStart/onResync");
+static const uint32_t ioTagUpdate     = IOStats::registerTag("onUpdate");
+static const uint32_t ioTagFrame      = IOStats::registerTag("onFrame");
+static const uint32_t ioTagTransition = IOStats::registerTag("Transition Events");
+static const uint32_t ioTagTriggers   = IOStats::registerTag("Script/Text Triggers");
+static const uint32_t ioTagInvariants = IOStats::registerTag("Invariants");
+static const uint32_t ioTagCommands   = IOStats::registerTag("GUI Commands");
+static const uint32_t ioTagTrace      = IOStats::registerTag("Trace Recording");
+
 GameManager::GameManager()
-    : emulator(nullptr)
+    : emulator(nullptr), rules(Rule::getList()), extras(Extra::getList())
 {
     memset(fieldScriptExecutionTable, 0, 128);
+    memset(lastFieldScriptExecutionTable, 0, 128);
 }
 
 GameManager::~GameManager()
@@ -22,6 +39,43 @@ GameManager::~GameManager()
     {
         delete emulator;
     }
+
+    if (ownsRules)
+    {
+        for (Rule* rule : rules)
+        {
+            delete rule;
+        }
+        for (Extra* extra : extras)
+        {
+            delete extra;
+        }
+    }
+}
+
+void GameManager::cloneRules()
+{
+    if (ownsRules)
+    {
+        return;
+    }
+
+    for (Rule*& rule : rules)
+    {
+        rule = rule->clone(rule);
+    }
+    for (Extra*& extra : extras)
+    {
+        extra = extra->clone(extra);
+    }
+
+    ownsRules = true;
+    restrictions = std::make_unique<RestrictionList>();
+}
+
+RestrictionList* GameManager::getRestrictions()
+{
+    return restrictions != nullptr ? restrictions.get() : Restrictions::current;
 }
 
 bool GameManager::connectToEmulator(std::string processName)
@@ -46,35 +100,360 @@ bool GameManager::connectToEmulator(std::string processName, uintptr_t memoryAdd
     return emulator->connect(processName);
 }
 
+bool GameManager::connectToEmulator(Emulator* customEmulator, std::string target)
+{
+    emulator = customEmulator;
+    return emulator->connect(target);
+}
+
 std::string GameManager::readString(uintptr_t offset, uint32_t length)
 {
-    std::vector<uint8_t> strData;
-    strData.resize(length);
-    emulator->read(offset, strData.data(), length);
-    return GameData::decodeString(strData);
+    uint8_t strData[TextCodec::MaxLength];
+    char buffer[TextCodec::MaxLength + 1];
+    std::string result = "";
+
+    for (uint32_t i = 0; i < length; i += TextCodec::MaxLength)
+    {
+        size_t chunkLength = std::min<size_t>(length - i, TextCodec::MaxLength);
+        emulator->read(offset + i, strData, chunkLength);
+
+        size_t count = TextCodec::decode(strData, chunkLength, buffer, sizeof(buffer));
+        result.append(buffer, count);
+
+        // Hit the terminator
+        if (count < chunkLength)
+        {
+            break;
+        }
+    }
+
+    return result;
 }
 
 void GameManager::writeString(uintptr_t offset, uint32_t length, const std::string& string, bool centerAlign)
 {
-    std::vector<uint8_t> strData = GameData::encodeString(string);
+    if (length > TextCodec::MaxLength)
+    {
+        std::vector<uint8_t> strData(length);
+        TextCodec::encode(string, strData.data(), length, centerAlign);
+        emulator->write(offset, strData.data(), length);
+        return;
+    }
+
+    uint8_t strData[TextCodec::MaxLength];
+    TextCodec::encode(string, strData, length, centerAlign);
+    emulator->write(offset, strData, length);
+}
+
+bool GameManager::compareString(uintptr_t offset, uint32_t length, std::string_view string)
+{
+    uint8_t strData[TextCodec::MaxLength];
+    length = std::min<uint32_t>(length, TextCodec::MaxLength);
+    emulator->read(offset, strData, length);
+    return TextCodec::equals(strData, length, string);
+}
+
+bool GameManager::compareEncoded(uintptr_t offset, const uint8_t* encoded, uint32_t length)
+{
+    uint8_t strData[TextCodec::MaxLength];
+    length = std::min<uint32_t>(length, TextCodec::MaxLength);
+    emulator->read(offset, strData, length);
+    return memcmp(strData, encoded, length) == 0;
+}
+
+void GameManager::addScriptTrigger(uint8_t groupIndex, uint16_t offset, std::function<void()> callback)
+{
+    if (groupIndex >= 64)
+    {
+        return;
+    }
+
+    ScriptTrigger& trigger = scriptTriggers[groupIndex].emplace_back();
+    trigger.offset = offset;
+    trigger.callback = callback;
+    scriptTriggerMask |= (1ull << groupIndex);
+}
+
+void GameManager::addScriptTextTrigger(uint8_t groupIndex, uint16_t offset, uintptr_t address, uint32_t length, const std::string& string, bool centerAlign)
+{
+    if (groupIndex >= 64)
+    {
+        return;
+    }
+
+    ScriptTrigger& trigger = scriptTriggers[groupIndex].emplace_back();
+    trigger.offset = offset;
+    trigger.payloadAddress = address;
+    trigger.payloadLength = std::min<uint32_t>(length, (uint32_t)trigger.payload.size());
+
+    // Encode once here so firing the trigger is just a write.
+    TextCodec::encode(string, trigger.payload.data(), trigger.payloadLength, centerAlign);
+
+    scriptTriggerMask |= (1ull << groupIndex);
+    scriptPayloadMask |= (1ull << groupIndex);
+}
+
+void GameManager::clearScriptTriggers()
+{
+    for (int i = 0; i < 64; ++i)
+    {
+        scriptTriggers[i].clear();
+    }
+    scriptTriggerMask = 0;
+    scriptPayloadMask = 0;
+}
+
+// Fires any triggers whose group just moved onto the trigger offset, callbacks only fire once per landing.
+// Payloads are held like a conditional invariant while the group stays on the offset, as the game may
+// redraw the window from its own string after the first write. Groups without payloads that haven't
+// moved since the last update are skipped.
+void GameManager::updateScriptTriggers()
+{
+    if (scriptTriggerMask == 0)
+    {
+        return;
+    }
+
+    for (int i = 0; i < 64; ++i)
+    {
+        if ((scriptTriggerMask & (1ull << i)) == 0)
+        {
+            continue;
+        }
+
+        uint16_t scriptPtr = fieldScriptExecutionTable[i];
+        bool landed = scriptPtr != lastFieldScriptExecutionTable[i];
+        if (!landed && (scriptPayloadMask & (1ull << i)) == 0)
+        {
+            continue;
+        }
+
+        for (ScriptTrigger& trigger : scriptTriggers[i])
+        {
+            if (trigger.offset != scriptPtr)
+            {
+                continue;
+            }
+
+            if (trigger.payloadLength > 0)
+            {
+                uint8_t current[sizeof(trigger.payload)];
+                emulator->read(trigger.payloadAddress, current, trigger.payloadLength);
+                if (memcmp(current, trigger.payload.data(), trigger.payloadLength) != 0)
+                {
+                    emulator->write(trigger.payloadAddress, trigger.payload.data(), trigger.payloadLength);
+                }
+            }
+
+            if (landed && trigger.callback)
+            {
+                trigger.callback();
+            }
+        }
+    }
+}
+
+void GameManager::addTextTrigger(uint8_t windowIndex, const std::string& text, std::function<void()> callback)
+{
+    if (windowIndex >= WindowCount)
+    {
+        return;
+    }
+
+    TextTrigger& trigger = textTriggers[windowIndex].emplace_back();
+    trigger.hash = TextCodec::hash(text);
+    trigger.text = text;
+    trigger.callback = callback;
+    textTriggerMask |= (1 << windowIndex);
+
+    // Force a full read of this window on the next update.
+    lastWindowTextHead[windowIndex].fill(TextCodec::ControlCode::End);
+}
+
+void GameManager::addInvariant(uintptr_t offset, uint8_t size, uint64_t value, std::function<bool()> condition)
+{
+    MemoryInvariant invariant;
+    invariant.offset = offset;
+    invariant.size = size;
+    invariant.value = value;
+    invariant.condition = condition;
+
+    auto it = std::upper_bound(invariants.begin(), invariants.end(), offset, [](uintptr_t value, const MemoryInvariant& other) { return value < other.offset; });
+    invariants.insert(it, invariant);
+    invariantSpansDirty = true;
+}
+
+void GameManager::clearInvariants()
+{
+    invariants.clear();
+    invariantSpans.clear();
+    invariantSpansDirty = false;
+}
+
+void GameManager::buildInvariantSpans()
+{
+    invariantSpans.clear();
+
+    uint32_t largestSpan = 0;
+    for (size_t i = 0; i < invariants.size(); ++i)
+    {
+        const MemoryInvariant& invariant = invariants[i];
+        uintptr_t end = invariant.offset + invariant.size;
+
+        if (!invariantSpans.empty())
+        {
+            InvariantSpan& span = invariantSpans.back();
+            uintptr_t spanEnd = span.offset + span.size;
+            if (invariant.offset <= spanEnd + InvariantMaxGap && std::max(spanEnd, end) - span.offset <= InvariantMaxSpan)
+            {
+                span.size = (uint32_t)(std::max(spanEnd, end) - span.offset);
+                span.count++;
+                largestSpan = std::max(largestSpan, span.size);
+                continue;
+            }
+        }
+
+        InvariantSpan& span = invariantSpans.emplace_back();
+        span.offset = invariant.offset;
+        span.size = invariant.size;
+        span.first = i;
+        span.count = 1;
+        largestSpan = std::max(largestSpan, span.size);
+    }
+
+    invariantBuffer.resize(largestSpan);
+    invariantActive.resize(invariants.size());
+    invariantSpansDirty = false;
+}
+
+// Checks every invariant whose condition holds against memory and rewrites the ones that don't match.
+// Invariants are read a span at a time and adjacent violations are written back together.
+void GameManager::updateInvariants()
+{
+    if (invariants.empty())
+    {
+        return;
+    }
+
+    if (invariantSpansDirty)
+    {
+        buildInvariantSpans();
+    }
+
+    for (const InvariantSpan& span : invariantSpans)
+    {
+        // Evaluate conditions first so spans with nothing to enforce aren't read.
+        bool anyActive = false;
+        for (size_t i = span.first; i < span.first + span.count; ++i)
+        {
+            const MemoryInvariant& invariant = invariants[i];
+            invariantActive[i] = !invariant.condition || invariant.condition();
+            anyActive |= (invariantActive[i] != 0);
+        }
+
+        if (!anyActive)
+        {
+            continue;
+        }
+
+        uint8_t* buffer = invariantBuffer.data();
+        emulator->read(span.offset, buffer, span.size);
+
+        uintptr_t writeStart = 0;
+        uintptr_t writeEnd = 0;
+        for (size_t i = span.first; i < span.first + span.count; ++i)
+        {
+            const MemoryInvariant& invariant = invariants[i];
+            if (!invariantActive[i])
+            {
+                continue;
+            }
 
-    std::vector<uint8_t> finalStrData;
-    finalStrData.resize(length, 0x00); // Fill with 0x00 by default
+            uint8_t* current = buffer + (invariant.offset - span.offset);
+            if (memcmp(current, &invariant.value, invariant.size) == 0)
+            {
+                continue;
+            }
 
-    size_t strLen = std::min<size_t>(strData.size(), length);
-    size_t padding = centerAlign ? (length - strLen) / 2 : 0;
+            memcpy(current, &invariant.value, invariant.size);
+            invariantViolations++;
 
-    for (size_t i = 0; i < strLen; ++i)
+            // Extend the pending write if this violation is touching it, otherwise flush it.
+            uintptr_t end = invariant.offset + invariant.size;
+            if (writeEnd != 0 && invariant.offset <= writeEnd)
+            {
+                writeEnd = std::max(writeEnd, end);
+                continue;
+            }
+
+            if (writeEnd != 0)
+            {
+                emulator->write(writeStart, buffer + (writeStart - span.offset), writeEnd - writeStart);
+            }
+            writeStart = invariant.offset;
+            writeEnd = end;
+        }
+
+        if (writeEnd != 0)
+        {
+            emulator->write(writeStart, buffer + (writeStart - span.offset), writeEnd - writeStart);
+        }
+    }
+}
+
+void GameManager::clearTextTriggers()
+{
+    for (int i = 0; i < WindowCount; ++i)
+    {
+        textTriggers[i].clear();
+    }
+    textTriggerMask = 0;
+}
+
+// Reads the start of each window with triggers and only when that changes is the full text read,
+// hashed and matched against the registered fingerprints.
+void GameManager::updateTextTriggers()
+{
+    if (textTriggerMask == 0)
     {
-        finalStrData[padding + i] = strData[i];
+        return;
     }
 
-    emulator->write(offset, finalStrData.data(), length);
+    for (int i = 0; i < WindowCount; ++i)
+    {
+        if ((textTriggerMask & (1 << i)) == 0)
+        {
+            continue;
+        }
+
+        uintptr_t windowOffset = getWindowTextOffset(i);
+
+        uint8_t head[WindowTextHeadSize];
+        emulator->read(windowOffset, head, WindowTextHeadSize);
+        if (memcmp(head, lastWindowTextHead[i].data(), WindowTextHeadSize) == 0)
+        {
+            continue;
+        }
+        memcpy(lastWindowTextHead[i].data(), head, WindowTextHeadSize);
+
+        uint8_t text[TextCodec::MaxLength];
+        emulator->read(windowOffset, text, TextCodec::MaxLength);
+        uint64_t textHash = TextCodec::hash(text, TextCodec::MaxLength);
+
+        for (TextTrigger& trigger : textTriggers[i])
+        {
+            // Hash collisions are unlikely but confirm before firing.
+            if (trigger.hash == textHash && TextCodec::equals(text, TextCodec::MaxLength, trigger.text))
+            {
+                trigger.callback();
+            }
+        }
+    }
 }
 
 bool GameManager::isRuleEnabled(std::string ruleName)
 {
-    for (Rule* rule : Rule::getList())
+    for (Rule* rule : rules)
     {
         if (rule->enabled && rule->name == ruleName)
         {
@@ -87,7 +466,7 @@ bool GameManager::isRuleEnabled(std::string ruleName)
 
 Rule* GameManager::getRule(std::string ruleName)
 {
-    for (Rule* rule : Rule::getList())
+    for (Rule* rule : rules)
     {
         if (rule->enabled && rule->name == ruleName)
         {
@@ -100,7 +479,7 @@ Rule* GameManager::getRule(std::string ruleName)
 
 bool GameManager::isExtraEnabled(std::string extraName)
 {
-    for (Extra* extra : Extra::getList())
+    for (Extra* extra : extras)
     {
         if (extra->enabled && extra->name == extraName)
         {
@@ -113,7 +492,7 @@ bool GameManager::isExtraEnabled(std::string extraName)
 
 Extra* GameManager::getExtra(std::string extraName)
 {
-    for (Extra* extra : Extra::getList())
+    for (Extra* extra : extras)
     {
         if (extra->enabled && extra->name == extraName)
         {
@@ -124,11 +503,29 @@ Extra* GameManager::getExtra(std::string extraName)
     return nullptr;
 }
 
+void GameManager::loadRuleSettings(ConfigFile& cfg)
+{
+    for (auto& rule : Rule::getList())
+    {
+        cfg.keyPrefix = Utilities::sanitizeName(rule->name) + ".";
+        rule->loadSettings(cfg);
+        rule->enabled = cfg.get<bool>("enabled", rule->enabled);
+        cfg.keyPrefix = "";
+    }
+    for (auto& extra : Extra::getList())
+    {
+        cfg.keyPrefix = Utilities::sanitizeName(extra->name) + ".";
+        extra->loadSettings(cfg);
+        extra->enabled = cfg.get<bool>("enabled", extra->enabled);
+        cfg.keyPrefix = "";
+    }
+}
+
 std::string GameManager::getSettingsSummary()
 {
     std::map<std::string, std::vector<std::string>> groups;
 
-    for (Rule* rule : Rule::getList())
+    for (Rule* rule : rules)
     {
         if (!rule->enabled)
         {
@@ -149,7 +546,7 @@ std::string GameManager::getSettingsSummary()
         groups[prefix].push_back(subject);
     }
 
-    for (Extra* extra : Extra::getList())
+    for (Extra* extra : extras)
     {
         if (!extra->enabled)
         {
@@ -200,23 +597,30 @@ void GameManager::setup(uint32_t inputSeed)
 {
     // Note: seed may change after loading a save file, so its important to not utilize it in rule setup.
     seed = inputSeed;
+    rulesGenerated = false;
+    RestrictionsScope restrictionsScope(getRestrictions());
 
-    for (Rule* rule : Rule::getList())
+    // Listeners are owned by the rule that added them so benchmarks can time each rule, extras follow rules.
+    for (size_t i = 0; i < rules.size(); ++i)
     {
+        Rule* rule = rules[i];
         if (!rule->enabled)
         {
             continue;
         }
+        EventOwnerScope ownerScope((int)i);
         rule->setManager(this);
         rule->setup();
     }
 
-    for (Extra* extra : Extra::getList())
+    for (size_t i = 0; i < extras.size(); ++i)
     {
+        Extra* extra = extras[i];
         if (!extra->enabled)
         {
             continue;
         }
+        EventOwnerScope ownerScope((int)(rules.size() + i));
         extra->setManager(this);
         extra->setup();
     }
@@ -250,6 +654,24 @@ void GameManager::loadSaveData()
     }
 }
 
+void GameManager::startRules()
+{
+    loadSaveData();
+
+    // Generation only needs to happen again if the save we loaded was made with a different seed.
+    IOTagScope ioScope(ioTagStart);
+    if (!rulesGenerated || seed != generatedSeed)
+    {
+        onStart.invoke();
+        rulesGenerated = true;
+        generatedSeed = seed;
+    }
+
+    onResync.invoke();
+    resetSavemapFingerprint();
+    inventoriesStale = true;
+}
+
 void GameManager::clearSaveData()
 {
     // Zero out the area.
@@ -290,6 +712,8 @@ GameManager::GameState GameManager::getState()
 bool GameManager::update()
 {
     double currentTime = Utilities::getTimeMS();
+    IOTagScope ioScope(ioTagManager);
+    RestrictionsScope restrictionsScope(getRestrictions());
     
     // If read/write errors have occurred then connection has been broken.
     if (emulator->pollErrors())
@@ -297,19 +721,29 @@ bool GameManager::update()
         return false;
     }
 
+    if (traceWriter != nullptr)
+    {
+        IOTagScope traceScope(ioTagTrace);
+        traceWriter->capture(emulator);
+    }
+
     GameState state = getState();
     {
         if (lastGameState == GameState::InGame && state != GameState::InGame)
         {
             // Clearing save data prevents stale state getting stuck from a game over.
             clearSaveData();
-            AudioManager::pauseMusic();
+
+            // Only a manager running Randomize Music owns the audio device.
+            if (isExtraEnabled("Randomize Music"))
+            {
+                AudioManager::pauseMusic();
+            }
         }
 
         if (lastGameState != GameState::InGame && state == GameState::InGame)
         {
-            loadSaveData();
-            onStart.invoke();
+            startRules();
             lastFrameUpdateTime = Utilities::getTimeMS();
         }
 
@@ -319,6 +753,8 @@ bool GameManager::update()
     // Only perform updates when we're actually in the game.
     if (state != GameState::InGame)
     {
+        processCommands(false);
+        updateStateView(state, false);
         return true;
     }
 
@@ -331,9 +767,16 @@ bool GameManager::update()
     }
 
     // Update the field script execution table.
+    memcpy(lastFieldScriptExecutionTable, fieldScriptExecutionTable, 128);
     read(FieldScriptOffsets::ExecutionTable, 128, (uint8_t*)(&fieldScriptExecutionTable[0]));
 
-    onUpdate.invoke();
+    // GUI commands are applied at a fixed point so rules always see their effects in the same update.
+    processCommands(true);
+
+    {
+        IOTagScope eventScope(ioTagUpdate);
+        onUpdate.invoke();
+    }
     
     uint8_t newGameModule = read<uint8_t>(GameOffsets::CurrentModule);
     if (newGameModule != gameModule)
@@ -342,6 +785,7 @@ bool GameManager::update()
         if (gameModule != GameModule::Battle && newGameModule == GameModule::Battle)
         {
             waitingForBattleData = true;
+            transitionTracker.begin(TransitionTracker::Type::Battle, frameNumber);
         }
 
         // Exited battle
@@ -353,11 +797,13 @@ bool GameManager::update()
         if (gameModule == GameModule::Battle && newGameModule == GameModule::Field)
         {
             waitingForFieldData = true;
+            transitionTracker.begin(TransitionTracker::Type::Field, frameNumber);
         }
 
         if (gameModule != GameModule::World && newGameModule == GameModule::World)
         {
             waitingForWorldData = true;
+            transitionTracker.begin(TransitionTracker::Type::World, frameNumber);
             lastWorldScreenFade = read<uint8_t>(GameOffsets::WorldScreenFade);
         }
 
@@ -368,6 +814,7 @@ bool GameManager::update()
             {
                 waitingForShopData = true;
                 wasInShopMenu = true;
+                transitionTracker.begin(TransitionTracker::Type::Shop, frameNumber);
             }
         }
 
@@ -395,7 +842,9 @@ bool GameManager::update()
     {
         if (waitingForBattleData && isBattleDataLoaded())
         {
-            onBattleEnter.invoke();
+            transitionTracker.dataLoaded(TransitionTracker::Type::Battle, read<uint16_t>(BattleOffsets::FormationID), frameNumber);
+            IOTagScope eventScope(ioTagTransition);
+            onBattleEnter.invokeEach([this](size_t i) { transitionTracker.listenerFinished(TransitionTracker::Type::Battle, i); });
             waitingForBattleData = false;
         }
     }
@@ -413,6 +862,7 @@ bool GameManager::update()
                 lastFieldScreenFade = read<uint16_t>(GameOffsets::FieldScreenFade);
                 waitingForFieldData = true;
                 framesInField = 0;
+                transitionTracker.begin(TransitionTracker::Type::Field, frameNumber);
             }
         }
 
@@ -423,14 +873,25 @@ bool GameManager::update()
             waitingForFieldData = true;
             framesInField = 0;
             fieldID = newFieldID;
+            transitionTracker.begin(TransitionTracker::Type::Field, frameNumber);
         }
 
         if (waitingForFieldData && isFieldDataLoaded(justConnected))
         {
             LOG("Loaded Field: %d", fieldID);
-            onFieldChanged.invoke(fieldID);
+            transitionTracker.dataLoaded(TransitionTracker::Type::Field, fieldID, frameNumber);
+            clearScriptTriggers();
+            IOTagScope eventScope(ioTagTransition);
+            onFieldChanged.invokeEach([this](size_t i) { transitionTracker.listenerFinished(TransitionTracker::Type::Field, i); }, fieldID);
             waitingForFieldData = false;
         }
+
+        if (!waitingForFieldData)
+        {
+            IOTagScope triggerScope(ioTagTriggers);
+            updateScriptTriggers();
+            updateTextTriggers();
+        }
     }
 
     if (gameModule == GameModule::World)
@@ -445,7 +906,9 @@ bool GameManager::update()
             waitingForFieldData = false;
 
             LOG("Entered world map.");
-            onWorldMapEnter.invoke();
+            transitionTracker.dataLoaded(TransitionTracker::Type::World, 0, frameNumber);
+            IOTagScope eventScope(ioTagTransition);
+            onWorldMapEnter.invokeEach([this](size_t i) { transitionTracker.listenerFinished(TransitionTracker::Type::World, i); });
             waitingForWorldData = false;
         }
     }
@@ -454,31 +917,65 @@ bool GameManager::update()
     {
         if (waitingForShopData && isShopDataLoaded())
         {
-            onShopOpened.invoke();
+            // Shops are identified by the field they're opened from.
+            transitionTracker.dataLoaded(TransitionTracker::Type::Shop, fieldID, frameNumber);
+            IOTagScope eventScope(ioTagTransition);
+            onShopOpened.invokeEach([this](size_t i) { transitionTracker.listenerFinished(TransitionTracker::Type::Shop, i); });
             waitingForShopData = false;
         }
     }
 
     uint32_t newFrameNumber = read<uint32_t>(GameOffsets::FrameNumber);
+    updateInput(newFrameNumber);
 
-    // A jump in frame number likely indicates a load game or load save state.
+    // A discontinuity in frame number likely indicates a load game or load save state.
     framesSinceReload++;
-    int frameDifference = std::abs((int)newFrameNumber - (int)frameNumber);
-    if (frameDifference > 30 && framesSinceReload > 30)
+    bool loaded = false;
+    if (newFrameNumber != frameNumber && framesSinceReload > 30 && isLoadDiscontinuity(newFrameNumber, currentTime - lastFrameUpdateTime))
     {
         double timeGap = currentTime - lastFrameUpdateTime;
-        LOG("Load detected, reloading rules %lf", timeGap);
-        loadSaveData();
-        onStart.invoke();
+        lastLoadType = classifyLoad();
+        if (lastLoadType == LoadType::SameSave)
+        {
+            LOG("Load detected, persistent state unchanged so rules are only resynced %lf", timeGap);
+            IOTagScope eventScope(ioTagStart);
+            onResync.invoke();
+            inventoriesStale = true;
+        }
+        else
+        {
+            LOG("Load detected (%s), reloading rules %lf", lastLoadType == LoadType::NewGame ? "new game" : "different save", timeGap);
+            startRules();
+        }
+
+        // A load can restore the text a window was already showing, the game state behind it is new
+        // so text triggers get to fire for it again.
+        for (auto& head : lastWindowTextHead)
+        {
+            head.fill(TextCodec::ControlCode::End);
+        }
+
         framesSinceReload = 0;
+        frameStats.loadsDetected++;
+        loaded = true;
     }
 
     // Detect change in frame number and trigger event
-    if (newFrameNumber != frameNumber)
+    bool newFrame = newFrameNumber != frameNumber;
+    if (newFrame)
     {
+        // After connecting or loading the frames in between weren't missed, we just start over from here.
+        bool restarted = loaded || frameNumber == 0 || newFrameNumber < frameNumber;
+        uint32_t elapsedFrames = restarted ? 1 : (newFrameNumber - frameNumber);
+
+        frameStats.totalFrames += elapsedFrames;
+        frameStats.missedFrames += elapsedFrames - 1;
+        frameStats.maxElapsedFrames = std::max(frameStats.maxElapsedFrames, elapsedFrames);
+        framesThisSecond += elapsedFrames;
+
         frameNumber = newFrameNumber;
         lastFrameUpdateTime = currentTime;
-        framesInField++;
+        framesInField += elapsedFrames;
 
         if (emulatorPaused)
         {
@@ -487,13 +984,225 @@ bool GameManager::update()
             emulatorPaused = false;
         }
         
-        onFrame.invoke(newFrameNumber);
+        {
+            IOTagScope eventScope(ioTagFrame);
+            onFrame.invoke(newFrameNumber, elapsedFrames);
+        }
+        {
+            IOTagScope invariantScope(ioTagInvariants);
+            updateInvariants();
+        }
+        updateInventories();
+
+        // Refresh one chunk of the savemap fingerprint per frame.
+        savemapChunkHashes[nextSavemapChunk] = hashSavemapChunk(nextSavemapChunk);
+        nextSavemapChunk = (nextSavemapChunk + 1) % SavemapChunkCount;
+
+        emulator->getIOStats().endFrame();
+    }
+
+    transitionTracker.flush();
+
+    if (currentTime - lastInvariantReportTime >= 1000.0)
+    {
+        invariantViolationsPerSecond = invariantViolations;
+        invariantViolations = 0;
+
+        frameStats.framesPerSecond = framesThisSecond;
+        fastForwarding = framesThisSecond > FastForwardFramesPerSecond;
+        framesThisSecond = 0;
+
+        lastInvariantReportTime = currentTime;
     }
 
     lastUpdateDuration = Utilities::getTimeMS() - currentTime;
+
+    // Nothing shown in the GUI changes faster than the game's own frames.
+    updateStateView(state, newFrame);
+
     return true;
 }
 
+// Building a view reads a fair amount of RAM, so it's skipped while nothing is showing one. The last view
+// is dropped then so a new request never starts from stale data.
+void GameManager::updateStateView(GameState state, bool newFrame)
+{
+    if (!stateViewRequested.load())
+    {
+        if (stateView != nullptr)
+        {
+            std::atomic_store(&stateView, std::shared_ptr<const GameStateView>());
+        }
+        return;
+    }
+
+    // Outside the game nothing in the view moves until the state itself changes.
+    if (newFrame || stateView == nullptr || stateView->state != state)
+    {
+        publishStateView(state);
+    }
+}
+
+void GameManager::publishStateView(GameState state)
+{
+    std::shared_ptr<GameStateView> newView = std::make_shared<GameStateView>();
+    newView->version = ++stateViewVersion;
+    newView->state = state;
+    newView->frameStats = frameStats;
+    newView->fastForwarding = fastForwarding;
+    newView->lastUpdateDuration = lastUpdateDuration;
+    newView->lastLoadType = lastLoadType;
+    newView->invariantViolationsPerSecond = invariantViolationsPerSecond;
+    newView->invariantCount = invariants.size();
+
+    if (state == GameState::InGame)
+    {
+        newView->frameNumber = frameNumber;
+        newView->gameModule = gameModule;
+        newView->gameMoment = read<uint16_t>(GameOffsets::GameMoment);
+        newView->fieldID = read<uint16_t>(GameOffsets::FieldID);
+        newView->musicID = read<uint16_t>(GameOffsets::MusicID);
+        newView->phsVisibilityMask = read<uint16_t>(GameOffsets::PHSVisibilityMask);
+
+        // Gil and in game time sit next to each other.
+        uint32_t gilAndTime[2];
+        read(GameOffsets::Gil, sizeof(gilAndTime), (uint8_t*)gilAndTime);
+        newView->gil = gilAndTime[0];
+        newView->inGameTime = gilAndTime[1];
+
+        newView->partyIDs = getPartyIDs();
+        for (int i = 0; i < 3; ++i)
+        {
+            if (newView->partyIDs[i] == 0xFF)
+            {
+                continue;
+            }
+
+            RecordView<CharacterRecord> character = view<CharacterRecord>(getCharacterDataOffset(newView->partyIDs[i]));
+            newView->partyHP[i] = character->currentHP;
+            newView->partyMaxHP[i] = character->maxHP;
+        }
+
+        if (gameModule == GameModule::World)
+        {
+            read(WorldOffsets::WorldX, sizeof(newView->position), (uint8_t*)newView->position.data());
+        }
+        else
+        {
+            read(FieldOffsets::FieldX, sizeof(newView->position), (uint8_t*)newView->position.data());
+            newView->triangle = read<uint16_t>(FieldOffsets::Triangle);
+        }
+
+        newView->formationID = read<uint16_t>(BattleOffsets::FormationID);
+        if (inBattle())
+        {
+            newView->formation = getBattleFormation().second;
+
+            // Enemy battle data is laid out back to back.
+            read(BattleOffsets::Enemies[0], sizeof(newView->enemies), (uint8_t*)newView->enemies.data());
+        }
+    }
+
+    std::atomic_store(&stateView, std::shared_ptr<const GameStateView>(newView));
+}
+
+// Fast forward advances the frame number quickly but steadily, a load jumps it (often backwards) and
+// changes the savemap with it. A forward jump is only treated as a load if it's larger than the current
+// frame rate can explain and the savemap doesn't look like it simply kept playing.
+bool GameManager::isLoadDiscontinuity(uint32_t newFrameNumber, double elapsedTime)
+{
+    uint32_t inGameTime = read<uint32_t>(GameOffsets::InGameTime);
+    uint32_t previousInGameTime = lastInGameTime;
+    lastInGameTime = inGameTime;
+
+    if (newFrameNumber < frameNumber)
+    {
+        return (frameNumber - newFrameNumber) > LoadFrameThreshold;
+    }
+
+    // Allow for up to 4x the frames per second we measured over the last second.
+    uint32_t frameDelta = newFrameNumber - frameNumber;
+    uint32_t expectedFrames = (uint32_t)((frameStats.framesPerSecond * std::max(elapsedTime, 1.0)) / 1000.0);
+    uint32_t threshold = std::max(LoadFrameThreshold, expectedFrames * 4);
+    if (frameDelta <= threshold)
+    {
+        return false;
+    }
+
+    // In game time is left out of the fingerprint, it advances one second per 60 frames so dividing by
+    // 30 allows twice that, plus a couple of seconds for rounding and lag.
+    if (inGameTime < previousInGameTime || (inGameTime - previousInGameTime) > (frameDelta / 30) + 2)
+    {
+        return true;
+    }
+
+    // Only a jump the frame rate can't explain is worth hashing the whole savemap for.
+    std::array<uint64_t, SavemapChunkCount> chunkHashes;
+    for (uint32_t i = 0; i < SavemapChunkCount; ++i)
+    {
+        chunkHashes[i] = hashSavemapChunk(i);
+    }
+
+    return combineSavemapHashes(chunkHashes) != combineSavemapHashes(savemapChunkHashes);
+}
+
+uint64_t GameManager::hashSavemapChunk(uint32_t chunkIndex)
+{
+    static_assert(SavemapChunkSize * SavemapChunkCount >= SavemapOffsets::Size, "Savemap chunks must cover the savemap.");
+
+    uint32_t chunkStart = chunkIndex * SavemapChunkSize;
+    uint32_t chunkSize = std::min(SavemapChunkSize, SavemapOffsets::Size - chunkStart);
+
+    uint8_t data[SavemapChunkSize];
+    read(SavemapOffsets::Start + chunkStart, chunkSize, data);
+
+    // In game time ticks constantly and isn't part of the persistent state.
+    uintptr_t timeOffset = GameOffsets::InGameTime - SavemapOffsets::Start;
+    if (timeOffset >= chunkStart && timeOffset + sizeof(uint32_t) <= chunkStart + chunkSize)
+    {
+        memset(data + (timeOffset - chunkStart), 0, sizeof(uint32_t));
+    }
+
+    return Utilities::hashBytes(data, chunkSize, chunkIndex);
+}
+
+uint64_t GameManager::combineSavemapHashes(const std::array<uint64_t, SavemapChunkCount>& chunkHashes)
+{
+    return Utilities::hashBytes((const uint8_t*)chunkHashes.data(), sizeof(uint64_t) * SavemapChunkCount);
+}
+
+void GameManager::resetSavemapFingerprint()
+{
+    for (uint32_t i = 0; i < SavemapChunkCount; ++i)
+    {
+        savemapChunkHashes[i] = hashSavemapChunk(i);
+    }
+    nextSavemapChunk = 0;
+}
+
+// Compares a fresh fingerprint of the savemap against the one we've been keeping up to date, if
+// nothing persistent changed there's no need to reinitialize rules.
+GameManager::LoadType GameManager::classifyLoad()
+{
+    uint16_t ironMogID = read<uint16_t>(SavemapOffsets::IronMogSave);
+    if (ironMogID != 0x4D49)
+    {
+        return LoadType::NewGame;
+    }
+
+    std::array<uint64_t, SavemapChunkCount> chunkHashes;
+    for (uint32_t i = 0; i < SavemapChunkCount; ++i)
+    {
+        chunkHashes[i] = hashSavemapChunk(i);
+    }
+
+    uint64_t previousFingerprint = combineSavemapHashes(savemapChunkHashes);
+    uint64_t fingerprint = combineSavemapHashes(chunkHashes);
+    savemapChunkHashes = chunkHashes;
+
+    return (fingerprint == previousFingerprint) ? LoadType::SameSave : LoadType::DifferentSave;
+}
+
 std::array<uint8_t, 3> GameManager::getPartyIDs()
 {
     std::array<uint8_t, 3> results = { 0xFF, 0xFF, 0xFF };
@@ -505,6 +1214,115 @@ std::array<uint8_t, 3> GameManager::getPartyIDs()
     return results;
 }
 
+bool GameManager::queueCommand(GameCommand command)
+{
+    if (!commandQueue.push(std::move(command)))
+    {
+        LOG("Command queue is full, command dropped.");
+        return false;
+    }
+
+    return true;
+}
+
+void GameManager::processCommands(bool inGame)
+{
+    GameCommand command;
+    if (!commandQueue.pop(command))
+    {
+        return;
+    }
+
+    IOTagScope commandScope(ioTagCommands);
+
+    // Inventory edits all go to one copy so any number of them cost one read and one write.
+    std::array<uint16_t, 320> inventory;
+    std::array<uint16_t, 320> originalInventory;
+    bool inventoryRead = false;
+
+    do
+    {
+        // Commands queued outside of the game are dropped rather than applied to whatever gets loaded next.
+        if (!inGame)
+        {
+            continue;
+        }
+
+        switch (command.type)
+        {
+        case GameCommand::Type::Write:
+            emulator->write(command.offset, &command.value, command.size);
+            break;
+
+        case GameCommand::Type::WarpToField:
+            write<uint16_t>(GameOffsets::FieldWarpID, (uint16_t)command.value);
+            write<uint8_t>(GameOffsets::FieldWarpTrigger, 1);
+            break;
+
+        case GameCommand::Type::AddGil:
+            write<uint32_t>(GameOffsets::Gil, read<uint32_t>(GameOffsets::Gil) + (uint32_t)command.value);
+            break;
+
+        case GameCommand::Type::RecoverParty:
+        {
+            std::array<uint8_t, 3> partyIDs = getPartyIDs();
+            for (uint8_t id : partyIDs)
+            {
+                if (id == 0xFF)
+                {
+                    continue;
+                }
+
+                RecordView<CharacterRecord> character = view<CharacterRecord>(getCharacterDataOffset(id));
+                character->currentHP = character->maxHP;
+                commit(character);
+            }
+            break;
+        }
+
+        case GameCommand::Type::AddItem:
+        {
+            if (!inventoryRead)
+            {
+                emulator->read(GameOffsets::Inventory, inventory.data(), sizeof(inventory));
+                originalInventory = inventory;
+                inventoryRead = true;
+            }
+
+            uint16_t addItemID = (uint16_t)command.value & 0x1FF;
+            auto it = std::find_if(inventory.begin(), inventory.end(), [&](uint16_t entry) { return entry != 0xFFFF && (entry & 0x1FF) == addItemID; });
+            if (it != inventory.end())
+            {
+                uint8_t quantity = std::min((*it >> 9) + 1, 99);
+                *it = (quantity << 9) | addItemID;
+                LOG("Cheats: increased inventory item %d to %d", addItemID, quantity);
+                break;
+            }
+
+            it = std::find(inventory.begin(), inventory.end(), 0xFFFF);
+            if (it != inventory.end())
+            {
+                *it = (1 << 9) | addItemID;
+                LOG("Cheats: added item %d to inventory", addItemID);
+            }
+            break;
+        }
+
+        case GameCommand::Type::Callback:
+            if (command.callback)
+            {
+                command.callback();
+            }
+            break;
+        }
+    } while (commandQueue.pop(command));
+
+    if (inventoryRead)
+    {
+        writeDiff(GameOffsets::Inventory, (const uint8_t*)originalInventory.data(), (const uint8_t*)inventory.data(), sizeof(inventory));
+    }
+}
+
 std::array<uint16_t, 320> GameManager::getPartyInventory()
 {
     std::array<uint16_t, 320> results;
@@ -530,6 +1348,115 @@ std::array<uint32_t, 200> GameManager::getPartyMateria()
     return results;
 }
 
+// Compares slots a word at a time and only looks at individual slots within words that changed.
+template <typename T, size_t N>
+void diffSlots(const std::array<T, N>& oldSlots, const std::array<T, N>& newSlots, const Event<uint16_t, T, T>& event)
+{
+    constexpr size_t SlotsPerWord = sizeof(uint64_t) / sizeof(T);
+    static_assert(N % SlotsPerWord == 0, "Slot arrays must be a multiple of 8 bytes.");
+
+    for (size_t w = 0; w < N; w += SlotsPerWord)
+    {
+        if (memcmp(&oldSlots[w], &newSlots[w], sizeof(uint64_t)) == 0)
+        {
+            continue;
+        }
+
+        for (size_t i = w; i < w + SlotsPerWord; ++i)
+        {
+            if (oldSlots[i] != newSlots[i])
+            {
+                event.invoke((uint16_t)i, oldSlots[i], newSlots[i]);
+            }
+        }
+    }
+}
+
+void GameManager::loadTransitionStats()
+{
+    transitionTracker.load(TransitionStatsPath);
+}
+
+void GameManager::saveTransitionStats()
+{
+    std::filesystem::create_directories("stats");
+    transitionTracker.save(TransitionStatsPath);
+}
+
+void GameManager::updateInput(uint32_t newFrameNumber)
+{
+    uint16_t newButtons = read<uint16_t>(BattleOffsets::ControllerInputs);
+    if (newButtons == buttons)
+    {
+        return;
+    }
+
+    InputEdge& edge = inputEdges[inputEdgeHead];
+    edge.sequence = ++inputSequence;
+    edge.pressed = newButtons & ~buttons;
+    edge.released = buttons & ~newButtons;
+    inputEdgeHead = (inputEdgeHead + 1) % InputEdgeCount;
+    buttons = newButtons;
+
+    if (edge.pressed != 0)
+    {
+        onButtonsPressed.invoke(edge.pressed, newFrameNumber);
+    }
+
+    if (edge.released != 0)
+    {
+        onButtonsReleased.invoke(edge.released, newFrameNumber);
+    }
+}
+
+bool GameManager::wasButtonPressed(uint16_t buttonMask, uint32_t sinceSequence)
+{
+    if ((buttons & buttonMask) != 0)
+    {
+        return true;
+    }
+
+    // Walk back from the newest edge until we reach ones the caller has already seen.
+    for (uint32_t i = 1; i <= InputEdgeCount; ++i)
+    {
+        const InputEdge& edge = inputEdges[(inputEdgeHead + InputEdgeCount - i) % InputEdgeCount];
+        if (edge.sequence <= sinceSequence)
+        {
+            break;
+        }
+
+        if ((edge.pressed & buttonMask) != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void GameManager::updateInventories()
+{
+    // Nothing needs the inventories, they're read afresh without diffing once something listens.
+    if (onItemsChanged.empty() && onMateriaChanged.empty())
+    {
+        inventoriesStale = true;
+        return;
+    }
+
+    std::array<uint16_t, 320> newInventory = getPartyInventory();
+    std::array<uint32_t, 200> newMateria = getPartyMateria();
+
+    if (!inventoriesStale)
+    {
+        diffSlots(previousInventory, newInventory, onItemsChanged);
+        diffSlots(previousMateria, newMateria, onMateriaChanged);
+    }
+
+    previousInventory = newInventory;
+    previousMateria = newMateria;
+    inventoriesStale = false;
+}
+
 uint16_t GameManager::getGameMoment()
 {
     return read<uint16_t>(GameOffsets::GameMoment);
@@ -619,7 +1546,7 @@ bool GameManager::isFieldDataLoaded(bool justConnected)
         return false;
     }
 
-    FieldData fieldData = GameData::getField(fieldID);
+    const FieldData& fieldData = GameData::getField(fieldID);
     if (!fieldData.isValid())
     {
         return false;
@@ -630,7 +1557,7 @@ bool GameManager::isFieldDataLoaded(bool justConnected)
 
     for (int i = 0; i < fieldData.items.size(); ++i)
     {
-        FieldScriptItem& item = fieldData.items[i];
+        const FieldScriptItem& item = fieldData.items[i];
         uintptr_t itemIDOffset = FieldScriptOffsets::ScriptStart + item.offset + FieldScriptOffsets::ItemID;
         uintptr_t itemQuantityOffset = FieldScriptOffsets::ScriptStart + item.offset + FieldScriptOffsets::ItemQuantity;
 
@@ -645,7 +1572,7 @@ bool GameManager::isFieldDataLoaded(bool justConnected)
 
     for (int i = 0; i < fieldData.materia.size(); ++i)
     {
-        FieldScriptItem& materia = fieldData.materia[i];
+        const FieldScriptItem& materia = fieldData.materia[i];
         uintptr_t idOffset = FieldScriptOffsets::ScriptStart + materia.offset + FieldScriptOffsets::MateriaID;
 
         uint8_t materiaID = read<uint8_t>(idOffset);
@@ -658,7 +1585,7 @@ bool GameManager::isFieldDataLoaded(bool justConnected)
 
     for (int i = 0; i < fieldData.messages.size(); ++i)
     {
-        FieldScriptMessage& message = fieldData.messages[i];
+        const FieldScriptMessage& message = fieldData.messages[i];
         uint8_t opCode = read<uint8_t>(FieldScriptOffsets::ScriptStart + message.offset);
         uint8_t endChar = read<uint8_t>(FieldScriptOffsets::ScriptStart + message.strOffset + message.strLength);
         if (opCode != 0x40 || endChar != 0xFF)
@@ -669,7 +1596,7 @@ bool GameManager::isFieldDataLoaded(bool justConnected)
 
     for (int i = 0; i < fieldData.worldExits.size(); ++i)
     {
-        FieldWorldExit& exit = fieldData.worldExits[i];
+        const FieldWorldExit& exit = fieldData.worldExits[i];
         uintptr_t exitOffset = FieldScriptOffsets::TriggersStart + exit.offset;
 
         uint16_t fieldID = read<uint8_t>(exitOffset);
@@ -690,7 +1617,7 @@ bool GameManager::isFieldDataLoaded(bool justConnected)
 
             for (int i = 0; i < 10; ++i)
             {
-                Encounter& origEncounter = fieldData.getEncounter(t, i);
+                Encounter origEncounter = fieldData.getEncounter(t, i);
                 if (origEncounter.prob == 0 && origEncounter.id == 0)
                 {
                     continue;
@@ -801,11 +1728,11 @@ bool GameManager::isWorldDataLoaded(bool justConnected)
 
     for (int r = 0; r < 16; ++r)
     {
-        WorldMapEncounters& origEncounters = GameData::worldMapEncounters[r];
+        const WorldMapEncounters& origEncounters = GameData::worldMapEncounters[r];
 
         for (int s = 0; s < 4; ++s)
         {
-            std::vector<Encounter>& origEncSet = origEncounters.sets[s];
+            const TableView<Encounter>& origEncSet = origEncounters.sets[s];
             if (origEncSet.size() == 0)
             {
                 continue;
@@ -816,7 +1743,7 @@ bool GameManager::isWorldDataLoaded(bool justConnected)
 
             for (int i = 0; i < 14; ++i)
             {
-                Encounter& origEnc = origEncSet[i];
+                const Encounter& origEnc = origEncSet[i];
                 Encounter& encData = worldMapEncounterTable[dataOffset + i];
 
                 if (origEnc.raw != encData.raw)
@@ -844,7 +1771,7 @@ bool GameManager::isWorldDataLoaded(bool justConnected)
 // the name of the item. The message is usually: Received "{itemName}"!
 int GameManager::findPickUpMessage(std::string itemName, uint8_t group, uint8_t script, uint32_t offset)
 {
-    FieldData fieldData = GameData::getField(fieldID);
+    const FieldData& fieldData = GameData::getField(fieldID);
     if (!fieldData.isValid())
     {
         return -1;
@@ -855,7 +1782,7 @@ int GameManager::findPickUpMessage(std::string itemName, uint8_t group, uint8_t
 
     for (int i = 0; i < fieldData.messages.size(); ++i)
     {
-        FieldScriptMessage& fieldMsg = fieldData.messages[i];
+        const FieldScriptMessage& fieldMsg = fieldData.messages[i];
 
         // The message is always in the same group+script as the pick up.
         if (fieldMsg.group != group || fieldMsg.script != script)
@@ -888,7 +1815,17 @@ std::string GameManager::getWindowText(uint8_t index)
     return readString(getWindowTextOffset(index), 256);
 }
 
-std::pair<BattleScene*, BattleFormation*> GameManager::getBattleFormation()
+bool GameManager::isWindowText(uint8_t index, std::string_view text)
+{
+    if (getGameModule() != GameModule::Field)
+    {
+        return false;
+    }
+
+    return compareString(getWindowTextOffset(index), 256, text);
+}
+
+std::pair<const BattleScene*, const BattleFormation*> GameManager::getBattleFormation()
 {
     if (getGameModule() != GameModule::Battle)
     {
@@ -897,14 +1834,18 @@ std::pair<BattleScene*, BattleFormation*> GameManager::getBattleFormation()
 
     uint16_t formationID = read<uint16_t>(BattleOffsets::FormationID);
 
-    for (auto& [id, scene] : GameData::battleScenes) 
+    // Each scene holds 4 formations so the scene ID can be derived from the formation ID.
+    const BattleScene* scene = GameData::getBattleScene((uint8_t)(formationID / 4));
+    if (scene == nullptr)
+    {
+        return { nullptr, nullptr };
+    }
+
+    for (const BattleFormation& formation : scene->formations)
     {
-        for (BattleFormation& formation : scene.formations)
+        if (formation.id == formationID)
         {
-            if (formation.id == formationID)
-            {
-                return { &scene, &formation };
-            }
+            return { scene, &formation };
         }
     }
 
@@ -912,16 +1853,14 @@ std::pair<BattleScene*, BattleFormation*> GameManager::getBattleFormation()
 }
 
 template <typename T>
-void multiplyStat(GameManager* game, uintptr_t offset, float multiplier)
+void multiplyStat(T& stat, float multiplier)
 {
     if (multiplier == 1.0f)
     {
         return;
     }
 
-    T stat = game->read<T>(offset);
     stat = Utilities::clampTo<T>(stat * multiplier);
-    game->write<T>(offset, stat);
 }
 
 void GameManager::applyBattleStatMultiplier(uintptr_t battleCharOffset, StatMultiplierSet& multiplierSet)
@@ -932,17 +1871,19 @@ void GameManager::applyBattleStatMultiplier(uintptr_t battleCharOffset, StatMult
         return;
     }
 
-    multiplyStat<uint32_t>(this, battleCharOffset + BattleOffsets::CurrentHP, multiplierSet.currentHP);
-    multiplyStat<uint32_t>(this, battleCharOffset + BattleOffsets::MaxHP, multiplierSet.maxHP);
-    multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::CurrentMP, multiplierSet.currentMP);
-    multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::MaxMP, multiplierSet.maxMP);
-    multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Strength, multiplierSet.strength);
-    multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Magic, multiplierSet.magic);
-    multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Evade, multiplierSet.evade);
-    multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Speed, multiplierSet.speed);
-    multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Luck, multiplierSet.luck);
-    multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::Defense, multiplierSet.defense);
-    multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::MDefense, multiplierSet.mDefense);
+    RecordView<BattleCharacter> battleChar = view<BattleCharacter>(battleCharOffset);
+    multiplyStat(battleChar->currentHP, multiplierSet.currentHP);
+    multiplyStat(battleChar->maxHP, multiplierSet.maxHP);
+    multiplyStat(battleChar->currentMP, multiplierSet.currentMP);
+    multiplyStat(battleChar->maxMP, multiplierSet.maxMP);
+    multiplyStat(battleChar->strength, multiplierSet.strength);
+    multiplyStat(battleChar->magic, multiplierSet.magic);
+    multiplyStat(battleChar->evade, multiplierSet.evade);
+    multiplyStat(battleChar->speed, multiplierSet.speed);
+    multiplyStat(battleChar->luck, multiplierSet.luck);
+    multiplyStat(battleChar->defense, multiplierSet.defense);
+    multiplyStat(battleChar->mDefense, multiplierSet.mDefense);
+    commit(battleChar);
 }
 
 void GameManager::applyBattleStatMultiplier(uintptr_t battleCharOffset, float multiplier, bool applyToHP, bool applyToMP, bool applyToStats)
@@ -953,26 +1894,59 @@ void GameManager::applyBattleStatMultiplier(uintptr_t battleCharOffset, float mu
         return;
     }
 
+    RecordView<BattleCharacter> battleChar = view<BattleCharacter>(battleCharOffset);
+
     if (applyToHP)
     {
-        multiplyStat<uint32_t>(this, battleCharOffset + BattleOffsets::CurrentHP, multiplier);
-        multiplyStat<uint32_t>(this, battleCharOffset + BattleOffsets::MaxHP, multiplier);
+        multiplyStat(battleChar->currentHP, multiplier);
+        multiplyStat(battleChar->maxHP, multiplier);
     }
 
     if (applyToMP)
     {
-        multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::CurrentMP, multiplier);
-        multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::MaxMP, multiplier);
+        multiplyStat(battleChar->currentMP, multiplier);
+        multiplyStat(battleChar->maxMP, multiplier);
     }
 
     if (applyToStats)
     {
-        multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Strength, multiplier);
-        multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Magic, multiplier);
-        multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Evade, multiplier);
-        multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Speed, multiplier);
-        multiplyStat<uint8_t>(this, battleCharOffset + BattleOffsets::Luck, multiplier);
-        multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::Defense, multiplier);
-        multiplyStat<uint16_t>(this, battleCharOffset + BattleOffsets::MDefense, multiplier);
+        multiplyStat(battleChar->strength, multiplier);
+        multiplyStat(battleChar->magic, multiplier);
+        multiplyStat(battleChar->evade, multiplier);
+        multiplyStat(battleChar->speed, multiplier);
+        multiplyStat(battleChar->luck, multiplier);
+        multiplyStat(battleChar->defense, multiplier);
+        multiplyStat(battleChar->mDefense, multiplier);
+    }
+
+    commit(battleChar);
+}
+
+void GameManager::writeDiff(uintptr_t offset, const uint8_t* original, const uint8_t* data, uintptr_t size)
+{
+    // Unchanged gaps shorter than this are written through rather than splitting the write.
+    const uintptr_t maxGap = 8;
+
+    uintptr_t i = 0;
+    while (i < size)
+    {
+        if (original[i] == data[i])
+        {
+            i++;
+            continue;
+        }
+
+        uintptr_t start = i;
+        uintptr_t end = i + 1;
+        for (uintptr_t j = end; j < size && j - end < maxGap; ++j)
+        {
+            if (original[j] != data[j])
+            {
+                end = j + 1;
+            }
+        }
+
+        emulator->write(offset + start, (void*)(data + start), end - start);
+        i = end;
     }
 }
\ No newline at end of file
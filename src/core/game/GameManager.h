@@ -1,13 +1,39 @@
 #pragma once
 
 #include "core/emulators/Emulator.h"
+#include "core/emulators/RAMTrace.h"
 #include "core/game/GameData.h"
+#include "core/game/MemoryStructs.h"
+#include "core/game/TransitionTracker.h"
 #include "core/utilities/Event.h"
+#include "core/utilities/SPSCQueue.h"
+#include <cstring>
 #include <string>
+#include <string_view>
 #include <array>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
+class ConfigFile;
 class Extra;
 class Rule;
+struct RestrictionList;
+
+// A copy of a record in emulator memory along with the values it was read with, so only
+// the bytes that were changed need to be written back.
+template <typename T>
+struct RecordView
+{
+    uintptr_t offset = 0;
+    T value{};
+    T original{};
+
+    T* operator->() { return &value; }
+    const T* operator->() const { return &value; }
+    bool isDirty() const { return memcmp(&value, &original, sizeof(T)) != 0; }
+};
 
 class GameManager
 {
@@ -26,22 +52,140 @@ public:
     bool connectToEmulator(std::string processName);
     bool connectToEmulator(std::string processName, uintptr_t memoryAddress);
 
+    // Takes ownership of an emulator created elsewhere, eg a ReplayEmulator, and connects it to the target.
+    bool connectToEmulator(Emulator* customEmulator, std::string target);
+
     bool isRuleEnabled(std::string ruleName);
     Rule* getRule(std::string ruleName);
     bool isExtraEnabled(std::string extraName);
     Extra* getExtra(std::string extraName);
     std::string getSettingsSummary();
 
+    // Applies the enabled state and settings of every registered rule and extra from a settings file.
+    static void loadRuleSettings(ConfigFile& cfg);
+
+    // Gives this manager its own copy of every registered rule and extra, as they're currently set up,
+    // along with its own restrictions so several managers can run in one process. Call before setup().
+    void cloneRules();
+    const std::vector<Rule*>& getRules() { return rules; }
+    const std::vector<Extra*>& getExtras() { return extras; }
+
     void setup(uint32_t inputSeed);
     void loadSaveData();
     void clearSaveData();
+
+    // Loads save data then fires onStart if the seed hasn't been generated for yet, followed by onResync.
+    void startRules();
     inline uint32_t getSeed() { return seed; }
     GameState getState();
     bool update();
 
+    // Returns the state seen by the last update(), safe to call from any thread.
+    GameState getLastState() const { return lastGameState.load(); }
+
     // Returns how long the last update() took in ms.
     double getLastUpdateDuration() { return lastUpdateDuration; }
 
+    // Frame accounting, frames are missed when more than one frame passes between updates.
+    struct FrameStats
+    {
+        uint64_t totalFrames = 0;
+        uint64_t missedFrames = 0;
+        uint32_t maxElapsedFrames = 0;
+        uint32_t loadsDetected = 0;
+        uint32_t framesPerSecond = 0;
+    };
+    const FrameStats& getFrameStats() { return frameStats; }
+
+    // True while the emulator is running well above normal speed, eg fast forward.
+    bool isFastForwarding() { return fastForwarding; }
+
+    // How the last detected load was classified using the savemap fingerprint.
+    enum class LoadType : int
+    {
+        None          = 0,
+        NewGame       = 1, // No IronMog save data was present
+        SameSave      = 2, // Persistent state is identical to before the load, rules are left alone
+        DifferentSave = 3
+    };
+    LoadType getLastLoadType() { return lastLoadType; }
+
+    // A copy of commonly displayed game state, built by the manager thread once per frame so the GUI
+    // can show it without touching emulator memory. Published views are never modified.
+    struct GameStateView
+    {
+        uint32_t version = 0; // Increments with every published view
+        GameState state = GameState::BootScreen;
+        uint32_t frameNumber = 0;
+        uint32_t inGameTime = 0;
+        uint32_t gil = 0;
+        uint16_t gameMoment = 0;
+        uint8_t gameModule = 0;
+        uint16_t fieldID = 0;
+        uint16_t formationID = 0;
+        uint16_t musicID = 0;
+        uint16_t phsVisibilityMask = 0;
+
+        std::array<uint8_t, 3> partyIDs = { 0xFF, 0xFF, 0xFF };
+        std::array<uint16_t, 3> partyHP{};
+        std::array<uint16_t, 3> partyMaxHP{};
+
+        // World coordinates on the world map, otherwise field coordinates and the walkmesh triangle.
+        std::array<int32_t, 3> position{};
+        uint16_t triangle = 0;
+
+        const BattleFormation* formation = nullptr;
+        std::array<BattleCharacter, 6> enemies{};
+
+        FrameStats frameStats;
+        bool fastForwarding = false;
+        double lastUpdateDuration = 0.0;
+        LoadType lastLoadType = LoadType::None;
+        uint32_t invariantViolationsPerSecond = 0;
+        size_t invariantCount = 0;
+    };
+
+    // Returns the last published state view, safe to call from any thread. Views are only built while
+    // requested, otherwise this returns null.
+    std::shared_ptr<const GameStateView> getStateView() const { return std::atomic_load(&stateView); }
+    void setStateViewRequested(bool requested) { stateViewRequested = requested; }
+
+    // An action requested by the GUI, applied by the manager thread at the start of its next in game update.
+    struct GameCommand
+    {
+        enum class Type : uint8_t
+        {
+            Write,        // Writes size bytes of value to offset
+            WarpToField,  // value is the field ID
+            AddGil,       // value is the amount to add
+            RecoverParty, // Sets the party's HP to max
+            AddItem,      // value is the item ID, adds one to the inventory
+            Callback      // Runs callback on the manager thread, for rule specific actions
+        };
+
+        Type type = Type::Write;
+        uintptr_t offset = 0;
+        uint8_t size = 0;
+        uint64_t value = 0;
+        std::function<void()> callback;
+    };
+
+    // Queues a command to be applied on the manager thread, must only be called from the GUI thread.
+    // Returns false if the queue is full.
+    bool queueCommand(GameCommand command);
+
+    template <typename T>
+    bool queueWrite(uintptr_t offset, T value)
+    {
+        static_assert(sizeof(T) <= sizeof(uint64_t), "Queued writes are limited to 8 bytes.");
+
+        GameCommand command;
+        command.offset = offset;
+        command.size = (uint8_t)sizeof(T);
+        memcpy(&command.value, &value, sizeof(T));
+        return queueCommand(std::move(command));
+    }
+
     // Returns a byte representing what module the game is. eg Field, Battle, World, etc
     uint8_t getGameModule() { return gameModule; }
     uint16_t getGameMoment();
@@ -50,24 +194,43 @@ public:
     uint16_t getFieldID() { return fieldID; }
     int getFramesInField() { return framesInField; }
 
+    // True once the current field's script, exits and encounters match GameData and the screen has
+    // started fading in. Called every update while waiting for a field to load.
+    bool isFieldDataLoaded(bool justConnected = false);
+
     // Returns a list of the character IDs that are currently in the party. 0xFF is the slot is empty.
     std::array<uint8_t, 3> getPartyIDs();
 
     // Returns a list of item IDs currently in the party's possession.
+    // Entries are packed as (quantity << 9) | itemID.
     std::array<uint16_t, 320> getPartyInventory();
     void setInventorySlot(uint32_t slotIndex, uint16_t itemID, uint8_t quantity);
 
     // Returns a list of materia IDs currently in the party's possession.
     std::array<uint32_t, 200> getPartyMateria();
 
+    // Controller buttons held as of the last update, bitflags are stable even if buttons are remapped.
+    uint16_t getButtons() { return buttons; }
+
+    // Counts every button edge seen, callers keep the value from their last check to pass to wasButtonPressed.
+    uint32_t getInputSequence() { return inputSequence; }
+
+    // True if any of the buttons are held now or were pressed in an edge after the given input sequence.
+    // Edges are sampled every update so a quick tap still counts even if no frame event saw it held,
+    // including taps sampled later within the frame the caller last checked on.
+    bool wasButtonPressed(uint16_t buttonMask, uint32_t sinceSequence);
+
     // Finds the nearest message that contains the item name
     int findPickUpMessage(std::string itemName, uint8_t group, uint8_t script, uint32_t offset);
 
     // Returns the last text displayed in a window
     std::string getWindowText(uint8_t index);
 
+    // Compares the last text displayed in a window without decoding it.
+    bool isWindowText(uint8_t index, std::string_view text);
+
     // Returns the current battle scene and formation.
-    std::pair<BattleScene*, BattleFormation*> getBattleFormation();
+    std::pair<const BattleScene*, const BattleFormation*> getBattleFormation();
 
     // Given an offset to a battle character this function will apply a multiplier to each of the chosen stats.
     void applyBattleStatMultiplier(uintptr_t battleCharOffset, StatMultiplierSet& multiplierSet);
@@ -76,21 +239,73 @@ public:
     // Returns the pointer to the line of field script last executed for a given group index.
     uint16_t getScriptExecutionPointer(uint8_t groupIndex) { return fieldScriptExecutionTable[groupIndex]; }
 
+    // Registers a callback that fires on the update where the field script of a group first lands on the given offset.
+    // Script triggers are field specific and are cleared whenever the field changes.
+    void addScriptTrigger(uint8_t groupIndex, uint16_t offset, std::function<void()> callback);
+
+    // Same as above but writes the string (encoded once, here) to the given address when the trigger fires,
+    // and rewrites it if it's changed for as long as the group's script stays on the offset.
+    void addScriptTextTrigger(uint8_t groupIndex, uint16_t offset, uintptr_t address, uint32_t length, const std::string& string, bool centerAlign = false);
+    void clearScriptTriggers();
+
+    // Registers a callback that fires when a window starts displaying the given text. The text is
+    // fingerprinted once here and windows are only re-read when the start of their text changes, or
+    // after a load. Unlike script triggers these persist across fields.
+    void addTextTrigger(uint8_t windowIndex, const std::string& text, std::function<void()> callback);
+    void clearTextTriggers();
+
+    // Declares that the value at an address must equal the given value while the condition returns true, or
+    // always if no condition is given. Invariants are checked together once per frame after onFrame and 
+    // only the values that don't match are written.
+    template <typename T>
+    void addInvariant(uintptr_t offset, T value, std::function<bool()> condition = nullptr)
+    {
+        static_assert(sizeof(T) <= sizeof(uint64_t), "Invariant values are limited to 8 bytes.");
+
+        uint64_t rawValue = 0;
+        memcpy(&rawValue, &value, sizeof(T));
+        addInvariant(offset, (uint8_t)sizeof(T), rawValue, condition);
+    }
+    void clearInvariants();
+
+    size_t getInvariantCount() { return invariants.size(); }
+
+    // Counts of every read and write made to emulator memory.
+    IOStats& getIOStats() { return emulator->getIOStats(); }
+
+    // Timing of module transitions, from the module change until rules have patched the new data.
+    // Managers start with no stats; loading continues the saved ones and saving overwrites the file.
+    static constexpr const char* TransitionStatsPath = "stats/Transition Stats.cfg";
+    TransitionTracker& getTransitionTracker() { return transitionTracker; }
+    void loadTransitionStats();
+    void saveTransitionStats();
+
+    // Records RAM at the start of every update while set, for replaying later. The writer isn't owned.
+    void setTraceWriter(RAMTrace::Writer* writer) { traceWriter = writer; }
+
+    // Returns how many invariants were found violated and rewritten over the last second.
+    uint32_t getInvariantViolationsPerSecond() { return invariantViolationsPerSecond; }
+
     // Returns pointer to the captured state of the world map encounter table after entering world map
     Encounter* getWorldMapEncounterTable() { return worldMapEncounterTable; }
 
     // Events
-    Event<> onStart;
+    Event<> onStart;  // Seed dependent generation, only fires when the seed changes.
+    Event<> onResync; // Fires after every load, rules re-read any state they derive from RAM.
     Event<> onUpdate;
     Event<> onEmulatorPaused;
     Event<> onEmulatorResumed;
-    Event<int> onFrame;
+    Event<uint32_t, uint32_t> onFrame; // frame number, frames elapsed since the last onFrame
     Event<uint8_t> onModuleChanged;
     Event<> onBattleEnter;
     Event<> onBattleExit;
     Event<uint16_t> onFieldChanged;
     Event<> onShopOpened;
     Event<> onWorldMapEnter;
+    Event<uint16_t, uint32_t> onButtonsPressed;  // newly pressed buttons, frame number
+    Event<uint16_t, uint32_t> onButtonsReleased; // newly released buttons, frame number
+    Event<uint16_t, uint16_t, uint16_t> onItemsChanged;   // slot, old entry, new entry
+    Event<uint16_t, uint32_t, uint32_t> onMateriaChanged; // slot, old materia, new materia
 
     // Read/Write RAM Functions
     template <typename T>
@@ -117,19 +332,121 @@ public:
         emulator->write(offset, dataIn, size);
     }
 
+    // Fetches a whole record in a single read, see MemoryStructs.h for layouts.
+    template <typename T>
+    RecordView<T> view(uintptr_t offset)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Record views must be trivially copyable.");
+
+        RecordView<T> record;
+        record.offset = offset;
+        emulator->read(offset, &record.value, sizeof(T));
+        record.original = record.value;
+        return record;
+    }
+
+    // Writes back only the bytes of the record that differ from when it was read.
+    template <typename T>
+    void commit(RecordView<T>& record)
+    {
+        writeDiff(record.offset, (const uint8_t*)&record.original, (const uint8_t*)&record.value, sizeof(T));
+        record.original = record.value;
+    }
+
+    // Writes the ranges where data differs from original, nearby ranges are merged into one write.
+    void writeDiff(uintptr_t offset, const uint8_t* original, const uint8_t* data, uintptr_t size);
+
     std::string readString(uintptr_t offset, uint32_t length);
     void writeString(uintptr_t offset, uint32_t length, const std::string& string, bool centerAlign = false);
 
+    // Zero allocation comparisons against text in RAM, length is capped at TextCodec::MaxLength.
+    bool compareString(uintptr_t offset, uint32_t length, std::string_view string);
+    bool compareEncoded(uintptr_t offset, const uint8_t* encoded, uint32_t length);
+
 private:
     Emulator* emulator;
 
-    GameState lastGameState = GameState::BootScreen;
+    // The registered rules and extras unless cloneRules() was called.
+    std::vector<Rule*> rules;
+    std::vector<Extra*> extras;
+    bool ownsRules = false;
+
+    // Null when using the process wide restrictions.
+    std::unique_ptr<RestrictionList> restrictions;
+    RestrictionList* getRestrictions();
+
+    std::atomic<GameState> lastGameState = GameState::BootScreen;
     bool emulatorPaused = false;
     double lastUpdateDuration = 0.0;
     uint32_t seed = 0;
     uint8_t gameModule = 0;
     uint32_t frameNumber = 0;
     double lastFrameUpdateTime = 0.0;
+
+    // A forward jump in frame number larger than this, that turbo can't account for, is treated as a load.
+    static constexpr uint32_t LoadFrameThreshold = 30;
+
+    // Normal speed is 60 frames per second, anything above this is considered fast forward.
+    static constexpr uint32_t FastForwardFramesPerSecond = 90;
+
+    FrameStats frameStats;
+    bool fastForwarding = false;
+    uint32_t framesThisSecond = 0;
+    uint32_t lastInGameTime = 0;
+    bool isLoadDiscontinuity(uint32_t newFrameNumber, double elapsedTime);
+
+    // The savemap is hashed in chunks, one chunk is refreshed per frame so the fingerprint is never
+    // more than a few frames old when a load is detected.
+    static constexpr uint32_t SavemapChunkSize = 1024;
+    static constexpr uint32_t SavemapChunkCount = 5;
+    std::array<uint64_t, SavemapChunkCount> savemapChunkHashes{};
+    uint32_t nextSavemapChunk = 0;
+    LoadType lastLoadType = LoadType::None;
+    uint64_t hashSavemapChunk(uint32_t chunkIndex);
+    uint64_t combineSavemapHashes(const std::array<uint64_t, SavemapChunkCount>& chunkHashes);
+    void resetSavemapFingerprint();
+    LoadType classifyLoad();
+
+    bool rulesGenerated = false;
+    uint32_t generatedSeed = 0;
+
+    // Inventories from the previous frame, diffed each frame to fire the changed events.
+    // They're marked stale after a load so the loaded inventory isn't reported as changes.
+    std::array<uint16_t, 320> previousInventory{};
+    std::array<uint32_t, 200> previousMateria{};
+    bool inventoriesStale = true;
+    void updateInventories();
+
+    struct InputEdge
+    {
+        uint32_t sequence = 0;
+        uint16_t pressed = 0;
+        uint16_t released = 0;
+    };
+
+    // Recent button edges, newest at inputEdgeHead - 1. Sequences start at 1 and never go backwards,
+    // unlike frame numbers which restart on load.
+    static constexpr uint32_t InputEdgeCount = 32;
+    std::array<InputEdge, InputEdgeCount> inputEdges{};
+    uint32_t inputEdgeHead = 0;
+    uint32_t inputSequence = 0;
+    uint16_t buttons = 0;
+    void updateInput(uint32_t newFrameNumber);
+
+    TransitionTracker transitionTracker;
+    RAMTrace::Writer* traceWriter = nullptr;
+
+    std::shared_ptr<const GameStateView> stateView;
+    uint32_t stateViewVersion = 0;
+    std::atomic<bool> stateViewRequested = false;
+    void updateStateView(GameState state, bool newFrame);
+    void publishStateView(GameState state);
+
+    // GUI thread produces, the manager thread consumes in processCommands().
+    static constexpr size_t CommandQueueSize = 64;
+    SPSCQueue<GameCommand, CommandQueueSize> commandQueue;
+    void processCommands(bool inGame);
+
     int framesSinceReload = 0;
     uint16_t fieldID = 0;
     int framesInField = 0;
@@ -137,13 +454,81 @@ private:
 
     // A set of pointers to the last line of field script executed within each group. 
     uint16_t fieldScriptExecutionTable[64];
+    uint16_t lastFieldScriptExecutionTable[64];
+
+    struct ScriptTrigger
+    {
+        uint16_t offset = 0;
+        std::function<void()> callback;
+
+        // Optional pre-encoded data written when the trigger fires.
+        uintptr_t payloadAddress = 0;
+        uint32_t payloadLength = 0;
+        std::array<uint8_t, 256> payload{};
+    };
+
+    // Triggers indexed by group, the masks track which groups have any registered and which have payloads.
+    std::array<std::vector<ScriptTrigger>, 64> scriptTriggers;
+    uint64_t scriptTriggerMask = 0;
+    uint64_t scriptPayloadMask = 0;
+    void updateScriptTriggers();
+
+    static constexpr int WindowCount = 8;
+    static constexpr int WindowTextHeadSize = 32;
+
+    struct TextTrigger
+    {
+        uint64_t hash = 0;
+        std::string text;
+        std::function<void()> callback;
+    };
+
+    // Triggers indexed by window, the first bytes of each window's text are kept to detect changes.
+    std::array<std::vector<TextTrigger>, WindowCount> textTriggers;
+    std::array<std::array<uint8_t, WindowTextHeadSize>, WindowCount> lastWindowTextHead{};
+    uint8_t textTriggerMask = 0;
+    void updateTextTriggers();
+
+    struct MemoryInvariant
+    {
+        uintptr_t offset = 0;
+        uint8_t size = 0;
+        uint64_t value = 0;
+        std::function<bool()> condition;
+    };
+
+    // Invariants close enough together are read with a single read.
+    struct InvariantSpan
+    {
+        uintptr_t offset = 0;
+        uint32_t size = 0;
+        size_t first = 0;
+        size_t count = 0;
+    };
+
+    // A read costs far more than the bytes in it, so gaps up to a character record are read through
+    // as long as the span stays within the byte budget.
+    static constexpr uint32_t InvariantMaxGap = 256;
+    static constexpr uint32_t InvariantMaxSpan = 2048;
+
+    // Kept sorted by offset, spans are rebuilt whenever an invariant is added.
+    std::vector<MemoryInvariant> invariants;
+    std::vector<InvariantSpan> invariantSpans;
+    std::vector<uint8_t> invariantBuffer;
+    std::vector<uint8_t> invariantActive;
+    bool invariantSpansDirty = false;
+    uint32_t invariantViolations = 0;
+    uint32_t invariantViolationsPerSecond = 0;
+    double lastInvariantReportTime = 0.0;
+    void addInvariant(uintptr_t offset, uint8_t size, uint64_t value, std::function<bool()> condition);
+    void buildInvariantSpans();
+    void updateInvariants();
 
     bool waitingForBattleData = false;
     bool isBattleDataLoaded();
 
     bool waitingForFieldData = false;
     int lastFieldScreenFade = 0;
-    bool isFieldDataLoaded(bool justConnected = false);
 
     bool waitingForShopData = false;
     bool wasInShopMenu = false;
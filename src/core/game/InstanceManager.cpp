@@ -0,0 +1,196 @@
+#include "InstanceManager.h"
+#include "core/utilities/Logging.h"
+#include "core/utilities/Utilities.h"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+InstanceManager::InstanceManager(uint32_t workerCount)
+    : workerCount(std::max(workerCount, 1u))
+{
+}
+
+InstanceManager::~InstanceManager()
+{
+    stop();
+}
+
+GameManager* InstanceManager::addInstance(const std::string& name, const std::string& processName, uintptr_t memoryAddress, uint32_t seed)
+{
+    if (running.load())
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<Instance> instance = std::make_unique<Instance>();
+    instance->name = name;
+    instance->game = std::make_unique<GameManager>();
+    instance->game->cloneRules();
+
+    bool connected = false;
+    if (memoryAddress != 0)
+    {
+        connected = instance->game->connectToEmulator(processName, memoryAddress);
+    }
+    else
+    {
+        connected = instance->game->connectToEmulator(processName);
+    }
+
+    if (!connected)
+    {
+        LOG("%s: Failed to connect to %s.", name.c_str(), processName.c_str());
+        return nullptr;
+    }
+
+    LOG("%s: Connected to %s.", name.c_str(), processName.c_str());
+    instance->game->setup(seed);
+
+    GameManager* game = instance->game.get();
+    instances.push_back(std::move(instance));
+    return game;
+}
+
+void InstanceManager::start()
+{
+    if (running.load())
+    {
+        return;
+    }
+
+    double currentTime = Utilities::getTimeMS();
+    for (auto& instance : instances)
+    {
+        instance->nextUpdateTime = currentTime;
+    }
+
+    running = true;
+    uint32_t threadCount = std::min<uint32_t>(workerCount, (uint32_t)std::max<size_t>(instances.size(), 1));
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        workers.emplace_back(&InstanceManager::runWorker, this);
+    }
+}
+
+void InstanceManager::stop()
+{
+    if (!running.load())
+    {
+        return;
+    }
+
+    running = false;
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+
+    // Every instance shares one stats file, so their stats are added to the saved ones and written once.
+    if (!instances.empty())
+    {
+        TransitionTracker combined;
+        combined.load(GameManager::TransitionStatsPath);
+        for (const auto& instance : instances)
+        {
+            combined.merge(instance->game->getTransitionTracker());
+        }
+
+        std::filesystem::create_directories("stats");
+        combined.save(GameManager::TransitionStatsPath);
+    }
+}
+
+bool InstanceManager::hasConnectedInstances()
+{
+    return std::any_of(instances.begin(), instances.end(), [](const auto& instance) { return instance->connected.load(); });
+}
+
+void InstanceManager::runWorker()
+{
+    while (running.load())
+    {
+        bool updated = false;
+        for (auto& instance : instances)
+        {
+            double currentTime = Utilities::getTimeMS();
+            if (!instance->connected.load() || currentTime < instance->nextUpdateTime.load())
+            {
+                continue;
+            }
+
+            // Another worker already has it.
+            bool expected = false;
+            if (!instance->busy.compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            updateInstance(*instance, currentTime);
+            instance->busy.store(false, std::memory_order_release);
+            updated = true;
+        }
+
+        if (!updated)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+void InstanceManager::updateInstance(Instance& instance, double currentTime)
+{
+    double lag = std::max(currentTime - instance.nextUpdateTime.load(), 0.0);
+
+    if (!instance.game->update())
+    {
+        LOG("%s: Connection lost.", instance.name.c_str());
+        instance.connected = false;
+        return;
+    }
+
+    double endTime = Utilities::getTimeMS();
+    double duration = endTime - currentTime;
+
+    instance.updates.store(instance.updates.load() + 1);
+    instance.totalUpdateMS.store(instance.totalUpdateMS.load() + duration);
+    instance.maxUpdateMS.store(std::max(instance.maxUpdateMS.load(), duration));
+    instance.totalLagMS.store(instance.totalLagMS.load() + lag);
+    instance.maxLagMS.store(std::max(instance.maxLagMS.load(), lag));
+
+    // Poll as fast as we can during fast forward so time critical rules keep up.
+    instance.nextUpdateTime = instance.game->isFastForwarding() ? endTime : endTime + PollIntervalMS;
+}
+
+std::vector<InstanceManager::InstanceStats> InstanceManager::getStats()
+{
+    std::vector<InstanceStats> result;
+    for (auto& instance : instances)
+    {
+        InstanceStats stats;
+        stats.name = instance->name;
+        stats.connected = instance->connected.load();
+        stats.updates = instance->updates.load();
+        stats.maxUpdateMS = instance->maxUpdateMS.load();
+        stats.maxLagMS = instance->maxLagMS.load();
+        if (stats.updates > 0)
+        {
+            stats.averageUpdateMS = instance->totalUpdateMS.load() / stats.updates;
+            stats.averageLagMS = instance->totalLagMS.load() / stats.updates;
+        }
+        result.push_back(stats);
+    }
+
+    return result;
+}
+
+void InstanceManager::logStats()
+{
+    for (const InstanceStats& stats : getStats())
+    {
+        LOG("%s: %s, %llu updates, update avg %.3lfms max %.3lfms, lag avg %.3lfms max %.3lfms", stats.name.c_str(),
+            stats.connected ? "connected" : "disconnected", (unsigned long long)stats.updates,
+            stats.averageUpdateMS, stats.maxUpdateMS, stats.averageLagMS, stats.maxLagMS);
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "core/game/GameManager.h"
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Runs several games in one process, eg for races. Each instance has its own GameManager with its
+// own copy of the rules and restrictions, GameData is shared. Instances are polled by a small pool
+// of worker threads, an idle worker picks up whichever instance is due next.
+class InstanceManager
+{
+public:
+    struct InstanceStats
+    {
+        std::string name;
+        bool connected = false;
+        uint64_t updates = 0;
+        double averageUpdateMS = 0.0;
+        double maxUpdateMS = 0.0;
+
+        // How late updates started after they were due, grows when the pool is too small.
+        double averageLagMS = 0.0;
+        double maxLagMS = 0.0;
+    };
+
+    InstanceManager(uint32_t workerCount);
+    ~InstanceManager();
+
+    // Connects a new game using the registered rules as they're currently set up, then runs their setup.
+    // A memory address of 0 detects the emulator from the process name. Only valid while stopped.
+    GameManager* addInstance(const std::string& name, const std::string& processName, uintptr_t memoryAddress, uint32_t seed);
+    size_t getInstanceCount() { return instances.size(); }
+
+    void start();
+    void stop();
+
+    // True while any instance is still connected.
+    bool hasConnectedInstances();
+
+    std::vector<InstanceStats> getStats();
+    void logStats();
+
+private:
+    struct Instance
+    {
+        std::string name;
+        std::unique_ptr<GameManager> game;
+
+        // Held by the worker updating the instance.
+        std::atomic<bool> busy{ false };
+        std::atomic<bool> connected{ true };
+        std::atomic<double> nextUpdateTime{ 0.0 };
+
+        // Only written by the worker holding busy.
+        std::atomic<uint64_t> updates{ 0 };
+        std::atomic<double> totalUpdateMS{ 0.0 };
+        std::atomic<double> maxUpdateMS{ 0.0 };
+        std::atomic<double> totalLagMS{ 0.0 };
+        std::atomic<double> maxLagMS{ 0.0 };
+    };
+
+    // Matches the single game loop, fast forwarding instances are polled continuously.
+    static constexpr double PollIntervalMS = 1.0;
+
+    std::vector<std::unique_ptr<Instance>> instances;
+    std::vector<std::thread> workers;
+    uint32_t workerCount = 1;
+    std::atomic<bool> running{ false };
+
+    void runWorker();
+    void updateInstance(Instance& instance, double currentTime);
+};
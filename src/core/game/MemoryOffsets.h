@@ -397,6 +397,7 @@ struct ShopOffsets
 struct SavemapOffsets
 {
     CONST_PTR Start = 0x9C6E4;
+    static constexpr uint32_t Size = 0x10F4;
 
     // These are IronMog specific values we store and fetch from an unused spot in the save map.
     // This area from 0x0B5C to 0x0B7C is 32 bytes of unused data.
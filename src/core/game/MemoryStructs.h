@@ -0,0 +1,131 @@
+#pragma once
+#include "core/game/MemoryOffsets.h"
+#include <cstddef>
+#include <cstdint>
+
+// Packed layouts of PS1 records so a whole record can be fetched with a single read, see GameManager::view.
+// Each field is checked against its loose offset in MemoryOffsets.h.
+
+#pragma pack(push, 1)
+
+// Character record in the save map, 132 bytes.
+struct CharacterRecord
+{
+    uint8_t id;
+    uint8_t level;
+    uint8_t strength;
+    uint8_t vitality;
+    uint8_t magic;
+    uint8_t spirit;
+    uint8_t dexterity;
+    uint8_t luck;
+    uint8_t strengthBonus;
+    uint8_t vitalityBonus;
+    uint8_t magicBonus;
+    uint8_t spiritBonus;
+    uint8_t dexterityBonus;
+    uint8_t luckBonus;
+    uint8_t currentLimitLevel;
+    uint8_t currentLimitBar;
+    uint8_t name[28];
+    uint16_t currentHP;
+    uint8_t unknown0[10];
+    uint16_t maxHP;
+    uint8_t unknown1[6];
+    uint32_t weaponMateria[8];
+    uint32_t armorMateria[8];
+    uint8_t unknown2[4];
+};
+
+// Battle character data shared by allies and enemies, 104 bytes.
+struct BattleCharacter
+{
+    uint16_t status;
+    uint8_t unknown0[7];
+    uint8_t level;
+    uint8_t unknown1[3];
+    uint8_t strength;
+    uint8_t magic;
+    uint8_t evade;
+    uint8_t unknown2[4];
+    uint8_t speed;
+    uint8_t luck;
+    uint8_t unknown3[10];
+    uint16_t defense;
+    uint16_t mDefense;
+    uint8_t unknown4[4];
+    uint16_t currentMP;
+    uint16_t maxMP;
+    uint32_t currentHP;
+    uint32_t maxHP;
+    uint8_t unknown5[36];
+    uint32_t gil;
+    uint32_t exp;
+    uint8_t unknown6[8];
+};
+
+// Static enemy data for the loaded battle scene, 184 bytes.
+struct BattleSceneEnemy
+{
+    uint8_t name[32];
+    uint8_t level;
+    uint8_t speed;
+    uint8_t luck;
+    uint8_t evade;
+    uint8_t strength;
+    uint8_t defense;
+    uint8_t magic;
+    uint8_t magicDefense;
+    uint8_t elementTypes[8];
+    uint8_t elementRates[8];
+    uint8_t unknown0[80];
+    uint8_t dropRates[4];
+    uint16_t dropIDs[4];
+    uint8_t unknown1[36];
+};
+
+// Entry in the battle inventory, 6 bytes.
+struct BattleInventoryEntry
+{
+    uint16_t itemID;
+    uint8_t quantity;
+    uint8_t unknown[3];
+};
+
+#pragma pack(pop)
+
+static_assert(sizeof(CharacterRecord) == CharacterDataOffsets::Barret - CharacterDataOffsets::Cloud, "CharacterRecord size mismatch.");
+static_assert(offsetof(CharacterRecord, level) == CharacterDataOffsets::Level, "CharacterRecord layout mismatch.");
+static_assert(offsetof(CharacterRecord, strengthBonus) == CharacterDataOffsets::StrengthBonus, "CharacterRecord layout mismatch.");
+static_assert(offsetof(CharacterRecord, currentLimitBar) == CharacterDataOffsets::CurrentLimitBar, "CharacterRecord layout mismatch.");
+static_assert(offsetof(CharacterRecord, name) == CharacterDataOffsets::Name, "CharacterRecord layout mismatch.");
+static_assert(offsetof(CharacterRecord, currentHP) == CharacterDataOffsets::CurrentHP, "CharacterRecord layout mismatch.");
+static_assert(offsetof(CharacterRecord, maxHP) == CharacterDataOffsets::MaxHP, "CharacterRecord layout mismatch.");
+static_assert(offsetof(CharacterRecord, weaponMateria) == CharacterDataOffsets::WeaponMateria[0], "CharacterRecord layout mismatch.");
+static_assert(offsetof(CharacterRecord, armorMateria) == CharacterDataOffsets::ArmorMateria[0], "CharacterRecord layout mismatch.");
+
+static_assert(sizeof(BattleCharacter) == BattleOffsets::Allies[1] - BattleOffsets::Allies[0], "BattleCharacter size mismatch.");
+static_assert(offsetof(BattleCharacter, level) == BattleOffsets::Level, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, strength) == BattleOffsets::Strength, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, magic) == BattleOffsets::Magic, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, evade) == BattleOffsets::Evade, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, speed) == BattleOffsets::Speed, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, luck) == BattleOffsets::Luck, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, defense) == BattleOffsets::Defense, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, mDefense) == BattleOffsets::MDefense, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, currentMP) == BattleOffsets::CurrentMP, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, maxMP) == BattleOffsets::MaxMP, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, currentHP) == BattleOffsets::CurrentHP, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, maxHP) == BattleOffsets::MaxHP, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, gil) == BattleOffsets::Gil, "BattleCharacter layout mismatch.");
+static_assert(offsetof(BattleCharacter, exp) == BattleOffsets::Exp, "BattleCharacter layout mismatch.");
+
+static_assert(sizeof(BattleSceneEnemy) == BattleSceneOffsets::Enemies[1] - BattleSceneOffsets::Enemies[0], "BattleSceneEnemy size mismatch.");
+static_assert(offsetof(BattleSceneEnemy, level) == BattleSceneOffsets::Level, "BattleSceneEnemy layout mismatch.");
+static_assert(offsetof(BattleSceneEnemy, magicDefense) == BattleSceneOffsets::MagicDefense, "BattleSceneEnemy layout mismatch.");
+static_assert(offsetof(BattleSceneEnemy, elementTypes) == BattleSceneOffsets::ElementTypes, "BattleSceneEnemy layout mismatch.");
+static_assert(offsetof(BattleSceneEnemy, elementRates) == BattleSceneOffsets::ElementRates, "BattleSceneEnemy layout mismatch.");
+static_assert(offsetof(BattleSceneEnemy, dropRates) == BattleSceneOffsets::DropRates[0], "BattleSceneEnemy layout mismatch.");
+static_assert(offsetof(BattleSceneEnemy, dropIDs) == BattleSceneOffsets::DropIDs[0], "BattleSceneEnemy layout mismatch.");
+
+static_assert(sizeof(BattleInventoryEntry) == 6, "BattleInventoryEntry size mismatch.");
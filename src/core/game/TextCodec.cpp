@@ -0,0 +1,93 @@
+#include "TextCodec.h"
+
+#include <algorithm>
+#include <cstring>
+
+size_t TextCodec::encode(std::string_view text, uint8_t* out, size_t length, bool centerAlign)
+{
+    memset(out, 0x00, length);
+
+    size_t strLen = std::min<size_t>(text.size(), length);
+    size_t padding = centerAlign ? (length - strLen) / 2 : 0;
+
+    for (size_t i = 0; i < strLen; ++i)
+    {
+        out[padding + i] = encodeChar(text[i]);
+    }
+
+    return strLen;
+}
+
+size_t TextCodec::decode(const uint8_t* data, size_t length, char* out, size_t outSize)
+{
+    if (outSize == 0)
+    {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (size_t i = 0; i < length && count < outSize - 1; ++i)
+    {
+        if (data[i] == ControlCode::End)
+        {
+            break;
+        }
+
+        out[count++] = decodeChar(data[i]);
+    }
+
+    out[count] = '\0';
+    return count;
+}
+
+bool TextCodec::equals(const uint8_t* data, size_t length, std::string_view text)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (data[i] == ControlCode::End)
+        {
+            break;
+        }
+
+        if (count >= text.size() || text[count] != decodeChar(data[i]))
+        {
+            return false;
+        }
+
+        count++;
+    }
+
+    return count == text.size();
+}
+
+static constexpr uint64_t FNVOffsetBasis = 0xCBF29CE484222325ull;
+static constexpr uint64_t FNVPrime = 0x100000001B3ull;
+
+uint64_t TextCodec::hash(const uint8_t* data, size_t length)
+{
+    uint64_t result = FNVOffsetBasis;
+    for (size_t i = 0; i < length; ++i)
+    {
+        if (data[i] == ControlCode::End)
+        {
+            break;
+        }
+
+        result = (result ^ (uint8_t)decodeChar(data[i])) * FNVPrime;
+    }
+
+    return result;
+}
+
+uint64_t TextCodec::hash(std::string_view text)
+{
+    uint64_t result = FNVOffsetBasis;
+    for (char c : text)
+    {
+        // Round trip through the tables so characters are normalized the same way as RAM text.
+        result = (result ^ (uint8_t)decodeChar(encodeChar(c))) * FNVPrime;
+    }
+
+    return result;
+}
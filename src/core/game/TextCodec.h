@@ -0,0 +1,99 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// Converts between FF7's single byte text encoding and plain strings. All conversions use
+// constexpr lookup tables and caller provided buffers so they can be used from per-frame code.
+class TextCodec
+{
+public:
+    // Longest string the game stores in a single window or message buffer.
+    static constexpr size_t MaxLength = 256;
+
+    struct ControlCode
+    {
+        static constexpr uint8_t Choice     = 0xE0; // 10 spaces, used to indent choices
+        static constexpr uint8_t Tab        = 0xE1; // 4 spaces
+        static constexpr uint8_t Comma      = 0xE2; // ", "
+        static constexpr uint8_t EndQuote   = 0xE3; // Period and closing quote
+        static constexpr uint8_t Ellipsis   = 0xE4; // Ellipsis and closing quote
+        static constexpr uint8_t NewLine    = 0xE7;
+        static constexpr uint8_t NewPage    = 0xE8;
+        static constexpr uint8_t Cloud      = 0xEA; // 0xEA - 0xF2 are character names
+        static constexpr uint8_t Cid        = 0xF2;
+        static constexpr uint8_t Party1     = 0xF3; // 0xF3 - 0xF5 are the current party members
+        static constexpr uint8_t Party3     = 0xF5;
+        static constexpr uint8_t Escape     = 0xFE; // Followed by an extended opcode (colors, pauses, etc)
+        static constexpr uint8_t End        = 0xFF;
+    };
+
+    static constexpr bool isControlCode(uint8_t byte)
+    {
+        return byte >= ControlCode::Choice;
+    }
+
+    // Control codes decode to a space so decoded text can be compared against what's shown on screen.
+    static constexpr std::array<char, 256> decodeTable = {
+        ' ', '!', '"', '#', '$', '%', '&', '\'', '(', ')', '*', '+', ',', '-', '.', '/',
+        '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', ':', ';', '<', '=', '>', '?',
+        '@', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O',
+        'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', '[', '\\', ']', '^', '_',
+        '`', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o',
+        'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '{', '|', '}', '~', '\xC4',
+        '\xC5', '\xC7', '\xC9', '\xD1', '\xD6', '\xDC', '\xE1', '\xE0', '\xE2', '\xE4', '\xE3', '\xE5', '\xE7', '\xE9', '\xE8', '\xEA',
+        '\xEB', '\xED', '\xEC', '\xEE', '\xEF', '\xF1', '\xF3', '\xF2', '\xF4', '\xF6', '\xF5', '\xFA', '\xF9', '\xFB', '\xFC', ' ',
+        '\xB0', '\xA2', '\xA3', ' ', ' ', ' ', ' ', ' ', ' ', ' ', '\xB4', '\xA8', ' ', ' ', '\xD8', ' ',
+        '\xB1', ' ', ' ', '\xA5', '\xB5', ' ', ' ', ' ', ' ', ' ', '\xAA', '\xBA', ' ', ' ', '\xF8', '\xBF',
+        '\xA1', '\xAC', ' ', '\x83', ' ', ' ', ' ', '\xBB', '\x85', '\xC0', '\xC3', '\xD5', '\x8C', '\x9C', '\x96', '\x97',
+        '\x93', '\x94', '\x91', '\x92', '\xF7', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', '\x82',
+        '\x84', '\x89', '\xC2', '\xCA', '\xC1', '\xCB', '\xC8', '\xCD', '\xCE', '\xCF', '\xCC', '\xD3', '\xD4', ' ', '\xD2', '\xDA',
+        '\xDB', '\xD9', ' ', '\x88', '\x98', '\xAF', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+        ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ',
+        ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', ' ', '\0',
+    };
+
+    static constexpr std::array<uint8_t, 256> encodeTable = []()
+    {
+        std::array<uint8_t, 256> table{};
+
+        // Walk backwards so the lowest byte wins when several map to the same character.
+        for (int i = ControlCode::End - 1; i >= 0; --i)
+        {
+            table[(uint8_t)decodeTable[i]] = (uint8_t)i;
+        }
+
+        // Characters with no glyph encode as a space.
+        table[0] = 0x00;
+        table[(uint8_t)'\n'] = ControlCode::NewLine;
+        table[(uint8_t)'\t'] = ControlCode::Tab;
+        return table;
+    }();
+
+    static constexpr char decodeChar(uint8_t byte)
+    {
+        return decodeTable[byte];
+    }
+
+    static constexpr uint8_t encodeChar(char c)
+    {
+        return encodeTable[(uint8_t)c];
+    }
+
+    // Encodes text into exactly length bytes, padding with 0x00. Returns the number of characters encoded.
+    static size_t encode(std::string_view text, uint8_t* out, size_t length, bool centerAlign = false);
+
+    // Decodes until the 0xFF terminator or length is reached, output is always null terminated.
+    // Returns the number of characters written, not counting the terminator.
+    static size_t decode(const uint8_t* data, size_t length, char* out, size_t outSize);
+
+    // Same result as comparing decode() against text but without decoding into a buffer.
+    static bool equals(const uint8_t* data, size_t length, std::string_view text);
+
+    // 64-bit FNV-1a fingerprint of the decoded text. Both versions hash the same characters so
+    // hash(encoded) == hash(text) whenever equals(encoded, text) is true.
+    static uint64_t hash(const uint8_t* data, size_t length);
+    static uint64_t hash(std::string_view text);
+};
@@ -0,0 +1,216 @@
+#include "TransitionTracker.h"
+#include "core/utilities/ConfigFile.h"
+#include "core/utilities/Utilities.h"
+
+#include <algorithm>
+#include <sstream>
+
+static const char* typeNames[] = { "Field", "Battle", "Shop", "World" };
+
+void TransitionTracker::begin(Type type, uint32_t frameNumber)
+{
+    Pending& transition = pending[(size_t)type];
+    transition = Pending();
+    transition.active = true;
+    transition.beginFrame = frameNumber;
+    transition.beginTime = Utilities::getTimeMS();
+}
+
+void TransitionTracker::dataLoaded(Type type, uint16_t id, uint32_t frameNumber)
+{
+    Pending& transition = pending[(size_t)type];
+    if (!transition.active)
+    {
+        return;
+    }
+
+    transition.loaded = true;
+    transition.id = id;
+    transition.loadedTime = Utilities::getTimeMS();
+    transition.lastListenerTime = transition.loadedTime;
+
+    Stats& entry = stats[makeKey(type, id)];
+    uint32_t detectFrames = frameNumber >= transition.beginFrame ? frameNumber - transition.beginFrame : 0;
+    double detectMS = transition.loadedTime - transition.beginTime;
+
+    entry.count++;
+    entry.totalDetectFrames += detectFrames;
+    entry.maxDetectFrames = std::max(entry.maxDetectFrames, detectFrames);
+    entry.totalDetectMS += detectMS;
+    entry.maxDetectMS = std::max(entry.maxDetectMS, detectMS);
+}
+
+void TransitionTracker::listenerFinished(Type type, size_t listenerIndex)
+{
+    Pending& transition = pending[(size_t)type];
+    if (!transition.loaded)
+    {
+        return;
+    }
+
+    double currentTime = Utilities::getTimeMS();
+    double listenerMS = currentTime - transition.lastListenerTime;
+    transition.lastListenerTime = currentTime;
+
+    if (listenerMS > transition.maxListenerMS)
+    {
+        transition.maxListenerMS = listenerMS;
+        transition.slowestListener = (int)listenerIndex;
+    }
+}
+
+// Called at the end of an update once all writes for it have gone out.
+void TransitionTracker::flush()
+{
+    double currentTime = Utilities::getTimeMS();
+
+    for (size_t i = 0; i < pending.size(); ++i)
+    {
+        Pending& transition = pending[i];
+        if (!transition.loaded)
+        {
+            continue;
+        }
+
+        Stats& entry = stats[makeKey((Type)i, transition.id)];
+        double patchMS = currentTime - transition.loadedTime;
+        entry.totalPatchMS += patchMS;
+        entry.maxPatchMS = std::max(entry.maxPatchMS, patchMS);
+
+        if (transition.maxListenerMS > entry.maxListenerMS)
+        {
+            entry.maxListenerMS = transition.maxListenerMS;
+            entry.slowestListener = transition.slowestListener;
+        }
+
+        transition = Pending();
+    }
+}
+
+std::vector<uint32_t> TransitionTracker::getSlowest(size_t count)
+{
+    std::vector<std::pair<double, uint32_t>> averages;
+    for (const auto& [key, entry] : stats)
+    {
+        if (entry.count == 0)
+        {
+            continue;
+        }
+
+        averages.push_back({ (entry.totalDetectMS + entry.totalPatchMS) / entry.count, key });
+    }
+
+    std::sort(averages.begin(), averages.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+
+    std::vector<uint32_t> results;
+    for (size_t i = 0; i < averages.size() && i < count; ++i)
+    {
+        results.push_back(averages[i].second);
+    }
+    return results;
+}
+
+std::string TransitionTracker::getName(uint32_t key)
+{
+    uint32_t type = key >> 16;
+    uint16_t id = key & 0xFFFF;
+
+    if (type >= 4)
+    {
+        return "Unknown";
+    }
+
+    if ((Type)type == Type::World)
+    {
+        return typeNames[type];
+    }
+
+    return std::string(typeNames[type]) + " " + std::to_string(id);
+}
+
+void TransitionTracker::merge(const TransitionTracker& other)
+{
+    for (const auto& [key, otherEntry] : other.stats)
+    {
+        Stats& entry = stats[key];
+        entry.count += otherEntry.count;
+        entry.totalDetectFrames += otherEntry.totalDetectFrames;
+        entry.maxDetectFrames = std::max(entry.maxDetectFrames, otherEntry.maxDetectFrames);
+        entry.totalDetectMS += otherEntry.totalDetectMS;
+        entry.maxDetectMS = std::max(entry.maxDetectMS, otherEntry.maxDetectMS);
+        entry.totalPatchMS += otherEntry.totalPatchMS;
+        entry.maxPatchMS = std::max(entry.maxPatchMS, otherEntry.maxPatchMS);
+
+        if (otherEntry.maxListenerMS > entry.maxListenerMS)
+        {
+            entry.maxListenerMS = otherEntry.maxListenerMS;
+            entry.slowestListener = otherEntry.slowestListener;
+        }
+    }
+}
+
+bool TransitionTracker::load(const std::string& filePath)
+{
+    ConfigFile cfg;
+    if (!cfg.load(filePath))
+    {
+        return false;
+    }
+
+    std::vector<uint64_t> keys;
+    std::string keyList = cfg.get<std::string>("keys", "");
+    std::stringstream keyStream(keyList);
+    std::string keyString;
+    while (std::getline(keyStream, keyString, ','))
+    {
+        if (!keyString.empty())
+        {
+            keys.push_back(std::stoull(keyString));
+        }
+    }
+
+    stats.clear();
+    for (uint64_t key : keys)
+    {
+        cfg.keyPrefix = std::to_string(key) + ".";
+
+        Stats& entry = stats[(uint32_t)key];
+        entry.count             = (uint32_t)cfg.get<uint64_t>("count", 0);
+        entry.totalDetectFrames = cfg.get<uint64_t>("totalDetectFrames", 0);
+        entry.maxDetectFrames   = (uint32_t)cfg.get<uint64_t>("maxDetectFrames", 0);
+        entry.totalDetectMS     = cfg.get<float>("totalDetectMS", 0.0f);
+        entry.maxDetectMS       = cfg.get<float>("maxDetectMS", 0.0f);
+        entry.totalPatchMS      = cfg.get<float>("totalPatchMS", 0.0f);
+        entry.maxPatchMS        = cfg.get<float>("maxPatchMS", 0.0f);
+        entry.maxListenerMS     = cfg.get<float>("maxListenerMS", 0.0f);
+        entry.slowestListener   = cfg.get<int>("slowestListener", -1);
+    }
+
+    return true;
+}
+
+bool TransitionTracker::save(const std::string& filePath)
+{
+    ConfigFile cfg;
+
+    std::string keyList;
+    for (const auto& [key, entry] : stats)
+    {
+        keyList += std::to_string(key) + ",";
+
+        cfg.keyPrefix = std::to_string(key) + ".";
+        cfg.set<uint64_t>("count", entry.count);
+        cfg.set<uint64_t>("totalDetectFrames", entry.totalDetectFrames);
+        cfg.set<uint64_t>("maxDetectFrames", entry.maxDetectFrames);
+        cfg.set<float>("totalDetectMS", (float)entry.totalDetectMS);
+        cfg.set<float>("maxDetectMS", (float)entry.maxDetectMS);
+        cfg.set<float>("totalPatchMS", (float)entry.totalPatchMS);
+        cfg.set<float>("maxPatchMS", (float)entry.maxPatchMS);
+        cfg.set<float>("maxListenerMS", (float)entry.maxListenerMS);
+        cfg.set<int>("slowestListener", entry.slowestListener);
+    }
+
+    cfg.keyPrefix = "";
+    cfg.set<std::string>("keys", keyList);
+    return cfg.save(filePath);
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// Measures how long it takes from a module transition until its data is detected as loaded, and from
+// there until every listener has patched it and the writes have gone out. Stats are aggregated per
+// field, battle formation, shop (by field) and world map, and can be saved between sessions.
+class TransitionTracker
+{
+public:
+    enum class Type : uint8_t
+    {
+        Field  = 0,
+        Battle = 1,
+        Shop   = 2,
+        World  = 3
+    };
+
+    struct Stats
+    {
+        uint32_t count = 0;
+
+        // Transition start until the data is detected as loaded.
+        uint64_t totalDetectFrames = 0;
+        uint32_t maxDetectFrames = 0;
+        double totalDetectMS = 0.0;
+        double maxDetectMS = 0.0;
+
+        // Data loaded until listeners have finished and writes are flushed.
+        double totalPatchMS = 0.0;
+        double maxPatchMS = 0.0;
+
+        // Slowest single listener seen, by its index in the event.
+        double maxListenerMS = 0.0;
+        int slowestListener = -1;
+    };
+
+    void begin(Type type, uint32_t frameNumber);
+    void dataLoaded(Type type, uint16_t id, uint32_t frameNumber);
+    void listenerFinished(Type type, size_t listenerIndex);
+    void flush();
+
+    const std::map<uint32_t, Stats>& getStats() { return stats; }
+
+    // Returns the keys of the transitions with the slowest average total time, slowest first.
+    std::vector<uint32_t> getSlowest(size_t count);
+    static std::string getName(uint32_t key);
+
+    // Adds another tracker's stats to these, for combining instances or sessions before saving.
+    void merge(const TransitionTracker& other);
+
+    bool load(const std::string& filePath);
+    bool save(const std::string& filePath);
+
+private:
+    struct Pending
+    {
+        bool active = false;
+        bool loaded = false;
+        uint16_t id = 0;
+        uint32_t beginFrame = 0;
+        double beginTime = 0.0;
+        double loadedTime = 0.0;
+        double lastListenerTime = 0.0;
+        double maxListenerMS = 0.0;
+        int slowestListener = -1;
+    };
+
+    static uint32_t makeKey(Type type, uint16_t id) { return ((uint32_t)type << 16) | id; }
+
+    std::array<Pending, 4> pending;
+    std::map<uint32_t, Stats> stats;
+};
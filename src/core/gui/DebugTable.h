@@ -0,0 +1,86 @@
+#pragma once
+
+#include "core/game/GameManager.h"
+#include "core/utilities/Utilities.h"
+#include <functional>
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+#if IRONMOG_GUI
+#include <imgui.h>
+#endif
+
+// A debug view of a table of T in emulator memory. The whole table is fetched with one read and only
+// re-read every refresh interval, or when the table moves, so leaving a view open doesn't cost the
+// manager a read per row every GUI frame. Only rows scrolled into view are drawn.
+template <typename T>
+class DebugTable
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Debug table rows must be trivially copyable.");
+
+public:
+    DebugTable(double refreshIntervalMS = 250.0) : refreshInterval(refreshIntervalMS) {}
+
+    // Returns the cached rows, re-reading them if the table moved or is older than the refresh interval.
+    const std::vector<T>& fetch(GameManager* game, uintptr_t offset, size_t count)
+    {
+        double currentTime = Utilities::getTimeMS();
+        if (offset != tableOffset || count != rows.size() || currentTime - lastRefreshTime >= refreshInterval)
+        {
+            tableOffset = offset;
+            rows.resize(count);
+            game->read(offset, count * sizeof(T), (uint8_t*)rows.data());
+            lastRefreshTime = currentTime;
+        }
+
+        return rows;
+    }
+
+#if IRONMOG_GUI
+    // Draws the cached rows, drawRow should fill in one column per header with ImGui::TableNextColumn().
+    // A height of 0 fits every row, otherwise the table scrolls.
+    void draw(const char* id, std::initializer_list<const char*> columns, std::function<void(int, const T&)> drawRow, float height = 300.0f)
+    {
+        ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg;
+        if (height > 0.0f)
+        {
+            flags |= ImGuiTableFlags_ScrollY;
+        }
+
+        if (!ImGui::BeginTable(id, (int)columns.size(), flags, ImVec2(0.0f, height)))
+        {
+            return;
+        }
+
+        ImGui::TableSetupScrollFreeze(0, 1);
+        for (const char* column : columns)
+        {
+            ImGui::TableSetupColumn(column);
+        }
+        ImGui::TableHeadersRow();
+
+        ImGuiListClipper clipper;
+        clipper.Begin((int)rows.size());
+        while (clipper.Step())
+        {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i)
+            {
+                ImGui::TableNextRow();
+                drawRow(i, rows[i]);
+            }
+        }
+
+        ImGui::EndTable();
+    }
+#endif
+
+    // Forces the next fetch to re-read the table.
+    void invalidate() { lastRefreshTime = -refreshInterval; }
+
+private:
+    std::vector<T> rows;
+    uintptr_t tableOffset = 0;
+    double refreshInterval = 250.0;
+    double lastRefreshTime = 0.0;
+};
@@ -1,11 +1,11 @@
 #include "GUI.h"
 
-#define IMGUI_IMPLEMENTATION
-#include "misc/single_file/imgui_single_file.h"
+#include <imgui.h>
 #include "imgui_impl_glfw.h"
 #include "imgui_impl_opengl3.h"
 #include "IconsFontAwesome5.h"
 
+#include <algorithm>
 #include <stdio.h>
 
 #define GL_SILENCE_DEPRECATION
@@ -210,10 +210,28 @@ bool GUI::beginFrame()
     // - When io.WantCaptureMouse is true, do not dispatch mouse input data to your main application, or clear/overwrite your copy of the mouse data.
     // - When io.WantCaptureKeyboard is true, do not dispatch keyboard input data to your main application, or clear/overwrite your copy of the keyboard data.
     // Generally you may always pass all inputs to dear imgui, and hide them from your application based on those two flags.
-    glfwPollEvents();
+    if (activeFrames > 0 || redrawRequested.exchange(false))
+    {
+        activeFrames = std::max(activeFrames - 1, 0);
+        glfwPollEvents();
+    }
+    else
+    {
+        // Sleep until there's input, a redraw request or the idle refresh is due. Waking
+        // before the timeout means something happened so draw a few frames in a row.
+        double timeout = 1.0 / idleRefreshRate;
+        double waitStart = glfwGetTime();
+        glfwWaitEventsTimeout(timeout);
+        if (glfwGetTime() - waitStart < timeout)
+        {
+            activeFrames = ActiveFrameCount;
+        }
+        redrawRequested = false;
+    }
+
     if (glfwGetWindowAttrib(window, GLFW_ICONIFIED) != 0)
     {
-        ImGui_ImplGlfw_Sleep(10);
+        activeFrames = 0;
         return false;
     }
 
@@ -246,6 +264,12 @@ void GUI::endFrame()
     glfwSwapBuffers(window);
 }
 
+void GUI::requestRedraw()
+{
+    redrawRequested = true;
+    glfwPostEmptyEvent();
+}
+
 bool GUI::wasWindowClosed()
 {
     return glfwWindowShouldClose(window);
@@ -340,6 +364,21 @@ bool GUIImage::loadFromMemory(const void* data, size_t data_size)
     if (image_data == NULL)
         return false;
 
+    bool ret = upload(image_data, image_width, image_height);
+    stbi_image_free(image_data);
+    return ret;
+}
+
+bool GUIImage::loadFromData(const GUIImageData& data)
+{
+    if (data.pixels.empty())
+        return false;
+
+    return upload(data.pixels.data(), data.width, data.height);
+}
+
+bool GUIImage::upload(const unsigned char* pixels, int image_width, int image_height)
+{
     // Create a OpenGL texture identifier
     GLuint image_texture;
     glGenTextures(1, &image_texture);
@@ -351,8 +390,7 @@ bool GUIImage::loadFromMemory(const void* data, size_t data_size)
 
     // Upload pixels into texture
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, image_data);
-    stbi_image_free(image_data);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, image_width, image_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
 
     textureID = image_texture;;
     width     = image_width;
@@ -380,63 +418,13 @@ bool GUIImage::loadFromFile(const char* file_name)
     return ret;
 }
 
-void GUI::drawImage(GUIImage& image, int width, int height, float alpha)
+bool GUIImageData::loadFromFile(const char* file_name)
 {
-    if (alpha < 1.0f)
-    {
-        ImGui::ImageWithBg((ImTextureID)image.textureID, ImVec2((float)width, (float)height), ImVec2(0, 0), ImVec2(1, 1), ImVec4(0, 0, 0, 0), ImVec4(1, 1, 1, alpha));
-    }
-    else
-    {
-        ImGui::Image((ImTextureID)image.textureID, ImVec2((float)width, (float)height));
-    }
-}
-
-void GUI::drawColorGrid(const std::string& name, std::vector<Utilities::Color>& colors, std::function<void(int, Utilities::Color)> onClickCallback, float boxSize, float spacing, int colorsPerRow)
-{
-    ImDrawList* drawList = ImGui::GetWindowDrawList();
-    ImVec2 startPos = ImGui::GetCursorScreenPos();
-
-    for (size_t i = 0; i < colors.size(); ++i)
-    {
-        ImU32 color = IM_COL32(colors[i].r, colors[i].g, colors[i].b, 255);
-
-        // compute position in grid
-        int row = static_cast<int>(i / colorsPerRow);
-        int col = static_cast<int>(i % colorsPerRow);
-        ImVec2 p0 = ImVec2(startPos.x + col * (boxSize + spacing), startPos.y + row * (boxSize + spacing));
-        ImVec2 p1 = ImVec2(p0.x + boxSize, p0.y + boxSize);
-
-        // draw filled rect
-        drawList->AddRectFilled(p0, p1, color);
-        drawList->AddRect(p0, p1, IM_COL32(60, 60, 60, 255)); // border
-
-        // Make an invisible button for interaction
-        ImGui::SetCursorScreenPos(p0);
-        ImGui::InvisibleButton((name + ".color" + std::to_string(i)).c_str(), ImVec2(boxSize, boxSize));
-
-        if (ImGui::IsItemClicked())
-        {
-            if (onClickCallback)
-            {
-                onClickCallback((int)i, colors[i]);
-            }
-        }
-    }
+    unsigned char* image_data = stbi_load(file_name, &width, &height, NULL, 4);
+    if (image_data == NULL)
+        return false;
 
-    // advance cursor so the next ImGui item doesn't overlap
-    //int totalRows = static_cast<int>((colors.size() + colorsPerRow - 1) / colorsPerRow);
-    //ImGui::Dummy(ImVec2(0.0f, totalRows * (boxSize + spacing)));
+    pixels.assign(image_data, image_data + (size_t)width * height * 4);
+    stbi_image_free(image_data);
+    return true;
 }
-
-void GUI::wrappedTooltip(const std::string& text, float maxWidth)
-{
-    if (ImGui::IsItemHovered())
-    {
-        ImGui::BeginTooltip();
-        ImGui::PushTextWrapPos(ImGui::GetCursorPos().x + maxWidth);
-        ImGui::TextWrapped(text.c_str());
-        ImGui::PopTextWrapPos();
-        ImGui::EndTooltip();
-    }
-}
\ No newline at end of file
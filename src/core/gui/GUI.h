@@ -1,10 +1,13 @@
 #pragma once
+#include <atomic>
 #include <functional>
+#include <vector>
 #include "core/utilities/Event.h"
 #include "core/utilities/Utilities.h"
 
 struct GLFWwindow;
 struct GUIImage;
+struct GUIImageData;
 
 class GUI
 {
@@ -19,6 +22,11 @@ public:
 
     bool wasWindowClosed();
 
+    // Frames are only drawn on input, when requested or at the idle refresh rate, otherwise beginFrame
+    // blocks waiting for events. requestRedraw is safe to call from any thread.
+    void setIdleRefreshRate(double framesPerSecond) { idleRefreshRate = framesPerSecond; }
+    void requestRedraw();
+
     void pushFont(const std::string& fontName);
     void popFont();
 
@@ -28,6 +36,13 @@ public:
 private:
     GLFWwindow* window;
 
+    // After being woken by input keep drawing for a few frames so hover states and animations settle.
+    static constexpr int ActiveFrameCount = 3;
+
+    double idleRefreshRate = 4.0;
+    std::atomic<bool> redrawRequested = false;
+    int activeFrames = 0;
+
     void onKeyCallback(int key, int scancode, int action, int mods);
 
 public:
@@ -36,6 +51,18 @@ public:
     static void wrappedTooltip(const std::string& text, float maxWidth = 400.0f);
 };
 
+// Decoded RGBA pixels. Decoding doesn't touch OpenGL so it can be done on any thread,
+// the data is then uploaded to a GUIImage on the GUI thread.
+struct GUIImageData
+{
+    std::vector<uint8_t> pixels;
+    int width = 0;
+    int height = 0;
+
+    bool loadFromFile(const char* file_name);
+};
+
+// An image uploaded as a texture, a texture ID of 0 means it hasn't been loaded yet.
 struct GUIImage
 {
     uint32_t textureID = 0;
@@ -44,4 +71,8 @@ struct GUIImage
 
     bool loadFromMemory(const void* data, size_t data_size);
     bool loadFromFile(const char* file_name);
+    bool loadFromData(const GUIImageData& data);
+
+private:
+    bool upload(const unsigned char* pixels, int image_width, int image_height);
 };
\ No newline at end of file
@@ -0,0 +1,74 @@
+#include "GUI.h"
+
+// ImGui itself and the widgets rules draw with in their settings and debug views. The window, backends
+// and textures are in GUI.cpp.
+#define IMGUI_IMPLEMENTATION
+#include "misc/single_file/imgui_single_file.h"
+
+void GUI::drawImage(GUIImage& image, int width, int height, float alpha)
+{
+    // Reserve the space while the image is still loading.
+    if (image.textureID == 0)
+    {
+        ImGui::Dummy(ImVec2((float)width, (float)height));
+        return;
+    }
+
+    if (alpha < 1.0f)
+    {
+        ImGui::ImageWithBg((ImTextureID)image.textureID, ImVec2((float)width, (float)height), ImVec2(0, 0), ImVec2(1, 1), ImVec4(0, 0, 0, 0), ImVec4(1, 1, 1, alpha));
+    }
+    else
+    {
+        ImGui::Image((ImTextureID)image.textureID, ImVec2((float)width, (float)height));
+    }
+}
+
+void GUI::drawColorGrid(const std::string& name, std::vector<Utilities::Color>& colors, std::function<void(int, Utilities::Color)> onClickCallback, float boxSize, float spacing, int colorsPerRow)
+{
+    ImDrawList* drawList = ImGui::GetWindowDrawList();
+    ImVec2 startPos = ImGui::GetCursorScreenPos();
+
+    for (size_t i = 0; i < colors.size(); ++i)
+    {
+        ImU32 color = IM_COL32(colors[i].r, colors[i].g, colors[i].b, 255);
+
+        // compute position in grid
+        int row = static_cast<int>(i / colorsPerRow);
+        int col = static_cast<int>(i % colorsPerRow);
+        ImVec2 p0 = ImVec2(startPos.x + col * (boxSize + spacing), startPos.y + row * (boxSize + spacing));
+        ImVec2 p1 = ImVec2(p0.x + boxSize, p0.y + boxSize);
+
+        // draw filled rect
+        drawList->AddRectFilled(p0, p1, color);
+        drawList->AddRect(p0, p1, IM_COL32(60, 60, 60, 255)); // border
+
+        // Make an invisible button for interaction
+        ImGui::SetCursorScreenPos(p0);
+        ImGui::InvisibleButton((name + ".color" + std::to_string(i)).c_str(), ImVec2(boxSize, boxSize));
+
+        if (ImGui::IsItemClicked())
+        {
+            if (onClickCallback)
+            {
+                onClickCallback((int)i, colors[i]);
+            }
+        }
+    }
+
+    // advance cursor so the next ImGui item doesn't overlap
+    //int totalRows = static_cast<int>((colors.size() + colorsPerRow - 1) / colorsPerRow);
+    //ImGui::Dummy(ImVec2(0.0f, totalRows * (boxSize + spacing)));
+}
+
+void GUI::wrappedTooltip(const std::string& text, float maxWidth)
+{
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::BeginTooltip();
+        ImGui::PushTextWrapPos(ImGui::GetCursorPos().x + maxWidth);
+        ImGui::TextWrapped(text.c_str());
+        ImGui::PopTextWrapPos();
+        ImGui::EndTooltip();
+    }
+}
\ No newline at end of file
@@ -1,8 +1,67 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <vector>
 
+// Attributes time spent in event listeners to whoever added them, eg each rule, for benchmarking.
+// Listeners remember the owner active on their thread when they were added, and are only timed
+// on threads where a profiler is active.
+class EventProfiler
+{
+public:
+    inline static thread_local int currentOwner = -1;
+    inline static thread_local EventProfiler* active = nullptr;
+
+    struct OwnerStats
+    {
+        uint64_t calls = 0;
+        double totalMS = 0.0;
+    };
+
+    // Indexed by owner, listeners added with no owner are not recorded.
+    std::vector<OwnerStats> owners;
+
+    // Listeners added from within a listener share its owner.
+    template<typename Func>
+    static void call(int owner, const Func& func)
+    {
+        int previousOwner = currentOwner;
+        currentOwner = owner;
+
+        if (active == nullptr || owner < 0)
+        {
+            func();
+            currentOwner = previousOwner;
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        func();
+        double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        currentOwner = previousOwner;
+
+        if ((size_t)owner >= active->owners.size())
+        {
+            active->owners.resize(owner + 1);
+        }
+        active->owners[owner].calls++;
+        active->owners[owner].totalMS += elapsed;
+    }
+};
+
+// Listeners added on this thread are owned by the given index until the scope ends.
+class EventOwnerScope
+{
+public:
+    EventOwnerScope(int owner) : previousOwner(EventProfiler::currentOwner) { EventProfiler::currentOwner = owner; }
+    ~EventOwnerScope() { EventProfiler::currentOwner = previousOwner; }
+
+private:
+    int previousOwner;
+};
+
 template<typename... Args>
 class Event 
 {
@@ -12,20 +71,36 @@ class Event
         void addListener(const Callback& callback) 
         {
             listeners.push_back(callback);
+            owners.push_back(EventProfiler::currentOwner);
         }
 
+        bool empty() const { return listeners.empty(); }
+
         void invoke(Args... args) const 
         {
-            for (const auto& listener : listeners) 
+            for (size_t i = 0; i < listeners.size(); ++i)
+            {
+                EventProfiler::call(owners[i], [&]() { listeners[i](args...); });
+            }
+        }
+
+        // Same as invoke but calls afterEach with the listener's index after each one returns.
+        template<typename Func>
+        void invokeEach(const Func& afterEach, Args... args) const
+        {
+            for (size_t i = 0; i < listeners.size(); ++i)
             {
-                listener(args...);
+                EventProfiler::call(owners[i], [&]() { listeners[i](args...); });
+                afterEach(i);
             }
         }
 
     private:
         std::vector<Callback> listeners;
+        std::vector<int> owners;
 };
 
 #define BIND_EVENT(EVENT, FUNC) EVENT.addListener(std::bind(&FUNC, this));
 #define BIND_EVENT_ONE_ARG(EVENT, FUNC) EVENT.addListener(std::bind(&FUNC, this, std::placeholders::_1));
-#define BIND_EVENT_TWO_ARG(EVENT, FUNC) EVENT.addListener(std::bind(&FUNC, this, std::placeholders::_1, std::placeholders::_2));
\ No newline at end of file
+#define BIND_EVENT_TWO_ARG(EVENT, FUNC) EVENT.addListener(std::bind(&FUNC, this, std::placeholders::_1, std::placeholders::_2));
+#define BIND_EVENT_THREE_ARG(EVENT, FUNC) EVENT.addListener(std::bind(&FUNC, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
\ No newline at end of file
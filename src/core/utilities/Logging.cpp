@@ -1,10 +1,20 @@
 #include "Logging.h"
 #include "core/utilities/Platform.h"
 
+#include <cstdio>
 #include <filesystem>
 #include <iomanip>
 #include <sstream>
 
+static void getLocalTime(std::time_t time, std::tm& tmOut)
+{
+#ifdef _WIN32
+    localtime_s(&tmOut, &time);
+#else
+    localtime_r(&time, &tmOut);
+#endif
+}
+
 Logger logger("logs");
 
 Logger::Logger(const std::string& directory) 
@@ -14,7 +24,7 @@ Logger::Logger(const std::string& directory)
     // Generate timestamped filename
     auto now = std::time(nullptr);
     std::tm tm;
-    localtime_s(&tm, &now);
+    getLocalTime(now, tm);
 
     std::ostringstream filename;
     filename << directory << "/log_" << std::put_time(&tm, "%Y-%m-%d_%H-%M-%S") << ".txt";
@@ -38,6 +48,8 @@ void Logger::Log(const char* format, ...)
 
     std::string line = getTimestamp() + " " + formatted + "\n";
 
+    std::lock_guard<std::mutex> lock(writeMutex);
+
     // Write to file
     if (logFile.is_open()) 
     {
@@ -45,6 +57,12 @@ void Logger::Log(const char* format, ...)
         logFile.flush();
     }
 
+    if (consoleOutput)
+    {
+        fputs(line.c_str(), stdout);
+        fflush(stdout);
+    }
+
     // Write to debugger log if one is attached
     Platform::debuggerLog(line);
 }
@@ -52,7 +70,7 @@ void Logger::Log(const char* format, ...)
 std::string Logger::formatString(const char* format, va_list args) 
 {
     char buffer[1024];
-    vsnprintf_s(buffer, sizeof(buffer), _TRUNCATE, format, args);
+    vsnprintf(buffer, sizeof(buffer), format, args);
     return std::string(buffer);
 }
 
@@ -60,7 +78,7 @@ std::string Logger::getTimestamp()
 {
     auto now = std::time(nullptr);
     std::tm tm;
-    localtime_s(&tm, &now);
+    getLocalTime(now, tm);
     
     char buffer[20];
     std::strftime(buffer, sizeof(buffer), "[%H:%M:%S]", &tm);
@@ -4,6 +4,7 @@
 #include <fstream>
 #include <ctime>
 #include <cstdarg>
+#include <mutex>
 
 class Logger {
 public:
@@ -12,8 +13,15 @@ public:
 
     void Log(const char* format, ...);
 
+    // Also writes each line to stdout, used when running without a window.
+    void setConsoleOutput(bool enabled) { consoleOutput = enabled; }
+
 private:
     std::ofstream logFile;
+    bool consoleOutput = false;
+
+    // Several game instances can log at once.
+    std::mutex writeMutex;
     std::string getTimestamp();
     std::string formatString(const char* format, va_list args);
 };
@@ -4,6 +4,7 @@
 #include <set>
 #include <string>
 #include <vector>
+#include <unordered_map>
 
 // Monitors a given memory range for any changes to values of type T. Will then call monitorFunc to allow 
 // you to inspect them in some way. Useful when you're looking for a value that changes into another 
@@ -103,7 +104,7 @@ public:
         patternCheckFunc = newPatternCheckFunc;
 
         firstUpdate = true;
-        BIND_EVENT_ONE_ARG(gameManager->onFrame, PatternMemoryMonitor::onFrame);
+        BIND_EVENT_TWO_ARG(gameManager->onFrame, PatternMemoryMonitor::onFrame);
     }
 
     ~PatternMemoryMonitor()
@@ -117,7 +118,7 @@ public:
         ignoreAddresses.insert(addresses.begin(), addresses.end());
     }
 
-    void onFrame(int frameNumber)
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
     {
         if (firstUpdate)
         {
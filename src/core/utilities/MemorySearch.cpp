@@ -28,6 +28,12 @@ void MemorySearch::loadMemoryState(std::string inputFilePath, uintptr_t startRan
     }
 
     uint8_t* data = Utilities::loadArrayFromFile<uint8_t>(inputFilePath);
+    if (data == nullptr)
+    {
+        LOG("Failed to load memory state from: %s", inputFilePath.c_str());
+        return;
+    }
+
     for (uintptr_t addr = startRange; addr <= endRange; addr++)
     {
         game->write<uint8_t>(addr, data[addr]);
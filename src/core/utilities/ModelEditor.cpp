@@ -91,18 +91,18 @@ void ModelEditor::findFieldModels()
 
         if (polygonCount > 100)
         {
-            for (Model& model : GameData::models)
+            for (const Model& model : GameData::models)
             {
                 if ((model.polyCount * 2) == polygonCount)
                 {
                     if (openFieldModel(startPolyIndex, model))
                     {
-                        DEBUG_LOG("Opened model: %s %d %d", model.name.c_str(), bufferAddress + (startPolyIndex * 4), polygonCount);
+                        DEBUG_LOG("Opened model: %s %d %d", model.name, bufferAddress + (startPolyIndex * 4), polygonCount);
                         break;
                     }
                     else 
                     {
-                        DEBUG_LOG("Failed to open model: %s %d %d", model.name.c_str(), bufferAddress + (startPolyIndex * 4), polygonCount);
+                        DEBUG_LOG("Failed to open model: %s %d %d", model.name, bufferAddress + (startPolyIndex * 4), polygonCount);
                     }
                 }
 
@@ -113,7 +113,7 @@ void ModelEditor::findFieldModels()
                     // First we see if its one on the end of the buffer
                     if (openFieldModel(startPolyIndex, model))
                     {
-                        DEBUG_LOG("Opened model: %s %d %d", model.name.c_str(), bufferAddress + (startPolyIndex * 4), polygonCount - 1);
+                        DEBUG_LOG("Opened model: %s %d %d", model.name, bufferAddress + (startPolyIndex * 4), polygonCount - 1);
                         break;
                     }
                     else
@@ -124,12 +124,12 @@ void ModelEditor::findFieldModels()
 
                         if (openFieldModel(startPolyIndex + readSize, model))
                         {
-                            DEBUG_LOG("Opened model: %s %d %d", model.name.c_str(), bufferAddress + (startPolyIndex * 4), polygonCount - 1);
+                            DEBUG_LOG("Opened model: %s %d %d", model.name, bufferAddress + (startPolyIndex * 4), polygonCount - 1);
                             break;
                         }
                         else
                         {
-                            DEBUG_LOG("Failed to open model: %s %d %d", model.name.c_str(), bufferAddress + (startPolyIndex * 4), polygonCount);
+                            DEBUG_LOG("Failed to open model: %s %d %d", model.name, bufferAddress + (startPolyIndex * 4), polygonCount);
                         }
                     }
                 }
@@ -166,7 +166,7 @@ void ModelEditor::openBattleModels()
     uint16_t fieldID = game->getFieldID();
     if (fieldID == 763)
     {
-        BattleModel* model = GameData::getBattleModel("HICLOUD");
+        const BattleModel* model = GameData::getBattleModel("HICLOUD");
         if (model != nullptr)
         {
             if (openBattleModel(model->headerSizes[0] / 4, *model))
@@ -189,7 +189,7 @@ void ModelEditor::openBattleModels()
             continue;
         }
 
-        BattleModel* model = GameData::getBattleModel(getCharacterName(id));
+        const BattleModel* model = GameData::getBattleModel(getCharacterName(id));
         if (model == nullptr)
         {
             continue;
@@ -227,7 +227,7 @@ bool ModelEditor::areBattleModelsLoaded()
     uint16_t fieldID = game->getFieldID();
     if (fieldID == 763)
     {
-        BattleModel* model = GameData::getBattleModel("HICLOUD");
+        const BattleModel* model = GameData::getBattleModel("HICLOUD");
         if (model != nullptr)
         {
             // Check the last parts vertex count so we can ensure the full model is loaded.
@@ -266,7 +266,7 @@ bool ModelEditor::areBattleModelsLoaded()
             continue;
         }
 
-        BattleModel* model = GameData::getBattleModel(modelName);
+        const BattleModel* model = GameData::getBattleModel(modelName);
         if (model == nullptr)
         {
             return false;
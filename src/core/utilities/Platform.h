@@ -9,7 +9,7 @@
 #include <unordered_map>
 
 // Platform serves as an OS agnostic wrapper around system function calls.
-// TODO: implement PlatformLinux.cpp and PlatformOSX.cpp
+// TODO: implement PlatformOSX.cpp
 
 class Platform
 {
@@ -43,4 +43,7 @@ public:
     static std::vector<std::string> getRunningProcesses();
 
     static void debuggerLog(const std::string& message);
+
+    // Raises the scheduling priority of this process, used by the headless runner.
+    static bool raiseProcessPriority();
 };
@@ -0,0 +1,264 @@
+#include "Platform.h"
+#include "core/utilities/Logging.h"
+
+#include <dirent.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// Processes are identified by their pid, the handle is the pid itself.
+static pid_t toPID(void* processHandle)
+{
+    return (pid_t)(uintptr_t)processHandle;
+}
+
+// Reads the memory map of a process, one entry per line of /proc/<pid>/maps.
+struct MapEntry
+{
+    uintptr_t start = 0;
+    uintptr_t end = 0;
+    char perms[5] = {};
+    std::string path;
+};
+
+static std::vector<MapEntry> readMaps(pid_t pid)
+{
+    std::vector<MapEntry> entries;
+    std::ifstream maps("/proc/" + std::to_string(pid) + "/maps");
+
+    std::string line;
+    while (std::getline(maps, line))
+    {
+        MapEntry entry;
+        unsigned long long start = 0;
+        unsigned long long end = 0;
+        int pathOffset = 0;
+        if (sscanf(line.c_str(), "%llx-%llx %4s %*s %*s %*s %n", &start, &end, entry.perms, &pathOffset) < 3)
+        {
+            continue;
+        }
+
+        entry.start = (uintptr_t)start;
+        entry.end = (uintptr_t)end;
+        if (pathOffset > 0 && pathOffset < (int)line.size())
+        {
+            entry.path = line.substr(pathOffset);
+        }
+        entries.push_back(entry);
+    }
+
+    return entries;
+}
+
+static std::string getProcessName(pid_t pid)
+{
+    std::ifstream comm("/proc/" + std::to_string(pid) + "/comm");
+    std::string name;
+    std::getline(comm, name);
+    return name;
+}
+
+static std::vector<pid_t> getProcessIDs()
+{
+    std::vector<pid_t> pids;
+
+    DIR* proc = opendir("/proc");
+    if (proc == nullptr)
+    {
+        return pids;
+    }
+
+    while (dirent* entry = readdir(proc))
+    {
+        pid_t pid = (pid_t)atoi(entry->d_name);
+        if (pid > 0)
+        {
+            pids.push_back(pid);
+        }
+    }
+
+    closedir(proc);
+    return pids;
+}
+
+void* Platform::openProcess(uint32_t pid)
+{
+    if (kill((pid_t)pid, 0) != 0)
+    {
+        return nullptr;
+    }
+
+    return (void*)(uintptr_t)pid;
+}
+
+void Platform::closeProcess(void* processHandle)
+{
+}
+
+bool Platform::read(void* processHandle, uintptr_t address, void* memOut, size_t sizeInBytes)
+{
+    iovec local = { memOut, sizeInBytes };
+    iovec remote = { (void*)address, sizeInBytes };
+    return process_vm_readv(toPID(processHandle), &local, 1, &remote, 1, 0) == (ssize_t)sizeInBytes;
+}
+
+bool Platform::write(void* processHandle, uintptr_t address, void* memIn, size_t sizeInBytes)
+{
+    iovec local = { memIn, sizeInBytes };
+    iovec remote = { (void*)address, sizeInBytes };
+    if (process_vm_writev(toPID(processHandle), &local, 1, &remote, 1, 0) != (ssize_t)sizeInBytes)
+    {
+        LOG("Platform::write process_vm_writev failed: offset=%llu errno=%d", (unsigned long long)address, errno);
+        return false;
+    }
+
+    return true;
+}
+
+void Platform::getApplicationAddressRange(uintptr_t& minAddressOut, uintptr_t& maxAddressOut)
+{
+    minAddressOut = (uintptr_t)sysconf(_SC_PAGESIZE);
+    maxAddressOut = (uintptr_t)0x7FFFFFFFFFFF;
+}
+
+bool Platform::findProcessLibrary(void* processHandle, const std::string& libraryName, ProcessLibrary& libraryOut)
+{
+    libraryOut.baseAddress = 0;
+    libraryOut.size = 0;
+
+    // A library is mapped as several consecutive regions, it spans from the first to the last.
+    uintptr_t end = 0;
+    for (const MapEntry& entry : readMaps(toPID(processHandle)))
+    {
+        size_t slash = entry.path.find_last_of('/');
+        std::string fileName = (slash == std::string::npos) ? entry.path : entry.path.substr(slash + 1);
+        if (fileName != libraryName)
+        {
+            continue;
+        }
+
+        if (libraryOut.baseAddress == 0)
+        {
+            libraryOut.baseAddress = entry.start;
+        }
+        end = entry.end;
+    }
+
+    libraryOut.size = end - libraryOut.baseAddress;
+    return libraryOut.baseAddress != 0;
+}
+
+bool Platform::openMemoryRegion(void* processHandle, uintptr_t startAddr, MemoryRegion& memoryRegionOut)
+{
+    memoryRegionOut.baseAddress = 0;
+    memoryRegionOut.size        = 0;
+    memoryRegionOut.isReadable  = false;
+    memoryRegionOut.isWritable  = false;
+    memoryRegionOut.isGuarded   = false;
+
+    // Like VirtualQueryEx, an address in a gap reports the gap up to the next region as unreadable.
+    uintptr_t gapStart = 0;
+    for (const MapEntry& entry : readMaps(toPID(processHandle)))
+    {
+        if (startAddr < entry.start)
+        {
+            memoryRegionOut.baseAddress = std::max(gapStart, startAddr & ~(uintptr_t)0xFFF);
+            memoryRegionOut.size        = entry.start - memoryRegionOut.baseAddress;
+            return true;
+        }
+
+        if (startAddr < entry.end)
+        {
+            memoryRegionOut.baseAddress = entry.start;
+            memoryRegionOut.size        = entry.end - entry.start;
+            memoryRegionOut.isReadable  = entry.perms[0] == 'r';
+            memoryRegionOut.isWritable  = entry.perms[1] == 'w';
+            return true;
+        }
+
+        gapStart = entry.end;
+    }
+
+    return false;
+}
+
+uint32_t Platform::getProcessIDByName(const std::string& processName)
+{
+    // comm is truncated to 15 characters.
+    std::string name = processName.substr(0, 15);
+    for (pid_t pid : getProcessIDs())
+    {
+        if (getProcessName(pid) == name)
+        {
+            return (uint32_t)pid;
+        }
+    }
+
+    return 0;
+}
+
+uintptr_t Platform::getProcessBaseAddress(void* processHandle)
+{
+    pid_t pid = toPID(processHandle);
+
+    char exePath[4096] = {};
+    std::string link = "/proc/" + std::to_string(pid) + "/exe";
+    if (readlink(link.c_str(), exePath, sizeof(exePath) - 1) <= 0)
+    {
+        return 0;
+    }
+
+    for (const MapEntry& entry : readMaps(pid))
+    {
+        if (entry.path == exePath)
+        {
+            return entry.start;
+        }
+    }
+
+    return 0;
+}
+
+std::vector<std::string> Platform::getRunningProcesses()
+{
+    std::vector<std::string> result;
+
+    // Only processes owned by this user can be attached to.
+    uid_t uid = getuid();
+    for (pid_t pid : getProcessIDs())
+    {
+        std::ifstream status("/proc/" + std::to_string(pid) + "/status");
+        std::string line;
+        while (std::getline(status, line))
+        {
+            unsigned int processUID = 0;
+            if (sscanf(line.c_str(), "Uid: %u", &processUID) == 1)
+            {
+                if (processUID == uid)
+                {
+                    result.push_back(getProcessName(pid));
+                }
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+void Platform::debuggerLog(const std::string& message)
+{
+}
+
+bool Platform::raiseProcessPriority()
+{
+    // Lowering niceness below 0 needs CAP_SYS_NICE, without it we carry on at normal priority.
+    return setpriority(PRIO_PROCESS, 0, -10) == 0;
+}
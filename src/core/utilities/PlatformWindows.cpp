@@ -232,4 +232,9 @@ void Platform::debuggerLog(const std::string& message)
 {
     // Write to Visual Studio debug console
     OutputDebugStringA(message.c_str());
+}
+
+bool Platform::raiseProcessPriority()
+{
+    return SetPriorityClass(GetCurrentProcess(), HIGH_PRIORITY_CLASS) != 0;
 }
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// Fixed size queue for passing items from exactly one producer thread to exactly one consumer thread
+// without locking. Each side only ever writes its own index, the other side's index is read with acquire
+// ordering so an item is fully written before it can be seen.
+template <typename T, size_t Capacity>
+class SPSCQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SPSCQueue capacity must be a power of two.");
+
+public:
+    // Producer only. Returns false if the queue is full.
+    bool push(T item)
+    {
+        size_t tail = tailIndex.load(std::memory_order_relaxed);
+        if (tail - headIndex.load(std::memory_order_acquire) >= Capacity)
+        {
+            return false;
+        }
+
+        items[tail & (Capacity - 1)] = std::move(item);
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer only. Returns false if the queue is empty.
+    bool pop(T& itemOut)
+    {
+        size_t head = headIndex.load(std::memory_order_relaxed);
+        if (head == tailIndex.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        T& item = items[head & (Capacity - 1)];
+        itemOut = std::move(item);
+        item = T();
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const { return headIndex.load(std::memory_order_acquire) == tailIndex.load(std::memory_order_acquire); }
+
+private:
+    std::array<T, Capacity> items{};
+
+    // Kept on separate cache lines so the two threads don't contend over them.
+    alignas(64) std::atomic<size_t> headIndex{ 0 };
+    alignas(64) std::atomic<size_t> tailIndex{ 0 };
+};
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -68,7 +70,7 @@ public:
         static_assert(std::is_trivially_copyable<T>::value, "Type must be trivially copyable");
 
         std::ofstream out(filename, std::ios::binary);
-        if (!out) throw std::runtime_error("Failed to open file for writing.");
+        if (!out) return;
 
         out.write(reinterpret_cast<const char*>(&size), sizeof(size));
         out.write(reinterpret_cast<const char*>(arr), size * sizeof(T));
@@ -80,7 +82,7 @@ public:
         static_assert(std::is_trivially_copyable<T>::value, "Type must be trivially copyable");
 
         std::ifstream in(filename, std::ios::binary);
-        if (!in) throw std::runtime_error("Failed to open file for reading.");
+        if (!in) return nullptr;
 
         size_t size = 0;
         in.read(reinterpret_cast<char*>(&size), sizeof(size));
@@ -97,7 +99,7 @@ public:
         static_assert(std::is_trivially_copyable<T>::value, "Type must be trivially copyable");
 
         std::ofstream out(filename, std::ios::binary);
-        if (!out) throw std::runtime_error("Failed to open file for writing.");
+        if (!out) return;
 
         size_t size = vec.size();
         out.write(reinterpret_cast<const char*>(&size), sizeof(size));
@@ -110,7 +112,7 @@ public:
         static_assert(std::is_trivially_copyable<T>::value, "Type must be trivially copyable");
 
         std::ifstream in(filename, std::ios::binary);
-        if (!in) throw std::runtime_error("Failed to open file for reading.");
+        if (!in) return {};
 
         size_t size = 0;
         in.read(reinterpret_cast<char*>(&size), sizeof(size));
@@ -188,6 +190,35 @@ public:
         return combined;
     }
 
+    // Fast non-cryptographic hash that consumes 8 bytes at a time, used for fingerprinting memory.
+    static uint64_t hashBytes(const uint8_t* data, size_t size, uint64_t hash = 0x9E3779B97F4A7C15)
+    {
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            uint64_t word;
+            memcpy(&word, data + i, 8);
+
+            word *= 0xff51afd7ed558ccd;
+            word ^= word >> 32;
+            hash = (hash ^ word) * 0xc4ceb9fe1a85ec53;
+            hash = (hash << 31) | (hash >> 33);
+        }
+
+        uint64_t tail = 0;
+        memcpy(&tail, data + i, size - i);
+        hash ^= tail ^ size;
+
+        // MurmurHash3 64-bit mixer
+        hash ^= hash >> 33;
+        hash *= 0xff51afd7ed558ccd;
+        hash ^= hash >> 33;
+        hash *= 0xc4ceb9fe1a85ec53;
+        hash ^= hash >> 33;
+
+        return hash;
+    }
+
     static uint64_t makeSeed64(uint32_t seed, uint16_t data16, uint8_t data8)
     {
         // Pack: [16-bit data16 | 8-bit data8 | 8-bit padding/zero]
@@ -202,6 +233,13 @@ public:
         return std::sqrt(static_cast<float>(dx * dx + dy * dy));
     }
 
+    static int64_t getDistanceSquared(int x1, int y1, int x2, int y2)
+    {
+        int64_t dx = static_cast<int64_t>(x2) - x1;
+        int64_t dy = static_cast<int64_t>(y2) - y1;
+        return dx * dx + dy * dy;
+    }
+
     static std::string sanitizeName(const std::string& name) 
     {
         std::string result;
@@ -11,6 +11,8 @@ public:
     std::string description = "";
     bool settingsVisible = false;
 
+    virtual ~Extra() = default;
+
     virtual void setup() {}
     virtual bool hasSettings() { return false; }
     virtual bool onSettingsGUI() { return false; }
@@ -19,6 +21,10 @@ public:
     virtual bool hasDebugGUI() { return false; }
     virtual void onDebugGUI() {}
 
+    // Loading that doesn't need the game, run on a worker thread at startup. The returned function
+    // is called on the GUI thread once loading finishes to apply the results.
+    virtual std::function<void()> loadAsync() { return nullptr; }
+
     void setManager(GameManager* gameManager)
     {
         game = gameManager;
@@ -28,6 +34,9 @@ protected:
     GameManager* game;
 
 public:
+    // Copies a registered extra, settings and all, for a GameManager that runs its own set.
+    Extra* (*clone)(const Extra*) = nullptr;
+
     static std::vector<Extra*>& getList()
     {
         static std::vector<Extra*> list;
@@ -47,6 +56,7 @@ public:
                 ClassName* tmp = new ClassName(); \
                 tmp->name = NameStr; \
                 tmp->description = DescStr; \
+                tmp->clone = [](const Extra* source) -> Extra* { return new ClassName(*static_cast<const ClassName*>(source)); }; \
                 Extra::registerExtra(NameStr, tmp); \
             } \
         }; \
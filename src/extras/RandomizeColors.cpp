@@ -2,13 +2,15 @@
 #include "core/audio/AudioManager.h"
 #include "core/game/GameData.h"
 #include "core/game/MemoryOffsets.h"
-#include "core/gui/GUI.h"
 #include "core/utilities/Logging.h"
 #include "core/utilities/MemorySearch.h"
 #include "core/utilities/ModelEditor.h"
 #include "core/utilities/Utilities.h"
 
+#if IRONMOG_GUI
+#include "core/gui/GUI.h"
 #include <imgui.h>
+#endif
 
 REGISTER_EXTRA(RandomizeColors, "Randomize Colors", "Playable characters clothing colors are randomized.")
 
@@ -18,10 +20,11 @@ REGISTER_EXTRA(RandomizeColors, "Randomize Colors", "Playable characters
 void RandomizeColors::setup()
 {
     BIND_EVENT(game->onStart, RandomizeColors::onStart);
+    BIND_EVENT(game->onResync, RandomizeColors::onResync);
     BIND_EVENT_ONE_ARG(game->onFieldChanged, RandomizeColors::onFieldChanged);
     BIND_EVENT(game->onBattleEnter, RandomizeColors::onBattleEnter);
     BIND_EVENT(game->onWorldMapEnter, RandomizeColors::onWorldMapEnter);
-    BIND_EVENT_ONE_ARG(game->onFrame, RandomizeColors::onFrame);
+    BIND_EVENT_TWO_ARG(game->onFrame, RandomizeColors::onFrame);
 
     debugStartNum[0] = '\0';
     debugCount[0] = '\0';
@@ -29,6 +32,7 @@ void RandomizeColors::setup()
     modelEditor.setup(game);
 }
 
+#if IRONMOG_GUI
 void RandomizeColors::onDebugGUI()
 {
     uint16_t fieldScreenFade = game->read<uint16_t>(GameOffsets::FieldScreenFade);
@@ -41,15 +45,21 @@ void RandomizeColors::onDebugGUI()
 
     if (ImGui::Button("Force Update", ImVec2(120, 0)))
     {
-        if (game->getGameModule() == GameModule::Battle)
-        {
-            waitingForBattle = true;
-        }
-        else 
+        GameManager::GameCommand command;
+        command.type = GameManager::GameCommand::Type::Callback;
+        command.callback = [this]()
         {
-            modelEditor.findFieldModels();
-            applyColors();
-        }
+            if (game->getGameModule() == GameModule::Battle)
+            {
+                waitingForBattle = true;
+            }
+            else 
+            {
+                modelEditor.findFieldModels();
+                applyColors();
+            }
+        };
+        game->queueCommand(std::move(command));
     }
 
     if (ImGui::CollapsingHeader("Current Models"))
@@ -115,14 +125,15 @@ void RandomizeColors::onDebugGUI()
         GUI::drawColorGrid("debugColors", debugColors, [this](int clickedIndex, Utilities::Color clickedColor)
             {
                 uintptr_t addr = debugAddresses[clickedIndex];
-                game->write<uint8_t>(addr + 0, 0xFF);
-                game->write<uint8_t>(addr + 1, 0x00);
-                game->write<uint8_t>(addr + 2, 0xFF);
+                game->queueWrite<uint8_t>(addr + 0, 0xFF);
+                game->queueWrite<uint8_t>(addr + 1, 0x00);
+                game->queueWrite<uint8_t>(addr + 2, 0xFF);
 
                 DEBUG_LOG("Clicked color %zu %d: RGB(%d, %d, %d)", clickedIndex, addr, clickedColor.r, clickedColor.g, clickedColor.b);
             });
     }
 }
+#endif
 
 Utilities::Color getRandomColor(std::mt19937& rng)
 {
@@ -152,6 +163,7 @@ Utilities::Color getRandomColor(std::mt19937& rng)
     return Utilities::HSVtoRGB(h, s, v);
 }
 
+#if IRONMOG_GUI
 bool RandomizeColors::onSettingsGUI()
 {
     ImGui::BeginDisabled(game == nullptr);
@@ -162,9 +174,9 @@ bool RandomizeColors::onSettingsGUI()
         randomModelColors.clear();
 
         // Generate table of random colors
-        for (Model& model : GameData::models)
+        for (const Model& model : GameData::models)
         {
-            std::string& modelName = model.name;
+            std::string modelName = model.name;
             for (int i = 0; i < COLORS_PER_MODEL; ++i)
             {
                 randomModelColors[modelName].push_back(getRandomColor(rng));
@@ -177,6 +189,7 @@ bool RandomizeColors::onSettingsGUI()
 
     return false;
 }
+#endif
 
 void RandomizeColors::onStart()
 {
@@ -184,15 +197,18 @@ void RandomizeColors::onStart()
 
     // Generate table of random colors
     randomModelColors.clear();
-    for (Model& model : GameData::models)
+    for (const Model& model : GameData::models)
     {
-        std::string& modelName = model.name;
+        std::string modelName = model.name;
         for (int i = 0; i < COLORS_PER_MODEL; ++i)
         {
             randomModelColors[modelName].push_back(getRandomColor(rng));
         }
     }
+}
 
+void RandomizeColors::onResync()
+{
     modelEditor.clear();
 }
 
@@ -214,7 +230,7 @@ void RandomizeColors::onWorldMapEnter()
     applyColors();
 }
 
-void RandomizeColors::onFrame(uint32_t frameNumber)
+void RandomizeColors::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
 {
     uint8_t gameModule = game->getGameModule();
     
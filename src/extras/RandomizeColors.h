@@ -9,17 +9,20 @@ class RandomizeColors : public Extra
 {
 public:
     void setup() override;
+    bool hasSettings() override { return true; }
+#if IRONMOG_GUI
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
-    bool hasSettings() override { return true; }
     bool onSettingsGUI() override;
+#endif
 
 private:
     void onStart();
+    void onResync();
     void onFieldChanged(uint16_t fieldID);
     void onBattleEnter();
     void onWorldMapEnter();
-    void onFrame(uint32_t frameNumber);
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
     void applyColors();
 
     ModelEditor modelEditor;
@@ -6,12 +6,17 @@
 #include "core/utilities/Logging.h"
 #include "core/utilities/Utilities.h"
 
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
+#include <atomic>
 #include <filesystem>
+#include <thread>
 namespace fs = std::filesystem;
 
 const uint16_t UnsetMusicID = 65535;
 const uint16_t FullVolume = 0x7F;
+const std::string HojoText = "Cloud Hojo!  Stop right there!!";
 
 const std::vector<std::string> MusicList = {
     "none", "nothing", "oa", "ob", "dun2", "guitar2", "fanfare", "makoro", "bat",
@@ -31,26 +36,36 @@ const std::vector<std::string> MusicList = {
 
 REGISTER_EXTRA(RandomizeMusic, "Randomize Music", "Music tracks are randomized and can include music from other games.")
 
-RandomizeMusic::RandomizeMusic()
-{
-    scanMusicFolder();
-}
-
 void RandomizeMusic::setup()
 {
-    BIND_EVENT(game->onStart, RandomizeMusic::onStart);
     BIND_EVENT(game->onEmulatorPaused, RandomizeMusic::onEmulatorPaused);
     BIND_EVENT(game->onEmulatorResumed, RandomizeMusic::onEmulatorResumed);
-    BIND_EVENT_ONE_ARG(game->onFrame, RandomizeMusic::onFrame);
+    BIND_EVENT_TWO_ARG(game->onFrame, RandomizeMusic::onFrame);
+
+    // Keep in game music volume locked to 0 while we're playing our own music
+    game->addInvariant<uint16_t>(GameOffsets::MusicVolume, 1, [this]() { return !isDisabled() && overrideMusic; });
+
+    // Fix for midgar raid skip music
+    game->addTextTrigger(0, HojoText, std::bind(&RandomizeMusic::onHojoText, this));
+    game->addInvariant<uint8_t>(GameOffsets::MusicLock, 0, [this]() { return !isDisabled() && hojoTextShown && game->getFieldID() == 741; });
 
     previousMusicID = UnsetMusicID;
 }
 
+#if IRONMOG_GUI
+// Only the app rescans, from the settings panel.
+static std::atomic<bool> rescanning = false;
+
 bool RandomizeMusic::onSettingsGUI()
 {
     bool changed = false;
 
-    if (disabled)
+    std::shared_ptr<const MusicIndex> index = getMusicIndex();
+    if (index == nullptr)
+    {
+        ImGui::Text("Scanning music folder..");
+    }
+    else if (index->trackCount == 0)
     {
         ImGui::Text("No music found, randomization disabled.");
     }
@@ -73,14 +88,21 @@ bool RandomizeMusic::onSettingsGUI()
         previousVolume = currentVolume;
     }
 
-    // Rescan
+    // Rescan, the current index stays in use until the new one is ready.
+    ImGui::BeginDisabled(index == nullptr || rescanning);
     if (ImGui::Button("Rescan Music Folder", ImVec2(150, 0)))
     {
-        scanMusicFolder();
+        rescanning = true;
+        std::thread([this]()
+        {
+            applyMusicIndex(scanMusicFolder());
+            rescanning = false;
+        }).detach();
     }
+    ImGui::EndDisabled();
 
     ImGui::SameLine();
-    std::string trackCountText = "Tracks: " + std::to_string(trackCount);
+    std::string trackCountText = "Tracks: " + std::to_string(index != nullptr ? index->trackCount : 0);
     ImGui::Text(trackCountText.c_str());
 
     // Reroll
@@ -93,6 +115,7 @@ bool RandomizeMusic::onSettingsGUI()
 
     return changed;
 }
+#endif
 
 void RandomizeMusic::loadSettings(const ConfigFile& cfg)
 {
@@ -106,6 +129,7 @@ void RandomizeMusic::saveSettings(ConfigFile& cfg)
     cfg.set<float>("volume", currentVolume);
 }
 
+#if IRONMOG_GUI
 void RandomizeMusic::onDebugGUI()
 {
     uint16_t musicID = game->read<uint16_t>(GameOffsets::MusicID);
@@ -121,10 +145,11 @@ void RandomizeMusic::onDebugGUI()
     std::string validStackStr = "Stack: " + std::to_string(previousValidStack[0]) + " " + std::to_string(previousValidStack[1]);
     ImGui::Text(validStackStr.c_str());
 }
+#endif
 
 bool RandomizeMusic::isPlaying()
 {
-    if (disabled)
+    if (isDisabled())
     {
         return false;
     }
@@ -134,7 +159,7 @@ bool RandomizeMusic::isPlaying()
 
 std::string RandomizeMusic::getCurrentlyPlaying()
 {
-    if (disabled)
+    if (isDisabled())
     {
         return "";
     }
@@ -142,14 +167,9 @@ std::string RandomizeMusic::getCurrentlyPlaying()
     return currentSong;
 }
 
-void RandomizeMusic::onStart()
-{
-    scanMusicFolder();
-}
-
 void RandomizeMusic::onEmulatorPaused()
 {
-    if (disabled)
+    if (isDisabled())
     {
         return;
     }
@@ -159,7 +179,7 @@ void RandomizeMusic::onEmulatorPaused()
 
 void RandomizeMusic::onEmulatorResumed()
 {
-    if (disabled)
+    if (isDisabled())
     {
         return;
     }
@@ -167,29 +187,27 @@ void RandomizeMusic::onEmulatorResumed()
     AudioManager::resumeMusic();
 }
 
-void RandomizeMusic::onFrame(uint32_t frameNumber)
+void RandomizeMusic::onHojoText()
 {
-    if (disabled)
+    if (isDisabled())
     {
         return;
     }
 
-    // Fix for midgar raid skip music
-    if (game->getFieldID() == 741)
+    // The trigger only fires when the line appears, the invariant keeps the lock cleared until it's gone.
+    hojoTextShown = game->getFieldID() == 741;
+}
+
+void RandomizeMusic::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
+{
+    if (isDisabled())
     {
-        if (game->read<uint8_t>(GameOffsets::MusicLock) == 1)
-        {
-            if (game->getWindowText(0) == "Cloud Hojo!  Stop right there!!")
-            {
-                game->write<uint8_t>(GameOffsets::MusicLock, 0);
-            }
-        }
+        return;
     }
 
-    // Keep in game music volume locked to 0
-    if (overrideMusic)
+    if (hojoTextShown && (game->getFieldID() != 741 || game->getWindowText(0) != HojoText))
     {
-        game->write<uint16_t>(GameOffsets::MusicVolume, 1);
+        hojoTextShown = false;
     }
 
     uint16_t musicID = game->read<uint16_t>(GameOffsets::MusicID);
@@ -231,14 +249,15 @@ void RandomizeMusic::onFrame(uint32_t frameNumber)
         // Reuse previously selected random track.
         if (usePreviousTrackSelection)
         {
+            std::shared_ptr<const MusicIndex> index = getMusicIndex();
             if (useCuratedMusic)
             {
-                std::vector<Track> tracks = musicMap[MusicList[musicID]];
+                auto tracks = index->musicMap.find(MusicList[musicID]);
                 uint16_t selectedMusic = previousTrackSelection[musicID];
 
-                if (selectedMusic < tracks.size())
+                if (tracks != index->musicMap.end() && selectedMusic < tracks->second.size())
                 {
-                    const Track& track = tracks[selectedMusic];
+                    const Track& track = tracks->second[selectedMusic];
                     play(track);
                     didRandomize = true;
                 }
@@ -246,9 +265,9 @@ void RandomizeMusic::onFrame(uint32_t frameNumber)
             else
             {
                 uint16_t selectedMusic = previousTrackSelection[musicID];
-                if (selectedMusic < uniqueTrackList.size())
+                if (selectedMusic < index->uniqueTrackList.size())
                 {
-                    const Track& track = uniqueTrackList[selectedMusic];
+                    const Track& track = index->uniqueTrackList[selectedMusic];
                     play(track);
                     didRandomize = true;
                 }
@@ -276,11 +295,16 @@ void RandomizeMusic::onFrame(uint32_t frameNumber)
     }
 }
 
-void RandomizeMusic::scanMusicFolder()
+std::function<void()> RandomizeMusic::loadAsync()
+{
+    MusicIndex index = scanMusicFolder();
+    return [this, index = std::move(index)]() mutable { applyMusicIndex(std::move(index)); };
+}
+
+// Only touches the returned index so it can run on a worker thread.
+MusicIndex RandomizeMusic::scanMusicFolder()
 {
-    musicMap.clear();
-    uniqueTrackList.clear();
-    trackCount = 0;
+    MusicIndex index;
 
     // Scan music folder
     const std::string basePath = "music";
@@ -288,8 +312,7 @@ void RandomizeMusic::scanMusicFolder()
     if (!fs::exists(basePath) || !fs::is_directory(basePath))
     {
         LOG("Randomize Music Error: music directory does not exist.");
-        disabled = true;
-        return;
+        return index;
     }
 
     for (const std::string& name : MusicList)
@@ -319,22 +342,36 @@ void RandomizeMusic::scanMusicFolder()
             if (ext == ".mp3" || ext == ".wav")
             {
                 Track track = loadTrack(entry.path().string());
-                musicMap[name].push_back(track);
-                addUniqueTrack(track);
-                trackCount++;
+                index.musicMap[name].push_back(track);
+                addUniqueTrack(index, track);
+                index.trackCount++;
             }
         }
     }
 
-    if (trackCount > 0)
-    {
-        disabled = false;
-    }
-    else
+    if (index.trackCount == 0)
     {
         LOG("Randomize Music Error: no music was found.");
-        disabled = true;
     }
+
+    return index;
+}
+
+// Safe to call from any thread, readers keep using the index they already hold.
+void RandomizeMusic::applyMusicIndex(MusicIndex index)
+{
+    std::atomic_store(&musicIndex, std::shared_ptr<const MusicIndex>(std::make_shared<MusicIndex>(std::move(index))));
+}
+
+std::shared_ptr<const MusicIndex> RandomizeMusic::getMusicIndex() const
+{
+    return std::atomic_load(&musicIndex);
+}
+
+bool RandomizeMusic::isDisabled() const
+{
+    std::shared_ptr<const MusicIndex> index = getMusicIndex();
+    return index == nullptr || index->trackCount == 0;
 }
 
 Track RandomizeMusic::loadTrack(std::string path)
@@ -359,13 +396,13 @@ Track RandomizeMusic::loadTrack(std::string path)
     return track;
 }
 
-void RandomizeMusic::addUniqueTrack(const Track& newTrack)
+void RandomizeMusic::addUniqueTrack(MusicIndex& index, const Track& newTrack)
 {
     // Extract the filename once before starting the loop for efficiency
     std::string newFileName = fs::path(newTrack.path).filename().string();
     bool isDuplicate = false;
 
-    for (const Track& track : uniqueTrackList) 
+    for (const Track& track : index.uniqueTrackList) 
     {
         // Extract the filename of the track currently being inspected
         std::string existingFileName = fs::path(track.path).filename().string();
@@ -384,13 +421,14 @@ void RandomizeMusic::addUniqueTrack(const Track& newTrack)
 
     if (!isDuplicate) 
     {
-        uniqueTrackList.push_back(newTrack);
+        index.uniqueTrackList.push_back(newTrack);
     }
 }
 
 bool RandomizeMusic::randomizeMusic(uint16_t musicID)
 {
-    if (musicID >= MusicList.size() || musicMap.count(MusicList[musicID]) == 0)
+    std::shared_ptr<const MusicIndex> index = getMusicIndex();
+    if (index == nullptr || musicID >= MusicList.size() || index->musicMap.count(MusicList[musicID]) == 0)
     {
         return false;
     }
@@ -400,7 +438,7 @@ bool RandomizeMusic::randomizeMusic(uint16_t musicID)
     if (useCuratedMusic)
     {
         // Get available tracks for this music ID
-        std::vector<Track> tracks = musicMap[MusicList[musicID]];
+        const std::vector<Track>& tracks = index->musicMap.at(MusicList[musicID]);
         if (tracks.size() == 0)
         {
             return false;
@@ -411,18 +449,18 @@ bool RandomizeMusic::randomizeMusic(uint16_t musicID)
         uint16_t selectedMusic = (uint16_t)dist(rng);
 
         // Play track
-        Track& track = tracks[selectedMusic];
+        const Track& track = tracks[selectedMusic];
         play(track);
         previousTrackSelection[musicID] = selectedMusic;
     }
     else 
     {
         // Randomly select a track from the unique song list
-        std::uniform_int_distribution<size_t> dist(0, uniqueTrackList.size() - 1);
+        std::uniform_int_distribution<size_t> dist(0, index->uniqueTrackList.size() - 1);
         uint16_t selectedMusic = (uint16_t)dist(rng);
 
         // Play track
-        Track& track = uniqueTrackList[selectedMusic];
+        const Track& track = index->uniqueTrackList[selectedMusic];
         play(track);
         previousTrackSelection[musicID] = selectedMusic;
     }
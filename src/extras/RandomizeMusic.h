@@ -1,6 +1,7 @@
 #pragma once
 #include "extras/Extra.h"
 #include <cstdint>
+#include <memory>
 #include <unordered_map>
 
 // Represents a song found in the 'music' folder
@@ -16,38 +17,49 @@ struct Track
     bool playOnce = false;
 };
 
+// Tracks found in the music folder by internal song name.
+struct MusicIndex
+{
+    std::unordered_map<std::string, std::vector<Track>> musicMap;
+    std::vector<Track> uniqueTrackList;
+    int trackCount = 0;
+};
+
 class RandomizeMusic : public Extra
 {
 public:
-    RandomizeMusic();
-
     void setup() override;
     bool hasSettings() override { return true; }
-    bool onSettingsGUI() override;
     void loadSettings(const ConfigFile& cfg) override;
     void saveSettings(ConfigFile& cfg) override;
+#if IRONMOG_GUI
+    bool onSettingsGUI() override;
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
+    std::function<void()> loadAsync() override;
 
     bool isPlaying();
     std::string getCurrentlyPlaying();
 
 private:
-    void onStart();
     void onEmulatorPaused();
     void onEmulatorResumed();
-    void onFrame(uint32_t frameNumber);
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
+    void onHojoText();
 
-    void scanMusicFolder();
-    Track loadTrack(std::string path);
-    void addUniqueTrack(const Track& newTrack);
+    static MusicIndex scanMusicFolder();
+    static Track loadTrack(std::string path);
+    static void addUniqueTrack(MusicIndex& index, const Track& newTrack);
+    void applyMusicIndex(MusicIndex index);
+    std::shared_ptr<const MusicIndex> getMusicIndex() const;
+    bool isDisabled() const;
     bool randomizeMusic(uint16_t musicID);
     void play(const Track& track);
 
     bool useCuratedMusic = true;
-    bool disabled = false;
     bool overrideMusic = false;
-    int trackCount = 0;
+    bool hojoTextShown = false;
     std::string currentSong = "";
     float currentVolume = 1.0f;
     float previousVolume = 1.0f;
@@ -56,6 +68,8 @@ private:
     uint16_t previousValidStack[2] = { 0, 0 };
     
     std::unordered_map<uint16_t, uint16_t> previousTrackSelection;
-    std::unordered_map<std::string, std::vector<Track>> musicMap;
-    std::vector<Track> uniqueTrackList;
+
+    // Null until the first scan finishes. Rescans replace it from another thread, so it's only
+    // accessed through getMusicIndex() and applyMusicIndex().
+    std::shared_ptr<const MusicIndex> musicIndex;
 };
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "core/audio/AudioManager.h"
+#include "core/game/GameManager.h"
+#include "core/game/InstanceManager.h"
+#include "core/utilities/ConfigFile.h"
+#include "core/utilities/Logging.h"
+#include "core/utilities/Platform.h"
+#include "core/utilities/Utilities.h"
+#include "extras/Extra.h"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Runs the rules against an emulator with no window, for CI, soak runs and benchmarking.
+//
+// Usage: IronMogHeadless [--settings <name>] [--emulator duckstation|bizhawk] [--process <name> --address <hex>] [--seed <hex>]
+//
+// Several emulators can be driven at once by giving --instance once per emulator process, all of them
+// run the same settings and seed. --threads sets how many worker threads poll them.
+//
+// --record <path> records the first game's RAM to a trace that the benchmark can replay.
+
+static std::atomic<bool> stopRequested{ false };
+
+static void onSignal(int)
+{
+    stopRequested = true;
+}
+
+struct HeadlessOptions
+{
+    std::string settings = "Default";
+    std::string emulator = "duckstation";
+    std::string process;
+    std::string address;
+    std::string seed;
+    std::vector<std::string> instances;
+    uint32_t threads = 2;
+    std::string record;
+};
+
+static bool parseOptions(int argc, char** argv, HeadlessOptions& optionsOut)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (value == nullptr)
+        {
+            LOG("Missing value for %s", arg);
+            return false;
+        }
+
+        if (strcmp(arg, "--settings") == 0)      optionsOut.settings = value;
+        else if (strcmp(arg, "--emulator") == 0) optionsOut.emulator = value;
+        else if (strcmp(arg, "--process") == 0)  optionsOut.process = value;
+        else if (strcmp(arg, "--address") == 0)  optionsOut.address = value;
+        else if (strcmp(arg, "--seed") == 0)     optionsOut.seed = value;
+        else if (strcmp(arg, "--instance") == 0) optionsOut.instances.push_back(value);
+        else if (strcmp(arg, "--threads") == 0)  optionsOut.threads = (uint32_t)atoi(value);
+        else if (strcmp(arg, "--record") == 0)   optionsOut.record = value;
+        else
+        {
+            LOG("Unknown argument: %s", arg);
+            return false;
+        }
+        ++i;
+    }
+
+    return true;
+}
+
+static std::string getProcessName(const HeadlessOptions& options)
+{
+    if (!options.process.empty())
+    {
+        return options.process;
+    }
+
+    if (options.emulator == "bizhawk")
+    {
+        return "EmuHawk.exe";
+    }
+
+    return "duckstation-qt-x64-ReleaseLTCG.exe";
+}
+
+int main(int argc, char** argv)
+{
+    logger.setConsoleOutput(true);
+    LOG("IronMog FF7 (headless)");
+
+    HeadlessOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    if (!Platform::raiseProcessPriority())
+    {
+        LOG("Could not raise process priority, running at normal priority.");
+    }
+
+    std::string seedStr = options.seed;
+    ConfigFile cfg;
+    std::string settingsPath = "settings/" + options.settings + ".cfg";
+    if (cfg.load(settingsPath))
+    {
+        LOG("Loaded settings from: %s", settingsPath.c_str());
+        if (seedStr.empty())
+        {
+            seedStr = cfg.get<std::string>("seed", "");
+        }
+        GameManager::loadRuleSettings(cfg);
+    }
+    else
+    {
+        LOG("Failed to load settings from: %s", settingsPath.c_str());
+        return 1;
+    }
+
+    if (seedStr.empty())
+    {
+        std::random_device rd;
+        char seedValue[9] = {};
+        snprintf(seedValue, sizeof(seedValue), "%08X", (static_cast<uint32_t>(rd()) << 16) ^ rd());
+        seedStr = seedValue;
+        LOG("Seed generated: %s", seedValue);
+    }
+
+    if (options.instances.empty())
+    {
+        options.instances.push_back(getProcessName(options));
+    }
+
+    // Every instance would share the one audio device and pause each other's music, so music is only
+    // randomized when running a single game.
+    bool musicEnabled = false;
+    for (auto& extra : Extra::getList())
+    {
+        if (extra->enabled && extra->name == "Randomize Music")
+        {
+            if (options.instances.size() > 1)
+            {
+                extra->enabled = false;
+                LOG("Randomize Music disabled, it only runs with a single instance.");
+            }
+            musicEnabled = extra->enabled;
+        }
+    }
+
+    // There's no frame loop to hand the results back to, so extras load in place.
+    for (auto& extra : Extra::getList())
+    {
+        std::function<void()> apply = extra->loadAsync();
+        if (apply)
+        {
+            apply();
+        }
+    }
+
+    if (musicEnabled)
+    {
+        AudioManager::initialize();
+    }
+
+    // A custom address only makes sense for a single process.
+    uintptr_t memoryAddress = (options.instances.size() == 1) ? Utilities::parseAddress(options.address) : 0;
+    uint32_t seed = Utilities::hexStringToSeed(seedStr);
+
+    RAMTrace::Writer traceWriter;
+    if (!options.record.empty() && !traceWriter.open(options.record))
+    {
+        LOG("Failed to open trace for recording: %s", options.record.c_str());
+        return 1;
+    }
+
+    InstanceManager instanceManager(options.threads);
+    for (size_t i = 0; i < options.instances.size(); ++i)
+    {
+        std::string name = "Game " + std::to_string(i + 1);
+        GameManager* game = instanceManager.addInstance(name, options.instances[i], memoryAddress, seed);
+        if (game == nullptr)
+        {
+            return 1;
+        }
+
+        if (i == 0 && !options.record.empty())
+        {
+            game->setTraceWriter(&traceWriter);
+        }
+    }
+
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    instanceManager.start();
+    while (!stopRequested.load() && instanceManager.hasConnectedInstances())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    instanceManager.stop();
+    instanceManager.logStats();
+
+    if (!options.record.empty())
+    {
+        traceWriter.close();
+        LOG("Recorded %u frames to: %s", traceWriter.getFrameCount(), options.record.c_str());
+    }
+
+    return stopRequested.load() ? 0 : 1;
+}
@@ -8,7 +8,6 @@
 int WINAPI wWinMain(HINSTANCE, HINSTANCE, PWSTR, int)
 {
     AudioManager::initialize();
-    GameData::loadGameData();
 
     App app;
     app.run();
@@ -0,0 +1,179 @@
+#include "RAMFixture.h"
+#include "core/game/MemoryOffsets.h"
+#include "core/game/TextCodec.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+void RAMFixture::placeField(const FieldData& field)
+{
+    write<uint8_t>(GameOffsets::CurrentModule, GameModule::Field);
+    write<uint16_t>(GameOffsets::FieldID, field.id);
+    write<uint16_t>(GameOffsets::FieldScreenFade, 0);
+
+    fieldScriptStart = FieldScriptOffsets::ScriptStart;
+    fieldScriptEnd = FieldScriptOffsets::ScriptStart;
+
+    for (const FieldScriptItem& item : field.items)
+    {
+        uintptr_t itemOffset = FieldScriptOffsets::ScriptStart + item.offset;
+        write<uint16_t>(itemOffset + FieldScriptOffsets::ItemID, item.id);
+        write<uint8_t>(itemOffset + FieldScriptOffsets::ItemQuantity, item.quantity);
+        markFieldScript(itemOffset, FieldScriptOffsets::ItemQuantity + 1);
+    }
+
+    for (const FieldScriptItem& materia : field.materia)
+    {
+        uintptr_t materiaOffset = FieldScriptOffsets::ScriptStart + materia.offset;
+        write<uint8_t>(materiaOffset + FieldScriptOffsets::MateriaID, (uint8_t)materia.id);
+        markFieldScript(materiaOffset, FieldScriptOffsets::MateriaID + 1);
+    }
+
+    // Message opcode followed later by its text, which must fit its original length. The text names the
+    // nearest pickup in the same script as the game's does, so lookups by item name find it.
+    for (const FieldScriptMessage& message : field.messages)
+    {
+        uintptr_t textOffset = FieldScriptOffsets::ScriptStart + message.strOffset;
+        write<uint8_t>(FieldScriptOffsets::ScriptStart + message.offset, 0x40);
+        TextCodec::encode("Received \"" + findPickUpName(field, message) + "\"!", ram.data() + textOffset, message.strLength);
+        write<uint8_t>(textOffset + message.strLength, TextCodec::ControlCode::End);
+        markFieldScript(FieldScriptOffsets::ScriptStart + message.offset, 1);
+        markFieldScript(textOffset, message.strLength + 1);
+    }
+
+    for (const FieldWorldExit& exit : field.worldExits)
+    {
+        write<uint16_t>(FieldScriptOffsets::TriggersStart + exit.offset, exit.fieldID);
+        markFieldScript(FieldScriptOffsets::TriggersStart + exit.offset, sizeof(uint16_t));
+    }
+
+    for (uint8_t t = 0; t < 2; ++t)
+    {
+        uintptr_t tableOffset = FieldScriptOffsets::EncounterStart + field.encounterOffset + (t * FieldScriptOffsets::EncounterTableStride);
+        for (uint8_t i = 0; i < 10; ++i)
+        {
+            write<uint16_t>(tableOffset + 2 + (i * sizeof(uint16_t)), field.getEncounter(t, i).raw);
+        }
+        markFieldScript(tableOffset, FieldScriptOffsets::EncounterTableStride);
+    }
+}
+
+void RAMFixture::placeFieldModel(const Model& model)
+{
+    // Command byte and size in words of each polygon kind, in the order a part is drawn.
+    struct PolyKind
+    {
+        uint8_t command;
+        uint32_t words;
+        int ModelPart::* count;
+    };
+    static const PolyKind kinds[] = {
+        { 0x3C, 13, &ModelPart::quadColorTex },
+        { 0x34, 10, &ModelPart::triColorTex },
+        { 0x30, 7,  &ModelPart::triColor },
+        { 0x38, 9,  &ModelPart::quadColor },
+    };
+
+    uintptr_t offset = FieldModelBuffer;
+    for (const ModelPart& part : model.parts)
+    {
+        for (int bufferCopy = 0; bufferCopy < 2; ++bufferCopy)
+        {
+            for (const PolyKind& kind : kinds)
+            {
+                for (int i = 0; i < part.*kind.count; ++i)
+                {
+                    // Each vertex gets a grey gouraud color, the command shares the first color word.
+                    write<uint32_t>(offset, ((uint32_t)kind.command << 24) | 0x808080);
+                    for (uint32_t word = 1; word < kind.words; ++word)
+                    {
+                        write<uint32_t>(offset + (word * 4), 0x00808080);
+                    }
+                    offset += kind.words * 4;
+                }
+            }
+        }
+    }
+
+    // Ends the run of polygons.
+    write<uint32_t>(offset, 0);
+}
+
+void RAMFixture::restoreFieldScript(uint8_t* ramOut)
+{
+    memcpy(ramOut + fieldScriptStart, ram.data() + fieldScriptStart, fieldScriptEnd - fieldScriptStart);
+}
+
+const FieldData& RAMFixture::findFieldWithMostItems()
+{
+    const FieldData* best = &GameData::fields[0];
+    for (const FieldData& field : GameData::fields)
+    {
+        // Debug rooms start with "black", rules leave them alone so they'd measure nothing.
+        if (strncmp(field.name, "black", 5) == 0)
+        {
+            continue;
+        }
+
+        size_t count = field.items.size() + field.materia.size();
+        if (count > best->items.size() + best->materia.size())
+        {
+            best = &field;
+        }
+    }
+
+    return *best;
+}
+
+const Model& RAMFixture::findLargestFieldModel()
+{
+    const Model* best = &GameData::models[0];
+    for (const Model& model : GameData::models)
+    {
+        // Models with mono polygons can't be built by placeFieldModel.
+        int polyCount = 0;
+        for (const ModelPart& part : model.parts)
+        {
+            polyCount += part.quadColorTex + part.triColorTex + part.triColor + part.quadColor;
+        }
+
+        if (polyCount == model.polyCount && model.polyCount > best->polyCount)
+        {
+            best = &model;
+        }
+    }
+
+    return *best;
+}
+
+std::string RAMFixture::findPickUpName(const FieldData& field, const FieldScriptMessage& message)
+{
+    std::string name;
+    uint32_t bestDistance = UINT32_MAX;
+    auto consider = [&](const FieldScriptItem& pickup, const std::string& pickupName)
+    {
+        uint32_t distance = (uint32_t)std::abs((int32_t)(message.offset - pickup.offset));
+        if (pickup.group == message.group && pickup.script == message.script && distance < bestDistance)
+        {
+            bestDistance = distance;
+            name = pickupName;
+        }
+    };
+
+    for (const FieldScriptItem& item : field.items)
+    {
+        consider(item, GameData::getItemName(item.id));
+    }
+    for (const FieldScriptItem& materia : field.materia)
+    {
+        consider(materia, GameData::getMateriaName((uint8_t)materia.id));
+    }
+
+    return name;
+}
+
+void RAMFixture::markFieldScript(uintptr_t offset, size_t size)
+{
+    fieldScriptStart = std::min(fieldScriptStart, offset);
+    fieldScriptEnd = std::max(fieldScriptEnd, offset + size);
+}
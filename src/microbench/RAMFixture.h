@@ -0,0 +1,53 @@
+#pragma once
+
+#include "core/emulators/RAMTrace.h"
+#include "core/game/GameData.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// A PS1 RAM image built from GameData, with data placed where the game keeps it, so code under
+// benchmark reads the same values it would in game.
+class RAMFixture
+{
+public:
+    // Where ModelEditor looks for field models.
+    static constexpr uintptr_t FieldModelBuffer = 1284000;
+
+    RAMFixture() : ram(RAMTrace::RAMSize, 0) {}
+
+    uint8_t* data() { return ram.data(); }
+
+    template <typename T>
+    void write(uintptr_t offset, T value)
+    {
+        memcpy(ram.data() + offset, &value, sizeof(T));
+    }
+
+    // Puts the game in a field with its items, materia, messages, world exits and encounter tables in
+    // place, as they are once the field has finished loading.
+    void placeField(const FieldData& field);
+
+    // Fills the field model buffer with the GPU polygons of a model, double buffered as the game draws them.
+    // Only the polygon kinds ModelEditor reads for field models are written.
+    void placeFieldModel(const Model& model);
+
+    // Copies the field script area written by placeField over ram, for undoing patches between iterations.
+    void restoreFieldScript(uint8_t* ramOut);
+
+    // The field with the most items and materia, skipping debug rooms.
+    static const FieldData& findFieldWithMostItems();
+
+    // The model with the most polygons that placeFieldModel can represent.
+    static const Model& findLargestFieldModel();
+
+private:
+    std::vector<uint8_t> ram;
+    uintptr_t fieldScriptStart = 0;
+    uintptr_t fieldScriptEnd = 0;
+
+    // Name of the pickup closest to a message in the same script, or empty if there are none.
+    static std::string findPickUpName(const FieldData& field, const FieldScriptMessage& message);
+    void markFieldScript(uintptr_t offset, size_t size);
+};
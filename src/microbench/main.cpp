@@ -0,0 +1,387 @@
+#include "RAMFixture.h"
+#include "core/emulators/MemoryEmulator.h"
+#include "core/game/GameData.h"
+#include "core/game/GameManager.h"
+#include "core/game/MemoryOffsets.h"
+#include "core/game/TextCodec.h"
+#include "core/utilities/ConfigFile.h"
+#include "core/utilities/ModelEditor.h"
+#include "extras/Extra.h"
+#include "rules/Restrictions.h"
+#include "rules/Rule.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+// Times hot functions one at a time against PS1 RAM images synthesized from GameData, so a change to
+// one of them can be measured without recording a session.
+//
+// Usage: IronMogMicroBench [--filter <substring>] [--settings <name>] [--json <path>]
+//
+// Iteration counts are fixed per benchmark so results from different runs and branches line up.
+
+struct Benchmark
+{
+    std::string name;
+    uint64_t iterations = 0;
+    std::function<void()> run;
+
+    // Untimed, called before every iteration when set, eg to undo the writes made by run.
+    std::function<void()> reset = nullptr;
+};
+
+struct BenchmarkResult
+{
+    std::string name;
+    uint64_t iterations = 0;
+    double medianNS = 0.0;
+    double minNS = 0.0;
+};
+
+struct MicroBenchOptions
+{
+    std::string filter;
+    std::string settings;
+    std::string json;
+};
+
+static constexpr int Repeats = 5;
+static constexpr uint32_t Seed = 0x1A2B3C4D;
+
+// Results are added here so the compiler can't drop the calls being timed.
+static volatile uint64_t sink = 0;
+
+static bool parseOptions(int argc, char** argv, MicroBenchOptions& optionsOut)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        const char* arg = argv[i];
+        const char* value = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (value == nullptr)
+        {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return false;
+        }
+
+        if (strcmp(arg, "--filter") == 0)        optionsOut.filter = value;
+        else if (strcmp(arg, "--settings") == 0) optionsOut.settings = value;
+        else if (strcmp(arg, "--json") == 0)     optionsOut.json = value;
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", arg);
+            fprintf(stderr, "Usage: IronMogMicroBench [--filter <substring>] [--settings <name>] [--json <path>]\n");
+            return false;
+        }
+        ++i;
+    }
+
+    return true;
+}
+
+static double elapsedNS(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Runs a tenth of the iterations to warm up, then times every iteration Repeats times over.
+static BenchmarkResult runBenchmark(const Benchmark& benchmark)
+{
+    uint64_t warmup = std::max<uint64_t>(benchmark.iterations / 10, 1);
+    for (uint64_t i = 0; i < warmup; ++i)
+    {
+        if (benchmark.reset) benchmark.reset();
+        benchmark.run();
+    }
+
+    std::vector<double> repeatNS;
+    for (int repeat = 0; repeat < Repeats; ++repeat)
+    {
+        double totalNS = 0.0;
+        if (benchmark.reset)
+        {
+            // Iterations are timed one by one so resets aren't counted.
+            for (uint64_t i = 0; i < benchmark.iterations; ++i)
+            {
+                benchmark.reset();
+                auto start = std::chrono::steady_clock::now();
+                benchmark.run();
+                totalNS += elapsedNS(start);
+            }
+        }
+        else
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (uint64_t i = 0; i < benchmark.iterations; ++i)
+            {
+                benchmark.run();
+            }
+            totalNS = elapsedNS(start);
+        }
+        repeatNS.push_back(totalNS / benchmark.iterations);
+    }
+
+    std::sort(repeatNS.begin(), repeatNS.end());
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.iterations = benchmark.iterations;
+    result.medianNS = repeatNS[Repeats / 2];
+    result.minNS = repeatNS[0];
+    return result;
+}
+
+// A game reading from a copy of the fixture with only the given rule or extra enabled, updated once so it
+// has picked up the module and field. Pass an empty name to enable nothing. Returns null if nothing by
+// that name is enabled once set up, so a renamed rule can't quietly time an empty game.
+static std::unique_ptr<GameManager> createGame(RAMFixture& fixture, const std::string& enabledName, MemoryEmulator*& emulatorOut)
+{
+    std::unique_ptr<GameManager> game = std::make_unique<GameManager>();
+    game->cloneRules();
+    for (Rule* rule : game->getRules())
+    {
+        rule->enabled = rule->name == enabledName;
+    }
+    for (Extra* extra : game->getExtras())
+    {
+        extra->enabled = extra->name == enabledName;
+    }
+
+    emulatorOut = new MemoryEmulator();
+    game->connectToEmulator(emulatorOut, "");
+    memcpy(emulatorOut->getRAM(), fixture.data(), RAMTrace::RAMSize);
+
+    game->setup(Seed);
+    game->update();
+
+    if (!enabledName.empty())
+    {
+        bool enabled = std::any_of(game->getRules().begin(), game->getRules().end(), [&](Rule* rule) { return rule->enabled && rule->name == enabledName; })
+            || std::any_of(game->getExtras().begin(), game->getExtras().end(), [&](Extra* extra) { return extra->enabled && extra->name == enabledName; });
+        if (!enabled)
+        {
+            fprintf(stderr, "No rule or extra named \"%s\" is enabled\n", enabledName.c_str());
+            return nullptr;
+        }
+    }
+
+    // Undo anything the first update wrote, eg rules applied to the field.
+    memcpy(emulatorOut->getRAM(), fixture.data(), RAMTrace::RAMSize);
+    return game;
+}
+
+// Seed generation is onStart and re-deriving state after a load is onResync, each timed with only the
+// named rule or extra listening. Events it doesn't listen to get no row.
+static bool addGenerationBenchmarks(std::vector<Benchmark>& benchmarks, std::vector<std::unique_ptr<GameManager>>& games, RAMFixture& fixture, const std::string& name)
+{
+    MemoryEmulator* emulator = nullptr;
+    std::unique_ptr<GameManager> created = createGame(fixture, name, emulator);
+    if (created == nullptr)
+    {
+        return false;
+    }
+
+    GameManager* game = games.emplace_back(std::move(created)).get();
+    if (!game->onStart.empty())
+    {
+        benchmarks.push_back({ "onStart/" + name, 20, [game]() { game->onStart.invoke(); } });
+    }
+    if (!game->onResync.empty())
+    {
+        benchmarks.push_back({ "onResync/" + name, 20, [game]() { game->onResync.invoke(); } });
+    }
+    return true;
+}
+
+static void addTextBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    static const std::string text = "Received \"Turbo Ether\"!";
+    static uint8_t encoded[64];
+    static char decoded[64];
+    TextCodec::encode(text, encoded, text.size());
+    encoded[text.size()] = TextCodec::ControlCode::End;
+
+    benchmarks.push_back({ "TextCodec::encode", 1000000, []() { sink += TextCodec::encode(text, encoded, text.size()); } });
+    benchmarks.push_back({ "TextCodec::decode", 1000000, []() { sink += TextCodec::decode(encoded, sizeof(encoded), decoded, sizeof(decoded)); } });
+    benchmarks.push_back({ "TextCodec::equals", 1000000, []() { sink += TextCodec::equals(encoded, sizeof(encoded), text); } });
+    benchmarks.push_back({ "TextCodec::hash", 1000000, []() { sink += TextCodec::hash(encoded, sizeof(encoded)); } });
+}
+
+static void addPickerBenchmarks(std::vector<Benchmark>& benchmarks)
+{
+    static std::mt19937_64 rng(Seed);
+
+    benchmarks.push_back({ "GameData::getRandomItem", 100000, []() { sink += GameData::getRandomItem(rng); } });
+    benchmarks.push_back({ "GameData::getRandomArmor", 100000, []() { sink += GameData::getRandomArmor(rng); } });
+    benchmarks.push_back({ "GameData::getRandomWeapon", 100000, []() { sink += GameData::getRandomWeapon(rng); } });
+    benchmarks.push_back({ "GameData::getRandomAccessory", 100000, []() { sink += GameData::getRandomAccessory(rng); } });
+    benchmarks.push_back({ "GameData::getRandomMateria", 100000, []() { sink += GameData::getRandomMateria(rng); } });
+
+    // Potion, picks from the same category as the original.
+    benchmarks.push_back({ "GameData::getRandomItemFromID", 100000, []() { sink += GameData::getRandomItemFromID(0, rng); } });
+}
+
+int main(int argc, char** argv)
+{
+    MicroBenchOptions options;
+    if (!parseOptions(argc, argv, options))
+    {
+        return 1;
+    }
+
+    // Rules run with their default settings unless a settings file is given.
+    if (!options.settings.empty())
+    {
+        ConfigFile cfg;
+        std::string settingsPath = "settings/" + options.settings + ".cfg";
+        if (!cfg.load(settingsPath))
+        {
+            fprintf(stderr, "Failed to load settings from: %s\n", settingsPath.c_str());
+            return 1;
+        }
+        GameManager::loadRuleSettings(cfg);
+    }
+    Restrictions::reset();
+
+    const FieldData& field = RAMFixture::findFieldWithMostItems();
+    RAMFixture fieldFixture;
+    fieldFixture.placeField(field);
+
+    // Every check passes but the screen is still faded out.
+    RAMFixture fadingFixture;
+    fadingFixture.placeField(field);
+    fadingFixture.write<uint16_t>(GameOffsets::FieldScreenFade, 0x100);
+
+    // The previous field's script hasn't been replaced yet, so the first item doesn't match.
+    RAMFixture staleFixture;
+    staleFixture.placeField(field);
+    for (const FieldScriptItem& item : field.items)
+    {
+        staleFixture.write<uint16_t>(FieldScriptOffsets::ScriptStart + item.offset + FieldScriptOffsets::ItemID, 0xFFFF);
+    }
+
+    const Model& model = RAMFixture::findLargestFieldModel();
+    RAMFixture modelFixture;
+    modelFixture.placeFieldModel(model);
+
+    std::vector<Benchmark> benchmarks;
+    addTextBenchmarks(benchmarks);
+    addPickerBenchmarks(benchmarks);
+
+    MemoryEmulator* emulator = nullptr;
+    std::vector<std::unique_ptr<GameManager>> games;
+
+    // Each fixture is checked to hit the path its benchmark is named for before anything is timed.
+    GameManager* loadedGame = games.emplace_back(createGame(fieldFixture, "", emulator)).get();
+    GameManager* fadingGame = games.emplace_back(createGame(fadingFixture, "", emulator)).get();
+    GameManager* staleGame = games.emplace_back(createGame(staleFixture, "", emulator)).get();
+    if (!loadedGame->isFieldDataLoaded(true) || fadingGame->isFieldDataLoaded(false) || staleGame->isFieldDataLoaded(false))
+    {
+        fprintf(stderr, "Field fixtures don't match their isFieldDataLoaded cases\n");
+        return 1;
+    }
+    benchmarks.push_back({ "GameManager::isFieldDataLoaded/loaded", 100000, [loadedGame]() { sink += loadedGame->isFieldDataLoaded(true); } });
+    benchmarks.push_back({ "GameManager::isFieldDataLoaded/fading", 100000, [fadingGame]() { sink += fadingGame->isFieldDataLoaded(false); } });
+    benchmarks.push_back({ "GameManager::isFieldDataLoaded/stale", 100000, [staleGame]() { sink += staleGame->isFieldDataLoaded(false); } });
+
+    // apply() is private, it runs as the rule's only onFieldChanged listener.
+    {
+        std::unique_ptr<GameManager> created = createGame(fieldFixture, "Randomize Field Items", emulator);
+        if (created == nullptr)
+        {
+            return 1;
+        }
+
+        GameManager* game = games.emplace_back(std::move(created)).get();
+        MemoryEmulator* fieldEmulator = emulator;
+        uint16_t fieldID = field.id;
+        RAMFixture* fixture = &fieldFixture;
+
+        game->onFieldChanged.invoke(fieldID);
+        if (memcmp(fieldEmulator->getRAM(), fieldFixture.data(), RAMTrace::RAMSize) == 0)
+        {
+            fprintf(stderr, "Randomize Field Items wrote nothing to %s\n", field.name);
+            return 1;
+        }
+
+        benchmarks.push_back({ "RandomizeFieldItems::apply/" + std::string(field.name), 10000,
+            [game, fieldID]() { game->onFieldChanged.invoke(fieldID); },
+            [game, fieldEmulator, fixture]() { fixture->restoreFieldScript(fieldEmulator->getRAM()); game->clearScriptTriggers(); } });
+    }
+
+    {
+        GameManager* game = games.emplace_back(createGame(modelFixture, "", emulator)).get();
+        std::shared_ptr<ModelEditor> editor = std::make_shared<ModelEditor>();
+        editor->setup(game);
+
+        editor->findFieldModels();
+        if (editor->getOpenModels().empty())
+        {
+            fprintf(stderr, "ModelEditor found no models in the %s fixture\n", model.name);
+            return 1;
+        }
+
+        benchmarks.push_back({ "ModelEditor::findFieldModels/" + std::string(model.name), 1000,
+            [editor]() { editor->findFieldModels(); sink += editor->getOpenModels().size(); } });
+    }
+
+    for (Rule* rule : Rule::getList())
+    {
+        if (!addGenerationBenchmarks(benchmarks, games, fieldFixture, rule->name))
+        {
+            return 1;
+        }
+    }
+
+    for (Extra* extra : Extra::getList())
+    {
+        if (!addGenerationBenchmarks(benchmarks, games, fieldFixture, extra->name))
+        {
+            return 1;
+        }
+    }
+
+    std::vector<BenchmarkResult> results;
+    printf("%-56s %12s %14s %14s\n", "Benchmark", "Iterations", "Median ns/op", "Min ns/op");
+    for (const Benchmark& benchmark : benchmarks)
+    {
+        if (!options.filter.empty() && benchmark.name.find(options.filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        BenchmarkResult result = runBenchmark(benchmark);
+        printf("%-56s %12llu %14.1f %14.1f\n", result.name.c_str(), (unsigned long long)result.iterations, result.medianNS, result.minNS);
+        fflush(stdout);
+        results.push_back(result);
+    }
+
+    if (!options.json.empty())
+    {
+        FILE* out = fopen(options.json.c_str(), "w");
+        if (out == nullptr)
+        {
+            fprintf(stderr, "Failed to open output: %s\n", options.json.c_str());
+            return 1;
+        }
+
+        // Benchmark names come from code and rule names, neither contain characters that need escaping.
+        fprintf(out, "{\n  \"repeats\": %d,\n  \"benchmarks\": [\n", Repeats);
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const BenchmarkResult& result = results[i];
+            fprintf(out, "    { \"name\": \"%s\", \"iterations\": %llu, \"medianNS\": %.1f, \"minNS\": %.1f }%s\n",
+                result.name.c_str(), (unsigned long long)result.iterations, result.medianNS, result.minNS, i + 1 < results.size() ? "," : "");
+        }
+        fprintf(out, "  ]\n}\n");
+        fclose(out);
+    }
+
+    return 0;
+}
@@ -1,29 +1,34 @@
 #include "NoDuping.h"
 #include "core/game/MemoryOffsets.h"
+#include "core/game/MemoryStructs.h"
 #include "core/utilities/Flags.h"
 #include "core/utilities/Logging.h"
 
 #include <bitset>
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <sstream>
 
 REGISTER_RULE(NoDuping, "No Duping", "Prevents duping with W-Item.")
 
 void NoDuping::setup()
 {
-    BIND_EVENT(game->onStart, NoDuping::onStart);
+    BIND_EVENT(game->onResync, NoDuping::onResync);
     BIND_EVENT(game->onBattleEnter, NoDuping::onBattleEnter);
-    BIND_EVENT_ONE_ARG(game->onFrame, NoDuping::onFrame);
+    BIND_EVENT_TWO_ARG(game->onFrame, NoDuping::onFrame);
+    BIND_EVENT_THREE_ARG(game->onItemsChanged, NoDuping::onItemsChanged);
 }
 
+#if IRONMOG_GUI
 void NoDuping::onDebugGUI()
 {
     // Controller input state
     {
-        uint8_t btn = game->read<uint8_t>(BattleOffsets::ControllerInputs);
+        uint16_t btn = game->getButtons();
 
         std::ostringstream stringStream;
-        stringStream << std::bitset<8>(btn) << std::endl;
+        stringStream << std::bitset<16>(btn) << std::endl;
 
         std::string btnText = "Buttons: " + stringStream.str();
         ImGui::Text(btnText.c_str());
@@ -39,24 +44,36 @@ void NoDuping::onDebugGUI()
         ImGui::Text(entryText.c_str());
     }
 
+    // Field Inventory Changes
+    if (ImGui::CollapsingHeader("Inventory Changes"))
+    {
+        for (const InventoryChange& change : inventoryChanges)
+        {
+            ImGui::Text(" Slot %d: %d x%d -> %d x%d", change.slot,
+                change.oldEntry & 0x1FF, change.oldEntry >> 9, change.newEntry & 0x1FF, change.newEntry >> 9);
+        }
+    }
+
     // Battle Inventory State
     if (ImGui::CollapsingHeader("Battle Inventory"))
     {
-        for (int i = 0; i < 320; ++i)
+        battleInventoryTable.fetch(game, BattleOffsets::Inventory, 320);
+        battleInventoryTable.draw("##BattleInventory", { "Slot", "Item", "Quantity", "Unknown" }, [](int i, const BattleInventoryEntry& entry)
         {
-            uint16_t itemID = game->read<uint16_t>(BattleOffsets::Inventory + (i * 6));
-            uint8_t itemQuantity = game->read<uint8_t>(BattleOffsets::Inventory + (i * 6) + 2);
-            uint8_t unknown0 = game->read<uint8_t>(BattleOffsets::Inventory + (i * 6) + 3);
-            uint8_t unknown1 = game->read<uint8_t>(BattleOffsets::Inventory + (i * 6) + 4);
-            uint8_t unknown2 = game->read<uint8_t>(BattleOffsets::Inventory + (i * 6) + 5);
-
-            std::string entryText = " " + std::to_string(i) + ") " + std::to_string(itemID) + " " + std::to_string(itemQuantity) + " " + std::to_string(unknown0) + " " + std::to_string(unknown1) + " " + std::to_string(unknown2);
-            ImGui::Text(entryText.c_str());
-        }
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", i);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", entry.itemID);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d", entry.quantity);
+            ImGui::TableNextColumn();
+            ImGui::Text("%d %d %d", entry.unknown[0], entry.unknown[1], entry.unknown[2]);
+        });
     }
 }
+#endif
 
-void NoDuping::onStart()
+void NoDuping::onResync()
 {
     if (game->getGameModule() == GameModule::Battle)
     {
@@ -72,6 +89,15 @@ void NoDuping::onBattleEnter()
     wItemCache.clear();
 }
 
+void NoDuping::onItemsChanged(uint16_t slot, uint16_t oldEntry, uint16_t newEntry)
+{
+    inventoryChanges.push_back({ slot, oldEntry, newEntry });
+    if (inventoryChanges.size() > 16)
+    {
+        inventoryChanges.pop_front();
+    }
+}
+
 void NoDuping::checkPartyMembers()
 {
     wItemPartyMembers = { false, false, false };
@@ -120,8 +146,12 @@ void NoDuping::checkPartyMembers()
     }
 }
 
-void NoDuping::onFrame(uint32_t frameNumber)
+void NoDuping::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
 {
+    // Recorded before any early return so the next check only sees edges newer than this frame.
+    uint32_t inputSinceSequence = lastInputSequence;
+    lastInputSequence = game->getInputSequence();
+
     if (game->getGameModule() != GameModule::Battle)
     {
         return;
@@ -165,9 +195,8 @@ void NoDuping::onFrame(uint32_t frameNumber)
         return;
     }
 
-    // Check if the cancel button was pressed. This works even if controller was remapped.
-    uint8_t btn = game->read<uint8_t>(BattleOffsets::ControllerInputs);
-    if ((btn >> 6) & 1) 
+    // Check if the cancel button was pressed since the last frame. This works even if controller was remapped.
+    if (game->wasButtonPressed(1 << 6, inputSinceSequence))
     {
         cancelWasPressed = true;
     }
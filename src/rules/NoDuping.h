@@ -1,5 +1,7 @@
 #pragma once
 #include "Rule.h"
+#include "core/game/MemoryStructs.h"
+#include "core/gui/DebugTable.h"
 #include <cstdint>
 #include <deque>
 
@@ -7,13 +9,16 @@ class NoDuping : public Rule
 {
 public:
     void setup() override;
+#if IRONMOG_GUI
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
-    void onStart();
+    void onResync();
     void onBattleEnter();
-    void onFrame(uint32_t frameNumber);
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
+    void onItemsChanged(uint16_t slot, uint16_t oldEntry, uint16_t newEntry);
 
     void checkPartyMembers();
 
@@ -22,4 +27,16 @@ private:
     bool cancelWasPressed = false;
     uint8_t lastTargetTrigger = 0xFF;
     int lastActivePlayer = -1;
+    uint32_t lastInputSequence = 0;
+
+    // Recent changes to the field inventory, duplicated items show up here once a battle ends.
+    struct InventoryChange
+    {
+        uint16_t slot;
+        uint16_t oldEntry;
+        uint16_t newEntry;
+    };
+    std::deque<InventoryChange> inventoryChanges;
+
+    DebugTable<BattleInventoryEntry> battleInventoryTable;
 };
\ No newline at end of file
@@ -6,7 +6,4 @@ class NoLimitBreaks : public Rule
 {
 public:
     void setup() override;
-
-private:
-    void onFrame(uint32_t frameNumber);
 };
\ No newline at end of file
@@ -7,10 +7,10 @@ REGISTER_RULE(NoSaving, "No Saving", "Saving your game is prohibited.")
 
 void NoSaving::setup()
 {
-    BIND_EVENT_ONE_ARG(game->onFrame, NoSaving::onFrame);
+    BIND_EVENT_TWO_ARG(game->onFrame, NoSaving::onFrame);
 }
 
-void NoSaving::onFrame(uint32_t frameNumber)
+void NoSaving::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
 {
     if (game->getGameModule() != GameModule::Menu && game->getGameModule() != GameModule::World)
     {
@@ -8,5 +8,5 @@ public:
     void setup() override;
 
 private:
-    void onFrame(uint32_t frameNumber);
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
 };
\ No newline at end of file
@@ -49,7 +49,7 @@ void NoSummons::onFieldChanged(uint16_t fieldID)
         return;
     }
 
-    FieldData fieldData = GameData::getField(fieldID);
+    const FieldData& fieldData = GameData::getField(fieldID);
     if (!fieldData.isValid())
     {
         return;
@@ -58,7 +58,7 @@ void NoSummons::onFieldChanged(uint16_t fieldID)
     // Randomize materia
     for (int i = 0; i < fieldData.materia.size(); ++i)
     {
-        FieldScriptItem& materia = fieldData.materia[i];
+        const FieldScriptItem& materia = fieldData.materia[i];
         uintptr_t idOffset = FieldScriptOffsets::ScriptStart + materia.offset + FieldScriptOffsets::MateriaID;
 
         uint8_t oldMateriaID = game->read<uint8_t>(idOffset);
@@ -84,7 +84,7 @@ void NoSummons::onFieldChanged(uint16_t fieldID)
         int msgIndex = game->findPickUpMessage(oldMateriaName, materia.group, materia.script, materia.offset);
         if (msgIndex >= 0)
         {
-            FieldScriptMessage& fieldMsg = fieldData.messages[msgIndex];
+            const FieldScriptMessage& fieldMsg = fieldData.messages[msgIndex];
             game->writeString(FieldScriptOffsets::ScriptStart + fieldMsg.strOffset, fieldMsg.strLength, newMateriaName);
         }
     }
@@ -97,7 +97,7 @@ void NoSummons::onShopOpened()
         return;
     }
 
-    FieldData fieldData = GameData::getField(game->getFieldID());
+    const FieldData& fieldData = GameData::getField(game->getFieldID());
     if (!fieldData.isValid())
     {
         return;
@@ -4,7 +4,9 @@
 #include "core/utilities/Logging.h"
 #include "core/utilities/Utilities.h"
 
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <random>
 
 REGISTER_RULE(Permadeath, "Permadeath", "If a character dies, they cannot be revived and will remain dead for the rest of the playthrough.")
@@ -16,11 +18,24 @@ REGISTER_RULE(Permadeath, "Permadeath", "If a character dies, they cannot be rev
 
 void Permadeath::setup()
 {
-    BIND_EVENT(game->onStart, Permadeath::onStart);
-    BIND_EVENT_ONE_ARG(game->onFrame, Permadeath::onFrame);
+    BIND_EVENT(game->onResync, Permadeath::onResync);
+    BIND_EVENT_TWO_ARG(game->onFrame, Permadeath::onFrame);
     BIND_EVENT_ONE_ARG(game->onFieldChanged, Permadeath::onFieldChanged);
     BIND_EVENT(game->onBattleExit, Permadeath::onBattleExit);
 
+    // Dead characters are held at 0 HP, and dead in battle, while onFrame flags them.
+    for (uint8_t i = 0; i < 9; ++i)
+    {
+        game->addInvariant<uint16_t>(getCharacterDataOffset(i) + CharacterDataOffsets::CurrentHP, 0, [this, i]() { return forceCharacterHP[i]; });
+    }
+
+    for (uint8_t i = 0; i < 3; ++i)
+    {
+        game->addInvariant<uint16_t>(PlayerOffsets::Players[i] + PlayerOffsets::CurrentHP, 0, [this, i]() { return forceBattleHP[i]; });
+        game->addInvariant<uint16_t>(BattleStateOffsets::Allies[i] + BattleStateOffsets::HPDisplay, 0, [this, i]() { return forceBattleHP[i]; });
+        game->addInvariant<uint16_t>(BattleOffsets::Allies[i] + BattleOffsets::Status, StatusFlags::Dead, [this, i]() { return forceBattleStatus[i]; });
+    }
+
     // Kalm Flashback
     {
         PermadeathExemption& kalmExemption = exemptions.emplace_back();
@@ -53,6 +68,7 @@ void Permadeath::setup()
     }
 }
 
+#if IRONMOG_GUI
 void Permadeath::onDebugGUI()
 {
     std::string deadCharText = "Dead Characters: ";
@@ -65,23 +81,30 @@ void Permadeath::onDebugGUI()
     }
     ImGui::Text(deadCharText.c_str());
 
+    // Debug actions touch rule state so they're run on the manager thread.
     if (ImGui::Button("Clear Dead Characters"))
     {
-        deadCharacters = 0;
-        game->write<uint16_t>(SavemapOffsets::IronMogPermadeath, deadCharacters.value());
-
-        std::array<uint8_t, 3> partyIDs = game->getPartyIDs();
-        for (int i = 0; i < 3; ++i)
+        GameManager::GameCommand command;
+        command.type = GameManager::GameCommand::Type::Callback;
+        command.callback = [this]()
         {
-            uint8_t id = partyIDs[i];
-            if (id == 0xFF)
+            deadCharacters = 0;
+            game->write<uint16_t>(SavemapOffsets::IronMogPermadeath, deadCharacters.value());
+
+            std::array<uint8_t, 3> partyIDs = game->getPartyIDs();
+            for (int i = 0; i < 3; ++i)
             {
-                continue;
-            }
+                uint8_t id = partyIDs[i];
+                if (id == 0xFF)
+                {
+                    continue;
+                }
 
-            uintptr_t characterOffset = getCharacterDataOffset(id);
-            game->write<uint16_t>(characterOffset + CharacterDataOffsets::CurrentHP, 1);
-        }
+                uintptr_t characterOffset = getCharacterDataOffset(id);
+                game->write<uint16_t>(characterOffset + CharacterDataOffsets::CurrentHP, 1);
+            }
+        };
+        game->queueCommand(std::move(command));
     }
 
     static char debugKillCharacterIndex[5];
@@ -92,20 +115,46 @@ void Permadeath::onDebugGUI()
         uint16_t charID = atoi(debugKillCharacterIndex);
         if (charID >= 0 && charID <= 9)
         {
-            deadCharacters.setBit(charID, true);
+            GameManager::GameCommand command;
+            command.type = GameManager::GameCommand::Type::Callback;
+            command.callback = [this, charID]() { deadCharacters.setBit(charID, true); };
+            game->queueCommand(std::move(command));
         }
     }
 }
+#endif
 
-void Permadeath::onStart()
+void Permadeath::onResync()
 {
     deadCharacters = game->read<uint16_t>(SavemapOffsets::IronMogPermadeath);
     appliedRufusRandom = false;
     waitingOnBattleExit = false;
+
+    forceCharacterHP.fill(false);
+    forceBattleHP.fill(false);
+    forceBattleStatus.fill(false);
 }
 
-void Permadeath::onFrame(uint32_t frameNumber)
+// Several character IDs share character data, returns the slot the data belongs to.
+static uint8_t getCharacterDataSlot(uint8_t characterID)
 {
+    uintptr_t offset = getCharacterDataOffset(characterID);
+    for (uint8_t i = 0; i < 9; ++i)
+    {
+        if (getCharacterDataOffset(i) == offset)
+        {
+            return i;
+        }
+    }
+    return 0;
+}
+
+void Permadeath::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
+{
+    forceCharacterHP.fill(false);
+    forceBattleHP.fill(false);
+    forceBattleStatus.fill(false);
+
     uint16_t fieldID = game->getFieldID();
     if (isExempt(fieldID))
     {
@@ -155,7 +204,7 @@ void Permadeath::onFrame(uint32_t frameNumber)
         if (deadCharacters.isBitSet(id))
         {
             // Force HP to 0
-            game->write<uint16_t>(characterOffset + CharacterDataOffsets::CurrentHP, 0);
+            forceCharacterHP[getCharacterDataSlot(id)] = true;
 
             if (game->inBattle())
             {
@@ -171,11 +220,10 @@ void Permadeath::onFrame(uint32_t frameNumber)
                 }
                 else
                 {
-                    game->write<uint16_t>(PlayerOffsets::Players[i] + PlayerOffsets::CurrentHP, 0);
-                    game->write<uint16_t>(BattleStateOffsets::Allies[i] + BattleStateOffsets::HPDisplay, 0);
+                    forceBattleHP[i] = true;
                 }
 
-                game->write<uint16_t>(BattleOffsets::Allies[i] + BattleOffsets::Status, StatusFlags::Dead);
+                forceBattleStatus[i] = true;
             }
         }
     }
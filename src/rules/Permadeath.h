@@ -1,5 +1,6 @@
 #pragma once
 #include "Rule.h"
+#include <array>
 #include <cstdint>
 #include <set>
 #include "core/utilities/Flags.h"
@@ -15,8 +16,10 @@ class Permadeath : public Rule
 {
 public:
     void setup() override;
+#if IRONMOG_GUI
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
     bool isCharacterDead(uint8_t characterID)
     {
@@ -24,8 +27,8 @@ public:
     }
 
 private:
-    void onStart();
-    void onFrame(uint32_t frameNumber);
+    void onResync();
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
     void onFieldChanged(uint16_t fieldID);
     void onBattleExit();
 
@@ -38,6 +41,12 @@ private:
     Flags<uint16_t> deadCharacters;
     std::set<uint8_t> justDiedCharacters;
 
+    // Set each frame for the invariants that hold dead characters at 0 HP. Character HP is indexed
+    // by character data slot and the battle values by party slot.
+    std::array<bool, 9> forceCharacterHP{};
+    std::array<bool, 3> forceBattleHP{};
+    std::array<bool, 3> forceBattleStatus{};
+
     bool appliedRufusRandom = false;
     bool appliedDyneRandom = false;
     bool waitingOnBattleExit = false;
@@ -4,7 +4,9 @@
 #include "core/utilities/Logging.h"
 #include "core/utilities/Utilities.h"
 
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <random>
 
 REGISTER_RULE(RandomizeBosses, "Randomize Bosses", "Does not actually randomize which boss you encounter but instead modifies the boss fights themselves.")
@@ -36,6 +38,7 @@ void RandomizeBosses::setup()
     BIND_EVENT(game->onBattleEnter, RandomizeBosses::onBattleEnter);
 }
 
+#if IRONMOG_GUI
 bool RandomizeBosses::onSettingsGUI()
 {
     bool changed = false;
@@ -94,6 +97,7 @@ bool RandomizeBosses::onSettingsGUI()
 
     return changed;
 }
+#endif
 
 void RandomizeBosses::loadSettings(const ConfigFile& cfg)
 {
@@ -145,11 +149,12 @@ std::string buildElementsString(uint64_t elementTypes, uint64_t elementRates, st
     return logString;
 }
 
+#if IRONMOG_GUI
 void RandomizeBosses::onDebugGUI()
 {
-    std::pair<BattleScene*, BattleFormation*> battleData = game->getBattleFormation();
-    BattleScene* scene = battleData.first;
-    BattleFormation* formation = battleData.second;
+    std::pair<const BattleScene*, const BattleFormation*> battleData = game->getBattleFormation();
+    const BattleScene* scene = battleData.first;
+    const BattleFormation* formation = battleData.second;
 
     if (scene == nullptr || formation == nullptr)
     {
@@ -184,6 +189,7 @@ void RandomizeBosses::onDebugGUI()
         ImGui::Unindent(32.0f);
     }
 }
+#endif
 
 void RandomizeBosses::onStart()
 {
@@ -286,9 +292,9 @@ void RandomizeBosses::onBattleEnter()
     uint16_t fieldID = game->getFieldID();
     uint16_t formationID = game->read<uint16_t>(BattleOffsets::FormationID);
 
-    std::pair<BattleScene*, BattleFormation*> battleData = game->getBattleFormation();
-    BattleScene* scene = battleData.first;
-    BattleFormation* formation = battleData.second;
+    std::pair<const BattleScene*, const BattleFormation*> battleData = game->getBattleFormation();
+    const BattleScene* scene = battleData.first;
+    const BattleFormation* formation = battleData.second;
 
     if (scene == nullptr || formation == nullptr)
     {
@@ -312,7 +318,7 @@ void RandomizeBosses::onBattleEnter()
                     game->write<uint64_t>(BattleSceneOffsets::Enemies[i] + BattleSceneOffsets::ElementRates, shuffledBoss.elementRates);
 
                     std::string elementsStr = buildElementsString(shuffledBoss.elementTypes, shuffledBoss.elementRates);
-                    LOG("Shuffled boss %s to %s weakness and resistance: %s", boss->name.c_str(), shuffledBoss.name.c_str(), elementsStr.c_str());
+                    LOG("Shuffled boss %s to %s weakness and resistance: %s", boss->name, shuffledBoss.name, elementsStr.c_str());
                 }
 
                 if (randomMode == RandomMode::WeightedRandom)
@@ -323,7 +329,7 @@ void RandomizeBosses::onBattleEnter()
                     game->write<uint64_t>(BattleSceneOffsets::Enemies[i] + BattleSceneOffsets::ElementRates, randomizedElements.second);
 
                     std::string elementsStr = buildElementsString(randomizedElements.first, randomizedElements.second);
-                    LOG("Randomized weakness and resistance on boss %s to: %s", boss->name.c_str(), elementsStr.c_str());
+                    LOG("Randomized weakness and resistance on boss %s to: %s", boss->name, elementsStr.c_str());
                 }
     
                 inBossFight = true;
@@ -3,6 +3,7 @@
 #include "core/game/GameData.h"
 #include <cstdint>
 #include <random>
+#include <unordered_map>
 
 class RandomizeBosses : public Rule
 {
@@ -11,11 +12,13 @@ public:
 
     void setup() override;
     bool hasSettings() override { return true; }
-    bool onSettingsGUI() override;
     void loadSettings(const ConfigFile& cfg) override;
     void saveSettings(ConfigFile& cfg) override;
+#if IRONMOG_GUI
+    bool onSettingsGUI() override;
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
     enum class RandomMode : int
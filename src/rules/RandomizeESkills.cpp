@@ -3,7 +3,9 @@
 #include "core/game/MemoryOffsets.h"
 #include "core/utilities/Logging.h"
 
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <random>
 #include <set>
 #include <unordered_set>
@@ -23,11 +25,13 @@ REGISTER_RULE(RandomizeESkills, "Randomize E.Skills", "When you learn an Enemy S
 void RandomizeESkills::setup()
 {
     BIND_EVENT(game->onStart, RandomizeESkills::onStart);
+    BIND_EVENT(game->onResync, RandomizeESkills::onResync);
     BIND_EVENT(game->onBattleEnter, RandomizeESkills::onBattleEnter);
     BIND_EVENT(game->onBattleExit, RandomizeESkills::onBattleExit);
-    BIND_EVENT_ONE_ARG(game->onFrame, RandomizeESkills::onFrame);
+    BIND_EVENT_TWO_ARG(game->onFrame, RandomizeESkills::onFrame);
 }
 
+#if IRONMOG_GUI
 void RandomizeESkills::onDebugGUI()
 {
     if (game->getGameModule() != GameModule::Battle)
@@ -56,12 +60,10 @@ void RandomizeESkills::onDebugGUI()
         }
     }
 }
+#endif
 
 void RandomizeESkills::onStart()
 {
-    battleEntered = false;
-    trackedPlayers.clear();
-
     // Generate a shuffled remapping of e.skills based on game seed.
     eSkillMapping.resize(24);
     for (int i = 0; i < 24; ++i) 
@@ -73,6 +75,12 @@ void RandomizeESkills::onStart()
     std::shuffle(eSkillMapping.begin(), eSkillMapping.end(), rng);
 }
 
+void RandomizeESkills::onResync()
+{
+    battleEntered = false;
+    trackedPlayers.clear();
+}
+
 void RandomizeESkills::onBattleEnter()
 {
     trackedPlayers.clear();
@@ -187,7 +195,7 @@ void RandomizeESkills::onBattleExit()
     battleEntered = false;
 }
 
-void RandomizeESkills::onFrame(uint32_t frameNumber)
+void RandomizeESkills::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
 {
     if (game->getGameModule() != GameModule::Battle || !battleEntered)
     {
@@ -7,8 +7,10 @@ class RandomizeESkills : public Rule
 {
 public:
     void setup() override;
+#if IRONMOG_GUI
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
 
@@ -26,9 +28,10 @@ private:
     };
 
     void onStart();
+    void onResync();
     void onBattleEnter();
     void onBattleExit();
-    void onFrame(uint32_t frameNumber);
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
 
     void setESkillBattleMenu(TrackedPlayer& player, int eSkillIndex, bool enabled);
 
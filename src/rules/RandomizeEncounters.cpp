@@ -7,7 +7,9 @@
 
 #include <algorithm>
 #include <cmath>
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <random>
 
 REGISTER_RULE(RandomizeEncounters, "Randomize Encounters", "Field, world map, and/or scripted encounters are randomized to any enemy formation within set specifications.")
@@ -20,13 +22,20 @@ void RandomizeEncounters::setup()
     BIND_EVENT(game->onBattleEnter, RandomizeEncounters::onBattleEnter);
 
     // Chocobo fights
-    excludedFormations.insert({ 56, 57, 60, 61, 78, 79, 80, 81, 98, 99, 104, 105, 152, 153, 156, 157, 162, 163, 166, 167, 202, 203, 206, 207, 214, 215, 218, 219 });
+    for (uint16_t formationID : { 56, 57, 60, 61, 78, 79, 80, 81, 98, 99, 104, 105, 152, 153, 156, 157, 162, 163, 166, 167, 202, 203, 206, 207, 214, 215, 218, 219 })
+    {
+        excludedFormations.set(formationID);
+    }
 
     // Yuffie
-    excludedFormations.insert({ 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 296, 297, 298 });
+    for (uint16_t formationID : { 268, 269, 270, 271, 272, 273, 274, 275, 276, 277, 278, 279, 296, 297, 298 })
+    {
+        excludedFormations.set(formationID);
+    }
 
     // Midgar Zolom
-    excludedFormations.insert({ 469, 470 });
+    excludedFormations.set(469);
+    excludedFormations.set(470);
 
     // Add all boss formations to excluded formations
     {
@@ -36,15 +45,15 @@ void RandomizeEncounters::setup()
             bossIDs.insert(boss.id);
         }
 
-        for (auto& [id, scene] : GameData::battleScenes)
+        for (const BattleScene& scene : GameData::battleScenes)
         {
-            for (BattleFormation& formation : scene.formations)
+            for (const BattleFormation& formation : scene.formations)
             {
                 for (int i = 0; i < 6; ++i)
                 {
                     if (bossIDs.count(formation.enemyIDs[i]) > 0)
                     {
-                        excludedFormations.insert(formation.id);
+                        excludedFormations.set(formation.id);
                         break;
                     }
                 }
@@ -53,6 +62,7 @@ void RandomizeEncounters::setup()
     }
 }
 
+#if IRONMOG_GUI
 bool RandomizeEncounters::onSettingsGUI()
 {
     bool changed = false;
@@ -82,6 +92,7 @@ bool RandomizeEncounters::onSettingsGUI()
 
     return changed;
 }
+#endif
 
 void RandomizeEncounters::loadSettings(const ConfigFile& cfg)
 {
@@ -103,33 +114,37 @@ void RandomizeEncounters::saveSettings(ConfigFile& cfg)
     cfg.set<float>("maxStatMultiplier", maxStatMultiplier);
 }
 
+#if IRONMOG_GUI
 void RandomizeEncounters::onDebugGUI()
 {
     if (game->getGameModule() == GameModule::Field)
     {
-        FieldData fieldData = GameData::getField(game->getFieldID());
+        const FieldData& fieldData = GameData::getField(game->getFieldID());
         if (!fieldData.isValid())
         {
             ImGui::Text("Invalid field.");
             return;
         }
 
+        uintptr_t tablesOffset = FieldScriptOffsets::EncounterStart + fieldData.encounterOffset;
+        const std::vector<uint8_t>& tables = fieldEncounterTable.fetch(game, tablesOffset, FieldScriptOffsets::EncounterTableStride * 2);
+
         for (int t = 0; t < 2; ++t)
         {
-            uintptr_t tableOffset = FieldScriptOffsets::EncounterStart + fieldData.encounterOffset + (t * FieldScriptOffsets::EncounterTableStride);
+            const uint8_t* table = tables.data() + (t * FieldScriptOffsets::EncounterTableStride);
 
-            uint8_t tableEnabled = game->read<uint8_t>(tableOffset);
+            uint8_t tableEnabled = table[0];
             if (tableEnabled == 1)
             {
                 Encounter dbgEncTable[10];
-                game->read(tableOffset + 2, sizeof(uint16_t) * 10, (uint8_t*)dbgEncTable);
+                memcpy(dbgEncTable, table + 2, sizeof(uint16_t) * 10);
 
                 std::string encTableText = "Encounter Table " + std::to_string(t);
                 ImGui::Text(encTableText.c_str());
 
                 for (int i = 0; i < 10; ++i)
                 {
-                    Encounter& origEnc = fieldData.getEncounter(t, i);
+                    Encounter origEnc = fieldData.getEncounter(t, i);
                     Encounter& enc = dbgEncTable[i];
 
                     std::string encText = std::to_string(i) + ") " + std::to_string(origEnc.id) + " to " + std::to_string(enc.id);
@@ -141,28 +156,31 @@ void RandomizeEncounters::onDebugGUI()
 
     if (game->getGameModule() == GameModule::World)
     {
+        // 16 regions of 4 sets, each set is an enabled flag followed by 14 encounters.
+        const std::vector<Encounter>& worldTable = worldEncounterTable.fetch(game, WorldOffsets::EncounterStart, 16 * 64);
+
         for (int r = 0; r < 16; ++r)
         {
-            WorldMapEncounters& origEncounters = GameData::worldMapEncounters[r];
+            const WorldMapEncounters& origEncounters = GameData::worldMapEncounters[r];
 
             std::string regionText = "World Region " + std::to_string(r);
             if (ImGui::CollapsingHeader(regionText.c_str()))
             {
                 for (int s = 0; s < 4; ++s)
                 {
-                    std::vector<Encounter>& origEncSet = origEncounters.sets[s];
+                    const TableView<Encounter>& origEncSet = origEncounters.sets[s];
 
                     std::string setText = "Set " + std::to_string(s);
                     ImGui::Text(setText.c_str());
-                    uintptr_t tableOffset = WorldOffsets::EncounterStart + (r * 128) + (s * 32);
+                    const Encounter* set = worldTable.data() + (r * 64) + (s * 16);
 
-                    uint8_t setEnabled = game->read<uint8_t>(tableOffset);
+                    uint8_t setEnabled = set[0].raw & 0xFF;
                     if (setEnabled == 1)
                     {
                         for (int i = 0; i < 14; ++i)
                         {
-                            Encounter& origEnc = origEncSet[i];
-                            Encounter enc = game->read<Encounter>(tableOffset + 2 + (i * 2));
+                            const Encounter& origEnc = origEncSet[i];
+                            const Encounter& enc = set[1 + i];
 
                             std::string encText = " " + std::to_string(i) + ") " + std::to_string(origEnc.id) + " to " + std::to_string(enc.id);
                             ImGui::Text(encText.c_str());
@@ -173,6 +191,7 @@ void RandomizeEncounters::onDebugGUI()
         }
     }
 }
+#endif
 
 void RandomizeEncounters::onStart()
 {
@@ -183,7 +202,7 @@ void RandomizeEncounters::onStart()
 
 void RandomizeEncounters::onFieldChanged(uint16_t fieldID)
 {
-    FieldData fieldData = GameData::getField(fieldID);
+    const FieldData& fieldData = GameData::getField(fieldID);
     if (!fieldData.isValid())
     {
         return;
@@ -198,13 +217,13 @@ void RandomizeEncounters::onFieldChanged(uint16_t fieldID)
 
             for (int i = 0; i < 10; ++i)
             {
-                Encounter& origEncounter = fieldData.getEncounter(t, i);
+                Encounter origEncounter = fieldData.getEncounter(t, i);
                 if (origEncounter.prob == 0 && origEncounter.id == 0)
                 {
                     continue;
                 }
 
-                std::vector<uint16_t> candidates = randomEncounterMap[origEncounter.id];
+                TableView<uint16_t> candidates = getCandidates(origEncounter.id);
                 if (candidates.size() == 0)
                 {
                     LOG("No random encounter candidates for formation %d", origEncounter.id);
@@ -223,9 +242,9 @@ void RandomizeEncounters::onFieldChanged(uint16_t fieldID)
 
     if (scriptedEncounters)
     {
-        for (FieldScriptBattle& battle : fieldData.battles)
+        for (const FieldScriptBattle& battle : fieldData.battles)
         {
-            std::vector<uint16_t> candidates = randomEncounterMap[battle.formationID];
+            TableView<uint16_t> candidates = getCandidates(battle.formationID);
             if (candidates.size() == 0)
             {
                 LOG("No random encounter candidates for formation %d", battle.formationID);
@@ -250,11 +269,11 @@ void RandomizeEncounters::onWorldMapEnter()
 
     for (int r = 0; r < 16; ++r)
     {
-        WorldMapEncounters& encounters = GameData::worldMapEncounters[r];
+        const WorldMapEncounters& encounters = GameData::worldMapEncounters[r];
 
         for (int s = 0; s < 4; ++s)
         {
-            std::vector<Encounter>& encSet = encounters.sets[s];
+            const TableView<Encounter>& encSet = encounters.sets[s];
             if (encSet.size() == 0)
             {
                 continue;
@@ -265,13 +284,13 @@ void RandomizeEncounters::onWorldMapEnter()
             // There are 14 in a set but the last 4 are chocobos and we don't randomize those fights.
             for (int i = 0; i < 10; ++i)
             {
-                Encounter& encData = encSet[i];
+                const Encounter& encData = encSet[i];
                 if (encData.raw == 0)
                 {
                     continue;
                 }
 
-                std::vector<uint16_t> candidates = randomEncounterMap[encData.id];
+                TableView<uint16_t> candidates = getCandidates(encData.id);
                 if (candidates.size() == 0)
                 {
                     LOG("No random encounter candidates for formation %d", encData.id);
@@ -298,14 +317,15 @@ void RandomizeEncounters::onBattleEnter()
         return;
     }
 
-    std::pair<BattleScene*, BattleFormation*> battleData = game->getBattleFormation();
-    BattleFormation* formation = battleData.second;
+    std::pair<const BattleScene*, const BattleFormation*> battleData = game->getBattleFormation();
+    const BattleFormation* formation = battleData.second;
     if (formation == nullptr)
     {
         return;
     }
 
-    if (randomEncounterMap.count(formation->id) == 0)
+    // Only formations that can be randomized get multipliers
+    if (formation->id >= FormationCount || excludedFormations.test(formation->id))
     {
         return;
     }
@@ -326,80 +346,101 @@ void RandomizeEncounters::onBattleEnter()
     }
 }
 
-void RandomizeEncounters::generateRandomEncounterMap()
+static uint8_t getMaxEnemyLevel(const BattleScene& scene)
 {
-    randomEncounterMap.clear();
-
-    for (const auto& kv : GameData::battleScenes)
+    uint8_t maxLevel = 0;
+    for (int i = 0; i < 3; ++i)
     {
-        BattleScene scene = kv.second;
+        if (scene.enemyLevels[i] == 255)
+        {
+            continue;
+        }
+        maxLevel = std::max(maxLevel, scene.enemyLevels[i]);
+    }
+    return maxLevel;
+}
 
-        // Determine max enemy level in the scene
-        uint8_t maxLevel = 0;
-        for (int i = 0; i < 3; ++i)
+void RandomizeEncounters::generateRandomEncounterMap()
+{
+    struct FormationLevel
+    {
+        uint8_t level;
+        uint16_t id;
+    };
+
+    // Gather every formation that can be used as a candidate, avoiding arena battles and 
+    // excluded formations, and sort them by the max enemy level of their scene.
+    std::vector<FormationLevel> sortedFormations;
+    for (const BattleScene& scene : GameData::battleScenes)
+    {
+        uint8_t maxLevel = getMaxEnemyLevel(scene);
+        for (const BattleFormation& formation : scene.formations)
         {
-            if (scene.enemyLevels[i] == 255)
+            if (formation.isArenaBattle() || formation.id >= FormationCount || excludedFormations.test(formation.id))
             {
                 continue;
             }
-            maxLevel = std::max(maxLevel, scene.enemyLevels[i]);
+
+            sortedFormations.push_back({ maxLevel, formation.id });
         }
+    }
+    std::stable_sort(sortedFormations.begin(), sortedFormations.end(), [](const FormationLevel& a, const FormationLevel& b) { return a.level < b.level; });
 
-        for (int i = 0; i < 4; ++i)
-        {
-            BattleFormation formation = scene.formations[i];
+    candidateOffsets.assign(FormationCount + 1, 0);
+    candidateIDs.clear();
 
-            // Don't randomize excluded formations
-            if (excludedFormations.count(formation.id) > 0)
+    // Scenes and their formations are sorted by ID so rows are written in order, any 
+    // formation IDs skipped over are left with no candidates.
+    uint32_t nextFormationID = 0;
+    for (const BattleScene& scene : GameData::battleScenes)
+    {
+        // Candidates are every formation whose max level is within maxLevelDifference of this scene.
+        int maxLevel = getMaxEnemyLevel(scene);
+        auto first = std::lower_bound(sortedFormations.begin(), sortedFormations.end(), maxLevel - maxLevelDifference, 
+            [](const FormationLevel& formation, int level) { return formation.level < level; });
+        auto last = std::upper_bound(sortedFormations.begin(), sortedFormations.end(), maxLevel + maxLevelDifference, 
+            [](int level, const FormationLevel& formation) { return level < formation.level; });
+
+        for (const BattleFormation& formation : scene.formations)
+        {
+            if (formation.id >= FormationCount)
             {
                 continue;
             }
 
-            std::vector<uint16_t> candidateFormationIDs;
-            for (const auto& candidateKv : GameData::battleScenes)
+            while (nextFormationID <= formation.id)
             {
-                BattleScene candidateScene = candidateKv.second;
-
-                // Determine max enemy level in the candidate scene
-                uint8_t candidateMaxLevel = 0;
-                for (int j = 0; j < 3; ++j)
-                {
-                    if (candidateScene.enemyLevels[j] == 255)
-                    {
-                        continue;
-                    }
-                    candidateMaxLevel = std::max(candidateMaxLevel, candidateScene.enemyLevels[j]);
-                }
-
-                // Skip the entire scene if max level exceeds max difference
-                if (std::abs(maxLevel - candidateMaxLevel) > maxLevelDifference)
-                {
-                    continue;
-                }
-
-                // Check each formation in this scene, avoiding no escapes.
-                for (int j = 0; j < 4; ++j)
-                {
-                    BattleFormation candidateFormation = candidateScene.formations[j];
-
-                    if (candidateFormation.isArenaBattle())
-                    {
-                        continue;
-                    }
-
-                    // Skip excluded formations
-                    if (excludedFormations.count(candidateFormation.id) > 0)
-                    {
-                        continue;
-                    }
+                candidateOffsets[nextFormationID++] = (uint32_t)candidateIDs.size();
+            }
 
-                    candidateFormationIDs.push_back(candidateFormation.id);
-                }
+            // Don't randomize excluded formations
+            if (excludedFormations.test(formation.id))
+            {
+                continue;
             }
 
-            randomEncounterMap[formation.id] = candidateFormationIDs;
+            for (auto it = first; it < last; ++it)
+            {
+                candidateIDs.push_back(it->id);
+            }
         }
     }
+
+    while (nextFormationID <= FormationCount)
+    {
+        candidateOffsets[nextFormationID++] = (uint32_t)candidateIDs.size();
+    }
+}
+
+TableView<uint16_t> RandomizeEncounters::getCandidates(uint16_t formationID) const
+{
+    if (formationID >= FormationCount || candidateOffsets.empty())
+    {
+        return {};
+    }
+
+    uint32_t start = candidateOffsets[formationID];
+    return { candidateIDs.data() + start, candidateOffsets[formationID + 1] - start };
 }
 
 void RandomizeEncounters::generateEnemyStatMultipliers()
@@ -408,9 +449,9 @@ void RandomizeEncounters::generateEnemyStatMultipliers()
 
     // Get list of all enemies
     std::set<uint16_t> enemyIDs;
-    for (auto& [id, scene] : GameData::battleScenes)
+    for (const BattleScene& scene : GameData::battleScenes)
     {
-        for (BattleFormation& formation : scene.formations)
+        for (const BattleFormation& formation : scene.formations)
         {
             for (uint16_t enemyID : formation.enemyIDs)
             {
@@ -1,19 +1,25 @@
 #pragma once
 #include "Rule.h"
 #include "core/game/GameData.h"
+#include "core/gui/DebugTable.h"
+#include <bitset>
 #include <cstdint>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 class RandomizeEncounters : public Rule
 {
 public:
     void setup() override;
     bool hasSettings() override { return true; }
-    bool onSettingsGUI() override;
     void loadSettings(const ConfigFile& cfg) override;
     void saveSettings(ConfigFile& cfg) override;
+#if IRONMOG_GUI
+    bool onSettingsGUI() override;
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
     void onStart();
@@ -24,6 +30,9 @@ private:
     void generateRandomEncounterMap();
     void generateEnemyStatMultipliers();
 
+    // Returns the formations a formation can be randomized to, empty if it can't be randomized.
+    TableView<uint16_t> getCandidates(uint16_t formationID) const;
+
     bool randomEncounters = true;
     bool scriptedEncounters = true;
     bool worldMapEncounters = true;
@@ -31,8 +40,18 @@ private:
     float minStatMultiplier = 1.0f;
     float maxStatMultiplier = 1.0f;
 
-    std::set<uint16_t> excludedFormations;
-    std::unordered_map<uint16_t, std::vector<uint16_t>> randomEncounterMap;
+    // Formation IDs are 10 bits in encounter tables.
+    static constexpr int FormationCount = 1024;
+    std::bitset<FormationCount> excludedFormations;
+
+    // Candidates stored in compressed sparse row form, the candidates for formation f are
+    // candidateIDs[candidateOffsets[f]] up to candidateIDs[candidateOffsets[f + 1]].
+    std::vector<uint32_t> candidateOffsets;
+    std::vector<uint16_t> candidateIDs;
     std::unordered_map<uint16_t, StatMultiplierSet> enemyStatMultipliers;
     std::mt19937 rng;
+
+    // Both field tables are fetched together, the world map table is fetched whole.
+    DebugTable<uint8_t> fieldEncounterTable;
+    DebugTable<Encounter> worldEncounterTable;
 };
\ No newline at end of file
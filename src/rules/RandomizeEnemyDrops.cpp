@@ -1,10 +1,13 @@
 #include "RandomizeEnemyDrops.h"
 #include "core/game/GameData.h"
 #include "core/game/MemoryOffsets.h"
+#include "core/game/MemoryStructs.h"
 #include "core/utilities/Logging.h"
 #include "core/utilities/Utilities.h"
 
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <random>
 #include <set>
 
@@ -12,10 +15,11 @@ REGISTER_RULE(RandomizeEnemyDrops, "Randomize Enemy Drops", "Enemy drops and ste
 
 void RandomizeEnemyDrops::setup()
 {
-    BIND_EVENT(game->onStart, RandomizeEnemyDrops::onStart);
+    BIND_EVENT(game->onResync, RandomizeEnemyDrops::onResync);
     BIND_EVENT(game->onBattleEnter, RandomizeEnemyDrops::onBattleEnter);
 }
 
+#if IRONMOG_GUI
 bool RandomizeEnemyDrops::onSettingsGUI()
 {
     bool changed = false;
@@ -46,6 +50,7 @@ bool RandomizeEnemyDrops::onSettingsGUI()
 
     return changed;
 }
+#endif
 
 void RandomizeEnemyDrops::loadSettings(const ConfigFile& cfg)
 {
@@ -63,11 +68,12 @@ void RandomizeEnemyDrops::saveSettings(ConfigFile& cfg)
     cfg.set<float>("maxExpMultiplier", maxExpMultiplier);
 }
 
+#if IRONMOG_GUI
 void RandomizeEnemyDrops::onDebugGUI()
 {
-    std::pair<BattleScene*, BattleFormation*> battleData = game->getBattleFormation();
-    BattleScene* scene = battleData.first;
-    BattleFormation* formation = battleData.second;
+    std::pair<const BattleScene*, const BattleFormation*> battleData = game->getBattleFormation();
+    const BattleScene* scene = battleData.first;
+    const BattleFormation* formation = battleData.second;
 
     if (scene == nullptr || formation == nullptr)
     {
@@ -100,9 +106,11 @@ void RandomizeEnemyDrops::onDebugGUI()
         }
     }
 }
+#endif
 
-void RandomizeEnemyDrops::onStart()
+void RandomizeEnemyDrops::onResync()
 {
+    // Reseeded on every load so reloading doesn't reroll drops.
     rng.seed(game->getSeed());
 }
 
@@ -111,9 +119,9 @@ void RandomizeEnemyDrops::onBattleEnter()
     uint16_t fieldID = game->getFieldID();
     uint16_t formationID = game->read<uint16_t>(BattleOffsets::FormationID);
 
-    std::pair<BattleScene*, BattleFormation*> battleData = game->getBattleFormation();
-    BattleScene* scene = battleData.first;
-    BattleFormation* formation = battleData.second;
+    std::pair<const BattleScene*, const BattleFormation*> battleData = game->getBattleFormation();
+    const BattleScene* scene = battleData.first;
+    const BattleFormation* formation = battleData.second;
 
     std::set<int> activeEnemyIDs;
     for (int i = 0; i < 6; ++i)
@@ -138,31 +146,33 @@ void RandomizeEnemyDrops::onBattleEnter()
         float expMultiplier = expDist(rng);
 
         // Gil and EXP Multipliers
-        uint32_t gil = game->read<uint32_t>(BattleOffsets::Enemies[i] + BattleOffsets::Gil);
-        uint32_t exp = game->read<uint32_t>(BattleOffsets::Enemies[i] + BattleOffsets::Exp);
-        uint32_t newGil = Utilities::clampTo<uint32_t>(gil * gilMultiplier);
-        uint32_t newExp = Utilities::clampTo<uint32_t>(exp * expMultiplier);
-        game->write<uint32_t>(BattleOffsets::Enemies[i] + BattleOffsets::Gil, newGil);
-        game->write<uint32_t>(BattleOffsets::Enemies[i] + BattleOffsets::Exp, newExp);
+        RecordView<BattleCharacter> enemy = game->view<BattleCharacter>(BattleOffsets::Enemies[i]);
+        enemy->gil = Utilities::clampTo<uint32_t>(enemy->gil * gilMultiplier);
+        enemy->exp = Utilities::clampTo<uint32_t>(enemy->exp * expMultiplier);
+        game->commit(enemy);
     }
 
     for (int id : activeEnemyIDs)
     {
+        RecordView<BattleSceneEnemy> sceneEnemy = game->view<BattleSceneEnemy>(BattleSceneOffsets::Enemies[id]);
+
         // Maximum of 4 item slots per enemy
         for (int i = 0; i < 4; ++i)
         {
-            uint16_t dropID = game->read<uint16_t>(BattleSceneOffsets::Enemies[id] + BattleSceneOffsets::DropIDs[i]);
+            uint16_t dropID = sceneEnemy->dropIDs[i];
             if (dropID == UINT16_MAX)
             {
                 continue;
             }
 
             uint16_t newDropID = GameData::getRandomItemFromID(dropID, rng, true);
-            game->write<uint16_t>(BattleSceneOffsets::Enemies[id] + BattleSceneOffsets::DropIDs[i], newDropID);
+            sceneEnemy->dropIDs[i] = newDropID;
 
             std::string oldItemName = GameData::getItemName(dropID);
             std::string newItemName = GameData::getItemName(newDropID);
             LOG("Randomized enemy drop in formation %d: %s changed to %s", formationID, oldItemName.c_str(), newItemName.c_str());
         }
+
+        game->commit(sceneEnemy);
     }
 }
\ No newline at end of file
@@ -8,14 +8,16 @@ class RandomizeEnemyDrops : public Rule
 public:
     void setup() override;
     bool hasSettings() override { return true; }
-    bool onSettingsGUI() override;
     void loadSettings(const ConfigFile& cfg) override;
     void saveSettings(ConfigFile& cfg) override;
+#if IRONMOG_GUI
+    bool onSettingsGUI() override;
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
-    void onStart();
+    void onResync();
     void onBattleEnter();
 
     std::mt19937_64 rng;
@@ -6,7 +6,10 @@
 #include "rules/Restrictions.h"
 
 #include <algorithm>
+#include <cstring>
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <random>
 
 REGISTER_RULE(RandomizeFieldItems, "Randomize Field Items", "Any items obtained from the field (such as from boxes or chests) are randomized.")
@@ -14,10 +17,10 @@ REGISTER_RULE(RandomizeFieldItems, "Randomize Field Items", "Any items obtained
 void RandomizeFieldItems::setup()
 {
     BIND_EVENT(game->onStart, RandomizeFieldItems::onStart);
-    BIND_EVENT_ONE_ARG(game->onFrame, RandomizeFieldItems::onFrame);
     BIND_EVENT_ONE_ARG(game->onFieldChanged, RandomizeFieldItems::onFieldChanged);
 }
 
+#if IRONMOG_GUI
 bool RandomizeFieldItems::onSettingsGUI()
 {
     bool changed = false;
@@ -30,6 +33,7 @@ bool RandomizeFieldItems::onSettingsGUI()
 
     return changed;
 }
+#endif
 
 void RandomizeFieldItems::loadSettings(const ConfigFile& cfg)
 {
@@ -41,6 +45,7 @@ void RandomizeFieldItems::saveSettings(ConfigFile& cfg)
     cfg.set<int>("randomMode", (int)randomMode);
 }
 
+#if IRONMOG_GUI
 void RandomizeFieldItems::onDebugGUI()
 {
     if (game->getGameModule() != GameModule::Field)
@@ -51,7 +56,7 @@ void RandomizeFieldItems::onDebugGUI()
     
     // Display field items and their values
     {
-        FieldData fieldData = GameData::getField(game->getFieldID());
+        const FieldData& fieldData = GameData::getField(game->getFieldID());
         if (!fieldData.isValid())
         {
             ImGui::Text("Invalid field.");
@@ -60,7 +65,7 @@ void RandomizeFieldItems::onDebugGUI()
 
         for (int i = 0; i < fieldData.items.size(); ++i)
         {
-            FieldScriptItem& item = fieldData.items[i];
+            const FieldScriptItem& item = fieldData.items[i];
             uintptr_t itemIDOffset = FieldScriptOffsets::ScriptStart + item.offset + FieldScriptOffsets::ItemID;
             uintptr_t itemQuantityOffset = FieldScriptOffsets::ScriptStart + item.offset + FieldScriptOffsets::ItemQuantity;
 
@@ -74,7 +79,7 @@ void RandomizeFieldItems::onDebugGUI()
 
         for (int i = 0; i < fieldData.materia.size(); ++i)
         {
-            FieldScriptItem& materia = fieldData.materia[i];
+            const FieldScriptItem& materia = fieldData.materia[i];
             uintptr_t idOffset = FieldScriptOffsets::ScriptStart + materia.offset + FieldScriptOffsets::MateriaID;
 
             uint8_t oldMateriaID = game->read<uint8_t>(idOffset);
@@ -84,6 +89,7 @@ void RandomizeFieldItems::onDebugGUI()
         }
     }
 }
+#endif
 
 void RandomizeFieldItems::onStart()
 {
@@ -95,21 +101,6 @@ uint32_t makeKey(uint16_t fieldID, uint8_t index)
     return (uint32_t(fieldID) << 16 | index);
 }
 
-void RandomizeFieldItems::onFrame(uint32_t frameNumber)
-{
-    for (int i = 0; i < overwriteMessages.size(); ++i)
-    {
-        const MessageOverwrite& overwriteMsg = overwriteMessages[i];
-        
-        // Check if the current dialog is overwrite message
-        uint16_t fieldScriptPtr = game->getScriptExecutionPointer(overwriteMsg.fieldMsg.group);
-        if (fieldScriptPtr == overwriteMsg.fieldMsg.offset)
-        {
-            game->writeString(getWindowTextOffset(overwriteMsg.fieldMsg.window), overwriteMsg.fieldMsg.strLength, overwriteMsg.text);
-        }
-    }
-}
-
 void RandomizeFieldItems::onFieldChanged(uint16_t fieldID)
 {
     apply();
@@ -123,14 +114,6 @@ void RandomizeFieldItems::generateRandomizedItems()
     randomizedItems.clear();
     randomizedMateria.clear();
 
-    // Sort the field IDs to get a deterministic order
-    std::vector<uint32_t> sortedFieldIDs;
-    for (const auto& kv : GameData::fieldData)
-    {
-        sortedFieldIDs.push_back(kv.first);
-    }
-    std::sort(sortedFieldIDs.begin(), sortedFieldIDs.end());
-
     struct SourceLoc
     {
         uint32_t fieldID;
@@ -140,13 +123,14 @@ void RandomizeFieldItems::generateRandomizedItems()
     std::vector<std::pair<FieldScriptItem, SourceLoc>> allItems;
     std::vector<std::pair<FieldScriptItem, SourceLoc>> allMateria;
 
-    for (uint32_t fieldID : sortedFieldIDs) 
+    // Fields are stored sorted by ID so this order is deterministic
+    for (const FieldData& field : GameData::fields) 
     {
-        FieldData& field = GameData::fieldData[fieldID];
+        uint32_t fieldID = field.id;
 
         // Skip any fields with names that start with "black" as those are debug rooms and 
         // loaded with all kinds of items we don't want put into rotation.
-        if (field.name.find("black") == 0)
+        if (strncmp(field.name, "black", 5) == 0)
         {
             continue;
         }
@@ -185,19 +169,23 @@ void RandomizeFieldItems::generateRandomizedItems()
 
 void RandomizeFieldItems::apply()
 {
-    FieldData fieldData = GameData::getField(game->getFieldID());
+    const FieldData& fieldData = GameData::getField(game->getFieldID());
     if (!fieldData.isValid())
     {
         return;
     }
 
-    overwriteMessages.clear();
     messagesToClear.clear();
 
+    // Each item's message is looked up once, when the first pickup is randomized, and reused to count
+    // which strings are shared rather than searching again for every item.
+    std::vector<int> itemMessages;
+    bool itemMessagesFound = false;
+
     // Randomize items
     for (int i = 0; i < fieldData.items.size(); ++i)
     {
-        FieldScriptItem& oldItem = fieldData.items[i];
+        const FieldScriptItem& oldItem = fieldData.items[i];
         uintptr_t itemIDOffset = FieldScriptOffsets::ScriptStart + oldItem.offset + FieldScriptOffsets::ItemID;
         uintptr_t itemQuantityOffset = FieldScriptOffsets::ScriptStart + oldItem.offset + FieldScriptOffsets::ItemQuantity;
 
@@ -249,14 +237,20 @@ void RandomizeFieldItems::apply()
         std::string newItemName = GameData::getItemName(newItem.id);
         LOG("Randomized item on field %d: %s (%d) changed to: %s (%d)", fieldData.id, oldItemName.c_str(), oldItem.quantity, newItemName.c_str(), newItem.quantity);
 
+        if (!itemMessagesFound)
+        {
+            itemMessages = findItemMessages(fieldData);
+            itemMessagesFound = true;
+        }
+
         // Overwrite the popup message
-        overwriteMessage(fieldData, oldItem, newItem, oldItemName, newItemName);
+        overwriteMessage(fieldData, itemMessages[i], itemMessages, oldItemName, newItemName);
     }
 
     // Randomize materia
     for (int i = 0; i < fieldData.materia.size(); ++i)
     {
-        FieldScriptItem& oldMateria = fieldData.materia[i];
+        const FieldScriptItem& oldMateria = fieldData.materia[i];
         uintptr_t idOffset = FieldScriptOffsets::ScriptStart + oldMateria.offset + FieldScriptOffsets::MateriaID;
 
         // Checks whats currently in the materia spot
@@ -304,8 +298,15 @@ void RandomizeFieldItems::apply()
         std::string newMateriaName = GameData::getMateriaName((uint8_t)newMateria.id);
         LOG("Randomized materia on field %d: %s changed to: %s", fieldData.id, oldMateriaName.c_str(), newMateriaName.c_str());
 
+        if (!itemMessagesFound)
+        {
+            itemMessages = findItemMessages(fieldData);
+            itemMessagesFound = true;
+        }
+
         // Overwrite the popup message
-        overwriteMessage(fieldData, oldMateria, newMateria, oldMateriaName, newMateriaName);
+        int msgIndex = game->findPickUpMessage(oldMateriaName, oldMateria.group, oldMateria.script, oldMateria.offset);
+        overwriteMessage(fieldData, msgIndex, itemMessages, oldMateriaName, newMateriaName);
     }
 
     // Clear original messages that will be overwritten in real time
@@ -315,27 +316,18 @@ void RandomizeFieldItems::apply()
     }
 }
 
-void RandomizeFieldItems::overwriteMessage(const FieldData& fieldData, const FieldScriptItem& oldItem, const FieldScriptItem& newItem, const std::string& oldName, const std::string& newName)
+void RandomizeFieldItems::overwriteMessage(const FieldData& fieldData, int msgIndex, const std::vector<int>& itemMessages, const std::string& oldName, const std::string& newName)
 {
-    // Overwrite the popup message
-    int msgIndex = game->findPickUpMessage(oldName, oldItem.group, oldItem.script, oldItem.offset);
     if (msgIndex >= 0)
     {
         const FieldScriptMessage& fieldMsg = fieldData.messages[msgIndex];
 
         int strMsgCount = 0;
-        for (const FieldScriptItem& compareItem : fieldData.items)
+        for (int compareMsgIndex : itemMessages)
         {
-            std::string compareItemName = GameData::getItemName(compareItem.id);
-            int compareMsgIndex = game->findPickUpMessage(compareItemName, compareItem.group, compareItem.script, compareItem.offset);
-            if (compareMsgIndex >= 0)
+            if (compareMsgIndex >= 0 && fieldData.messages[compareMsgIndex].strOffset == fieldMsg.strOffset)
             {
-                const FieldScriptMessage& compareFieldMsg = fieldData.messages[compareMsgIndex];
-
-                if (fieldMsg.strOffset == compareFieldMsg.strOffset)
-                {
-                    strMsgCount++;
-                }
+                strMsgCount++;
             }
         }
 
@@ -344,7 +336,7 @@ void RandomizeFieldItems::overwriteMessage(const FieldData& fieldData, const Fie
         // every item separately and the fact the game reuses the same string for duplicates.
         if (strMsgCount > 1)
         {
-            overwriteMessages.push_back({ fieldMsg, newName });
+            game->addScriptTextTrigger(fieldMsg.group, (uint16_t)fieldMsg.offset, getWindowTextOffset(fieldMsg.window), fieldMsg.strLength, newName);
             messagesToClear.push_back(fieldMsg);
         }
         else
@@ -356,4 +348,18 @@ void RandomizeFieldItems::overwriteMessage(const FieldData& fieldData, const Fie
     {
         LOG("Error: Unable to find message that contains: %s", oldName.c_str());
     }
+}
+
+// Searches the script text in RAM for the pickup message of every item in the field, before any of
+// them have been overwritten.
+std::vector<int> RandomizeFieldItems::findItemMessages(const FieldData& fieldData)
+{
+    std::vector<int> itemMessages;
+    itemMessages.reserve(fieldData.items.size());
+    for (const FieldScriptItem& item : fieldData.items)
+    {
+        itemMessages.push_back(game->findPickUpMessage(GameData::getItemName(item.id), item.group, item.script, item.offset));
+    }
+
+    return itemMessages;
 }
\ No newline at end of file
@@ -2,17 +2,21 @@
 #include "Rule.h"
 #include "core/game/GameData.h"
 #include <cstdint>
+#include <unordered_map>
+#include <vector>
 
 class RandomizeFieldItems : public Rule
 {
 public:
     void setup() override;
     bool hasSettings() override { return true; }
-    bool onSettingsGUI() override;
     void loadSettings(const ConfigFile& cfg) override;
     void saveSettings(ConfigFile& cfg) override;
+#if IRONMOG_GUI
+    bool onSettingsGUI() override;
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
     enum class RandomMode : int
@@ -21,14 +25,7 @@ private:
         Random = 1
     };
 
-    struct MessageOverwrite
-    {
-        FieldScriptMessage fieldMsg;
-        std::string text;
-    };
-
     void onStart();
-    void onFrame(uint32_t frameNumber);
     void onFieldChanged(uint16_t fieldID);
 
     // Shuffles items and materia between maps based on the game seed.
@@ -36,7 +33,8 @@ private:
 
     // Applies randomization to current field.
     void apply();
-    void overwriteMessage(const FieldData& fieldData, const FieldScriptItem& oldItem, const FieldScriptItem& newItem, const std::string& oldName, const std::string& newName);
+    void overwriteMessage(const FieldData& fieldData, int msgIndex, const std::vector<int>& itemMessages, const std::string& oldName, const std::string& newName);
+    std::vector<int> findItemMessages(const FieldData& fieldData);
 
     RandomMode randomMode;
 
@@ -44,8 +42,7 @@ private:
     std::unordered_map<uint32_t, FieldScriptItem> randomizedItems;
     std::unordered_map<uint32_t, FieldScriptItem> randomizedMateria;
 
-    // List of messages that should be overwritten in real time rather than on field change.
-    // This is for items that share the same message in memory and thus would conflict.
-    std::vector<MessageOverwrite> overwriteMessages;
+    // Messages that are overwritten in real time through script triggers rather than on field change
+    // have their original text cleared. This is for items that share the same message in memory.
     std::vector<FieldScriptMessage> messagesToClear;
 };
\ No newline at end of file
@@ -1,12 +1,14 @@
 #include "RandomizeShops.h"
-#include "core/gui/GUI.h"
 #include "core/game/GameData.h"
 #include "core/game/MemoryOffsets.h"
 #include "core/utilities/Logging.h"
 #include "core/utilities/Utilities.h"
 #include "rules/Restrictions.h"
 
+#if IRONMOG_GUI
+#include "core/gui/GUI.h"
 #include <imgui.h>
+#endif
 
 REGISTER_RULE(RandomizeShops, "Randomize Shops", "Shop inventories are randomized.")
 
@@ -15,9 +17,10 @@ void RandomizeShops::setup()
     BIND_EVENT(game->onStart, RandomizeShops::onStart);
     BIND_EVENT_ONE_ARG(game->onFieldChanged, RandomizeShops::onFieldChanged);
     BIND_EVENT(game->onShopOpened, RandomizeShops::onShopOpened);
-    BIND_EVENT_ONE_ARG(game->onFrame, RandomizeShops::onFrame);
+    BIND_EVENT_TWO_ARG(game->onFrame, RandomizeShops::onFrame);
 }
 
+#if IRONMOG_GUI
 bool RandomizeShops::onSettingsGUI()
 {
     bool changed = false;
@@ -37,6 +40,7 @@ bool RandomizeShops::onSettingsGUI()
 
     return changed;
 }
+#endif
 
 void RandomizeShops::loadSettings(const ConfigFile& cfg)
 {
@@ -52,14 +56,25 @@ void RandomizeShops::saveSettings(ConfigFile& cfg)
     cfg.set<bool>("excludeRareItems", excludeRareItems);
 }
 
+#if IRONMOG_GUI
 void RandomizeShops::onDebugGUI()
 {
-    FieldData fieldData = GameData::getField(lastFieldID);
+    const FieldData& fieldData = GameData::getField(lastFieldID);
     if (!fieldData.isValid())
     {
         return;
     }
 
+    uint8_t maxShopID = 0;
+    for (const auto& shop : fieldData.shops)
+    {
+        maxShopID = std::max(maxShopID, shop.shopID);
+    }
+
+    const std::vector<uint8_t>& shops = shopTable.fetch(game, ShopOffsets::ShopStart, ShopOffsets::ShopStride * (maxShopID + 1));
+    const std::vector<uint32_t>& itemPrices = itemPriceTable.fetch(game, ShopOffsets::PricesStart, itemSellPrices.size());
+    const std::vector<uint32_t>& materiaPrices = materiaPriceTable.fetch(game, ShopOffsets::MateriaPricesStart, materiaSellPrices.size());
+
     std::set<uint8_t> displayedShopIDs;
     for (int i = 0; i < fieldData.shops.size(); ++i)
     {
@@ -69,8 +84,8 @@ void RandomizeShops::onDebugGUI()
             continue;
         }
 
-        uintptr_t shopOffset = ShopOffsets::ShopStart + (ShopOffsets::ShopStride * shopID);
-        uint8_t invCount = game->read<uint8_t>(shopOffset + 2);
+        const uint8_t* shop = shops.data() + (ShopOffsets::ShopStride * shopID);
+        uint8_t invCount = shop[2];
 
         if (invCount > SHOP_ITEM_MAX)
         {
@@ -82,14 +97,16 @@ void RandomizeShops::onDebugGUI()
 
         for (int j = 0; j < invCount; ++j)
         {
-            uintptr_t itemOffset = shopOffset + 4 + (j * 8);
-            uint32_t itemType = game->read<uint32_t>(itemOffset + 0);
-            uint16_t itemID = game->read<uint16_t>(itemOffset + 4);
+            const uint8_t* item = shop + 4 + (j * 8);
+            uint32_t itemType = 0;
+            uint16_t itemID = 0;
+            memcpy(&itemType, item + 0, sizeof(itemType));
+            memcpy(&itemID, item + 4, sizeof(itemID));
 
             // Materia
             if (itemType == 1)
             {
-                uint32_t price = game->read<uint32_t>(ShopOffsets::MateriaPricesStart + (itemID * 4));
+                uint32_t price = itemID < materiaPrices.size() ? materiaPrices[itemID] : 0;
                 std::string materiaName = GameData::getMateriaName((uint8_t)itemID);
 
                 std::string debugText = "Materia: " + materiaName + " (" + std::to_string(price) + ")";
@@ -98,7 +115,7 @@ void RandomizeShops::onDebugGUI()
             // Item
             else
             {
-                uint32_t price = game->read<uint32_t>(ShopOffsets::PricesStart + (itemID * 4));
+                uint32_t price = itemID < itemPrices.size() ? itemPrices[itemID] : 0;
                 std::string itemName = GameData::getItemName(itemID);
 
                 std::string debugText = "Materia: " + itemName + " (" + std::to_string(price) + ")";
@@ -109,6 +126,7 @@ void RandomizeShops::onDebugGUI()
         displayedShopIDs.insert(shopID);
     }
 }
+#endif
 
 void RandomizeShops::onStart()
 {
@@ -138,7 +156,7 @@ void RandomizeShops::generateRandomizedShops()
     // assigned to the highest value original item. When Keep Prices is enabled this
     // adds a minor degree of balance.
 
-    for (const auto& [fieldID, fieldData] : GameData::fieldData)
+    for (const FieldData& fieldData : GameData::fields)
     {
         for (int i = 0; i < fieldData.shops.size(); ++i)
         {
@@ -148,7 +166,7 @@ void RandomizeShops::generateRandomizedShops()
                 continue;
             }
 
-            rng.seed(Utilities::makeSeed64(game->getSeed(), fieldID, shopID));
+            rng.seed(Utilities::makeSeed64(game->getSeed(), fieldData.id, shopID));
 
             const Shop& shop = GameData::shops[shopID];
             RandomizedShop& randomizedShop = randomizedShops[shopID];
@@ -249,7 +267,7 @@ void RandomizeShops::generateRandomizedShops()
 
 void RandomizeShops::onFieldChanged(uint16_t fieldID)
 {
-    FieldData fieldData = GameData::getField(fieldID);
+    const FieldData& fieldData = GameData::getField(fieldID);
     if (!fieldData.isValid())
     {
         return;
@@ -272,7 +290,7 @@ void RandomizeShops::onFieldChanged(uint16_t fieldID)
 
 void RandomizeShops::onShopOpened()
 {
-    FieldData fieldData = GameData::getField(lastFieldID);
+    const FieldData& fieldData = GameData::getField(lastFieldID);
     if (!fieldData.isValid())
     {
         return;
@@ -300,7 +318,7 @@ void RandomizeShops::onShopOpened()
     shopOpen = true;
 }
 
-void RandomizeShops::onFrame(uint32_t frameNumber)
+void RandomizeShops::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
 {
     if (game->getGameModule() != GameModule::Menu)
     {
@@ -1,8 +1,10 @@
 #pragma once
 #include "Rule.h"
+#include "core/gui/DebugTable.h"
 #include <cstdint>
 #include <random>
 #include <set>
+#include <unordered_map>
 
 struct RandomizedShopItem
 {
@@ -24,18 +26,20 @@ class RandomizeShops : public Rule
 public:
     void setup() override;
     bool hasSettings() override { return true; }
-    bool onSettingsGUI() override;
     void loadSettings(const ConfigFile& cfg) override;
     void saveSettings(ConfigFile& cfg) override;
+#if IRONMOG_GUI
+    bool onSettingsGUI() override;
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
     void onStart();
     void generateRandomizedShops();
     void onFieldChanged(uint16_t fieldID);
     void onShopOpened();
-    void onFrame(uint32_t frameNumber);
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
 
     uint16_t randomizeShopItem(uint16_t itemID, const std::set<uint16_t>& previouslyChosen);
     uint16_t randomizeShopMateria(uint16_t materiaID, const std::set<uint16_t>& previouslyChosen);
@@ -54,4 +58,9 @@ private:
     // Used exclusively for overwriting sell prices, decoupled from buy prices.
     std::array<uint32_t, 320> itemSellPrices;
     std::array<uint32_t, 91> materiaSellPrices;
+
+    // Shop data up to the highest shop in the field, along with the price tables.
+    DebugTable<uint8_t> shopTable;
+    DebugTable<uint32_t> itemPriceTable;
+    DebugTable<uint32_t> materiaPriceTable;
 };
\ No newline at end of file
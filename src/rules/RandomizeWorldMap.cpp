@@ -5,7 +5,11 @@
 #include "core/utilities/Logging.h"
 #include "core/utilities/Utilities.h"
 
+#include <algorithm>
+#include <array>
+#if IRONMOG_GUI
 #include <imgui.h>
+#endif
 #include <random>
 
 REGISTER_RULE(RandomizeWorldMap, "Randomize World Map", "World map entrances are shuffled so entering Kalm might take you to Midgar.")
@@ -13,11 +17,15 @@ REGISTER_RULE(RandomizeWorldMap, "Randomize World Map", "World map entrances are
 void RandomizeWorldMap::setup()
 {
     BIND_EVENT(game->onStart, RandomizeWorldMap::onStart);
-    BIND_EVENT_ONE_ARG(game->onFrame, RandomizeWorldMap::onFrame);
+    BIND_EVENT(game->onResync, RandomizeWorldMap::onResync);
+    BIND_EVENT_TWO_ARG(game->onFrame, RandomizeWorldMap::onFrame);
     BIND_EVENT(game->onWorldMapEnter, RandomizeWorldMap::onWorldMapEnter);
     BIND_EVENT_ONE_ARG(game->onFieldChanged, RandomizeWorldMap::onFieldChanged);
+
+    buildEntranceGrid();
 }
 
+#if IRONMOG_GUI
 void RandomizeWorldMap::onDebugGUI()
 {
     if (game->getGameModule() != GameModule::World)
@@ -32,33 +40,23 @@ void RandomizeWorldMap::onDebugGUI()
         int worldZ = game->read<int>(WorldOffsets::WorldZ);
 
         // Find nearest entrance to the player
-        float closestDistance = FLT_MAX;
-        int closestIndex = -1;
-        for (int i = 0; i < GameData::worldMapEntrances.size(); ++i)
+        int closestIndex = findClosestEntrance(worldX, worldZ, lastClosestIndex);
+        if (closestIndex == -1)
         {
-            // Skip Zolom entrance
-            if (i == 29)
-            {
-                continue;
-            }
-
-            WorldMapEntrance& entrance = GameData::worldMapEntrances[i];
-            float dist = Utilities::getDistance(worldX, worldZ, entrance.centerX, entrance.centerZ);
-
-            if (dist < closestDistance)
-            {
-                closestDistance = dist;
-                closestIndex = i;
-            }
+            ImGui::Text("No entrance nearby.");
+            return;
         }
 
-        WorldMapEntrance& closestEntrance = GameData::worldMapEntrances[closestIndex];
-        std::string closestText = "Closest Entrance: " + closestEntrance.fieldName + " (" + std::to_string(closestEntrance.fieldID) + ")";
+        std::string cellText = "Grid Cell: " + std::to_string(getGridCell(worldX, worldZ));
+        ImGui::Text(cellText.c_str());
+
+        const WorldMapEntrance& closestEntrance = GameData::worldMapEntrances[closestIndex];
+        std::string closestText = "Closest Entrance: " + std::string(closestEntrance.fieldName) + " (" + std::to_string(closestEntrance.fieldID) + ")";
         ImGui::Text(closestText.c_str());
 
         uint16_t randomEntIndex = getRandomEntrance(closestIndex);
-        WorldMapEntrance& randomizedEntrance = GameData::worldMapEntrances[randomEntIndex];
-        std::string randomizedText = "Randomized to: " + randomizedEntrance.fieldName + " (" + std::to_string(randomizedEntrance.fieldID) + ")";
+        const WorldMapEntrance& randomizedEntrance = GameData::worldMapEntrances[randomEntIndex];
+        std::string randomizedText = "Randomized to: " + std::string(randomizedEntrance.fieldName) + " (" + std::to_string(randomizedEntrance.fieldID) + ")";
         ImGui::Text(randomizedText.c_str());
 
         int groupIndex = -1;
@@ -75,14 +73,10 @@ void RandomizeWorldMap::onDebugGUI()
         ImGui::Text(groupText.c_str());
     }
 }
+#endif
 
 void RandomizeWorldMap::onStart()
 {
-    // Clear state
-    lastClosestIndex = -1;
-    lastCmd0 = 0;
-    lastCmd1 = 0;
-    lastGameMoment = game->getGameMoment();
     entranceGroups.clear();
     randomizedEntrances.clear();
 
@@ -119,7 +113,7 @@ void RandomizeWorldMap::onStart()
 
         for (int j = 0; j < GameData::worldMapEntrances.size(); ++j)
         {
-            WorldMapEntrance& entrance = GameData::worldMapEntrances[j];
+            const WorldMapEntrance& entrance = GameData::worldMapEntrances[j];
             if (group.count(entrance.fieldID) > 0)
             {
                 groupKeys.push_back(j);
@@ -132,26 +126,37 @@ void RandomizeWorldMap::onStart()
         {
             randomizedEntrances[groupKeys[j]] = groupValues[j];
 
-            WorldMapEntrance& entrance1 = GameData::worldMapEntrances[groupKeys[j]];
-            WorldMapEntrance& entrance2 = GameData::worldMapEntrances[groupValues[j]];
+            const WorldMapEntrance& entrance1 = GameData::worldMapEntrances[groupKeys[j]];
+            const WorldMapEntrance& entrance2 = GameData::worldMapEntrances[groupValues[j]];
 
             // Only log if we haven't already for this seed, otherwise this is just log spam.
             if (lastLoggedSeed != seed)
             {
-                LOG("World Map Entrance %s (%d) -> %s (%d)", entrance1.fieldName.c_str(), entrance1.fieldID, entrance2.fieldName.c_str(), entrance2.fieldID);
+                LOG("World Map Entrance %s (%d) -> %s (%d)", entrance1.fieldName, entrance1.fieldID, entrance2.fieldName, entrance2.fieldID);
             }
         }
     }
 
+    lastLoggedSeed = seed;
+}
+
+void RandomizeWorldMap::onResync()
+{
+    // Clear state
+    lastClosestIndex = -1;
+    lastCmd0 = 0;
+    lastCmd1 = 0;
+    lastGameMoment = game->getGameMoment();
+    lastGridCell = -1;
+    gridClosestIndex = -1;
+
     // Hack: disable the dead zolom scene to simplify things
     uint8_t seenZolom = game->read<uint8_t>(0x9D457);
     seenZolom |= (1u << 3);
     game->write<uint8_t>(0x9D457, seenZolom);
-
-    lastLoggedSeed = seed;
 }
 
-void RandomizeWorldMap::onFrame(uint32_t frameNumber)
+void RandomizeWorldMap::onFrame(uint32_t frameNumber, uint32_t elapsedFrames)
 {
     uint16_t currentGameMoment = game->getGameMoment();
     if (lastGameMoment < 1299 && currentGameMoment == 1299)
@@ -169,37 +174,29 @@ void RandomizeWorldMap::onFrame(uint32_t frameNumber)
     if (game->getGameModule() != GameModule::World)
     {
         lastClosestIndex = -1;
+        lastGridCell = -1;
+        gridClosestIndex = -1;
         return;
     }
 
     int worldX = game->read<int>(WorldOffsets::WorldX);
     int worldZ = game->read<int>(WorldOffsets::WorldZ);
 
-    // Find nearest entrance to the player
-    float closestDistance = FLT_MAX;
-    int closestIndex = -1;
-    for (int i = 0; i < GameData::worldMapEntrances.size(); ++i)
+    // Find nearest entrance to the player. If we're still in the same cell and it only has one
+    // candidate then the closest entrance can't have changed.
+    int cell = getGridCell(worldX, worldZ);
+    bool singleCandidate = (gridCellOffsets[cell + 1] - gridCellOffsets[cell]) == 1;
+    if (cell != lastGridCell || !singleCandidate)
     {
-        // Skip Zolom entrance
-        if (i == 29)
-        {
-            continue;
-        }
-
-        WorldMapEntrance& entrance = GameData::worldMapEntrances[i];
-        float dist = Utilities::getDistance(worldX, worldZ, entrance.centerX, entrance.centerZ);
-
-        if (dist < closestDistance)
-        {
-            closestDistance = dist;
-            closestIndex = i;
-        }
+        gridClosestIndex = findClosestEntrance(worldX, worldZ, gridClosestIndex);
+        lastGridCell = cell;
     }
+    int closestIndex = gridClosestIndex;
 
     // Only update when the closest entrance changes.
     if (closestIndex != -1 && closestIndex != lastClosestIndex)
     {
-        WorldMapEntrance& entrance = GameData::worldMapEntrances[closestIndex];
+        const WorldMapEntrance& entrance = GameData::worldMapEntrances[closestIndex];
         uintptr_t entScriptStart = WorldOffsets::ScriptStart + entrance.offset;
 
         uint16_t cmd0 = game->read<uint16_t>(entScriptStart);
@@ -209,7 +206,7 @@ void RandomizeWorldMap::onFrame(uint32_t frameNumber)
             // Undo the randomization to the previous entrance so we can't get caught in a loop.
             if (lastClosestIndex >= 0)
             {
-                WorldMapEntrance& oldEntrance = GameData::worldMapEntrances[lastClosestIndex];
+                const WorldMapEntrance& oldEntrance = GameData::worldMapEntrances[lastClosestIndex];
                 uintptr_t oldEntScriptStart = WorldOffsets::ScriptStart + oldEntrance.offset;
                 game->write<uint16_t>(oldEntScriptStart, lastCmd0);
                 game->write<uint16_t>(oldEntScriptStart + 2, lastCmd1);
@@ -217,7 +214,7 @@ void RandomizeWorldMap::onFrame(uint32_t frameNumber)
 
             // Only overwrite the script if we actually got a random index, otherwise it'll spinlock.
             uint16_t randomEntIndex = getRandomEntrance(closestIndex);
-            WorldMapEntrance& randEntrance = GameData::worldMapEntrances[randomEntIndex];
+            const WorldMapEntrance& randEntrance = GameData::worldMapEntrances[randomEntIndex];
             if (randomEntIndex != closestIndex)
             {
                 uintptr_t randEntScriptStart = WorldOffsets::ScriptStart + randEntrance.offset;
@@ -230,7 +227,7 @@ void RandomizeWorldMap::onFrame(uint32_t frameNumber)
             lastCmd0 = cmd0;
             lastCmd1 = cmd1;
 
-            WorldMapEntrance& origEntrance = GameData::worldMapEntrances[closestIndex];
+            const WorldMapEntrance& origEntrance = GameData::worldMapEntrances[closestIndex];
             LOG("Randomized world map entrance %d to %d", origEntrance.fieldID, randEntrance.fieldID);
         }
     }
@@ -252,7 +249,7 @@ uint16_t findWorldEntranceIndex(uint16_t fieldID)
 {
     for (int i = 0; i < GameData::worldMapEntrances.size(); ++i)
     {
-        WorldMapEntrance& entrance = GameData::worldMapEntrances[i];
+        const WorldMapEntrance& entrance = GameData::worldMapEntrances[i];
         if (entrance.fieldID == fieldID)
         {
             return i;
@@ -264,7 +261,7 @@ uint16_t findWorldEntranceIndex(uint16_t fieldID)
 
 void RandomizeWorldMap::onFieldChanged(uint16_t fieldID)
 {
-    FieldData fieldData = GameData::getField(fieldID);
+    const FieldData& fieldData = GameData::getField(fieldID);
     if (!fieldData.isValid())
     {
         return;
@@ -293,14 +290,14 @@ void RandomizeWorldMap::onFieldChanged(uint16_t fieldID)
     if (fieldID == 581)
     {
         uint16_t exitIndex = getRandomEntrance(22);
-        WorldMapEntrance& randEntrance = GameData::worldMapEntrances[exitIndex];
+        const WorldMapEntrance& randEntrance = GameData::worldMapEntrances[exitIndex];
         game->write<uint16_t>(FieldScriptOffsets::ScriptStart + 0xDFF, randEntrance.fieldID);
         LOG("Changed Wutai side quest ending cutscene exit to: %d", randEntrance.fieldID);
     }
 
     for (int i = 0; i < fieldData.worldExits.size(); ++i)
     {
-        FieldWorldExit& exit = fieldData.worldExits[i];
+        const FieldWorldExit& exit = fieldData.worldExits[i];
         uint16_t exitIndex = findWorldEntranceIndex(exit.fieldID);
         
         int randIndex = exitIndex;
@@ -314,7 +311,7 @@ void RandomizeWorldMap::onFieldChanged(uint16_t fieldID)
 
         if (randIndex != exitIndex)
         {
-            WorldMapEntrance& randEntrance = GameData::worldMapEntrances[randIndex];
+            const WorldMapEntrance& randEntrance = GameData::worldMapEntrances[randIndex];
 
             uintptr_t fieldIDOffset = FieldScriptOffsets::TriggersStart + exit.offset;
             game->write<uint16_t>(fieldIDOffset, randEntrance.fieldID);
@@ -324,6 +321,102 @@ void RandomizeWorldMap::onFieldChanged(uint16_t fieldID)
     }
 }
 
+void RandomizeWorldMap::buildEntranceGrid()
+{
+    gridCellOffsets.clear();
+    gridCellEntrances.clear();
+    gridCellOffsets.reserve(GridWidth * GridHeight + 1);
+
+    for (int cz = 0; cz < GridHeight; ++cz)
+    {
+        for (int cx = 0; cx < GridWidth; ++cx)
+        {
+            int64_t minX = (int64_t)cx * GridCellSize;
+            int64_t minZ = (int64_t)cz * GridCellSize;
+            int64_t maxX = minX + GridCellSize;
+            int64_t maxZ = minZ + GridCellSize;
+
+            // Squared distance from each entrance to the nearest and farthest points of the cell. 
+            std::array<int64_t, 256> nearestDistSq;
+            int64_t bestFarthestDistSq = INT64_MAX;
+            int entranceCount = std::min<int>((int)GameData::worldMapEntrances.size(), (int)nearestDistSq.size());
+            for (int i = 0; i < entranceCount; ++i)
+            {
+                const WorldMapEntrance& entrance = GameData::worldMapEntrances[i];
+                int64_t x = entrance.centerX;
+                int64_t z = entrance.centerZ;
+
+                int64_t nearX = std::max<int64_t>(0, std::max(minX - x, x - maxX));
+                int64_t nearZ = std::max<int64_t>(0, std::max(minZ - z, z - maxZ));
+                int64_t farX = std::max(x - minX, maxX - x);
+                int64_t farZ = std::max(z - minZ, maxZ - z);
+
+                nearestDistSq[i] = nearX * nearX + nearZ * nearZ;
+
+                // Skip Zolom entrance
+                if (i != 29)
+                {
+                    bestFarthestDistSq = std::min(bestFarthestDistSq, farX * farX + farZ * farZ);
+                }
+            }
+
+            // An entrance can only be the closest to a point in the cell if it can be nearer
+            // than the entrance whose farthest point is the nearest.
+            gridCellOffsets.push_back((uint16_t)gridCellEntrances.size());
+            for (int i = 0; i < entranceCount; ++i)
+            {
+                if (i != 29 && nearestDistSq[i] <= bestFarthestDistSq)
+                {
+                    gridCellEntrances.push_back((uint8_t)i);
+                }
+            }
+        }
+    }
+    gridCellOffsets.push_back((uint16_t)gridCellEntrances.size());
+}
+
+int RandomizeWorldMap::getGridCell(int worldX, int worldZ)
+{
+    int cx = std::clamp(worldX / GridCellSize, 0, GridWidth - 1);
+    int cz = std::clamp(worldZ / GridCellSize, 0, GridHeight - 1);
+    return (cz * GridWidth) + cx;
+}
+
+int RandomizeWorldMap::findClosestEntrance(int worldX, int worldZ, int currentIndex)
+{
+    int cell = getGridCell(worldX, worldZ);
+
+    int64_t closestDistSq = INT64_MAX;
+    int closestIndex = -1;
+    int64_t currentDistSq = INT64_MAX;
+    for (uint16_t i = gridCellOffsets[cell]; i < gridCellOffsets[cell + 1]; ++i)
+    {
+        int index = gridCellEntrances[i];
+        const WorldMapEntrance& entrance = GameData::worldMapEntrances[index];
+        int64_t distSq = Utilities::getDistanceSquared(worldX, worldZ, entrance.centerX, entrance.centerZ);
+
+        if (distSq < closestDistSq)
+        {
+            closestDistSq = distSq;
+            closestIndex = index;
+        }
+
+        if (index == currentIndex)
+        {
+            currentDistSq = distSq;
+        }
+    }
+
+    // Hysteresis: stick with the current entrance unless the new one is at least 10% closer, this
+    // stops us flipping back and forth when standing roughly between two entrances.
+    if (currentDistSq != INT64_MAX && closestIndex != currentIndex && closestDistSq * 100 > currentDistSq * 81)
+    {
+        return currentIndex;
+    }
+
+    return closestIndex;
+}
+
 uint16_t RandomizeWorldMap::getRandomEntrance(uint16_t entranceIndex)
 {
     if (randomizedEntrances.count(entranceIndex) == 0)
@@ -3,21 +3,30 @@
 #include <cstdint>
 #include <random>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 class RandomizeWorldMap : public Rule
 {
 public:
     void setup() override;
+#if IRONMOG_GUI
     bool hasDebugGUI() override { return true; }
     void onDebugGUI() override;
+#endif
 
 private:
     void onStart();
-    void onFrame(uint32_t frameNumber);
+    void onResync();
+    void onFrame(uint32_t frameNumber, uint32_t elapsedFrames);
     void onWorldMapEnter();
     void onFieldChanged(uint16_t fieldID);
     uint16_t getRandomEntrance(uint16_t entranceIndex);
 
+    void buildEntranceGrid();
+    int getGridCell(int worldX, int worldZ);
+    int findClosestEntrance(int worldX, int worldZ, int currentIndex);
+
     int lastClosestIndex = -1;
     uint16_t lastCmd0 = 0;
     uint16_t lastCmd1 = 0;
@@ -26,4 +35,15 @@ private:
 
     std::vector<std::set<uint16_t>> entranceGroups;
     std::unordered_map<int, int> randomizedEntrances;
+
+    // Uniform grid over the world map, each cell lists the entrances that could be the closest 
+    // to a point inside it. Cells are one world map block in size.
+    static constexpr int GridCellSize = 8192;
+    static constexpr int GridWidth = 36;
+    static constexpr int GridHeight = 28;
+    std::vector<uint16_t> gridCellOffsets;
+    std::vector<uint8_t> gridCellEntrances;
+
+    int lastGridCell = -1;
+    int gridClosestIndex = -1;
 };
\ No newline at end of file
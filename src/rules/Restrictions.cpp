@@ -1,53 +1,45 @@
 #include "Restrictions.h"
 #include "core/game/MemoryOffsets.h"
-#include <set>
 
-std::set<uint8_t> bannedAccessories;
-std::set<uint8_t> bannedArmor;
-std::set<uint8_t> bannedItems;
-std::set<uint8_t> bannedWeapons;
-std::set<uint8_t> bannedMateria;
+static RestrictionList processRestrictions;
+thread_local RestrictionList* Restrictions::current = &processRestrictions;
 
 void Restrictions::reset()
 {
-    bannedAccessories.clear();
-    bannedArmor.clear();
-    bannedItems.clear(); 
-    bannedWeapons.clear();
-    bannedMateria.clear();
+    *current = RestrictionList();
 }
 
 void Restrictions::banAccessory(uint8_t id)
 {
-    bannedAccessories.insert(id);
+    current->accessories.insert(id);
 }
 bool Restrictions::isAccessoryBanned(uint8_t id)
 {
-    return (bannedAccessories.count(id) > 0);
+    return (current->accessories.count(id) > 0);
 }
 void Restrictions::banArmor(uint8_t id)
 {
-    bannedArmor.insert(id);
+    current->armor.insert(id);
 }
 bool Restrictions::isArmorBanned(uint8_t id)
 {
-    return (bannedArmor.count(id) > 0);
+    return (current->armor.count(id) > 0);
 }
 void Restrictions::banItem(uint8_t id)
 {
-    bannedItems.insert(id);
+    current->items.insert(id);
 }
 bool Restrictions::isItemBanned(uint8_t id)
 {
-    return (bannedItems.count(id) > 0);
+    return (current->items.count(id) > 0);
 }
 void Restrictions::banWeapon(uint8_t id)
 {
-    bannedWeapons.insert(id);
+    current->weapons.insert(id);
 }
 bool Restrictions::isWeaponBanned(uint8_t id)
 {
-    return (bannedWeapons.count(id) > 0);
+    return (current->weapons.count(id) > 0);
 }
 
 bool Restrictions::isFieldItemBanned(uint16_t fieldItemID)
@@ -74,10 +66,10 @@ bool Restrictions::isFieldItemBanned(uint16_t fieldItemID)
 
 void Restrictions::banMateria(uint8_t materiaID)
 {
-    bannedMateria.insert(materiaID);
+    current->materia.insert(materiaID);
 }
 
 bool Restrictions::isMateriaBanned(uint8_t materiaID)
 {
-    return (bannedMateria.count(materiaID) > 0);
+    return (current->materia.count(materiaID) > 0);
 }
\ No newline at end of file
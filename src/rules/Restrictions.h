@@ -1,10 +1,25 @@
 #pragma once
 
 #include "core/game/GameManager.h"
+#include <set>
+
+// The ids banned by the enabled rules of one game. Each GameManager owns one so several games can
+// run in one process, see RestrictionsScope.
+struct RestrictionList
+{
+    std::set<uint8_t> accessories;
+    std::set<uint8_t> armor;
+    std::set<uint8_t> items;
+    std::set<uint8_t> weapons;
+    std::set<uint8_t> materia;
+};
 
 class Restrictions
 {
 public:
+    // The list bans on this thread apply to, a process wide list unless a RestrictionsScope is active.
+    static thread_local RestrictionList* current;
+
     static void reset();
 
     static void banAccessory(uint8_t id);
@@ -20,4 +35,15 @@ public:
 
     static void banMateria(uint8_t materiaID);
     static bool isMateriaBanned(uint8_t materiaID);
+};
+
+// Applies bans made on this thread to a game's list until the scope ends.
+class RestrictionsScope
+{
+public:
+    RestrictionsScope(RestrictionList* list) : previousList(Restrictions::current) { Restrictions::current = list; }
+    ~RestrictionsScope() { Restrictions::current = previousList; }
+
+private:
+    RestrictionList* previousList;
 };
\ No newline at end of file
@@ -12,6 +12,8 @@ public:
     bool settingsVisible = false;
     bool debugVisible = false;
 
+    virtual ~Rule() = default;
+
     virtual void setup() {}
     virtual bool hasSettings() { return false; }
     virtual bool onSettingsGUI() { return false; }
@@ -29,6 +31,9 @@ protected:
     GameManager* game;
 
 public:
+    // Copies a registered rule, settings and all, for a GameManager that runs its own set.
+    Rule* (*clone)(const Rule*) = nullptr;
+
     static std::vector<Rule*>& getList()
     {
         static std::vector<Rule*> list;
@@ -48,6 +53,7 @@ public:
                 ClassName* tmp = new ClassName(); \
                 tmp->name = NameStr; \
                 tmp->description = DescStr; \
+                tmp->clone = [](const Rule* source) -> Rule* { return new ClassName(*static_cast<const ClassName*>(source)); }; \
                 Rule::registerRule(NameStr, tmp); \
             } \
         }; \
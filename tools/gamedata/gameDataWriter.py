@@ -0,0 +1,298 @@
+# Collects game data records and writes them out as constexpr tables. Child lists (field items,
+# formations, model parts, etc) are flattened into one array per type and parents reference a
+# slice of it, so nothing in GameDataGenerated.cpp needs to be constructed at runtime.
+
+def listToCPPArray(src_list):
+    list_string = ", ".join(map(str, src_list))
+    return "{" + list_string + "}"
+
+def toCPPBool(value):
+    return "true" if value else "false"
+
+class FieldRecord:
+    def __init__(self, fieldID, name):
+        self.id = fieldID
+        self.name = name
+        self.items = []
+        self.materia = []
+        self.messages = []
+        self.shops = []
+        self.battles = []
+        self.worldExits = []
+        self.modelIDs = []
+        self.encounterOffset = 0
+        self.encounterTable0 = []
+        self.encounterTable1 = []
+
+class GameDataWriter:
+    def __init__(self, filepath="GameDataGenerated.cpp"):
+        self.filepath = filepath
+        self.file = None
+
+        self.items = {}
+        self.weapons = {}
+        self.armors = {}
+        self.accessories = {}
+        self.materia = {}
+        self.eSkills = []
+        self.fields = {}
+        self.worldMapEntrances = []
+        self.worldMapEncounters = []
+        self.shops = {}
+        self.battleScenes = {}
+        self.bosses = []
+        self.models = []
+        self.battleModels = []
+
+    # Items
+    def addItem(self, id, name, price):      self.items[id] = (name, price)
+    def addWeapon(self, id, name, price):    self.weapons[id] = (name, price)
+    def addArmor(self, id, name, price):     self.armors[id] = (name, price)
+    def addAccessory(self, id, name, price): self.accessories[id] = (name, price)
+    def addMateria(self, id, name, price):   self.materia[id] = (name, price)
+
+    # targetFlags is written as is so it can be given in binary.
+    def addESkill(self, name, targetFlags, mpCost, index):
+        self.eSkills.append((name, targetFlags, mpCost, index))
+
+    # Fields
+    def addField(self, fieldID, name):
+        self.fields[fieldID] = FieldRecord(fieldID, name)
+
+    def addFieldScriptItem(self, fieldID, groupIdx, scriptIdx, offset, itemID, quantity):
+        self.fields[fieldID].items.append((groupIdx, scriptIdx, offset, itemID, quantity))
+
+    def addFieldScriptMateria(self, fieldID, groupIdx, scriptIdx, offset, materiaID):
+        self.fields[fieldID].materia.append((groupIdx, scriptIdx, offset, materiaID, 1))
+
+    def addFieldScriptMessage(self, fieldID, groupIdx, scriptIdx, windowIdx, offset, strOffset, strLength):
+        self.fields[fieldID].messages.append((groupIdx, scriptIdx, windowIdx, offset, strOffset, strLength))
+
+    def addFieldScriptShop(self, fieldID, groupIdx, scriptIdx, offset, shopID):
+        self.fields[fieldID].shops.append((groupIdx, scriptIdx, offset, shopID))
+
+    def addFieldScriptBattle(self, fieldID, groupIdx, scriptIdx, offset, formationID):
+        self.fields[fieldID].battles.append((groupIdx, scriptIdx, offset, formationID))
+
+    def addFieldWorldExit(self, fieldID, offset, index, targetFieldID):
+        self.fields[fieldID].worldExits.append((offset, index, targetFieldID))
+
+    def addFieldModels(self, fieldID, modelIDs):
+        self.fields[fieldID].modelIDs = list(modelIDs)
+
+    def addFieldEncounters(self, fieldID, encounterOffset, encounterTable0, encounterTable1):
+        field = self.fields[fieldID]
+        field.encounterOffset = encounterOffset
+        field.encounterTable0 = list(encounterTable0)
+        field.encounterTable1 = list(encounterTable1)
+
+    # World Map
+    def addWorldMapEntrance(self, offset, fieldID, fieldName, centerX, centerZ):
+        self.worldMapEntrances.append((offset, fieldID, fieldName, centerX, centerZ))
+
+    def addWorldMapEncounters(self, sets):
+        self.worldMapEncounters.append([list(s) for s in sets])
+
+    # Shop entries of 512 and above are materia.
+    def addShop(self, shopID, itemData):
+        items = []
+        materia = []
+        for i, id in enumerate(itemData):
+            if id >= 512:
+                materia.append((i, id - 512))
+            else:
+                items.append((i, id))
+        self.shops[shopID] = (items, materia)
+
+    # Battles
+    def addBattleScene(self, sceneID, enemyIDs, enemyLevels):
+        self.battleScenes[sceneID] = (list(enemyIDs), list(enemyLevels), [])
+
+    def addBattleFormation(self, sceneID, formationID, noEscape, enemyIDs, arenaIDs):
+        self.battleScenes[sceneID][2].append((formationID, noEscape, list(enemyIDs), list(arenaIDs)))
+
+    # elemTypes and elemRates are written as is.
+    def addBoss(self, enemyID, name, sceneIDs, elemTypes, elemRates):
+        self.bosses.append((enemyID, name, list(sceneIDs), elemTypes, elemRates))
+
+    # Model parts are pre-formatted initializer strings.
+    def addModel(self, name, polyCount, parts):
+        self.models.append((name, polyCount, list(parts)))
+
+    def addBattleModel(self, name, headerSizes, parts):
+        self.battleModels.append((name, list(headerSizes), list(parts)))
+
+    def write_line(self, line, indent=0):
+        indent_str = " " * indent
+        self.file.write(f"{indent_str}{line}\n")
+
+    # Writes a flat array and returns the function used to reference a slice of it.
+    def write_child_table(self, cppType, tableName, rows):
+        if len(rows) == 0:
+            return lambda start, count: "{}"
+
+        self.write_line("static constexpr " + cppType + " " + tableName + "[] = {")
+        for row in rows:
+            self.write_line(row + ",", 4)
+        self.write_line("};")
+        self.write_line("")
+
+        return lambda start, count: "{ " + tableName + " + " + str(start) + ", " + str(count) + " }" if count > 0 else "{}"
+
+    def write_table(self, cppType, tableName, memberName, rows):
+        self.write_line("static constexpr " + cppType + " " + tableName + "[] = {")
+        for row in rows:
+            self.write_line(row + ",", 4)
+        self.write_line("};")
+        self.write_line("constexpr TableView<" + cppType + "> GameData::" + memberName + " = { " + tableName + ", std::size(" + tableName + ") };")
+        self.write_line("")
+
+    # Items are indexed directly by ID, unused IDs have an empty name.
+    def write_item_table(self, tableName, memberName, items):
+        rows = []
+        count = max(items.keys()) + 1 if len(items) > 0 else 0
+        for id in range(0, count):
+            name, price = items.get(id, ("", 0))
+            rows.append("{ \"" + name + "\", " + str(price) + " }")
+        self.write_table("Item", tableName, memberName, rows)
+
+    # Flattens one child list of every parent into a single table, returns the slice reference for each parent.
+    def flatten(self, parents, getChildren, formatChild, cppType, tableName):
+        rows = []
+        starts = []
+        for parent in parents:
+            starts.append(len(rows))
+            for child in getChildren(parent):
+                rows.append(formatChild(child))
+
+        sliceRef = self.write_child_table(cppType, tableName, rows)
+        return [sliceRef(starts[i], len(getChildren(parent))) for i, parent in enumerate(parents)]
+
+    def write_fields(self):
+        fields = [self.fields[id] for id in sorted(self.fields.keys())]
+
+        formatItem = lambda i: "{ " + str(i[0]) + ", " + str(i[1]) + ", " + f"0x{i[2]:X}" + ", " + str(i[3]) + ", " + str(i[4]) + " }"
+        items = self.flatten(fields, lambda f: f.items, formatItem, "FieldScriptItem", "fieldScriptItems")
+        materia = self.flatten(fields, lambda f: f.materia, formatItem, "FieldScriptItem", "fieldScriptMateria")
+
+        messages = self.flatten(fields, lambda f: f.messages,
+            lambda m: "{ " + str(m[0]) + ", " + str(m[1]) + ", " + str(m[2]) + ", " + f"0x{m[3]:X}" + ", " + f"0x{m[4]:X}" + ", " + str(m[5]) + " }",
+            "FieldScriptMessage", "fieldScriptMessages")
+
+        shops = self.flatten(fields, lambda f: f.shops,
+            lambda s: "{ " + str(s[0]) + ", " + str(s[1]) + ", " + f"0x{s[2]:X}" + ", " + str(s[3]) + " }",
+            "FieldScriptShop", "fieldScriptShops")
+
+        battles = self.flatten(fields, lambda f: f.battles,
+            lambda b: "{ " + str(b[0]) + ", " + str(b[1]) + ", " + f"0x{b[2]:X}" + ", " + str(b[3]) + " }",
+            "FieldScriptBattle", "fieldScriptBattles")
+
+        worldExits = self.flatten(fields, lambda f: f.worldExits,
+            lambda e: "{ " + f"0x{e[0]:X}" + ", " + str(e[1]) + ", " + f"0x{e[2]:X}" + " }",
+            "FieldWorldExit", "fieldWorldExits")
+
+        modelIDs = self.flatten(fields, lambda f: f.modelIDs, str, "uint8_t", "fieldModelIDs")
+
+        rows = []
+        for i, field in enumerate(fields):
+            table0 = listToCPPArray(field.encounterTable0)
+            table1 = listToCPPArray(field.encounterTable1)
+            rows.append("{ " + f"0x{field.id:04X}" + ", \"" + field.name + "\", " + items[i] + ", " + materia[i] + ", " + messages[i] + ", " + shops[i] + ", " +
+                        battles[i] + ", " + worldExits[i] + ", " + modelIDs[i] + ", " + f"0x{field.encounterOffset:X}" + ", " + table0 + ", " + table1 + " }")
+
+        self.write_table("FieldData", "fieldTable", "fields", rows)
+
+    def write_world_map(self):
+        rows = []
+        for offset, fieldID, fieldName, centerX, centerZ in self.worldMapEntrances:
+            rows.append("{ " + f"0x{offset:X}" + ", " + f"0x{fieldID:02X}" + ", \"" + fieldName + "\", " + str(centerX) + ", " + str(centerZ) + " }")
+        self.write_table("WorldMapEntrance", "worldMapEntranceTable", "worldMapEntrances", rows)
+
+        # Each region has 4 sets, flatten them all into one list of sets.
+        sets = [s for region in self.worldMapEncounters for s in region]
+        setRefs = self.flatten(sets, lambda s: s, str, "Encounter", "worldMapEncounterSets")
+
+        rows = []
+        for i in range(0, len(self.worldMapEncounters)):
+            rows.append("{ { " + listToCPPArray(setRefs[i * 4:i * 4 + 4]) + " } }")
+        self.write_table("WorldMapEncounters", "worldMapEncounterTable", "worldMapEncounters", rows)
+
+    def write_shops(self):
+        shops = [self.shops[id] for id in sorted(self.shops.keys())]
+        formatShopItem = lambda s: "{ " + str(s[0]) + ", " + str(s[1]) + " }"
+        items = self.flatten(shops, lambda s: s[0], formatShopItem, "ShopItem", "shopItems")
+        materia = self.flatten(shops, lambda s: s[1], formatShopItem, "ShopItem", "shopMateria")
+
+        rows = []
+        for i in range(0, len(shops)):
+            rows.append("{ " + items[i] + ", " + materia[i] + " }")
+        self.write_table("Shop", "shopTable", "shops", rows)
+
+    def write_battles(self):
+        sceneIDs = sorted(self.battleScenes.keys())
+        scenes = [self.battleScenes[id] for id in sceneIDs]
+        formations = self.flatten(scenes, lambda s: s[2],
+            lambda f: "{ " + str(f[0]) + ", " + toCPPBool(f[1]) + ", " + listToCPPArray(f[2]) + ", " + listToCPPArray(f[3]) + " }",
+            "BattleFormation", "battleFormations")
+
+        rows = []
+        for i, scene in enumerate(scenes):
+            rows.append("{ " + str(sceneIDs[i]) + ", " + listToCPPArray(scene[0]) + ", " + listToCPPArray(scene[1]) + ", " + formations[i] + " }")
+        self.write_table("BattleScene", "battleSceneTable", "battleScenes", rows)
+
+        sceneRefs = self.flatten(self.bosses, lambda b: b[2], str, "uint8_t", "bossSceneIDs")
+        rows = []
+        for i, (enemyID, name, sceneIDs, elemTypes, elemRates) in enumerate(self.bosses):
+            rows.append("{ " + str(enemyID) + ", \"" + name + "\", " + sceneRefs[i] + ", " + elemTypes + ", " + elemRates + " }")
+        self.write_table("Boss", "bossTable", "bosses", rows)
+
+    def write_models(self):
+        parts = self.flatten(self.models, lambda m: m[2], str, "ModelPart", "modelParts")
+        rows = []
+        for i, (name, polyCount, modelParts) in enumerate(self.models):
+            rows.append("{ \"" + name + "\", " + str(polyCount) + ", " + parts[i] + " }")
+        self.write_table("Model", "modelTable", "models", rows)
+
+        headerSizes = self.flatten(self.battleModels, lambda m: m[1], str, "int", "battleModelHeaderSizes")
+        parts = self.flatten(self.battleModels, lambda m: m[2], str, "BattleModelPart", "battleModelParts")
+        rows = []
+        for i, (name, modelHeaderSizes, modelParts) in enumerate(self.battleModels):
+            rows.append("{ \"" + name + "\", " + headerSizes[i] + ", " + parts[i] + " }")
+        self.write_table("BattleModel", "battleModelTable", "battleModels", rows)
+
+    def write(self):
+        self.file = open(self.filepath, "w", encoding="utf-8")
+
+        self.write_line("// Auto-generated game data file")
+        self.write_line("#include \"GameData.h\"")
+        self.write_line("#include <iterator>")
+        self.write_line("")
+
+        self.write_line("// Items")
+        self.write_item_table("itemTable", "items", self.items)
+        self.write_item_table("weaponTable", "weapons", self.weapons)
+        self.write_item_table("armorTable", "armors", self.armors)
+        self.write_item_table("accessoryTable", "accessories", self.accessories)
+        self.write_item_table("materiaTable", "materia", self.materia)
+
+        self.write_line("// Enemy Skills")
+        rows = ["{ \"" + name + "\", " + targetFlags + ", " + str(mpCost) + ", " + str(index) + " }" for name, targetFlags, mpCost, index in self.eSkills]
+        self.write_table("ESkill", "eSkillTable", "eSkills", rows)
+
+        self.write_line("// Fields")
+        self.write_fields()
+
+        self.write_line("// World Map")
+        self.write_world_map()
+
+        self.write_line("// Shops")
+        self.write_shops()
+
+        self.write_line("// Battles")
+        self.write_battles()
+
+        self.write_line("// Models")
+        self.write_models()
+
+        self.file.close()
+        self.file = None
@@ -2,38 +2,13 @@ import os
 import sys
 import ff7
 from ff7.field import opcodes, specialOpcodes, Op, fieldIDTable
+from gameDataWriter import GameDataWriter
 
-class GameDataGenerator:
+class GameDataGenerator(GameDataWriter):
     def __init__(self, filepath="GameDataGenerated.cpp"):
-        self.filepath = filepath
-        self.file = None
+        super().__init__(filepath)
         self.item_names = []
 
-    def open_file(self):
-        self.file = open(self.filepath, "w", encoding="utf-8")
-
-    def close_file(self):
-        if self.file:
-            self.file.close()
-
-    def write_line(self, line, indent=0):
-        indent_str = " " * indent
-        self.file.write(f"{indent_str}{line}\n")
-
-    def write_header(self):
-        self.write_line("// Auto-generated game data file", 0)
-        self.write_line("#include \"GameData.h\"", 0)
-        self.write_line("", 0)
-        self.write_line("void GameData::loadGameData()", 0)
-        self.write_line("{", 0)
-
-    def write_footer(self):
-        self.write_line("}", 0)
-
-def listToCPPArray(src_list):
-    list_string = ", ".join(map(str, src_list))
-    return "{" + list_string + "}"
-
 def outputInventory(gen, discPath, version):
     # Retrieve the kernel data file
     kernelDataFile = ff7.game.retrieveFile(discPath, "INIT", "KERNEL.BIN")
@@ -49,7 +24,6 @@ def outputInventory(gen, discPath, version):
 
         # Item Names
         if (index == 10):
-            gen.write_line("// Items", 4)
             for idx in range(0, len(lines)):
                 item_name = lines[idx]
                 if (item_name == ""):
@@ -58,13 +32,11 @@ def outputInventory(gen, discPath, version):
                 item_id = idx
                 item_price = shopData.item_prices[item_id]
 
-                gen.write_line("addItem(" + str(idx) + ", \"" + item_name + "\", " + str(item_price) + ");", 4)  
+                gen.addItem(idx, item_name, item_price)
                 gen.item_names.append(item_name)
-            gen.write_line("")
 
         # Weapon Names
         if (index == 11):
-            gen.write_line("// Weapons", 4)
             for idx in range(0, len(lines)):
                 item_name = lines[idx]
                 if (item_name == ""):
@@ -73,13 +45,11 @@ def outputInventory(gen, discPath, version):
                 item_id = idx + 128
                 item_price = shopData.item_prices[item_id]
 
-                gen.write_line("addWeapon(" + str(idx) + ", \"" + item_name + "\", " + str(item_price) + ");", 4)  
+                gen.addWeapon(idx, item_name, item_price)
                 gen.item_names.append(item_name)
-            gen.write_line("")
 
         # Armor Names
         if (index == 12):
-            gen.write_line("// Armor", 4)
             for idx in range(0, len(lines)):
                 item_name = lines[idx]
                 if (item_name == ""):
@@ -88,13 +58,11 @@ def outputInventory(gen, discPath, version):
                 item_id = idx + 256
                 item_price = shopData.item_prices[item_id]
 
-                gen.write_line("addArmor(" + str(idx) + ", \"" + item_name + "\", " + str(item_price) + ");", 4)  
+                gen.addArmor(idx, item_name, item_price)
                 gen.item_names.append(item_name)
-            gen.write_line("")
 
         # Accessory Names
         if (index == 13):
-            gen.write_line("// Accessories", 4)
             for idx in range(0, len(lines)):
                 item_name = lines[idx]
                 if (item_name == ""):
@@ -103,13 +71,11 @@ def outputInventory(gen, discPath, version):
                 item_id = idx + 288
                 item_price = shopData.item_prices[item_id]
 
-                gen.write_line("addAccessory(" + str(idx) + ", \"" + item_name + "\", " + str(item_price) + ");", 4)   
+                gen.addAccessory(idx, item_name, item_price)
                 gen.item_names.append(item_name)
-            gen.write_line("")
 
         # Materia Names
         if (index == 14):
-            gen.write_line("// Materia", 4)
             for idx in range(0, len(lines)):
                 materia_name = lines[idx]
                 if (materia_name == ""):
@@ -118,39 +84,37 @@ def outputInventory(gen, discPath, version):
                 materia_id = idx
                 materia_price = shopData.materia_prices[materia_id]
                 
-                gen.write_line("addMateria(" + str(idx) + ", \"" + materia_name + "\", " + str(materia_price) + ");", 4) 
+                gen.addMateria(idx, materia_name, materia_price)
                 gen.item_names.append(materia_name) 
-            gen.write_line("")
 
 def outputOther(gen, discPath, version):
     # Enemy Skills
     # TODO: we can pull this data from kernel, instead its hardcoded from inspection with Scarlet.
     # Format: Name, Target Flags, MP Cost, Index.
-    gen.write_line("addESkill(\"Frog Song\", 0b00000011, 5, 0);", 4)
-    gen.write_line("addESkill(\"L4 Suicide\", 0b00000111, 10, 1);", 4)
-    gen.write_line("addESkill(\"Magic Hammer\", 0b00000011, 3, 2);", 4)
-    gen.write_line("addESkill(\"White Wind\", 0b00000101, 34, 3);", 4)
-    gen.write_line("addESkill(\"Big Guard\", 0b00000101, 56, 4);", 4)
-    gen.write_line("addESkill(\"Angel Whisper\", 0b00000001, 50, 5);", 4)
-    gen.write_line("addESkill(\"Dragon Force\", 0b00000001, 19, 6);", 4)
-    gen.write_line("addESkill(\"Death Force\", 0b00000001, 3, 7);", 4)
-    gen.write_line("addESkill(\"Flame Thrower\", 0b00000011, 10, 8);", 4)
-    gen.write_line("addESkill(\"Laser\", 0b00000011, 16, 9);", 4)
-    gen.write_line("addESkill(\"Matra Magic\", 0b00000111, 8, 10);", 4)
-    gen.write_line("addESkill(\"Bad Breath\", 0b00000111, 58, 11);", 4)
-    gen.write_line("addESkill(\"Beta\", 0b00000111, 35, 12);", 4)
-    gen.write_line("addESkill(\"Aqualung\", 0b00000111, 34, 13);", 4)
-    gen.write_line("addESkill(\"Trine\", 0b00000111, 20, 14);", 4)
-    gen.write_line("addESkill(\"Magic Breath\", 0b00000111, 75, 15);", 4)
-    gen.write_line("addESkill(\"????\", 0b00000011, 3, 16);", 4)
-    gen.write_line("addESkill(\"Goblin Punch\", 0b00000011, 0, 17);", 4)
-    gen.write_line("addESkill(\"Chocobuckle\", 0b00000011, 3, 18);", 4)
-    gen.write_line("addESkill(\"L5 Death\", 0b00000111, 22, 19);", 4)
-    gen.write_line("addESkill(\"Death Sentence\", 0b00000011, 10, 20);", 4)
-    gen.write_line("addESkill(\"Roulette\", 0b11000111, 6, 21);", 4)
-    gen.write_line("addESkill(\"Shadow Flare\", 0b00000011, 100, 22);", 4)
-    gen.write_line("addESkill(\"Pandora’s Box\", 0b00000111, 110, 23);", 4)
-    gen.write_line("")
+    gen.addESkill("Frog Song", "0b00000011", 5, 0)
+    gen.addESkill("L4 Suicide", "0b00000111", 10, 1)
+    gen.addESkill("Magic Hammer", "0b00000011", 3, 2)
+    gen.addESkill("White Wind", "0b00000101", 34, 3)
+    gen.addESkill("Big Guard", "0b00000101", 56, 4)
+    gen.addESkill("Angel Whisper", "0b00000001", 50, 5)
+    gen.addESkill("Dragon Force", "0b00000001", 19, 6)
+    gen.addESkill("Death Force", "0b00000001", 3, 7)
+    gen.addESkill("Flame Thrower", "0b00000011", 10, 8)
+    gen.addESkill("Laser", "0b00000011", 16, 9)
+    gen.addESkill("Matra Magic", "0b00000111", 8, 10)
+    gen.addESkill("Bad Breath", "0b00000111", 58, 11)
+    gen.addESkill("Beta", "0b00000111", 35, 12)
+    gen.addESkill("Aqualung", "0b00000111", 34, 13)
+    gen.addESkill("Trine", "0b00000111", 20, 14)
+    gen.addESkill("Magic Breath", "0b00000111", 75, 15)
+    gen.addESkill("????", "0b00000011", 3, 16)
+    gen.addESkill("Goblin Punch", "0b00000011", 0, 17)
+    gen.addESkill("Chocobuckle", "0b00000011", 3, 18)
+    gen.addESkill("L5 Death", "0b00000111", 22, 19)
+    gen.addESkill("Death Sentence", "0b00000011", 10, 20)
+    gen.addESkill("Roulette", "0b11000111", 6, 21)
+    gen.addESkill("Shadow Flare", "0b00000011", 100, 22)
+    gen.addESkill("Pandora’s Box", "0b00000111", 110, 23)
 
 def unpack_ushort(byteA, byteB):
     value = byteA | (byteB << 8)
@@ -175,8 +139,8 @@ def outputFields(gen, discPath, version):
             fieldOffsets[id] = (stroffset, strlen)
             id += 1
 
-        fieldID = fieldIDTable[map.lower()]
-        gen.write_line("addField(" + fieldID + ", \"" + map.lower() + "\");", 4)
+        fieldID = int(fieldIDTable[map.lower()], 16)
+        gen.addField(fieldID, map.lower())
 
         last_x = 0
         last_y = 0
@@ -220,11 +184,11 @@ def outputFields(gen, discPath, version):
             if (mnemonic == "stitm"):
                 item_id = values[3] | (values[4] << 8)
                 item_quantity = values[5]
-                gen.write_line("addFieldScriptItem(" + fieldID + ", " + str(groupIndex) + ", " + str(scriptIndex) + ", " + f"0x{addr:X}" + ", " + str(item_id) + ", " + str(item_quantity) + ");", 4)
+                gen.addFieldScriptItem(fieldID, groupIndex, scriptIndex, addr, item_id, item_quantity)
 
             if (mnemonic == "smtra"):
                 materia_id = values[4]
-                gen.write_line("addFieldScriptMateria(" + fieldID + ", " + str(groupIndex) + ", " + str(scriptIndex) + ", " + f"0x{addr:X}" + ", " + str(materia_id) + ");", 4)
+                gen.addFieldScriptMateria(fieldID, groupIndex, scriptIndex, addr, materia_id)
 
             if (mnemonic == "mes"):
                 windowIndex = values[2]
@@ -233,23 +197,23 @@ def outputFields(gen, discPath, version):
                 # We use the Turtle Paradise newsletter for in game hints
                 if ("Turtle Paradise" in string or "Turtles Paradise" in string or "Turtle's Paradise" in string) and ("No." in string or "Number" in string):
                     stroffset, strlen = fieldOffsets[values[3]]
-                    gen.write_line("addFieldScriptMessage(" + fieldID + ", " + str(groupIndex) + ", " + str(scriptIndex) + ", " + str(windowIndex) + ", " + f"0x{addr:X}" + ", " + f"0x{stroffset:X}" + ", " + str(strlen) + ");", 4)
+                    gen.addFieldScriptMessage(fieldID, groupIndex, scriptIndex, windowIndex, addr, stroffset, strlen)
 
                 # Ensures the string contains an item/materia/etc name wrapped in quotes
                 match = next((word for word in gen.item_names if f'"{word}"' in string), None)
                 if match:
                     stroffset, strlen = fieldOffsets[values[3]]
-                    gen.write_line("addFieldScriptMessage(" + fieldID + ", " + str(groupIndex) + ", " + str(scriptIndex) + ", " + str(windowIndex) + ", " +  f"0x{addr:X}" + ", " + f"0x{stroffset:X}" + ", " + str(strlen) + ");", 4)
+                    gen.addFieldScriptMessage(fieldID, groupIndex, scriptIndex, windowIndex, addr, stroffset, strlen)
 
             if (mnemonic == "menu" and len(values) == 5):
                 # Shop
                 if values[3] == 8:
-                    gen.write_line("addFieldScriptShop(" + fieldID + ", "+ str(groupIndex) + ", " + str(scriptIndex) + ", " + f"0x{addr:X}" + ", " + str(values[4]) + ");", 4)
+                    gen.addFieldScriptShop(fieldID, groupIndex, scriptIndex, addr, values[4])
 
             if (mnemonic == "batle"):
                 if values[2] == 0:
                     encounterID = values[3] | (values[4] << 8)
-                    gen.write_line("addFieldScriptBattle(" + fieldID + ", "+ str(groupIndex) + ", " + str(scriptIndex) + ", " + f"0x{addr:X}" + ", " + str(encounterID) + ");", 4)
+                    gen.addFieldScriptBattle(fieldID, groupIndex, scriptIndex, addr, encounterID)
                 else:
                     print("Field script battle uses memory fetch: " + str(values))
 
@@ -265,7 +229,7 @@ def outputFields(gen, discPath, version):
             if (door.fieldID > 0 and door.fieldID < 65):
                 final_offset = section_start + 56 + (door_index * 24)
 
-                gen.write_line("addFieldWorldExit(" + fieldID + ", " + f"0x{final_offset:X}" + ", " + str(door_index) + ", " + f"0x{door.fieldID:X}" + ");", 4)
+                gen.addFieldWorldExit(fieldID, final_offset, door_index, door.fieldID)
             door_index += 1
 
         # Field Models
@@ -273,24 +237,16 @@ def outputFields(gen, discPath, version):
         globalModelIDs = []
         for model in modelSection.models:
             globalModelIDs.append(model.globalModelID)
-        gen.write_line("addFieldModels(" + fieldID + ", {" + ",".join(str(x) for x in globalModelIDs) + "});", 4)    
+        gen.addFieldModels(fieldID, globalModelIDs)
 
         # Field Encounters
         encounterSection = mapData.getEncounterSection()
         encounterSectionStart = mapData.getEncounterSectionStart()
 
-        table0Str = "{}"
-        if any(encounterSection.table0.encounters):
-            table0Str = "{" + ",".join(str(x) for x in encounterSection.table0.encounters) + "}"
-
-        table1Str = "{}"
-        if any(encounterSection.table1.encounters):
-            table1Str = "{" + ",".join(str(x) for x in encounterSection.table1.encounters) + "}"
-        
-        if not table0Str == "{}" or not table1Str == "{}":
-            gen.write_line("addFieldEncounters(" + fieldID + ", " + f"0x{encounterSectionStart:X}" + ", " + table0Str + ", " + table1Str + ");", 4)    
-
-    gen.write_line("")
+        if any(encounterSection.table0.encounters) or any(encounterSection.table1.encounters):
+            table0 = encounterSection.table0.encounters if any(encounterSection.table0.encounters) else []
+            table1 = encounterSection.table1.encounters if any(encounterSection.table1.encounters) else []
+            gen.addFieldEncounters(fieldID, encounterSectionStart, table0, table1)
 
 def outputWorldMap(gen, discPath, version):
 
@@ -299,63 +255,49 @@ def outputWorldMap(gen, discPath, version):
     # and seems to produce wrong jumps for certain entrances. Therefore, the jump addresses were all determined
     # by analyzing memory at runtime.
 
-    gen.write_line("addWorldMapEntrance(0x5436, 0x01, \"Slum Outskirts\", 185586, 120034);", 4)
-    gen.write_line("addWorldMapEntrance(0x546c, 0x02, \"Kalm\", 201654, 112270);", 4)
-    gen.write_line("addWorldMapEntrance(0x54a2, 0x03, \"Chocobo Farm\", 239232, 137553);", 4)
-    gen.write_line("addWorldMapEntrance(0x558c, 0x04, \"Mithril Mine\", 214151, 153662);", 4)
-    gen.write_line("addWorldMapEntrance(0x55c2, 0x05, \"Mithril Mine\", 209488, 157306);", 4)
-    gen.write_line("addWorldMapEntrance(0x55f8, 0x06, \"Base of Fort Condor\", 203336, 169536);", 4)
-    gen.write_line("addWorldMapEntrance(0x562e, 0x07, \"Under Junon\", 169850, 146365);", 4)
-    gen.write_line("addWorldMapEntrance(0x5670, 0x08, \"Temple of the Ancients\", 169981, 182279);", 4)
-    gen.write_line("addWorldMapEntrance(0x56a6, 0x09, \"Old Man's House\", 198726, 133446);", 4)
-    gen.write_line("addWorldMapEntrance(0x56dc, 0x0A, \"Weapon Seller\", 129280, 173309);", 4)
-    gen.write_line("addWorldMapEntrance(0x5712, 0x0B, \"Mideel\", 220157, 201688);", 4)
-    gen.write_line("addWorldMapEntrance(0x5768, 0x0C, \"Materia Cave\", 274268, 140114);", 4)
-    gen.write_line("addWorldMapEntrance(0x579e, 0x0D, \"Costa del Sol\", 140866, 124836);", 4)
-    gen.write_line("addWorldMapEntrance(0x57e0, 0x0E, \"Mt. Corel\", 112985, 121747);", 4)
-    gen.write_line("addWorldMapEntrance(0x5816, 0x0F, \"North Corel\", 109337, 125402);", 4)
-    gen.write_line("addWorldMapEntrance(0x5866, 0x10, \"Corel Desert\", 120383, 154118);", 4)
-    gen.write_line("addWorldMapEntrance(0x5884, 0x11, \"Jungle\", 112914, 182638);", 4)
-    gen.write_line("addWorldMapEntrance(0x58ba, 0x12, \"Cosmo Canyon\", 87246, 170237);", 4)
-    gen.write_line("addWorldMapEntrance(0x58f0, 0x13, \"Nibelheim\", 92529, 136292);", 4)
-    gen.write_line("addWorldMapEntrance(0x5926, 0x14, \"Rocket Town\", 83786, 120735);", 4)
-    gen.write_line("addWorldMapEntrance(0x597c, 0x15, \"???\", 102194, 141174);", 4)
-    gen.write_line("addWorldMapEntrance(0x59b2, 0x16, \"Materia Cave\", 116260, 109023);", 4)
-    gen.write_line("addWorldMapEntrance(0x59e8, 0x17, \"Wutai\", 37926, 88476);", 4)
-    gen.write_line("addWorldMapEntrance(0x5a90, 0x18, \"Materia Cave\", 53675, 128295);", 4)
-    gen.write_line("addWorldMapEntrance(0x5ac6, 0x19, \"Bone Village\", 156389, 89288);", 4)
-    gen.write_line("addWorldMapEntrance(0x5afc, 0x1A, \"Corel Valley Cave\", 158239, 71427);", 4)
-    gen.write_line("addWorldMapEntrance(0x5b32, 0x1B, \"Icicle Inn\", 129009, 72362);", 4)
-    gen.write_line("addWorldMapEntrance(0x5b68, 0x1C, \"Mystery House\", 146135, 70381);", 4)
-    gen.write_line("addWorldMapEntrance(0x5b9e, 0x1D, \"Materia Cave\", 263725, 13193);", 4)
-    gen.write_line("addWorldMapEntrance(0x5238, 0x20, \"Marshes\", 215007, 152937);", 4)
-    gen.write_line("addWorldMapEntrance(0x5286, 0x22, \"Wilderness\", 52951, 156334);", 4)
-    gen.write_line("addWorldMapEntrance(0x5bd4, 0x2B, \"Nibelheim\", 92389, 135817);", 4)
-    gen.write_line("addWorldMapEntrance(0x5c0a, 0x2C, \"Mt. Nibel\", 94085, 125897);", 4)
-    gen.write_line("addWorldMapEntrance(0x5c40, 0x2E, \"Mt. Nibel\", 88079, 132446);", 4)
-    gen.write_line("addWorldMapEntrance(0x5c76, 0x2F, \"Icicle Inn\", 129068, 71982);", 4)
-    gen.write_line("addWorldMapEntrance(0x5cbc, 0x30, \"Great Glacier\", 136858, 53523);", 4)
-    gen.write_line("addWorldMapEntrance(0x5cda, 0x39, \"Corel Valley\", 162994, 86357);", 4)
-    gen.write_line("addWorldMapEntrance(0x5d10, 0x3A, \"Forgotten Capital\", 162051, 81137);", 4)
-    gen.write_line("")
+    gen.addWorldMapEntrance(0x5436, 0x01, "Slum Outskirts", 185586, 120034)
+    gen.addWorldMapEntrance(0x546c, 0x02, "Kalm", 201654, 112270)
+    gen.addWorldMapEntrance(0x54a2, 0x03, "Chocobo Farm", 239232, 137553)
+    gen.addWorldMapEntrance(0x558c, 0x04, "Mithril Mine", 214151, 153662)
+    gen.addWorldMapEntrance(0x55c2, 0x05, "Mithril Mine", 209488, 157306)
+    gen.addWorldMapEntrance(0x55f8, 0x06, "Base of Fort Condor", 203336, 169536)
+    gen.addWorldMapEntrance(0x562e, 0x07, "Under Junon", 169850, 146365)
+    gen.addWorldMapEntrance(0x5670, 0x08, "Temple of the Ancients", 169981, 182279)
+    gen.addWorldMapEntrance(0x56a6, 0x09, "Old Man's House", 198726, 133446)
+    gen.addWorldMapEntrance(0x56dc, 0x0A, "Weapon Seller", 129280, 173309)
+    gen.addWorldMapEntrance(0x5712, 0x0B, "Mideel", 220157, 201688)
+    gen.addWorldMapEntrance(0x5768, 0x0C, "Materia Cave", 274268, 140114)
+    gen.addWorldMapEntrance(0x579e, 0x0D, "Costa del Sol", 140866, 124836)
+    gen.addWorldMapEntrance(0x57e0, 0x0E, "Mt. Corel", 112985, 121747)
+    gen.addWorldMapEntrance(0x5816, 0x0F, "North Corel", 109337, 125402)
+    gen.addWorldMapEntrance(0x5866, 0x10, "Corel Desert", 120383, 154118)
+    gen.addWorldMapEntrance(0x5884, 0x11, "Jungle", 112914, 182638)
+    gen.addWorldMapEntrance(0x58ba, 0x12, "Cosmo Canyon", 87246, 170237)
+    gen.addWorldMapEntrance(0x58f0, 0x13, "Nibelheim", 92529, 136292)
+    gen.addWorldMapEntrance(0x5926, 0x14, "Rocket Town", 83786, 120735)
+    gen.addWorldMapEntrance(0x597c, 0x15, "???", 102194, 141174)
+    gen.addWorldMapEntrance(0x59b2, 0x16, "Materia Cave", 116260, 109023)
+    gen.addWorldMapEntrance(0x59e8, 0x17, "Wutai", 37926, 88476)
+    gen.addWorldMapEntrance(0x5a90, 0x18, "Materia Cave", 53675, 128295)
+    gen.addWorldMapEntrance(0x5ac6, 0x19, "Bone Village", 156389, 89288)
+    gen.addWorldMapEntrance(0x5afc, 0x1A, "Corel Valley Cave", 158239, 71427)
+    gen.addWorldMapEntrance(0x5b32, 0x1B, "Icicle Inn", 129009, 72362)
+    gen.addWorldMapEntrance(0x5b68, 0x1C, "Mystery House", 146135, 70381)
+    gen.addWorldMapEntrance(0x5b9e, 0x1D, "Materia Cave", 263725, 13193)
+    gen.addWorldMapEntrance(0x5238, 0x20, "Marshes", 215007, 152937)
+    gen.addWorldMapEntrance(0x5286, 0x22, "Wilderness", 52951, 156334)
+    gen.addWorldMapEntrance(0x5bd4, 0x2B, "Nibelheim", 92389, 135817)
+    gen.addWorldMapEntrance(0x5c0a, 0x2C, "Mt. Nibel", 94085, 125897)
+    gen.addWorldMapEntrance(0x5c40, 0x2E, "Mt. Nibel", 88079, 132446)
+    gen.addWorldMapEntrance(0x5c76, 0x2F, "Icicle Inn", 129068, 71982)
+    gen.addWorldMapEntrance(0x5cbc, 0x30, "Great Glacier", 136858, 53523)
+    gen.addWorldMapEntrance(0x5cda, 0x39, "Corel Valley", 162994, 86357)
+    gen.addWorldMapEntrance(0x5d10, 0x3A, "Forgotten Capital", 162051, 81137)
 
     worldData = ff7.world.WorldBin(ff7.game.retrieveFile(discPath, "WORLD", "WORLD.BIN"))
 
     for region in worldData.encounterTables:
-        region_str = ""
-
-        first = True
-        for encounterSet in region:
-            if first:
-                region_str += listToCPPArray(encounterSet)
-            else:
-                region_str += ", " + listToCPPArray(encounterSet)
-
-            first = False
-
-        gen.write_line("addWorldMapEncounters(" + region_str + ");", 4)
-        
-    gen.write_line("")  
+        gen.addWorldMapEncounters(region)
 
 def outputBattles(gen, discPath, version):
     sceneBin = ff7.scene.Archive(ff7.game.retrieveFile(discPath, "BATTLE", "SCENE.BIN"))
@@ -365,7 +307,7 @@ def outputBattles(gen, discPath, version):
         scene = sceneBin.getScene(i)
 
         hasValidEnemies = False
-        enemyLevels = ""
+        enemyLevels = []
         enemies = scene.getEnemies(ff7.game.isJapanese(version))
         for enemy in enemies:
             if len(enemy.name) >= 2 and ord(enemy.name[0]) == 0x00EA and ord(enemy.name[1]) == 0x00FA:
@@ -373,29 +315,25 @@ def outputBattles(gen, discPath, version):
                 break
 
             if (enemy.name != "" and enemy.level != 255):
-                enemyLevels += ", " + str(enemy.level)
+                enemyLevels.append(enemy.level)
                 hasValidEnemies = True
             else:
-                enemyLevels += ", 255"
+                enemyLevels.append(255)
         
         if not hasValidEnemies:
             continue
 
-        gen.write_line("addBattleScene(" + str(i) + ", " + str(scene.enemyIDs[0]) + ", " + str(scene.enemyIDs[1]) + ", " + str(scene.enemyIDs[2]) + enemyLevels + ");", 4)
+        gen.addBattleScene(i, scene.enemyIDs[0:3], enemyLevels)
 
         formations = scene.getFormations()
         formationIndex = 0
         for formation in formations:
             formationID = (i * 4) + formationIndex
 
-            noEscape = "false"
-            if not formation.canEscape():
-                noEscape = "true"
-
-            gen.write_line("addBattleFormation(" + str(i) + ", " + str(formationID) + ", " + noEscape + ", " + listToCPPArray(formation.enemyIDs) + ", " + listToCPPArray(formation.battleArenaCandidates) + ");", 4)
+            noEscape = not formation.canEscape()
+            gen.addBattleFormation(i, formationID, noEscape, formation.enemyIDs, formation.battleArenaCandidates)
             formationIndex += 1
 
-    gen.write_line("")
 
 def outputShops(gen, discPath, verison):
     shopData = ff7.menu.ShopMenuData(ff7.game.retrieveFile(discPath, "MENU", "SHOPMENU.MNU"))
@@ -409,10 +347,9 @@ def outputShops(gen, discPath, verison):
             else:
                 items.append(item.id)
 
-        gen.write_line("addShop(" + str(shopID) + ", " + listToCPPArray(items) + ");", 4)
+        gen.addShop(shopID, items)
         shopID += 1
 
-    gen.write_line("")
 
 def outputBosses(gen, discPath, version):
     sceneBin = ff7.scene.Archive(ff7.game.retrieveFile(discPath, "BATTLE", "SCENE.BIN"))
@@ -522,9 +459,8 @@ def outputBosses(gen, discPath, version):
             uint64_elemTypes = f"0x{bytes(elementTypes).hex().upper()}ULL"
             uint64_elemRates = f"0x{bytes(elementRates).hex().upper()}ULL"
 
-            gen.write_line("addBoss(" + str(bossID) + ", \"" + final_name + "\", " + listToCPPArray(scenes) + ", " + uint64_elemTypes + ", " + uint64_elemRates + ");", 4)
+            gen.addBoss(bossID, final_name, scenes, uint64_elemTypes, uint64_elemRates)
 
-    gen.write_line("")
 
 def outputModel(modelName, model):
     parts_strings = []
@@ -533,7 +469,7 @@ def outputModel(modelName, model):
         model_part_string = "{" + str(len(part.quad_color_tex)) + ", " + str(len(part.tri_color_tex)) + ", " + str(len(part.quad_mono_tex)) + ", " + str(len(part.tri_mono_tex)) + ", " + str(len(part.tri_mono)) + ", " + str(len(part.quad_mono)) + ", " + str(len(part.tri_color)) + ", " + str(len(part.quad_color)) + "}"
         parts_strings.append(model_part_string)
 
-    gen.write_line("addModel(\"" + modelName + "\", " + str(model.poly_count) + ", " + listToCPPArray(parts_strings) + ");", 4)
+    gen.addModel(modelName, model.poly_count, parts_strings)
 
 def outputModelFromField(discPath, fieldFile, modelIndex, modelName):
     models = ff7.models.loadModelsFromBSX(ff7.game.retrieveFile(discPath, "FIELD", fieldFile), discPath)
@@ -575,8 +511,7 @@ def outputModels(gen, discPath, version):
     outputModelFromField(discPath, "FSHIP_12.BSX", 5, "YUFFIE_PARACHUTE")
 
     # Clouds model is slightly different on the world map for some reason, this was extracted from memory.
-    gen.write_line("addModel(\"CLOUD_WORLD\", 378, {{0, 0, 0, 0, 0, 0, 12, 6}, {0, 0, 0, 0, 0, 0, 6, 27}, {2, 4 + 2, 0, 0, 0, 0, 148 + 2, 12 + 1}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 10, 9}, {0, 0, 0, 0, 0, 0, 0, 14}, {0, 0, 0, 0, 0, 0, 0, 6}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}, {0, 0, 0, 0, 0, 0, 8, 4}, {0, 0, 0, 0, 0, 0, 4, 14}, {0, 0, 0, 0, 0, 0, 2, 7}});", 4)
-    gen.write_line("")
+    gen.addModel("CLOUD_WORLD", 378, ["{0, 0, 0, 0, 0, 0, 12, 6}", "{0, 0, 0, 0, 0, 0, 6, 27}", "{2, 4 + 2, 0, 0, 0, 0, 148 + 2, 12 + 1}", "{0, 0, 0, 0, 0, 0, 10, 9}", "{0, 0, 0, 0, 0, 0, 0, 14}", "{0, 0, 0, 0, 0, 0, 0, 6}", "{0, 0, 0, 0, 0, 0, 10, 9}", "{0, 0, 0, 0, 0, 0, 0, 14}", "{0, 0, 0, 0, 0, 0, 0, 6}", "{0, 0, 0, 0, 0, 0, 8, 4}", "{0, 0, 0, 0, 0, 0, 4, 14}", "{0, 0, 0, 0, 0, 0, 2, 7}", "{0, 0, 0, 0, 0, 0, 8, 4}", "{0, 0, 0, 0, 0, 0, 4, 14}", "{0, 0, 0, 0, 0, 0, 2, 7}"])
 
     # Battle Models
     battleModelFiles = {"BARRET":   "BARRETT.LZS", 
@@ -618,7 +553,7 @@ def outputModels(gen, discPath, version):
 
             part_strings.append("{" + str(totalSize) + ", " + str(len(part.vertices)) + ", " + str(len(part.tri_mono_tex)) + ", " + str(len(part.quad_mono_tex)) + ", " + str(len(part.tri_color)) + ", " + str(len(part.quad_color)) + "}")
             
-        gen.write_line("addBattleModel(\"" + modelName + "\", " + listToCPPArray(battleModelHeaderSizes[modelName]) + ", " + listToCPPArray(part_strings) + ");", 4)
+        gen.addBattleModel(modelName, battleModelHeaderSizes[modelName], part_strings)
 
 discPath = sys.argv[1]
 
@@ -629,8 +564,6 @@ if not os.path.isdir(discPath):
 version, discNumber, execFileName = ff7.game.checkDisc(discPath)
 
 gen = GameDataGenerator()
-gen.open_file()
-gen.write_header()
 
 outputInventory(gen, discPath, version)
 outputOther(gen, discPath, version)
@@ -641,5 +574,4 @@ outputBattles(gen, discPath, version)
 outputBosses(gen, discPath, version)
 outputModels(gen, discPath, version)
 
-gen.write_footer()
-gen.close_file()
\ No newline at end of file
+gen.write()